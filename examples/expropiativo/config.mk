@@ -13,3 +13,6 @@ FREERTOS_HEAP_TYPE=4
 LOAD_INRAM=n
 
 DEFINES += CPU=lpc4337
+
+# El cambio de contexto esta escrito en ensamblador de ARM
+HOST_BUILD=n
@@ -0,0 +1,176 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DISPLAY_SERVER_H
+#define DISPLAY_SERVER_H
+
+/** @brief Servidor asincrónico de la pantalla ILI9341
+ **
+ ** Las funciones de dibujo de ili9341.c esperan a que el SPI termine de
+ ** enviar cada bloque, por lo que la tarea que dibuja ocupa el procesador
+ ** mientras salen los pixeles. Con el servidor las tareas de la aplicación
+ ** publican comandos de dibujo en una cola y siguen sin esperar; una tarea
+ ** dedicada los junta en lotes, descarta los que un comando posterior del
+ ** mismo lugar reemplaza y los dibuja en franjas de pixeles:
+ **
+ **     static uint8_t franjas[8192] __attribute__((section(".bss.$RamAHB32"), aligned(4)));
+ **
+ **     DisplayServerStart(franjas, sizeof(franjas), tskIDLE_PRIORITY + 1);
+ **     ...
+ **     DisplayServerString(100, 25, reloj, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+ **     DisplayServerFrame(xTaskGetCurrentTaskHandle());
+ **     ulTaskNotifyTake(pdTRUE, portMAX_DELAY);      // opcional, espera el cuadro
+ **
+ ** La memoria de las franjas se divide en dos: mientras el DMA envia una
+ ** franja el servidor compone la siguiente en la otra mitad. El fin de cada
+ ** transferencia despierta al servidor con una notificación desde la
+ ** interrupción del SPI, y el fin de cada cuadro se avisa con una
+ ** notificación a la tarea indicada.
+ **
+ ** Una vez iniciado el servidor es el único que debe dibujar en la pantalla,
+ ** que se inicializa antes con ILI9341Init en el puerto SPI_1.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup display_server Servidor de pantalla
+ ** @brief Dibujo en la pantalla ILI9341 sin bloquear a las tareas de la aplicación
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fonts.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Cantidad de comandos que esperan en la cola del servidor */
+#ifndef DISPLAY_SERVER_QUEUE
+#define DISPLAY_SERVER_QUEUE     16
+#endif
+
+/** @brief Cantidad de comandos que el servidor junta en un lote */
+#ifndef DISPLAY_SERVER_BATCH
+#define DISPLAY_SERVER_BATCH     16
+#endif
+
+/** @brief Caracteres de una cadena que se copian en el comando, el resto se descarta */
+#ifndef DISPLAY_SERVER_TEXT
+#define DISPLAY_SERVER_TEXT      16
+#endif
+
+/** @brief Tamaño de la pila de la tarea del servidor */
+#ifndef DISPLAY_SERVER_STACK
+#define DISPLAY_SERVER_STACK     ( configMINIMAL_STACK_SIZE * 2 )
+#endif
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Estadisticas del servidor, los tiempos en ciclos de Cycles_Frequency */
+typedef struct display_server_stats_s {
+   uint32_t commands;            /*!< Comandos publicados */
+   uint32_t dropped;             /*!< Comandos descartados porque la cola estaba llena */
+   uint32_t replaced;            /*!< Comandos reemplazados por uno posterior del mismo lugar */
+   uint32_t batches;             /*!< Lotes dibujados */
+   uint32_t frames;              /*!< Cuadros terminados */
+   uint32_t frames_per_second;   /*!< Cuadros terminados en el ultimo segundo */
+   uint32_t bands;               /*!< Franjas enviadas */
+   uint32_t pixels;              /*!< Pixeles enviados */
+   uint32_t waits;               /*!< Veces que el servidor espero el fin de una transferencia */
+   uint32_t render;              /*!< Ciclos ocupados en componer las franjas */
+   uint32_t post_max;            /*!< Duración de la publicación mas larga */
+   uint32_t post_average;        /*!< Duración promedio de una publicación */
+} DisplayServerStats_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Crea la cola y la tarea del servidor
+ **
+ ** Las franjas tienen el ancho del comando que se dibuja y tantas lineas
+ ** como entren en la mitad de la memoria. Un comando con lineas mas largas
+ ** que la mitad de la memoria se dibuja directamente con ili9341.c. Usa el
+ ** contador de ciclos, que se habilita con Init_Cycles.
+ **
+ ** @param[in] bands      Memoria para dos franjas, alineada a 4 bytes y accesible por el DMA
+ ** @param[in] size       Tamaño de la memoria en bytes
+ ** @param[in] priority   Prioridad de la tarea del servidor
+ ** @return pdPASS si se creo el servidor
+ */
+BaseType_t DisplayServerStart(uint8_t * bands, size_t size, UBaseType_t priority);
+
+/** @brief Publica una cadena de una linea, termina en un cero o un salto de linea
+ **
+ ** @return pdPASS si el comando entro en la cola, pdFAIL si se descarto
+ */
+BaseType_t DisplayServerString(uint16_t x, uint16_t y, const char * text, Font_t * font,
+                               uint16_t foreground, uint16_t background);
+
+/** @brief Publica un rectángulo relleno entre dos esquinas opuestas incluidas
+ **
+ ** @return pdPASS si el comando entro en la cola, pdFAIL si se descarto
+ */
+BaseType_t DisplayServerRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                  uint16_t color);
+
+/** @brief Publica el fin de un cuadro
+ **
+ ** El servidor dibuja lo publicado antes sin esperar mas comandos y, al
+ ** terminar de enviarlo, actualiza los cuadros por segundo y da una
+ ** notificación a la tarea indicada, que puede esperarla con
+ ** ulTaskNotifyTake.
+ **
+ ** @param[in] notify     Tarea a notificar, NULL si ninguna
+ ** @return pdPASS si el comando entro en la cola, pdFAIL si se descarto
+ */
+BaseType_t DisplayServerFrame(TaskHandle_t notify);
+
+/** @brief Obtiene las estadisticas del servidor */
+void DisplayServerGetStats(DisplayServerStats_t * stats);
+
+/** @brief Pone en cero las estadisticas del servidor */
+void DisplayServerClearStats(void);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* DISPLAY_SERVER_H */
@@ -0,0 +1,137 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HEAP_REGIONS_H
+#define HEAP_REGIONS_H
+
+/** @brief Heap distribuido en los bancos de RAM con clases de ubicación
+ **
+ ** Con FREERTOS_HEAP_TYPE=5 el heap se arma automáticamente con el espacio
+ ** que el enlazador deja libre al final de cada banco de RAM, definido por
+ ** los símbolos _pvHeapStart_<banco> y _pvHeapLimit_<banco> de los archivos
+ ** libs/lpc_open/lib/link.ld y flat.ld, sin llamar a vPortDefineHeapRegions.
+ **
+ ** Los bancos no son equivalentes: el CPU accede a las RAM locales por su
+ ** propio puerto de la matriz de buses, mientras que las RAM AHB comparten
+ ** puerto con el DMA y los periféricos. Por eso cada pedido puede indicar
+ ** una clase de ubicación:
+ **
+ **     pixeles = HeapRegionsAlloc(HEAP_CLASS_AHB, 240 * 2 * 16);   // origen de un DMA
+ **     ... transferir ...
+ **     vPortFree(pixeles);
+ **
+ ** pvPortMalloc recorre los bloques libres por dirección creciente, por lo
+ ** que las pilas y los TCB de las tareas, y los pedidos con HEAP_CLASS_ANY,
+ ** ocupan primero la RAM local y solo pasan a las RAM AHB cuando esta se
+ ** llena.
+ **
+ ** Con cualquier otro heap la clase se ignora y HeapRegionsAlloc equivale a
+ ** pvPortMalloc. En PLATFORM=host los bancos se simulan con un arreglo
+ ** estático dividido en partes del tamaño de cada banco.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup heap_regions Heap en los bancos de RAM
+ ** @brief Ubicación de las asignaciones dinámicas según el banco de RAM
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Clases de ubicación de una asignación */
+typedef enum heap_class_e {
+   HEAP_CLASS_ANY = 0,        /*!< Cualquier banco, primero la RAM local */
+   HEAP_CLASS_LOCAL,          /*!< RamLoc32 o RamLoc40: pilas, TCB y datos usados por el CPU */
+   HEAP_CLASS_AHB,            /*!< RamAHB32, RamAHB16 o RamAHB_ETB16: buffers de DMA */
+} HeapClass_t;
+
+/** @brief Descripción de un banco de RAM usado por el heap */
+typedef struct heap_region_info_s {
+   const char * name;         /*!< Nombre de la región en libs/lpc_open/lib/mem.ld */
+   HeapClass_t placement;     /*!< Clase de ubicación a la que pertenece */
+   uint8_t * start;           /*!< Primer byte libre */
+   size_t size;               /*!< Cantidad de bytes libres al iniciar el programa */
+} HeapRegionInfo_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Define las regiones del heap_5 con el espacio libre de cada banco
+ **
+ ** La llama heap_5 en la primer asignación si la aplicación no llamo antes a
+ ** vPortDefineHeapRegions, por lo que normalmente no es necesario usarla.
+ */
+void HeapRegionsInit(void);
+
+/** @brief Asigna memoria en un banco de la clase indicada
+ **
+ ** @param[in] placement  Clase de ubicación de la asignación
+ ** @param[in] size       Tamaño pedido en bytes
+ ** @return Puntero a la memoria, que se libera con vPortFree, o NULL si ningún banco de la
+ **         clase tiene un bloque libre suficientemente grande
+ */
+void * HeapRegionsAlloc(HeapClass_t placement, size_t size);
+
+/** @brief Clase de ubicación del banco que contiene una dirección
+ **
+ ** @return HEAP_CLASS_LOCAL o HEAP_CLASS_AHB, o HEAP_CLASS_ANY si la dirección no pertenece
+ **         a ninguno de los bancos del heap
+ */
+HeapClass_t HeapRegionsClassOf(const void * pointer);
+
+/** @brief Obtiene la descripción de uno de los bancos usados por el heap
+ **
+ ** @param[in] index      Número de banco, en orden de direcciones crecientes
+ ** @param[out] info      Descripción del banco
+ ** @return pdTRUE si el banco existe o pdFALSE si index es mayor al último banco
+ */
+BaseType_t HeapRegionsGet(UBaseType_t index, HeapRegionInfo_t * info);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* HEAP_REGIONS_H */
@@ -0,0 +1,188 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+/** @brief Conjuntos de bloques de memoria de tamaño fijo
+ **
+ ** Los objetos del mismo tamaño que se piden y devuelven continuamente, como
+ ** los elementos de una cola, los comandos de una pantalla o las tramas de
+ ** una UART, se obtienen de un conjunto de bloques reservado de antemano en
+ ** lugar del heap. Pedir y devolver un bloque es una sección critica de unas
+ ** pocas instrucciones, que se puede usar desde tareas y desde interrupciones
+ ** y no fragmenta la memoria:
+ **
+ **     MEM_POOL_BUFFER(tramas, 8, 64, RamAHB32);        // 8 bloques de 64 bytes
+ **
+ **     conjunto = MemPoolCreate(8, 64, tramas);
+ **     trama = MemPoolAlloc(conjunto, pdMS_TO_TICKS(10));
+ **     ... usar la trama ...
+ **     MemPoolFree(conjunto, trama);
+ **
+ ** Los bloques se reservan con pvPortMalloc o en una memoria provista por la
+ ** aplicación, que con MEM_POOL_BUFFER se ubica en uno de los bancos de RAM
+ ** definidos en libs/lpc_open/lib/mem.ld. Cuando no quedan bloques libres la
+ ** tarea que pide uno puede esperar a que otra lo devuelva.
+ **
+ ** Para objetos de tamaño variable se puede usar un arreglo de conjuntos
+ ** ordenado por tamaño de bloque como clases de tamaño: MemPoolClassAlloc
+ ** entrega un bloque del conjunto mas chico que tenga lugar para el pedido.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup mem_pool Conjuntos de bloques
+ ** @brief Asignación de bloques de memoria de tamaño fijo en tiempo constante
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Tamaño que ocupa cada bloque, redondeado al alineamiento del port */
+#define MEM_POOL_BLOCK_SIZE(size)                                                                  \
+   ((((size) < sizeof(void *) ? sizeof(void *) : (size)) + portBYTE_ALIGNMENT - 1) &               \
+    ~((size_t) portBYTE_ALIGNMENT - 1))
+
+/** @brief Define la memoria para los bloques de un conjunto en un banco de RAM
+ **
+ ** El banco es el nombre de una de las regiones de libs/lpc_open/lib/mem.ld,
+ ** RamLoc40, RamAHB32, RamAHB16 o RamAHB_ETB16, o su alias RAM2 a RAM5 del
+ ** archivo link.ld. La memoria se pone en cero al iniciar el programa.
+ */
+#define MEM_POOL_BUFFER(name, count, size, bank)                                                   \
+   static uint8_t name[(count) * MEM_POOL_BLOCK_SIZE(size)]                                        \
+      __attribute__((section(".bss.$" #bank), aligned(portBYTE_ALIGNMENT)))
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Referencia a un conjunto de bloques */
+typedef struct mem_pool_s * MemPoolHandle_t;
+
+/** @brief Estadisticas de uso de un conjunto de bloques */
+typedef struct mem_pool_stats_s {
+   size_t size;               /*!< Tamaño de cada bloque incluyendo el relleno de alineación */
+   UBaseType_t count;         /*!< Cantidad de bloques */
+   UBaseType_t used;          /*!< Bloques entregados que no se devolvieron */
+   UBaseType_t high_water;    /*!< Mayor cantidad de bloques entregados al mismo tiempo */
+   uint32_t allocations;      /*!< Pedidos atendidos */
+   uint32_t failures;         /*!< Pedidos que terminaron sin obtener un bloque */
+} MemPoolStats_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Crea un conjunto de bloques
+ **
+ ** @param[in] count      Cantidad de bloques
+ ** @param[in] size       Tamaño de cada bloque en bytes
+ ** @param[in] buffer     Memoria para los bloques, de al menos count * MEM_POOL_BLOCK_SIZE(size)
+ **                       bytes y alineada al port, o NULL para reservarla con pvPortMalloc
+ ** @return Referencia al conjunto creado o NULL si no hay memoria suficiente
+ */
+MemPoolHandle_t MemPoolCreate(UBaseType_t count, size_t size, void * buffer);
+
+/** @brief Elimina un conjunto, y sus bloques si fueron reservados con pvPortMalloc
+ **
+ ** Ninguna tarea debe estar usando el conjunto ni alguno de sus bloques.
+ */
+void MemPoolDelete(MemPoolHandle_t pool);
+
+/** @brief Obtiene un bloque libre
+ **
+ ** @param[in] pool       Conjunto del que se pide el bloque
+ ** @param[in] wait       Ticks de espera si no hay bloques libres
+ ** @return Puntero al bloque o NULL si no se devolvio ninguno en el tiempo de espera
+ */
+void * MemPoolAlloc(MemPoolHandle_t pool, TickType_t wait);
+
+/** @brief Obtiene un bloque libre desde una interrupción, sin esperar */
+void * MemPoolAllocFromISR(MemPoolHandle_t pool);
+
+/** @brief Devuelve un bloque al conjunto del que se obtuvo */
+void MemPoolFree(MemPoolHandle_t pool, void * block);
+
+/** @brief Devuelve un bloque desde una interrupción */
+void MemPoolFreeFromISR(MemPoolHandle_t pool, void * block, BaseType_t * woken);
+
+/** @brief Verifica que un puntero sea el inicio de uno de los bloques del conjunto */
+BaseType_t MemPoolContains(MemPoolHandle_t pool, const void * block);
+
+/** @brief Cantidad de bloques libres */
+UBaseType_t MemPoolAvailable(MemPoolHandle_t pool);
+
+/** @brief Tamaño de cada bloque incluyendo el relleno de alineación */
+size_t MemPoolBlockSize(MemPoolHandle_t pool);
+
+/** @brief Obtiene las estadisticas de uso de un conjunto */
+void MemPoolGetStats(MemPoolHandle_t pool, MemPoolStats_t * stats);
+
+/** @brief Obtiene un bloque de la clase de tamaño mas chica con lugar para el pedido
+ **
+ ** Si ninguna de las clases con bloques suficientemente grandes tiene uno
+ ** libre espera en la mas chica de ellas.
+ **
+ ** @param[in] classes    Conjuntos ordenados de menor a mayor tamaño de bloque
+ ** @param[in] count      Cantidad de conjuntos
+ ** @param[in] size       Tamaño pedido en bytes
+ ** @param[in] wait       Ticks de espera si no hay bloques libres
+ ** @return Puntero al bloque o NULL si no se obtuvo ninguno en el tiempo de espera
+ */
+void * MemPoolClassAlloc(const MemPoolHandle_t classes[], UBaseType_t count, size_t size,
+                         TickType_t wait);
+
+/** @brief Obtiene un bloque de una clase de tamaño desde una interrupción, sin esperar */
+void * MemPoolClassAllocFromISR(const MemPoolHandle_t classes[], UBaseType_t count, size_t size);
+
+/** @brief Devuelve un bloque a la clase de tamaño a la que pertenece */
+void MemPoolClassFree(const MemPoolHandle_t classes[], UBaseType_t count, void * block);
+
+/** @brief Devuelve un bloque a su clase de tamaño desde una interrupción */
+void MemPoolClassFreeFromISR(const MemPoolHandle_t classes[], UBaseType_t count, void * block,
+                             BaseType_t * woken);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* MEM_POOL_H */
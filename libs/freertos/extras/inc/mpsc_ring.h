@@ -0,0 +1,165 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MPSC_RING_H
+#define MPSC_RING_H
+
+/** @brief Anillo sin bloqueos con varios productores y un consumidor
+ **
+ ** Permite que varias rutinas de servicio de interrupción, de cualquier
+ ** prioridad y aun anidadas entre si, agreguen elementos de tamaño fijo sin
+ ** enmascarar interrupciones, y que una única tarea los reciba bloqueandose
+ ** mientras el anillo esta vacío:
+ **
+ **     void UART2_IRQHandler(void) {                  // productor
+ **        BaseType_t woken = pdFALSE;
+ **        uint8_t dato = Chip_UART_ReadByte(LPC_USART2);
+ **        MpscRingSendFromISR(anillo, &dato, &woken);
+ **        portYIELD_FROM_ISR(woken);
+ **     }
+ **
+ **     while (MpscRingReceive(anillo, &dato, portMAX_DELAY) == pdPASS) {   // consumidor
+ **        ... procesar el dato ...
+ **     }
+ **
+ ** Cada productor reserva una posición del anillo con una operación atómica
+ ** (LDREX/STREX en el Cortex-M4), copia su elemento y lo publica. Una
+ ** interrupción que desplaza a otra en medio de una reserva solo provoca que
+ ** la desplazada repita la operación, nunca que se pierda o se duplique un
+ ** elemento.
+ **
+ ** MpscRingWrite no llama al kernel, por lo que puede usarse desde
+ ** interrupciones con prioridad mayor a configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ ** En ese caso la tarea consumidora no se despierta hasta que una interrupción
+ ** de menor prioridad o una tarea llame a MpscRingNotifyFromISR o envie otro
+ ** elemento.
+ **
+ ** El consumidor se despierta con una notificación directa a la tarea, por lo
+ ** que la tarea que recibe no debe usar sus notificaciones para otro fin. El
+ ** anillo admite una sola tarea consumidora.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup mpsc_ring Anillos de varios productores
+ ** @brief Transferencia de datos desde interrupciones sin secciones criticas
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Referencia a un anillo de varios productores */
+typedef struct mpsc_ring_s * MpscRingHandle_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Crea un anillo vacío
+ **
+ ** @param[in] length     Cantidad de elementos, debe ser una potencia de dos
+ ** @param[in] size       Tamaño de cada elemento en bytes
+ ** @return Referencia al anillo creado o NULL si no hay memoria suficiente
+ */
+MpscRingHandle_t MpscRingCreate(UBaseType_t length, size_t size);
+
+/** @brief Elimina un anillo
+ **
+ ** Ninguna tarea ni interrupción debe estar usando el anillo.
+ */
+void MpscRingDelete(MpscRingHandle_t ring);
+
+/** @brief Agrega un elemento sin despertar a la tarea consumidora
+ **
+ ** Puede llamarse desde cualquier contexto, incluso desde interrupciones que
+ ** no pueden usar la API de FreeRTOS.
+ **
+ ** @param[in] ring       Anillo en el que se agrega el elemento
+ ** @param[in] item       Puntero al elemento que se copia en el anillo
+ ** @return pdPASS si se agrego el elemento o errQUEUE_FULL si el anillo esta lleno
+ */
+BaseType_t MpscRingWrite(MpscRingHandle_t ring, const void * item);
+
+/** @brief Agrega un elemento desde una tarea y despierta a la tarea consumidora */
+BaseType_t MpscRingSend(MpscRingHandle_t ring, const void * item);
+
+/** @brief Agrega un elemento desde una interrupción y despierta a la tarea consumidora
+ **
+ ** @param[in] ring       Anillo en el que se agrega el elemento
+ ** @param[in] item       Puntero al elemento que se copia en el anillo
+ ** @param[out] woken     Se pone en pdTRUE si se desperto una tarea de mayor prioridad
+ ** @return pdPASS si se agrego el elemento o errQUEUE_FULL si el anillo esta lleno
+ */
+BaseType_t MpscRingSendFromISR(MpscRingHandle_t ring, const void * item, BaseType_t * woken);
+
+/** @brief Despierta a la tarea consumidora si esta esperando y hay elementos
+ **
+ ** Completa las escrituras hechas con MpscRingWrite desde interrupciones de
+ ** prioridad mayor a configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ */
+void MpscRingNotifyFromISR(MpscRingHandle_t ring, BaseType_t * woken);
+
+/** @brief Recibe el elemento mas antiguo del anillo
+ **
+ ** Solo puede llamarse desde una tarea y siempre desde la misma.
+ **
+ ** @param[in] ring       Anillo del que se recibe
+ ** @param[out] item      Puntero al lugar donde se copia el elemento
+ ** @param[in] wait       Ticks de espera si el anillo esta vacío
+ ** @return pdPASS si se recibio un elemento o errQUEUE_EMPTY si no llego ninguno en el tiempo de espera
+ */
+BaseType_t MpscRingReceive(MpscRingHandle_t ring, void * item, TickType_t wait);
+
+/** @brief Cantidad de elementos en el anillo, incluyendo los que un productor esta copiando */
+UBaseType_t MpscRingItemsWaiting(MpscRingHandle_t ring);
+
+/** @brief Cantidad de elementos descartados porque el anillo estaba lleno */
+uint32_t MpscRingDropped(MpscRingHandle_t ring);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* MPSC_RING_H */
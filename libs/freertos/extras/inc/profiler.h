@@ -0,0 +1,172 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/** @brief Perfilador estadistico por muestreo
+ **
+ ** Una interrupción periodica de la mayor prioridad toma la dirección de la
+ ** instrucción interrumpida y la tarea en ejecución, y cuenta las muestras
+ ** de cada par en un histograma en RAM. La función en la que el programa
+ ** pasa mas tiempo es la que acumula mas muestras, sin instrumentar el
+ ** código ni recompilarlo:
+ **
+ **     ProfilerStart(1000);                      // 1000 muestras por segundo
+ **     ...                                       // carga a medir
+ **     ProfilerStop();
+ **     ProfilerDump(Enviar);
+ **
+ ** ProfilerDump envia el histograma como lineas de texto que pueden
+ ** mezclarse con otros mensajes en la USB-UART, y
+ ** scripts/profile/symbolize.py las convierte en un perfil plano por
+ ** función, con la tabla de simbolos .names.csv o el .elf que genera la
+ ** compilación, y en pilas plegadas "tarea;función muestras" para
+ ** flamegraph.pl o speedscope.app.
+ **
+ ** En la EDU-CIAA el muestreo lo hace el RITIMER con prioridad 0, por
+ ** encima de configMAX_SYSCALL_INTERRUPT_PRIORITY, por lo que también se
+ ** muestrean las secciones criticas del kernel y las demas interrupciones,
+ ** que aparecen como la tarea "[isr]". El módulo define RIT_IRQHandler, por
+ ** lo que el proyecto no puede usar el RITIMER para otro fin. En la PC el
+ ** muestreo lo hace la señal SIGPROF, que cuenta el tiempo de procesador del
+ ** proceso, y las direcciones fuera del programa, como las de la biblioteca
+ ** de C, aparecen como "[externo]". Linux revisa ese temporizador en cada
+ ** tick de su planificador, por lo que en la PC se obtienen a lo sumo unas
+ ** 250 muestras por segundo aunque se pida una frecuencia mayor.
+ **
+ ** Los nombres de las tareas se leen al enviar el histograma, por lo que no
+ ** deben eliminarse tareas mientras se perfila.
+ **
+ ** Para habilitarlo el proyecto define configUSE_PROFILER en 1 en
+ ** FreeRTOSConfig.h junto con INCLUDE_xTaskGetCurrentTaskHandle.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup profiler Perfilador
+ ** @brief Perfil del uso del procesador por función y tarea
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+#ifndef configUSE_PROFILER
+#define configUSE_PROFILER                      0
+#endif
+
+#if ( configUSE_PROFILER == 1 )
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+#error El perfilador requiere INCLUDE_xTaskGetCurrentTaskHandle en 1
+#endif
+
+/** @brief Cantidad de pares de dirección y tarea distintos del histograma, potencia de dos */
+#ifndef configPROFILER_SLOTS
+#define configPROFILER_SLOTS                    256
+#endif
+
+/** @brief Cantidad de tareas distintas que se pueden muestrear entre dos ProfilerClear */
+#ifndef configPROFILER_TASKS
+#define configPROFILER_TASKS                    16
+#endif
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Resumen del muestreo */
+typedef struct profiler_stats_s {
+   uint32_t frequency;           /*!< Muestras por segundo */
+   uint32_t samples;             /*!< Muestras contadas en el histograma */
+   uint32_t dropped;             /*!< Muestras descartadas por estar llenos el histograma o las tareas */
+   uint32_t used;                /*!< Pares distintos del histograma */
+} profiler_stats_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Comienza a tomar muestras, sin borrar las anteriores
+ **
+ ** @param[in] frequency  Muestras por segundo
+ */
+void ProfilerStart(uint32_t frequency);
+
+/** @brief Deja de tomar muestras, el histograma se conserva */
+void ProfilerStop(void);
+
+/** @brief Borra el histograma, debe llamarse con el muestreo detenido */
+void ProfilerClear(void);
+
+/** @brief Obtiene el resumen del muestreo
+ **
+ ** @param[out] stats     Resumen del muestreo
+ */
+void ProfilerGetStats(profiler_stats_t * stats);
+
+/** @brief Envia el histograma como lineas de texto
+ **
+ ** Debe llamarse con el muestreo detenido. Cada linea se entrega a la función
+ ** de salida terminada con "\r\n":
+ **
+ **     @profile-begin hz=1000 samples=5000 dropped=0 ref=0x1a0012c5
+ **     @profile-task 0x1 Control
+ **     @profile 0x1a0034f6 0x1 812
+ **     @profile-end
+ **
+ ** Cada linea @profile tiene la dirección, el numero de la tarea, o cero
+ ** para las interrupciones, y la cantidad de muestras. Los nombres de las
+ ** lineas @profile-task se copian al tomar las muestras, por lo que las
+ ** tareas pueden haberse borrado antes del envio. ref es la dirección de
+ ** ProfilerStart en ejecución, que permite ubicar el programa cuando el
+ ** sistema lo carga en otra dirección que la del .elf.
+ **
+ ** @param[in] output     Función que envia cada linea
+ */
+void ProfilerDump(void (*output)(const char * text));
+
+#endif /* configUSE_PROFILER */
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* PROFILER_H */
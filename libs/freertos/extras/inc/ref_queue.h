@@ -0,0 +1,149 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef REF_QUEUE_H
+#define REF_QUEUE_H
+
+/** @brief Colas de referencias con bloques de memoria propios
+ **
+ ** Una cola de FreeRTOS copia cada elemento dos veces, al enviarlo y al
+ ** recibirlo. Para elementos grandes, como bloques de muestras o partes de
+ ** una imagen, es mas eficiente pasar solo la referencia a un bloque que
+ ** cambia de dueño:
+ **
+ **     bloque = RefQueueAcquire(cola, portMAX_DELAY);   // productor
+ **     ... completar el bloque ...
+ **     RefQueueSend(cola, bloque);
+ **
+ **     bloque = RefQueueReceive(cola, portMAX_DELAY);   // consumidor
+ **     ... usar el bloque ...
+ **     RefQueueRelease(cola, bloque);
+ **
+ ** Cada cola tiene un conjunto fijo de bloques del mismo tamaño reservados al
+ ** crearla, por lo que enviar y recibir no usa el heap. Como hay tantos
+ ** bloques como lugares en la cola el envio nunca se bloquea, y cuando el
+ ** consumidor se atrasa el productor espera en RefQueueAcquire a que se
+ ** libere un bloque.
+ **
+ ** Entre la obtención y el envio el bloque pertenece al productor, y entre
+ ** la recepción y la liberación al consumidor. Ninguna otra tarea debe
+ ** usarlo en ese tiempo.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup ref_queue Colas de referencias
+ ** @brief Transferencia de bloques de memoria entre tareas sin copias
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+#include "queue.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Referencia a una cola de referencias */
+typedef struct ref_queue_s * RefQueueHandle_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Crea una cola de referencias con sus bloques
+ **
+ ** @param[in] length     Cantidad de bloques, que es tambien la capacidad de la cola
+ ** @param[in] size       Tamaño de cada bloque en bytes
+ ** @return Referencia a la cola creada o NULL si no hay memoria suficiente
+ */
+RefQueueHandle_t RefQueueCreate(UBaseType_t length, size_t size);
+
+/** @brief Elimina una cola de referencias y libera sus bloques
+ **
+ ** Ninguna tarea debe estar usando la cola ni alguno de sus bloques.
+ */
+void RefQueueDelete(RefQueueHandle_t queue);
+
+/** @brief Obtiene un bloque libre para completarlo
+ **
+ ** @param[in] queue      Cola a la que pertenece el bloque
+ ** @param[in] wait       Ticks de espera si no hay bloques libres
+ ** @return Puntero al bloque o NULL si no se libero ninguno en el tiempo de espera
+ */
+void * RefQueueAcquire(RefQueueHandle_t queue, TickType_t wait);
+
+/** @brief Obtiene un bloque libre desde una interrupción, sin esperar */
+void * RefQueueAcquireFromISR(RefQueueHandle_t queue, BaseType_t * woken);
+
+/** @brief Envia un bloque obtenido con RefQueueAcquire al final de la cola */
+void RefQueueSend(RefQueueHandle_t queue, void * block);
+
+/** @brief Envia un bloque desde una interrupción */
+void RefQueueSendFromISR(RefQueueHandle_t queue, void * block, BaseType_t * woken);
+
+/** @brief Recibe el bloque mas antiguo de la cola
+ **
+ ** @param[in] queue      Cola de la que se recibe
+ ** @param[in] wait       Ticks de espera si la cola esta vacia
+ ** @return Puntero al bloque o NULL si no llego ninguno en el tiempo de espera
+ */
+void * RefQueueReceive(RefQueueHandle_t queue, TickType_t wait);
+
+/** @brief Recibe un bloque desde una interrupción, sin esperar */
+void * RefQueueReceiveFromISR(RefQueueHandle_t queue, BaseType_t * woken);
+
+/** @brief Devuelve a la cola un bloque recibido que ya no se usa */
+void RefQueueRelease(RefQueueHandle_t queue, void * block);
+
+/** @brief Devuelve un bloque desde una interrupción */
+void RefQueueReleaseFromISR(RefQueueHandle_t queue, void * block, BaseType_t * woken);
+
+/** @brief Cantidad de bloques enviados que esperan ser recibidos */
+UBaseType_t RefQueueMessagesWaiting(RefQueueHandle_t queue);
+
+/** @brief Cantidad de bloques libres */
+UBaseType_t RefQueueBlocksAvailable(RefQueueHandle_t queue);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* REF_QUEUE_H */
@@ -0,0 +1,157 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RUNTIME_STATS_H
+#define RUNTIME_STATS_H
+
+/** @brief Estadisticas de ejecución por tarea medidas en ciclos
+ **
+ ** Mide el tiempo que cada tarea ocupa el procesador con el contador de
+ ** ciclos de cycles.h, extendido por software a 64 bits para que no de la
+ ** vuelta. Para cada tarea acumula el tiempo total, la ejecución continua mas
+ ** larga y la cantidad de veces que tomo el procesador. El tiempo de las
+ ** interrupciones que llaman a RuntimeStatsIsrEnter y RuntimeStatsIsrExit se
+ ** acumula aparte y se descuenta del tiempo de la tarea interrumpida.
+ **
+ ** Para habilitarlo el proyecto define configGENERATE_RUN_TIME_STATS en 1 en
+ ** FreeRTOSConfig.h, que debe incluir runtime_stats_hooks.h al final. El
+ ** costo es de una lectura del contador y unas pocas sumas de 64 bits en cada
+ ** cambio de contexto, por lo que puede quedar habilitado en producción.
+ **
+ ** También mide el tiempo que el kernel ocupa en procesar cada tick, que
+ ** incluye despertar a las tareas cuya demora vencio, para comparar el peor
+ ** caso con las listas ordenadas y con configUSE_DELAYED_TASK_WHEEL.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup runtime_stats Estadisticas de ejecución
+ ** @brief Medición del uso del procesador por tarea e interrupciones
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Estadisticas de una tarea */
+typedef struct runtime_task_stats_s {
+   TaskHandle_t task;                        /*!< Tarea, NULL para las que no tienen lugar propio */
+   char name[configMAX_TASK_NAME_LEN];       /*!< Nombre de la tarea */
+   uint64_t cycles;                          /*!< Ciclos ejecutados sin contar interrupciones */
+   uint32_t max_run;                         /*!< Ejecución continua mas larga, en ciclos */
+   uint32_t runs;                            /*!< Cantidad de veces que tomo el procesador */
+} runtime_task_stats_t;
+
+/** @brief Estadisticas globales del sistema */
+typedef struct runtime_stats_s {
+   uint64_t elapsed;                         /*!< Ciclos transcurridos desde el inicio o la ultima puesta a cero */
+   uint64_t isr_cycles;                      /*!< Ciclos ejecutados en interrupciones */
+   uint32_t isr_max;                         /*!< Interrupción mas larga, en ciclos */
+   uint32_t isr_count;                       /*!< Cantidad de interrupciones medidas */
+   uint64_t tick_cycles;                     /*!< Ciclos ejecutados en xTaskIncrementTick */
+   uint32_t tick_max;                        /*!< Procesamiento de tick mas largo, en ciclos */
+   uint32_t tick_count;                      /*!< Cantidad de ticks medidos */
+   uint32_t frequency;                       /*!< Frecuencia del contador en Hz */
+   UBaseType_t tasks;                        /*!< Cantidad de tareas existentes con estadisticas */
+} runtime_stats_t;
+
+/** @brief Función que recibe cada linea del informe periodico */
+typedef void (*runtime_stats_output_t)(const char * text);
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Marca el inicio de una rutina de servicio de interrupción
+ **
+ ** Se llama al comienzo de la rutina de servicio. Solo puede usarse en
+ ** interrupciones con prioridad menor o igual que
+ ** configMAX_SYSCALL_INTERRUPT_PRIORITY, igual que las funciones FromISR.
+ */
+void RuntimeStatsIsrEnter(void);
+
+/** @brief Marca el final de una rutina de servicio de interrupción */
+void RuntimeStatsIsrExit(void);
+
+/** @brief Copia las estadisticas actuales
+ **
+ ** La copia se hace en una sección critica, por lo que todos los valores
+ ** corresponden al mismo instante. La tarea que llama a la función incluye el
+ ** tiempo de su ejecución en curso.
+ **
+ ** @param[out] stats     Estadisticas globales, puede ser NULL
+ ** @param[out] tasks     Vector donde se copian las estadisticas de las tareas
+ ** @param[in]  count     Cantidad de elementos del vector
+ ** @return Cantidad de elementos del vector completados
+ */
+UBaseType_t RuntimeStatsSnapshot(runtime_stats_t * stats, runtime_task_stats_t * tasks, UBaseType_t count);
+
+/** @brief Pone en cero los tiempos acumulados y los maximos */
+void RuntimeStatsReset(void);
+
+/** @brief Crea una tarea que envia periodicamente una tabla con las estadisticas
+ **
+ ** Cada linea de la tabla se entrega a la función de salida terminada con
+ ** "\r\n". Los valores se separan con comas para procesarlos en la PC:
+ **
+ **     # runtime-stats elapsed_ms=5000 isr_pct=0.31 isr_count=120 isr_max_us=4 tick_avg_ns=610 tick_max_ns=2140
+ **     task,cpu_pct,time_ms,max_run_us,runs
+ **     IDLE,82.40,4120,9980,510
+ **
+ ** @param[in] period     Periodo del informe en ticks
+ ** @param[in] output     Función que envia cada linea
+ ** @param[in] priority   Prioridad de la tarea del informe
+ ** @return pdPASS si se pudo crear la tarea
+ */
+BaseType_t RuntimeStatsStartReport(TickType_t period, runtime_stats_output_t output, UBaseType_t priority);
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* RUNTIME_STATS_H */
@@ -0,0 +1,135 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RUNTIME_STATS_HOOKS_H
+#define RUNTIME_STATS_HOOKS_H
+
+/** @brief Conexión de las estadisticas de ejecución con el kernel
+ **
+ ** Este archivo se incluye al final de FreeRTOSConfig.h. Cuando el proyecto
+ ** define configGENERATE_RUN_TIME_STATS en 1 asigna las macros de trazado del
+ ** kernel a las funciones de runtime_stats.c, que miden con el contador de
+ ** ciclos el tiempo de ejecución de cada tarea. Las macros se expanden dentro
+ ** de tasks.c, donde el bloque de control de la tarea es visible.
+ **
+ ** El modulo usa el campo uxTaskNumber del bloque de control de cada tarea
+ ** para guardar el indice de sus estadisticas, por lo que no se puede usar
+ ** vTaskSetTaskNumber en los proyectos que lo habilitan.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup runtime_stats Estadisticas de ejecución
+ ** @brief Medición del uso del procesador por tarea e interrupciones
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+#if ( configUSE_TRACE_FACILITY != 1 )
+#error Las estadisticas de ejecución requieren configUSE_TRACE_FACILITY en 1
+#endif
+
+/** @brief Cantidad de tareas con estadisticas propias, las restantes se acumulan juntas */
+#ifndef configRUNTIME_STATS_MAX_TASKS
+#define configRUNTIME_STATS_MAX_TASKS           16
+#endif
+
+/** @brief Desplazamiento del contador de 64 bits entregado a vTaskGetRunTimeStats
+ **
+ ** El kernel acumula el tiempo de cada tarea en 32 bits. Con un desplazamiento
+ ** de 8 la resolución es de 256 ciclos y el contador da la vuelta cada 90
+ ** minutos a 204 MHz, en lugar de cada 21 segundos.
+ */
+#ifndef configRUNTIME_STATS_KERNEL_SHIFT
+#define configRUNTIME_STATS_KERNEL_SHIFT        8
+#endif
+
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()   RuntimeStatsStart()
+#define portGET_RUN_TIME_COUNTER_VALUE()           RuntimeStatsKernelCounter()
+
+#define traceTASK_CREATE( pxNewTCB )               ( pxNewTCB )->uxTaskNumber = RuntimeStatsTaskCreated( pxNewTCB )
+#define traceTASK_DELETE( pxTCB )                  RuntimeStatsTaskDeleted( ( pxTCB )->uxTaskNumber )
+#define traceTASK_SWITCHED_OUT()                   RuntimeStatsTaskOut( pxCurrentTCB->uxTaskNumber )
+#define traceTASK_SWITCHED_IN()                    RuntimeStatsTaskIn( pxCurrentTCB->uxTaskNumber )
+#define traceTASK_INCREMENT_TICK( xTickCount )     RuntimeStatsTick()
+#define traceTASK_INCREMENT_TICK_EXIT( xTickCount )   RuntimeStatsTickExit()
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Pone en marcha el contador de ciclos al iniciar el planificador */
+void RuntimeStatsStart(void);
+
+/** @brief Contador de 32 bits para las estadisticas propias del kernel */
+uint32_t RuntimeStatsKernelCounter(void);
+
+/** @brief Asigna las estadisticas de una tarea nueva y devuelve su indice */
+uint32_t RuntimeStatsTaskCreated(void * task);
+
+/** @brief Libera las estadisticas de una tarea eliminada */
+void RuntimeStatsTaskDeleted(uint32_t index);
+
+/** @brief Acumula el tiempo de la tarea que deja el procesador */
+void RuntimeStatsTaskOut(uint32_t index);
+
+/** @brief Registra el inicio de la ejecución de la tarea que toma el procesador */
+void RuntimeStatsTaskIn(uint32_t index);
+
+/** @brief Mantiene la extensión a 64 bits del contador en cada tick y marca el inicio del tick */
+void RuntimeStatsTick(void);
+
+/** @brief Acumula la duración del procesamiento del tick */
+void RuntimeStatsTickExit(void);
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* RUNTIME_STATS_HOOKS_H */
@@ -0,0 +1,257 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef STATIC_SYSTEM_H
+#define STATIC_SYSTEM_H
+
+/** @brief Descripción estatica de las tareas y objetos del kernel de un sistema
+ **
+ ** Las tareas, colas, semaforos, mutex, grupos de eventos y temporizadores
+ ** del sistema se describen en tablas que se expanden en tiempo de
+ ** compilación en sus bloques de control, pilas y memoria de las colas, y en
+ ** una única función que los crea con las versiones Static del kernel. El
+ ** arranque no usa el heap y la memoria de cada objeto aparece con su nombre
+ ** en el archivo .map:
+ **
+ **     #define STATIC_SYSTEM_TASKS(TASK)                                                          \
+ **        TASK(control, Control, NULL, 256, 3)                                                    \
+ **        TASK(teclas, Teclas, NULL, 128, 2)
+ **     #define STATIC_SYSTEM_QUEUES(QUEUE)                                                        \
+ **        QUEUE(eventos, 8, sizeof(evento_t))
+ **     #include "static_system.h"
+ **
+ **     STATIC_SYSTEM_DEFINE();
+ **
+ **     int main(void) {
+ **        StaticSystemCreate();
+ **        vTaskStartScheduler();
+ **     }
+ **
+ ** Cada tabla es una macro que recibe el nombre de la macro que se aplica a
+ ** cada elemento, y las que el sistema no usa pueden no definirse:
+ **
+ **  - TASK(nombre, función, parametros, pila, prioridad), con la pila en palabras
+ **  - QUEUE(nombre, elementos, tamaño de cada elemento)
+ **  - SEMAPHORE(nombre, cuenta maxima, cuenta inicial)
+ **  - MUTEX(nombre)
+ **  - EVENTS(nombre)
+ **  - TIMER(nombre, periodo en ticks, recarga automatica, función)
+ **
+ ** Cada elemento define una variable global con su nombre que guarda la
+ ** referencia al objeto, y los otros archivos del proyecto las declaran con
+ ** STATIC_SYSTEM_DECLARE despues de incluir las mismas tablas. La memoria del
+ ** objeto se llama static_<nombre>_tcb, static_<nombre>_stack, etc.
+ ** STATIC_SYSTEM_RAM es la memoria que ocupan todos los objetos, conocida en
+ ** tiempo de compilación.
+ **
+ ** Para habilitarlo el proyecto define configSUPPORT_STATIC_ALLOCATION en 1
+ ** en FreeRTOSConfig.h. En ese caso static_system.c provee tambien la memoria
+ ** de las tareas IDLE y de servicio de los temporizadores que pide el kernel.
+ ** Con configSUPPORT_DYNAMIC_ALLOCATION en 1 las funciones que crean objetos
+ ** con pvPortMalloc siguen disponibles.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup static_system Sistema estatico
+ ** @brief Creación de las tareas y objetos del kernel sin memoria dinámica
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "timers.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Tablas vacias para los tipos de objeto que el sistema no usa */
+#ifndef STATIC_SYSTEM_TASKS
+#define STATIC_SYSTEM_TASKS(TASK)
+#endif
+#ifndef STATIC_SYSTEM_QUEUES
+#define STATIC_SYSTEM_QUEUES(QUEUE)
+#endif
+#ifndef STATIC_SYSTEM_SEMAPHORES
+#define STATIC_SYSTEM_SEMAPHORES(SEMAPHORE)
+#endif
+#ifndef STATIC_SYSTEM_MUTEXES
+#define STATIC_SYSTEM_MUTEXES(MUTEX)
+#endif
+#ifndef STATIC_SYSTEM_EVENTS
+#define STATIC_SYSTEM_EVENTS(EVENTS)
+#endif
+#ifndef STATIC_SYSTEM_TIMERS
+#define STATIC_SYSTEM_TIMERS(TIMER)
+#endif
+
+/** @brief Atributos de la memoria de los objetos, por ejemplo para ubicarla en un banco de RAM
+ **
+ ** Se puede definir antes de incluir el archivo como
+ ** __attribute__((section(".bss.$RamLoc40"))) para no ocupar la RamLoc32.
+ */
+#ifndef STATIC_SYSTEM_ATTRIBUTES
+#define STATIC_SYSTEM_ATTRIBUTES
+#endif
+
+/** @brief Declara las referencias a los objetos del sistema en otros archivos del proyecto */
+#define STATIC_SYSTEM_DECLARE()                                                                    \
+   STATIC_SYSTEM_TASKS(STATIC_SYSTEM_TASK_EXTERN)                                                  \
+   STATIC_SYSTEM_QUEUES(STATIC_SYSTEM_QUEUE_EXTERN)                                                \
+   STATIC_SYSTEM_SEMAPHORES(STATIC_SYSTEM_SEMAPHORE_EXTERN)                                        \
+   STATIC_SYSTEM_MUTEXES(STATIC_SYSTEM_MUTEX_EXTERN)                                               \
+   STATIC_SYSTEM_EVENTS(STATIC_SYSTEM_EVENTS_EXTERN)                                               \
+   STATIC_SYSTEM_TIMERS(STATIC_SYSTEM_TIMER_EXTERN)                                                \
+   extern void StaticSystemCreate(void)
+
+/** @brief Define la memoria de los objetos del sistema y la función StaticSystemCreate
+ **
+ ** Se usa una sola vez en el proyecto, en el archivo que crea el sistema.
+ */
+#define STATIC_SYSTEM_DEFINE()                                                                     \
+   STATIC_SYSTEM_TASKS(STATIC_SYSTEM_TASK_STORAGE)                                                 \
+   STATIC_SYSTEM_QUEUES(STATIC_SYSTEM_QUEUE_STORAGE)                                               \
+   STATIC_SYSTEM_SEMAPHORES(STATIC_SYSTEM_SEMAPHORE_STORAGE)                                       \
+   STATIC_SYSTEM_MUTEXES(STATIC_SYSTEM_MUTEX_STORAGE)                                              \
+   STATIC_SYSTEM_EVENTS(STATIC_SYSTEM_EVENTS_STORAGE)                                              \
+   STATIC_SYSTEM_TIMERS(STATIC_SYSTEM_TIMER_STORAGE)                                               \
+   void StaticSystemCreate(void) {                                                                 \
+      STATIC_SYSTEM_QUEUES(STATIC_SYSTEM_QUEUE_CREATE)                                             \
+      STATIC_SYSTEM_SEMAPHORES(STATIC_SYSTEM_SEMAPHORE_CREATE)                                     \
+      STATIC_SYSTEM_MUTEXES(STATIC_SYSTEM_MUTEX_CREATE)                                            \
+      STATIC_SYSTEM_EVENTS(STATIC_SYSTEM_EVENTS_CREATE)                                            \
+      STATIC_SYSTEM_TIMERS(STATIC_SYSTEM_TIMER_CREATE)                                             \
+      STATIC_SYSTEM_TASKS(STATIC_SYSTEM_TASK_CREATE)                                               \
+   }                                                                                               \
+   extern void StaticSystemCreate(void)
+
+/** @brief Bytes de RAM que ocupan los bloques de control, pilas y memoria de las colas */
+#define STATIC_SYSTEM_RAM                                                                          \
+   ((size_t) 0 STATIC_SYSTEM_TASKS(STATIC_SYSTEM_TASK_SIZE)                                        \
+      STATIC_SYSTEM_QUEUES(STATIC_SYSTEM_QUEUE_SIZE)                                               \
+      STATIC_SYSTEM_SEMAPHORES(STATIC_SYSTEM_SEMAPHORE_SIZE)                                       \
+      STATIC_SYSTEM_MUTEXES(STATIC_SYSTEM_MUTEX_SIZE)                                              \
+      STATIC_SYSTEM_EVENTS(STATIC_SYSTEM_EVENTS_SIZE)                                              \
+      STATIC_SYSTEM_TIMERS(STATIC_SYSTEM_TIMER_SIZE))
+
+/** @brief Cantidad de objetos del sistema */
+#define STATIC_SYSTEM_OBJECTS                                                                      \
+   ((UBaseType_t) 0 STATIC_SYSTEM_TASKS(STATIC_SYSTEM_COUNT)                                       \
+      STATIC_SYSTEM_QUEUES(STATIC_SYSTEM_COUNT) STATIC_SYSTEM_SEMAPHORES(STATIC_SYSTEM_COUNT)      \
+      STATIC_SYSTEM_MUTEXES(STATIC_SYSTEM_COUNT) STATIC_SYSTEM_EVENTS(STATIC_SYSTEM_COUNT)         \
+      STATIC_SYSTEM_TIMERS(STATIC_SYSTEM_COUNT))
+
+/* --- Expansión de cada elemento de las tablas, de uso interno -------------------------------- */
+
+#define STATIC_SYSTEM_TASK_EXTERN(name, function, parameters, stack, priority)                     \
+   extern TaskHandle_t name;
+#define STATIC_SYSTEM_QUEUE_EXTERN(name, length, size)          extern QueueHandle_t name;
+#define STATIC_SYSTEM_SEMAPHORE_EXTERN(name, maximum, initial)  extern SemaphoreHandle_t name;
+#define STATIC_SYSTEM_MUTEX_EXTERN(name)                        extern SemaphoreHandle_t name;
+#define STATIC_SYSTEM_EVENTS_EXTERN(name)                       extern EventGroupHandle_t name;
+#define STATIC_SYSTEM_TIMER_EXTERN(name, period, reload, function)                                 \
+   extern TimerHandle_t name;
+
+#define STATIC_SYSTEM_TASK_STORAGE(name, function, parameters, stack, priority)                    \
+   TaskHandle_t name;                                                                              \
+   static StaticTask_t static_##name##_tcb STATIC_SYSTEM_ATTRIBUTES;                               \
+   static StackType_t static_##name##_stack[stack] STATIC_SYSTEM_ATTRIBUTES;
+#define STATIC_SYSTEM_QUEUE_STORAGE(name, length, size)                                            \
+   QueueHandle_t name;                                                                             \
+   static StaticQueue_t static_##name##_queue STATIC_SYSTEM_ATTRIBUTES;                            \
+   static uint8_t static_##name##_storage[(length) * (size)] STATIC_SYSTEM_ATTRIBUTES;
+#define STATIC_SYSTEM_SEMAPHORE_STORAGE(name, maximum, initial)                                    \
+   SemaphoreHandle_t name;                                                                         \
+   static StaticSemaphore_t static_##name##_semaphore STATIC_SYSTEM_ATTRIBUTES;
+#define STATIC_SYSTEM_MUTEX_STORAGE(name)                                                          \
+   SemaphoreHandle_t name;                                                                         \
+   static StaticSemaphore_t static_##name##_mutex STATIC_SYSTEM_ATTRIBUTES;
+#define STATIC_SYSTEM_EVENTS_STORAGE(name)                                                         \
+   EventGroupHandle_t name;                                                                        \
+   static StaticEventGroup_t static_##name##_events STATIC_SYSTEM_ATTRIBUTES;
+#define STATIC_SYSTEM_TIMER_STORAGE(name, period, reload, function)                                \
+   TimerHandle_t name;                                                                             \
+   static StaticTimer_t static_##name##_timer STATIC_SYSTEM_ATTRIBUTES;
+
+#define STATIC_SYSTEM_TASK_CREATE(name, function, parameters, stack, priority)                     \
+   name = xTaskCreateStatic(function, #name, stack, parameters, priority, static_##name##_stack,   \
+                            &static_##name##_tcb);
+#define STATIC_SYSTEM_QUEUE_CREATE(name, length, size)                                             \
+   name = xQueueCreateStatic(length, size, static_##name##_storage, &static_##name##_queue);
+#define STATIC_SYSTEM_SEMAPHORE_CREATE(name, maximum, initial)                                     \
+   name = xSemaphoreCreateCountingStatic(maximum, initial, &static_##name##_semaphore);
+#define STATIC_SYSTEM_MUTEX_CREATE(name)                                                           \
+   name = xSemaphoreCreateMutexStatic(&static_##name##_mutex);
+#define STATIC_SYSTEM_EVENTS_CREATE(name)                                                          \
+   name = xEventGroupCreateStatic(&static_##name##_events);
+#define STATIC_SYSTEM_TIMER_CREATE(name, period, reload, function)                                 \
+   name = xTimerCreateStatic(#name, period, reload, NULL, function, &static_##name##_timer);
+
+#define STATIC_SYSTEM_TASK_SIZE(name, function, parameters, stack, priority)                       \
+   + sizeof(StaticTask_t) + (stack) * sizeof(StackType_t)
+#define STATIC_SYSTEM_QUEUE_SIZE(name, length, size)   + sizeof(StaticQueue_t) + (length) * (size)
+#define STATIC_SYSTEM_SEMAPHORE_SIZE(name, maximum, initial)  + sizeof(StaticSemaphore_t)
+#define STATIC_SYSTEM_MUTEX_SIZE(name)                 + sizeof(StaticSemaphore_t)
+#define STATIC_SYSTEM_EVENTS_SIZE(name)                + sizeof(StaticEventGroup_t)
+#define STATIC_SYSTEM_TIMER_SIZE(name, period, reload, function)  + sizeof(StaticTimer_t)
+
+#define STATIC_SYSTEM_COUNT(...)                       + 1
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Crea todos los objetos del sistema, definida por STATIC_SYSTEM_DEFINE
+ **
+ ** Crea primero las colas, semaforos, mutex, grupos de eventos y
+ ** temporizadores, y por ultimo las tareas, por lo que todas las referencias
+ ** son validas cuando una tarea se ejecuta por primera vez.
+ */
+void StaticSystemCreate(void);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* STATIC_SYSTEM_H */
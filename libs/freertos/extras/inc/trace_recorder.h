@@ -0,0 +1,157 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+/** @brief Registro binario de los eventos del kernel
+ **
+ ** Guarda los cambios de contexto, las operaciones sobre colas y semaforos,
+ ** los bloqueos y las interrupciones en un anillo en RAM, con registros de
+ ** 8 bytes formados por el valor del contador de ciclos y un código de
+ ** evento de 8 bits con un argumento de 24 bits. Cuando el anillo se llena se
+ ** sobreescriben los eventos mas viejos, por lo que siempre contiene la
+ ** historia mas reciente.
+ **
+ ** Para habilitarlo el proyecto define configUSE_TRACE_RECORDER en 1 en
+ ** FreeRTOSConfig.h, que debe incluir trace_recorder_hooks.h al final. Las
+ ** rutinas de servicio de interrupción que se quieran ver en la traza llaman
+ ** a TraceIsrEnter al comenzar y a TraceIsrExit al terminar.
+ **
+ ** El contenido se obtiene de dos formas:
+ **
+ **  - TraceRecorderDump envia el registro completo como lineas de texto
+ **    "@trace <hexadecimal>", que pueden mezclarse con otros mensajes en la
+ **    USB-UART.
+ **  - make trace lee la variable trace_recorder de la placa con GDB y
+ **    OpenOCD sin detener el programa mas que durante la copia.
+ **
+ ** En ambos casos scripts/trace/trace2perfetto.py convierte el registro en
+ ** una linea de tiempo JSON que se abre con ui.perfetto.dev o
+ ** chrome://tracing.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup trace_recorder Registro de eventos
+ ** @brief Registro de la actividad del planificador para verla como linea de tiempo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+#include "trace_recorder_hooks.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/** @brief Identificación del formato del registro */
+#define TRACE_RECORDER_MAGIC        "FRTRACE"
+
+/** @brief Versión del formato del registro */
+#define TRACE_RECORDER_VERSION      1
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Evento registrado */
+typedef struct trace_record_s {
+   uint32_t time;             /*!< Valor del contador de ciclos */
+   uint32_t event;            /*!< Código del evento << 24 | argumento */
+} trace_record_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Registra un evento
+ **
+ ** Puede llamarse desde tareas y desde interrupciones de cualquier prioridad,
+ ** porque reserva el lugar del registro con una operación atómica sin
+ ** enmascarar interrupciones.
+ **
+ ** @param[in] code       Código del evento
+ ** @param[in] argument   Argumento del evento, se guardan los 24 bits menos significativos
+ */
+void TraceEvent(uint32_t code, uint32_t argument);
+
+/** @brief Registra un evento propio de la aplicación, que se muestra como una marca */
+void TraceUserEvent(uint32_t value);
+
+/** @brief Marca el inicio de una rutina de servicio de interrupción */
+void TraceIsrEnter(void);
+
+/** @brief Marca el final de una rutina de servicio de interrupción */
+void TraceIsrExit(void);
+
+/** @brief Detiene el registro de eventos, los eventos registrados se conservan */
+void TraceRecorderStop(void);
+
+/** @brief Reanuda el registro de eventos */
+void TraceRecorderStart(void);
+
+/** @brief Descarta los eventos registrados, los nombres de las tareas y colas se conservan */
+void TraceRecorderClear(void);
+
+/** @brief Cantidad de eventos registrados desde el inicio o la ultima puesta a cero
+ **
+ ** Cuando supera la capacidad del anillo solo se conservan los ultimos.
+ */
+uint32_t TraceRecorderCount(void);
+
+/** @brief Envia el registro completo como lineas de texto
+ **
+ ** El registro se detiene durante el envio. Cada linea se entrega a la
+ ** función de salida terminada con "\r\n":
+ **
+ **     @trace-begin bytes=8624
+ **     @trace 4652545241434500010000000024290c...
+ **     @trace-end
+ **
+ ** @param[in] output     Función que envia cada linea
+ */
+void TraceRecorderDump(void (*output)(const char * text));
+
+#endif /* configUSE_TRACE_RECORDER */
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* TRACE_RECORDER_H */
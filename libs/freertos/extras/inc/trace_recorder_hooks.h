@@ -0,0 +1,153 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TRACE_RECORDER_HOOKS_H
+#define TRACE_RECORDER_HOOKS_H
+
+/** @brief Conexión del registro de eventos con el kernel
+ **
+ ** Este archivo se incluye al final de FreeRTOSConfig.h. Cuando el proyecto
+ ** define configUSE_TRACE_RECORDER en 1 asigna las macros de trazado del
+ ** kernel a las funciones de trace_recorder.c. Las macros se expanden dentro
+ ** de tasks.c y queue.c, donde los bloques de control de las tareas y de las
+ ** colas son visibles.
+ **
+ ** El modulo usa los campos uxTaskNumber y uxQueueNumber para guardar el
+ ** número con el que cada tarea y cada cola aparece en el registro, por lo
+ ** que no se pueden usar vTaskSetTaskNumber ni vQueueSetQueueNumber en los
+ ** proyectos que lo habilitan. Tampoco puede habilitarse junto con las
+ ** estadisticas de ejecución, que usan las mismas macros.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup trace_recorder Registro de eventos
+ ** @brief Registro de la actividad del planificador para verla como linea de tiempo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Habilita el registro de eventos */
+#ifndef configUSE_TRACE_RECORDER
+#define configUSE_TRACE_RECORDER                0
+#endif
+
+/** @brief Códigos de los eventos, en los 8 bits superiores de cada registro */
+#define TRACE_TASK_CREATE           0x01     /*!< Argumento: número de tarea */
+#define TRACE_TASK_DELETE           0x02     /*!< Argumento: número de tarea */
+#define TRACE_TASK_SWITCHED_IN      0x03     /*!< Argumento: número de tarea */
+#define TRACE_TASK_SWITCHED_OUT     0x04     /*!< Argumento: número de tarea */
+#define TRACE_QUEUE_CREATE          0x05     /*!< Argumento: tipo << 16 | número de cola */
+#define TRACE_QUEUE_SEND            0x06     /*!< Argumento: número de cola */
+#define TRACE_QUEUE_SEND_FROM_ISR   0x07     /*!< Argumento: número de cola */
+#define TRACE_QUEUE_RECEIVE         0x08     /*!< Argumento: número de cola */
+#define TRACE_QUEUE_RECEIVE_FROM_ISR   0x09  /*!< Argumento: número de cola */
+#define TRACE_BLOCKING_ON_SEND      0x0A     /*!< Argumento: número de cola */
+#define TRACE_BLOCKING_ON_RECEIVE   0x0B     /*!< Argumento: número de cola */
+#define TRACE_ISR_ENTER             0x0C     /*!< Argumento: número de excepción */
+#define TRACE_ISR_EXIT              0x0D     /*!< Argumento: número de excepción */
+#define TRACE_USER                  0x0E     /*!< Argumento: valor elegido por la aplicación */
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+#if ( configUSE_TRACE_FACILITY != 1 )
+#error El registro de eventos requiere configUSE_TRACE_FACILITY en 1
+#endif
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+#error El registro de eventos y las estadisticas de ejecución no pueden usarse juntos
+#endif
+
+/** @brief Cantidad de eventos del anillo, debe ser una potencia de dos */
+#ifndef configTRACE_BUFFER_RECORDS
+#define configTRACE_BUFFER_RECORDS              1024
+#endif
+
+/** @brief Cantidad de tareas cuyo nombre se guarda en el registro */
+#ifndef configTRACE_MAX_TASKS
+#define configTRACE_MAX_TASKS                   16
+#endif
+
+/** @brief Cantidad de colas cuyo nombre se guarda en el registro */
+#ifndef configTRACE_MAX_QUEUES
+#define configTRACE_MAX_QUEUES                  8
+#endif
+
+#define traceTASK_CREATE( pxNewTCB )               ( pxNewTCB )->uxTaskNumber = TraceTaskCreated( ( pxNewTCB )->pcTaskName )
+#define traceTASK_DELETE( pxTCB )                  TraceEvent( TRACE_TASK_DELETE, ( pxTCB )->uxTaskNumber )
+#define traceTASK_SWITCHED_IN()                    TraceEvent( TRACE_TASK_SWITCHED_IN, pxCurrentTCB->uxTaskNumber )
+#define traceTASK_SWITCHED_OUT()                   TraceEvent( TRACE_TASK_SWITCHED_OUT, pxCurrentTCB->uxTaskNumber )
+#define traceQUEUE_CREATE( pxNewQueue )            ( pxNewQueue )->uxQueueNumber = TraceQueueCreated( ( pxNewQueue )->ucQueueType )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )   TraceQueueNamed( ( xQueue )->uxQueueNumber, pcQueueName )
+#define traceQUEUE_SEND( pxQueue )                 TraceEvent( TRACE_QUEUE_SEND, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )        TraceEvent( TRACE_QUEUE_SEND_FROM_ISR, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE( pxQueue )              TraceEvent( TRACE_QUEUE_RECEIVE, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )     TraceEvent( TRACE_QUEUE_RECEIVE_FROM_ISR, ( pxQueue )->uxQueueNumber )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )     TraceEvent( TRACE_BLOCKING_ON_SEND, ( pxQueue )->uxQueueNumber )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )  TraceEvent( TRACE_BLOCKING_ON_RECEIVE, ( pxQueue )->uxQueueNumber )
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Registra un evento, declarada también en trace_recorder.h */
+void TraceEvent(uint32_t code, uint32_t argument);
+
+/** @brief Registra la creación de una tarea y devuelve su número */
+uint32_t TraceTaskCreated(const char * name);
+
+/** @brief Registra la creación de una cola y devuelve su número */
+uint32_t TraceQueueCreated(uint8_t type);
+
+/** @brief Guarda el nombre con el que se agrego una cola al registro del kernel */
+void TraceQueueNamed(uint32_t number, const char * name);
+
+#endif /* configUSE_TRACE_RECORDER */
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* TRACE_RECORDER_HOOKS_H */
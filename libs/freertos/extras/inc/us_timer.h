@@ -0,0 +1,211 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef US_TIMER_H
+#define US_TIMER_H
+
+/** @brief Temporizadores de software con resolución de microsegundos
+ **
+ ** Multiplexa cualquier cantidad de vencimientos, de una vez o periodicos,
+ ** sobre la comparación del contador de microsegundos de usec_timer.h. Los
+ ** temporizadores activos se mantienen ordenados por vencimiento y la
+ ** comparación se programa siempre con el más próximo, por lo que la
+ ** resolución no depende de configTICK_RATE_HZ y no hace falta subir la
+ ** frecuencia del tick para generar tiempos menores a un milisegundo:
+ **
+ **     void Pulso(UsTimerHandle_t timer, void * context, BaseType_t * woken) {
+ **        Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, 5, 14);
+ **     }
+ **
+ **     UsTimerInit();
+ **     pulso = UsTimerCreate(Pulso, NULL, US_TIMER_ISR);
+ **     UsTimerStart(pulso, 0, 250);              // cada 250 us
+ **
+ **     UsTimerDelay(80);                          // bloquea la tarea 80 us
+ **
+ ** La función de un temporizador se ejecuta en la interrupción del contador
+ ** (US_TIMER_ISR), donde solo puede usar las funciones FromISR del kernel, o
+ ** en la tarea de servicio de los temporizadores de FreeRTOS (US_TIMER_TASK),
+ ** que la recibe con xTimerPendFunctionCallFromISR y puede usar cualquier
+ ** función. La segunda opción agrega la latencia del cambio a esa tarea.
+ **
+ ** UsTimerDelay y UsTimerDelayUntil bloquean a la tarea hasta el vencimiento
+ ** en lugar de esperar en un lazo, y la despiertan con una notificación
+ ** directa, por lo que la tarea no debe estar usando sus notificaciones con
+ ** xTaskNotifyWait al mismo tiempo.
+ **
+ ** Para habilitarlo el proyecto define configUSE_US_TIMERS en 1 en
+ ** FreeRTOSConfig.h junto con configUSE_TIMERS e INCLUDE_xTimerPendFunctionCall.
+ ** El módulo define la rutina de servicio USEC_TIMER_IRQHandler, por lo que
+ ** el proyecto no puede usar el temporizador de usec_timer.h para otro fin.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup us_timer Temporizadores de microsegundos
+ ** @brief Vencimientos y demoras de alta resolución
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+#ifndef configUSE_US_TIMERS
+#define configUSE_US_TIMERS                     0
+#endif
+
+#if ( configUSE_US_TIMERS == 1 )
+
+#if ( configUSE_TIMERS != 1 ) || ( INCLUDE_xTimerPendFunctionCall != 1 )
+#error Los temporizadores de microsegundos requieren configUSE_TIMERS e INCLUDE_xTimerPendFunctionCall en 1
+#endif
+
+/** @brief Prioridad de la interrupción del contador, debe permitir llamar a las funciones FromISR */
+#ifndef configUS_TIMER_INTERRUPT_PRIORITY
+#define configUS_TIMER_INTERRUPT_PRIORITY       configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#endif
+
+/** @brief La función del temporizador se ejecuta en la interrupción del contador */
+#define US_TIMER_ISR                            0
+
+/** @brief La función del temporizador se ejecuta en la tarea de servicio de los temporizadores */
+#define US_TIMER_TASK                           1
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Referencia a un temporizador de microsegundos */
+typedef struct us_timer_s * UsTimerHandle_t;
+
+/** @brief Función que se ejecuta al vencer un temporizador
+ **
+ ** @param[in] timer      Temporizador que vencio
+ ** @param[in] context    Valor indicado al crear el temporizador
+ ** @param[out] woken     En modo US_TIMER_ISR se pasa a las funciones FromISR que se llamen, en
+ **                       modo US_TIMER_TASK vale NULL
+ */
+typedef void (*UsTimerCallback_t)(UsTimerHandle_t timer, void * context, BaseType_t * woken);
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Pone en marcha el contador de microsegundos y habilita su interrupción
+ **
+ ** Se llama una vez antes de usar cualquier otra función del módulo.
+ */
+void UsTimerInit(void);
+
+/** @brief Crea un temporizador detenido
+ **
+ ** @param[in] callback   Función que se ejecuta en cada vencimiento
+ ** @param[in] context    Valor que se entrega a la función
+ ** @param[in] mode       US_TIMER_ISR o US_TIMER_TASK
+ ** @return Referencia al temporizador creado o NULL si no hay memoria suficiente
+ */
+UsTimerHandle_t UsTimerCreate(UsTimerCallback_t callback, void * context, BaseType_t mode);
+
+/** @brief Detiene y elimina un temporizador
+ **
+ ** Solo puede llamarse desde una tarea, incluso desde la función del propio
+ ** temporizador en modo US_TIMER_TASK. Los vencimientos que ya estaban
+ ** enviados a la tarea de servicio se descartan.
+ */
+void UsTimerDelete(UsTimerHandle_t timer);
+
+/** @brief Arranca un temporizador, o lo vuelve a arrancar si estaba activo
+ **
+ ** @param[in] timer      Temporizador que se arranca
+ ** @param[in] delay      Microsegundos hasta el primer vencimiento
+ ** @param[in] period     Microsegundos entre los vencimientos siguientes, cero para uno solo
+ */
+void UsTimerStart(UsTimerHandle_t timer, uint32_t delay, uint32_t period);
+
+/** @brief Arranca un temporizador desde una interrupción */
+void UsTimerStartFromISR(UsTimerHandle_t timer, uint32_t delay, uint32_t period);
+
+/** @brief Detiene un temporizador, no tiene efecto si ya estaba detenido */
+void UsTimerStop(UsTimerHandle_t timer);
+
+/** @brief Detiene un temporizador desde una interrupción */
+void UsTimerStopFromISR(UsTimerHandle_t timer);
+
+/** @brief Indica si el temporizador tiene un vencimiento pendiente */
+BaseType_t UsTimerIsActive(UsTimerHandle_t timer);
+
+/** @brief Cantidad de vencimientos perdidos
+ **
+ ** Cuenta los periodos que se saltearon porque el anterior se atendio tarde
+ ** y, en modo US_TIMER_TASK, los vencimientos que no se pudieron enviar
+ ** porque la cola de la tarea de servicio estaba llena.
+ */
+uint32_t UsTimerMissed(UsTimerHandle_t timer);
+
+/** @brief Valor actual del contador de microsegundos */
+uint32_t UsTimerNow(void);
+
+/** @brief Bloquea a la tarea durante la cantidad de microsegundos indicada
+ **
+ ** La tarea cede el procesador mientras espera. La demora nunca es menor a
+ ** la pedida, y la excede en la latencia de la interrupción y del cambio de
+ ** contexto.
+ */
+void UsTimerDelay(uint32_t usec);
+
+/** @brief Bloquea a la tarea hasta un instante fijo respecto del anterior
+ **
+ ** Permite ejecutar una tarea con un periodo de microsegundos sin que se
+ ** acumulen las demoras de cada vuelta, igual que vTaskDelayUntil. Si el
+ ** instante ya paso la función vuelve de inmediato.
+ **
+ ** @param[in,out] previous   Instante del despertar anterior, se actualiza con el nuevo
+ ** @param[in] period         Microsegundos entre dos despertares
+ */
+void UsTimerDelayUntil(uint32_t * previous, uint32_t period);
+
+#endif /* configUSE_US_TIMERS */
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* US_TIMER_H */
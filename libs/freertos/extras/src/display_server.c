@@ -0,0 +1,417 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Servidor asincrónico de la pantalla ILI9341
+ **
+ ** Cada lote empieza con el primer comando de la cola y junta los que ya
+ ** estan esperando, hasta un fin de cuadro o hasta llenar el lote. Un
+ ** comando que dibuja el mismo rectángulo que otro anterior del lote lo
+ ** reemplaza, porque los dos son opacos y solo el último queda visible.
+ **
+ ** Todo el lote se dibuja en una sola selección de la pantalla. Cada comando
+ ** se parte en franjas horizontales que se componen alternando entre las dos
+ ** mitades de la memoria y se envian con ILI9341WritePixels, que dentro de
+ ** la selección retorna apenas arranca el DMA. Antes de enviar una franja el
+ ** servidor espera el fin de la anterior bloqueado en una notificación que
+ ** da la interrupción del SPI, en lugar de consultar el puerto.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup display_server Servidor de pantalla
+ ** @brief Dibujo en la pantalla ILI9341 sin bloquear a las tareas de la aplicación
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "display_server.h"
+#include "queue.h"
+#include "ili9341.h"
+#include "spi.h"
+#include "cycles.h"
+#include <string.h>
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Tipos de comandos */
+#define COMMAND_NONE          0     /*!< Comando reemplazado por otro posterior */
+#define COMMAND_RECTANGLE     1     /*!< Rectángulo relleno */
+#define COMMAND_STRING        2     /*!< Cadena de una linea */
+#define COMMAND_FRAME         3     /*!< Fin de un cuadro */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Comando de dibujo publicado en la cola */
+typedef struct command_s {
+   uint8_t type;                       /*!< Tipo de comando */
+   uint8_t length;                     /*!< Caracteres de la cadena */
+   uint16_t x0, y0, x1, y1;            /*!< Rectángulo que ocupa el dibujo */
+   uint16_t foreground;                /*!< Color de la cadena, ya convertido con ILI9341_PIXEL */
+   uint16_t background;                /*!< Color del fondo o del rectángulo */
+   Font_t * font;                      /*!< Fuente de la cadena */
+   TaskHandle_t notify;                /*!< Tarea a notificar al terminar el cuadro */
+   char text[DISPLAY_SERVER_TEXT];     /*!< Caracteres de la cadena */
+} command_t;
+
+/** @brief Estado del servidor */
+typedef struct server_s {
+   QueueHandle_t queue;                /*!< Cola de comandos */
+   TaskHandle_t task;                  /*!< Tarea del servidor */
+   uint16_t * bands[2];                /*!< Mitades de la memoria de las franjas */
+   size_t band_size;                   /*!< Tamaño de cada mitad en bytes */
+   uint8_t current;                    /*!< Mitad en la que se compone la próxima franja */
+   UBaseType_t count;                  /*!< Comandos del lote */
+   command_t batch[DISPLAY_SERVER_BATCH];   /*!< Lote de comandos */
+   uint64_t post_total;                /*!< Suma de las duraciones de las publicaciones */
+   uint32_t posts;                     /*!< Cantidad de publicaciones medidas */
+   uint8_t window_open;                /*!< Se inicio la ventana de los cuadros por segundo */
+   uint32_t window_start;              /*!< Contador de ciclos al iniciar la ventana */
+   uint32_t window_frames;             /*!< Cuadros terminados al iniciar la ventana */
+   DisplayServerStats_t stats;         /*!< Estadisticas */
+} server_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Tarea del servidor */
+static void Server(void * parameters);
+
+/** @brief Agrega un comando al lote, descartando el anterior del mismo lugar */
+static void Add(const command_t * command);
+
+/** @brief Dibuja todos los comandos del lote */
+static void Render(void);
+
+/** @brief Dibuja un comando en franjas */
+static void Draw(const command_t * command);
+
+/** @brief Compone lineas de un comando en una franja */
+static void Compose(const command_t * command, uint16_t y, uint16_t lines, uint16_t * band);
+
+/** @brief Espera bloqueado a que el SPI termine de enviar la última franja */
+static void WaitTransfer(void);
+
+/** @brief Notifica al servidor el fin de una transferencia, desde la interrupción del SPI */
+static void TransferComplete(void);
+
+/** @brief Publica un comando sin esperar y mide la duración de la publicación */
+static BaseType_t Post(const command_t * command, uint32_t start);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Servidor, hay uno solo porque hay una sola pantalla */
+static server_t server;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void Server(void * parameters) {
+   command_t command;
+
+   (void) parameters;
+   for (;;) {
+      xQueueReceive(server.queue, &command, portMAX_DELAY);
+      server.count = 0;
+      Add(&command);
+      /* Los comandos que ya esperan se dibujan juntos, hasta el fin del cuadro */
+      while ((command.type != COMMAND_FRAME) && (server.count < DISPLAY_SERVER_BATCH) &&
+             (xQueueReceive(server.queue, &command, 0) == pdTRUE)) {
+         Add(&command);
+      }
+      Render();
+   }
+}
+
+static void Add(const command_t * command) {
+   UBaseType_t index;
+   command_t * previous;
+
+   if (command->type != COMMAND_FRAME) {
+      for (index = 0; index < server.count; index++) {
+         previous = &server.batch[index];
+         if ((previous->type == command->type) && (previous->x0 == command->x0) &&
+             (previous->y0 == command->y0) && (previous->x1 == command->x1) &&
+             (previous->y1 == command->y1)) {
+            previous->type = COMMAND_NONE;
+            server.stats.replaced++;
+         }
+      }
+   }
+   server.batch[server.count++] = *command;
+}
+
+static void Render(void) {
+   UBaseType_t index;
+   command_t * command;
+   uint32_t now, elapsed;
+
+   ILI9341BeginDrawing();
+   for (index = 0; index < server.count; index++) {
+      command = &server.batch[index];
+      if ((command->type == COMMAND_RECTANGLE) || (command->type == COMMAND_STRING)) {
+         Draw(command);
+      }
+   }
+   /* Al cerrar la selección ya no queda nada por enviar */
+   WaitTransfer();
+   ILI9341EndDrawing();
+   server.stats.batches++;
+
+   command = &server.batch[server.count - 1];
+   if (command->type == COMMAND_FRAME) {
+      server.stats.frames++;
+      now = Read_Cycles();
+      if (!server.window_open) {
+         server.window_open = 1;
+         server.window_start = now;
+         server.window_frames = server.stats.frames;
+      } else {
+         elapsed = now - server.window_start;
+         if (elapsed >= Cycles_Frequency()) {
+            server.stats.frames_per_second = (uint32_t) ((uint64_t) (server.stats.frames -
+               server.window_frames) * Cycles_Frequency() / elapsed);
+            server.window_start = now;
+            server.window_frames = server.stats.frames;
+         }
+      }
+      if (command->notify != NULL) {
+         xTaskNotifyGive(command->notify);
+      }
+   }
+}
+
+static void Draw(const command_t * command) {
+   uint16_t width, lines, y, count;
+   uint16_t * band;
+   uint32_t start;
+
+   width = command->x1 - command->x0 + 1;
+   lines = (uint16_t) (server.band_size / (2U * width));
+   if (lines == 0) {
+      /* No entra ni una linea en una franja, ILI9341_PIXEL devuelve los colores originales */
+      WaitTransfer();
+      if (command->type == COMMAND_RECTANGLE) {
+         ILI9341DrawFilledRectangle(command->x0, command->y0, command->x1, command->y1,
+                                    ILI9341_PIXEL(command->background));
+      } else {
+         char text[DISPLAY_SERVER_TEXT + 1];
+
+         memcpy(text, command->text, command->length);
+         text[command->length] = '\0';
+         ILI9341DrawString(command->x0, command->y0, text, command->font,
+                           ILI9341_PIXEL(command->foreground), ILI9341_PIXEL(command->background));
+      }
+      server.stats.pixels += (uint32_t) width * (command->y1 - command->y0 + 1);
+      return;
+   }
+
+   for (y = command->y0; y <= command->y1; y += count) {
+      count = command->y1 - y + 1;
+      if (count > lines) {
+         count = lines;
+      }
+      /* La otra mitad puede estar saliendo por el DMA mientras se compone esta */
+      band = server.bands[server.current];
+      start = Read_Cycles();
+      Compose(command, y, count, band);
+      server.stats.render += Read_Cycles() - start;
+
+      WaitTransfer();
+      ILI9341WritePixels(command->x0, y, command->x1, y + count - 1, band);
+      server.current ^= 1;
+      server.stats.bands++;
+      server.stats.pixels += (uint32_t) width * count;
+   }
+}
+
+static void Compose(const command_t * command, uint16_t y, uint16_t lines, uint16_t * band) {
+   uint32_t pixels, index;
+   uint16_t line, character, column, bits;
+   uint16_t width = command->font != NULL ? command->font->FontWidth : 0;
+   const uint16_t * rows;
+
+   if (command->type == COMMAND_RECTANGLE) {
+      pixels = (uint32_t) (command->x1 - command->x0 + 1) * lines;
+      for (index = 0; index < pixels; index++) {
+         band[index] = command->background;
+      }
+      return;
+   }
+
+   for (line = y - command->y0; line < y - command->y0 + lines; line++) {
+      for (character = 0; character < command->length; character++) {
+         rows = &command->font->data[(command->text[character] - ' ') * command->font->FontHeight];
+         bits = rows[line];
+         for (column = 0; column < width; column++) {
+            *band++ = (bits & (0x8000 >> column)) ? command->foreground : command->background;
+         }
+      }
+   }
+}
+
+static void WaitTransfer(void) {
+   /* La interrupción solo notifica cuando el puerto ya quedo libre, una
+      notificación de una transferencia anterior solo repite la consulta */
+   while (!SpiFree(SPI_1)) {
+      server.stats.waits++;
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+   }
+}
+
+static void TransferComplete(void) {
+   BaseType_t woken = pdFALSE;
+
+   vTaskNotifyGiveFromISR(server.task, &woken);
+   portYIELD_FROM_ISR(woken);
+}
+
+static BaseType_t Post(const command_t * command, uint32_t start) {
+   BaseType_t result;
+   uint32_t elapsed;
+
+   result = xQueueSend(server.queue, command, 0);
+   elapsed = Read_Cycles() - start;
+
+   taskENTER_CRITICAL();
+   if (result == pdTRUE) {
+      server.stats.commands++;
+   } else {
+      server.stats.dropped++;
+   }
+   server.post_total += elapsed;
+   server.posts++;
+   if (elapsed > server.stats.post_max) {
+      server.stats.post_max = elapsed;
+   }
+   taskEXIT_CRITICAL();
+   return result;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+BaseType_t DisplayServerStart(uint8_t * bands, size_t size, UBaseType_t priority) {
+   configASSERT(bands != NULL);
+   configASSERT(server.queue == NULL);
+   /* TransferComplete runs in the SSP1 and DMA interrupts and calls FromISR functions */
+   configASSERT(SPI_IRQ_PRIORITY >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY);
+
+   server.bands[0] = (uint16_t *) bands;
+   server.band_size = (size / 2) & ~(size_t) 3;
+   server.bands[1] = (uint16_t *) (bands + server.band_size);
+   server.current = 0;
+
+   server.queue = xQueueCreate(DISPLAY_SERVER_QUEUE, sizeof(command_t));
+   if (server.queue == NULL) {
+      return pdFAIL;
+   }
+   if (xTaskCreate(Server, "Pantalla", DISPLAY_SERVER_STACK, NULL, priority, &server.task) !=
+       pdPASS) {
+      vQueueDelete(server.queue);
+      server.queue = NULL;
+      return pdFAIL;
+   }
+   SpiSetTransferCallback(SPI_1, TransferComplete);
+   return pdPASS;
+}
+
+BaseType_t DisplayServerString(uint16_t x, uint16_t y, const char * text, Font_t * font,
+                               uint16_t foreground, uint16_t background) {
+   uint32_t start = Read_Cycles();
+   command_t command;
+   uint8_t length;
+
+   for (length = 0; (length < DISPLAY_SERVER_TEXT) && (text[length] != '\0') &&
+                    (text[length] != '\n'); length++) {
+      command.text[length] = text[length];
+   }
+   if (length == 0) {
+      return pdPASS;
+   }
+   command.type = COMMAND_STRING;
+   command.length = length;
+   command.x0 = x;
+   command.y0 = y;
+   command.x1 = x + length * font->FontWidth - 1;
+   command.y1 = y + font->FontHeight - 1;
+   command.foreground = ILI9341_PIXEL(foreground);
+   command.background = ILI9341_PIXEL(background);
+   command.font = font;
+   command.notify = NULL;
+   return Post(&command, start);
+}
+
+BaseType_t DisplayServerRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                  uint16_t color) {
+   uint32_t start = Read_Cycles();
+   command_t command;
+
+   command.type = COMMAND_RECTANGLE;
+   command.length = 0;
+   command.x0 = (x0 < x1) ? x0 : x1;
+   command.y0 = (y0 < y1) ? y0 : y1;
+   command.x1 = (x0 < x1) ? x1 : x0;
+   command.y1 = (y0 < y1) ? y1 : y0;
+   command.foreground = 0;
+   command.background = ILI9341_PIXEL(color);
+   command.font = NULL;
+   command.notify = NULL;
+   return Post(&command, start);
+}
+
+BaseType_t DisplayServerFrame(TaskHandle_t notify) {
+   uint32_t start = Read_Cycles();
+   command_t command;
+
+   memset(&command, 0, sizeof(command) - sizeof(command.text));
+   command.type = COMMAND_FRAME;
+   command.notify = notify;
+   return Post(&command, start);
+}
+
+void DisplayServerGetStats(DisplayServerStats_t * stats) {
+   taskENTER_CRITICAL();
+   *stats = server.stats;
+   stats->post_average = (server.posts > 0) ? (uint32_t) (server.post_total / server.posts) : 0;
+   taskEXIT_CRITICAL();
+}
+
+void DisplayServerClearStats(void) {
+   taskENTER_CRITICAL();
+   memset(&server.stats, 0, sizeof(server.stats));
+   server.post_total = 0;
+   server.posts = 0;
+   server.window_open = 0;
+   taskEXIT_CRITICAL();
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,196 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Heap distribuido en los bancos de RAM con clases de ubicación
+ **
+ ** Cada clase ocupa un rango continuo de direcciones, las RAM locales en
+ ** 0x10000000 y las RAM AHB en 0x20000000, por lo que una asignación de una
+ ** clase es una búsqueda de heap_5 limitada a los bloques libres del rango
+ ** que va desde el primer banco de la clase hasta el final del último.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup heap_regions Heap en los bancos de RAM
+ ** @brief Ubicación de las asignaciones dinámicas según el banco de RAM
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "heap_regions.h"
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Cantidad de bancos de RAM */
+#define BANK_COUNT         (sizeof(BANKS) / sizeof(BANKS[0]))
+
+/** @brief Menor espacio libre de un banco para usarlo como región del heap */
+#define MINIMUM_REGION     (16 * portBYTE_ALIGNMENT)
+
+#ifdef PLATFORM_HOST
+/** @brief Tamaño del arreglo que simula los bancos de RAM */
+#define HOST_MEMORY_SIZE   (0xa000 + 0x8000 + 0x4000 + 0x4000)
+
+/** @brief Banco simulado con una parte del arreglo hostMemory */
+#define BANK(name, placement, offset, size)                                                        \
+   { #name, placement, &hostMemory[offset], &hostMemory[(offset) + (size)] }
+#else
+/** @brief Banco con el espacio libre definido por el enlazador */
+#define BANK(name, placement, offset, size)                                                        \
+   { #name, placement, _pvHeapStart_##name, _pvHeapLimit_##name }
+#endif
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Espacio libre de un banco de RAM */
+typedef struct bank_s {
+   const char * name;         /*!< Nombre de la región en mem.ld */
+   HeapClass_t placement;     /*!< Clase de ubicación a la que pertenece */
+   uint8_t * start;           /*!< Primer byte libre */
+   uint8_t * limit;           /*!< Primer byte después del espacio libre */
+} bank_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Verifica que un banco tenga espacio suficiente para usarlo en el heap */
+static BaseType_t BankUsed(const bank_t * bank);
+
+/* === Definiciones de variables internas ====================================================== */
+
+#ifdef PLATFORM_HOST
+/** @brief Memoria que simula los bancos de RAM */
+static uint8_t hostMemory[HOST_MEMORY_SIZE] __attribute__((aligned(portBYTE_ALIGNMENT)));
+#else
+/** @brief Limites del espacio libre de cada banco, definidos en link.ld y flat.ld */
+extern uint8_t _pvHeapStart_RamLoc32[], _pvHeapLimit_RamLoc32[];
+extern uint8_t _pvHeapStart_RamLoc40[], _pvHeapLimit_RamLoc40[];
+extern uint8_t _pvHeapStart_RamAHB32[], _pvHeapLimit_RamAHB32[];
+extern uint8_t _pvHeapStart_RamAHB16[], _pvHeapLimit_RamAHB16[];
+extern uint8_t _pvHeapStart_RamAHB_ETB16[], _pvHeapLimit_RamAHB_ETB16[];
+#endif
+
+/** @brief Bancos de RAM en orden de direcciones crecientes */
+static const bank_t BANKS[] = {
+   BANK(RamLoc32, HEAP_CLASS_LOCAL, 0, 0),
+   BANK(RamLoc40, HEAP_CLASS_LOCAL, 0, 0xa000),
+   BANK(RamAHB32, HEAP_CLASS_AHB, 0xa000, 0x8000),
+   BANK(RamAHB16, HEAP_CLASS_AHB, 0x12000, 0x4000),
+   BANK(RamAHB_ETB16, HEAP_CLASS_AHB, 0x16000, 0x4000),
+};
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static BaseType_t BankUsed(const bank_t * bank) {
+   return (bank->limit >= bank->start + MINIMUM_REGION);
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void HeapRegionsInit(void) {
+#if (FREERTOS_HEAP_TYPE == 5)
+   HeapRegion_t regions[BANK_COUNT + 1];
+   UBaseType_t index, used = 0;
+
+   for (index = 0; index < BANK_COUNT; index++) {
+      if (BankUsed(&BANKS[index])) {
+         regions[used].pucStartAddress = BANKS[index].start;
+         regions[used].xSizeInBytes = BANKS[index].limit - BANKS[index].start;
+         used++;
+      }
+   }
+   regions[used].pucStartAddress = NULL;
+   regions[used].xSizeInBytes = 0;
+   vPortDefineHeapRegions(regions);
+#endif
+}
+
+void * HeapRegionsAlloc(HeapClass_t placement, size_t size) {
+#if (FREERTOS_HEAP_TYPE == 5)
+   uint8_t * lowest = NULL;
+   uint8_t * highest = NULL;
+   UBaseType_t index;
+
+   if (placement == HEAP_CLASS_ANY) {
+      return pvPortMalloc(size);
+   }
+   for (index = 0; index < BANK_COUNT; index++) {
+      if ((BANKS[index].placement == placement) && BankUsed(&BANKS[index])) {
+         if (lowest == NULL) {
+            lowest = BANKS[index].start;
+         }
+         highest = BANKS[index].limit;
+      }
+   }
+   if (lowest == NULL) {
+      return NULL;
+   }
+   return pvPortMallocInRange(size, lowest, highest);
+#else
+   (void) placement;
+   return pvPortMalloc(size);
+#endif
+}
+
+HeapClass_t HeapRegionsClassOf(const void * pointer) {
+   const uint8_t * address = pointer;
+   UBaseType_t index;
+
+   for (index = 0; index < BANK_COUNT; index++) {
+      if ((address >= BANKS[index].start) && (address < BANKS[index].limit)) {
+         return BANKS[index].placement;
+      }
+   }
+   return HEAP_CLASS_ANY;
+}
+
+BaseType_t HeapRegionsGet(UBaseType_t index, HeapRegionInfo_t * info) {
+   UBaseType_t bank;
+
+   for (bank = 0; bank < BANK_COUNT; bank++) {
+      if (BankUsed(&BANKS[bank])) {
+         if (index == 0) {
+            info->name = BANKS[bank].name;
+            info->placement = BANKS[bank].placement;
+            info->start = BANKS[bank].start;
+            info->size = BANKS[bank].limit - BANKS[bank].start;
+            return pdTRUE;
+         }
+         index--;
+      }
+   }
+   return pdFALSE;
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,345 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Conjuntos de bloques de memoria de tamaño fijo
+ **
+ ** Los bloques libres forman una lista enlazada que usa la primer palabra de
+ ** cada bloque, por lo que obtener y devolver un bloque es una sección
+ ** critica de unas pocas instrucciones, igual desde una tarea que desde una
+ ** interrupción. Solo cuando no quedan bloques libres la tarea que pide uno
+ ** espera en un semaforo contador, que se entrega al devolver un bloque si
+ ** hay tareas esperando.
+ **
+ ** Cuando los bloques se reservan con pvPortMalloc la estructura de control
+ ** y los bloques se piden en una sola llamada, los bloques a continuación de
+ ** la estructura.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup mem_pool Conjuntos de bloques
+ ** @brief Asignación de bloques de memoria de tamaño fijo en tiempo constante
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "mem_pool.h"
+#include "semphr.h"
+#include "task.h"
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Redondea un tamaño al alineamiento del port */
+#define ALIGN(size)        ( ( ( size ) + portBYTE_ALIGNMENT - 1 ) & ~( ( size_t ) portBYTE_ALIGNMENT - 1 ) )
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Bloque libre, el enlace ocupa el comienzo del bloque */
+typedef struct free_block_s {
+   struct free_block_s * next;   /*!< Siguiente bloque libre */
+} free_block_t;
+
+/** @brief Estructura de control de un conjunto de bloques */
+struct mem_pool_s {
+   SemaphoreHandle_t released;   /*!< Se entrega al devolver un bloque si hay tareas esperando */
+   free_block_t * free;          /*!< Primer bloque libre */
+   UBaseType_t available;        /*!< Cantidad de bloques libres */
+   UBaseType_t waiting;          /*!< Tareas esperando un bloque libre */
+   UBaseType_t high_water;       /*!< Mayor cantidad de bloques entregados al mismo tiempo */
+   uint32_t allocations;         /*!< Pedidos atendidos */
+   uint32_t failures;            /*!< Pedidos que terminaron sin obtener un bloque */
+   uint8_t * blocks;             /*!< Primer bloque */
+   size_t size;                  /*!< Tamaño de cada bloque incluyendo el relleno de alineación */
+   UBaseType_t count;            /*!< Cantidad de bloques */
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Saca el primer bloque de la lista de libres, debe llamarse en una sección critica */
+static void * Pop(MemPoolHandle_t pool);
+
+/** @brief Agrega un bloque a la lista de libres, debe llamarse en una sección critica
+ **
+ ** @return Verdadero si hay tareas esperando un bloque libre
+ */
+static BaseType_t Push(MemPoolHandle_t pool, void * block);
+
+/** @brief Busca la clase de tamaño a la que pertenece un bloque */
+static MemPoolHandle_t ClassOf(const MemPoolHandle_t classes[], UBaseType_t count, void * block);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void * Pop(MemPoolHandle_t pool) {
+   free_block_t * block = pool->free;
+
+   if (block != NULL) {
+      pool->free = block->next;
+      pool->available--;
+      pool->allocations++;
+      if (pool->count - pool->available > pool->high_water) {
+         pool->high_water = pool->count - pool->available;
+      }
+   }
+   return block;
+}
+
+static BaseType_t Push(MemPoolHandle_t pool, void * block) {
+   ((free_block_t *) block)->next = pool->free;
+   pool->free = block;
+   pool->available++;
+   return (pool->waiting > 0);
+}
+
+static MemPoolHandle_t ClassOf(const MemPoolHandle_t classes[], UBaseType_t count, void * block) {
+   UBaseType_t index;
+
+   for (index = 0; index < count; index++) {
+      if (MemPoolContains(classes[index], block)) {
+         return classes[index];
+      }
+   }
+   configASSERT(0);
+   return NULL;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+MemPoolHandle_t MemPoolCreate(UBaseType_t count, size_t size, void * buffer) {
+   MemPoolHandle_t pool;
+   UBaseType_t index;
+
+   configASSERT(count > 0);
+   configASSERT(size > 0);
+   configASSERT(((uintptr_t) buffer & portBYTE_ALIGNMENT_MASK) == 0);
+
+   size = MEM_POOL_BLOCK_SIZE(size);
+   if (buffer == NULL) {
+      pool = pvPortMalloc(ALIGN(sizeof(struct mem_pool_s)) + count * size);
+   } else {
+      pool = pvPortMalloc(sizeof(struct mem_pool_s));
+   }
+   if (pool == NULL) {
+      return NULL;
+   }
+   /* Sin memoria propia los bloques siguen a la estructura, en la misma asignación */
+   if (buffer == NULL) {
+      buffer = (uint8_t *) pool + ALIGN(sizeof(struct mem_pool_s));
+   }
+
+   pool->blocks = buffer;
+   pool->size = size;
+   pool->count = count;
+   pool->free = NULL;
+   pool->available = 0;
+   pool->waiting = 0;
+   for (index = count; index > 0; index--) {
+      Push(pool, pool->blocks + (index - 1) * size);
+   }
+   pool->high_water = 0;
+   pool->allocations = 0;
+   pool->failures = 0;
+
+   pool->released = xSemaphoreCreateCounting(count, 0);
+   if (pool->released == NULL) {
+      vPortFree(pool);
+      return NULL;
+   }
+   return pool;
+}
+
+void MemPoolDelete(MemPoolHandle_t pool) {
+   vSemaphoreDelete(pool->released);
+   vPortFree(pool);
+}
+
+void * MemPoolAlloc(MemPoolHandle_t pool, TickType_t wait) {
+   TimeOut_t timeout;
+   void * block;
+
+   vTaskSetTimeOutState(&timeout);
+   while (1) {
+      taskENTER_CRITICAL();
+      block = Pop(pool);
+      if (block == NULL) {
+         if (wait > 0) {
+            pool->waiting++;
+         } else {
+            pool->failures++;
+         }
+      }
+      taskEXIT_CRITICAL();
+
+      if ((block != NULL) || (wait == 0)) {
+         return block;
+      }
+
+      /* Otra tarea puede tomar el bloque devuelto antes que esta, y una
+       * entrega destinada a una espera que ya vencio solo provoca una vuelta
+       * mas del lazo */
+      xSemaphoreTake(pool->released, wait);
+
+      taskENTER_CRITICAL();
+      pool->waiting--;
+      taskEXIT_CRITICAL();
+
+      if (xTaskCheckForTimeOut(&timeout, &wait) != pdFALSE) {
+         wait = 0;
+      }
+   }
+}
+
+void * MemPoolAllocFromISR(MemPoolHandle_t pool) {
+   UBaseType_t mask;
+   void * block;
+
+   mask = taskENTER_CRITICAL_FROM_ISR();
+   block = Pop(pool);
+   if (block == NULL) {
+      pool->failures++;
+   }
+   taskEXIT_CRITICAL_FROM_ISR(mask);
+   return block;
+}
+
+void MemPoolFree(MemPoolHandle_t pool, void * block) {
+   BaseType_t waiting;
+
+   configASSERT(MemPoolContains(pool, block));
+   taskENTER_CRITICAL();
+   waiting = Push(pool, block);
+   taskEXIT_CRITICAL();
+
+   if (waiting) {
+      xSemaphoreGive(pool->released);
+   }
+}
+
+void MemPoolFreeFromISR(MemPoolHandle_t pool, void * block, BaseType_t * woken) {
+   UBaseType_t mask;
+   BaseType_t waiting;
+
+   configASSERT(MemPoolContains(pool, block));
+   mask = taskENTER_CRITICAL_FROM_ISR();
+   waiting = Push(pool, block);
+   taskEXIT_CRITICAL_FROM_ISR(mask);
+
+   if (waiting) {
+      xSemaphoreGiveFromISR(pool->released, woken);
+   }
+}
+
+BaseType_t MemPoolContains(MemPoolHandle_t pool, const void * block) {
+   size_t offset = (const uint8_t *) block - pool->blocks;
+
+   return ((const uint8_t *) block >= pool->blocks) && (offset < pool->size * pool->count) &&
+      (offset % pool->size == 0);
+}
+
+UBaseType_t MemPoolAvailable(MemPoolHandle_t pool) {
+   return pool->available;
+}
+
+size_t MemPoolBlockSize(MemPoolHandle_t pool) {
+   return pool->size;
+}
+
+void MemPoolGetStats(MemPoolHandle_t pool, MemPoolStats_t * stats) {
+   taskENTER_CRITICAL();
+   stats->size = pool->size;
+   stats->count = pool->count;
+   stats->used = pool->count - pool->available;
+   stats->high_water = pool->high_water;
+   stats->allocations = pool->allocations;
+   stats->failures = pool->failures;
+   taskEXIT_CRITICAL();
+}
+
+void * MemPoolClassAlloc(const MemPoolHandle_t classes[], UBaseType_t count, size_t size,
+                         TickType_t wait) {
+   UBaseType_t first, index;
+   void * block = NULL;
+
+   for (first = 0; (first < count) && (classes[first]->size < size); first++) {
+   }
+   if (first == count) {
+      return NULL;
+   }
+
+   taskENTER_CRITICAL();
+   for (index = first; (index < count) && (block == NULL); index++) {
+      block = Pop(classes[index]);
+   }
+   taskEXIT_CRITICAL();
+
+   if (block == NULL) {
+      block = MemPoolAlloc(classes[first], wait);
+   }
+   return block;
+}
+
+void * MemPoolClassAllocFromISR(const MemPoolHandle_t classes[], UBaseType_t count, size_t size) {
+   UBaseType_t first, index;
+   UBaseType_t mask;
+   void * block = NULL;
+
+   for (first = 0; (first < count) && (classes[first]->size < size); first++) {
+   }
+   if (first == count) {
+      return NULL;
+   }
+
+   mask = taskENTER_CRITICAL_FROM_ISR();
+   for (index = first; (index < count) && (block == NULL); index++) {
+      block = Pop(classes[index]);
+   }
+   if (block == NULL) {
+      classes[first]->failures++;
+   }
+   taskEXIT_CRITICAL_FROM_ISR(mask);
+   return block;
+}
+
+void MemPoolClassFree(const MemPoolHandle_t classes[], UBaseType_t count, void * block) {
+   MemPoolFree(ClassOf(classes, count, block), block);
+}
+
+void MemPoolClassFreeFromISR(const MemPoolHandle_t classes[], UBaseType_t count, void * block,
+                             BaseType_t * woken) {
+   MemPoolFreeFromISR(ClassOf(classes, count, block), block, woken);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
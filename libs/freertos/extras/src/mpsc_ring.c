@@ -0,0 +1,355 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Anillo sin bloqueos con varios productores y un consumidor
+ **
+ ** Cada posición del anillo tiene un numero de secuencia que indica su
+ ** estado. Una posición con secuencia igual a la cuenta de escritura esta
+ ** libre en esta vuelta del anillo, con secuencia igual a la cuenta mas uno
+ ** tiene un elemento publicado, y al leerlo el consumidor la adelanta una
+ ** vuelta completa. Asi los productores solo compiten por la cuenta de
+ ** escritura, que se incrementa con una comparación e intercambio, y cada uno
+ ** completa su posición sin que los demas esperen.
+ **
+ ** Si un productor es desplazado entre la reserva y la publicación, el
+ ** consumidor encuentra la posición sin publicar y se detiene ahi aunque las
+ ** siguientes ya esten completas. No se pierde nada porque al publicarla el
+ ** productor despierta al consumidor si este esta esperando.
+ **
+ ** El consumidor marca que va a esperar, vuelve a revisar el anillo y solo
+ ** entonces espera una notificación. Los productores publican, y luego toman
+ ** la marca con un intercambio atomico para que solo uno de ellos notifique.
+ ** Las barreras entre la escritura de uno y la lectura del otro aseguran que
+ ** al menos uno de los dos vea el cambio del otro. Una notificación de mas
+ ** solo provoca una vuelta adicional del lazo de recepción.
+ **
+ ** En la EDU-CIAA las operaciones atomicas usan LDREX y STREX. El procesador
+ ** borra la reserva exclusiva al entrar y salir de una interrupción, por lo
+ ** que una interrupción anidada entre ambas instrucciones hace fallar STREX y
+ ** la operación se repite. En la PC se usan las funciones atomicas de GCC,
+ ** lo que permite probar el anillo con hilos que se ejecutan en paralelo.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup mpsc_ring Anillos de varios productores
+ ** @brief Transferencia de datos desde interrupciones sin secciones criticas
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "mpsc_ring.h"
+#include <string.h>
+#ifndef PLATFORM_HOST
+#include "chip.h"
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Redondea un tamaño al alineamiento del port */
+#define ALIGN(size)        ( ( ( size ) + portBYTE_ALIGNMENT - 1 ) & ~( ( size_t ) portBYTE_ALIGNMENT - 1 ) )
+
+/** @brief Puntos de traza entre la lectura de la cuenta y la reserva, y entre la copia y la
+ ** publicación. Se definen en FreeRTOSConfig.h para forzar desplazamientos en las pruebas */
+#ifndef traceMPSC_RING_RESERVE
+#define traceMPSC_RING_RESERVE(ring, position)
+#endif
+#ifndef traceMPSC_RING_PUBLISH
+#define traceMPSC_RING_PUBLISH(ring, position)
+#endif
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Posición del anillo, el elemento sigue a la secuencia */
+typedef struct slot_s {
+   volatile uint32_t sequence;   /*!< Estado de la posición en la vuelta actual */
+} slot_t;
+
+/** @brief Estructura de control de un anillo */
+struct mpsc_ring_s {
+   volatile uint32_t head;       /*!< Cuenta de escritura, proxima posición a reservar */
+   uint32_t tail;                /*!< Cuenta de lectura, solo la modifica el consumidor */
+   volatile uint32_t waiting;    /*!< El consumidor espera una notificación */
+   volatile uint32_t dropped;    /*!< Elementos descartados por anillo lleno */
+   TaskHandle_t consumer;        /*!< Tarea que recibe del anillo */
+   uint32_t mask;                /*!< Cantidad de posiciones menos uno */
+   size_t size;                  /*!< Tamaño de cada elemento */
+   size_t stride;                /*!< Distancia entre posiciones incluyendo la secuencia */
+   uint8_t * slots;              /*!< Primer posición */
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Barrera de memoria completa, ordena escrituras y lecturas anteriores y posteriores */
+static inline void Barrier(void);
+
+/** @brief Reemplaza un valor solo si no cambio desde que se leyo
+ **
+ ** @return Verdadero si se escribio el nuevo valor
+ */
+static inline BaseType_t CompareAndSwap(volatile uint32_t * value, uint32_t expected, uint32_t desired);
+
+/** @brief Reemplaza un valor y devuelve el anterior en una operación atomica */
+static inline uint32_t Exchange(volatile uint32_t * value, uint32_t desired);
+
+/** @brief Posición del anillo que corresponde a una cuenta */
+static inline slot_t * Slot(MpscRingHandle_t ring, uint32_t count);
+
+/** @brief Despierta al consumidor si estaba esperando
+ **
+ ** @return Verdadero si la notificación desperto a una tarea de mayor prioridad
+ */
+static BaseType_t Wake(MpscRingHandle_t ring, BaseType_t from_isr);
+
+/** @brief Copia el proximo elemento publicado, solo la llama el consumidor
+ **
+ ** @return Verdadero si habia un elemento publicado
+ */
+static BaseType_t Read(MpscRingHandle_t ring, void * item);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+#ifdef PLATFORM_HOST
+
+static inline void Barrier(void) {
+   __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline BaseType_t CompareAndSwap(volatile uint32_t * value, uint32_t expected, uint32_t desired) {
+   return __atomic_compare_exchange_n(value, &expected, desired, 0, __ATOMIC_SEQ_CST,
+      __ATOMIC_SEQ_CST);
+}
+
+static inline uint32_t Exchange(volatile uint32_t * value, uint32_t desired) {
+   return __atomic_exchange_n(value, desired, __ATOMIC_SEQ_CST);
+}
+
+#else
+
+static inline void Barrier(void) {
+   __DMB();
+}
+
+static inline BaseType_t CompareAndSwap(volatile uint32_t * value, uint32_t expected, uint32_t desired) {
+   do {
+      if (__LDREXW(value) != expected) {
+         __CLREX();
+         return pdFALSE;
+      }
+   } while (__STREXW(desired, value) != 0);
+   __DMB();
+   return pdTRUE;
+}
+
+static inline uint32_t Exchange(volatile uint32_t * value, uint32_t desired) {
+   uint32_t previous;
+
+   do {
+      previous = __LDREXW(value);
+   } while (__STREXW(desired, value) != 0);
+   __DMB();
+   return previous;
+}
+
+#endif
+
+static inline slot_t * Slot(MpscRingHandle_t ring, uint32_t count) {
+   return (slot_t *) (ring->slots + (count & ring->mask) * ring->stride);
+}
+
+static BaseType_t Wake(MpscRingHandle_t ring, BaseType_t from_isr) {
+   BaseType_t woken = pdFALSE;
+
+   /* La publicación del elemento tiene que ser visible antes de leer la marca */
+   Barrier();
+   if ((ring->waiting != 0) && (Exchange(&ring->waiting, 0) != 0)) {
+      if (from_isr) {
+         vTaskNotifyGiveFromISR(ring->consumer, &woken);
+      } else {
+         xTaskNotifyGive(ring->consumer);
+      }
+   }
+   return woken;
+}
+
+static BaseType_t Read(MpscRingHandle_t ring, void * item) {
+   slot_t * slot = Slot(ring, ring->tail);
+
+   if (slot->sequence != ring->tail + 1) {
+      return pdFALSE;
+   }
+   Barrier();
+   memcpy(item, slot + 1, ring->size);
+   Barrier();
+   slot->sequence = ring->tail + ring->mask + 1;
+   ring->tail++;
+   return pdTRUE;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+MpscRingHandle_t MpscRingCreate(UBaseType_t length, size_t size) {
+   MpscRingHandle_t ring;
+   uint32_t index;
+
+   configASSERT(length > 0);
+   configASSERT((length & (length - 1)) == 0);
+   configASSERT(size > 0);
+
+   ring = pvPortMalloc(ALIGN(sizeof(struct mpsc_ring_s)) + length * ALIGN(sizeof(slot_t) + size));
+   if (ring == NULL) {
+      return NULL;
+   }
+
+   ring->slots = (uint8_t *) ring + ALIGN(sizeof(struct mpsc_ring_s));
+   ring->stride = ALIGN(sizeof(slot_t) + size);
+   ring->size = size;
+   ring->mask = length - 1;
+   ring->head = 0;
+   ring->tail = 0;
+   ring->waiting = 0;
+   ring->dropped = 0;
+   ring->consumer = NULL;
+   for (index = 0; index < length; index++) {
+      Slot(ring, index)->sequence = index;
+   }
+   return ring;
+}
+
+void MpscRingDelete(MpscRingHandle_t ring) {
+   vPortFree(ring);
+}
+
+BaseType_t MpscRingWrite(MpscRingHandle_t ring, const void * item) {
+   slot_t * slot;
+   uint32_t position;
+   uint32_t dropped;
+   int32_t difference;
+
+   while (1) {
+      position = ring->head;
+      slot = Slot(ring, position);
+      difference = (int32_t) (slot->sequence - position);
+
+      if (difference < 0) {
+         /* El consumidor todavia no leyo esta posición en la vuelta anterior */
+         do {
+            dropped = ring->dropped;
+         } while (!CompareAndSwap(&ring->dropped, dropped, dropped + 1));
+         return errQUEUE_FULL;
+      }
+      traceMPSC_RING_RESERVE(ring, position);
+      if ((difference == 0) && CompareAndSwap(&ring->head, position, position + 1)) {
+         break;
+      }
+      /* Otro productor reservo la posición primero, se repite con la siguiente */
+   }
+
+   memcpy(slot + 1, item, ring->size);
+   traceMPSC_RING_PUBLISH(ring, position);
+   Barrier();
+   slot->sequence = position + 1;
+   return pdPASS;
+}
+
+BaseType_t MpscRingSend(MpscRingHandle_t ring, const void * item) {
+   BaseType_t result;
+
+   result = MpscRingWrite(ring, item);
+   if (result == pdPASS) {
+      Wake(ring, pdFALSE);
+   }
+   return result;
+}
+
+BaseType_t MpscRingSendFromISR(MpscRingHandle_t ring, const void * item, BaseType_t * woken) {
+   BaseType_t result;
+
+   result = MpscRingWrite(ring, item);
+   if ((result == pdPASS) && Wake(ring, pdTRUE) && (woken != NULL)) {
+      *woken = pdTRUE;
+   }
+   return result;
+}
+
+void MpscRingNotifyFromISR(MpscRingHandle_t ring, BaseType_t * woken) {
+   if (Wake(ring, pdTRUE) && (woken != NULL)) {
+      *woken = pdTRUE;
+   }
+}
+
+BaseType_t MpscRingReceive(MpscRingHandle_t ring, void * item, TickType_t wait) {
+   TimeOut_t timeout;
+
+   configASSERT((ring->consumer == NULL) || (ring->consumer == xTaskGetCurrentTaskHandle()));
+   ring->consumer = xTaskGetCurrentTaskHandle();
+
+   vTaskSetTimeOutState(&timeout);
+   while (1) {
+      if (Read(ring, item)) {
+         return pdPASS;
+      }
+      if (wait == 0) {
+         return errQUEUE_EMPTY;
+      }
+
+      /* Se marca la espera antes de revisar otra vez, asi un elemento
+       * publicado despues de la primer revisión lo ve el consumidor o el
+       * productor encuentra la marca y lo notifica */
+      Exchange(&ring->waiting, 1);
+      if (Read(ring, item)) {
+         Exchange(&ring->waiting, 0);
+         return pdPASS;
+      }
+      ulTaskNotifyTake(pdTRUE, wait);
+      Exchange(&ring->waiting, 0);
+
+      if (xTaskCheckForTimeOut(&timeout, &wait) != pdFALSE) {
+         wait = 0;
+      }
+   }
+}
+
+UBaseType_t MpscRingItemsWaiting(MpscRingHandle_t ring) {
+   return (UBaseType_t) (ring->head - ring->tail);
+}
+
+uint32_t MpscRingDropped(MpscRingHandle_t ring) {
+   return ring->dropped;
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,323 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Perfilador estadistico por muestreo
+ **
+ ** El histograma es una tabla de dispersión de direcciones abiertas indexada
+ ** por el par de dirección y tarea. Cada muestra prueba a lo sumo PROBES
+ ** lugares consecutivos, por lo que la interrupción tiene una duración
+ ** acotada; cuando no encuentra el par ni un lugar libre la muestra se
+ ** cuenta como descartada.
+ **
+ ** La interrupción de muestreo es la única que escribe el histograma. Como
+ ** tiene una prioridad mayor a configMAX_SYSCALL_INTERRUPT_PRIORITY no usa
+ ** funciones del kernel: solo lee el puntero a la tarea en ejecución, que el
+ ** kernel actualiza con una única escritura, y el nombre de esa tarea.
+ **
+ ** Las muestras no guardan el puntero a la tarea, que deja de ser valido si
+ ** la tarea se borra antes del envio, sino un numero de la tabla de tareas.
+ ** Cada tarea se agrega a la tabla con una copia de su nombre la primera vez
+ ** que se muestrea; una tarea nueva creada en la memoria de otra ya borrada
+ ** tiene su propio lugar porque tambien se compara el nombre.
+ **
+ ** En la EDU-CIAA la rutina de servicio del RITIMER es una función desnuda
+ ** que obtiene el marco que apilo el procesador al entrar a la interrupción,
+ ** del puntero de pila de proceso si se interrumpio una tarea o del puntero
+ ** de pila principal si se interrumpio otra interrupción, y la dirección de
+ ** la instrucción interrumpida es el septimo elemento del marco. En la PC la
+ ** dirección se lee del contexto que recibe el manejador de SIGPROF.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup profiler Perfilador
+ ** @brief Perfil del uso del procesador por función y tarea
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#ifdef PLATFORM_HOST
+#define _GNU_SOURCE
+#endif
+
+#include "profiler.h"
+#include "task.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef PLATFORM_HOST
+#include <signal.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#else
+#include "chip.h"
+#endif
+
+#if ( configUSE_PROFILER == 1 )
+
+/* === Definicion y Macros ===================================================================== */
+
+#if ( ( configPROFILER_SLOTS & ( configPROFILER_SLOTS - 1 ) ) != 0 )
+#error configPROFILER_SLOTS debe ser una potencia de dos
+#endif
+
+/** @brief Lugares del histograma que prueba cada muestra */
+#define PROBES              8
+
+/** @brief Bit del valor de retorno de excepción que indica el regreso a una tarea */
+#define EXC_RETURN_THREAD   ( 1UL << 3 )
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Muestras de un par de dirección y tarea */
+typedef struct slot_s {
+   uintptr_t address;            /*!< Dirección de la instrucción interrumpida, cero si esta libre */
+   uint16_t task;                /*!< Numero de la tarea en ejecución, cero en las interrupciones */
+   uint32_t count;               /*!< Cantidad de muestras */
+} slot_t;
+
+/** @brief Tarea muestreada, el numero de la tarea es su posición mas uno */
+typedef struct task_s {
+   TaskHandle_t handle;                   /*!< Tarea al tomar la muestra, NULL si esta libre */
+   char name[configMAX_TASK_NAME_LEN];    /*!< Copia del nombre de la tarea */
+} task_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Devuelve el numero de una tarea, la agrega a la tabla si no esta y cero si esta llena */
+static uint16_t Identify(TaskHandle_t handle);
+
+/** @brief Cuenta una muestra en el histograma */
+static void Count(uintptr_t address, TaskHandle_t handle);
+
+/** @brief Programa la fuente de muestreo con la frecuencia indicada, cero la detiene */
+static void Program(uint32_t frequency);
+
+/* === Definiciones de variables internas ====================================================== */
+
+static slot_t slots[configPROFILER_SLOTS];
+
+static task_t tasks[configPROFILER_TASKS];
+
+static profiler_stats_t stats;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static uint16_t Identify(TaskHandle_t handle) {
+   const char * name = pcTaskGetName(handle);
+   uint16_t index;
+
+   for (index = 0; index < configPROFILER_TASKS; index++) {
+      if (tasks[index].handle == NULL) {
+         tasks[index].handle = handle;
+         strncpy(tasks[index].name, name, sizeof(tasks[index].name));
+         tasks[index].name[sizeof(tasks[index].name) - 1] = '\0';
+         return index + 1;
+      }
+      if ((tasks[index].handle == handle) &&
+          (strncmp(tasks[index].name, name, sizeof(tasks[index].name) - 1) == 0)) {
+         return index + 1;
+      }
+   }
+   return 0;
+}
+
+static void Count(uintptr_t address, TaskHandle_t handle) {
+   uint32_t index;
+   uint32_t probe;
+   uint16_t task = 0;
+   slot_t * slot;
+
+   if (handle != NULL) {
+      task = Identify(handle);
+      if (task == 0) {
+         stats.dropped++;
+         return;
+      }
+   }
+   index = (uint32_t) ((address >> 1) ^ task) * 2654435761U;
+   index = index >> 16;
+   for (probe = 0; probe < PROBES; probe++) {
+      slot = &slots[(index + probe) & (configPROFILER_SLOTS - 1)];
+      if ((slot->address == address) && (slot->task == task)) {
+         slot->count++;
+         stats.samples++;
+         return;
+      }
+      if (slot->address == 0) {
+         slot->address = address;
+         slot->task = task;
+         slot->count = 1;
+         stats.samples++;
+         stats.used++;
+         return;
+      }
+   }
+   stats.dropped++;
+}
+
+#ifdef PLATFORM_HOST
+
+/** @brief Manejador de SIGPROF, cuenta la dirección interrumpida en la tarea en ejecución */
+static void Sample(int signal, siginfo_t * info, void * context) {
+   const ucontext_t * interrupted = (const ucontext_t *) context;
+   uintptr_t address;
+
+#if defined(__x86_64__)
+   address = (uintptr_t) interrupted->uc_mcontext.gregs[REG_RIP];
+#elif defined(__i386__)
+   address = (uintptr_t) interrupted->uc_mcontext.gregs[REG_EIP];
+#elif defined(__aarch64__)
+   address = (uintptr_t) interrupted->uc_mcontext.pc;
+#else
+   address = 1;
+#endif
+   Count(address, xTaskGetCurrentTaskHandle());
+}
+
+static void Program(uint32_t frequency) {
+   struct sigaction action;
+   struct itimerval timer;
+
+   memset(&timer, 0, sizeof(timer));
+   if (frequency > 0) {
+      memset(&action, 0, sizeof(action));
+      sigfillset(&action.sa_mask);
+      action.sa_flags = SA_RESTART | SA_SIGINFO;
+      action.sa_sigaction = Sample;
+      sigaction(SIGPROF, &action, NULL);
+
+      timer.it_interval.tv_usec = (frequency < 1000000) ? 1000000 / frequency : 1;
+      timer.it_value = timer.it_interval;
+   }
+   setitimer(ITIMER_PROF, &timer, NULL);
+}
+
+#else
+
+/** @brief Cuenta una muestra a partir del marco apilado al entrar a la interrupción
+ **
+ ** @param[in] frame         Marco apilado: r0, r1, r2, r3, r12, lr, pc, xpsr
+ ** @param[in] exc_return    Valor del registro lr al entrar a la interrupción
+ */
+static void __attribute__((used)) Sample(const uint32_t * frame, uint32_t exc_return) {
+   Chip_RIT_ClearInt(LPC_RITIMER);
+   Count((uintptr_t) frame[6], (exc_return & EXC_RETURN_THREAD) ? xTaskGetCurrentTaskHandle() : NULL);
+}
+
+static void Program(uint32_t frequency) {
+   if (frequency > 0) {
+      Chip_RIT_Init(LPC_RITIMER);
+      Chip_RIT_Disable(LPC_RITIMER);
+      Chip_RIT_SetCOMPVAL(LPC_RITIMER, Chip_Clock_GetRate(CLK_MX_RITIMER) / frequency);
+      Chip_RIT_EnableCTRL(LPC_RITIMER, RIT_CTRL_ENCLR);
+      Chip_RIT_ClearInt(LPC_RITIMER);
+      NVIC_SetPriority(RITIMER_IRQn, 0);
+      NVIC_ClearPendingIRQ(RITIMER_IRQn);
+      NVIC_EnableIRQ(RITIMER_IRQn);
+      Chip_RIT_Enable(LPC_RITIMER);
+   } else {
+      NVIC_DisableIRQ(RITIMER_IRQn);
+      Chip_RIT_Disable(LPC_RITIMER);
+   }
+}
+
+#endif
+
+/* === Definiciones de funciones externas ====================================================== */
+
+#ifndef PLATFORM_HOST
+
+void __attribute__((naked)) RIT_IRQHandler(void) {
+   __asm volatile("   tst   lr, #4     \n"
+                  "   ite   eq         \n"
+                  "   mrseq r0, msp    \n"
+                  "   mrsne r0, psp    \n"
+                  "   mov   r1, lr     \n"
+                  "   b     Sample     \n");
+}
+
+#endif
+
+void ProfilerStart(uint32_t frequency) {
+   stats.frequency = frequency;
+   Program(frequency);
+}
+
+void ProfilerStop(void) {
+   Program(0);
+}
+
+void ProfilerClear(void) {
+   memset(slots, 0, sizeof(slots));
+   memset(tasks, 0, sizeof(tasks));
+   stats.samples = 0;
+   stats.dropped = 0;
+   stats.used = 0;
+}
+
+void ProfilerGetStats(profiler_stats_t * result) {
+   *result = stats;
+}
+
+void ProfilerDump(void (*output)(const char * text)) {
+   static char line[96 + configMAX_TASK_NAME_LEN];
+   uint32_t index;
+
+   snprintf(line, sizeof(line), "@profile-begin hz=%lu samples=%lu dropped=%lu ref=0x%lx\r\n",
+      (unsigned long) stats.frequency, (unsigned long) stats.samples, (unsigned long) stats.dropped,
+      (unsigned long) (uintptr_t) ProfilerStart);
+   output(line);
+
+   /* Los nombres son las copias de la tabla, las tareas pueden haberse borrado */
+   for (index = 0; (index < configPROFILER_TASKS) && (tasks[index].handle != NULL); index++) {
+      snprintf(line, sizeof(line), "@profile-task 0x%lx %s\r\n", (unsigned long) (index + 1),
+         tasks[index].name);
+      output(line);
+   }
+
+   for (index = 0; index < configPROFILER_SLOTS; index++) {
+      if (slots[index].address != 0) {
+         snprintf(line, sizeof(line), "@profile 0x%lx 0x%lx %lu\r\n",
+            (unsigned long) slots[index].address, (unsigned long) slots[index].task,
+            (unsigned long) slots[index].count);
+         output(line);
+      }
+   }
+   output("@profile-end\r\n");
+}
+
+#endif /* configUSE_PROFILER */
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
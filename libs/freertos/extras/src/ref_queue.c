@@ -0,0 +1,169 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Colas de referencias con bloques de memoria propios
+ **
+ ** Los bloques enviados viajan por una cola de FreeRTOS que transporta
+ ** punteros, asi las esperas del consumidor y el despertar de las tareas
+ ** quedan a cargo del kernel y cada envio copia solo un puntero sin importar
+ ** el tamaño del bloque.
+ **
+ ** Los bloques libres se toman de un conjunto de bloques de mem_pool, por lo
+ ** que obtener y liberar un bloque es una sección critica de unas pocas
+ ** instrucciones y solo cuando no quedan bloques libres el productor espera
+ ** a que el consumidor libere uno.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup ref_queue Colas de referencias
+ ** @brief Transferencia de bloques de memoria entre tareas sin copias
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "ref_queue.h"
+#include "mem_pool.h"
+
+/* === Definicion y Macros ===================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Estructura de control de una cola de referencias */
+struct ref_queue_s {
+   QueueHandle_t ready;          /*!< Cola de punteros a los bloques enviados */
+   MemPoolHandle_t pool;         /*!< Bloques de la cola */
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+/* === Definiciones de funciones externas ====================================================== */
+
+RefQueueHandle_t RefQueueCreate(UBaseType_t length, size_t size) {
+   RefQueueHandle_t queue;
+
+   configASSERT(length > 0);
+   configASSERT(size > 0);
+
+   queue = pvPortMalloc(sizeof(struct ref_queue_s));
+   if (queue == NULL) {
+      return NULL;
+   }
+
+   queue->pool = MemPoolCreate(length, size, NULL);
+   queue->ready = xQueueCreate(length, sizeof(void *));
+   if ((queue->ready == NULL) || (queue->pool == NULL)) {
+      RefQueueDelete(queue);
+      return NULL;
+   }
+   return queue;
+}
+
+void RefQueueDelete(RefQueueHandle_t queue) {
+   if (queue->ready != NULL) {
+      vQueueDelete(queue->ready);
+   }
+   if (queue->pool != NULL) {
+      MemPoolDelete(queue->pool);
+   }
+   vPortFree(queue);
+}
+
+void * RefQueueAcquire(RefQueueHandle_t queue, TickType_t wait) {
+   return MemPoolAlloc(queue->pool, wait);
+}
+
+void * RefQueueAcquireFromISR(RefQueueHandle_t queue, BaseType_t * woken) {
+   (void) woken;
+   return MemPoolAllocFromISR(queue->pool);
+}
+
+void RefQueueSend(RefQueueHandle_t queue, void * block) {
+   BaseType_t result;
+
+   configASSERT(MemPoolContains(queue->pool, block));
+   result = xQueueSend(queue->ready, &block, 0);
+   configASSERT(result == pdPASS);
+   (void) result;
+}
+
+void RefQueueSendFromISR(RefQueueHandle_t queue, void * block, BaseType_t * woken) {
+   BaseType_t result;
+
+   configASSERT(MemPoolContains(queue->pool, block));
+   result = xQueueSendFromISR(queue->ready, &block, woken);
+   configASSERT(result == pdPASS);
+   (void) result;
+}
+
+void * RefQueueReceive(RefQueueHandle_t queue, TickType_t wait) {
+   void * block;
+
+   if (xQueueReceive(queue->ready, &block, wait) != pdPASS) {
+      return NULL;
+   }
+   return block;
+}
+
+void * RefQueueReceiveFromISR(RefQueueHandle_t queue, BaseType_t * woken) {
+   void * block;
+
+   if (xQueueReceiveFromISR(queue->ready, &block, woken) != pdPASS) {
+      return NULL;
+   }
+   return block;
+}
+
+void RefQueueRelease(RefQueueHandle_t queue, void * block) {
+   MemPoolFree(queue->pool, block);
+}
+
+void RefQueueReleaseFromISR(RefQueueHandle_t queue, void * block, BaseType_t * woken) {
+   MemPoolFreeFromISR(queue->pool, block, woken);
+}
+
+UBaseType_t RefQueueMessagesWaiting(RefQueueHandle_t queue) {
+   return uxQueueMessagesWaiting(queue->ready);
+}
+
+UBaseType_t RefQueueBlocksAvailable(RefQueueHandle_t queue) {
+   return MemPoolAvailable(queue->pool);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
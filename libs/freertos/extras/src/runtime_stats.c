@@ -0,0 +1,391 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Estadisticas de ejecución por tarea medidas en ciclos
+ **
+ ** Cada tarea tiene un lugar en una tabla estatica, asignado al crearla y
+ ** cuyo indice se guarda en el campo uxTaskNumber de su bloque de control.
+ ** El lugar cero acumula las tareas creadas cuando la tabla esta completa.
+ **
+ ** Las funciones llamadas por el kernel se ejecutan siempre con las
+ ** interrupciones de prioridad configMAX_SYSCALL_INTERRUPT_PRIORITY o menor
+ ** enmascaradas (en el cambio de contexto y en el tick), por lo que no
+ ** necesitan protegerse entre si. Las funciones de las interrupciones y la
+ ** lectura del contador desde una tarea enmascaran las interrupciones.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup runtime_stats Estadisticas de ejecución
+ ** @brief Medición del uso del procesador por tarea e interrupciones
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "runtime_stats.h"
+#include "cycles.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Cantidad de lugares de la tabla, incluyendo el lugar compartido */
+#define SLOTS               ( configRUNTIME_STATS_MAX_TASKS + 1 )
+
+/** @brief Pila de la tarea que envia el informe periodico */
+#define REPORT_STACK        ( configMINIMAL_STACK_SIZE * 3 )
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Tiempos acumulados de una tarea */
+typedef struct slot_s {
+   void * task;                  /*!< Bloque de control de la tarea, NULL si el lugar esta libre */
+   uint64_t cycles;              /*!< Ciclos ejecutados sin contar interrupciones */
+   uint32_t max_run;             /*!< Ejecución continua mas larga */
+   uint32_t runs;                /*!< Cantidad de veces que tomo el procesador */
+} slot_t;
+
+/** @brief Estado global de la medición */
+typedef struct state_s {
+   uint32_t last;                /*!< Ultima lectura del contador de 32 bits */
+   uint32_t high;                /*!< Parte alta del contador extendido */
+   uint64_t now;                 /*!< Lectura tomada al salir la ultima tarea */
+   bool fresh;                   /*!< La lectura anterior puede usarse para el contador del kernel */
+   uint32_t frequency;           /*!< Frecuencia del contador */
+   uint64_t start;               /*!< Inicio de la medición */
+   uint32_t current;             /*!< Lugar de la tarea en ejecución */
+   uint64_t switched_in;         /*!< Momento en que la tarea en ejecución tomo el procesador */
+   uint64_t isr_at_switch_in;    /*!< Tiempo de interrupciones cuando la tarea tomo el procesador */
+   uint64_t isr_cycles;          /*!< Tiempo total de interrupciones */
+   uint64_t isr_start;           /*!< Inicio de la interrupción en curso */
+   uint32_t isr_max;             /*!< Interrupción mas larga */
+   uint32_t isr_count;           /*!< Cantidad de interrupciones */
+   uint32_t isr_nesting;         /*!< Interrupciones anidadas en curso */
+   uint64_t tick_start;          /*!< Inicio del tick en curso */
+   uint64_t tick_cycles;         /*!< Tiempo total de procesamiento de ticks */
+   uint32_t tick_max;            /*!< Procesamiento de tick mas largo */
+   uint32_t tick_count;          /*!< Cantidad de ticks */
+} state_t;
+
+/** @brief Configuración del informe periodico */
+typedef struct report_s {
+   TickType_t period;            /*!< Periodo del informe en ticks */
+   runtime_stats_output_t output;   /*!< Función que envia cada linea */
+} report_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Lee el contador de ciclos y lo extiende a 64 bits
+ **
+ ** Debe llamarse con las interrupciones enmascaradas y al menos una vez por
+ ** vuelta del contador de 32 bits, lo que garantiza la llamada en cada tick.
+ */
+static inline uint64_t Now(void);
+
+/** @brief Convierte ciclos del contador a microsegundos */
+static uint64_t ToMicroseconds(uint64_t cycles, uint32_t frequency);
+
+/** @brief Convierte ciclos del contador a nanosegundos, para duraciones menores a un segundo */
+static uint32_t ToNanoseconds(uint32_t cycles, uint32_t frequency);
+
+/** @brief Tarea que envia periodicamente la tabla de estadisticas */
+static void Report(void * parameters);
+
+/* === Definiciones de variables internas ====================================================== */
+
+static slot_t slots[SLOTS];
+
+static state_t state;
+
+static report_t report;
+
+/** @brief Copia de las estadisticas usada por la tarea del informe */
+static runtime_task_stats_t report_tasks[SLOTS];
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static inline uint64_t Now(void) {
+   uint32_t low = Read_Cycles();
+
+   if (low < state.last) {
+      state.high++;
+   }
+   state.last = low;
+   return ((uint64_t) state.high << 32) | low;
+}
+
+static uint64_t ToMicroseconds(uint64_t cycles, uint32_t frequency) {
+   if (frequency < 1000000) {
+      return (cycles * 1000000) / frequency;
+   }
+   return cycles / (frequency / 1000000);
+}
+
+static uint32_t ToNanoseconds(uint32_t cycles, uint32_t frequency) {
+   return (uint32_t) (((uint64_t) cycles * 1000000000ULL) / frequency);
+}
+
+static void Report(void * parameters) {
+   static char line[112 + configMAX_TASK_NAME_LEN];
+   runtime_stats_t stats;
+   TickType_t last;
+   UBaseType_t count;
+   UBaseType_t index;
+   uint32_t percent;
+
+   last = xTaskGetTickCount();
+   while (1) {
+      vTaskDelayUntil(&last, report.period);
+      count = RuntimeStatsSnapshot(&stats, report_tasks, SLOTS);
+      if (stats.elapsed == 0) {
+         continue;
+      }
+
+      percent = (uint32_t) ((stats.isr_cycles * 10000) / stats.elapsed);
+      snprintf(line, sizeof(line),
+         "# runtime-stats elapsed_ms=%lu isr_pct=%lu.%02lu isr_count=%lu isr_max_us=%lu tick_avg_ns=%lu "
+         "tick_max_ns=%lu\r\n",
+         (unsigned long) (ToMicroseconds(stats.elapsed, stats.frequency) / 1000),
+         (unsigned long) (percent / 100), (unsigned long) (percent % 100), (unsigned long) stats.isr_count,
+         (unsigned long) ToMicroseconds(stats.isr_max, stats.frequency),
+         (unsigned long) ToNanoseconds((stats.tick_count > 0) ? (uint32_t) (stats.tick_cycles / stats.tick_count) : 0,
+            stats.frequency),
+         (unsigned long) ToNanoseconds(stats.tick_max, stats.frequency));
+      report.output(line);
+      report.output("task,cpu_pct,time_ms,max_run_us,runs\r\n");
+
+      for (index = 0; index < count; index++) {
+         percent = (uint32_t) ((report_tasks[index].cycles * 10000) / stats.elapsed);
+         snprintf(line, sizeof(line), "%s,%lu.%02lu,%lu,%lu,%lu\r\n", report_tasks[index].name,
+            (unsigned long) (percent / 100), (unsigned long) (percent % 100),
+            (unsigned long) (ToMicroseconds(report_tasks[index].cycles, stats.frequency) / 1000),
+            (unsigned long) ToMicroseconds(report_tasks[index].max_run, stats.frequency),
+            (unsigned long) report_tasks[index].runs);
+         report.output(line);
+      }
+   }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void RuntimeStatsStart(void) {
+   Init_Cycles();
+   state.frequency = Cycles_Frequency();
+   state.last = Read_Cycles();
+   state.now = Now();
+   state.start = state.now;
+}
+
+uint32_t RuntimeStatsKernelCounter(void) {
+   UBaseType_t mask;
+   uint64_t now;
+
+   /* En el cambio de contexto el kernel lee el contador inmediatamente
+    * despues de RuntimeStatsTaskOut, por lo que se reutiliza esa lectura */
+   if (state.fresh) {
+      state.fresh = false;
+      now = state.now;
+   } else {
+      mask = portSET_INTERRUPT_MASK_FROM_ISR();
+      now = Now();
+      portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+   }
+   return (uint32_t) (now >> configRUNTIME_STATS_KERNEL_SHIFT);
+}
+
+uint32_t RuntimeStatsTaskCreated(void * task) {
+   uint32_t index;
+
+   for (index = 1; index < SLOTS; index++) {
+      if (slots[index].task == NULL) {
+         memset(&slots[index], 0, sizeof(slots[index]));
+         slots[index].task = task;
+         return index;
+      }
+   }
+   return 0;
+}
+
+void RuntimeStatsTaskDeleted(uint32_t index) {
+   if (index != 0) {
+      slots[index].task = NULL;
+   }
+}
+
+void RuntimeStatsTaskOut(uint32_t index) {
+   slot_t * slot = &slots[index];
+   uint64_t run;
+
+   state.now = Now();
+   state.fresh = true;
+
+   run = (state.now - state.switched_in) - (state.isr_cycles - state.isr_at_switch_in);
+   slot->cycles += run;
+   if (run > slot->max_run) {
+      slot->max_run = (run > UINT32_MAX) ? UINT32_MAX : (uint32_t) run;
+   }
+}
+
+void RuntimeStatsTaskIn(uint32_t index) {
+   state.current = index;
+   state.switched_in = state.now;
+   state.isr_at_switch_in = state.isr_cycles;
+   slots[index].runs++;
+}
+
+void RuntimeStatsTick(void) {
+   state.tick_start = Now();
+}
+
+void RuntimeStatsTickExit(void) {
+   uint64_t duration = Now() - state.tick_start;
+
+   state.tick_cycles += duration;
+   state.tick_count++;
+   if (duration > state.tick_max) {
+      state.tick_max = (duration > UINT32_MAX) ? UINT32_MAX : (uint32_t) duration;
+   }
+}
+
+void RuntimeStatsIsrEnter(void) {
+   UBaseType_t mask;
+
+   mask = portSET_INTERRUPT_MASK_FROM_ISR();
+   if (state.isr_nesting == 0) {
+      state.isr_start = Now();
+   }
+   state.isr_nesting++;
+   portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+void RuntimeStatsIsrExit(void) {
+   UBaseType_t mask;
+   uint64_t duration;
+
+   mask = portSET_INTERRUPT_MASK_FROM_ISR();
+   state.isr_nesting--;
+   if (state.isr_nesting == 0) {
+      duration = Now() - state.isr_start;
+      state.isr_cycles += duration;
+      state.isr_count++;
+      if (duration > state.isr_max) {
+         state.isr_max = (duration > UINT32_MAX) ? UINT32_MAX : (uint32_t) duration;
+      }
+   }
+   portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+UBaseType_t RuntimeStatsSnapshot(runtime_stats_t * stats, runtime_task_stats_t * tasks, UBaseType_t count) {
+   UBaseType_t filled = 0;
+   UBaseType_t existing = 0;
+   uint32_t index;
+   uint64_t now;
+   const char * name;
+
+   taskENTER_CRITICAL();
+   now = Now();
+
+   for (index = 0; index < SLOTS; index++) {
+      if ((index == 0) ? (slots[0].runs == 0) : (slots[index].task == NULL)) {
+         continue;
+      }
+      existing++;
+      if (filled < count) {
+         tasks[filled].task = slots[index].task;
+         tasks[filled].cycles = slots[index].cycles;
+         tasks[filled].max_run = slots[index].max_run;
+         tasks[filled].runs = slots[index].runs;
+         if (index == state.current) {
+            tasks[filled].cycles += (now - state.switched_in) - (state.isr_cycles - state.isr_at_switch_in);
+         }
+         name = (index == 0) ? "otras" : pcTaskGetName(slots[index].task);
+         strncpy(tasks[filled].name, name, sizeof(tasks[filled].name) - 1);
+         tasks[filled].name[sizeof(tasks[filled].name) - 1] = '\0';
+         filled++;
+      }
+   }
+
+   if (stats != NULL) {
+      stats->elapsed = now - state.start;
+      stats->isr_cycles = state.isr_cycles;
+      stats->isr_max = state.isr_max;
+      stats->isr_count = state.isr_count;
+      stats->tick_cycles = state.tick_cycles;
+      stats->tick_max = state.tick_max;
+      stats->tick_count = state.tick_count;
+      stats->frequency = state.frequency;
+      stats->tasks = existing;
+   }
+   taskEXIT_CRITICAL();
+
+   return filled;
+}
+
+void RuntimeStatsReset(void) {
+   uint32_t index;
+
+   taskENTER_CRITICAL();
+   state.start = Now();
+   state.switched_in = state.start;
+   state.isr_cycles = 0;
+   state.isr_at_switch_in = 0;
+   state.isr_max = 0;
+   state.isr_count = 0;
+   state.tick_cycles = 0;
+   state.tick_max = 0;
+   state.tick_count = 0;
+   for (index = 0; index < SLOTS; index++) {
+      slots[index].cycles = 0;
+      slots[index].max_run = 0;
+      slots[index].runs = 0;
+   }
+   taskEXIT_CRITICAL();
+}
+
+BaseType_t RuntimeStatsStartReport(TickType_t period, runtime_stats_output_t output, UBaseType_t priority) {
+   configASSERT(output != NULL);
+   configASSERT(period > 0);
+
+   report.period = period;
+   report.output = output;
+   return xTaskCreate(Report, "Estadisticas", REPORT_STACK, NULL, priority, NULL);
+}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,94 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Descripción estatica de las tareas y objetos del kernel de un sistema
+ **
+ ** Cuando configSUPPORT_STATIC_ALLOCATION es 1 el kernel pide a la aplicación
+ ** la memoria de la tarea IDLE y de la tarea de servicio de los
+ ** temporizadores, que se define aqui con los tamaños de pila de
+ ** FreeRTOSConfig.h.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup static_system Sistema estatico
+ ** @brief Creación de las tareas y objetos del kernel sin memoria dinámica
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "static_system.h"
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+/* === Definicion y Macros ===================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Bloque de control y pila de la tarea IDLE */
+static StaticTask_t idle_tcb;
+static StackType_t idle_stack[configMINIMAL_STACK_SIZE];
+
+#if ( configUSE_TIMERS == 1 )
+/** @brief Bloque de control y pila de la tarea de servicio de los temporizadores */
+static StaticTask_t timer_tcb;
+static StackType_t timer_stack[configTIMER_TASK_STACK_DEPTH];
+#endif
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void vApplicationGetIdleTaskMemory(StaticTask_t ** tcb, StackType_t ** stack, uint32_t * size) {
+   *tcb = &idle_tcb;
+   *stack = idle_stack;
+   *size = configMINIMAL_STACK_SIZE;
+}
+
+#if ( configUSE_TIMERS == 1 )
+void vApplicationGetTimerTaskMemory(StaticTask_t ** tcb, StackType_t ** stack, uint32_t * size) {
+   *tcb = &timer_tcb;
+   *stack = timer_stack;
+   *size = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
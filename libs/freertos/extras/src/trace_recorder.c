@@ -0,0 +1,270 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Registro binario de los eventos del kernel
+ **
+ ** El registro completo es una única variable global, trace_recorder, con
+ ** una cabecera que describe su formato, las tablas de nombres de tareas y
+ ** colas y el anillo de eventos. El programa de la PC lee la variable tal
+ ** como esta en memoria, ya sea copiada por GDB o enviada en hexadecimal por
+ ** TraceRecorderDump, por lo que su disposición es parte del formato y
+ ** scripts/trace/trace2perfetto.py debe cambiar junto con ella.
+ **
+ ** Cada evento reserva su lugar incrementando atomicamente el contador de
+ ** eventos escritos y después completa el registro. No se enmascaran las
+ ** interrupciones, por lo que pueden registrar eventos las interrupciones de
+ ** cualquier prioridad, incluso las que estan por encima de
+ ** configMAX_SYSCALL_INTERRUPT_PRIORITY. Si una interrupción se registra entre
+ ** la reserva y la lectura del contador de ciclos de otro evento, los dos
+ ** quedan en el anillo con los tiempos invertidos; el programa de la PC los
+ ** ordena por tiempo.
+ **
+ ** En la EDU-CIAA el registro se ubica en el banco RamAHB_ETB16, que no usan
+ ** el heap ni las pilas, para no desplazar la memoria de la aplicación.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup trace_recorder Registro de eventos
+ ** @brief Registro de la actividad del planificador para verla como linea de tiempo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "trace_recorder.h"
+#include "cycles.h"
+#include <stdio.h>
+#include <string.h>
+#ifndef PLATFORM_HOST
+#include "chip.h"
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/* === Definicion y Macros ===================================================================== */
+
+#if ( ( configTRACE_BUFFER_RECORDS & ( configTRACE_BUFFER_RECORDS - 1 ) ) != 0 )
+#error configTRACE_BUFFER_RECORDS debe ser una potencia de dos
+#endif
+
+/** @brief Ubicación del registro en la memoria */
+#ifdef PLATFORM_HOST
+#define TRACE_SECTION
+#else
+#define TRACE_SECTION       __attribute__((section(".bss.$RamAHB_ETB16")))
+#endif
+
+/** @brief Bytes del registro enviados en cada linea de texto */
+#define DUMP_BYTES          32
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Registro completo, tal como lo lee el programa de la PC
+ **
+ ** Todos los campos de la cabecera son de 32 bits y en el orden de bytes
+ ** del procesador, que es little endian tanto en la EDU-CIAA como en la PC.
+ */
+typedef struct trace_recorder_s {
+   char magic[8];                /*!< TRACE_RECORDER_MAGIC, vacio mientras el registro no se inicio */
+   uint32_t version;             /*!< TRACE_RECORDER_VERSION */
+   uint32_t frequency;           /*!< Frecuencia del contador de ciclos */
+   uint32_t capacity;            /*!< Cantidad de eventos del anillo */
+   uint32_t name_length;         /*!< Longitud de cada nombre, incluyendo el terminador */
+   uint32_t max_tasks;           /*!< Cantidad de nombres de tareas */
+   uint32_t max_queues;          /*!< Cantidad de nombres de colas */
+   uint32_t tasks;               /*!< Cantidad de tareas creadas */
+   uint32_t queues;              /*!< Cantidad de colas creadas */
+   volatile uint32_t written;    /*!< Cantidad de eventos escritos */
+   volatile uint32_t enabled;    /*!< Distinto de cero mientras se registran eventos */
+   char task_names[configTRACE_MAX_TASKS][configMAX_TASK_NAME_LEN];   /*!< Nombre de la tarea número n + 1 */
+   char queue_names[configTRACE_MAX_QUEUES][configMAX_TASK_NAME_LEN]; /*!< Nombre de la cola número n + 1 */
+   trace_record_t records[configTRACE_BUFFER_RECORDS];                 /*!< Anillo de eventos */
+} trace_recorder_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Completa la cabecera y habilita el registro la primera vez que se llama */
+static void Setup(void);
+
+/** @brief Incrementa atomicamente un contador y devuelve el valor anterior */
+static inline uint32_t FetchIncrement(volatile uint32_t * value);
+
+/** @brief Número de la excepción en curso, cero fuera de las interrupciones */
+static inline uint32_t ExceptionNumber(void);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/** @brief Registro de eventos, con nombre global para que GDB lo encuentre */
+trace_recorder_t trace_recorder TRACE_SECTION;
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void Setup(void) {
+   if (trace_recorder.magic[0] == 0) {
+      Init_Cycles();
+      trace_recorder.version = TRACE_RECORDER_VERSION;
+      trace_recorder.frequency = Cycles_Frequency();
+      trace_recorder.capacity = configTRACE_BUFFER_RECORDS;
+      trace_recorder.name_length = configMAX_TASK_NAME_LEN;
+      trace_recorder.max_tasks = configTRACE_MAX_TASKS;
+      trace_recorder.max_queues = configTRACE_MAX_QUEUES;
+      trace_recorder.written = 0;
+      trace_recorder.enabled = 1;
+      memcpy(trace_recorder.magic, TRACE_RECORDER_MAGIC, sizeof(trace_recorder.magic));
+   }
+}
+
+#ifdef PLATFORM_HOST
+
+static inline uint32_t FetchIncrement(volatile uint32_t * value) {
+   return __atomic_fetch_add(value, 1, __ATOMIC_RELAXED);
+}
+
+static inline uint32_t ExceptionNumber(void) {
+   return 0;
+}
+
+#else
+
+static inline uint32_t FetchIncrement(volatile uint32_t * value) {
+   uint32_t previous;
+
+   do {
+      previous = __LDREXW(value);
+   } while (__STREXW(previous + 1, value) != 0);
+   return previous;
+}
+
+static inline uint32_t ExceptionNumber(void) {
+   return __get_IPSR();
+}
+
+#endif
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void TraceEvent(uint32_t code, uint32_t argument) {
+   trace_record_t * record;
+
+   if (trace_recorder.enabled) {
+      record = &trace_recorder.records[FetchIncrement(&trace_recorder.written) & (configTRACE_BUFFER_RECORDS - 1)];
+      record->time = Read_Cycles();
+      record->event = (code << 24) | (argument & 0x00FFFFFF);
+   }
+}
+
+uint32_t TraceTaskCreated(const char * name) {
+   uint32_t number;
+
+   Setup();
+   number = FetchIncrement(&trace_recorder.tasks) + 1;
+   if (number <= configTRACE_MAX_TASKS) {
+      strncpy(trace_recorder.task_names[number - 1], name, configMAX_TASK_NAME_LEN - 1);
+   }
+   TraceEvent(TRACE_TASK_CREATE, number);
+   return number;
+}
+
+uint32_t TraceQueueCreated(uint8_t type) {
+   uint32_t number;
+
+   Setup();
+   number = FetchIncrement(&trace_recorder.queues) + 1;
+   TraceEvent(TRACE_QUEUE_CREATE, ((uint32_t) type << 16) | (number & 0xFFFF));
+   return number;
+}
+
+void TraceQueueNamed(uint32_t number, const char * name) {
+   if ((number > 0) && (number <= configTRACE_MAX_QUEUES)) {
+      strncpy(trace_recorder.queue_names[number - 1], name, configMAX_TASK_NAME_LEN - 1);
+   }
+}
+
+void TraceUserEvent(uint32_t value) {
+   TraceEvent(TRACE_USER, value);
+}
+
+void TraceIsrEnter(void) {
+   TraceEvent(TRACE_ISR_ENTER, ExceptionNumber());
+}
+
+void TraceIsrExit(void) {
+   TraceEvent(TRACE_ISR_EXIT, ExceptionNumber());
+}
+
+void TraceRecorderStop(void) {
+   trace_recorder.enabled = 0;
+}
+
+void TraceRecorderStart(void) {
+   Setup();
+   trace_recorder.enabled = 1;
+}
+
+void TraceRecorderClear(void) {
+   trace_recorder.written = 0;
+   memset(trace_recorder.records, 0, sizeof(trace_recorder.records));
+}
+
+uint32_t TraceRecorderCount(void) {
+   return trace_recorder.written;
+}
+
+void TraceRecorderDump(void (*output)(const char * text)) {
+   static char line[16 + 2 * DUMP_BYTES];
+   const uint8_t * data = (const uint8_t *) &trace_recorder;
+   uint32_t enabled = trace_recorder.enabled;
+   size_t offset;
+   size_t index;
+   int length;
+
+   trace_recorder.enabled = 0;
+   snprintf(line, sizeof(line), "@trace-begin bytes=%lu\r\n", (unsigned long) sizeof(trace_recorder));
+   output(line);
+   for (offset = 0; offset < sizeof(trace_recorder); offset += DUMP_BYTES) {
+      length = snprintf(line, sizeof(line), "@trace ");
+      for (index = offset; (index < offset + DUMP_BYTES) && (index < sizeof(trace_recorder)); index++) {
+         length += snprintf(&line[length], sizeof(line) - length, "%02x", data[index]);
+      }
+      snprintf(&line[length], sizeof(line) - length, "\r\n");
+      output(line);
+   }
+   output("@trace-end\r\n");
+   trace_recorder.enabled = enabled;
+}
+
+#endif /* configUSE_TRACE_RECORDER */
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,380 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Temporizadores de software con resolución de microsegundos
+ **
+ ** Los temporizadores activos forman una lista simple ordenada por
+ ** vencimiento. Los vencimientos se comparan con diferencias con signo de 32
+ ** bits, igual que los ticks del kernel, por lo que ningún temporizador puede
+ ** programarse a mas de 35 minutos. Cada vez que cambia el primero de la
+ ** lista se vuelve a programar la comparación del contador.
+ **
+ ** La lista se modifica dentro de secciones criticas, que en la EDU-CIAA
+ ** enmascaran la interrupción del contador. La rutina de servicio retira de
+ ** a un temporizador vencido por vez, lo vuelve a insertar si es periodico y
+ ** ejecuta su función fuera de la sección critica, para que la interrupción
+ ** quede enmascarada el menor tiempo posible aun con muchos vencimientos
+ ** simultaneos.
+ **
+ ** Un temporizador en modo US_TIMER_TASK cuenta los vencimientos enviados a
+ ** la tarea de servicio que todavía no se ejecutaron. Si se elimina con
+ ** vencimientos pendientes solo se marca, y lo libera la tarea de servicio
+ ** al procesar el último de ellos.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup us_timer Temporizadores de microsegundos
+ ** @brief Vencimientos y demoras de alta resolución
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "us_timer.h"
+
+#if ( configUSE_US_TIMERS == 1 )
+
+#include "usec_timer.h"
+#include <string.h>
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Verdadero si el instante a es anterior al instante b */
+#define BEFORE(a, b)          ( ( int32_t ) ( ( uint32_t ) ( a ) - ( uint32_t ) ( b ) ) < 0 )
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Estructura de control de un temporizador */
+struct us_timer_s {
+   struct us_timer_s * next;     /*!< Siguiente temporizador activo */
+   UsTimerCallback_t callback;   /*!< Función que se ejecuta al vencer */
+   void * context;               /*!< Valor que se entrega a la función */
+   uint32_t deadline;            /*!< Instante del próximo vencimiento */
+   uint32_t period;              /*!< Microsegundos entre vencimientos, cero si es de una vez */
+   uint32_t missed;              /*!< Vencimientos perdidos */
+   uint16_t pending;             /*!< Vencimientos enviados a la tarea de servicio sin ejecutar */
+   uint8_t mode;                 /*!< US_TIMER_ISR o US_TIMER_TASK */
+   volatile uint8_t active;      /*!< El temporizador esta en la lista */
+   uint8_t deleted;              /*!< Se elimino con vencimientos pendientes */
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Agrega un temporizador a la lista despues de los que vencen en el mismo instante
+ **
+ ** Se llama dentro de una sección critica.
+ */
+static void Insert(struct us_timer_s * timer);
+
+/** @brief Quita un temporizador de la lista si esta activo
+ **
+ ** Se llama dentro de una sección critica.
+ */
+static void Remove(struct us_timer_s * timer);
+
+/** @brief Programa la comparación con el primer vencimiento si cambio el primero de la lista
+ **
+ ** Se llama dentro de una sección critica.
+ **
+ ** @param[in] first      Primer temporizador de la lista antes de modificarla
+ */
+static void Reprogram(const struct us_timer_s * first);
+
+/** @brief Arranca un temporizador, se llama dentro de una sección critica
+ **
+ ** @param[in] timer      Temporizador que se arranca
+ ** @param[in] deadline   Instante del primer vencimiento
+ ** @param[in] period     Microsegundos entre los vencimientos siguientes
+ */
+static void Arm(struct us_timer_s * timer, uint32_t deadline, uint32_t period);
+
+/** @brief Detiene un temporizador, se llama dentro de una sección critica */
+static void Disarm(struct us_timer_s * timer);
+
+/** @brief Ejecuta en la tarea de servicio un vencimiento de un temporizador en modo US_TIMER_TASK */
+static void Dispatch(void * timer, uint32_t unused);
+
+/** @brief Despierta a la tarea que espera en UsTimerDelay */
+static void Wake(UsTimerHandle_t timer, void * context, BaseType_t * woken);
+
+/** @brief Bloquea a la tarea actual hasta el instante indicado */
+static void Sleep(uint32_t deadline);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Temporizadores activos ordenados por vencimiento */
+static struct us_timer_s * volatile timers;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void Insert(struct us_timer_s * timer) {
+   struct us_timer_s * volatile * link = &timers;
+
+   while ((*link != NULL) && !BEFORE(timer->deadline, (*link)->deadline)) {
+      link = &(*link)->next;
+   }
+   timer->next = *link;
+   *link = timer;
+   timer->active = 1;
+}
+
+static void Remove(struct us_timer_s * timer) {
+   struct us_timer_s * volatile * link = &timers;
+
+   if (timer->active) {
+      while (*link != timer) {
+         link = &(*link)->next;
+      }
+      *link = timer->next;
+      timer->next = NULL;
+      timer->active = 0;
+   }
+}
+
+static void Reprogram(const struct us_timer_s * first) {
+   if (timers != first) {
+      if (timers == NULL) {
+         Clear_Usec_Timer_Match();
+      } else {
+         Set_Usec_Timer_Match(timers->deadline);
+      }
+   }
+}
+
+static void Arm(struct us_timer_s * timer, uint32_t deadline, uint32_t period) {
+   const struct us_timer_s * first = timers;
+
+   Remove(timer);
+   timer->deadline = deadline;
+   timer->period = period;
+   Insert(timer);
+   Reprogram(first);
+}
+
+static void Disarm(struct us_timer_s * timer) {
+   const struct us_timer_s * first = timers;
+
+   Remove(timer);
+   Reprogram(first);
+}
+
+static void Dispatch(void * timer, uint32_t unused) {
+   struct us_timer_s * self = timer;
+   BaseType_t deleted;
+   BaseType_t release;
+
+   taskENTER_CRITICAL();
+   self->pending--;
+   deleted = self->deleted;
+   release = (deleted && (self->pending == 0));
+   taskEXIT_CRITICAL();
+
+   if (!deleted) {
+      self->callback(self, self->context, NULL);
+   } else if (release) {
+      vPortFree(self);
+   }
+}
+
+static void Wake(UsTimerHandle_t timer, void * context, BaseType_t * woken) {
+   xTaskNotifyFromISR((TaskHandle_t) context, 0, eNoAction, woken);
+}
+
+static void Sleep(uint32_t deadline) {
+   struct us_timer_s timer;
+
+   memset(&timer, 0, sizeof(timer));
+   timer.callback = Wake;
+   timer.context = xTaskGetCurrentTaskHandle();
+   timer.mode = US_TIMER_ISR;
+
+   taskENTER_CRITICAL();
+   Arm(&timer, deadline, 0);
+   taskEXIT_CRITICAL();
+
+   /* El vencimiento siempre notifica a la tarea, aun si ya ocurrio, por lo
+    * que se espera al menos una vez para no dejar la notificación pendiente.
+    * La notificación no modifica el valor de la tarea, y una que llegue por
+    * otro motivo solo provoca una vuelta mas del lazo */
+   do {
+      xTaskNotifyWait(0, 0, NULL, portMAX_DELAY);
+   } while (timer.active);
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void USEC_TIMER_IRQHandler(void) {
+   BaseType_t woken = pdFALSE;
+   struct us_timer_s * timer;
+   UBaseType_t mask;
+   uint32_t now;
+   uint32_t skipped;
+
+   Clear_Usec_Timer_Match();
+   while (1) {
+      mask = taskENTER_CRITICAL_FROM_ISR();
+      timer = timers;
+      now = Read_Usec_Timer();
+      if ((timer == NULL) || BEFORE(now, timer->deadline)) {
+         if (timer != NULL) {
+            Set_Usec_Timer_Match(timer->deadline);
+         }
+         taskEXIT_CRITICAL_FROM_ISR(mask);
+         break;
+      }
+
+      timers = timer->next;
+      timer->next = NULL;
+      timer->active = 0;
+      if (timer->period != 0) {
+         /* Los periodos que ya pasaron se cuentan como perdidos para que el
+          * temporizador siga en fase con su primer vencimiento */
+         timer->deadline += timer->period;
+         if (!BEFORE(now, timer->deadline)) {
+            skipped = (now - timer->deadline) / timer->period + 1;
+            timer->deadline += skipped * timer->period;
+            timer->missed += skipped;
+         }
+         Insert(timer);
+      }
+      if (timer->mode == US_TIMER_TASK) {
+         if (xTimerPendFunctionCallFromISR(Dispatch, timer, 0, &woken) == pdPASS) {
+            timer->pending++;
+         } else {
+            timer->missed++;
+         }
+      }
+      taskEXIT_CRITICAL_FROM_ISR(mask);
+
+      if (timer->mode == US_TIMER_ISR) {
+         timer->callback(timer, timer->context, &woken);
+      }
+   }
+   portYIELD_FROM_ISR(woken);
+}
+
+void UsTimerInit(void) {
+   timers = NULL;
+   Init_Usec_Timer(configUS_TIMER_INTERRUPT_PRIORITY);
+}
+
+UsTimerHandle_t UsTimerCreate(UsTimerCallback_t callback, void * context, BaseType_t mode) {
+   struct us_timer_s * timer;
+
+   configASSERT(callback != NULL);
+   configASSERT((mode == US_TIMER_ISR) || (mode == US_TIMER_TASK));
+
+   timer = pvPortMalloc(sizeof(*timer));
+   if (timer != NULL) {
+      memset(timer, 0, sizeof(*timer));
+      timer->callback = callback;
+      timer->context = context;
+      timer->mode = (uint8_t) mode;
+   }
+   return timer;
+}
+
+void UsTimerDelete(UsTimerHandle_t timer) {
+   BaseType_t pending;
+
+   taskENTER_CRITICAL();
+   Disarm(timer);
+   pending = (timer->pending != 0);
+   timer->deleted = 1;
+   taskEXIT_CRITICAL();
+
+   if (!pending) {
+      vPortFree(timer);
+   }
+}
+
+void UsTimerStart(UsTimerHandle_t timer, uint32_t delay, uint32_t period) {
+   taskENTER_CRITICAL();
+   Arm(timer, Read_Usec_Timer() + delay, period);
+   taskEXIT_CRITICAL();
+}
+
+void UsTimerStartFromISR(UsTimerHandle_t timer, uint32_t delay, uint32_t period) {
+   UBaseType_t mask;
+
+   mask = taskENTER_CRITICAL_FROM_ISR();
+   Arm(timer, Read_Usec_Timer() + delay, period);
+   taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+
+void UsTimerStop(UsTimerHandle_t timer) {
+   taskENTER_CRITICAL();
+   Disarm(timer);
+   taskEXIT_CRITICAL();
+}
+
+void UsTimerStopFromISR(UsTimerHandle_t timer) {
+   UBaseType_t mask;
+
+   mask = taskENTER_CRITICAL_FROM_ISR();
+   Disarm(timer);
+   taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+
+BaseType_t UsTimerIsActive(UsTimerHandle_t timer) {
+   return timer->active ? pdTRUE : pdFALSE;
+}
+
+uint32_t UsTimerMissed(UsTimerHandle_t timer) {
+   return timer->missed;
+}
+
+uint32_t UsTimerNow(void) {
+   return Read_Usec_Timer();
+}
+
+void UsTimerDelay(uint32_t usec) {
+   /* El contador pudo estar por avanzar al leerlo, el microsegundo extra
+    * asegura que la demora nunca sea menor a la pedida */
+   if (usec > 0) {
+      Sleep(UsTimerNow() + usec + 1);
+   }
+}
+
+void UsTimerDelayUntil(uint32_t * previous, uint32_t period) {
+   *previous += period;
+   if (BEFORE(UsTimerNow(), *previous)) {
+      Sleep(*previous);
+   }
+}
+
+#endif /* configUSE_US_TIMERS */
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
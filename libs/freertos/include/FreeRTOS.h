@@ -256,6 +256,23 @@ extern "C" {
 		#error If configUSE_TIMERS is set to 1 then configTIMER_TASK_STACK_DEPTH must also be defined.
 	#endif /* configTIMER_TASK_STACK_DEPTH */
 
+	/* Set configUSE_TIMER_WHEEL to 1 to keep the active timers in a
+	hierarchical timing wheel instead of the sorted active timer lists. */
+	#ifndef configUSE_TIMER_WHEEL
+		#define configUSE_TIMER_WHEEL 0
+	#endif
+
+	/* Levels of the timing wheel.  Each level has 32 slots, so the wheel covers
+	2^( 5 * configTIMER_WHEEL_LEVELS ) ticks.  Longer delays are cascaded from
+	the top level again when they reach it. */
+	#ifndef configTIMER_WHEEL_LEVELS
+		#define configTIMER_WHEEL_LEVELS 4
+	#endif
+
+	#if ( configUSE_TIMER_WHEEL == 1 ) && ( ( configTIMER_WHEEL_LEVELS < 2 ) || ( configTIMER_WHEEL_LEVELS > 6 ) )
+		#error configTIMER_WHEEL_LEVELS must be between 2 and 6.
+	#endif
+
 #endif /* configUSE_TIMERS */
 
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
@@ -528,6 +545,12 @@ extern "C" {
 	#define traceTASK_INCREMENT_TICK( xTickCount )
 #endif
 
+#ifndef traceTASK_INCREMENT_TICK_EXIT
+	/* Called at the end of xTaskIncrementTick(), after the tasks whose delay
+	expired have been moved to the ready lists. */
+	#define traceTASK_INCREMENT_TICK_EXIT( xTickCount )
+#endif
+
 #ifndef traceTIMER_CREATE
 	#define traceTIMER_CREATE( pxNewTimer )
 #endif
@@ -806,6 +829,21 @@ extern "C" {
 	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
 #endif
 
+/* Set configUSE_DELAYED_TASK_WHEEL to 1 to keep the delayed tasks in a wheel
+of configDELAYED_TASK_WHEEL_SLOTS unsorted lists indexed by wake time, instead
+of the two delayed task lists sorted by wake time. */
+#ifndef configUSE_DELAYED_TASK_WHEEL
+	#define configUSE_DELAYED_TASK_WHEEL 0
+#endif
+
+#ifndef configDELAYED_TASK_WHEEL_SLOTS
+	#define configDELAYED_TASK_WHEEL_SLOTS 64
+#endif
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 ) && ( ( configDELAYED_TASK_WHEEL_SLOTS < 32 ) || ( ( configDELAYED_TASK_WHEEL_SLOTS & ( configDELAYED_TASK_WHEEL_SLOTS - 1 ) ) != 0 ) )
+	#error configDELAYED_TASK_WHEEL_SLOTS must be a power of two no smaller than 32.
+#endif
+
 #ifndef configAPPLICATION_ALLOCATED_HEAP
 	#define configAPPLICATION_ALLOCATED_HEAP 0
 #endif
@@ -130,11 +130,39 @@ typedef struct HeapRegion
  */
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
+/* Used to pass information about the heap out of vPortGetHeapStats(). */
+typedef struct xHeapStats
+{
+	size_t xAvailableHeapSpaceInBytes;		/* The total heap size currently available - this is the sum of all the free blocks, not the largest block that can be allocated. */
+	size_t xSizeOfLargestFreeBlockInBytes; 	/* The maximum size, in bytes, of all the free blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xSizeOfSmallestFreeBlockInBytes; /* The minimum size, in bytes, of all the free blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xNumberOfFreeBlocks;				/* The number of free memory blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xMinimumEverFreeBytesRemaining;	/* The minimum amount of total free memory (sum of all free blocks) there has been in the heap since the system booted. */
+	size_t xNumberOfSuccessfulAllocations;	/* The number of calls to pvPortMalloc() that have returned a valid memory block. */
+	size_t xNumberOfSuccessfulFrees;		/* The number of calls to vPortFree() that has successfully freed a block of memory. */
+	size_t xFragmentationPerMille;			/* The part of the available space, in thousandths, that is not in the largest free block. */
+} HeapStats_t;
+
+/*
+ * Returns a HeapStats_t structure filled with information about the current
+ * heap state.  Only provided by heap_6.c.
+ */
+void vPortGetHeapStats( HeapStats_t *pxHeapStats );
+
 
 /*
  * Map to the memory management routines required for the port.
  */
 void *pvPortMalloc( size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Only provided by heap_5.c.  Behaves as pvPortMalloc() but only returns a
+ * block that lies entirely between pvLowest and pvHighest, which is used to
+ * place an allocation in a given RAM bank.  A NULL pvHighest means no upper
+ * limit.
+ */
+void *pvPortMallocInRange( size_t xSize, const void *pvLowest, const void *pvHighest ) PRIVILEGED_FUNCTION;
+
 void vPortFree( void *pv ) PRIVILEGED_FUNCTION;
 void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
@@ -1384,6 +1384,148 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherP
  */
 BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSendMultiple(
+								QueueHandle_t xQueue,
+								const void *pvItems,
+								UBaseType_t uxCount,
+								TickType_t xTicksToWait
+							);
+ * </pre>
+ *
+ * Post a batch of items to the back of a queue.  As many items as there is
+ * space for, up to uxCount, are copied under a single critical section and at
+ * most one task waiting to receive is unblocked for the whole batch, so a
+ * burst costs one kernel entry instead of uxCount.  The call only blocks while
+ * the queue is completely full.
+ *
+ * Waking a single reader per batch is meant for queues with one consumer.  If
+ * several tasks are blocked reading the same queue the ones that were not
+ * unblocked stay blocked, even with data available, until the next send.
+ *
+ * Cannot be used on semaphores, mutexes or queues that are members of a
+ * queue set.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems Pointer to an array of uxCount items, each of the size given
+ * when the queue was created.
+ *
+ * @param uxCount The number of items in the array.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.
+ *
+ * @return The number of items copied to the queue, from 0 (the block time
+ * expired with the queue full) to uxCount.
+ *
+ * Example usage:
+   <pre>
+ uint16_t usSamples[ 8 ];
+
+	// Post the whole buffer, waiting for space as needed.
+	for( x = 0; x < 8; x += xSent )
+	{
+		xSent = xQueueSendMultiple( xQueue, &( usSamples[ x ] ), 8 - x, portMAX_DELAY );
+	}
+ </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSendMultipleFromISR(
+									   QueueHandle_t xQueue,
+									   const void *pvItems,
+									   UBaseType_t uxCount,
+									   BaseType_t *pxHigherPriorityTaskWoken
+									 );
+ * </pre>
+ *
+ * Version of xQueueSendMultiple() that can be used from an interrupt service
+ * routine.  Items that do not fit in the queue are not copied.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the batch
+ * unblocked a task with a priority higher than the running task, in which
+ * case a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items copied to the queue, from 0 to uxCount.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveMultiple(
+								   QueueHandle_t xQueue,
+								   void *pvBuffer,
+								   UBaseType_t uxCount,
+								   TickType_t xTicksToWait
+							   );
+ * </pre>
+ *
+ * Receive a batch of items from a queue.  All the items available, up to
+ * uxCount, are copied out under a single critical section and at most one
+ * task waiting to send is unblocked for the whole batch.  The call only blocks
+ * while the queue is empty.
+ *
+ * Waking a single writer per batch is meant for queues with one producer.  If
+ * several tasks are blocked sending to the same queue the ones that were not
+ * unblocked stay blocked, even with space available, until their block time
+ * expires or the next receive.
+ *
+ * Cannot be used on semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer with room for uxCount items.
+ *
+ * @param uxCount The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty.
+ *
+ * @return The number of items copied into the buffer, from 0 (the block time
+ * expired with the queue empty) to uxCount.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveMultipleFromISR(
+										  QueueHandle_t xQueue,
+										  void *pvBuffer,
+										  UBaseType_t uxCount,
+										  BaseType_t *pxHigherPriorityTaskWoken
+										);
+ * </pre>
+ *
+ * Version of xQueueReceiveMultiple() that can be used from an interrupt
+ * service routine.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if receiving the batch
+ * unblocked a task with a priority higher than the running task.
+ *
+ * @return The number of items copied into the buffer, from 0 to uxCount.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
@@ -4,12 +4,18 @@ ifeq ($(USE_FREERTOS),y)
     FREERTOS_HEAP_TYPE ?= 4
     
     DEFINES+=USE_FREERTOS
+    DEFINES+=FREERTOS_HEAP_TYPE=$(FREERTOS_HEAP_TYPE)
     INCLUDES += -I$(FREERTOS_BASE)/include
+    INCLUDES += -I$(FREERTOS_BASE)/extras/inc
 
     SRC+=$(wildcard $(FREERTOS_BASE)/source/*.c)
+    SRC+=$(wildcard $(FREERTOS_BASE)/extras/src/*.c)
     SRC+=$(FREERTOS_BASE)/portable/MemMang/heap_$(FREERTOS_HEAP_TYPE).c
 
-    ifeq ($(USE_FPU),y)
+    ifeq ($(PLATFORM),host)
+        INCLUDES += -I$(FREERTOS_BASE)/portable/GCC/Posix
+        SRC+=$(FREERTOS_BASE)/portable/GCC/Posix/port.c
+    else ifeq ($(USE_FPU),y)
         INCLUDES += -I$(FREERTOS_BASE)/portable/GCC/ARM_CM4F
         SRC+=$(FREERTOS_BASE)/portable/GCC/ARM_CM4F/port.c
     else
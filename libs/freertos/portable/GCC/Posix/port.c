@@ -0,0 +1,506 @@
+/*
+ * FreeRTOS Kernel V10.2.0
+ * Copyright (C) 2019 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX host port.
+ *
+ * Each task is backed by a pthread that blocks on its own event while it is
+ * not the running task, so the kernel still decides which single task runs.
+ * SIGALRM plays the role of the SysTick and SIGUSR1 the role of the NVIC for
+ * simulated peripheral interrupts.  Both are process directed, and every
+ * thread except the running task keeps them masked, so they are always
+ * serviced on the thread of the running task, exactly like an exception
+ * stacked on top of the running task on the Cortex-M4.
+ *----------------------------------------------------------*/
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define portSIGNAL_TICK			SIGALRM
+#define portSIGNAL_INTERRUPT	SIGUSR1
+
+/*-----------------------------------------------------------*/
+
+/* Binary semaphore used to park and release the thread of a task. */
+typedef struct xEVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCondition;
+	BaseType_t xSignaled;
+} Event_t;
+
+/* Descriptor of the pthread that runs a task.  It is stored at the top of the
+stack allocated by the kernel for the task, so it has the same lifetime as the
+TCB. */
+typedef struct xTHREAD
+{
+	pthread_t xThread;
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	Event_t xWakeUp;
+} Thread_t;
+
+/*-----------------------------------------------------------*/
+
+/* The first member of the TCB is the top of stack, which points just below
+the thread descriptor. */
+extern void * volatile pxCurrentTCB;
+
+/* Critical nesting and interrupt context are tracked per thread, so they are
+preserved automatically across context switches. */
+static __thread UBaseType_t uxCriticalNesting = 0;
+static __thread UBaseType_t uxInterruptNesting = 0;
+
+/* A context switch was requested from interrupt context, it is performed when
+the outermost interrupt handler finishes (the PendSV equivalent). */
+static volatile BaseType_t xSwitchPending = pdFALSE;
+
+static volatile BaseType_t xSchedulerRunning = pdFALSE;
+static Event_t xSchedulerEnd = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, pdFALSE };
+static pthread_once_t xSignalsInstalled = PTHREAD_ONCE_INIT;
+
+/* Simulated interrupt controller. */
+static void ( * volatile pxInterruptHandlers[ portMAX_INTERRUPTS ] )( void );
+static volatile uint64_t ullPendingInterrupts = 0;
+
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( Event_t *pxEvent );
+static void prvEventSignal( Event_t *pxEvent );
+static void prvEventWait( Event_t *pxEvent );
+static void prvInstallSignals( void );
+static void prvMaskPortSignals( sigset_t *pxPrevious );
+static void *prvThreadEntry( void *pvParameters );
+static Thread_t *prvGetThreadFromTask( void *pxTCB );
+static void prvSwitchContext( void );
+static void prvServiceInterrupts( void );
+static void prvTickHandler( int iSignal );
+static void prvInterruptHandler( int iSignal );
+static void prvSetTimer( uint32_t ulPeriodUs );
+
+/*-----------------------------------------------------------*/
+
+static void prvEventUnlock( void *pvMutex )
+{
+	pthread_mutex_unlock( ( pthread_mutex_t * ) pvMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( Event_t *pxEvent )
+{
+	pthread_mutex_init( &pxEvent->xMutex, NULL );
+	pthread_cond_init( &pxEvent->xCondition, NULL );
+	pxEvent->xSignaled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( Event_t *pxEvent )
+{
+	pthread_mutex_lock( &pxEvent->xMutex );
+	pxEvent->xSignaled = pdTRUE;
+	pthread_cond_signal( &pxEvent->xCondition );
+	pthread_mutex_unlock( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( Event_t *pxEvent )
+{
+	pthread_mutex_lock( &pxEvent->xMutex );
+
+	/* A parked thread is only ever cancelled while waiting here, when its task
+	is deleted. */
+	pthread_cleanup_push( prvEventUnlock, &pxEvent->xMutex );
+	while( pxEvent->xSignaled == pdFALSE )
+	{
+		pthread_cond_wait( &pxEvent->xCondition, &pxEvent->xMutex );
+	}
+	pxEvent->xSignaled = pdFALSE;
+	pthread_cleanup_pop( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMaskPortSignals( sigset_t *pxPrevious )
+{
+sigset_t xSignals;
+
+	/* Only the signals used by the port are masked, so the process can still
+	be terminated with SIGINT or SIGTERM. */
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portSIGNAL_TICK );
+	sigaddset( &xSignals, portSIGNAL_INTERRUPT );
+	pthread_sigmask( SIG_BLOCK, &xSignals, pxPrevious );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInstallSignals( void )
+{
+struct sigaction xAction;
+
+	memset( &xAction, 0, sizeof( xAction ) );
+
+	/* Handlers never nest, as with a single exception priority level. */
+	sigfillset( &xAction.sa_mask );
+	xAction.sa_flags = SA_RESTART;
+
+	xAction.sa_handler = prvTickHandler;
+	sigaction( portSIGNAL_TICK, &xAction, NULL );
+
+	xAction.sa_handler = prvInterruptHandler;
+	sigaction( portSIGNAL_INTERRUPT, &xAction, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThreadFromTask( void *pxTCB )
+{
+StackType_t *pxTopOfStack = *( StackType_t ** ) pxTCB;
+
+	return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadEntry( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	/* Wait until the scheduler selects this task for the first time. */
+	prvEventWait( &pxThread->xWakeUp );
+
+	uxCriticalNesting = 0;
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* Tasks must not return, but if one does it is removed cleanly. */
+	vTaskDelete( NULL );
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+Thread_t *pxPrevious, *pxNext;
+
+	pxPrevious = prvGetThreadFromTask( pxCurrentTCB );
+	vTaskSwitchContext();
+	pxNext = prvGetThreadFromTask( pxCurrentTCB );
+
+	if( pxNext != pxPrevious )
+	{
+		prvEventSignal( &pxNext->xWakeUp );
+		prvEventWait( &pxPrevious->xWakeUp );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvServiceInterrupts( void )
+{
+uint64_t ullServiced;
+uint32_t ulInterrupt;
+void ( *pvHandler )( void );
+
+	/* Only the interrupts that have a handler are serviced, the others remain
+	pending until they are enabled. */
+	do
+	{
+		ullServiced = 0;
+		for( ulInterrupt = 0; ulInterrupt < portMAX_INTERRUPTS; ulInterrupt++ )
+		{
+			if( ( ullPendingInterrupts & ( 1ULL << ulInterrupt ) ) != 0ULL )
+			{
+				pvHandler = pxInterruptHandlers[ ulInterrupt ];
+				if( pvHandler != NULL )
+				{
+					__atomic_fetch_and( &ullPendingInterrupts, ~( 1ULL << ulInterrupt ), __ATOMIC_SEQ_CST );
+					pvHandler();
+					ullServiced |= 1ULL << ulInterrupt;
+				}
+			}
+		}
+	} while( ullServiced != 0ULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEnterInterrupt( void )
+{
+	uxCriticalNesting++;
+	uxInterruptNesting++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvExitInterrupt( void )
+{
+	prvServiceInterrupts();
+
+	uxInterruptNesting--;
+	if( ( uxInterruptNesting == 0 ) && ( xSwitchPending != pdFALSE ) && ( xSchedulerRunning != pdFALSE ) )
+	{
+		xSwitchPending = pdFALSE;
+		prvSwitchContext();
+	}
+	uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickHandler( int iSignal )
+{
+	( void ) iSignal;
+
+	prvEnterInterrupt();
+	if( xSchedulerRunning != pdFALSE )
+	{
+		if( xTaskIncrementTick() != pdFALSE )
+		{
+			xSwitchPending = pdTRUE;
+		}
+	}
+	prvExitInterrupt();
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptHandler( int iSignal )
+{
+	( void ) iSignal;
+
+	prvEnterInterrupt();
+	prvExitInterrupt();
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetTimer( uint32_t ulPeriodUs )
+{
+struct itimerval xTimer;
+
+	xTimer.it_interval.tv_sec = ulPeriodUs / 1000000UL;
+	xTimer.it_interval.tv_usec = ulPeriodUs % 1000000UL;
+	xTimer.it_value = xTimer.it_interval;
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+pthread_attr_t xAttributes;
+sigset_t xPrevious;
+int iResult;
+
+	pthread_once( &xSignalsInstalled, prvInstallSignals );
+
+	pxThread = ( Thread_t * ) ( pxTopOfStack + 1 ) - 1;
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	prvEventInit( &pxThread->xWakeUp );
+
+	/* The new thread inherits the port signals masked, so it can never take
+	the tick before it runs as a task. */
+	prvMaskPortSignals( &xPrevious );
+	pthread_attr_init( &xAttributes );
+	pthread_attr_setstacksize( &xAttributes, configHOST_THREAD_STACK_SIZE );
+	iResult = pthread_create( &pxThread->xThread, &xAttributes, prvThreadEntry, pxThread );
+	pthread_attr_destroy( &xAttributes );
+	pthread_sigmask( SIG_SETMASK, &xPrevious, NULL );
+
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+
+	return ( StackType_t * ) pxThread - 1;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+	pthread_once( &xSignalsInstalled, prvInstallSignals );
+
+	/* From now on the thread that called main() only waits for the end of the
+	scheduler, it must never service the tick or an interrupt. */
+	prvMaskPortSignals( NULL );
+
+	xSchedulerRunning = pdTRUE;
+	prvSetTimer( configHOST_TICK_PERIOD_US );
+	prvEventSignal( &prvGetThreadFromTask( pxCurrentTCB )->xWakeUp );
+
+	prvEventWait( &xSchedulerEnd );
+	prvSetTimer( 0 );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	xSchedulerRunning = pdFALSE;
+	prvSetTimer( 0 );
+	prvEventSignal( &xSchedulerEnd );
+
+	/* The calling task never runs again, main() resumes instead. */
+	if( uxInterruptNesting == 0 )
+	{
+		prvEventWait( &prvGetThreadFromTask( pxCurrentTCB )->xWakeUp );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTCB( void *pxTCB )
+{
+Thread_t *pxThread = prvGetThreadFromTask( pxTCB );
+
+	/* The thread of a deleted task is parked on its event, which is a
+	cancellation point. */
+	pthread_cancel( pxThread->xThread );
+	pthread_join( pxThread->xThread, NULL );
+	pthread_cond_destroy( &pxThread->xWakeUp.xCondition );
+	pthread_mutex_destroy( &pxThread->xWakeUp.xMutex );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	if( uxInterruptNesting != 0 )
+	{
+		xSwitchPending = pdTRUE;
+	}
+	else
+	{
+		vPortEnterCritical();
+		prvSwitchContext();
+		vPortExitCritical();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+	/* Called from a task it behaves as a normal yield, as the PendSV would. */
+	vPortYield();
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	prvMaskPortSignals( NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+sigset_t xSignals;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portSIGNAL_TICK );
+	sigaddset( &xSignals, portSIGNAL_INTERRUPT );
+	pthread_sigmask( SIG_UNBLOCK, &xSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	if( uxCriticalNesting == 0 )
+	{
+		vPortDisableInterrupts();
+	}
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+
+	/* Pending signals are delivered as soon as they are unmasked. */
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+	/* Inside a handler the signals are already masked, so this is only a
+	counter increment in the usual case. */
+	vPortEnterCritical();
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+	( void ) uxMask;
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortIsInsideInterrupt( void )
+{
+	return ( uxInterruptNesting != 0 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber, void ( *pvHandler )( void ) )
+{
+	configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+	pthread_once( &xSignalsInstalled, prvInstallSignals );
+	pxInterruptHandlers[ ulInterruptNumber ] = pvHandler;
+
+	/* An interrupt raised while it was disabled is taken once enabled. */
+	if( ( pvHandler != NULL ) && ( ( ullPendingInterrupts & ( 1ULL << ulInterruptNumber ) ) != 0ULL ) )
+	{
+		vPortGenerateSimulatedInterrupt( ulInterruptNumber );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+	configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+	pthread_once( &xSignalsInstalled, prvInstallSignals );
+	__atomic_fetch_or( &ullPendingInterrupts, 1ULL << ulInterruptNumber, __ATOMIC_SEQ_CST );
+
+	/* From interrupt context the pending flag is enough, it is serviced before
+	the current handler returns.  Otherwise the signal reaches whichever thread
+	runs the current task, as soon as it leaves any critical section. */
+	if( uxInterruptNesting == 0 )
+	{
+		kill( getpid(), portSIGNAL_INTERRUPT );
+	}
+}
+/*-----------------------------------------------------------*/
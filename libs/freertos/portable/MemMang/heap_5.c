@@ -107,6 +107,12 @@ typedef struct A_BLOCK_LINK
  */
 static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert );
 
+/*
+ * Allocates a block that lies entirely between xLowest and xHighest.  Free
+ * blocks outside that range are skipped by the first fit search.
+ */
+static void *prvMallocInRange( size_t xWantedSize, size_t xLowest, size_t xHighest );
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -129,7 +135,54 @@ static size_t xBlockAllocatedBit = 0;
 
 /*-----------------------------------------------------------*/
 
+/* When configUSE_LINKER_HEAP_REGIONS is 1 the heap does not need to be defined
+by the application.  The first allocation calls HeapRegionsInit(), which passes
+the free space the linker left in each RAM bank to vPortDefineHeapRegions(). */
+#ifndef configUSE_LINKER_HEAP_REGIONS
+	#define configUSE_LINKER_HEAP_REGIONS 1
+#endif
+
+#if( configUSE_LINKER_HEAP_REGIONS == 1 )
+	extern void HeapRegionsInit( void );
+#endif
+
+/*-----------------------------------------------------------*/
+
 void *pvPortMalloc( size_t xWantedSize )
+{
+	return pvPortMallocInRange( xWantedSize, NULL, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMallocInRange( size_t xWantedSize, const void *pvLowest, const void *pvHighest )
+{
+size_t xHighest = ( size_t ) pvHighest;
+
+	#if( configUSE_LINKER_HEAP_REGIONS == 1 )
+	{
+		if( pxEnd == NULL )
+		{
+			HeapRegionsInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	/* A NULL upper limit means the range extends to the end of the address
+	space. */
+	if( xHighest == ( size_t ) 0 )
+	{
+		xHighest = ~( ( size_t ) 0 );
+	}
+
+	return prvMallocInRange( xWantedSize, ( size_t ) pvLowest, xHighest );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvMallocInRange( size_t xWantedSize, size_t xLowest, size_t xHighest )
 {
 BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 void *pvReturn = NULL;
@@ -172,10 +225,13 @@ void *pvReturn = NULL;
 			if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
 			{
 				/* Traverse the list from the start	(lowest address) block until
-				one	of adequate size is found. */
+				one	of adequate size is found inside the requested range. */
 				pxPreviousBlock = &xStart;
 				pxBlock = xStart.pxNextFreeBlock;
-				while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+				while( ( ( pxBlock->xBlockSize < xWantedSize ) ||
+						 ( ( size_t ) pxBlock < xLowest ) ||
+						 ( ( ( size_t ) pxBlock + xWantedSize ) > xHighest ) ) &&
+					   ( pxBlock->pxNextFreeBlock != NULL ) )
 				{
 					pxPreviousBlock = pxBlock;
 					pxBlock = pxBlock->pxNextFreeBlock;
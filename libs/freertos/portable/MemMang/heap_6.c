@@ -0,0 +1,659 @@
+/*
+ * FreeRTOS Kernel V10.2.0
+ * Copyright (C) 2019 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * An implementation of pvPortMalloc() and vPortFree() with a Two-Level
+ * Segregated Fit (TLSF) allocator.  Like heap_4.c it uses a single statically
+ * allocated array as the heap and combines (coalescences) adjacent memory
+ * blocks as they are freed, but the free blocks are kept in lists segregated
+ * by size instead of one list in address order, so both pvPortMalloc() and
+ * vPortFree() take a bounded time that does not depend on the number of free
+ * blocks or on how fragmented the heap is.
+ *
+ * The first level divides the block sizes in powers of two and the second
+ * level divides each power of two in 2^heapSL_INDEX_COUNT_LOG2 ranges of the
+ * same width.  One bit per list records which lists are not empty, so the
+ * smallest list that can satisfy a request is found with two count leading or
+ * trailing zeros operations.  Requests are rounded up to the start of the next
+ * range, which guarantees that any block in the list found is big enough.
+ *
+ * Every block starts with a header that holds its size and a pointer to the
+ * block immediately before it in memory, so a block being freed finds both
+ * of its neighbours without searching.
+ *
+ * vPortGetHeapStats() reports the free space, the largest and smallest free
+ * blocks, the fragmentation and the number of allocations and frees.
+ *
+ * configHEAP_TLSF_FL_INDEX_MAX sets the log2 of the first size that the heap
+ * cannot hold, and so the number of first level lists.  The default of 24
+ * allows heaps of up to 16MB.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_TLSF_FL_INDEX_MAX
+	#define configHEAP_TLSF_FL_INDEX_MAX	24
+#endif
+
+/* The lowest bit of the block size is used as a flag, so the alignment must
+leave at least one bit free. */
+#if portBYTE_ALIGNMENT == 32
+	#define heapALIGN_SIZE_LOG2	5
+#elif portBYTE_ALIGNMENT == 16
+	#define heapALIGN_SIZE_LOG2	4
+#elif portBYTE_ALIGNMENT == 8
+	#define heapALIGN_SIZE_LOG2	3
+#elif portBYTE_ALIGNMENT == 4
+	#define heapALIGN_SIZE_LOG2	2
+#else
+	#error heap_6.c requires portBYTE_ALIGNMENT to be at least 4
+#endif
+
+/* Each power of two is divided in 16 lists. */
+#define heapSL_INDEX_COUNT_LOG2	4
+#define heapSL_INDEX_COUNT		( 1U << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE go to the first list of the first
+level, which is divided in ranges of one alignment unit. */
+#define heapFL_INDEX_SHIFT		( heapSL_INDEX_COUNT_LOG2 + heapALIGN_SIZE_LOG2 )
+#define heapFL_INDEX_COUNT		( configHEAP_TLSF_FL_INDEX_MAX - heapFL_INDEX_SHIFT + 1 )
+#define heapSMALL_BLOCK_SIZE	( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* Blocks must be smaller than this size. */
+#define heapMAXIMUM_BLOCK_SIZE	( ( size_t ) 1 << configHEAP_TLSF_FL_INDEX_MAX )
+
+#if ( heapFL_INDEX_COUNT < 2 ) || ( heapFL_INDEX_COUNT > 32 )
+	#error configHEAP_TLSF_FL_INDEX_MAX is out of range
+#endif
+
+/* Set in the size of the blocks owned by the application, and in the zero
+sized block that marks the end of the heap. */
+#define heapBLOCK_ALLOCATED_BIT	( ( size_t ) 1 )
+
+/* Block sizes must not get too small, a free block has to hold the two free
+list pointers. */
+#define heapMINIMUM_BLOCK_SIZE	( ( ( sizeof( BlockHeader_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) )
+
+#define heapBLOCK_SIZE( pxBlock )	( ( pxBlock )->xBlockSize & ~heapBLOCK_ALLOCATED_BIT )
+#define heapNEXT_PHYS_BLOCK( pxBlock )	( ( BlockHeader_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) ) )
+
+/* Position of the highest and lowest bits set in a non zero 32 bit value. */
+#define heapFLS( ulValue )		( ( uint32_t ) ( 31 - __builtin_clz( ulValue ) ) )
+#define heapFFS( ulValue )		( ( uint32_t ) __builtin_ctz( ulValue ) )
+
+/* Allocate the memory for the heap. */
+#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+	/* The application writer has already defined the array used for the RTOS
+	heap - probably so it can be placed in a special segment or address. */
+	extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+	__attribute__ ((section(".data.$RAM2")))
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* The header at the start of every block.  Only the first two members are
+kept while the block is allocated, the free list pointers share the memory
+given to the application. */
+typedef struct A_BLOCK_HEADER
+{
+	struct A_BLOCK_HEADER *pxPrevPhysBlock;	/*<< The block immediately before this one in memory, NULL for the first block. */
+	size_t xBlockSize;						/*<< The size of the block, including the header, and the allocated flag. */
+	struct A_BLOCK_HEADER *pxNextFreeBlock;	/*<< The next block in the same free list. */
+	struct A_BLOCK_HEADER *pxPrevFreeBlock;	/*<< The previous block in the same free list. */
+} BlockHeader_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void );
+
+/*
+ * Find the lists a free block of xSize bytes is stored in.
+ */
+static void prvMappingInsert( size_t xSize, uint32_t *pulFirst, uint32_t *pulSecond );
+
+/*
+ * Find the first list whose blocks are all at least xSize bytes.
+ */
+static void prvMappingSearch( size_t xSize, uint32_t *pulFirst, uint32_t *pulSecond );
+
+/*
+ * Return the first block of the smallest non empty list starting at the one
+ * pointed by the parameters, which are updated, or NULL if there is none.
+ */
+static BlockHeader_t *prvFindSuitableBlock( uint32_t *pulFirst, uint32_t *pulSecond );
+
+/*
+ * Add and remove a block from the free list that corresponds to its size.
+ */
+static void prvInsertFreeBlock( BlockHeader_t *pxBlock );
+static void prvRemoveFreeBlock( BlockHeader_t *pxBlock );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the header kept in allocated blocks must by
+correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( BlockHeader_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Zero sized block that marks the end of the heap, it is never free so the
+last real block is never merged with it. */
+static BlockHeader_t *pxEnd = NULL;
+
+/* One bit for each first level with any non empty list, and for each first
+level one bit for each non empty second level list. */
+static uint32_t ulFirstLevelMap = 0U;
+static uint32_t ulSecondLevelMap[ heapFL_INDEX_COUNT ];
+static BlockHeader_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+fragmentation. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+static size_t xNumberOfSuccessfulAllocations = 0U;
+static size_t xNumberOfSuccessfulFrees = 0U;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockHeader_t *pxBlock, *pxNewBlock;
+uint32_t ulFirst, ulSecond;
+void *pvReturn = NULL;
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the free lists. */
+		if( pxEnd == NULL )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Check the requested block size is not so large that the size with
+		the header can not be held in a block. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize < ( heapMAXIMUM_BLOCK_SIZE - heapSMALL_BLOCK_SIZE ) ) )
+		{
+			/* The wanted size is increased so it can contain the header in
+			addition to the requested amount of bytes, and is rounded so the
+			next block is also aligned. */
+			xWantedSize += xHeapStructSize;
+			if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+				configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+			{
+				xWantedSize = heapMINIMUM_BLOCK_SIZE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xWantedSize <= xFreeBytesRemaining )
+			{
+				prvMappingSearch( xWantedSize, &ulFirst, &ulSecond );
+				pxBlock = prvFindSuitableBlock( &ulFirst, &ulSecond );
+
+				if( pxBlock != NULL )
+				{
+					configASSERT( heapBLOCK_SIZE( pxBlock ) >= xWantedSize );
+					prvRemoveFreeBlock( pxBlock );
+
+					/* If the block is larger than required it can be split
+					into two.  The next block in memory is allocated, otherwise
+					it would have been merged with this one, so the remainder
+					does not need to be combined with it. */
+					if( ( pxBlock->xBlockSize - xWantedSize ) >= heapMINIMUM_BLOCK_SIZE )
+					{
+						pxNewBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+						configASSERT( ( ( ( size_t ) pxNewBlock ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+						pxNewBlock->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+						pxNewBlock->pxPrevPhysBlock = pxBlock;
+						heapNEXT_PHYS_BLOCK( pxNewBlock )->pxPrevPhysBlock = pxNewBlock;
+						pxBlock->xBlockSize = xWantedSize;
+
+						prvInsertFreeBlock( pxNewBlock );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+					if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+					{
+						xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The block is being returned - it is allocated and owned
+					by the application. */
+					pxBlock->xBlockSize |= heapBLOCK_ALLOCATED_BIT;
+					xNumberOfSuccessfulAllocations++;
+
+					/* Return the memory space pointed to - jumping over the
+					header at its start. */
+					pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockHeader_t *pxBlock, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a header immediately before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxBlock = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxBlock->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 );
+
+		if( ( pxBlock->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				/* The block is being returned to the heap - it is no longer
+				allocated. */
+				pxBlock->xBlockSize &= ~heapBLOCK_ALLOCATED_BIT;
+				xFreeBytesRemaining += pxBlock->xBlockSize;
+				xNumberOfSuccessfulFrees++;
+				traceFREE( pv, pxBlock->xBlockSize );
+
+				/* Form one big block with the block before it in memory if
+				that one is free. */
+				pxNeighbour = pxBlock->pxPrevPhysBlock;
+				if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize += pxBlock->xBlockSize;
+					pxBlock = pxNeighbour;
+					heapNEXT_PHYS_BLOCK( pxBlock )->pxPrevPhysBlock = pxBlock;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* And with the block after it.  The end marker is always
+				allocated, so it is never merged. */
+				pxNeighbour = heapNEXT_PHYS_BLOCK( pxBlock );
+				if( ( pxNeighbour->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxBlock->xBlockSize += pxNeighbour->xBlockSize;
+					heapNEXT_PHYS_BLOCK( pxBlock )->pxPrevPhysBlock = pxBlock;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvInsertFreeBlock( pxBlock );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+BlockHeader_t *pxBlock;
+size_t xBlocks = 0, xMaxSize = 0, xMinSize = ~( ( size_t ) 0 );
+uint32_t ulFirst, ulSecond;
+
+	vTaskSuspendAll();
+	{
+		/* Walk every non empty list, this is the only part of the file that
+		depends on the number of free blocks. */
+		for( ulFirst = 0U; ulFirst < ( uint32_t ) heapFL_INDEX_COUNT; ulFirst++ )
+		{
+			for( ulSecond = 0U; ulSecond < heapSL_INDEX_COUNT; ulSecond++ )
+			{
+				for( pxBlock = pxFreeLists[ ulFirst ][ ulSecond ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+				{
+					xBlocks++;
+
+					if( pxBlock->xBlockSize > xMaxSize )
+					{
+						xMaxSize = pxBlock->xBlockSize;
+					}
+
+					if( pxBlock->xBlockSize < xMinSize )
+					{
+						xMinSize = pxBlock->xBlockSize;
+					}
+				}
+			}
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+	}
+	( void ) xTaskResumeAll();
+
+	pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+	pxHeapStats->xSizeOfSmallestFreeBlockInBytes = ( xBlocks > 0 ) ? xMinSize : 0;
+	pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+	/* The part of the free space that can not be given in a single block. */
+	if( pxHeapStats->xAvailableHeapSpaceInBytes > 0 )
+	{
+		pxHeapStats->xFragmentationPerMille = 1000U - ( size_t ) ( ( ( uint64_t ) xMaxSize * 1000U ) / pxHeapStats->xAvailableHeapSpaceInBytes );
+	}
+	else
+	{
+		pxHeapStats->xFragmentationPerMille = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+BlockHeader_t *pxFirstFreeBlock;
+uint8_t *pucAlignedHeap;
+size_t uxAddress;
+size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+
+	/* Ensure the heap starts on a correctly aligned boundary. */
+	uxAddress = ( size_t ) ucHeap;
+
+	if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		uxAddress += ( portBYTE_ALIGNMENT - 1 );
+		uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xTotalHeapSize -= uxAddress - ( size_t ) ucHeap;
+	}
+
+	pucAlignedHeap = ( uint8_t * ) uxAddress;
+
+	/* pxEnd is used to mark the end of the heap.  Only the members kept in
+	allocated blocks are used, so it takes the size of that part. */
+	uxAddress = ( ( size_t ) pucAlignedHeap ) + xTotalHeapSize;
+	uxAddress -= xHeapStructSize;
+	uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	pxEnd = ( void * ) uxAddress;
+
+	/* To start with there is a single free block that is sized to take up the
+	entire heap space, minus the space taken by pxEnd. */
+	pxFirstFreeBlock = ( void * ) pucAlignedHeap;
+	pxFirstFreeBlock->xBlockSize = uxAddress - ( size_t ) pxFirstFreeBlock;
+	pxFirstFreeBlock->pxPrevPhysBlock = NULL;
+	configASSERT( pxFirstFreeBlock->xBlockSize < heapMAXIMUM_BLOCK_SIZE );
+
+	pxEnd->xBlockSize = heapBLOCK_ALLOCATED_BIT;
+	pxEnd->pxPrevPhysBlock = pxFirstFreeBlock;
+
+	prvInsertFreeBlock( pxFirstFreeBlock );
+
+	/* Only one block exists - and it covers the entire usable heap space. */
+	xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+	xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xSize, uint32_t *pulFirst, uint32_t *pulSecond )
+{
+uint32_t ulBit;
+
+	if( xSize < heapSMALL_BLOCK_SIZE )
+	{
+		*pulFirst = 0U;
+		*pulSecond = ( uint32_t ) ( xSize >> heapALIGN_SIZE_LOG2 );
+	}
+	else
+	{
+		ulBit = heapFLS( ( uint32_t ) xSize );
+		*pulFirst = ulBit - ( heapFL_INDEX_SHIFT - 1U );
+		*pulSecond = ( uint32_t ) ( xSize >> ( ulBit - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingSearch( size_t xSize, uint32_t *pulFirst, uint32_t *pulSecond )
+{
+	/* Round up to the start of the next range, every block in that list is
+	then at least as big as the request. */
+	if( xSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xSize += ( ( size_t ) 1 << ( heapFLS( ( uint32_t ) xSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMappingInsert( xSize, pulFirst, pulSecond );
+}
+/*-----------------------------------------------------------*/
+
+static BlockHeader_t *prvFindSuitableBlock( uint32_t *pulFirst, uint32_t *pulSecond )
+{
+uint32_t ulMap;
+
+	if( *pulFirst >= ( uint32_t ) heapFL_INDEX_COUNT )
+	{
+		return NULL;
+	}
+
+	/* First look for a list in the same power of two... */
+	ulMap = ulSecondLevelMap[ *pulFirst ] & ( ~0UL << *pulSecond );
+	if( ulMap == 0U )
+	{
+		/* ...and if there is none take the smallest list of the first bigger
+		power of two that has any free block. */
+		if( ( *pulFirst + 1U ) >= ( uint32_t ) heapFL_INDEX_COUNT )
+		{
+			return NULL;
+		}
+
+		ulMap = ulFirstLevelMap & ( ~0UL << ( *pulFirst + 1U ) );
+		if( ulMap == 0U )
+		{
+			return NULL;
+		}
+
+		*pulFirst = heapFFS( ulMap );
+		ulMap = ulSecondLevelMap[ *pulFirst ];
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	*pulSecond = heapFFS( ulMap );
+	return pxFreeLists[ *pulFirst ][ *pulSecond ];
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockHeader_t *pxBlock )
+{
+uint32_t ulFirst, ulSecond;
+BlockHeader_t *pxHead;
+
+	prvMappingInsert( pxBlock->xBlockSize, &ulFirst, &ulSecond );
+
+	pxHead = pxFreeLists[ ulFirst ][ ulSecond ];
+	pxBlock->pxNextFreeBlock = pxHead;
+	pxBlock->pxPrevFreeBlock = NULL;
+	if( pxHead != NULL )
+	{
+		pxHead->pxPrevFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	pxFreeLists[ ulFirst ][ ulSecond ] = pxBlock;
+
+	ulFirstLevelMap |= ( 1UL << ulFirst );
+	ulSecondLevelMap[ ulFirst ] |= ( 1UL << ulSecond );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockHeader_t *pxBlock )
+{
+uint32_t ulFirst, ulSecond;
+
+	prvMappingInsert( pxBlock->xBlockSize, &ulFirst, &ulSecond );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPrevFreeBlock != NULL )
+	{
+		pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was the head of its list, which may now be empty. */
+		pxFreeLists[ ulFirst ][ ulSecond ] = pxBlock->pxNextFreeBlock;
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			ulSecondLevelMap[ ulFirst ] &= ~( 1UL << ulSecond );
+			if( ulSecondLevelMap[ ulFirst ] == 0U )
+			{
+				ulFirstLevelMap &= ~( 1UL << ulFirst );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
@@ -198,6 +198,14 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies uxCount items to the back of the queue, and out of the front of the
+ * queue, using at most two memcpy() calls each as the storage area wraps.  The
+ * caller has already checked there is enough space or data.
+ */
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -1869,6 +1877,425 @@ Queue_t * const pxQueue = xQueue;
 }
 /*-----------------------------------------------------------*/
 
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+UBaseType_t uxSpace;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvItems );
+
+	/* Semaphores and mutexes have no data to copy, and the queue set
+	container is notified once per item so batches are not supported on
+	queues that are members of a set. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		configASSERT( pxQueue->pxQueueSetContainer == NULL );
+	}
+	#endif
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( uxCount == ( UBaseType_t ) 0 )
+	{
+		return 0;
+	}
+
+	/*lint -save -e904 This function relaxes the coding standard somewhat to
+	allow return statements within the function itself.  This is done in the
+	interest of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxSpace = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+			/* Is there room for at least one item?  As many items as fit are
+			copied, the caller sends the rest with another call. */
+			if( uxSpace > ( UBaseType_t ) 0 )
+			{
+				if( uxSpace > uxCount )
+				{
+					uxSpace = uxCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceQUEUE_SEND( pxQueue );
+				prvCopyMultipleToQueue( pxQueue, ( const int8_t * ) pvItems, uxSpace );
+
+				/* Only one task is unblocked for the whole batch, which is
+				normally the single consumer of the queue.  Any other reader
+				left blocked will be unblocked by the next send. */
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return ( BaseType_t ) uxSpace;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					taskEXIT_CRITICAL();
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return 0;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* The queue is full, block exactly as xQueueGenericSend() does. */
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+			else
+			{
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			traceQUEUE_SEND_FAILED( pxQueue );
+			return 0;
+		}
+	} /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxSpace;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvItems );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		configASSERT( pxQueue->pxQueueSetContainer == NULL );
+	}
+	#endif
+
+	/* See the comments in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxSpace = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+		if( uxSpace > uxCount )
+		{
+			uxSpace = uxCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( uxSpace > ( UBaseType_t ) 0 )
+		{
+			const int8_t cTxLock = pxQueue->cTxLock;
+
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+			prvCopyMultipleToQueue( pxQueue, ( const int8_t * ) pvItems, uxSpace );
+
+			/* The event list is not altered if the queue is locked.  A single
+			increment of the lock count makes the task that unlocks the queue
+			unblock one reader, as is done here when it is not locked. */
+			if( cTxLock == queueUNLOCKED )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+			}
+		}
+		else
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return ( BaseType_t ) uxSpace;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxCount, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+UBaseType_t uxAvailable;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( uxCount == ( UBaseType_t ) 0 )
+	{
+		return 0;
+	}
+
+	/*lint -save -e904 This function relaxes the coding standard somewhat to
+	allow return statements within the function itself.  This is done in the
+	interest of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxAvailable = pxQueue->uxMessagesWaiting;
+
+			/* Is there at least one item?  Everything available, up to
+			uxCount, is copied out. */
+			if( uxAvailable > ( UBaseType_t ) 0 )
+			{
+				if( uxAvailable > uxCount )
+				{
+					uxAvailable = uxCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvCopyMultipleFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxAvailable );
+				traceQUEUE_RECEIVE( pxQueue );
+
+				/* Unblock a single writer for the whole batch. */
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return ( BaseType_t ) uxAvailable;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					taskEXIT_CRITICAL();
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return 0;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* The queue is empty, block exactly as xQueueReceive() does. */
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	} /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxAvailable;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+	/* See the comments in xQueueReceiveFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxAvailable = pxQueue->uxMessagesWaiting;
+		if( uxAvailable > uxCount )
+		{
+			uxAvailable = uxCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( uxAvailable > ( UBaseType_t ) 0 )
+		{
+			const int8_t cRxLock = pxQueue->cRxLock;
+
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+			prvCopyMultipleFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxAvailable );
+
+			if( cRxLock == queueUNLOCKED )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxQueue->cRxLock = ( int8_t ) ( cRxLock + 1 );
+			}
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return ( BaseType_t ) uxAvailable;
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
 {
 BaseType_t xReturn;
@@ -2164,6 +2591,104 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 }
 /*-----------------------------------------------------------*/
 
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxCount )
+{
+size_t xRemaining = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+size_t xChunk;
+
+	while( xRemaining > ( size_t ) 0 )
+	{
+		/* Copy up to the end of the storage area, then wrap to the start. */
+		xChunk = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo );
+		if( xChunk > xRemaining )
+		{
+			xChunk = xRemaining;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcItems, xChunk );
+		pxQueue->pcWriteTo += xChunk;
+		pcItems += xChunk;
+		xRemaining -= xChunk;
+
+		if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+		{
+			pxQueue->pcWriteTo = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	pxQueue->uxMessagesWaiting += uxCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxCount )
+{
+size_t xRemaining = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+size_t xChunk;
+int8_t *pcReadFrom;
+
+	/* pcReadFrom points to the last item read, so the first item to copy out
+	is the one that follows it. */
+	pcReadFrom = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+	if( pcReadFrom >= pxQueue->u.xQueue.pcTail )
+	{
+		pcReadFrom = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	while( xRemaining > ( size_t ) 0 )
+	{
+		xChunk = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcReadFrom );
+		if( xChunk > xRemaining )
+		{
+			xChunk = xRemaining;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		( void ) memcpy( ( void * ) pcBuffer, ( void * ) pcReadFrom, xChunk );
+		pcReadFrom += xChunk;
+		pcBuffer += xChunk;
+		xRemaining -= xChunk;
+
+		if( pcReadFrom >= pxQueue->u.xQueue.pcTail )
+		{
+			pcReadFrom = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	/* Leave pcReadFrom on the last item copied out, as prvCopyDataFromQueue()
+	would have done. */
+	if( pcReadFrom == pxQueue->pcHead )
+	{
+		pcReadFrom = pxQueue->u.xQueue.pcTail;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	pxQueue->u.xQueue.pcReadFrom = pcReadFrom - pxQueue->uxItemSize;
+
+	pxQueue->uxMessagesWaiting -= uxCount;
+}
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -193,6 +193,35 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/* Each slot of the delayed task wheel holds, in no particular order, the
+	tasks whose wake time modulo configDELAYED_TASK_WHEEL_SLOTS is the slot
+	number.  A bit per slot is set when a task is placed in the slot and only
+	cleared when the slot is found empty, so a set bit means the slot may hold
+	tasks. */
+	#define taskWHEEL_SLOT_MASK		( ( TickType_t ) configDELAYED_TASK_WHEEL_SLOTS - ( TickType_t ) 1 )
+	#define taskWHEEL_MAP_WORDS		( ( UBaseType_t ) configDELAYED_TASK_WHEEL_SLOTS / ( UBaseType_t ) 32 )
+	#define taskWHEEL_SLOT( xTime )	( ( UBaseType_t ) ( ( xTime ) & taskWHEEL_SLOT_MASK ) )
+
+	/* Index of the lowest set bit of a non zero map word. */
+	#define taskWHEEL_FIRST_SLOT( ulMap )	( ( UBaseType_t ) __builtin_ctz( ulMap ) )
+
+	/* Does pxList point to a slot of the delayed task wheel? */
+	#define taskIS_DELAYED_LIST( pxList )	( ( ( pxList ) >= &( xDelayedTaskWheel[ 0 ] ) ) && ( ( pxList ) < &( xDelayedTaskWheel[ configDELAYED_TASK_WHEEL_SLOTS ] ) ) )
+
+	/* The wheel does not need to be switched when the tick count overflows,
+	the wake times are matched exactly.  The overflow tick is checked straight
+	away because xNextTaskUnblockTime stops at portMAX_DELAY rather than
+	wrapping past it. */
+	#define taskSWITCH_DELAYED_LISTS()																\
+	{																								\
+		xNumOfOverflows++;																			\
+		xNextTaskUnblockTime = ( TickType_t ) 0U;													\
+	}
+
+#else
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
 count overflows. */
 #define taskSWITCH_DELAYED_LISTS()																	\
@@ -209,6 +238,8 @@ count overflows. */
 	prvResetNextTaskUnblockTime();																	\
 }
 
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -338,10 +369,15 @@ xDelayedTaskList1 and xDelayedTaskList2 could be move to function scople but
 doing so breaks some kernel aware debuggers and debuggers that rely on removing
 the static qualifier. */
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+	PRIVILEGED_DATA static List_t xDelayedTaskWheel[ configDELAYED_TASK_WHEEL_SLOTS ];	/*< Delayed tasks, by wake time modulo the number of slots. */
+	PRIVILEGED_DATA static uint32_t ulDelayedWheelMap[ taskWHEEL_MAP_WORDS ];			/*< A set bit marks a slot of the wheel that may hold delayed tasks. */
+#else
 PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
 PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if( INCLUDE_vTaskDelete == 1 )
@@ -531,6 +567,23 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/*
+	 * Place the calling task in the slot of the delayed task wheel for
+	 * xTimeToWake.  Constant time, whatever the number of delayed tasks.
+	 */
+	static void prvPlaceCurrentTaskInDelayedWheel( TickType_t xTimeToWake ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the first tick after xTickCount whose slot of the delayed task
+	 * wheel may hold a task, or portMAX_DELAY if the wheel is empty or that tick
+	 * is past portMAX_DELAY.
+	 */
+	static TickType_t prvGetNextDelayedWheelTick( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -1393,8 +1446,18 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			taskENTER_CRITICAL();
 			{
 				pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-				pxDelayedList = pxDelayedTaskList;
-				pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+				#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+				{
+					/* Any slot of the wheel is a Blocked list. */
+					pxDelayedList = taskIS_DELAYED_LIST( pxStateList ) ? pxStateList : NULL;
+					pxOverflowedDelayedList = pxDelayedList;
+				}
+				#else
+				{
+					pxDelayedList = pxDelayedTaskList;
+					pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+				}
+				#endif
 			}
 			taskEXIT_CRITICAL();
 
@@ -2441,15 +2504,26 @@ TCB_t *pxTCB;
 			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
 			/* Search the delayed lists. */
-			if( pxTCB == NULL )
+			#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				for( uxQueue = ( UBaseType_t ) 0U; ( uxQueue < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SLOTS ) && ( pxTCB == NULL ); uxQueue++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheel[ uxQueue ] ), pcNameToQuery );
+				}
 			}
-
-			if( pxTCB == NULL )
+			#else
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				}
+
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				}
 			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 			#if ( INCLUDE_vTaskSuspend == 1 )
 			{
@@ -2501,8 +2575,19 @@ TCB_t *pxTCB;
 
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+				{
+					for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SLOTS; uxQueue++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxQueue ] ), eBlocked );
+					}
+				}
+				#else
+				{
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				}
+				#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -2690,6 +2775,76 @@ BaseType_t xSwitchRequired = pdFALSE;
 			mtCOVERAGE_TEST_MARKER();
 		}
 
+		#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+		{
+		List_t * const pxSlot = &( xDelayedTaskWheel[ taskWHEEL_SLOT( xConstTickCount ) ] );
+		ListItem_t const * const pxEnd = listGET_END_MARKER( pxSlot );
+		ListItem_t * pxItem;
+
+			/* xNextTaskUnblockTime is the next tick whose slot may hold tasks.
+			Only the tasks of that slot whose wake time is this tick are
+			unblocked, the others wake on a later turn of the wheel. */
+			if( xConstTickCount == xNextTaskUnblockTime )
+			{
+				pxItem = listGET_HEAD_ENTRY( pxSlot );
+				while( pxItem != pxEnd )
+				{
+					pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					pxItem = listGET_NEXT( pxItem );
+					xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+					if( xItemValue != xConstTickCount )
+					{
+						continue;
+					}
+
+					/* It is time to remove the item from the Blocked state. */
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+					/* Is the task waiting on an event also?  If so remove
+					it from the event list. */
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					{
+						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* Place the unblocked task into the appropriate ready
+					list. */
+					prvAddTaskToReadyList( pxTCB );
+
+					/* A task being unblocked cannot cause an immediate
+					context switch if preemption is turned off. */
+					#if (  configUSE_PREEMPTION == 1 )
+					{
+						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_PREEMPTION */
+				}
+
+				if( listLIST_IS_EMPTY( pxSlot ) != pdFALSE )
+				{
+					ulDelayedWheelMap[ taskWHEEL_SLOT( xConstTickCount ) >> 5 ] &= ~( ( uint32_t ) 1U << ( taskWHEEL_SLOT( xConstTickCount ) & ( UBaseType_t ) 31 ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xNextTaskUnblockTime = prvGetNextDelayedWheelTick();
+			}
+		}
+		#else
 		/* See if this tick has made a timeout expire.  Tasks are stored in
 		the	queue in the order of their wake time - meaning once one task
 		has been found whose block time has not expired there is no need to
@@ -2771,6 +2926,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 				}
 			}
 		}
+		#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
@@ -2829,6 +2985,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 	}
 	#endif /* configUSE_PREEMPTION */
 
+	traceTASK_INCREMENT_TICK_EXIT( xTickCount );
 	return xSwitchRequired;
 }
 /*-----------------------------------------------------------*/
@@ -3551,8 +3708,20 @@ UBaseType_t uxPriority;
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+	{
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SLOTS; uxPriority++ )
+		{
+			vListInitialise( &( xDelayedTaskWheel[ uxPriority ] ) );
+		}
+		( void ) memset( ulDelayedWheelMap, 0x00, sizeof( ulDelayedWheelMap ) );
+	}
+	#else
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -3567,10 +3736,14 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		/* Start with pxDelayedTaskList using list1 and the
+		pxOverflowDelayedTaskList using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
@@ -3876,6 +4049,98 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+static void prvResetNextTaskUnblockTime( void )
+{
+	xNextTaskUnblockTime = prvGetNextDelayedWheelTick();
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvGetNextDelayedWheelTick( void )
+{
+const TickType_t xConstTickCount = xTickCount;
+const UBaseType_t uxCurrent = taskWHEEL_SLOT( xConstTickCount );
+UBaseType_t uxSlot, uxWord, uxWordsChecked;
+uint32_t ulMap;
+TickType_t xNext;
+
+	/* Look for the first slot that may hold tasks going round the wheel from
+	the slot after the current one.  The word holding that slot is checked
+	again at the end for the slots before it. */
+	uxSlot = ( uxCurrent + ( UBaseType_t ) 1 ) & ( UBaseType_t ) taskWHEEL_SLOT_MASK;
+	uxWord = uxSlot >> 5;
+	ulMap = ulDelayedWheelMap[ uxWord ] & ~( ( ( uint32_t ) 1U << ( uxSlot & ( UBaseType_t ) 31 ) ) - ( uint32_t ) 1U );
+
+	for( uxWordsChecked = ( UBaseType_t ) 0U; ulMap == 0U; uxWordsChecked++ )
+	{
+		if( uxWordsChecked == taskWHEEL_MAP_WORDS )
+		{
+			/* The wheel is empty. */
+			return portMAX_DELAY;
+		}
+
+		uxWord = ( uxWord + ( UBaseType_t ) 1 ) % taskWHEEL_MAP_WORDS;
+		ulMap = ulDelayedWheelMap[ uxWord ];
+	}
+
+	/* A task in the current slot wakes a full turn later at the earliest. */
+	uxSlot = ( uxWord << 5 ) + taskWHEEL_FIRST_SLOT( ulMap );
+	xNext = xConstTickCount + ( ( ( TickType_t ) ( uxSlot - uxCurrent - ( UBaseType_t ) 1 ) & taskWHEEL_SLOT_MASK ) + ( TickType_t ) 1 );
+
+	if( xNext < xConstTickCount )
+	{
+		/* Stop at portMAX_DELAY, the tick that overflows to 0 is checked by
+		taskSWITCH_DELAYED_LISTS(). */
+		xNext = portMAX_DELAY;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xNext;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPlaceCurrentTaskInDelayedWheel( TickType_t xTimeToWake )
+{
+const TickType_t xConstTickCount = xTickCount;
+const UBaseType_t uxSlot = taskWHEEL_SLOT( xTimeToWake );
+TickType_t xSlotTick;
+
+	/* The wake time is matched exactly when the slot is checked, so a task
+	must not be placed in the slot being checked now. */
+	configASSERT( xTimeToWake != xConstTickCount );
+
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+	vListInsertEnd( &( xDelayedTaskWheel[ uxSlot ] ), &( pxCurrentTCB->xStateListItem ) );
+	ulDelayedWheelMap[ uxSlot >> 5 ] |= ( uint32_t ) 1U << ( uxSlot & ( UBaseType_t ) 31 );
+
+	/* The slot is checked next within one turn of the wheel, which may be
+	before xTimeToWake if the delay is longer than a turn. */
+	xSlotTick = xConstTickCount + ( ( ( TickType_t ) ( uxSlot - taskWHEEL_SLOT( xConstTickCount ) - ( UBaseType_t ) 1 ) & taskWHEEL_SLOT_MASK ) + ( TickType_t ) 1 );
+	if( xSlotTick < xConstTickCount )
+	{
+		xSlotTick = portMAX_DELAY;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xSlotTick < xNextTaskUnblockTime )
+	{
+		xNextTaskUnblockTime = xSlotTick;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
 static void prvResetNextTaskUnblockTime( void )
 {
 TCB_t *pxTCB;
@@ -3898,6 +4163,8 @@ TCB_t *pxTCB;
 		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
 	}
 }
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
@@ -5120,33 +5387,41 @@ const TickType_t xConstTickCount = xTickCount;
 			kernel will manage it correctly. */
 			xTimeToWake = xConstTickCount + xTicksToWait;
 
-			/* The list item will be inserted in wake time order. */
-			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
-
-			if( xTimeToWake < xConstTickCount )
+			#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
 			{
-				/* Wake time has overflowed.  Place this item in the overflow
-				list. */
-				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				prvPlaceCurrentTaskInDelayedWheel( xTimeToWake );
 			}
-			else
+			#else
 			{
-				/* The wake time has not overflowed, so the current block list
-				is used. */
-				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				/* The list item will be inserted in wake time order. */
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-				/* If the task entering the blocked state was placed at the
-				head of the list of blocked tasks then xNextTaskUnblockTime
-				needs to be updated too. */
-				if( xTimeToWake < xNextTaskUnblockTime )
+				if( xTimeToWake < xConstTickCount )
 				{
-					xNextTaskUnblockTime = xTimeToWake;
+					/* Wake time has overflowed.  Place this item in the
+					overflow list. */
+					vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* The wake time has not overflowed, so the current block
+					list is used. */
+					vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+					/* If the task entering the blocked state was placed at the
+					head of the list of blocked tasks then xNextTaskUnblockTime
+					needs to be updated too. */
+					if( xTimeToWake < xNextTaskUnblockTime )
+					{
+						xNextTaskUnblockTime = xTimeToWake;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
 		}
 	}
 	#else /* INCLUDE_vTaskSuspend */
@@ -5156,31 +5431,39 @@ const TickType_t xConstTickCount = xTickCount;
 		will manage it correctly. */
 		xTimeToWake = xConstTickCount + xTicksToWait;
 
-		/* The list item will be inserted in wake time order. */
-		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
-
-		if( xTimeToWake < xConstTickCount )
+		#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
 		{
-			/* Wake time has overflowed.  Place this item in the overflow list. */
-			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			prvPlaceCurrentTaskInDelayedWheel( xTimeToWake );
 		}
-		else
+		#else
 		{
-			/* The wake time has not overflowed, so the current block list is used. */
-			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			/* The list item will be inserted in wake time order. */
+			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-			/* If the task entering the blocked state was placed at the head of the
-			list of blocked tasks then xNextTaskUnblockTime needs to be updated
-			too. */
-			if( xTimeToWake < xNextTaskUnblockTime )
+			if( xTimeToWake < xConstTickCount )
 			{
-				xNextTaskUnblockTime = xTimeToWake;
+				/* Wake time has overflowed.  Place this item in the overflow list. */
+				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* The wake time has not overflowed, so the current block list is used. */
+				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+				/* If the task entering the blocked state was placed at the head of the
+				list of blocked tasks then xNextTaskUnblockTime needs to be updated
+				too. */
+				if( xTimeToWake < xNextTaskUnblockTime )
+				{
+					xNextTaskUnblockTime = xTimeToWake;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 		}
+		#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 		/* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
 		( void ) xCanBlockIndefinitely;
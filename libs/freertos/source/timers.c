@@ -69,6 +69,21 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 #define tmrSTATUS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 0x02 )
 #define tmrSTATUS_IS_AUTORELOAD				( ( uint8_t ) 0x04 )
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+	/* Geometry of the timing wheel.  Every level has 32 slots so the occupancy
+	of a level fits in a 32-bit map, and a timer that is placed in level N has
+	between 32^N and 32^(N+1) - 1 ticks to go before it expires. */
+	#define tmrWHEEL_SLOT_BITS		( 5U )
+	#define tmrWHEEL_SLOTS			( ( UBaseType_t ) 1U << tmrWHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK		( ( uint32_t ) tmrWHEEL_SLOTS - 1U )
+	#define tmrWHEEL_MAX_DELTA		( ( ( uint32_t ) 1U << ( tmrWHEEL_SLOT_BITS * ( uint32_t ) configTIMER_WHEEL_LEVELS ) ) - 1U )
+
+	/* Index of the lowest set bit of a non zero slot map. */
+	#ifndef tmrWHEEL_FIRST_SLOT
+		#define tmrWHEEL_FIRST_SLOT( ulMap )	( ( uint32_t ) __builtin_ctz( ulMap ) )
+	#endif
+#endif /* configUSE_TIMER_WHEEL */
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl /* The old naming convention is used to prevent breaking kernel aware debuggers. */
 {
@@ -132,10 +147,22 @@ timer service task is allowed to access these lists.
 xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
 breaks some kernel aware debuggers, and debuggers that reply on removing the
 static qualifier. */
+#if ( configUSE_TIMER_WHEEL == 0 )
 PRIVILEGED_DATA static List_t xActiveTimerList1;
 PRIVILEGED_DATA static List_t xActiveTimerList2;
 PRIVILEGED_DATA static List_t *pxCurrentTimerList;
 PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#else
+	/* When the timing wheel is used the active timers are instead stored in
+	unsorted slot lists, so starting, stopping and expiring a timer does not
+	depend on how many timers are active.  xWheelTime is the last tick the
+	wheel has processed, it only lags the tick count while the timer service
+	task is not running.  Only the timer service task accesses these. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ configTIMER_WHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+	PRIVILEGED_DATA static uint32_t ulWheelSlotMap[ configTIMER_WHEEL_LEVELS ];
+	PRIVILEGED_DATA static TickType_t xWheelTime = ( TickType_t ) 0U;
+	PRIVILEGED_DATA static UBaseType_t uxTimersInWheel = ( UBaseType_t ) 0U;
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -180,6 +207,8 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto reload timer, then call its callback.
@@ -192,12 +221,16 @@ static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const Tick
  */
 static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
 
+#endif /* configUSE_TIMER_WHEEL */
+
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
  * if a tick count overflow occurred since prvSampleTimeNow() was last called.
  */
 static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 /*
  * If the timer list contains any active timers then return the expire time of
  * the timer that will expire first and set *pxListWasEmpty to false.  If the
@@ -212,6 +245,39 @@ static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIV
  */
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
+#else
+
+/*
+ * Place the timer in the wheel slot that corresponds to the expiry time
+ * held in its list item, relative to the tick the wheel has reached.
+ */
+static void prvPlaceTimerInWheel( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Take an active timer out of its wheel slot.
+ */
+static void prvRemoveTimerFromWheel( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move the wheel forward one tick at a time until it reaches xTimeNow,
+ * cascading the upper levels and expiring the timers that are due.
+ */
+static void prvAdvanceTimerWheel( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Number of ticks until the wheel has something to do, either expire a
+ * timer or cascade a non empty slot.  The wheel must not be empty.
+ */
+static TickType_t prvGetWheelTicksToNextEvent( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Bring the wheel up to date, then block the timer service task until the
+ * next wheel event or until a command is received.
+ */
+static void prvProcessTimerWheelOrBlockTask( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
+
 /*
  * Called after a Timer_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -479,6 +545,8 @@ Timer_t *pxTimer = xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
@@ -518,12 +586,16 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 	/* Call the timer callback. */
 	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static portTASK_FUNCTION( prvTimerTask, pvParameters )
 {
+#if ( configUSE_TIMER_WHEEL == 0 )
 TickType_t xNextExpireTime;
 BaseType_t xListWasEmpty;
+#endif
 
 	/* Just to avoid compiler warnings. */
 	( void ) pvParameters;
@@ -542,13 +614,23 @@ BaseType_t xListWasEmpty;
 
 	for( ;; )
 	{
-		/* Query the timers list to see if it contains any timers, and if so,
-		obtain the time at which the next timer will expire. */
-		xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
+		#if ( configUSE_TIMER_WHEEL == 0 )
+		{
+			/* Query the timers list to see if it contains any timers, and if
+			so, obtain the time at which the next timer will expire. */
+			xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
 
-		/* If a timer has expired, process it.  Otherwise, block this task
-		until either a timer does expire, or a command is received. */
-		prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+			/* If a timer has expired, process it.  Otherwise, block this task
+			until either a timer does expire, or a command is received. */
+			prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+		}
+		#else
+		{
+			/* Expire the timers that are due, then block this task until the
+			wheel has work to do again or a command is received. */
+			prvProcessTimerWheelOrBlockTask();
+		}
+		#endif /* configUSE_TIMER_WHEEL */
 
 		/* Empty the command queue. */
 		prvProcessReceivedCommands();
@@ -556,6 +638,8 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
@@ -640,6 +724,217 @@ TickType_t xNextExpireTime;
 
 	return xNextExpireTime;
 }
+
+#else /* configUSE_TIMER_WHEEL */
+
+static void prvPlaceTimerInWheel( Timer_t * const pxTimer )
+{
+TickType_t xPlacement = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+uint32_t ulDelta = ( uint32_t ) ( TickType_t ) ( xPlacement - xWheelTime );
+uint32_t ulLevel = 0U, ulSlot;
+
+	/* A delay longer than the wheel is parked in the top level at the
+	furthest position it can reach.  The real expiry time stays in the list
+	item, so the timer is placed again when that slot is cascaded. */
+	if( ulDelta > tmrWHEEL_MAX_DELTA )
+	{
+		ulDelta = tmrWHEEL_MAX_DELTA;
+		xPlacement = ( TickType_t ) ( xWheelTime + ( TickType_t ) tmrWHEEL_MAX_DELTA );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The level depends on how far away the expiry is, the slot within
+	the level on the expiry time itself. */
+	while( ulDelta > ( ( ( uint32_t ) 1U << ( tmrWHEEL_SLOT_BITS * ( ulLevel + 1U ) ) ) - 1U ) )
+	{
+		ulLevel++;
+	}
+	ulSlot = ( ( uint32_t ) xPlacement >> ( tmrWHEEL_SLOT_BITS * ulLevel ) ) & tmrWHEEL_SLOT_MASK;
+
+	vListInsertEnd( &( xTimerWheel[ ulLevel ][ ulSlot ] ), &( pxTimer->xTimerListItem ) );
+	ulWheelSlotMap[ ulLevel ] |= ( ( uint32_t ) 1U << ulSlot );
+	uxTimersInWheel++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveTimerFromWheel( Timer_t * const pxTimer )
+{
+const List_t * const pxSlot = ( const List_t * ) listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+const uint32_t ulIndex = ( uint32_t ) ( pxSlot - &( xTimerWheel[ 0 ][ 0 ] ) );
+
+	if( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0 )
+	{
+		ulWheelSlotMap[ ulIndex >> tmrWHEEL_SLOT_BITS ] &= ~( ( uint32_t ) 1U << ( ulIndex & tmrWHEEL_SLOT_MASK ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	uxTimersInWheel--;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAdvanceTimerWheel( const TickType_t xTimeNow )
+{
+TickType_t xIdleTicks;
+uint32_t ulLevel, ulSlot;
+List_t *pxSlot;
+Timer_t *pxTimer;
+
+	while( xWheelTime != xTimeNow )
+	{
+		if( uxTimersInWheel == ( UBaseType_t ) 0 )
+		{
+			/* Nothing to expire, the wheel can jump straight to now. */
+			xWheelTime = xTimeNow;
+			break;
+		}
+
+		/* Skip the ticks on which the wheel has nothing to do. */
+		xIdleTicks = prvGetWheelTicksToNextEvent() - ( TickType_t ) 1U;
+		if( ( TickType_t ) ( xTimeNow - xWheelTime ) <= xIdleTicks )
+		{
+			xWheelTime = xTimeNow;
+			break;
+		}
+		xWheelTime += xIdleTicks;
+		xWheelTime++;
+
+		/* Each time a level wraps the next slot of the level above is
+		spread over the lower levels. */
+		for( ulLevel = 1U; ulLevel < ( uint32_t ) configTIMER_WHEEL_LEVELS; ulLevel++ )
+		{
+			if( ( ( uint32_t ) xWheelTime & ( ( ( uint32_t ) 1U << ( tmrWHEEL_SLOT_BITS * ulLevel ) ) - 1U ) ) != 0U )
+			{
+				break;
+			}
+
+			ulSlot = ( ( uint32_t ) xWheelTime >> ( tmrWHEEL_SLOT_BITS * ulLevel ) ) & tmrWHEEL_SLOT_MASK;
+			pxSlot = &( xTimerWheel[ ulLevel ][ ulSlot ] );
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				prvRemoveTimerFromWheel( pxTimer );
+				prvPlaceTimerInWheel( pxTimer );
+			}
+		}
+
+		/* Every timer left in the current slot of the lowest level expires
+		on this tick. */
+		pxSlot = &( xTimerWheel[ 0 ][ ( uint32_t ) xWheelTime & tmrWHEEL_SLOT_MASK ] );
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			prvRemoveTimerFromWheel( pxTimer );
+			traceTIMER_EXPIRED( pxTimer );
+
+			if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+			{
+				/* The reload is relative to the tick the wheel is on, so
+				it can always be placed directly, even when the wheel is
+				catching up with the tick count. */
+				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), ( xWheelTime + pxTimer->xTimerPeriodInTicks ) );
+				prvPlaceTimerInWheel( pxTimer );
+			}
+			else
+			{
+				pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+			}
+
+			/* Call the timer callback. */
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvGetWheelTicksToNextEvent( void )
+{
+TickType_t xTicks = portMAX_DELAY, xCandidate;
+uint32_t ulLevel, ulShift, ulCurrent, ulFirst, ulMap, ulSlot;
+
+	for( ulLevel = 0U; ulLevel < ( uint32_t ) configTIMER_WHEEL_LEVELS; ulLevel++ )
+	{
+		ulMap = ulWheelSlotMap[ ulLevel ];
+		if( ulMap == 0U )
+		{
+			continue;
+		}
+
+		/* Find the first used slot after the current one, going round the
+		level. */
+		ulShift = tmrWHEEL_SLOT_BITS * ulLevel;
+		ulCurrent = ( ( uint32_t ) xWheelTime >> ulShift ) & tmrWHEEL_SLOT_MASK;
+		ulFirst = ( ulCurrent + 1U ) & tmrWHEEL_SLOT_MASK;
+		if( ulFirst != 0U )
+		{
+			ulMap = ( ulMap >> ulFirst ) | ( ulMap << ( tmrWHEEL_SLOTS - ulFirst ) );
+		}
+		ulSlot = ( ulFirst + tmrWHEEL_FIRST_SLOT( ulMap ) ) & tmrWHEEL_SLOT_MASK;
+
+		/* A slot of the lowest level expires when the wheel reaches it,
+		a slot of an upper level is cascaded on the tick where all the
+		levels below it are back at slot zero.  A used current slot was
+		already cascaded and comes round after a full turn. */
+		ulSlot = ( ulSlot - ulCurrent ) & tmrWHEEL_SLOT_MASK;
+		if( ulSlot == 0U )
+		{
+			ulSlot = ( uint32_t ) tmrWHEEL_SLOTS;
+		}
+		xCandidate = ( TickType_t ) ( ( ulSlot << ulShift ) - ( ( uint32_t ) xWheelTime & ( ( ( uint32_t ) 1U << ulShift ) - 1U ) ) );
+
+		if( xCandidate < xTicks )
+		{
+			xTicks = xCandidate;
+		}
+	}
+
+	return xTicks;
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessTimerWheelOrBlockTask( void )
+{
+TickType_t xTicksToWait;
+BaseType_t xWheelWasEmpty;
+
+	/* Callbacks run with the scheduler resumed, as they do with the
+	timer lists. */
+	prvAdvanceTimerWheel( xTaskGetTickCount() );
+
+	vTaskSuspendAll();
+	{
+		if( xTaskGetTickCount() == xWheelTime )
+		{
+			xWheelWasEmpty = ( uxTimersInWheel == ( UBaseType_t ) 0 ) ? pdTRUE : pdFALSE;
+			xTicksToWait = ( xWheelWasEmpty != pdFALSE ) ? portMAX_DELAY : prvGetWheelTicksToNextEvent();
+
+			vQueueWaitForMessageRestricted( xTimerQueue, xTicksToWait, xWheelWasEmpty );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				/* Yield to wait for either a command to arrive, or the
+				block time to expire. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* The tick count moved on while the callbacks ran, process
+			the new ticks before blocking. */
+			( void ) xTaskResumeAll();
+		}
+	}
+}
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
@@ -649,15 +944,31 @@ PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Va
 
 	xTimeNow = xTaskGetTickCount();
 
-	if( xTimeNow < xLastTime )
+	#if ( configUSE_TIMER_WHEEL == 0 )
 	{
-		prvSwitchTimerLists();
-		*pxTimerListsWereSwitched = pdTRUE;
+		if( xTimeNow < xLastTime )
+		{
+			prvSwitchTimerLists();
+			*pxTimerListsWereSwitched = pdTRUE;
+		}
+		else
+		{
+			*pxTimerListsWereSwitched = pdFALSE;
+		}
 	}
-	else
+	#else
 	{
+		/* The wheel works modulo the tick count, so there are no lists to
+		switch when the tick count overflows.  An empty wheel has nothing to
+		catch up with, keep it on the current tick so the next timer is placed
+		relative to now however long the timer task was blocked. */
+		if( uxTimersInWheel == ( UBaseType_t ) 0 )
+		{
+			xWheelTime = xTimeNow;
+		}
 		*pxTimerListsWereSwitched = pdFALSE;
 	}
+	#endif /* configUSE_TIMER_WHEEL */
 
 	xLastTime = xTimeNow;
 
@@ -672,6 +983,21 @@ BaseType_t xProcessTimerNow = pdFALSE;
 	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
 	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
 
+	#if ( configUSE_TIMER_WHEEL == 1 )
+	{
+		/* The expiry time is xCommandTime plus the period, so it has elapsed
+		if at least a period went by since the command was issued, whether or
+		not the tick count overflowed in between. */
+		if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		{
+			xProcessTimerNow = pdTRUE;
+		}
+		else
+		{
+			prvPlaceTimerInWheel( pxTimer );
+		}
+	}
+	#else
 	if( xNextExpiryTime <= xTimeNow )
 	{
 		/* Has the expiry time elapsed between the command to start/reset a
@@ -701,6 +1027,7 @@ BaseType_t xProcessTimerNow = pdFALSE;
 			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
 		}
 	}
+	#endif /* configUSE_TIMER_WHEEL */
 
 	return xProcessTimerNow;
 }
@@ -748,7 +1075,15 @@ TickType_t xTimeNow;
 			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
 			{
 				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				#if ( configUSE_TIMER_WHEEL == 0 )
+				{
+					( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				}
+				#else
+				{
+					prvRemoveTimerFromWheel( pxTimer );
+				}
+				#endif /* configUSE_TIMER_WHEEL */
 			}
 			else
 			{
@@ -854,6 +1189,8 @@ TickType_t xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -911,6 +1248,8 @@ BaseType_t xResult;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -922,10 +1261,27 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if ( configUSE_TIMER_WHEEL == 0 )
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#else
+			{
+			UBaseType_t uxLevel, uxSlot;
+
+				for( uxLevel = 0; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+				{
+					for( uxSlot = 0; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+					{
+						vListInitialise( &( xTimerWheel[ uxLevel ][ uxSlot ] ) );
+					}
+					ulWheelSlotMap[ uxLevel ] = 0U;
+				}
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
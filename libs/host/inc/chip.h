@@ -0,0 +1,186 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CHIP_H_
+#define __CHIP_H_
+
+/** @brief Capa de chip simulada para compilar en la PC
+ **
+ ** Reemplaza a chip.h de LPCOpen cuando se compila con PLATFORM=host. Solo
+ ** ofrece la parte de la API que usan directamente los proyectos (NVIC y
+ ** envio de bytes por las UART), el resto de los perifericos se reemplaza a
+ ** nivel de los controladores de drivers_bm.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+#ifndef TRUE
+#define TRUE  (1)
+#endif
+#ifndef FALSE
+#define FALSE (0)
+#endif
+
+/** @brief Cantidad de bits de prioridad del NVIC del LPC4337 */
+#define __NVIC_PRIO_BITS          3
+
+/** @brief Bits de la UART usados por los proyectos */
+#define UART_IER_RBRINT           (1 << 0)    /*!< Habilitación de interrupción por recepción */
+#define UART_IER_THREINT          (1 << 1)    /*!< Habilitación de interrupción por THR vacio */
+#define UART_LSR_RDR              (1 << 0)    /*!< Dato recibido disponible */
+#define UART_LSR_THRE             (1 << 5)    /*!< Registro de transmisión vacio */
+#define UART_LSR_TEMT             (1 << 6)    /*!< Transmisor vacio */
+
+/** @brief UART simuladas, la USB-UART es la salida estandar del proceso */
+#define LPC_USART0                (&host_usart[0])
+#define LPC_USART2                (&host_usart[2])
+#define LPC_USART3                (&host_usart[3])
+
+#define __NOP()                   __asm volatile ("nop")
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+typedef enum {ERROR = 0, SUCCESS = !ERROR} Status;
+
+/** @brief Numeros de interrupción del LPC43xx, iguales a los de cmsis_43xx.h */
+typedef enum {
+   SysTick_IRQn      =  -1,
+   DAC_IRQn          =   0,
+   M0APP_IRQn        =   1,
+   DMA_IRQn          =   2,
+   ETHERNET_IRQn     =   5,
+   SDIO_IRQn         =   6,
+   LCD_IRQn          =   7,
+   USB0_IRQn         =   8,
+   USB1_IRQn         =   9,
+   SCT_IRQn          =  10,
+   RITIMER_IRQn      =  11,
+   TIMER0_IRQn       =  12,
+   TIMER1_IRQn       =  13,
+   TIMER2_IRQn       =  14,
+   TIMER3_IRQn       =  15,
+   MCPWM_IRQn        =  16,
+   ADC0_IRQn         =  17,
+   I2C0_IRQn         =  18,
+   I2C1_IRQn         =  19,
+   SPI_INT_IRQn      =  20,
+   ADC1_IRQn         =  21,
+   SSP0_IRQn         =  22,
+   SSP1_IRQn         =  23,
+   USART0_IRQn       =  24,
+   UART1_IRQn        =  25,
+   USART2_IRQn       =  26,
+   USART3_IRQn       =  27,
+   PIN_INT0_IRQn     =  32,
+   PIN_INT1_IRQn     =  33,
+   PIN_INT2_IRQn     =  34,
+   PIN_INT3_IRQn     =  35,
+   RTC_IRQn          =  47,
+   QEI_IRQn          =  52,
+} IRQn_Type;
+
+/** @brief Estado de una UART simulada */
+typedef struct {
+   volatile uint32_t IER;     /*!< Interrupciones habilitadas */
+   volatile bool sent;        /*!< Se escribio el registro de transmisión desde la ultima interrupción */
+   int fd;                    /*!< Descriptor donde se escriben los datos transmitidos */
+   IRQn_Type irq;             /*!< Interrupción asociada */
+} LPC_USART_T;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/** @brief Frecuencia nominal del nucleo, igual a la de la EDU-CIAA */
+extern uint32_t SystemCoreClock;
+
+/** @brief UART simuladas */
+extern LPC_USART_T host_usart[4];
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+void SystemCoreClockUpdate(void);
+
+/** @brief La placa simulada no requiere inicialización */
+void Board_Init(void);
+
+/** @brief Habilita una interrupción, desde ese momento se atiende su rutina de servicio */
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+
+/** @brief Deshabilita una interrupción, si se activa queda pendiente */
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+
+/** @brief Marca una interrupción como pendiente, como si la generara el periferico */
+void NVIC_SetPendingIRQ(IRQn_Type IRQn);
+
+/** @brief En la PC todas las interrupciones tienen la misma prioridad */
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+
+void Chip_UART_SendByte(LPC_USART_T *pUART, uint8_t data);
+uint8_t Chip_UART_ReadByte(LPC_USART_T *pUART);
+uint32_t Chip_UART_ReadLineStatus(LPC_USART_T *pUART);
+void Chip_UART_IntEnable(LPC_USART_T *pUART, uint32_t intMask);
+void Chip_UART_IntDisable(LPC_USART_T *pUART, uint32_t intMask);
+
+/** @brief Entrega un byte recibido a una UART simulada y genera su interrupción de recepción */
+void HostUartReceive(LPC_USART_T *pUART, uint8_t data);
+
+/** @brief Crea un hilo auxiliar de la simulación (teclado, perifericos)
+ **
+ ** El hilo se crea con todas las señales bloqueadas para que nunca atienda
+ ** el tick ni las interrupciones simuladas, que son exclusivas de la tarea
+ ** en ejecución.
+ */
+void HostStartThread(void * (*entry)(void *), void * arg);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* __CHIP_H_ */
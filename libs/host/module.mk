@@ -0,0 +1,13 @@
+ifeq ($(PLATFORM),host)
+
+# Ejecución de los proyectos como proceso nativo de la PC: el chip se reemplaza
+# por libs/host y los perifericos por los archivos host/ de cada modulo
+DEFINES+=PLATFORM_HOST
+ARCH_FLAGS=-pthread
+
+# Periodo real del tick en microsegundos, permite ejecutar mas rapido que en la placa
+ifneq ($(HOST_TICK_US),)
+DEFINES+=configHOST_TICK_PERIOD_US=$(HOST_TICK_US)UL
+endif
+
+endif
@@ -0,0 +1,298 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Capa de chip simulada para compilar en la PC
+ **
+ ** Implementa un NVIC simulado sobre las interrupciones del port POSIX de
+ ** FreeRTOS y las UART del LPC4337 sobre la entrada y salida del proceso.
+ ** Cuando el proyecto no usa FreeRTOS las rutinas de servicio se ejecutan
+ ** directamente en el hilo que genera la interrupción.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#define _GNU_SOURCE
+
+#include "chip.h"
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Cantidad de interrupciones del NVIC simulado */
+#define HOST_IRQ_COUNT      64
+
+/** @brief Tamaño de la cola de recepción de cada UART, potencia de dos */
+#define HOST_UART_RX_SIZE   256
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Cola de recepción de una UART, un único productor y un único consumidor */
+typedef struct {
+   uint8_t data[HOST_UART_RX_SIZE];
+   volatile uint32_t head;
+   volatile uint32_t tail;
+} host_uart_rx_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Rutina de servicio por defecto, las interrupciones sin rutina se ignoran */
+static void Default_IRQHandler(void);
+
+/** @brief Atiende una interrupción de UART y la vuelve a generar mientras siga activa
+ **
+ ** Igual que en el LPC4337 la interrupción de THR vacio se vuelve a activar
+ ** cada vez que la rutina de servicio escribe un nuevo dato, y la de
+ ** recepción permanece activa mientras queden datos por leer.
+ */
+static void HostUartService(LPC_USART_T * uart, void (*handler)(void));
+
+static void HostUart0Dispatch(void);
+static void HostUart2Dispatch(void);
+static void HostUart3Dispatch(void);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Colas de recepción de las UART simuladas */
+static host_uart_rx_t host_uart_rx[4];
+
+/** @brief Interrupciones habilitadas en el NVIC simulado */
+static volatile uint64_t host_irq_enabled;
+
+/* === Definiciones de variables externas ====================================================== */
+
+uint32_t SystemCoreClock = 204000000;
+
+LPC_USART_T host_usart[4] = {
+   { .IER = 0, .sent = false, .fd = STDERR_FILENO, .irq = USART0_IRQn },
+   { .IER = 0, .sent = false, .fd = STDERR_FILENO, .irq = UART1_IRQn  },
+   { .IER = 0, .sent = false, .fd = STDOUT_FILENO, .irq = USART2_IRQn },
+   { .IER = 0, .sent = false, .fd = STDERR_FILENO, .irq = USART3_IRQn },
+};
+
+/* Rutinas de servicio, las define el proyecto o algún controlador */
+void DMA_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void RIT_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void TIMER0_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void TIMER1_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void TIMER2_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void TIMER3_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void SSP0_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void SSP1_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void UART0_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void UART1_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void UART2_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void UART3_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void GPIO0_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void GPIO1_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void GPIO2_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void GPIO3_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+void RTC_IRQHandler(void) __attribute__((weak, alias("Default_IRQHandler")));
+
+/* El port de FreeRTOS solo esta presente cuando el proyecto lo usa */
+extern void vPortSetInterruptHandler(uint32_t number, void (*handler)(void)) __attribute__((weak));
+extern void vPortGenerateSimulatedInterrupt(uint32_t number) __attribute__((weak));
+
+/** @brief Tabla de vectores del NVIC simulado */
+static void (* const host_vectors[HOST_IRQ_COUNT])(void) = {
+   [DMA_IRQn]       = DMA_IRQHandler,
+   [RITIMER_IRQn]   = RIT_IRQHandler,
+   [TIMER0_IRQn]    = TIMER0_IRQHandler,
+   [TIMER1_IRQn]    = TIMER1_IRQHandler,
+   [TIMER2_IRQn]    = TIMER2_IRQHandler,
+   [TIMER3_IRQn]    = TIMER3_IRQHandler,
+   [SSP0_IRQn]      = SSP0_IRQHandler,
+   [SSP1_IRQn]      = SSP1_IRQHandler,
+   [USART0_IRQn]    = HostUart0Dispatch,
+   [UART1_IRQn]     = UART1_IRQHandler,
+   [USART2_IRQn]    = HostUart2Dispatch,
+   [USART3_IRQn]    = HostUart3Dispatch,
+   [PIN_INT0_IRQn]  = GPIO0_IRQHandler,
+   [PIN_INT1_IRQn]  = GPIO1_IRQHandler,
+   [PIN_INT2_IRQn]  = GPIO2_IRQHandler,
+   [PIN_INT3_IRQn]  = GPIO3_IRQHandler,
+   [RTC_IRQn]       = RTC_IRQHandler,
+};
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void Default_IRQHandler(void) {
+}
+
+static void HostUartService(LPC_USART_T * uart, void (*handler)(void)) {
+   host_uart_rx_t * rx = &host_uart_rx[uart - host_usart];
+
+   uart->sent = false;
+   handler();
+
+   if (((uart->IER & UART_IER_THREINT) && uart->sent) ||
+      ((uart->IER & UART_IER_RBRINT) && (rx->head != rx->tail))) {
+      NVIC_SetPendingIRQ(uart->irq);
+   }
+}
+
+static void HostUart0Dispatch(void) {
+   HostUartService(LPC_USART0, UART0_IRQHandler);
+}
+
+static void HostUart2Dispatch(void) {
+   HostUartService(LPC_USART2, UART2_IRQHandler);
+}
+
+static void HostUart3Dispatch(void) {
+   HostUartService(LPC_USART3, UART3_IRQHandler);
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void SystemCoreClockUpdate(void) {
+}
+
+void Board_Init(void) {
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn) {
+   if ((IRQn < 0) || (IRQn >= HOST_IRQ_COUNT) || (host_vectors[IRQn] == NULL)) {
+      return;
+   }
+   __atomic_fetch_or(&host_irq_enabled, 1ULL << IRQn, __ATOMIC_SEQ_CST);
+   if (vPortSetInterruptHandler) {
+      vPortSetInterruptHandler(IRQn, host_vectors[IRQn]);
+   }
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn) {
+   if ((IRQn < 0) || (IRQn >= HOST_IRQ_COUNT)) {
+      return;
+   }
+   __atomic_fetch_and(&host_irq_enabled, ~(1ULL << IRQn), __ATOMIC_SEQ_CST);
+   if (vPortSetInterruptHandler) {
+      vPortSetInterruptHandler(IRQn, NULL);
+   }
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type IRQn) {
+   if ((IRQn < 0) || (IRQn >= HOST_IRQ_COUNT)) {
+      return;
+   }
+   if (vPortGenerateSimulatedInterrupt) {
+      vPortGenerateSimulatedInterrupt(IRQn);
+   } else if (host_irq_enabled & (1ULL << IRQn)) {
+      host_vectors[IRQn]();
+   }
+}
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority) {
+   (void) IRQn;
+   (void) priority;
+}
+
+void Chip_UART_SendByte(LPC_USART_T *pUART, uint8_t data) {
+   ssize_t written;
+
+   do {
+      written = write(pUART->fd, &data, 1);
+   } while (written < 0);
+   pUART->sent = true;
+}
+
+uint8_t Chip_UART_ReadByte(LPC_USART_T *pUART) {
+   host_uart_rx_t * rx = &host_uart_rx[pUART - host_usart];
+   uint8_t data = 0;
+
+   if (rx->head != rx->tail) {
+      data = rx->data[rx->tail % HOST_UART_RX_SIZE];
+      __atomic_store_n(&rx->tail, rx->tail + 1, __ATOMIC_RELEASE);
+   }
+   return data;
+}
+
+uint32_t Chip_UART_ReadLineStatus(LPC_USART_T *pUART) {
+   host_uart_rx_t * rx = &host_uart_rx[pUART - host_usart];
+   uint32_t status = UART_LSR_THRE | UART_LSR_TEMT;
+
+   if (rx->head != rx->tail) {
+      status |= UART_LSR_RDR;
+   }
+   return status;
+}
+
+void Chip_UART_IntEnable(LPC_USART_T *pUART, uint32_t intMask) {
+   host_uart_rx_t * rx = &host_uart_rx[pUART - host_usart];
+
+   __atomic_fetch_or(&pUART->IER, intMask, __ATOMIC_SEQ_CST);
+
+   /* El transmisor siempre esta vacio, igual que en el 16550 habilitar la
+      interrupción con el THR vacio la genera inmediatamente */
+   if ((intMask & UART_IER_THREINT) || ((intMask & UART_IER_RBRINT) && (rx->head != rx->tail))) {
+      NVIC_SetPendingIRQ(pUART->irq);
+   }
+}
+
+void Chip_UART_IntDisable(LPC_USART_T *pUART, uint32_t intMask) {
+   __atomic_fetch_and(&pUART->IER, ~intMask, __ATOMIC_SEQ_CST);
+}
+
+void HostUartReceive(LPC_USART_T *pUART, uint8_t data) {
+   host_uart_rx_t * rx = &host_uart_rx[pUART - host_usart];
+
+   /* Con la cola llena el dato se pierde, como con un desborde de la FIFO */
+   if ((rx->head - rx->tail) < HOST_UART_RX_SIZE) {
+      rx->data[rx->head % HOST_UART_RX_SIZE] = data;
+      __atomic_store_n(&rx->head, rx->head + 1, __ATOMIC_RELEASE);
+   }
+   if (pUART->IER & UART_IER_RBRINT) {
+      NVIC_SetPendingIRQ(pUART->irq);
+   }
+}
+
+void HostStartThread(void * (*entry)(void *), void * arg) {
+   pthread_t thread;
+   sigset_t signals, previous;
+
+   sigfillset(&signals);
+   pthread_sigmask(SIG_BLOCK, &signals, &previous);
+   if (pthread_create(&thread, NULL, entry, arg) == 0) {
+      pthread_detach(thread);
+   }
+   pthread_sigmask(SIG_SETMASK, &previous, NULL);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
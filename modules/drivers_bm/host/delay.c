@@ -0,0 +1,99 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Demoras simuladas
+ **
+ ** Reemplaza a src/delay.c cuando se compila con PLATFORM=host. En lugar de
+ ** esperar al TIMER0 el hilo duerme hasta un instante absoluto, de forma que
+ ** las señales del tick y de las interrupciones simuladas no acortan ni
+ ** alargan la demora.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#define _GNU_SOURCE
+
+#include "delay.h"
+#include <errno.h>
+#include <time.h>
+
+/* === Definicion y Macros ===================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Duerme el hilo actual durante la cantidad de microsegundos indicada */
+static void SleepUs(uint64_t usec);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void SleepUs(uint64_t usec) {
+   struct timespec deadline;
+
+   clock_gettime(CLOCK_MONOTONIC, &deadline);
+   deadline.tv_sec += usec / 1000000;
+   deadline.tv_nsec += (usec % 1000000) * 1000;
+   if (deadline.tv_nsec >= 1000000000) {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000;
+   }
+   while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+   }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void DelaySec(uint32_t sec) {
+   SleepUs((uint64_t) sec * 1000000);
+}
+
+void DelayMs(uint32_t msec) {
+   SleepUs((uint64_t) msec * 1000);
+}
+
+void DelayUs(uint32_t usec) {
+   SleepUs(usec);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,101 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief GPIO de la EDU-CIAA simulados
+ **
+ ** Reemplaza a src/gpio.c cuando se compila con PLATFORM=host. El nivel de
+ ** cada pin se guarda en memoria, lo que permite que otros perifericos
+ ** simulados lo consulten, por ejemplo la linea DC de la pantalla en spi.c.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "gpio.h"
+#include "chip.h"
+
+/* === Definicion y Macros ===================================================================== */
+
+#define SUCCESS_GPIO    1
+
+/** @brief Cantidad de pines de la bornera GPIO */
+#define GPIO_COUNT      (GPIO_8 + 1)
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Nivel de cada pin */
+static volatile uint8_t gpio_level[GPIO_COUNT];
+
+/** @brief Nivel de un pin de entrada sin excitación, segun su resistencia */
+static uint8_t gpio_idle[GPIO_COUNT];
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+/* === Definiciones de funciones externas ====================================================== */
+
+uint8_t GPIOInit(gpioConf_t gpio) {
+   gpio_idle[gpio.pin] = (gpio.res == PULLUP) ? TRUE : FALSE;
+
+   /* All outputs initialized at low state */
+   gpio_level[gpio.pin] = (gpio.dir == OUTPUT) ? FALSE : gpio_idle[gpio.pin];
+   return SUCCESS_GPIO;
+}
+
+uint8_t GPIORead(gpioPin_t pin) {
+   return gpio_level[pin];
+}
+
+void GPIOSetHigh(gpioPin_t pin) {
+   gpio_level[pin] = TRUE;
+}
+
+void GPIOSetLow(gpioPin_t pin) {
+   gpio_level[pin] = FALSE;
+}
+
+void GPIOToggle(gpioPin_t pin) {
+   gpio_level[pin] = !gpio_level[pin];
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,141 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HOST_BOARD_H
+#define HOST_BOARD_H
+
+/** @brief Acceso a la placa simulada cuando se compila con PLATFORM=host
+ **
+ ** Los controladores de la carpeta host reemplazan a los de src y mantienen el
+ ** estado de los perifericos en memoria. Estas funciones permiten a los
+ ** proyectos y a los bancos de prueba actuar sobre las teclas y leer el estado
+ ** de los leds y de la pantalla sin modificar el código de las tareas.
+ **
+ ** Las teclas 1 a 4 del teclado de la PC pulsan TECLA1 a TECLA4, el resto de
+ ** los caracteres se entregan a la recepción de la USB-UART.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Duración de la pulsación de una tecla desde el teclado de la PC */
+#define HOST_KEY_PRESS_MS     150
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/** @brief Estadisticas del puerto SPI1 y de la pantalla simulada */
+typedef struct {
+   uint32_t inits;            /*!< Llamadas a SpiInit */
+   uint32_t transfers;        /*!< Transferencias iniciadas con SpiWrite, SpiWrite16, SpiRead o SpiReadWrite */
+   uint32_t bytes;            /*!< Bytes transferidos */
+   uint32_t frames;           /*!< Tramas transferidas, de 8 o de 16 bits */
+   uint32_t commands;         /*!< Comandos recibidos por el ILI9341 */
+   uint32_t pixels;           /*!< Pixeles escritos en la memoria de la pantalla */
+} host_spi_stats_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Mantiene pulsadas las teclas indicadas hasta una nueva llamada
+ **
+ ** @param[in] keys Mascara de teclas con los valores de SWITCHES
+ */
+void HostSwitchesSet(uint8_t keys);
+
+/** @brief Pulsa las teclas indicadas durante un tiempo y luego las libera
+ **
+ ** @param[in] keys Mascara de teclas con los valores de SWITCHES
+ ** @param[in] msec Duración de la pulsación en milisegundos
+ */
+void HostSwitchesPress(uint8_t keys, uint32_t msec);
+
+/** @brief Devuelve la mascara de leds encendidos con los valores de LED_COLOR */
+uint8_t HostLedsGet(void);
+
+/** @brief Devuelve el color RGB565 de un pixel de la memoria de la pantalla
+ **
+ ** @param[in] column Columna de la memoria, entre 0 y 239
+ ** @param[in] page Fila de la memoria, entre 0 y 319
+ */
+uint16_t HostDisplayGetPixel(uint16_t column, uint16_t page);
+
+/** @brief Devuelve el color RGB565 de un pixel como lo muestra el panel
+ **
+ ** Aplica el desplazamiento vertical configurado con los comandos 0x33 y
+ ** 0x37, las filas del area de desplazamiento muestran otras filas de la
+ ** memoria. Sin desplazamiento es igual a HostDisplayGetPixel.
+ **
+ ** @param[in] column Columna de la memoria, entre 0 y 239
+ ** @param[in] row Fila del panel, entre 0 y 319
+ */
+uint16_t HostDisplayGetScreenPixel(uint16_t column, uint16_t row);
+
+/** @brief Guarda el contenido de la pantalla en un archivo PPM
+ **
+ ** La imagen se guarda como se ve el panel, independientemente de la
+ ** orientación configurada con ILI9341Rotate y con el desplazamiento
+ ** vertical aplicado.
+ **
+ ** @param[in] file Nombre del archivo
+ ** @return true si el archivo se pudo escribir
+ */
+bool HostDisplaySave(const char * file);
+
+/** @brief Copia las estadisticas del puerto SPI1 */
+void HostSpiGetStats(host_spi_stats_t * stats);
+
+/** @brief Pone a cero las estadisticas del puerto SPI1 */
+void HostSpiResetStats(void);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* HOST_BOARD_H */
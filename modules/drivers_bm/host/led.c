@@ -0,0 +1,127 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Leds de la EDU-CIAA simulados
+ **
+ ** Reemplaza a src/led.c cuando se compila con PLATFORM=host. El estado de los
+ ** leds se guarda en memoria y, si la variable de entorno HOST_TRACE_LEDS esta
+ ** definida, cada cambio se informa por la salida de errores.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "led.h"
+#include "host_board.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Mascara con todos los leds de la placa */
+#define ALL_LEDS    (RGB_R_LED | RGB_G_LED | RGB_B_LED | RED_LED | YELLOW_LED | GREEN_LED)
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Cambia el estado de los leds e informa el cambio si corresponde */
+static uint8_t LedsUpdate(uint8_t state);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Leds encendidos */
+static volatile uint8_t leds_state;
+
+/** @brief Informar los cambios por la salida de errores */
+static bool leds_trace;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static uint8_t LedsUpdate(uint8_t state) {
+   state &= ALL_LEDS;
+   if (leds_trace && (state != leds_state)) {
+      fprintf(stderr, "[leds] R:%c G:%c B:%c ROJO:%c AMARILLO:%c VERDE:%c\n",
+         (state & RGB_R_LED) ? '1' : '0', (state & RGB_G_LED) ? '1' : '0',
+         (state & RGB_B_LED) ? '1' : '0', (state & RED_LED) ? '1' : '0',
+         (state & YELLOW_LED) ? '1' : '0', (state & GREEN_LED) ? '1' : '0');
+   }
+   leds_state = state;
+   return TRUE;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+uint8_t Init_Leds(void) {
+   leds_trace = (getenv("HOST_TRACE_LEDS") != NULL);
+   leds_state = 0;
+   return TRUE;
+}
+
+uint8_t Led_On(uint8_t led) {
+   if ((led & ALL_LEDS) == 0) {
+      return FALSE;
+   }
+   return LedsUpdate(leds_state | led);
+}
+
+uint8_t Led_Off(uint8_t led) {
+   if ((led & ALL_LEDS) == 0) {
+      return FALSE;
+   }
+   return LedsUpdate(leds_state & ~led);
+}
+
+uint8_t Led_Toggle(uint8_t led) {
+   if ((led & ALL_LEDS) == 0) {
+      return FALSE;
+   }
+   return LedsUpdate(leds_state ^ led);
+}
+
+uint8_t Led_Off_All(void) {
+   return LedsUpdate(0);
+}
+
+uint8_t HostLedsGet(void) {
+   return leds_state;
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
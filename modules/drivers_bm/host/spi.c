@@ -0,0 +1,441 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Puerto SPI1 con una pantalla ILI9341 simulada
+ **
+ ** Reemplaza a src/spi.c cuando se compila con PLATFORM=host. Todo lo que se
+ ** transmite por el SPI1 lo recibe un modelo del controlador ILI9341 que
+ ** mantiene la memoria de 240x320 pixeles, de forma que src/ili9341.c y
+ ** src/fonts.c se compilan sin cambios y su resultado se puede verificar.
+ **
+ ** El modelo interpreta los comandos de ventana (0x2A, 0x2B), escritura de
+ ** memoria (0x2C, 0x3C), orientación (0x36), desplazamiento vertical (0x33,
+ ** 0x37) y reinicio (0x01), el resto se cuentan pero no tienen efecto. Igual que en la placa, la linea DC se
+ ** muestrea del GPIO al que la conectan todos los proyectos.
+ **
+ ** Las transferencias se completan antes de retornar, en cualquiera de los
+ ** modos de transferencia. Las tramas de 16 bits de SpiWrite16 llegan a la
+ ** pantalla con el bit mas significativo primero, como en el SSP.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "spi.h"
+#include "gpio.h"
+#include "chip.h"
+#include "host_board.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ===================================================================== */
+
+#define SUCCESS_SPI     1
+#define ERROR_SPI       0
+#define HIGH            1
+#define LOW             0
+
+/** @brief GPIO conectado a la linea DC de la pantalla */
+#define LCD_DC_PIN      GPIO_6
+
+/** @brief Dimensiones fisicas de la memoria del ILI9341 */
+#define LCD_COLUMNS     240
+#define LCD_PAGES       320
+
+/** @brief Comandos interpretados por el modelo */
+#define LCD_RESET       0x01
+#define LCD_COLUMN_SET  0x2A
+#define LCD_PAGE_SET    0x2B
+#define LCD_MEM_WRITE   0x2C
+#define LCD_SCROLL_AREA 0x33
+#define LCD_MEM_ACCESS  0x36
+#define LCD_SCROLL_START 0x37
+#define LCD_MEM_CONTINUE 0x3C
+
+/** @brief Bits del registro MADCTL */
+#define MADCTL_MY       0x80
+#define MADCTL_MX       0x40
+#define MADCTL_MV       0x20
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/** @brief Estado del controlador ILI9341 simulado */
+typedef struct {
+   uint8_t command;                       /*!< Ultimo comando recibido */
+   uint8_t params[6];                     /*!< Parametros recibidos del ultimo comando */
+   uint8_t count;                         /*!< Cantidad de parametros recibidos */
+   uint8_t madctl;                        /*!< Registro de control de acceso a memoria */
+   uint16_t sc, ec, sp, ep;               /*!< Ventana de escritura */
+   uint16_t column, page;                 /*!< Posición de escritura actual */
+   int16_t latch;                         /*!< Primer byte de un pixel, -1 si no hay */
+   uint16_t tfa, vsa;                     /*!< Area fija superior y area de desplazamiento */
+   uint16_t vsp;                          /*!< Fila de la memoria al inicio del area de desplazamiento */
+} lcd_model_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Entrega un bloque de bytes recibidos por el SPI al modelo de la pantalla */
+static void LcdReceive(const uint8_t * data, uint32_t size);
+
+/** @brief Procesa un comando, con DC en bajo */
+static void LcdCommand(uint8_t command);
+
+/** @brief Procesa un parametro o dato, con DC en alto */
+static void LcdData(uint8_t data);
+
+/** @brief Escribe un pixel en la posición actual y avanza dentro de la ventana */
+static void LcdPixel(uint16_t color);
+
+/** @brief Devuelve la fila de la memoria que muestra una fila del panel */
+static uint16_t LcdScreenPage(uint16_t row);
+
+/** @brief Completa una transferencia de tramas de 8 bits en el SPI1 */
+static void Spi1Transfer(uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t size);
+
+/** @brief Completa una escritura de tramas de 16 bits en el SPI1 */
+static void Spi1Transfer16(uint16_t * tx_buffer, uint32_t count);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Modelo de la pantalla */
+static lcd_model_t lcd = {
+   .ec = LCD_COLUMNS - 1,
+   .ep = LCD_PAGES - 1,
+   .latch = -1,
+   .vsa = LCD_PAGES,
+};
+
+/** @brief Memoria de la pantalla */
+static uint16_t lcd_gram[LCD_PAGES][LCD_COLUMNS];
+
+/** @brief Estadisticas del puerto */
+static host_spi_stats_t spi_stats;
+
+/** @brief Funcion para manejar el CS del SPI1 */
+static void (* SetCS1) (uint8_t);
+
+/** @brief Funcion que se llama al terminar cada transferencia del SPI1 */
+static void (* TransferCallback1) (void);
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void LcdCommand(uint8_t command) {
+   spi_stats.commands++;
+   lcd.command = command;
+   lcd.count = 0;
+   lcd.latch = -1;
+
+   switch (command) {
+   case LCD_RESET:
+      lcd.madctl = 0;
+      lcd.sc = 0;
+      lcd.ec = LCD_COLUMNS - 1;
+      lcd.sp = 0;
+      lcd.ep = LCD_PAGES - 1;
+      lcd.tfa = 0;
+      lcd.vsa = LCD_PAGES;
+      lcd.vsp = 0;
+      break;
+   case LCD_MEM_WRITE:
+      lcd.column = lcd.sc;
+      lcd.page = lcd.sp;
+      break;
+   default:
+      break;
+   }
+}
+
+static void LcdData(uint8_t data) {
+   if ((lcd.command == LCD_MEM_WRITE) || (lcd.command == LCD_MEM_CONTINUE)) {
+      if (lcd.latch < 0) {
+         lcd.latch = data;
+      } else {
+         LcdPixel((lcd.latch << 8) | data);
+         lcd.latch = -1;
+      }
+      return;
+   }
+
+   if (lcd.count < sizeof(lcd.params)) {
+      lcd.params[lcd.count] = data;
+   }
+   lcd.count++;
+
+   switch (lcd.command) {
+   case LCD_COLUMN_SET:
+      if (lcd.count == 4) {
+         lcd.sc = (lcd.params[0] << 8) | lcd.params[1];
+         lcd.ec = (lcd.params[2] << 8) | lcd.params[3];
+      }
+      break;
+   case LCD_PAGE_SET:
+      if (lcd.count == 4) {
+         lcd.sp = (lcd.params[0] << 8) | lcd.params[1];
+         lcd.ep = (lcd.params[2] << 8) | lcd.params[3];
+      }
+      break;
+   case LCD_MEM_ACCESS:
+      lcd.madctl = data;
+      break;
+   case LCD_SCROLL_AREA:
+      /* Como en el controlador, si las tres areas no suman la pantalla el comando no se aplica */
+      if ((lcd.count == 6) && (((lcd.params[0] << 8) | lcd.params[1]) + ((lcd.params[2] << 8) | lcd.params[3]) +
+                               ((lcd.params[4] << 8) | lcd.params[5]) == LCD_PAGES)) {
+         lcd.tfa = (lcd.params[0] << 8) | lcd.params[1];
+         lcd.vsa = (lcd.params[2] << 8) | lcd.params[3];
+      }
+      break;
+   case LCD_SCROLL_START:
+      if (lcd.count == 2) {
+         lcd.vsp = (lcd.params[0] << 8) | lcd.params[1];
+      }
+      break;
+   default:
+      break;
+   }
+}
+
+static uint16_t LcdScreenPage(uint16_t row) {
+   uint16_t start;
+
+   if ((row < lcd.tfa) || (row >= lcd.tfa + lcd.vsa) || (lcd.vsa == 0)) {
+      return row;
+   }
+   /* El area muestra desde la fila vsp y da la vuelta al llegar al final */
+   start = ((lcd.vsp >= lcd.tfa) && (lcd.vsp < lcd.tfa + lcd.vsa)) ? lcd.vsp - lcd.tfa : 0;
+   return lcd.tfa + (row - lcd.tfa + start) % lcd.vsa;
+}
+
+static void LcdPixel(uint16_t color) {
+   uint16_t x = lcd.column;
+   uint16_t y = lcd.page;
+   uint16_t aux;
+
+   /* Con MV las columnas recorren las filas de la memoria y viceversa */
+   if (lcd.madctl & MADCTL_MV) {
+      aux = x;
+      x = y;
+      y = aux;
+   }
+   /* Los datos fuera de la memoria se descartan */
+   if ((x < LCD_COLUMNS) && (y < LCD_PAGES)) {
+      if (lcd.madctl & MADCTL_MX) {
+         x = LCD_COLUMNS - 1 - x;
+      }
+      if (lcd.madctl & MADCTL_MY) {
+         y = LCD_PAGES - 1 - y;
+      }
+      lcd_gram[y][x] = color;
+   }
+   spi_stats.pixels++;
+
+   if (lcd.column < lcd.ec) {
+      lcd.column++;
+   } else {
+      lcd.column = lcd.sc;
+      lcd.page = (lcd.page < lcd.ep) ? lcd.page + 1 : lcd.sp;
+   }
+}
+
+static void LcdReceive(const uint8_t * data, uint32_t size) {
+   uint32_t index;
+
+   if (GPIORead(LCD_DC_PIN)) {
+      for (index = 0; index < size; index++) {
+         LcdData(data[index]);
+      }
+   } else {
+      for (index = 0; index < size; index++) {
+         LcdCommand(data[index]);
+      }
+   }
+}
+
+static void Spi1Transfer(uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t size) {
+   spi_stats.transfers++;
+   spi_stats.bytes += size;
+   spi_stats.frames += size;
+
+   if (SetCS1 != NULL) {
+      SetCS1(LOW);
+   }
+   if (tx_buffer != NULL) {
+      LcdReceive(tx_buffer, size);
+   }
+   if (rx_buffer != NULL) {
+      memset(rx_buffer, 0, size);
+   }
+   if (SetCS1 != NULL) {
+      SetCS1(HIGH);
+   }
+   /* Las transferencias terminan antes de volver, como en el modo polling */
+   if (TransferCallback1 != NULL) {
+      TransferCallback1();
+   }
+}
+
+static void Spi1Transfer16(uint16_t * tx_buffer, uint32_t count) {
+   uint32_t index;
+   uint8_t frame[2];
+
+   spi_stats.transfers++;
+   spi_stats.bytes += 2 * count;
+   spi_stats.frames += count;
+
+   if (SetCS1 != NULL) {
+      SetCS1(LOW);
+   }
+   for (index = 0; index < count; index++) {
+      frame[0] = (uint8_t) (tx_buffer[index] >> 8);
+      frame[1] = (uint8_t) tx_buffer[index];
+      LcdReceive(frame, sizeof(frame));
+   }
+   if (SetCS1 != NULL) {
+      SetCS1(HIGH);
+   }
+   if (TransferCallback1 != NULL) {
+      TransferCallback1();
+   }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+uint8_t SpiInit(spiConfig_t spi) {
+   if (spi.port != SPI_1) {
+      return ERROR_SPI;
+   }
+   spi_stats.inits++;
+   SetCS1 = spi.SetCS;
+   return SUCCESS_SPI;
+}
+
+void SpiRead(spiPort_t port, uint8_t * rx_buffer, uint32_t rx_buffer_size) {
+   if (port == SPI_1) {
+      Spi1Transfer(NULL, rx_buffer, rx_buffer_size);
+   }
+}
+
+void SpiWrite(spiPort_t port, uint8_t * tx_buffer, uint32_t tx_buffer_size) {
+   if (port == SPI_1) {
+      Spi1Transfer(tx_buffer, NULL, tx_buffer_size);
+   }
+}
+
+void SpiWrite16(spiPort_t port, uint16_t * tx_buffer, uint32_t tx_buffer_count) {
+   if (port == SPI_1) {
+      Spi1Transfer16(tx_buffer, tx_buffer_count);
+   }
+}
+
+void SpiReadWrite(spiPort_t port, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size) {
+   if (port == SPI_1) {
+      Spi1Transfer(tx_buffer, rx_buffer, buffer_size);
+   }
+}
+
+uint8_t SpiFree(spiPort_t port) {
+   (void) port;
+   return TRUE;
+}
+
+void SpiSetTransferCallback(spiPort_t port, void (* callback) (void)) {
+   if (port == SPI_1) {
+      TransferCallback1 = callback;
+   }
+}
+
+uint8_t SpiDeInit(spiPort_t port) {
+   return (port == SPI_1) ? SUCCESS_SPI : ERROR_SPI;
+}
+
+uint16_t HostDisplayGetPixel(uint16_t column, uint16_t page) {
+   if ((column >= LCD_COLUMNS) || (page >= LCD_PAGES)) {
+      return 0;
+   }
+   return lcd_gram[page][column];
+}
+
+uint16_t HostDisplayGetScreenPixel(uint16_t column, uint16_t row) {
+   if ((column >= LCD_COLUMNS) || (row >= LCD_PAGES)) {
+      return 0;
+   }
+   return lcd_gram[LcdScreenPage(row)][column];
+}
+
+bool HostDisplaySave(const char * file) {
+   FILE * output;
+   uint16_t x, y, color;
+   uint8_t rgb[3];
+   bool result = true;
+
+   output = fopen(file, "wb");
+   if (output == NULL) {
+      return false;
+   }
+
+   /* El panel tiene las columnas de la memoria invertidas, por eso la
+      orientación por defecto usa MX = 1, y muestra las filas desplazadas */
+   fprintf(output, "P6\n%d %d\n255\n", LCD_COLUMNS, LCD_PAGES);
+   for (y = 0; y < LCD_PAGES; y++) {
+      for (x = 0; x < LCD_COLUMNS; x++) {
+         color = lcd_gram[LcdScreenPage(y)][LCD_COLUMNS - 1 - x];
+         rgb[0] = ((color >> 11) & 0x1F) * 255 / 31;
+         rgb[1] = ((color >> 5) & 0x3F) * 255 / 63;
+         rgb[2] = (color & 0x1F) * 255 / 31;
+         if (fwrite(rgb, sizeof(rgb), 1, output) != 1) {
+            result = false;
+         }
+      }
+   }
+   if (fclose(output) != 0) {
+      result = false;
+   }
+   return result;
+}
+
+void HostSpiGetStats(host_spi_stats_t * stats) {
+   *stats = spi_stats;
+}
+
+void HostSpiResetStats(void) {
+   memset(&spi_stats, 0, sizeof(spi_stats));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
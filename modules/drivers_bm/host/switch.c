@@ -0,0 +1,148 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Teclas de la EDU-CIAA simuladas
+ **
+ ** Reemplaza a src/switch.c cuando se compila con PLATFORM=host. Un hilo
+ ** auxiliar, que se inicia al arrancar el programa porque varios proyectos
+ ** leen las teclas sin llamar a Init_Switches, lee la entrada estandar: las
+ ** teclas 1 a 4 pulsan TECLA1 a TECLA4 durante HOST_KEY_PRESS_MS y el resto
+ ** de los caracteres se entregan a la recepción de la USB-UART.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#define _GNU_SOURCE
+
+#include "switch.h"
+#include "uart.h"
+#include "host_board.h"
+#include <time.h>
+#include <unistd.h>
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Cantidad de teclas de la placa */
+#define SWITCHES_COUNT      4
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Tiempo monotonico actual en milisegundos */
+static uint64_t CurrentMs(void);
+
+/** @brief Hilo que lee la entrada estandar */
+static void * KeyboardThread(void * arg);
+
+/** @brief Inicia el hilo de lectura del teclado antes de main */
+static void KeyboardStart(void) __attribute__((constructor));
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Teclas mantenidas pulsadas con HostSwitchesSet */
+static volatile uint8_t switches_held;
+
+/** @brief Instante en el que se libera cada tecla pulsada con HostSwitchesPress */
+static volatile uint64_t switches_release[SWITCHES_COUNT];
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static uint64_t CurrentMs(void) {
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (uint64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static void * KeyboardThread(void * arg) {
+   uint8_t data;
+
+   (void) arg;
+   while (read(STDIN_FILENO, &data, 1) == 1) {
+      if ((data >= '1') && (data < '1' + SWITCHES_COUNT)) {
+         HostSwitchesPress(1 << (data - '1'), HOST_KEY_PRESS_MS);
+      } else {
+         HostUartReceive(USB_UART, data);
+      }
+   }
+   return NULL;
+}
+
+static void KeyboardStart(void) {
+   HostStartThread(KeyboardThread, NULL);
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+uint8_t Init_Switches(void) {
+   return TRUE;
+}
+
+uint8_t Read_Switches(void) {
+   uint8_t switchPressed = switches_held;
+   uint64_t now = CurrentMs();
+   int index;
+
+   for (index = 0; index < SWITCHES_COUNT; index++) {
+      if (now < switches_release[index]) {
+         switchPressed |= (1 << index);
+      }
+   }
+   return switchPressed;
+}
+
+void HostSwitchesSet(uint8_t keys) {
+   switches_held = keys;
+}
+
+void HostSwitchesPress(uint8_t keys, uint32_t msec) {
+   uint64_t release = CurrentMs() + msec;
+   int index;
+
+   for (index = 0; index < SWITCHES_COUNT; index++) {
+      if (keys & (1 << index)) {
+         switches_release[index] = release;
+      }
+   }
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,171 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief UART de la EDU-CIAA simuladas
+ **
+ ** Reemplaza a src/uart.c cuando se compila con PLATFORM=host. La USB-UART
+ ** transmite por la salida estandar del proceso, y la RS232 y la RS485 por la
+ ** salida de errores. La recepción de la USB-UART se alimenta desde el teclado
+ ** de la PC, ver switch.c.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "uart.h"
+
+/* === Definicion y Macros ===================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Envia una cadena terminada en cero por una UART */
+static void SendString(LPC_USART_T * uart, uint8_t * msg);
+
+/** @brief Lee un byte recibido por una UART si hay alguno disponible */
+static uint8_t ReadByte(LPC_USART_T * uart, uint8_t * dat);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void SendString(LPC_USART_T * uart, uint8_t * msg) {
+   while (*msg != 0) {
+      Chip_UART_SendByte(uart, *msg);
+      msg++;
+   }
+}
+
+static uint8_t ReadByte(LPC_USART_T * uart, uint8_t * dat) {
+   if (Chip_UART_ReadLineStatus(uart) & UART_LSR_RDR) {
+      *dat = Chip_UART_ReadByte(uart);
+      return TRUE;
+   }
+   return FALSE;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+uint32_t Init_Uart_Ftdi(void) {
+   return TRUE;
+}
+
+uint32_t Init_Uart_Rs485(void) {
+   return TRUE;
+}
+
+uint32_t Init_Uart_Rs232(void) {
+   return TRUE;
+}
+
+uint32_t ReadStatus_Uart_Rs232(void) {
+   return Chip_UART_ReadLineStatus(RS232_UART) & UART_LSR_THRE;
+}
+
+uint32_t ReadStatus_Uart_Ftdi(void) {
+   return Chip_UART_ReadLineStatus(USB_UART) & UART_LSR_THRE;
+}
+
+uint32_t ReadRxReady_Uart_Ftdi(void) {
+   return Chip_UART_ReadLineStatus(USB_UART) & UART_LSR_RDR;
+}
+
+uint32_t ReadRxReady_Uart_Rs232(void) {
+   return Chip_UART_ReadLineStatus(RS232_UART) & UART_LSR_RDR;
+}
+
+uint8_t ReadByte_Uart_Ftdi(uint8_t * dat) {
+   return ReadByte(USB_UART, dat);
+}
+
+uint8_t ReadByte_Uart_Rs232(uint8_t * dat) {
+   return ReadByte(RS232_UART, dat);
+}
+
+void SendString_Uart_Ftdi(uint8_t * msg) {
+   SendString(USB_UART, msg);
+}
+
+void SendByte_Uart_Ftdi(uint8_t * dat) {
+   Chip_UART_SendByte(USB_UART, *dat);
+}
+
+void SendByte_Uart_Rs232(uint8_t * dat) {
+   Chip_UART_SendByte(RS232_UART, *dat);
+}
+
+void SendString_Uart_Rs232(uint8_t * msg) {
+   SendString(RS232_UART, msg);
+}
+
+void IntToString(int16_t value, uint8_t * pBuf, uint32_t len, uint32_t base) {
+   static const char * pAscii = "0123456789abcdefghijklmnopqrstuvwxyz";
+   int pos = 0;
+   int tmpValue = value;
+
+   /* Mismas validaciones y resultado que la versión de src/uart.c */
+   if ((pBuf == NULL) || (len < 2) || (base < 2) || (base > 36)) {
+      return;
+   }
+
+   if (value < 0) {
+      tmpValue = -tmpValue;
+      value = -value;
+      pBuf[pos++] = '-';
+   }
+
+   do {
+      pos++;
+      tmpValue /= base;
+   } while (tmpValue > 0);
+
+   if (pos > len) {
+      return;
+   }
+
+   pBuf[pos] = '\0';
+   do {
+      pBuf[--pos] = pAscii[value % base];
+      value /= base;
+   } while (value > 0);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
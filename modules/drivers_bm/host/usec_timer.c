@@ -0,0 +1,159 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Contador de microsegundos simulado
+ **
+ ** Reemplaza a src/usec_timer.c cuando se compila con PLATFORM=host. El
+ ** contador cuenta microsegundos del reloj monotonico del sistema, truncados
+ ** a 32 bits igual que el TIMER1. La comparación la vigila un hilo auxiliar
+ ** que duerme hasta el instante programado y genera la interrupción simulada.
+ **
+ ** Programar la comparación puede ocurrir dentro de una interrupción, que en
+ ** la PC es un manejador de señal, por eso el instante se publica con una
+ ** operación atomica y el hilo se despierta escribiendo en un eventfd, que
+ ** son seguras en ese contexto.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup host Plataforma host
+ ** @brief Ejecución de los proyectos como proceso nativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#define _GNU_SOURCE
+
+#include "usec_timer.h"
+#include <poll.h>
+#include <stdbool.h>
+#include <sys/eventfd.h>
+#include <sys/prctl.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Marca de comparación programada, el instante ocupa los 32 bits bajos */
+#define ARMED               (1ULL << 32)
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/** @brief Hilo que genera la interrupción al llegar el instante programado */
+static void * Watch(void * arg);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/** @brief Comparación programada, cero si no hay ninguna */
+static uint64_t programmed;
+
+/** @brief Descriptor usado para despertar al hilo cuando cambia la comparación */
+static int wakeup = -1;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void * Watch(void * arg) {
+   struct pollfd event = {.fd = wakeup, .events = POLLIN};
+   struct timespec timeout;
+   uint64_t value, discard;
+   int32_t remaining;
+
+   /* Sin esto el kernel puede demorar el despertar hasta 50 us */
+   prctl(PR_SET_TIMERSLACK, 1UL);
+
+   while (true) {
+      value = __atomic_load_n(&programmed, __ATOMIC_ACQUIRE);
+      if (value & ARMED) {
+         remaining = (int32_t) ((uint32_t) value - Read_Usec_Timer());
+         if (remaining <= 0) {
+            /* Si la comparación cambio mientras tanto se vuelve a evaluar */
+            if (__atomic_compare_exchange_n(&programmed, &value, 0, false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_ACQUIRE)) {
+               NVIC_SetPendingIRQ(USEC_TIMER_IRQn);
+            }
+            continue;
+         }
+         timeout.tv_sec = remaining / 1000000;
+         timeout.tv_nsec = (remaining % 1000000) * 1000;
+         ppoll(&event, 1, &timeout, NULL);
+      } else {
+         ppoll(&event, 1, NULL, NULL);
+      }
+      if (event.revents & POLLIN) {
+         if (read(wakeup, &discard, sizeof(discard)) < 0) {
+            continue;
+         }
+      }
+   }
+   return NULL;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void Init_Usec_Timer(uint32_t priority) {
+   __atomic_store_n(&programmed, 0, __ATOMIC_RELEASE);
+   if (wakeup < 0) {
+      wakeup = eventfd(0, EFD_NONBLOCK);
+      HostStartThread(Watch, NULL);
+   }
+   NVIC_SetPriority(USEC_TIMER_IRQn, priority);
+   NVIC_EnableIRQ(USEC_TIMER_IRQn);
+}
+
+uint32_t Read_Usec_Timer(void) {
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (uint32_t) ((uint64_t) now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+void Set_Usec_Timer_Match(uint32_t when) {
+   uint64_t signal = 1;
+
+   __atomic_store_n(&programmed, ARMED | when, __ATOMIC_RELEASE);
+   if (write(wakeup, &signal, sizeof(signal)) < 0) {
+      /* El contador del eventfd ya tiene un aviso pendiente */
+   }
+}
+
+void Clear_Usec_Timer_Match(void) {
+   /* El hilo puede despertarse por la comparación anterior, la encuentra
+    * cancelada y vuelve a dormir */
+   __atomic_store_n(&programmed, 0, __ATOMIC_RELEASE);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
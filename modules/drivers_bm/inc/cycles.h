@@ -0,0 +1,98 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CYCLES_H
+#define CYCLES_H
+
+/** @brief Contador de ciclos del procesador
+ **
+ ** En la EDU-CIAA usa el contador CYCCNT de la unidad DWT del Cortex-M4, que
+ ** se incrementa una vez por ciclo de reloj y se lee en una sola instrucción.
+ ** Al compilar con PLATFORM=host el contador se obtiene de clock_gettime y
+ ** cuenta nanosegundos, por eso los resultados siempre deben convertirse con
+ ** la frecuencia que informa Cycles_Frequency.
+ **
+ ** El contador es de 32 bits, a 204 MHz da la vuelta cada 21 segundos. Las
+ ** diferencias entre dos lecturas calculadas como uint32_t son correctas
+ ** mientras el intervalo sea menor que ese periodo.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup drivers_bm Controladores
+ ** @brief Controladores de la EDU-CIAA sin sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include <stdint.h>
+#include "chip.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Habilita el contador de ciclos y lo pone en cero
+ **
+ ** @return TRUE si el procesador dispone del contador
+ */
+uint8_t Init_Cycles(void);
+
+/** @brief Frecuencia a la que se incrementa el contador, en Hz */
+uint32_t Cycles_Frequency(void);
+
+#ifdef PLATFORM_HOST
+/** @brief Valor actual del contador */
+uint32_t Read_Cycles(void);
+#else
+/** @brief Valor actual del contador */
+static inline uint32_t Read_Cycles(void) {
+   return DWT->CYCCNT;
+}
+#endif
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* CYCLES_H */
@@ -5,6 +5,8 @@
  *  - 7 x 10 pixels
  *  - 11 x 18 pixels
  *  - 16 x 26 pixels
+ *  - Anti-aliased sans serif, 18 pixels per em, printable ASCII
+ *  - Anti-aliased bold digits, 64 pixels per em, for large numeric displays
  *
  * @author Albano Peñalva
  *
@@ -13,6 +15,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 21/11/2018 | Document creation		                         |
+ * | 17/10/2026 | Compressed anti-aliased fonts of any width     |
  *
  */
 
@@ -50,6 +53,61 @@ extern Font_t font_11x18;
  */
 extern Font_t font_16x26;
 
-extern Font_t font_42x35;
+/**
+ * @brief  Character of an anti-aliased font
+ *
+ * Each character takes a cell of advance columns by the height of the font. Only the box
+ * of the cell with ink is stored, its pixels row after row as a coverage from 0, background,
+ * to 2^bpp - 1, foreground. The coverages are coded in bytes:
+ *
+ * | Code		| Pixels									|
+ * |:----------:|:------------------------------------------|
+ * | 00nnnnnn	| n + 1 pixels of background				|
+ * | 01nnnnnn	| n + 1 pixels of foreground				|
+ * | 1nnncccc	| n + 1 pixels of coverage c				|
+ *
+ * Small characters have few runs, they are stored instead as packed bpp bits per pixel, the
+ * first pixel in the high bits of each byte.
+ */
+typedef struct
+{
+	uint16_t offset;		/*!< Offset of the character data in the font data */
+	uint8_t width;			/*!< Width of the box with ink, 0 for a character without pixels */
+	uint8_t height;			/*!< Height of the box with ink */
+	uint8_t x;				/*!< Column of the box inside the cell */
+	uint8_t y;				/*!< Row of the box inside the cell */
+	uint8_t advance;		/*!< Width of the cell, 0 for a character missing in the font */
+	uint8_t packed;			/*!< 1 when the data are packed coverages instead of codes */
+} Glyph_t;
+
+/**
+ * @brief  Anti-aliased font, made from a TTF or BDF font with scripts/font/font2c.py
+ */
+typedef struct
+{
+	uint8_t bpp;			/*!< Bits of coverage per pixel: 1, 2 or 4 */
+	uint8_t height;			/*!< Height of the characters cells in pixels */
+	uint8_t first;			/*!< First character of the font */
+	uint8_t count;			/*!< Number of characters from the first one */
+	const Glyph_t *glyphs;	/*!< Pointer to the characters */
+	const uint8_t *data;	/*!< Pointer to the characters data */
+	uint32_t size;			/*!< Bytes of data */
+} FontAA_t;
+
+/**
+ * @brief  Sans serif font, Lato Regular with 18 pixels per em and 2 bits per pixel
+ *
+ * font2c.py Lato-Regular.ttf -s 18 -b 2 -n font_sans_18 -o font_sans_18.c
+ */
+extern const FontAA_t font_sans_18;
+
+/**
+ * @brief  Digits, sign, point, percent and colon, Source Code Pro Bold with 64 pixels
+ * 		   per em and 4 bits per pixel
+ *
+ * font2c.py SourceCodePro-Bold.ttf -s 64 -b 4 -c " %+-.0123456789:" -n font_digits_64
+ * -o font_digits_64.c
+ */
+extern const FontAA_t font_digits_64;
 
 #endif /* FONTS_H_ */
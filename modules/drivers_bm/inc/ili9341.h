@@ -44,6 +44,69 @@
 #define ILI9341_HEIGHT      320			/*!< LCD height in pixels */
 #define ILI9341_PIXEL_MAX	76800
 
+/**
+ * @brief  SPI session mode. When 1 the SPI port is configured once in ILI9341Init and
+ * 		   every drawing function streams its commands and data through a single chip
+ * 		   select cycle, changing the DC line only when it has to. When 0 the port is
+ * 		   configured again for every command (previous behaviour, kept for comparison).
+ */
+#ifndef ILI9341_SPI_SESSION
+#define ILI9341_SPI_SESSION	1
+#endif
+
+/**
+ * @brief  Rasterizer mode. When 1 lines and circles are converted to horizontal or vertical
+ * 		   runs of pixels and each run is sent in one address window. When 0 they are drawn
+ * 		   pixel by pixel (previous behaviour, kept for comparison).
+ */
+#ifndef ILI9341_SPANS
+#define ILI9341_SPANS		1
+#endif
+
+/**
+ * @brief  Pixel frames mode. When 1 the pixels are kept in memory as native uint16_t colors
+ * 		   and sent in 16 bits SPI frames, one DMA transfer per pixel. When 0 they are kept
+ * 		   high byte first and sent in 8 bits frames (previous behaviour, kept for comparison).
+ * 		   Commands and parameters are always sent in 8 bits frames.
+ */
+#ifndef ILI9341_SPI_16BIT
+#define ILI9341_SPI_16BIT	1
+#endif
+
+/**
+ * @brief  Frequency of SCK. The SSP1 clock of the EDU-CIAA is 204 MHz and its smallest
+ * 		   divider is 2, the SSP rounds the frequency down to 204 MHz / 2 / n.
+ */
+#ifndef ILI9341_SPI_BITRATE
+#define ILI9341_SPI_BITRATE	51000000
+#endif
+
+/**
+ * @brief  Color as stored in the pixel buffers given to ILI9341WritePixels. Applied twice it
+ * 		   gives the original color back
+ */
+#if (ILI9341_SPI_16BIT == 1)
+#define ILI9341_PIXEL(color)	((uint16_t) (color))
+#else
+#define ILI9341_PIXEL(color)	((uint16_t) (((color) >> 8) | ((color) << 8)))
+#endif
+
+/**
+ * @brief  Number of glyphs indexed by the glyph cache, must be a power of 2. With 128 the
+ *         printable characters of a font and colors never replace each other in the index
+ */
+#ifndef ILI9341_GLYPH_CACHE_ENTRIES
+#define ILI9341_GLYPH_CACHE_ENTRIES	128
+#endif
+
+/**
+ * @brief  Number of images whose decoding position is remembered between bands, so each band
+ * 		   continues the images of the previous one instead of decoding them again from the start
+ */
+#ifndef ILI9341_IMAGE_DECODERS
+#define ILI9341_IMAGE_DECODERS		4
+#endif
+
 /* Colors */							/*	 R,   G,   B */
 #define ILI9341_BLACK          	0x0000  /*   0,   0,   0 */
 #define ILI9341_NAVY           	0x000F 	/*   0,   0, 128 */
@@ -80,6 +143,51 @@ typedef enum
 	ILI9341_Landscape_2  	/*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
 
+/**
+ * @brief  Glyph cache statistics
+ */
+typedef struct
+{
+	uint32_t hits;			/*!< Glyphs found in the cache */
+	uint32_t misses;		/*!< Glyphs expanded from the font */
+	uint32_t evictions;		/*!< Glyphs discarded to make room for others */
+	uint32_t glyphs;		/*!< Glyphs stored */
+	uint32_t used;			/*!< Bytes used by the stored glyphs */
+	uint32_t size;			/*!< Bytes available for glyphs */
+} ili9341_glyph_stats_t;
+
+/**
+ * @brief  Function that draws a frame, called by ILI9341BandRender once for every band
+ */
+typedef void (*ili9341_band_draw_t)(void * context);
+
+/**
+ * @brief  Compressed image, made from a PNG with scripts/image/png2image.py
+ *
+ * The RGB565 pixels, row after row, are coded as a sequence of operations. Each one gives the
+ * next pixel from the previous color, which starts as 0x0000, or from an index of 64 colors,
+ * all 0x0000 at the start, where every color given by a DIFF, LUMA or COLOR operation is
+ * stored at (r * 3 + g * 5 + b * 7) % 64:
+ *
+ * | Operation	| Bytes					| Pixels										|
+ * |:----------:|:----------------------|:----------------------------------------------|
+ * | INDEX		| 00iiiiii				| Color at position i of the index				|
+ * | DIFF		| 01rrggbb				| Previous color plus rr - 2, gg - 2, bb - 2	|
+ * | LUMA		| 10gggggg rrrrbbbb		| Previous green plus dg = gggggg - 32, red and	|
+ * | 			| 						| blue plus dg / 2 + rrrr - 8, dg / 2 + bbbb - 8|
+ * | RUN		| 11nnnnnn				| Previous color n + 1 times, n up to 61		|
+ * | COLOR		| 0xFE hhhhhhhh llllllll| Color given high byte first					|
+ *
+ * The components wrap around, dg / 2 is ((dg + 32) >> 1) - 16.
+ */
+typedef struct
+{
+	uint16_t width;						/*!< Image width in pixels */
+	uint16_t height;					/*!< Image height in pixels */
+	uint32_t size;						/*!< Bytes of data */
+	const uint8_t * data;				/*!< Operations */
+} ili9341_image_t;
+
 /*****************************************************************************
  * Public functions definitions
  ****************************************************************************/
@@ -117,6 +225,34 @@ void ILI9341Fill(uint16_t color);
  */
 void ILI9341Rotate(ili9341_orientation_t orientation);
 
+/**
+ * @brief  		Defines the vertical scrolling area of the LCD
+ *
+ * The rows above and below the area stay fixed. Only ILI9341_Portrait_1 is supported, the
+ * LCD scrolls along the rows of the frame memory and the other orientations turn them
+ * upside down or into columns. The drawings still go to the frame memory, what scrolls is
+ * only the way it is shown, see ILI9341SetScrollStart.
+ *
+ * @param[in]  	top: Rows of the fixed area at the top of the LCD
+ * @param[in]  	height: Rows of the scrolling area, top + height up to ILI9341_HEIGHT
+ * @retval 		SUCCESS or ERROR if the orientation is not ILI9341_Portrait_1 or the area does
+ * 				not fit
+ */
+uint8_t ILI9341SetScrollArea(uint16_t top, uint16_t height);
+
+/**
+ * @brief  		Sets the row of the frame memory shown at the top of the scrolling area
+ *
+ * The following rows of the area are shown below it, wrapping around to the first row of
+ * the area, e.g. with an area from row 40 to 279 and start 100 the LCD shows rows 100 to
+ * 279 and then rows 40 to 99. Use ILI9341SetScrollStart(0) with the area of the whole LCD
+ * to go back to the normal display.
+ *
+ * @param[in]  	row: Row of the frame memory, inside the scrolling area
+ * @retval 		None
+ */
+void ILI9341SetScrollStart(uint16_t row);
+
 /**
  * @brief  		Draw a single character on the LCD
  * @param[in]  	x: X position of top left corner
@@ -151,6 +287,35 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
  */
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height);
 
+/**
+ * @brief  		Draw a text with an anti-aliased font on the LCD
+ *
+ * Each character is decoded while it is drawn and its coverages are mixed from the background
+ * to the foreground color. Inside a band only the rows of each character in the band are
+ * decoded, straight into the band memory. Outside a band each character cell is sent in one
+ * address window, several rows per transfer.
+ *
+ * @param[in] 	x: X position of top left corner of first character in text
+ * @param[in]  	y: Y position of top left corner of first character in text
+ * @param[in]  	str: Pointer to first character, a line feed goes on below x
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for text
+ * @param[in]  	background: Color for text background
+ * @retval 		None
+ */
+void ILI9341DrawText(uint16_t x, uint16_t y, const char * str, const FontAA_t * font, uint16_t foreground,
+	uint16_t background);
+
+/**
+ * @brief  		Gets width and height of box with text drawn with an anti-aliased font
+ * @param[in]  	str: Pointer to first character
+ * @param[in] 	font: Pointer to used font
+ * @param[out]	width: Pointer to variable to store the width of the widest line
+ * @param[out]	height: Pointer to variable to store height
+ * @retval 		None
+ */
+void ILI9341GetTextSize(const char * str, const FontAA_t * font, uint16_t * width, uint16_t * height);
+
 /**
  * @brief  		Draws line on the LCD
  * @param[in]  	x0: X coordinate of starting point
@@ -210,11 +375,163 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
  * @param[in]  	y: Y position of top left corner of picture
  * @param[in] 	width: Picture width in pixels
  * @param[in]  	height: Picture height in pixels
- * @param[in]  	pic: Pointer to first byte of picture
+ * @param[in]  	pic: Pointer to first byte of picture, RGB565 pixels with the high byte first.
+ * 				They are sent from this memory, which must be accessible by the DMA
  * @retval 		None
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t hieght, const uint8_t* pic);
 
+/**
+ * @brief  		Draw a compressed image on the LCD, clipped to the LCD
+ *
+ * The image is decoded while it is sent. Inside a band only its rows in the band are decoded,
+ * straight into the band memory, and the next band continues from there. Outside a band it is
+ * decoded into the band memories when the band buffer has memory, several rows per transfer,
+ * or into two small buffers otherwise.
+ *
+ * @param[in] 	x: X position of top left corner of image
+ * @param[in]  	y: Y position of top left corner of image
+ * @param[in]  	image: Pointer to the image
+ * @retval 		None
+ */
+void ILI9341DrawImage(uint16_t x, uint16_t y, const ili9341_image_t * image);
+
+/**
+ * @brief  		Draw a compressed image leaving the pixels of a color unchanged
+ *
+ * Inside a band the transparent pixels keep what was drawn below. Outside a band each run
+ * of other pixels in a row is sent in its own address window.
+ *
+ * @param[in] 	x: X position of top left corner of image
+ * @param[in]  	y: Y position of top left corner of image
+ * @param[in]  	image: Pointer to the image
+ * @param[in]  	transparent: Color of the pixels that are not drawn
+ * @retval 		None
+ */
+void ILI9341DrawSprite(uint16_t x, uint16_t y, const ili9341_image_t * image, uint16_t transparent);
+
+/**
+ * @brief  		Starts a group of drawings sent in a single chip select cycle
+ *
+ * Calls can be nested, the LCD is deselected by the last ILI9341EndDrawing. Inside a group
+ * ILI9341WritePixels returns as soon as the transfer of the pixels starts.
+ *
+ * @retval 		None
+ */
+void ILI9341BeginDrawing(void);
+
+/**
+ * @brief  		Ends a group of drawings, the last call waits until all the bytes are sent
+ * @retval 		None
+ */
+void ILI9341EndDrawing(void);
+
+/**
+ * @brief  		Sends a block of pixels to a window of the LCD
+ *
+ * The pixels are sent from the given buffer without copying them. Inside a group of drawings
+ * the function returns once the transfer starts, so the buffer must not change until SpiFree
+ * returns 1 or the SPI transfer callback is called.
+ *
+ * @param[in]  	x0: X coordinate of top left point
+ * @param[in]  	y0: Y coordinate of top left point
+ * @param[in]  	x1: X coordinate of bottom right point
+ * @param[in]  	y1: Y coordinate of bottom right point
+ * @param[in]  	pixels: RGB565 pixels converted with ILI9341_PIXEL, row after row, 2 bytes
+ * 				aligned. Up to 32760 pixels per call
+ * @retval 		None
+ */
+void ILI9341WritePixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t * pixels);
+
+/**
+ * @brief  		Gives memory to the band buffer
+ *
+ * A band is a group of whole rows of the LCD composed in memory and sent with one address
+ * window and one transfer, so several overlapping drawings cost a single write of each pixel
+ * and a frame takes a few large transfers instead of many small ones:
+ *
+ *     for (y = 40; y < 280; y += lines)
+ *     {
+ *         lines = ILI9341BandBegin(y, 279, ILI9341_WHITE);
+ *         ILI9341DrawFilledCircle(120, 160, 100, ILI9341_NAVY);
+ *         ILI9341DrawString(56, 190, "12:34:56", &font_16x26, ILI9341_WHITE, ILI9341_NAVY);
+ *         ILI9341BandEnd();
+ *     }
+ *
+ * All the drawing functions compose in the open band, only ILI9341WritePixels,
+ * ILI9341Rotate and the scroll functions go to the LCD. The band takes as many rows as fit in one memory, e.g. 16 rows
+ * of 320 pixels with 10240 bytes. With a second memory, e.g. one in RamAHB32 and the other in
+ * RamAHB16, a band is composed while the DMA sends the previous one. The memories must be
+ * accessible by the DMA.
+ *
+ * @param[in]  	memory: Memory for the band, 4 bytes aligned, NULL to disable the band
+ * @param[in]  	second: Memory for a second band of the same size, NULL to use only one
+ * @param[in]  	size: Size of each memory in bytes
+ * @retval 		1 when success, 0 when the memory can't hold a row of ILI9341_HEIGHT pixels
+ */
+uint8_t ILI9341BandInit(uint8_t * memory, uint8_t * second, uint32_t size);
+
+/**
+ * @brief  		Opens a band, the next drawings are composed in memory
+ * @param[in]  	y0: First row of the band
+ * @param[in]  	y1: Last row to compose, the band ends before if the memory is smaller
+ * @param[in]  	background: Color of the band before the drawings
+ * @retval 		Rows of the band, 0 when the band has no memory or y0 is outside the LCD
+ */
+uint16_t ILI9341BandBegin(uint16_t y0, uint16_t y1, uint16_t background);
+
+/**
+ * @brief  		Closes the band and sends it to the LCD
+ *
+ * Inside a group of drawings the function returns once the transfer starts. With one memory
+ * the next ILI9341BandBegin waits until the band is sent, with two it continues in the other.
+ *
+ * @retval 		None
+ */
+void ILI9341BandEnd(void);
+
+/**
+ * @brief  		Draws the rows from y0 to y1 band by band in a single group of drawings
+ * @param[in]  	y0: First row
+ * @param[in]  	y1: Last row
+ * @param[in]  	background: Color of the bands before the drawings
+ * @param[in]  	draw: Function that draws the whole frame, called for every band
+ * @param[in]  	context: Parameter for the draw function
+ * @retval 		None
+ */
+void ILI9341BandRender(uint16_t y0, uint16_t y1, uint16_t background, ili9341_band_draw_t draw, void * context);
+
+/**
+ * @brief  		Gives memory to the glyph cache used by ILI9341DrawString
+ *
+ * Glyphs are stored already expanded to RGB565 for each font, foreground and background, and
+ * the strings are composed in a line buffer and sent with one address window and one transfer.
+ * All the memory comes from the given block, so its RAM bank can be chosen, e.g. with
+ * __attribute__((section(".bss.$RamAHB32"))). The block holds the index of
+ * ILI9341_GLYPH_CACHE_ENTRIES glyphs, the line buffer and the glyphs, older glyphs are
+ * replaced when the rest is full. Strings longer than the line buffer are sent in pieces.
+ *
+ * @param[in]  	memory: Memory for the cache, 4 bytes aligned, NULL to disable the cache
+ * @param[in]  	size: Size of memory in bytes, the budget of the cache
+ * @param[in]  	line_size: Bytes of memory used as line buffer, a string of n characters takes
+ * 				n * FontWidth * FontHeight * 2 bytes
+ * @retval 		1 when success, 0 when the memory can't hold the index and the line buffer
+ */
+uint8_t ILI9341GlyphCacheInit(uint8_t * memory, uint32_t size, uint32_t line_size);
+
+/**
+ * @brief  		Discards all the glyphs and clears the glyph cache statistics
+ * @retval 		None
+ */
+void ILI9341GlyphCacheClear(void);
+
+/**
+ * @brief  		Gets the glyph cache statistics
+ * @param[out]	stats: Pointer to the structure to store the statistics
+ * @retval 		None
+ */
+void ILI9341GlyphCacheGetStats(ili9341_glyph_stats_t * stats);
+
 /**
  * @brief  	De-initializes ILI9341 LCD
  * @param	None
@@ -0,0 +1,140 @@
+/*! @file ili9341_console.h
+ * @brief  Text console with hardware vertical scrolling for the ILI9341 driver
+ *
+ * Log output for the LCD. The console is a grid of character cells over a band of rows of
+ * the screen, the rows above and below it stay fixed. When the grid is full, a new line
+ * takes the row of the oldest one and the LCD scrolling start moves one line down, so the
+ * rest of the lines go up without being sent again.
+ *
+ * The console remembers the characters of every cell on the LCD. A line is compared with the
+ * row it takes and only the runs of cells that differ are drawn, e.g. the digits of a time
+ * stamp that changed. Appending a line costs at most one row of cells, whatever is on the
+ * screen.
+ *
+ * The scrolling uses the rows of the frame memory, so the console needs ILI9341_Portrait_1
+ * and the other drawings must stay out of its rows while it is open.
+ *
+ *     ILI9341ConsoleInit(40, 24, &font_7x10, ILI9341_WHITE, ILI9341_BLACK);
+ *     ILI9341ConsolePrint("adc: 1023\n");
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ */
+
+#ifndef ILI9341_CONSOLE_H_
+#define ILI9341_CONSOLE_H_
+
+#include <stdint.h>
+#include "fonts.h"
+
+/*****************************************************************************
+ * Public macros/types/enumerations/variables definitions
+ ****************************************************************************/
+
+/**
+ * @brief  Maximum number of characters of a console line, longer lines continue in the next
+ *         one. The console uses as many as fit in the width of the LCD
+ */
+#ifndef ILI9341_CONSOLE_COLUMNS
+#define ILI9341_CONSOLE_COLUMNS	34
+#endif
+
+/**
+ * @brief  Maximum number of lines of the console
+ */
+#ifndef ILI9341_CONSOLE_ROWS
+#define ILI9341_CONSOLE_ROWS	32
+#endif
+
+/**
+ * @brief  Console statistics
+ */
+typedef struct
+{
+	uint32_t lines;					/*!< Lines appended */
+	uint32_t scrolls;				/*!< Lines that moved the scrolling start */
+	uint32_t drawn;					/*!< Cells sent to the LCD */
+	uint32_t skipped;				/*!< Cells not sent because the LCD already shows them */
+} ili9341_console_stats_t;
+
+/*****************************************************************************
+ * Public functions definitions
+ ****************************************************************************/
+
+/**
+ * @brief  		Opens a console and clears its rows
+ * @param[in]  	y: Row of the LCD where the console starts
+ * @param[in]  	lines: Lines of the console, up to ILI9341_CONSOLE_ROWS
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for the text, until ILI9341ConsoleColor changes it
+ * @param[in]  	background: Color for the background of the console
+ * @retval 		SUCCESS or ERROR if the lines do not fit in the LCD or the orientation is not
+ * 				ILI9341_Portrait_1
+ */
+uint8_t ILI9341ConsoleInit(uint16_t y, uint8_t lines, Font_t * font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Closes the console and shows the LCD without scrolling
+ *
+ * The lines stay in the frame memory in the order of the rows they took, the screen should be
+ * drawn again.
+ *
+ * @retval 		None
+ */
+void ILI9341ConsoleEnd(void);
+
+/**
+ * @brief  		Writes text at the end of the console
+ *
+ * The text is kept until a line feed, which appends the line to the console. A carriage
+ * return goes back to the start of the line and the next characters replace the previous
+ * ones. Characters without glyph in the font are shown as spaces.
+ *
+ * @param[in]  	str: Pointer to first character
+ * @retval 		None
+ */
+void ILI9341ConsolePrint(const char * str);
+
+/**
+ * @brief  		Shows the line being written, without waiting for the line feed
+ *
+ * The next characters continue in the same row of the LCD.
+ *
+ * @retval 		None
+ */
+void ILI9341ConsoleFlush(void);
+
+/**
+ * @brief  		Changes the color of the text of the line being written and the next ones
+ * @param[in]  	foreground: Color for the text
+ * @retval 		None
+ */
+void ILI9341ConsoleColor(uint16_t foreground);
+
+/**
+ * @brief  		Erases all the lines of the console
+ *
+ * Only the cells that are not empty are drawn again.
+ *
+ * @retval 		None
+ */
+void ILI9341ConsoleClear(void);
+
+/**
+ * @brief  		Gets the console statistics
+ * @param[out]	stats: Pointer to the structure to store the statistics
+ * @retval 		None
+ */
+void ILI9341ConsoleGetStats(ili9341_console_stats_t * stats);
+
+/**
+ * @brief  		Clears the console statistics
+ * @retval 		None
+ */
+void ILI9341ConsoleClearStats(void);
+
+#endif /* ILI9341_CONSOLE_H_ */
@@ -0,0 +1,132 @@
+/*! @file ili9341_damage.h
+ * @brief  Damage tracking for the ILI9341 driver
+ *
+ * Retained drawing layer over ili9341.c for screens that are redrawn every loop. The
+ * application keeps calling the drawing functions of this layer as before, but they only
+ * record what should be on the screen and the rectangles that differ from what is already
+ * there. Overlapping or touching rectangles are merged and ILI9341DamageFlush sends only the
+ * parts of the items inside them, e.g. the last digit of a clock.
+ *
+ * Items are identified by their position: a string by its top left corner and a filled
+ * rectangle by its corners. Strings must fit in one line of the screen. Items are drawn in
+ * the order they were first recorded, so a rectangle recorded before a string stays below it.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ */
+
+#ifndef ILI9341_DAMAGE_H_
+#define ILI9341_DAMAGE_H_
+
+#include <stdint.h>
+#include "fonts.h"
+
+/*****************************************************************************
+ * Public macros/types/enumerations/variables definitions
+ ****************************************************************************/
+
+/**
+ * @brief  Number of items (strings and filled rectangles) the layer remembers. Items recorded
+ *         when the table is full are drawn directly and counted as overflows
+ */
+#ifndef ILI9341_DAMAGE_ITEMS
+#define ILI9341_DAMAGE_ITEMS	16
+#endif
+
+/**
+ * @brief  Number of dirty rectangles kept between flushes. When a new one does not fit it is
+ *         merged with the rectangle that grows the least
+ */
+#ifndef ILI9341_DAMAGE_RECTS
+#define ILI9341_DAMAGE_RECTS	16
+#endif
+
+/**
+ * @brief  Maximum length of a string item, longer strings are truncated
+ */
+#ifndef ILI9341_DAMAGE_TEXT
+#define ILI9341_DAMAGE_TEXT		24
+#endif
+
+/**
+ * @brief  Damage tracking statistics
+ */
+typedef struct
+{
+	uint32_t flushes;				/*!< Calls to ILI9341DamageFlush */
+	uint32_t rects;					/*!< Dirty rectangles sent */
+	uint32_t merges;				/*!< Dirty rectangles merged into others */
+	uint32_t overflows;				/*!< Items drawn directly because the table was full */
+	uint32_t requested;				/*!< Pixels the drawing calls would have sent */
+	uint32_t pushed;				/*!< Pixels sent to the LCD */
+	uint32_t requested_per_second;	/*!< Pixels requested during the last second */
+	uint32_t pushed_per_second;		/*!< Pixels sent during the last second */
+} ili9341_damage_stats_t;
+
+/*****************************************************************************
+ * Public functions definitions
+ ****************************************************************************/
+
+/**
+ * @brief  		Forgets all the items and the dirty rectangles
+ *
+ * Must be called after drawing on the LCD without this layer, e.g. after ILI9341Fill or
+ * ILI9341Rotate, so the next recorded items are drawn completely.
+ *
+ * @retval 		None
+ */
+void ILI9341DamageReset(void);
+
+/**
+ * @brief  		Records a string on the LCD
+ * @param[in] 	x: X position of top left corner of first character in string
+ * @param[in]  	y: Y position of top left corner of first character in string
+ * @param[in]  	str: Pointer to first character, a line feed ends the string
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for string
+ * @param[in]  	background: Color for string background, also used to erase the characters
+ * 				left when the string gets shorter
+ * @retval 		None
+ */
+void ILI9341DamageString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Records a filled rectangle on the LCD
+ * @param[in]  	x0: X coordinate of top left point
+ * @param[in]  	y0: Y coordinate of top left point
+ * @param[in]  	x1: X coordinate of bottom right point
+ * @param[in]  	y1: Y coordinate of bottom right point
+ * @param[in]  	color: Rectangle color
+ * @retval 		None
+ */
+void ILI9341DamageFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Sends the dirty rectangles to the LCD
+ *
+ * Draws, for every dirty rectangle, the part of each item inside it. The rates of the
+ * statistics are updated here once a second using the cycle counter, so Init_Cycles must
+ * have been called and the flushes must not be more than a counter period apart.
+ *
+ * @retval 		None
+ */
+void ILI9341DamageFlush(void);
+
+/**
+ * @brief  		Gets the damage tracking statistics
+ * @param[out]	stats: Pointer to the structure to store the statistics
+ * @retval 		None
+ */
+void ILI9341DamageGetStats(ili9341_damage_stats_t * stats);
+
+/**
+ * @brief  		Clears the damage tracking statistics
+ * @retval 		None
+ */
+void ILI9341DamageClearStats(void);
+
+#endif /* ILI9341_DAMAGE_H_ */
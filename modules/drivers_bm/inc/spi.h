@@ -11,7 +11,7 @@
  * is the only one implemented in the EDU-CIAA NXP. However, it remains compatible
  * for future upgrades.
  *
- * @note This driver is limited to transfer data only in 8 bits format.
+ * @note This driver transfers data in 8 bits frames, SpiWrite16 writes 16 bits frames.
  *
  * @author Albano Peñalva
  *
@@ -22,6 +22,8 @@
  * | 09/11/2018 | Document creation		                         						|
  * | 17/12/2018 | Added capability to transfer data in Polling, Interrupt and DMA modes |
  * | 20/12/2018 | Added capability to handle CS pin	 			 						|
+ * | 17/10/2026 | Added callback at the end of each transfer							|
+ * | 17/10/2026 | Added 16 bits frames writes, halfword DMA transfers					|
  *
  */
 
@@ -34,6 +36,14 @@
  * Public macros/types/enumerations/variables definitions
  ****************************************************************************/
 
+/**
+ * @brief Priority of the SSP1 and DMA interrupts, numerically not lower than the
+ * configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY of the FreeRTOS projects (5)
+ */
+#ifndef SPI_IRQ_PRIORITY
+#define SPI_IRQ_PRIORITY	5
+#endif
+
 /**
  * @brief SSP ports
  */
@@ -111,10 +121,25 @@ void SpiRead(spiPort_t port, uint8_t * rx_buffer, uint32_t rx_buffer_size);
  * @param[out]	tx_buffer pointer to buffer where data is stored
  * @param[in]	tx_buffer_size numbers of bytes to write
  * @return  	None
- * @note
+ * @note		In DMA mode writes longer than 4095 bytes are sent through linked lists
+ * 				of descriptors of up to 65520 bytes, each one in a single transfer
  */
 void SpiWrite(spiPort_t port, uint8_t * tx_buffer, uint32_t tx_buffer_size);
 
+/**
+ * @brief		Write 16 bits frames to SPI port
+ * @param[in]	port SPI Port to write to
+ * @param[out]	tx_buffer pointer to buffer where data is stored
+ * @param[in]	tx_buffer_count numbers of 16 bits frames to write
+ * @return  	None
+ * @note		Each frame is sent most significant bit first, so a RGB565 pixel is written from its
+ * 				native uint16_t value without swapping the bytes. The port switches to 16 bits
+ * 				frames and stays so until the next SpiRead, SpiWrite or SpiReadWrite. In DMA mode
+ * 				each DMA transfer moves a whole frame, writes of any length are chained in lists of
+ * 				descriptors of up to 65520 frames
+ */
+void SpiWrite16(spiPort_t port, uint16_t * tx_buffer, uint32_t tx_buffer_count);
+
 /**
  * @brief		Write and Read data simultaneous from SPI port
  * @param[in]	port SPI Port to write to
@@ -134,6 +159,19 @@ void SpiReadWrite(spiPort_t port, uint8_t * tx_buffer, uint8_t * rx_buffer, uint
  */
 uint8_t SpiFree(spiPort_t port);
 
+/**
+ * @brief		Set a function to be called each time a transfer ends
+ * @param[in]	port SPI Port
+ * @param[in]	callback Function to call, NULL to call none
+ * @return  	None
+ * @note		In interrupt and DMA modes the function is called from the interrupt handler, once
+ * 				the port is free, so it can wake up a task waiting for the transfer, e.g. with
+ * 				vTaskNotifyGiveFromISR. It may only call FreeRTOS FromISR functions, and only while
+ * 				SPI_IRQ_PRIORITY is numerically not lower than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY.
+ * 				In polling mode it is called before SpiWrite returns
+ */
+void SpiSetTransferCallback(spiPort_t port, void (* callback) (void));
+
 /**
  * @brief		De-Initialize SPI module with the corresponding configuration
  * @param[in]	spi Structure with the module configuration
@@ -0,0 +1,110 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef USEC_TIMER_H
+#define USEC_TIMER_H
+
+/** @brief Contador de microsegundos con una comparación programable
+ **
+ ** En la EDU-CIAA usa el TIMER1 con el preescalador ajustado para que el
+ ** contador avance una vez por microsegundo, y el registro de comparación
+ ** MR0 para generar una interrupción en un instante dado. Al compilar con
+ ** PLATFORM=host el contador se obtiene de clock_gettime y un hilo auxiliar
+ ** genera la interrupción simulada del TIMER1 al llegar el instante.
+ **
+ ** El contador es de 32 bits y da la vuelta cada 71 minutos. Los instantes se
+ ** comparan como diferencias con signo, por lo que una comparación debe
+ ** programarse a menos de 35 minutos de la lectura actual.
+ **
+ ** El controlador no define la rutina de servicio, la define quien lo usa con
+ ** el nombre USEC_TIMER_IRQHandler y debe llamar a Clear_Usec_Timer_Match
+ ** antes de programar la siguiente comparación.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup drivers_bm Controladores
+ ** @brief Controladores de la EDU-CIAA sin sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+#include <stdint.h>
+#include "chip.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Interrupción generada por la comparación */
+#define USEC_TIMER_IRQn           TIMER1_IRQn
+
+/** @brief Nombre de la rutina de servicio de la interrupción */
+#define USEC_TIMER_IRQHandler     TIMER1_IRQHandler
+
+/* == Declaraciones de tipos de datos ========================================================== */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/** @brief Pone en marcha el contador y habilita su interrupción sin ninguna comparación programada
+ **
+ ** @param[in] priority Prioridad de la interrupción en el NVIC
+ */
+void Init_Usec_Timer(uint32_t priority);
+
+/** @brief Valor actual del contador, en microsegundos */
+uint32_t Read_Usec_Timer(void);
+
+/** @brief Programa la interrupción para el instante indicado
+ **
+ ** Si el instante ya paso, o llega mientras se programa, la interrupción
+ ** queda pendiente de inmediato. Reemplaza a la comparación anterior.
+ **
+ ** @param[in] when Valor del contador en el que se genera la interrupción
+ */
+void Set_Usec_Timer_Match(uint32_t when);
+
+/** @brief Cancela la comparación programada y la interrupción pendiente */
+void Clear_Usec_Timer_Match(void);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* USEC_TIMER_H */
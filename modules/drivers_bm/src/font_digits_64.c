@@ -0,0 +1,246 @@
+/* Generado con scripts/font/font2c.py a partir de SourceCodePro-Bold.ttf, no editar */
+/* Fuente original: © 2010 - 2020 Adobe Systems Incorporated (http://www.adobe.com/), with Reserved Font Name ‘Source’. */
+
+#include "fonts.h"
+
+/* 27 caracteres de 43 pixeles de alto con 4 bits por pixel, 3288 bytes en lugar de 8487 */
+static const uint8_t font_digits_64_data[] = {
+	0x06, 0x82, 0x85, 0x98, 0x86, 0x83, 0x1C, 0x85, 0x8C, 0x45, 0x8D, 0x86, 0x18, 0x81, 0x8A, 0x49,
+	0x8C, 0x81, 0x0D, 0x8B, 0x83, 0x05, 0x81, 0x8C, 0x4B, 0x8C, 0x81, 0x0B, 0x89, 0x40, 0x8E, 0x83,
+	0x04, 0x88, 0x4D, 0x8B, 0x0A, 0x86, 0x42, 0x8E, 0x83, 0x02, 0x82, 0x46, 0x8A, 0x89, 0x8E, 0x45,
+	0x86, 0x08, 0x83, 0x44, 0x8E, 0x83, 0x01, 0x89, 0x44, 0x8E, 0x83, 0x01, 0x83, 0x8E, 0x44, 0x8B,
+	0x07, 0x82, 0x8E, 0x45, 0x8E, 0x82, 0x00, 0x8E, 0x44, 0x88, 0x03, 0x86, 0x45, 0x81, 0x05, 0x81,
+	0x8C, 0x46, 0x89, 0x00, 0x83, 0x45, 0x84, 0x03, 0x81, 0x45, 0x85, 0x05, 0x89, 0x46, 0x87, 0x01,
+	0x84, 0x45, 0x05, 0x45, 0x88, 0x04, 0x88, 0x46, 0x86, 0x02, 0x86, 0x45, 0x05, 0x8C, 0x44, 0x88,
+	0x03, 0x85, 0x46, 0x86, 0x03, 0x88, 0x45, 0x05, 0x8B, 0x44, 0x88, 0x02, 0x83, 0x8E, 0x45, 0x86,
+	0x04, 0x84, 0x45, 0x05, 0x45, 0x88, 0x01, 0x81, 0x8C, 0x44, 0x8E, 0x83, 0x05, 0x84, 0x45, 0x83,
+	0x04, 0x45, 0x86, 0x01, 0x8B, 0x44, 0x8E, 0x83, 0x07, 0x45, 0x86, 0x03, 0x83, 0x45, 0x83, 0x00,
+	0x88, 0x44, 0x8E, 0x83, 0x08, 0x8C, 0x44, 0x8B, 0x03, 0x8A, 0x44, 0x8E, 0x01, 0x83, 0x8E, 0x42,
+	0x8C, 0x83, 0x09, 0x86, 0x45, 0x89, 0x82, 0x81, 0x88, 0x45, 0x88, 0x02, 0x82, 0x8C, 0x40, 0x8C,
+	0x81, 0x0B, 0x8D, 0x4D, 0x8E, 0x81, 0x03, 0x81, 0x89, 0x81, 0x0C, 0x83, 0x4D, 0x85, 0x15, 0x86,
+	0x4B, 0x86, 0x17, 0x83, 0x8D, 0x47, 0x8E, 0x85, 0x1A, 0x86, 0x8A, 0x8E, 0x41, 0x8E, 0x8B, 0x86,
+	0x81, 0x06, 0x81, 0x86, 0x88, 0x9B, 0x8A, 0x88, 0x83, 0x1B, 0x88, 0x8E, 0x46, 0x8D, 0x84, 0x17,
+	0x81, 0x8B, 0x4A, 0x86, 0x0E, 0x82, 0x83, 0x05, 0x8C, 0x4C, 0x86, 0x0C, 0x83, 0x9E, 0x83, 0x03,
+	0x88, 0x4E, 0x83, 0x0A, 0x83, 0x8E, 0x41, 0x8E, 0x86, 0x01, 0x81, 0x8E, 0x44, 0x8E, 0x88, 0x85,
+	0x8A, 0x45, 0x8B, 0x09, 0x83, 0x8E, 0x44, 0x82, 0x00, 0x87, 0x45, 0x83, 0x02, 0x88, 0x45, 0x82,
+	0x07, 0x86, 0x45, 0x88, 0x01, 0x8B, 0x44, 0x8A, 0x03, 0x81, 0x45, 0x87, 0x06, 0x86, 0x45, 0x89,
+	0x02, 0x45, 0x88, 0x04, 0x8B, 0x44, 0x89, 0x05, 0x86, 0x45, 0x8C, 0x81, 0x02, 0x45, 0x84, 0x04,
+	0x8B, 0x44, 0x8B, 0x04, 0x88, 0x45, 0x8E, 0x82, 0x02, 0x82, 0x45, 0x84, 0x04, 0x88, 0x44, 0x8B,
+	0x03, 0x89, 0x46, 0x84, 0x03, 0x82, 0x45, 0x84, 0x04, 0x88, 0x44, 0x8B, 0x02, 0x89, 0x46, 0x86,
+	0x05, 0x45, 0x84, 0x04, 0x8B, 0x44, 0x8B, 0x00, 0x81, 0x89, 0x46, 0x89, 0x06, 0x8E, 0x44, 0x88,
+	0x04, 0x8B, 0x44, 0x88, 0x00, 0x89, 0x46, 0x8C, 0x07, 0x8A, 0x44, 0x8A, 0x03, 0x81, 0x45, 0x86,
+	0x00, 0x81, 0x8C, 0x44, 0x8D, 0x81, 0x07, 0x87, 0x45, 0x84, 0x02, 0x89, 0x45, 0x82, 0x01, 0x81,
+	0x8C, 0x42, 0x8E, 0x83, 0x08, 0x81, 0x8E, 0x44, 0x8E, 0x88, 0x84, 0x8A, 0x45, 0x89, 0x03, 0x81,
+	0x8C, 0x41, 0x86, 0x0A, 0x87, 0x4D, 0x8E, 0x82, 0x04, 0x81, 0x8C, 0x88, 0x0C, 0x8A, 0x4C, 0x86,
+	0x06, 0x81, 0x0D, 0x81, 0x8B, 0x4A, 0x86, 0x18, 0x87, 0x8E, 0x46, 0x8D, 0x84, 0x1A, 0x81, 0x86,
+	0x88, 0xAB, 0x88, 0x83, 0x06, 0x0A, 0x81, 0xD4, 0x83, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45,
+	0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45,
+	0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45,
+	0x8B, 0x15, 0x84, 0x45, 0x8B, 0x0A, 0x84, 0xF8, 0x98, 0x89, 0x45, 0x8D, 0xF8, 0xB8, 0x5C, 0x88,
+	0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x82, 0xF4, 0x94, 0x87, 0x45, 0x8C, 0xF4,
+	0xA4, 0x0A, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45,
+	0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45,
+	0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x15, 0x84, 0x45, 0x8B, 0x0A, 0x84, 0xF8,
+	0xF8, 0xF8, 0xD8, 0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x82, 0xF4,
+	0xF4, 0xF4, 0xC4, 0x05, 0x82, 0x94, 0x83, 0x09, 0x86, 0x8D, 0x43, 0x8E, 0x89, 0x81, 0x04, 0x81,
+	0x8A, 0x47, 0x8E, 0x83, 0x03, 0x89, 0x49, 0x8E, 0x82, 0x01, 0x85, 0x4B, 0x8B, 0x01, 0x8B, 0x4C,
+	0x82, 0x00, 0x4D, 0x87, 0x84, 0x4D, 0x88, 0x84, 0x4D, 0x88, 0x82, 0x4D, 0x88, 0x00, 0x8E, 0x4C,
+	0x85, 0x00, 0x88, 0x4B, 0x8E, 0x81, 0x00, 0x81, 0x8E, 0x4A, 0x87, 0x02, 0x84, 0x49, 0x89, 0x04,
+	0x83, 0x8D, 0x46, 0x88, 0x07, 0x85, 0x89, 0x9B, 0x8A, 0x87, 0x82, 0x03, 0x0C, 0x83, 0x84, 0x86,
+	0x88, 0x94, 0x81, 0x15, 0x86, 0x8A, 0x47, 0x8C, 0x88, 0x82, 0x10, 0x85, 0x8D, 0x4C, 0x88, 0x81,
+	0x0C, 0x81, 0x8A, 0x4F, 0x8D, 0x83, 0x0A, 0x81, 0x8C, 0x51, 0x8E, 0x85, 0x08, 0x81, 0x8C, 0x53,
+	0x8E, 0x83, 0x07, 0x88, 0x55, 0x8E, 0x81, 0x05, 0x84, 0x57, 0x89, 0x05, 0x8C, 0x48, 0x88, 0x82,
+	0x02, 0x86, 0x8C, 0x48, 0x84, 0x03, 0x85, 0x47, 0x8E, 0x83, 0x06, 0x89, 0x47, 0x8A, 0x03, 0x8A,
+	0x47, 0x84, 0x08, 0x8C, 0x47, 0x82, 0x01, 0x81, 0x47, 0x89, 0x09, 0x84, 0x47, 0x87, 0x01, 0x86,
+	0x47, 0x83, 0x0A, 0x8C, 0x46, 0x8B, 0x01, 0x88, 0x46, 0x8D, 0x0B, 0x87, 0x47, 0x01, 0x8C, 0x46,
+	0x89, 0x0B, 0x83, 0x47, 0x84, 0x00, 0x47, 0x87, 0x0C, 0x47, 0x86, 0x82, 0x47, 0x84, 0x03, 0x83,
+	0x87, 0x88, 0x85, 0x04, 0x8C, 0x46, 0x88, 0x84, 0x47, 0x83, 0x01, 0x81, 0x8A, 0x43, 0x8E, 0x85,
+	0x02, 0x8B, 0x46, 0x89, 0x84, 0x47, 0x02, 0x8B, 0x46, 0x83, 0x01, 0x8B, 0x46, 0x8B, 0x84, 0x47,
+	0x01, 0x85, 0x47, 0x8A, 0x01, 0x88, 0x46, 0x8B, 0x88, 0x47, 0x01, 0x88, 0x47, 0x8E, 0x01, 0x88,
+	0x46, 0x8B, 0x88, 0x47, 0x01, 0x88, 0x48, 0x01, 0x88, 0x46, 0x8B, 0x88, 0x47, 0x01, 0x88, 0x47,
+	0x8D, 0x01, 0x88, 0x46, 0x8B, 0x84, 0x47, 0x01, 0x83, 0x47, 0x89, 0x01, 0x88, 0x46, 0x8B, 0x84,
+	0x47, 0x02, 0x88, 0x45, 0x8E, 0x81, 0x01, 0x8B, 0x46, 0x8B, 0x84, 0x47, 0x82, 0x02, 0x88, 0x8E,
+	0x42, 0x8B, 0x82, 0x02, 0x8B, 0x46, 0x89, 0x82, 0x47, 0x84, 0x04, 0x94, 0x82, 0x04, 0x8C, 0x46,
+	0x88, 0x00, 0x47, 0x86, 0x0C, 0x47, 0x86, 0x00, 0x8C, 0x46, 0x88, 0x0B, 0x83, 0x47, 0x84, 0x00,
+	0x89, 0x46, 0x8C, 0x0B, 0x87, 0x47, 0x01, 0x86, 0x47, 0x82, 0x0A, 0x8B, 0x46, 0x8B, 0x01, 0x81,
+	0x47, 0x88, 0x09, 0x82, 0x47, 0x87, 0x02, 0x8A, 0x47, 0x82, 0x08, 0x8A, 0x47, 0x82, 0x02, 0x86,
+	0x47, 0x8C, 0x81, 0x06, 0x86, 0x47, 0x8B, 0x04, 0x8D, 0x47, 0x8C, 0x84, 0x03, 0x81, 0x88, 0x48,
+	0x84, 0x04, 0x85, 0x49, 0x8C, 0x98, 0x8A, 0x8E, 0x48, 0x8B, 0x06, 0x8A, 0x55, 0x8E, 0x82, 0x06,
+	0x81, 0x8C, 0x54, 0x86, 0x08, 0x83, 0x8E, 0x52, 0x86, 0x0A, 0x83, 0x8D, 0x50, 0x86, 0x0C, 0x81,
+	0x88, 0x4D, 0x8D, 0x83, 0x0F, 0x84, 0x89, 0x49, 0x8D, 0x86, 0x13, 0x81, 0x85, 0x88, 0xBB, 0x88,
+	0x87, 0x83, 0x0A, 0x0B, 0x82, 0x89, 0xDB, 0x86, 0x12, 0x82, 0x89, 0x47, 0x88, 0x0F, 0x81, 0x86,
+	0x8A, 0x49, 0x88, 0x0B, 0x83, 0x86, 0x88, 0x8C, 0x4C, 0x88, 0x0A, 0x51, 0x88, 0x0A, 0x51, 0x88,
+	0x0A, 0x51, 0x88, 0x0A, 0x51, 0x88, 0x0A, 0x51, 0x88, 0x0A, 0x51, 0x88, 0x13, 0x48, 0x88, 0x13,
+	0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48,
+	0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88,
+	0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13,
+	0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48, 0x88, 0x13, 0x48,
+	0x88, 0x08, 0xF8, 0xA8, 0x48, 0x8B, 0xF8, 0x84, 0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x88,
+	0x5C, 0x88, 0x5C, 0x88, 0x5C, 0x88, 0x0A, 0x83, 0x84, 0x86, 0x98, 0x94, 0x81, 0x13, 0x82, 0x87,
+	0x8B, 0x48, 0x8C, 0x88, 0x82, 0x0E, 0x82, 0x89, 0x4E, 0x8A, 0x82, 0x0B, 0x87, 0x8E, 0x50, 0x8E,
+	0x86, 0x08, 0x81, 0x8B, 0x54, 0x89, 0x06, 0x83, 0x8D, 0x56, 0x86, 0x04, 0x83, 0x8E, 0x58, 0x83,
+	0x03, 0x86, 0x59, 0x8B, 0x04, 0x86, 0x46, 0x8E, 0x88, 0x83, 0x02, 0x82, 0x86, 0x8D, 0x49, 0x83,
+	0x04, 0x86, 0x44, 0x88, 0x81, 0x07, 0x89, 0x48, 0x88, 0x05, 0x86, 0x41, 0x8E, 0x84, 0x0A, 0x8B,
+	0x47, 0x8C, 0x06, 0x86, 0x8C, 0x82, 0x0B, 0x85, 0x48, 0x16, 0x48, 0x16, 0x8C, 0x47, 0x16, 0x8C,
+	0x47, 0x16, 0x48, 0x15, 0x83, 0x47, 0x8B, 0x15, 0x89, 0x47, 0x87, 0x14, 0x82, 0x47, 0x8E, 0x81,
+	0x14, 0x8A, 0x47, 0x88, 0x14, 0x86, 0x47, 0x8E, 0x81, 0x13, 0x83, 0x8E, 0x47, 0x87, 0x13, 0x81,
+	0x8D, 0x47, 0x8B, 0x13, 0x81, 0x8C, 0x47, 0x8E, 0x81, 0x12, 0x81, 0x8C, 0x48, 0x84, 0x12, 0x81,
+	0x8C, 0x48, 0x86, 0x12, 0x81, 0x8C, 0x48, 0x89, 0x12, 0x81, 0x8C, 0x48, 0x89, 0x12, 0x82, 0x8C,
+	0x48, 0x89, 0x12, 0x83, 0x8E, 0x48, 0x89, 0x12, 0x84, 0x8E, 0x48, 0x89, 0x12, 0x86, 0x49, 0x89,
+	0x12, 0x87, 0x49, 0x89, 0x12, 0x89, 0x49, 0x86, 0x11, 0x81, 0x8B, 0x49, 0x8C, 0x88, 0x8A, 0x9B,
+	0x8D, 0x4A, 0x84, 0x00, 0x82, 0x8C, 0x5B, 0x84, 0x82, 0x8E, 0x5C, 0x94, 0x5D, 0x94, 0x5D, 0x94,
+	0x5D, 0x94, 0x5D, 0x94, 0x5D, 0x84, 0x0B, 0x83, 0x84, 0x86, 0x98, 0x94, 0x82, 0x13, 0x82, 0x87,
+	0x8B, 0x48, 0x8E, 0x8A, 0x87, 0x82, 0x0D, 0x84, 0x8A, 0x4F, 0x89, 0x82, 0x09, 0x82, 0x8B, 0x53,
+	0x88, 0x07, 0x88, 0x56, 0x89, 0x05, 0x8B, 0x58, 0x89, 0x04, 0x88, 0x59, 0x84, 0x04, 0x8B, 0x58,
+	0x8C, 0x04, 0x81, 0x8C, 0x44, 0x8E, 0x89, 0x85, 0x81, 0x02, 0x83, 0x88, 0x8E, 0x49, 0x83, 0x04,
+	0x83, 0x8E, 0x42, 0x88, 0x81, 0x07, 0x82, 0x8C, 0x48, 0x87, 0x05, 0x85, 0x40, 0x8C, 0x83, 0x0A,
+	0x84, 0x48, 0x88, 0x06, 0x84, 0x0D, 0x8D, 0x47, 0x8A, 0x15, 0x8B, 0x47, 0x88, 0x15, 0x8E, 0x47,
+	0x87, 0x14, 0x85, 0x48, 0x83, 0x13, 0x83, 0x8E, 0x47, 0x8B, 0x12, 0x81, 0x88, 0x8E, 0x47, 0x8E,
+	0x82, 0x0B, 0x83, 0xA4, 0x86, 0x88, 0x8B, 0x49, 0x8E, 0x83, 0x0C, 0x8B, 0x4E, 0x8D, 0x83, 0x0D,
+	0x8B, 0x4C, 0x8E, 0x88, 0x81, 0x0E, 0x8B, 0x4B, 0x88, 0x81, 0x10, 0x8B, 0x4B, 0x8C, 0x87, 0x81,
+	0x0F, 0x8B, 0x4E, 0x88, 0x81, 0x0D, 0x8B, 0x4F, 0x8E, 0x84, 0x0C, 0x86, 0x98, 0x89, 0x9B, 0x4C,
+	0x86, 0x12, 0x83, 0x87, 0x8D, 0x49, 0x84, 0x14, 0x87, 0x8E, 0x47, 0x8D, 0x15, 0x86, 0x48, 0x86,
+	0x15, 0x8C, 0x47, 0x8A, 0x15, 0x88, 0x47, 0x8D, 0x15, 0x88, 0x48, 0x03, 0x85, 0x88, 0x0F, 0x88,
+	0x48, 0x02, 0x81, 0x8E, 0x40, 0x8C, 0x82, 0x0C, 0x81, 0x8E, 0x47, 0x8D, 0x02, 0x8B, 0x43, 0x88,
+	0x82, 0x09, 0x83, 0x8C, 0x48, 0x8A, 0x01, 0x88, 0x46, 0x89, 0x85, 0x81, 0x03, 0x81, 0x85, 0x89,
+	0x4A, 0x86, 0x00, 0x83, 0x4B, 0x9C, 0x4D, 0x8E, 0x91, 0x8D, 0x5B, 0x85, 0x00, 0x81, 0x8C, 0x5A,
+	0x89, 0x02, 0x81, 0x89, 0x58, 0x89, 0x05, 0x87, 0x8E, 0x54, 0x8E, 0x87, 0x07, 0x81, 0x88, 0x8E,
+	0x51, 0x89, 0x82, 0x0A, 0x81, 0x87, 0x8C, 0x4C, 0x8C, 0x88, 0x82, 0x0F, 0x81, 0x84, 0x98, 0xCB,
+	0x89, 0x88, 0x85, 0x82, 0x09, 0x0F, 0x81, 0x8A, 0xFB, 0x9B, 0x86, 0x14, 0x88, 0x4A, 0x88, 0x13,
+	0x84, 0x4B, 0x88, 0x12, 0x81, 0x8E, 0x4B, 0x88, 0x12, 0x8A, 0x4C, 0x88, 0x11, 0x86, 0x4D, 0x88,
+	0x10, 0x82, 0x8E, 0x4D, 0x88, 0x10, 0x8B, 0x4E, 0x88, 0x0F, 0x87, 0x46, 0x9C, 0x46, 0x88, 0x0E,
+	0x83, 0x47, 0x83, 0x47, 0x88, 0x0E, 0x8C, 0x46, 0x88, 0x00, 0x47, 0x88, 0x0D, 0x88, 0x46, 0x8D,
+	0x81, 0x00, 0x47, 0x88, 0x0C, 0x84, 0x47, 0x84, 0x01, 0x47, 0x88, 0x0B, 0x81, 0x8D, 0x46, 0x88,
+	0x02, 0x47, 0x88, 0x0B, 0x88, 0x46, 0x8E, 0x81, 0x01, 0x82, 0x47, 0x88, 0x0A, 0x85, 0x47, 0x85,
+	0x02, 0x84, 0x47, 0x88, 0x09, 0x81, 0x8E, 0x46, 0x89, 0x03, 0x84, 0x47, 0x88, 0x09, 0x8A, 0x46,
+	0x8D, 0x81, 0x03, 0x84, 0x47, 0x88, 0x08, 0x86, 0x47, 0x84, 0x04, 0x84, 0x47, 0x88, 0x07, 0x82,
+	0x8E, 0x46, 0x88, 0x05, 0x84, 0x47, 0x88, 0x07, 0x8B, 0x46, 0x8C, 0x06, 0x84, 0x47, 0x88, 0x06,
+	0x88, 0x47, 0x83, 0x06, 0x84, 0x47, 0x88, 0x05, 0x83, 0x47, 0x87, 0x07, 0x84, 0x47, 0x88, 0x05,
+	0x8C, 0x46, 0x8B, 0x08, 0x84, 0x47, 0x88, 0x04, 0x88, 0x5F, 0x9B, 0x5F, 0x9B, 0x5F, 0x9B, 0x5F,
+	0x9B, 0x5F, 0x9B, 0x5F, 0x9B, 0x5F, 0x8B, 0x83, 0xF4, 0xF4, 0x94, 0x87, 0x47, 0x89, 0xB4, 0x83,
+	0x12, 0x84, 0x47, 0x88, 0x17, 0x84, 0x47, 0x88, 0x17, 0x84, 0x47, 0x88, 0x17, 0x84, 0x47, 0x88,
+	0x17, 0x84, 0x47, 0x88, 0x17, 0x84, 0x47, 0x88, 0x17, 0x84, 0x47, 0x88, 0x17, 0x84, 0x47, 0x88,
+	0x17, 0x84, 0x47, 0x88, 0x04, 0x03, 0x88, 0xFB, 0xFB, 0xFB, 0x83, 0x04, 0x8B, 0x57, 0x84, 0x04,
+	0x8B, 0x57, 0x84, 0x04, 0x8D, 0x57, 0x84, 0x04, 0x58, 0x84, 0x04, 0x58, 0x84, 0x04, 0x58, 0x84,
+	0x04, 0x58, 0x84, 0x03, 0x83, 0x47, 0x88, 0xF4, 0xF4, 0x81, 0x03, 0x84, 0x47, 0x84, 0x14, 0x84,
+	0x47, 0x84, 0x14, 0x84, 0x47, 0x82, 0x14, 0x84, 0x47, 0x15, 0x88, 0x47, 0x15, 0x88, 0x46, 0x8C,
+	0x15, 0x88, 0x46, 0x8C, 0x86, 0x89, 0x8C, 0x43, 0x8E, 0x8B, 0x88, 0x84, 0x0A, 0x88, 0x52, 0x8D,
+	0x88, 0x81, 0x07, 0x88, 0x54, 0x8E, 0x85, 0x06, 0x8B, 0x56, 0x86, 0x05, 0x8B, 0x57, 0x86, 0x04,
+	0x8B, 0x58, 0x83, 0x03, 0x82, 0x8B, 0x45, 0x8C, 0x8A, 0x98, 0x89, 0x8B, 0x4B, 0x8B, 0x05, 0x87,
+	0x8E, 0x40, 0x8E, 0x88, 0x82, 0x05, 0x81, 0x88, 0x8E, 0x49, 0x83, 0x05, 0x81, 0x87, 0x81, 0x09,
+	0x83, 0x8E, 0x48, 0x88, 0x13, 0x84, 0x48, 0x8B, 0x14, 0x8B, 0x47, 0x8E, 0x14, 0x88, 0x48, 0x14,
+	0x86, 0x48, 0x14, 0x87, 0x48, 0x14, 0x88, 0x48, 0x02, 0x82, 0x88, 0x81, 0x0E, 0x8D, 0x47, 0x8B,
+	0x02, 0x8C, 0x40, 0x8C, 0x83, 0x0C, 0x88, 0x48, 0x88, 0x01, 0x88, 0x43, 0x89, 0x81, 0x09, 0x88,
+	0x49, 0x83, 0x00, 0x84, 0x46, 0x89, 0x85, 0x04, 0x82, 0x87, 0x8D, 0x49, 0x8B, 0x00, 0x81, 0x8D,
+	0x4A, 0x8B, 0x8C, 0x4D, 0x84, 0x00, 0x8A, 0x5A, 0x89, 0x01, 0x89, 0x59, 0x8C, 0x81, 0x02, 0x86,
+	0x8E, 0x56, 0x8C, 0x81, 0x04, 0x82, 0x8B, 0x54, 0x88, 0x81, 0x07, 0x84, 0x8B, 0x50, 0x8D, 0x84,
+	0x0B, 0x84, 0x89, 0x8E, 0x4B, 0x8A, 0x85, 0x10, 0x83, 0x86, 0x88, 0x8A, 0xBB, 0x89, 0x88, 0x84,
+	0x81, 0x09, 0x0E, 0x83, 0x84, 0x86, 0x88, 0x86, 0x94, 0x15, 0x86, 0x8A, 0x8E, 0x47, 0x8C, 0x88,
+	0x82, 0x0F, 0x87, 0x8D, 0x4D, 0x8B, 0x84, 0x0B, 0x83, 0x8C, 0x51, 0x8A, 0x81, 0x08, 0x86, 0x8E,
+	0x53, 0x8E, 0x84, 0x06, 0x86, 0x57, 0x82, 0x04, 0x84, 0x57, 0x86, 0x04, 0x81, 0x8E, 0x56, 0x88,
+	0x05, 0x8A, 0x49, 0x8E, 0x89, 0x86, 0xA4, 0x88, 0x8C, 0x44, 0x89, 0x05, 0x84, 0x49, 0x88, 0x81,
+	0x06, 0x84, 0x8B, 0x41, 0x8B, 0x06, 0x8B, 0x47, 0x8E, 0x83, 0x0A, 0x87, 0x8B, 0x81, 0x05, 0x83,
+	0x48, 0x84, 0x14, 0x89, 0x47, 0x88, 0x15, 0x8E, 0x47, 0x81, 0x14, 0x83, 0x47, 0x89, 0x15, 0x87,
+	0x47, 0x85, 0x15, 0x8A, 0x47, 0x81, 0x05, 0x84, 0x86, 0x88, 0x86, 0x84, 0x82, 0x09, 0x8B, 0x46,
+	0x8D, 0x03, 0x85, 0x8A, 0x46, 0x8D, 0x88, 0x82, 0x06, 0x47, 0x8B, 0x01, 0x84, 0x8D, 0x4B, 0x89,
+	0x81, 0x04, 0x47, 0x8A, 0x81, 0x89, 0x4E, 0x8E, 0x83, 0x03, 0x47, 0x88, 0x8C, 0x50, 0x8E, 0x83,
+	0x01, 0x84, 0x5B, 0x8C, 0x01, 0x84, 0x5C, 0x88, 0x00, 0x84, 0x4C, 0x8C, 0x88, 0x94, 0x85, 0x88,
+	0x8D, 0x48, 0x8D, 0x00, 0x81, 0x4A, 0x8B, 0x82, 0x06, 0x88, 0x48, 0x84, 0x00, 0x49, 0x88, 0x09,
+	0x88, 0x47, 0x88, 0x00, 0x48, 0x86, 0x0A, 0x82, 0x47, 0x8B, 0x00, 0x8C, 0x46, 0x8D, 0x0C, 0x8C,
+	0x46, 0x8B, 0x00, 0x8A, 0x47, 0x0C, 0x8B, 0x46, 0x8B, 0x00, 0x87, 0x47, 0x84, 0x0B, 0x8B, 0x46,
+	0x8C, 0x00, 0x83, 0x47, 0x88, 0x0B, 0x8B, 0x46, 0x8B, 0x01, 0x8D, 0x46, 0x8E, 0x0B, 0x47, 0x8B,
+	0x01, 0x88, 0x47, 0x88, 0x09, 0x86, 0x47, 0x88, 0x01, 0x82, 0x48, 0x83, 0x07, 0x81, 0x8D, 0x47,
+	0x83, 0x02, 0x89, 0x48, 0x87, 0x05, 0x83, 0x8C, 0x47, 0x8D, 0x03, 0x81, 0x8E, 0x48, 0x8D, 0x88,
+	0x94, 0x87, 0x8A, 0x49, 0x86, 0x04, 0x85, 0x57, 0x8C, 0x06, 0x88, 0x55, 0x8E, 0x82, 0x07, 0x89,
+	0x53, 0x8E, 0x83, 0x09, 0x87, 0x51, 0x8D, 0x83, 0x0B, 0x83, 0x8C, 0x4E, 0x88, 0x81, 0x0E, 0x85,
+	0x8A, 0x49, 0x8E, 0x88, 0x82, 0x12, 0x81, 0x85, 0x88, 0x8A, 0xAB, 0x89, 0x88, 0x84, 0x09, 0xFB,
+	0xFB, 0xFB, 0xDB, 0x86, 0x5D, 0x88, 0x5D, 0x88, 0x5D, 0x88, 0x5D, 0x88, 0x5D, 0x88, 0x5C, 0x8E,
+	0x83, 0x5C, 0x85, 0x00, 0xF4, 0xF4, 0xB4, 0x8D, 0x46, 0x87, 0x14, 0x88, 0x46, 0x89, 0x14, 0x85,
+	0x46, 0x8C, 0x81, 0x13, 0x81, 0x8E, 0x45, 0x8E, 0x83, 0x14, 0x8B, 0x46, 0x86, 0x14, 0x87, 0x46,
+	0x8A, 0x14, 0x82, 0x8E, 0x45, 0x8E, 0x82, 0x14, 0x8A, 0x46, 0x88, 0x14, 0x84, 0x46, 0x8D, 0x15,
+	0x8C, 0x46, 0x86, 0x14, 0x86, 0x46, 0x8D, 0x15, 0x8D, 0x46, 0x88, 0x14, 0x85, 0x47, 0x81, 0x14,
+	0x8B, 0x46, 0x8A, 0x14, 0x82, 0x47, 0x86, 0x14, 0x88, 0x47, 0x82, 0x14, 0x8D, 0x46, 0x8C, 0x14,
+	0x83, 0x47, 0x88, 0x14, 0x88, 0x47, 0x86, 0x14, 0x8B, 0x47, 0x83, 0x14, 0x48, 0x14, 0x84, 0x47,
+	0x8C, 0x14, 0x87, 0x47, 0x8B, 0x14, 0x88, 0x47, 0x88, 0x14, 0x8B, 0x47, 0x88, 0x14, 0x8E, 0x47,
+	0x86, 0x14, 0x48, 0x84, 0x13, 0x83, 0x48, 0x84, 0x13, 0x84, 0x48, 0x82, 0x13, 0x86, 0x48, 0x14,
+	0x88, 0x48, 0x14, 0x88, 0x48, 0x14, 0x88, 0x47, 0x8B, 0x0C, 0x0B, 0x94, 0x87, 0x88, 0x86, 0x84,
+	0x83, 0x13, 0x82, 0x88, 0x8C, 0x48, 0x8B, 0x87, 0x81, 0x0D, 0x82, 0x89, 0x4D, 0x8E, 0x88, 0x81,
+	0x0A, 0x86, 0x8E, 0x50, 0x8C, 0x83, 0x08, 0x86, 0x53, 0x8E, 0x83, 0x06, 0x85, 0x55, 0x8C, 0x81,
+	0x04, 0x81, 0x8E, 0x56, 0x88, 0x04, 0x88, 0x48, 0x89, 0x85, 0x84, 0x82, 0x84, 0x87, 0x8C, 0x47,
+	0x8E, 0x81, 0x03, 0x8D, 0x46, 0x8E, 0x84, 0x06, 0x89, 0x47, 0x85, 0x02, 0x82, 0x47, 0x87, 0x08,
+	0x8B, 0x46, 0x88, 0x02, 0x84, 0x47, 0x81, 0x08, 0x85, 0x46, 0x8B, 0x02, 0x84, 0x47, 0x0A, 0x46,
+	0x8B, 0x02, 0x84, 0x47, 0x0A, 0x46, 0x8B, 0x02, 0x84, 0x47, 0x84, 0x08, 0x81, 0x46, 0x88, 0x03,
+	0x47, 0x8C, 0x08, 0x86, 0x46, 0x85, 0x03, 0x89, 0x47, 0x8C, 0x82, 0x06, 0x8B, 0x45, 0x8D, 0x04,
+	0x83, 0x49, 0x88, 0x81, 0x03, 0x87, 0x46, 0x85, 0x05, 0x88, 0x4A, 0x89, 0x83, 0x00, 0x83, 0x46,
+	0x88, 0x07, 0x89, 0x4B, 0x8D, 0x8E, 0x45, 0x89, 0x09, 0x89, 0x51, 0x88, 0x0B, 0x88, 0x4F, 0x84,
+	0x0D, 0x89, 0x4E, 0x8C, 0x84, 0x0A, 0x83, 0x8B, 0x51, 0x88, 0x81, 0x07, 0x88, 0x54, 0x8C, 0x81,
+	0x04, 0x81, 0x8A, 0x46, 0x87, 0x85, 0x89, 0x4C, 0x8C, 0x81, 0x02, 0x81, 0x8C, 0x46, 0x86, 0x02,
+	0x81, 0x86, 0x8C, 0x4A, 0x8C, 0x02, 0x88, 0x46, 0x87, 0x06, 0x84, 0x8B, 0x49, 0x88, 0x00, 0x84,
+	0x46, 0x8B, 0x09, 0x85, 0x8E, 0x47, 0x8D, 0x00, 0x89, 0x46, 0x86, 0x0A, 0x83, 0x8E, 0x47, 0x83,
+	0x8D, 0x46, 0x82, 0x0B, 0x88, 0x47, 0x87, 0x47, 0x0C, 0x84, 0x47, 0x88, 0x47, 0x82, 0x0B, 0x84,
+	0x47, 0x88, 0x47, 0x86, 0x0B, 0x86, 0x47, 0x88, 0x8E, 0x46, 0x8D, 0x81, 0x0A, 0x8B, 0x47, 0x86,
+	0x8A, 0x47, 0x8C, 0x81, 0x08, 0x86, 0x48, 0x82, 0x86, 0x48, 0x8E, 0x88, 0x82, 0x04, 0x85, 0x8B,
+	0x48, 0x8B, 0x01, 0x8C, 0x4A, 0x8E, 0xAB, 0x4B, 0x84, 0x01, 0x83, 0x59, 0x88, 0x03, 0x86, 0x57,
+	0x89, 0x05, 0x84, 0x8E, 0x54, 0x88, 0x07, 0x81, 0x89, 0x51, 0x8D, 0x84, 0x0A, 0x82, 0x88, 0x8D,
+	0x4C, 0x8A, 0x85, 0x0F, 0x82, 0x86, 0x88, 0x8A, 0xCB, 0x88, 0x87, 0x84, 0x09, 0x0A, 0x81, 0x94,
+	0x98, 0x94, 0x15, 0x82, 0x88, 0x8C, 0x47, 0x8C, 0x87, 0x81, 0x0F, 0x82, 0x89, 0x4C, 0x8E, 0x88,
+	0x81, 0x0C, 0x86, 0x8E, 0x4F, 0x8E, 0x85, 0x0A, 0x89, 0x53, 0x88, 0x08, 0x88, 0x55, 0x88, 0x06,
+	0x85, 0x57, 0x85, 0x04, 0x81, 0x8D, 0x49, 0x8D, 0xAB, 0x49, 0x8E, 0x82, 0x03, 0x87, 0x48, 0x8B,
+	0x84, 0x03, 0x82, 0x88, 0x48, 0x8A, 0x03, 0x8D, 0x47, 0x89, 0x07, 0x86, 0x48, 0x84, 0x01, 0x82,
+	0x47, 0x8C, 0x09, 0x87, 0x47, 0x8A, 0x01, 0x86, 0x47, 0x86, 0x0A, 0x8C, 0x47, 0x81, 0x00, 0x88,
+	0x47, 0x82, 0x0A, 0x86, 0x47, 0x86, 0x00, 0x88, 0x47, 0x0B, 0x81, 0x47, 0x8A, 0x00, 0x88, 0x47,
+	0x0C, 0x8B, 0x46, 0x8D, 0x00, 0x88, 0x47, 0x0C, 0x88, 0x47, 0x00, 0x88, 0x47, 0x84, 0x0A, 0x81,
+	0x8C, 0x47, 0x84, 0x85, 0x47, 0x89, 0x09, 0x81, 0x8C, 0x48, 0x84, 0x82, 0x48, 0x86, 0x07, 0x83,
+	0x8C, 0x49, 0x85, 0x00, 0x8C, 0x48, 0x8A, 0x85, 0x03, 0x85, 0x89, 0x4B, 0x88, 0x00, 0x86, 0x5C,
+	0x88, 0x01, 0x8C, 0x5B, 0x88, 0x01, 0x83, 0x8E, 0x51, 0x8C, 0x47, 0x87, 0x02, 0x83, 0x8E, 0x4F,
+	0x86, 0x84, 0x47, 0x84, 0x03, 0x83, 0x8C, 0x4C, 0x8B, 0x83, 0x00, 0x86, 0x47, 0x84, 0x05, 0x86,
+	0x8C, 0x48, 0x8B, 0x85, 0x02, 0x88, 0x47, 0x83, 0x07, 0x82, 0x86, 0x88, 0xAB, 0x89, 0x87, 0x82,
+	0x04, 0x8A, 0x47, 0x16, 0x8E, 0x46, 0x8C, 0x15, 0x83, 0x47, 0x89, 0x15, 0x89, 0x47, 0x85, 0x14,
+	0x82, 0x48, 0x81, 0x14, 0x8A, 0x47, 0x89, 0x06, 0x84, 0x85, 0x0B, 0x88, 0x48, 0x84, 0x05, 0x83,
+	0x8E, 0x40, 0x88, 0x81, 0x07, 0x81, 0x89, 0x48, 0x8B, 0x05, 0x82, 0x8E, 0x42, 0x8E, 0x89, 0x84,
+	0x03, 0x82, 0x88, 0x8D, 0x49, 0x84, 0x04, 0x81, 0x8C, 0x47, 0x8D, 0x8C, 0x4C, 0x88, 0x05, 0x8C,
+	0x56, 0x8C, 0x81, 0x04, 0x89, 0x56, 0x8E, 0x82, 0x05, 0x86, 0x8E, 0x54, 0x8C, 0x83, 0x07, 0x83,
+	0x8B, 0x52, 0x8B, 0x81, 0x0A, 0x86, 0x8D, 0x4E, 0x8E, 0x86, 0x0E, 0x86, 0x8A, 0x4A, 0x8C, 0x87,
+	0x81, 0x11, 0x81, 0x85, 0x88, 0x89, 0xBB, 0x88, 0x86, 0x82, 0x0C, 0x03, 0x82, 0x88, 0x8B, 0x41,
+	0x8C, 0x89, 0x84, 0x06, 0x86, 0x8E, 0x46, 0x8A, 0x81, 0x03, 0x86, 0x49, 0x8C, 0x02, 0x82, 0x4B,
+	0x88, 0x01, 0x89, 0x4C, 0x81, 0x00, 0x8E, 0x4C, 0x86, 0x83, 0x4D, 0x88, 0x84, 0x4D, 0x88, 0x84,
+	0x4D, 0x88, 0x00, 0x4D, 0x87, 0x00, 0x8A, 0x4C, 0x82, 0x00, 0x84, 0x4B, 0x89, 0x02, 0x88, 0x49,
+	0x8C, 0x81, 0x03, 0x88, 0x47, 0x8C, 0x81, 0x05, 0x84, 0x89, 0x8E, 0x42, 0x8C, 0x86, 0x3F, 0x19,
+	0x82, 0x94, 0x83, 0x09, 0x86, 0x8D, 0x43, 0x8E, 0x89, 0x81, 0x04, 0x81, 0x8A, 0x47, 0x8E, 0x83,
+	0x03, 0x89, 0x49, 0x8E, 0x82, 0x01, 0x85, 0x4B, 0x8B, 0x01, 0x8B, 0x4C, 0x82, 0x00, 0x4D, 0x87,
+	0x84, 0x4D, 0x88, 0x84, 0x4D, 0x88, 0x82, 0x4D, 0x88, 0x00, 0x8E, 0x4C, 0x85, 0x00, 0x88, 0x4B,
+	0x8E, 0x81, 0x00, 0x81, 0x8E, 0x4A, 0x87, 0x02, 0x84, 0x49, 0x89, 0x04, 0x83, 0x8D, 0x46, 0x88,
+	0x07, 0x85, 0x89, 0x9B, 0x8A, 0x87, 0x82, 0x03,
+};
+
+static const Glyph_t font_digits_64_glyphs[] = {
+	{0, 0, 0, 0, 0, 38, 0},	/* ' ' */
+	{0, 0, 0, 0, 0, 0, 0},	/* '!' */
+	{0, 0, 0, 0, 0, 0, 0},	/* '"' */
+	{0, 0, 0, 0, 0, 0, 0},	/* '#' */
+	{0, 0, 0, 0, 0, 0, 0},	/* '$' */
+	{0, 37, 43, 1, 0, 38, 0},	/* '%' */
+	{453, 0, 0, 0, 0, 0, 0},	/* '&' */
+	{453, 0, 0, 0, 0, 0, 0},	/* '\'' */
+	{453, 0, 0, 0, 0, 0, 0},	/* '(' */
+	{453, 0, 0, 0, 0, 0, 0},	/* ')' */
+	{453, 0, 0, 0, 0, 0, 0},	/* '*' */
+	{453, 30, 31, 4, 5, 38, 0},	/* '+' */
+	{574, 0, 0, 0, 0, 0, 0},	/* ',' */
+	{574, 30, 8, 4, 17, 38, 0},	/* '-' */
+	{595, 16, 16, 11, 27, 38, 0},	/* '.' */
+	{668, 0, 0, 0, 0, 0, 0},	/* '/' */
+	{668, 32, 43, 3, 0, 38, 0},	/* '0' */
+	{1011, 30, 41, 5, 1, 38, 0},	/* '1' */
+	{1142, 32, 42, 3, 0, 38, 0},	/* '2' */
+	{1350, 32, 43, 2, 0, 38, 0},	/* '3' */
+	{1621, 34, 41, 2, 1, 38, 0},	/* '4' */
+	{1845, 31, 42, 3, 1, 38, 0},	/* '5' */
+	{2082, 32, 43, 3, 0, 38, 0},	/* '6' */
+	{2383, 31, 41, 4, 1, 38, 0},	/* '7' */
+	{2538, 31, 43, 4, 0, 38, 0},	/* '8' */
+	{2845, 32, 43, 3, 0, 38, 0},	/* '9' */
+	{3147, 16, 36, 11, 7, 38, 0},	/* ':' */
+};
+
+const FontAA_t font_digits_64 = {4, 43, 32, 27, font_digits_64_glyphs, font_digits_64_data, sizeof(font_digits_64_data)};
@@ -0,0 +1,259 @@
+/* Generado con scripts/font/font2c.py a partir de Lato-Regular.ttf, no editar */
+/* Fuente original: Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic with Reserved Font Name "Lato". Licensed under the SIL Open Font License, Version 1.1. */
+
+#include "fonts.h"
+
+/* 95 caracteres de 19 pixeles de alto con 2 bits por pixel, 2414 bytes en lugar de 2422 */
+static const uint8_t font_sans_18_data[] = {
+	0xF2, 0xF2, 0x91, 0x03, 0x43, 0xA2, 0xA8, 0xAA, 0x2A, 0x8A, 0x51, 0x40, 0x00, 0xD2, 0x80, 0x1C,
+	0x28, 0x02, 0x83, 0x40, 0x28, 0x70, 0x3F, 0xFF, 0xE0, 0x34, 0xA0, 0x07, 0x0A, 0x00, 0xA0, 0xD0,
+	0xBF, 0xFF, 0xD1, 0xE5, 0xD4, 0x0D, 0x2C, 0x01, 0xC2, 0x80, 0x1C, 0x28, 0x00, 0x00, 0x50, 0x00,
+	0x28, 0x00, 0xBF, 0x90, 0xBB, 0xAC, 0x74, 0x91, 0x2C, 0x24, 0x07, 0x4C, 0x00, 0xBB, 0x00, 0x0B,
+	0xF9, 0x00, 0x3B, 0xC0, 0x18, 0x78, 0x06, 0x0E, 0x51, 0x87, 0x6E, 0xA7, 0x82, 0xFF, 0x80, 0x0A,
+	0x00, 0x02, 0x40, 0x00, 0x40, 0x00, 0x1F, 0xD0, 0x07, 0x43, 0x8B, 0x00, 0xE0, 0x70, 0x34, 0x28,
+	0x07, 0x03, 0x47, 0x00, 0x30, 0x31, 0xD0, 0x02, 0xEE, 0x38, 0x00, 0x06, 0x4A, 0x05, 0x00, 0x01,
+	0xD7, 0xB8, 0x00, 0x74, 0xD0, 0xD0, 0x0A, 0x1C, 0x0A, 0x02, 0x81, 0xC0, 0xA0, 0x74, 0x0D, 0x1C,
+	0x1D, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x40, 0x01, 0xBE, 0x00, 0x00, 0xE5, 0xE0, 0x00, 0x70, 0x1C,
+	0x00, 0x2C, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xBF, 0x40, 0x80, 0xB4, 0xB4,
+	0x70, 0x38, 0x0B, 0x68, 0x1D, 0x00, 0xBD, 0x03, 0x80, 0x0F, 0x40, 0xB9, 0x6E, 0xB4, 0x0B, 0xFD,
+	0x0B, 0x40, 0x10, 0x00, 0x00, 0xF2, 0x91, 0x09, 0x0D, 0x2C, 0x34, 0x70, 0xB0, 0xA0, 0xA0, 0xA0,
+	0xA0, 0xA0, 0xB0, 0x74, 0x38, 0x2C, 0x0D, 0x04, 0x20, 0x38, 0x2C, 0x0D, 0x0A, 0x0A, 0x0B, 0x07,
+	0x07, 0x07, 0x0B, 0x0A, 0x0E, 0x1D, 0x28, 0x74, 0x10, 0x04, 0x12, 0x1A, 0xA8, 0xB8, 0x99, 0x82,
+	0x00, 0x40, 0x01, 0x40, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0xAB, 0xEA, 0x6A, 0xBA, 0x90,
+	0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x50, 0x00, 0xEF, 0x29, 0x40, 0x43, 0xC1, 0x00, 0xEF,
+	0x00, 0x04, 0x00, 0xA0, 0x03, 0x00, 0x28, 0x00, 0xD0, 0x07, 0x00, 0x28, 0x00, 0xC0, 0x0A, 0x00,
+	0x34, 0x01, 0xC0, 0x0A, 0x00, 0x70, 0x02, 0x80, 0x09, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xF5, 0xB8,
+	0x2C, 0x02, 0xC3, 0x80, 0x1D, 0x74, 0x00, 0xEB, 0x40, 0x0A, 0xB4, 0x00, 0xBB, 0x40, 0x0B, 0x74,
+	0x00, 0xE3, 0x80, 0x0E, 0x2C, 0x02, 0xC1, 0xE5, 0xB8, 0x06, 0xFE, 0x00, 0x02, 0xC0, 0x1B, 0xC0,
+	0x7B, 0xC0, 0xE2, 0xC0, 0x42, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0,
+	0x02, 0xC0, 0x16, 0xD4, 0xBF, 0xFE, 0x0B, 0xF8, 0x0F, 0x5B, 0x8B, 0x40, 0xB2, 0x80, 0x1D, 0x00,
+	0x0B, 0x40, 0x03, 0x80, 0x02, 0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x02, 0xEA,
+	0xA9, 0xFF, 0xFF, 0x80, 0x0B, 0xF8, 0x0B, 0x9B, 0x87, 0x40, 0x75, 0x80, 0x1D, 0x00, 0x07, 0x00,
+	0x1B, 0x40, 0x1F, 0x80, 0x00, 0x6C, 0x00, 0x03, 0x94, 0x00, 0xEB, 0x00, 0x75, 0xE5, 0xB8, 0x1F,
+	0xF8, 0x00, 0x10, 0x00, 0x00, 0x0B, 0x40, 0x01, 0xF4, 0x00, 0x7B, 0x40, 0x0E, 0x74, 0x02, 0xC7,
+	0x40, 0x74, 0x74, 0x1D, 0x07, 0x43, 0x80, 0x74, 0xBA, 0xAB, 0xA6, 0xAA, 0xBA, 0x00, 0x07, 0x40,
+	0x00, 0x74, 0x00, 0x07, 0x40, 0x1F, 0xFE, 0x0B, 0xAA, 0x42, 0x80, 0x00, 0xE0, 0x00, 0x35, 0x40,
+	0x1F, 0xFE, 0x01, 0x46, 0xE0, 0x00, 0x2C, 0x00, 0x0B, 0x40, 0x02, 0xC0, 0x00, 0xF2, 0xD5, 0xB4,
+	0x6F, 0xE4, 0x00, 0x40, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x1D, 0x00, 0x1E, 0x00,
+	0x0B, 0xBA, 0x07, 0xD6, 0xE3, 0xC0, 0x1D, 0xE0, 0x03, 0xB8, 0x00, 0xEB, 0x00, 0x75, 0xE5, 0xB8,
+	0x1F, 0xF8, 0x00, 0x10, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0xE0, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x2C,
+	0x00, 0x0E, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0xB0, 0x00, 0x38, 0x00,
+	0x2C, 0x00, 0x00, 0x1B, 0xF8, 0x0E, 0x5B, 0x8B, 0x00, 0xB2, 0xC0, 0x2C, 0x70, 0x0B, 0x0B, 0x5B,
+	0x41, 0xFF, 0x82, 0xD0, 0x6C, 0xE0, 0x07, 0x78, 0x00, 0xEE, 0x00, 0x76, 0xE5, 0x7C, 0x2F, 0xF8,
+	0x00, 0x10, 0x00, 0x0B, 0xF8, 0x0B, 0x97, 0x87, 0x40, 0x76, 0xC0, 0x0E, 0xB0, 0x03, 0x9D, 0x01,
+	0xE2, 0xEA, 0xF0, 0x1A, 0xB8, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0B, 0x40,
+	0x00, 0xA2, 0xD1, 0x00, 0x00, 0x00, 0x2D, 0xB4, 0xA2, 0xD1, 0x00, 0x00, 0x00, 0x2D, 0xB4, 0x86,
+	0x10, 0x00, 0x09, 0x00, 0xBC, 0x0B, 0xD0, 0x7D, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00,
+	0x09, 0xF1, 0x82, 0x46, 0x07, 0xF1, 0x82, 0x46, 0x90, 0x02, 0xE4, 0x00, 0xB9, 0x00, 0x2E, 0x01,
+	0xB8, 0x6E, 0x0B, 0x80, 0x24, 0x00, 0x2F, 0xE1, 0xD6, 0xE0, 0x02, 0x80, 0x0A, 0x00, 0x74, 0x0B,
+	0x80, 0x74, 0x01, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0B, 0x40, 0x00, 0x01, 0x40,
+	0x00, 0x07, 0xEF, 0x80, 0x02, 0x90, 0x0B, 0x40, 0xA0, 0x00, 0x1C, 0x1C, 0x01, 0xA4, 0xA2, 0x41,
+	0xEB, 0x87, 0x30, 0x34, 0x34, 0x37, 0x0A, 0x07, 0x03, 0x70, 0xA0, 0x60, 0x63, 0x0A, 0x0E, 0x09,
+	0x24, 0x7B, 0x7B, 0x81, 0xC0, 0x40, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x6C, 0x00, 0x6F,
+	0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xE7,
+	0x40, 0x02, 0xC3, 0x80, 0x03, 0x82, 0xD0, 0x07, 0x40, 0xE0, 0x0B, 0x00, 0xB0, 0x0F, 0xAA, 0xF4,
+	0x2E, 0xAA, 0xB8, 0x3C, 0x00, 0x2D, 0x74, 0x00, 0x1E, 0xB0, 0x00, 0x0B, 0xBF, 0xE9, 0x0B, 0xAA,
+	0xF8, 0xB4, 0x02, 0xCB, 0x40, 0x2D, 0xB4, 0x02, 0xCB, 0x41, 0xB4, 0xBF, 0xFE, 0x0B, 0x41, 0x7C,
+	0xB4, 0x01, 0xEB, 0x40, 0x0E, 0xB4, 0x01, 0xDB, 0xAA, 0xB8, 0xBF, 0xFE, 0x00, 0x00, 0xAF, 0xE4,
+	0x07, 0xEA, 0xBD, 0x0F, 0x40, 0x04, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x40, 0x08, 0x07, 0xE5,
+	0xBD, 0x01, 0xBF, 0xE4, 0xBF, 0xFA, 0x40, 0xBA, 0xAB, 0xE0, 0xB4, 0x00, 0xB8, 0xB4, 0x00, 0x2C,
+	0xB4, 0x00, 0x1D, 0xB4, 0x00, 0x0E, 0xB4, 0x00, 0x0E, 0xB4, 0x00, 0x0E, 0xB4, 0x00, 0x1E, 0xB4,
+	0x00, 0x2C, 0xB4, 0x00, 0xB8, 0xBA, 0xAB, 0xE0, 0xBF, 0xFE, 0x40, 0xBF, 0xFF, 0xAE, 0xAA, 0x9B,
+	0x40, 0x02, 0xD0, 0x00, 0xB4, 0x00, 0x2D, 0x55, 0x0B, 0xFF, 0xD2, 0xD5, 0x50, 0xB4, 0x00, 0x2D,
+	0x00, 0x0B, 0x40, 0x02, 0xEA, 0xA9, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0xAE, 0xAA, 0x9B, 0x40, 0x02,
+	0xD0, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x0B, 0xFF, 0xE2, 0xEA, 0xA4, 0xB4, 0x00, 0x2D, 0x00, 0x0B,
+	0x40, 0x02, 0xD0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xAF, 0xE4, 0x07, 0xEA, 0xBE, 0x0F, 0x40, 0x05,
+	0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x55, 0x38, 0x00, 0xBF, 0x3C,
+	0x00, 0x1B, 0x2D, 0x00, 0x0B, 0x0F, 0x40, 0x0B, 0x07, 0xE5, 0x6F, 0x00, 0xBF, 0xF8, 0x00, 0x01,
+	0x00, 0xB4, 0x00, 0x2E, 0xD0, 0x00, 0xBB, 0x40, 0x02, 0xED, 0x00, 0x0B, 0xB4, 0x00, 0x2E, 0xD5,
+	0x55, 0xBB, 0xFF, 0xFF, 0xED, 0x55, 0x5B, 0xB4, 0x00, 0x2E, 0xD0, 0x00, 0xBB, 0x40, 0x02, 0xED,
+	0x00, 0x0B, 0xB4, 0x00, 0x2C, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x78, 0x01, 0xE0,
+	0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xD0, 0x0B, 0x05,
+	0xB8, 0xBF, 0x80, 0x10, 0x00, 0x78, 0x00, 0xB5, 0xE0, 0x0B, 0x47, 0x80, 0x78, 0x1E, 0x07, 0x80,
+	0x78, 0x78, 0x01, 0xE7, 0x80, 0x07, 0xFE, 0x00, 0x1E, 0x2D, 0x00, 0x78, 0x2D, 0x01, 0xE0, 0x3D,
+	0x07, 0x80, 0x7C, 0x1E, 0x00, 0x78, 0x78, 0x00, 0x78, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4,
+	0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xBA,
+	0xAA, 0xBF, 0xFF, 0xB8, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x2F, 0xBE, 0x00, 0x03, 0xFB, 0xB4, 0x00,
+	0xBB, 0xB3, 0x80, 0x0E, 0xBB, 0x1D, 0x02, 0xCB, 0xB0, 0xB0, 0x74, 0xBB, 0x07, 0x4B, 0x0B, 0xB0,
+	0x2D, 0xD0, 0xBB, 0x00, 0xF8, 0x0B, 0xB0, 0x0B, 0x40, 0xBB, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00,
+	0xB0, 0xB4, 0x00, 0x2E, 0xF0, 0x00, 0xBB, 0xE0, 0x02, 0xEE, 0xD0, 0x0B, 0xB2, 0xD0, 0x2E, 0xC3,
+	0xC0, 0xBB, 0x07, 0x82, 0xEC, 0x07, 0x8B, 0xB0, 0x0B, 0x6E, 0xC0, 0x0F, 0xBB, 0x00, 0x1F, 0xEC,
+	0x00, 0x1F, 0xB0, 0x00, 0x2C, 0x00, 0xBF, 0xE4, 0x00, 0x7E, 0xAB, 0xD0, 0x0F, 0x40, 0x0B, 0x42,
+	0xD0, 0x00, 0x3C, 0x3C, 0x00, 0x02, 0xD3, 0x80, 0x00, 0x1E, 0x78, 0x00, 0x01, 0xE3, 0x80, 0x00,
+	0x1E, 0x3C, 0x00, 0x02, 0xD2, 0xD0, 0x00, 0x3C, 0x0F, 0x40, 0x0B, 0x40, 0x7E, 0xAB, 0xE0, 0x00,
+	0xBF, 0xE4, 0x00, 0x7F, 0xE9, 0x07, 0xAA, 0xF4, 0x78, 0x03, 0xC7, 0x80, 0x2D, 0x78, 0x02, 0xD7,
+	0x80, 0x2C, 0x79, 0x5B, 0x87, 0xFF, 0xE0, 0x79, 0x40, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80,
+	0x00, 0x78, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x7E, 0xAB, 0xD0, 0x0F, 0x40, 0x0B, 0x42, 0xD0,
+	0x00, 0x3C, 0x3C, 0x00, 0x02, 0xD3, 0x80, 0x00, 0x1E, 0x78, 0x00, 0x01, 0xE3, 0x80, 0x00, 0x1E,
+	0x3C, 0x00, 0x02, 0xD2, 0xD0, 0x00, 0x3C, 0x0F, 0x40, 0x0B, 0x40, 0x7E, 0xAB, 0xE0, 0x00, 0xBF,
+	0xFD, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1A, 0x7F, 0xE9, 0x07, 0xAA,
+	0xF4, 0x78, 0x03, 0xC7, 0x80, 0x2C, 0x78, 0x02, 0xC7, 0x80, 0x78, 0x7E, 0xAE, 0x07, 0xAF, 0x40,
+	0x78, 0x3C, 0x07, 0x81, 0xE0, 0x78, 0x0B, 0x47, 0x80, 0x2D, 0x78, 0x00, 0xF0, 0x06, 0xFE, 0x07,
+	0xEA, 0xD2, 0xC0, 0x10, 0xE0, 0x00, 0x2D, 0x00, 0x07, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x7E, 0x00,
+	0x03, 0x80, 0x00, 0xA2, 0x00, 0x39, 0xF5, 0x7D, 0x1B, 0xF9, 0x00, 0x10, 0x00, 0xBF, 0xFF, 0xF5,
+	0xAA, 0xEA, 0x80, 0x0B, 0x40, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40,
+	0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x2D, 0x00, 0x00, 0xB4,
+	0x00, 0xB4, 0x00, 0x3A, 0xD0, 0x00, 0xEB, 0x40, 0x03, 0xAD, 0x00, 0x0E, 0xB4, 0x00, 0x3A, 0xD0,
+	0x00, 0xEB, 0x40, 0x03, 0xAD, 0x00, 0x0E, 0xB4, 0x00, 0x39, 0xD0, 0x01, 0xE3, 0xC0, 0x0B, 0x07,
+	0xEA, 0xF4, 0x06, 0xFF, 0x40, 0x00, 0x40, 0x00, 0xB0, 0x00, 0x0B, 0x74, 0x00, 0x1E, 0x3C, 0x00,
+	0x2D, 0x2D, 0x00, 0x38, 0x0E, 0x00, 0x74, 0x0B, 0x00, 0xF0, 0x07, 0x41, 0xE0, 0x03, 0xC2, 0xC0,
+	0x02, 0xD3, 0x80, 0x00, 0xE7, 0x40, 0x00, 0xBB, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0xB0,
+	0x00, 0xB0, 0x00, 0xB7, 0x40, 0x0F, 0x40, 0x0E, 0x38, 0x01, 0xF8, 0x01, 0xD2, 0xC0, 0x2E, 0xC0,
+	0x2C, 0x2D, 0x03, 0x9D, 0x03, 0x81, 0xE0, 0x74, 0xE0, 0x78, 0x0F, 0x0B, 0x0B, 0x0B, 0x40, 0xB4,
+	0xE0, 0x74, 0xB0, 0x07, 0x9D, 0x03, 0x8E, 0x00, 0x3A, 0xC0, 0x2E, 0xD0, 0x02, 0xF8, 0x01, 0xFC,
+	0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x78, 0x00, 0x2C, 0xB4, 0x02, 0xD0,
+	0xF0, 0x1E, 0x01, 0xE0, 0xF0, 0x02, 0xDB, 0x40, 0x03, 0xB8, 0x00, 0x0B, 0xD0, 0x00, 0x7B, 0x80,
+	0x02, 0xCB, 0x80, 0x2D, 0x0B, 0x01, 0xE0, 0x1E, 0x0B, 0x00, 0x2D, 0xB4, 0x00, 0x3C, 0xB4, 0x00,
+	0x2C, 0xE0, 0x01, 0xD2, 0xD0, 0x0E, 0x03, 0xC0, 0xB4, 0x07, 0x87, 0x80, 0x0B, 0x2C, 0x00, 0x0E,
+	0xD0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+	0x78, 0x00, 0x3F, 0xFF, 0xF8, 0xAA, 0xAB, 0xD0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x00,
+	0x00, 0xB4, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00,
+	0x0B, 0xAA, 0xA9, 0x7F, 0xFF, 0xF8, 0xA9, 0xA4, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+	0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xB9, 0x69, 0x40, 0x03, 0x40, 0x0A, 0x00, 0x0D, 0x00, 0x28, 0x00,
+	0x70, 0x00, 0xD0, 0x02, 0x80, 0x03, 0x40, 0x0A, 0x00, 0x1C, 0x00, 0x34, 0x00, 0x70, 0x00, 0xD0,
+	0x02, 0x40, 0x6A, 0x17, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x2B, 0x2A, 0x02, 0xC0, 0x03, 0xE0, 0x0A, 0x70, 0x1D, 0x38, 0x28, 0x1C, 0x70, 0x0A, 0xF2,
+	0xD2, 0x78, 0x1D, 0x05, 0x00, 0x50, 0x0B, 0xF8, 0x29, 0x1E, 0x00, 0x0B, 0x00, 0x0B, 0x06, 0xFF,
+	0x2D, 0x0B, 0x74, 0x0B, 0x38, 0x1F, 0x1F, 0xE7, 0x01, 0x00, 0x50, 0x00, 0x2C, 0x00, 0x0B, 0x00,
+	0x02, 0xC0, 0x00, 0xB0, 0x50, 0x2D, 0xFF, 0x4B, 0x91, 0xE2, 0xC0, 0x2D, 0xB0, 0x07, 0x6C, 0x01,
+	0xEB, 0x00, 0x76, 0xC0, 0x2C, 0xB9, 0x6E, 0x29, 0xFE, 0x00, 0x00, 0x50, 0x0B, 0xFD, 0x2D, 0x06,
+	0x38, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x38, 0x00, 0x2E, 0x5A, 0x0B, 0xF9, 0x00, 0x01,
+	0x40, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x53, 0x82, 0xFE, 0xE2, 0xD0, 0x78, 0xE0, 0x0E,
+	0x74, 0x03, 0x9D, 0x00, 0xE7, 0x40, 0x38, 0xE0, 0x0E, 0x2D, 0x5B, 0x82, 0xFD, 0xA0, 0x00, 0x50,
+	0x02, 0xFF, 0x42, 0xD0, 0xB0, 0xE0, 0x0E, 0x7A, 0xAB, 0x9E, 0xAA, 0x97, 0x40, 0x00, 0xE0, 0x00,
+	0x1E, 0x57, 0x41, 0xFF, 0x80, 0x07, 0xF0, 0xE5, 0x1D, 0x01, 0xD0, 0xBF, 0xE1, 0xD5, 0x1D, 0x01,
+	0xD0, 0x1D, 0x01, 0xD0, 0x1D, 0x01, 0xD0, 0x1D, 0x00, 0x01, 0x40, 0x07, 0xFE, 0xA3, 0x81, 0xE4,
+	0xE0, 0x28, 0x38, 0x0A, 0x07, 0xAB, 0x41, 0xE9, 0x00, 0xA0, 0x00, 0x2F, 0xFA, 0x0A, 0x5A, 0xEB,
+	0x00, 0x29, 0xD0, 0x1D, 0x2F, 0xFD, 0x00, 0x54, 0x00, 0x50, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0,
+	0x00, 0xB0, 0x50, 0xB7, 0xF8, 0xB8, 0x1E, 0xB0, 0x0A, 0xB0, 0x0B, 0xB0, 0x0B, 0xB0, 0x0B, 0xB0,
+	0x0B, 0xB0, 0x0B, 0xB0, 0x0B, 0xB6, 0xD0, 0x00, 0xB2, 0xCB, 0x2C, 0xB2, 0xCB, 0x2C, 0xB0, 0x0B,
+	0x42, 0xD0, 0x00, 0x00, 0x0B, 0x02, 0xC0, 0xB0, 0x2C, 0x0B, 0x02, 0xC0, 0xB0, 0x2C, 0x0B, 0x02,
+	0xC0, 0xB2, 0xF4, 0x10, 0x00, 0x50, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0,
+	0x1D, 0xB0, 0x74, 0xB1, 0xD0, 0xBB, 0x80, 0xBB, 0x80, 0xB1, 0xD0, 0xB0, 0xB4, 0xB0, 0x2C, 0xB0,
+	0x0E, 0x1B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0x40, 0x14, 0x2A, 0xFD, 0x7F, 0x8B, 0x82,
+	0xE0, 0xB6, 0xC0, 0x74, 0x0E, 0xB0, 0x1D, 0x03, 0xAC, 0x07, 0x40, 0xEB, 0x01, 0xD0, 0x3A, 0xC0,
+	0x74, 0x0E, 0xB0, 0x1D, 0x03, 0xAC, 0x07, 0x40, 0xE0, 0x00, 0x50, 0xA7, 0xF8, 0xB8, 0x1E, 0xB0,
+	0x0A, 0xB0, 0x0B, 0xB0, 0x0B, 0xB0, 0x0B, 0xB0, 0x0B, 0xB0, 0x0B, 0xB0, 0x0B, 0x00, 0x50, 0x00,
+	0xBF, 0xE0, 0x2D, 0x07, 0x83, 0x80, 0x2C, 0x74, 0x01, 0xD7, 0x40, 0x1D, 0x74, 0x01, 0xD3, 0x80,
+	0x2C, 0x1E, 0x5B, 0x40, 0x7F, 0xD0, 0x00, 0x50, 0x29, 0xFF, 0x4B, 0x81, 0xE2, 0xC0, 0x2C, 0xB0,
+	0x07, 0x6C, 0x01, 0xDB, 0x00, 0x76, 0xC0, 0x2C, 0xB9, 0x6E, 0x2E, 0xFE, 0x0B, 0x00, 0x02, 0xC0,
+	0x00, 0xB0, 0x00, 0x00, 0x00, 0x50, 0x02, 0xFE, 0xA2, 0xD0, 0x78, 0xE0, 0x0E, 0x74, 0x03, 0x9D,
+	0x00, 0xE7, 0x40, 0x38, 0xE0, 0x0E, 0x2D, 0x5B, 0x82, 0xFD, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00,
+	0x03, 0x80, 0x00, 0x4A, 0x7E, 0xAD, 0x5B, 0x40, 0xB0, 0x0B, 0x00, 0xB0, 0x0B, 0x00, 0xB0, 0x0B,
+	0x00, 0x01, 0x40, 0x7F, 0xD3, 0x81, 0x5D, 0x00, 0x3E, 0x40, 0x2F, 0xD0, 0x07, 0xC0, 0x0B, 0x24,
+	0x28, 0xBF, 0x80, 0x10, 0x00, 0x0A, 0x00, 0xE0, 0x0E, 0x07, 0xFF, 0x1E, 0x51, 0xE0, 0x1E, 0x01,
+	0xE0, 0x1E, 0x01, 0xE0, 0x0E, 0x50, 0xBF, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0,
+	0x0E, 0xE0, 0x0E, 0xA0, 0x0E, 0xB5, 0x6E, 0x2F, 0xDA, 0xB0, 0x02, 0x9D, 0x01, 0xD2, 0xC0, 0xB0,
+	0x74, 0x38, 0x0E, 0x1C, 0x02, 0xCA, 0x00, 0x3B, 0x40, 0x0B, 0xC0, 0x01, 0xE0, 0x00, 0xB0, 0x0F,
+	0x00, 0xD7, 0x41, 0xF0, 0x1C, 0x38, 0x2B, 0x42, 0x82, 0xC3, 0x68, 0x38, 0x1C, 0x71, 0xC7, 0x40,
+	0xDA, 0x0D, 0xB0, 0x0A, 0xD0, 0xAE, 0x00, 0x7C, 0x07, 0xD0, 0x03, 0x80, 0x3C, 0x00, 0x78, 0x07,
+	0x4B, 0x43, 0x80, 0xB2, 0x80, 0x1E, 0xD0, 0x02, 0xE0, 0x01, 0xED, 0x00, 0xE2, 0xD0, 0xB0, 0x38,
+	0x74, 0x07, 0x80, 0xB0, 0x02, 0x8E, 0x01, 0xD2, 0xC0, 0xB0, 0x74, 0x38, 0x0F, 0x1C, 0x01, 0xDE,
+	0x00, 0x3B, 0x40, 0x0B, 0x80, 0x01, 0xD0, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x3F, 0xFE,
+	0x15, 0x6D, 0x00, 0x74, 0x00, 0xE0, 0x02, 0xC0, 0x07, 0x40, 0x1D, 0x00, 0x39, 0x54, 0x7F, 0xFE,
+	0x06, 0x4B, 0x42, 0x80, 0xA0, 0x28, 0x0B, 0x01, 0xC0, 0xA0, 0xB4, 0x0B, 0x01, 0xC0, 0xB0, 0x28,
+	0x0A, 0x02, 0x80, 0x79, 0x06, 0x40, 0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD0, 0x68,
+	0x06, 0x80, 0x74, 0x1D, 0x07, 0x02, 0xC0, 0xA0, 0x1D, 0x02, 0xC1, 0xC0, 0xA0, 0x2C, 0x07, 0x01,
+	0xD0, 0x74, 0xB8, 0x24, 0x00, 0x19, 0x03, 0x5F, 0xFA, 0xCE, 0x0A, 0x91, 0x00, 0x00,
+};
+
+static const Glyph_t font_sans_18_glyphs[] = {
+	{0, 0, 0, 0, 0, 3, 0},	/* ' ' */
+	{0, 2, 13, 2, 2, 6, 0},	/* '!' */
+	{5, 5, 5, 1, 2, 7, 1},	/* '"' */
+	{12, 10, 13, 0, 2, 10, 1},	/* '#' */
+	{45, 9, 18, 1, 0, 10, 1},	/* '$' */
+	{86, 14, 14, 0, 2, 14, 1},	/* '%' */
+	{135, 13, 14, 0, 2, 13, 1},	/* '&' */
+	{181, 2, 5, 1, 2, 4, 0},	/* '\'' */
+	{183, 4, 17, 1, 1, 5, 1},	/* '(' */
+	{200, 4, 17, 0, 1, 5, 1},	/* ')' */
+	{217, 5, 7, 1, 1, 7, 1},	/* '*' */
+	{226, 9, 10, 1, 4, 10, 1},	/* '+' */
+	{249, 2, 5, 1, 13, 4, 1},	/* ',' */
+	{252, 5, 2, 1, 9, 6, 0},	/* '-' */
+	{255, 2, 2, 1, 13, 4, 1},	/* '.' */
+	{256, 7, 15, 0, 1, 7, 1},	/* '/' */
+	{283, 10, 13, 0, 2, 10, 1},	/* '0' */
+	{316, 8, 13, 2, 2, 10, 1},	/* '1' */
+	{342, 9, 13, 1, 2, 10, 1},	/* '2' */
+	{372, 9, 14, 1, 2, 10, 1},	/* '3' */
+	{404, 10, 13, 0, 2, 10, 1},	/* '4' */
+	{437, 9, 14, 1, 2, 10, 1},	/* '5' */
+	{469, 9, 14, 1, 2, 10, 1},	/* '6' */
+	{501, 9, 13, 1, 2, 10, 1},	/* '7' */
+	{531, 9, 14, 1, 2, 10, 1},	/* '8' */
+	{563, 9, 13, 1, 2, 10, 1},	/* '9' */
+	{593, 3, 9, 1, 6, 5, 1},	/* ':' */
+	{600, 3, 12, 1, 6, 5, 1},	/* ';' */
+	{609, 8, 8, 1, 5, 10, 1},	/* '<' */
+	{625, 8, 5, 1, 6, 10, 0},	/* '=' */
+	{632, 7, 8, 2, 5, 10, 1},	/* '>' */
+	{646, 7, 13, 0, 2, 7, 1},	/* '?' */
+	{669, 14, 16, 0, 2, 15, 1},	/* '@' */
+	{725, 12, 13, 0, 2, 12, 1},	/* 'A' */
+	{764, 10, 13, 1, 2, 12, 1},	/* 'B' */
+	{797, 12, 13, 0, 2, 12, 1},	/* 'C' */
+	{836, 12, 13, 1, 2, 14, 1},	/* 'D' */
+	{875, 9, 13, 1, 2, 10, 1},	/* 'E' */
+	{905, 9, 13, 1, 2, 10, 1},	/* 'F' */
+	{935, 12, 14, 0, 2, 13, 1},	/* 'G' */
+	{977, 11, 13, 1, 2, 14, 1},	/* 'H' */
+	{1013, 2, 13, 2, 2, 6, 1},	/* 'I' */
+	{1020, 7, 14, 0, 2, 8, 1},	/* 'J' */
+	{1045, 11, 13, 1, 2, 12, 1},	/* 'K' */
+	{1081, 8, 13, 1, 2, 9, 1},	/* 'L' */
+	{1107, 14, 13, 1, 2, 17, 1},	/* 'M' */
+	{1153, 11, 13, 1, 2, 14, 1},	/* 'N' */
+	{1189, 14, 13, 0, 2, 14, 1},	/* 'O' */
+	{1235, 10, 13, 1, 2, 11, 1},	/* 'P' */
+	{1268, 14, 16, 0, 2, 14, 1},	/* 'Q' */
+	{1324, 10, 13, 1, 2, 12, 1},	/* 'R' */
+	{1357, 9, 14, 0, 2, 10, 1},	/* 'S' */
+	{1389, 11, 13, 0, 2, 11, 1},	/* 'T' */
+	{1425, 11, 14, 1, 2, 13, 1},	/* 'U' */
+	{1464, 12, 13, 0, 2, 12, 1},	/* 'V' */
+	{1503, 18, 13, 0, 2, 18, 1},	/* 'W' */
+	{1562, 11, 13, 0, 2, 12, 1},	/* 'X' */
+	{1598, 11, 13, 0, 2, 11, 1},	/* 'Y' */
+	{1634, 11, 13, 0, 2, 11, 1},	/* 'Z' */
+	{1670, 4, 17, 1, 1, 5, 1},	/* '[' */
+	{1687, 7, 15, 0, 1, 7, 1},	/* '\\' */
+	{1714, 4, 17, 0, 1, 5, 1},	/* ']' */
+	{1731, 8, 6, 1, 2, 10, 1},	/* '^' */
+	{1743, 7, 2, 0, 16, 7, 0},	/* '_' */
+	{1745, 4, 3, 0, 2, 6, 1},	/* '`' */
+	{1748, 8, 11, 0, 5, 9, 1},	/* 'a' */
+	{1770, 9, 14, 1, 1, 10, 1},	/* 'b' */
+	{1802, 8, 10, 0, 5, 8, 1},	/* 'c' */
+	{1822, 9, 14, 0, 1, 10, 1},	/* 'd' */
+	{1854, 9, 10, 0, 5, 9, 1},	/* 'e' */
+	{1877, 6, 13, 0, 2, 6, 1},	/* 'f' */
+	{1897, 9, 14, 0, 5, 9, 1},	/* 'g' */
+	{1929, 8, 14, 1, 1, 10, 1},	/* 'h' */
+	{1957, 3, 13, 1, 2, 5, 1},	/* 'i' */
+	{1967, 5, 17, 0, 2, 5, 1},	/* 'j' */
+	{1989, 8, 14, 1, 1, 9, 1},	/* 'k' */
+	{2017, 2, 14, 1, 1, 5, 1},	/* 'l' */
+	{2024, 13, 10, 1, 5, 15, 1},	/* 'm' */
+	{2057, 8, 10, 1, 5, 10, 1},	/* 'n' */
+	{2077, 10, 10, 0, 5, 10, 1},	/* 'o' */
+	{2102, 9, 13, 1, 5, 10, 1},	/* 'p' */
+	{2132, 9, 13, 0, 5, 10, 1},	/* 'q' */
+	{2162, 6, 10, 1, 5, 7, 1},	/* 'r' */
+	{2177, 7, 11, 0, 5, 8, 1},	/* 's' */
+	{2197, 6, 12, 0, 3, 7, 1},	/* 't' */
+	{2215, 8, 9, 1, 6, 10, 1},	/* 'u' */
+	{2233, 9, 9, 0, 6, 9, 1},	/* 'v' */
+	{2254, 14, 9, 0, 6, 14, 1},	/* 'w' */
+	{2286, 9, 9, 0, 6, 9, 1},	/* 'x' */
+	{2307, 9, 12, 0, 6, 9, 1},	/* 'y' */
+	{2334, 8, 9, 0, 6, 8, 1},	/* 'z' */
+	{2352, 5, 17, 0, 1, 5, 1},	/* '{' */
+	{2374, 2, 17, 2, 1, 5, 1},	/* '|' */
+	{2383, 5, 17, 0, 1, 5, 1},	/* '}' */
+	{2405, 9, 4, 1, 8, 10, 1},	/* '~' */
+};
+
+const FontAA_t font_sans_18 = {2, 19, 32, 95, font_sans_18_glyphs, font_sans_18_data, sizeof(font_sans_18_data)};
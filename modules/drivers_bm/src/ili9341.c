@@ -26,6 +26,23 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 21/11/2018 | Document creation		                         |
+ * | 17/10/2026 | SPI port configured once, commands streamed    |
+ *            | through a single session per drawing           |
+ * | 17/10/2026 | Glyph cache, strings sent in one window and    |
+ *            | one transfer                                   |
+ * | 17/10/2026 | Drawings grouped in one session, pixels sent   |
+ *            | from the caller buffer without waiting         |
+ * | 17/10/2026 | Lines and circles sent as runs of pixels, band |
+ *            | buffer to compose several drawings             |
+ * | 17/10/2026 | All drawings composed in the band, two band    |
+ *            | buffers sent alternately by the DMA            |
+ * | 17/10/2026 | Pixels kept as native colors and sent in 16    |
+ *            | bits frames, pictures sent from their memory   |
+ * | 17/10/2026 | Compressed images and sprites decoded into the |
+ *            | band or while they are sent                    |
+ * | 17/10/2026 | Anti-aliased text, characters decoded and      |
+ *            | blended into the band or while they are sent   |
+ * | 17/10/2026 | Vertical scrolling area and start address      |
  *
  */
 
@@ -35,6 +52,7 @@
 #include "gpio.h"
 #include "delay.h"
 #include "chip.h"
+#include <string.h>
 
 /*****************************************************************************
  * Private macros/types/enumerations/variables definitions
@@ -44,14 +62,29 @@
 	#define NULL 0
 #endif
 
-#define SPI_BR 51000000				/*!< Frequency of sck for SPI communication */
 #define MAX_PIXEL 320*240*2			/*!< Maximum number of bytes to write on LCD */
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
+#define MAX_VALUE_PIXELS (MAX_VALUE_SIZE / 2)	/*!< Pixels in a data array */
+#define MAX_TRANSFER 65520			/*!< Maximum number of bytes of a SPI write */
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
 #define UP -1						/*!< Vertical grow direction */
+#define DC_COMMAND 0				/*!< DC line level to send commands */
+#define DC_DATA 1					/*!< DC line level to send parameters or data */
+#define STAGE_SIZE 32				/*!< Size of the staging buffers for commands and parameters */
+#define IMAGE_INDEX 0x00			/*!< Image operation 00iiiiii, color of the index */
+#define IMAGE_DIFF 0x40				/*!< Image operation 01rrggbb, small difference */
+#define IMAGE_LUMA 0x80				/*!< Image operation 10gggggg rrrrbbbb, difference */
+#define IMAGE_RUN 0xC0				/*!< Image operation 11nnnnnn, previous color repeated */
+#define IMAGE_COLOR 0xFE			/*!< Image operation followed by a color */
+#define IMAGE_OP_MASK 0xC0			/*!< Bits of the image operation code */
+#define IMAGE_OPAQUE 0x10000		/*!< Transparent color that matches no pixel */
+#define GLYPH_FORE 0x40				/*!< Character code 01nnnnnn, run of foreground, else background */
+#define GLYPH_BLEND 0x80			/*!< Character code 1nnncccc, run of coverage c */
+#define TEXT_LEVELS 16				/*!< Coverages of the fonts with most bits per pixel */
+#define TEXT_PIXELS (ILI9341_HEIGHT * 2)	/*!< Pixels of each text buffer, two rows of the widest cell */
 
 /* Command List */
 #define SEND_PIXELS			0X00
@@ -66,7 +99,9 @@
 #define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
 #define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
 #define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define VERT_SCROLL_DEF		0x33 	/*!< Defines the fixed top and bottom areas and the vertical scrolling area */
 #define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
+#define VERT_SCROLL_START	0x37 	/*!< Row of frame memory shown at the top of the vertical scrolling area */
 #define PIXEL_FORMAT_SET	0x3A 	/*!< Sets the pixel format for the RGB image data used by the interface */
 #define WRITE_DISP_BRIGHT	0x51 	/*!< Adjust the brightness value of the display */
 #define WRITE_CTRL_DISP		0x53 	/*!< Control display brightness */
@@ -90,6 +125,7 @@
 
 #define HighByte(x) x >> 8			/*!< High byte of a 16 bits data */
 #define LowByte(x) x & 0xFF			/*!< Low byte of a 16 bits data */
+#define ImageHash(r, g, b) (((r) * 3 + (g) * 5 + (b) * 7) & 0x3F)	/*!< Index position of a color */
 
 /**
  * @brief  Structure with LCD orientation properties
@@ -111,6 +147,108 @@ typedef struct
     uint8_t *data;			/*!< Pointer to data or parameters array */
 } lcd_cmd_t;
 
+/**
+ * @brief SPI session with the LCD
+ *
+ * Commands and short parameters are copied to a staging buffer and sent together while
+ * the DC level does not change, one staging buffer is filled while the other is sent.
+ * Longer data is sent straight from the caller buffer.
+ */
+typedef struct
+{
+	uint8_t depth;						/*!< Nesting level of SessionBegin calls */
+	uint8_t dc;							/*!< Current DC line level */
+	uint8_t stage_dc;					/*!< DC level of the staged bytes */
+	uint8_t stage_index;				/*!< Staging buffer being filled */
+	uint8_t stage_count;				/*!< Number of staged bytes */
+	uint8_t stage[2][STAGE_SIZE];		/*!< Staging buffers */
+} lcd_session_t;
+
+/**
+ * @brief Glyph stored in the glyph cache
+ */
+typedef struct
+{
+	const Font_t * font;				/*!< Font of the glyph, NULL when the entry is free */
+	uint16_t foreground;				/*!< Foreground color */
+	uint16_t background;				/*!< Background color */
+	char data;							/*!< Character */
+	uint32_t offset;					/*!< Offset of the RGB565 pixels in the glyphs memory */
+} lcd_glyph_t;
+
+/**
+ * @brief Glyph cache
+ *
+ * The index is direct mapped, a glyph replaces the one with the same hash. The glyphs memory
+ * is used as a ring, the glyphs stored where a new one goes are discarded.
+ */
+typedef struct
+{
+	lcd_glyph_t * index;				/*!< Index of ILI9341_GLYPH_CACHE_ENTRIES glyphs */
+	uint8_t * line;						/*!< Buffer where the strings are composed */
+	uint32_t line_size;					/*!< Size of the line buffer */
+	uint8_t * glyphs;					/*!< Memory for the expanded glyphs */
+	uint32_t next;						/*!< Offset where the next glyph is stored */
+	ili9341_glyph_stats_t stats;		/*!< Statistics, stats.size is the glyphs memory size */
+} lcd_glyph_cache_t;
+
+/**
+ * @brief Band buffer
+ *
+ * While a band is open the drawings are composed in memory instead of being sent. The band
+ * covers the whole width of the LCD and the rows from y0 to y1. With two memories a band is
+ * composed in one while the DMA sends the other.
+ */
+typedef struct
+{
+	uint16_t * memory[2];				/*!< Pixels of the bands, converted with ILI9341_PIXEL */
+	uint32_t size;						/*!< Size of each memory in bytes */
+	uint8_t buffers;					/*!< Number of memories */
+	uint8_t current;					/*!< Memory of the open band */
+	uint8_t open;						/*!< A band is being composed */
+	uint16_t y0;						/*!< First row of the band */
+	uint16_t y1;						/*!< Last row of the band */
+} lcd_band_t;
+
+/**
+ * @brief Decoding position of a compressed image
+ */
+typedef struct
+{
+	const ili9341_image_t * image;		/*!< Image being decoded, NULL when the decoder is free */
+	const uint8_t * next;				/*!< Next operation */
+	uint32_t pixel;						/*!< Number of pixels decoded */
+	uint16_t color;						/*!< Last decoded color */
+	uint8_t run;						/*!< Pixels left of the current operation */
+	uint16_t index[64];					/*!< Colors seen, by hash */
+} lcd_image_decoder_t;
+
+/**
+ * @brief Decoding position of a character of an anti-aliased font
+ */
+typedef struct
+{
+	const Glyph_t * glyph;				/*!< Character being decoded */
+	const uint8_t * next;				/*!< Next code or byte of packed coverages */
+	uint8_t bpp;						/*!< Bits per coverage */
+	uint8_t run;						/*!< Pixels left of the current code */
+	uint8_t level;						/*!< Coverage of the current code */
+	uint8_t bits;						/*!< Byte of packed coverages being decoded */
+	uint8_t shift;						/*!< Bits of that byte not decoded yet */
+} lcd_text_decoder_t;
+
+/**
+ * @brief Decoders of the last images drawn
+ *
+ * A band decodes only its rows of each image, the decoder keeps the position so the next
+ * band goes on from there. A new image takes the decoders in turn.
+ */
+typedef struct
+{
+	lcd_image_decoder_t decoder[ILI9341_IMAGE_DECODERS];	/*!< Decoders */
+	uint8_t next;						/*!< Decoder taken by the next new image */
+} lcd_image_cache_t;
+
 /**
  * @brief Initial LCD configuration parameters
  */
@@ -171,7 +309,7 @@ lcd_cmd_t lcd_on = {DISPLAY_ON, 0, NULL};		/*!< Exit sleep mode */
 /*
  * @brief: SPI port configuration compatible with LCD interface
  */
-spiConfig_t spi_conf = {SPI_1, MASTER, MODE0, SPI_BR, SPI_DMA, NULL};
+spiConfig_t spi_conf = {SPI_1, MASTER, MODE0, ILI9341_SPI_BITRATE, SPI_DMA, NULL};
 
 spiPort_t ili9341_spi;							/*!< uC SPI port */
 gpioPin_t ili9341_cs, ili9341_dc, ili9341_rst;	/*!< uC GPIO ports to use as CS, DC and RST */
@@ -183,6 +321,11 @@ orientation_properties_t lcd_orientation =
 		ILI9341_Portrait_1
 };												/*!< Default orientation configuration */
 
+lcd_session_t lcd_session;						/*!< SPI session with the LCD */
+lcd_glyph_cache_t lcd_glyph_cache;				/*!< Glyph cache, disabled until it gets memory */
+lcd_band_t lcd_band;							/*!< Band buffer, disabled until it gets memory */
+lcd_image_cache_t lcd_images;					/*!< Decoders of compressed images */
+
 /*****************************************************************************
  * Public types/enumerations/variables declarations
  ****************************************************************************/
@@ -198,6 +341,52 @@ orientation_properties_t lcd_orientation =
  */
 void SetChipSelect(uint8_t state);
 
+/**
+ * @brief  		Start a drawing operation, the first call selects the LCD
+ * @retval 		None
+ */
+void SessionBegin(void);
+
+/**
+ * @brief  		End a drawing operation, the last call sends the staged bytes, waits the
+ * 				end of the transfers and deselects the LCD
+ * @retval 		None
+ */
+void SessionEnd(void);
+
+/**
+ * @brief  		Copy bytes to the staging buffer, sending the staged ones first when the DC
+ * 				level changes or they don't fit
+ * @param[in]  	dc: DC line level for the bytes
+ * @param[in]  	data: Bytes to send
+ * @param[in]  	size: Number of bytes
+ * @retval 		None
+ */
+void SessionPush(uint8_t dc, uint8_t * data, uint32_t size);
+
+/**
+ * @brief  		Send the staged bytes
+ * @retval 		None
+ */
+void SessionFlush(void);
+
+/**
+ * @brief  		Set the DC line level, waiting for the previous transfer when it changes
+ * @param[in]  	dc: DC line level for the next bytes
+ * @retval 		None
+ */
+void SessionSelect(uint8_t dc);
+
+/**
+ * @brief  		Start a transfer, waiting for the previous one before changing the DC level.
+ * 				The data must not change until the next transfer starts or the session ends
+ * @param[in]  	dc: DC line level for the bytes
+ * @param[in]  	data: Bytes to send
+ * @param[in]  	size: Number of bytes
+ * @retval 		None
+ */
+void SessionTransmit(uint8_t dc, uint8_t * data, uint32_t size);
+
 /**
  * @brief  		Send command and parameters/data to LCD
  * @param[in]  	data: Structure with the command and parameters/data to send
@@ -205,6 +394,16 @@ void SetChipSelect(uint8_t state);
  */
 void WriteLCD(lcd_cmd_t * data);
 
+/**
+ * @brief  		Send pixels after a memory write command, in 16 bits frames when
+ * 				ILI9341_SPI_16BIT is 1. Inside a session the pixels must not change until the
+ * 				next transfer starts or the session ends
+ * @param[in]  	pixels: Pixels converted with ILI9341_PIXEL
+ * @param[in]  	count: Number of pixels, up to 32760
+ * @retval 		None
+ */
+void SendPixels(uint16_t * pixels, uint32_t count);
+
 /**
  * @brief  		Define an area of frame memory where MCU can access
  * @param[in]  	x1: Start column
@@ -226,6 +425,234 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  */
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Expand the bits of a character to pixels converted with ILI9341_PIXEL
+ * @param[in]  	font: Font of the character
+ * @param[in]  	data: Character
+ * @param[in]  	foreground: Color for the bits set
+ * @param[in]  	background: Color for the bits clear
+ * @param[out] 	pixels: Where the first row of pixels is stored
+ * @param[in]  	stride: Pixels from the start of a row to the start of the next one
+ * @retval 		None
+ */
+void ExpandGlyph(const Font_t * font, char data, uint16_t foreground, uint16_t background,
+	uint16_t * pixels, uint32_t stride);
+
+/**
+ * @brief  		Find a glyph in the cache, expanding and storing it if is not there
+ * @param[in]  	font: Font of the character
+ * @param[in]  	data: Character
+ * @param[in]  	foreground: Foreground color
+ * @param[in]  	background: Background color
+ * @retval 		Pixels of the glyph, NULL if the glyph is bigger than the cache
+ */
+uint8_t * GlyphLookup(const Font_t * font, char data, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draw a string composing runs of characters in the line buffer of the glyph cache
+ * @param[in] 	x: X position of top left corner of first character in string
+ * @param[in]  	y: Y position of top left corner of first character in string
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for string
+ * @param[in]  	background: Color for string background
+ * @retval 		None
+ */
+void DrawStringCached(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Fill the part of an area inside the open band
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void BandFill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Expand the rows of a character inside the open band
+ * @param[in] 	x: X position of top left corner of the character
+ * @param[in]  	y: Y position of top left corner of the character
+ * @param[in]  	data: Character
+ * @param[in]  	font: Font of the character
+ * @param[in]  	foreground: Color for the bits set
+ * @param[in]  	background: Color for the bits clear
+ * @retval 		None
+ */
+void BandGlyph(uint16_t x, uint16_t y, char data, const Font_t * font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Copy the rows of a picture inside the open band
+ * @param[in] 	x: X position of top left corner of the picture
+ * @param[in]  	y: Y position of top left corner of the picture
+ * @param[in] 	width: Picture width in pixels
+ * @param[in]  	height: Picture height in pixels
+ * @param[in]  	pic: RGB565 pixels, high byte first
+ * @retval 		None
+ */
+void BandPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t * pic);
+
+/**
+ * @brief  		Draw a run of pixels in one address window, clipped to the LCD
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void Span(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draw a line as horizontal runs, or vertical runs when it is steep
+ * @param[in]  	x0: X coordinate of starting point
+ * @param[in]  	y0: Y coordinate of starting point
+ * @param[in]  	x1: X coordinate of ending point
+ * @param[in]  	y1: Y coordinate of ending point
+ * @param[in]  	color: Line color
+ * @retval 		None
+ */
+void LineSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draw a circle as runs of pixels, the same pixels of the midpoint algorithm
+ * @param[in]  	x0: X coordinate of center circle point
+ * @param[in]  	y0: Y coordinate of center circle point
+ * @param[in]  	r: Circle radius
+ * @param[in]  	color: Circle color
+ * @param[in]  	filled: 1 to draw a filled circle
+ * @retval 		None
+ */
+void CircleSpans(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint8_t filled);
+
+/**
+ * @brief  		Get the decoder of an image positioned at a pixel. Going forward continues
+ * 				from the last position, going back decodes again from the start
+ * @param[in]  	image: Compressed image
+ * @param[in]  	pixel: Index of the next pixel to decode, row after row
+ * @retval 		Decoder of the image
+ */
+lcd_image_decoder_t * ImageSeek(const ili9341_image_t * image, uint32_t pixel);
+
+/**
+ * @brief  		Decode the next pixels of an image
+ * @param[in]  	decoder: Decoder of the image
+ * @param[out] 	pixels: Where the pixels are stored converted with ILI9341_PIXEL, NULL to skip
+ * 				them
+ * @param[in]  	count: Number of pixels
+ * @param[in]  	transparent: Color of the pixels left unchanged, IMAGE_OPAQUE to store all
+ * @retval 		None
+ */
+void ImageDecode(lcd_image_decoder_t * decoder, uint16_t * pixels, uint32_t count, uint32_t transparent);
+
+/**
+ * @brief  		Decode the rows of an image inside the open band
+ * @param[in] 	x: X position of top left corner of the image
+ * @param[in]  	y: Y position of top left corner of the image
+ * @param[in]  	image: Compressed image
+ * @param[in]  	transparent: Color of the pixels left unchanged, IMAGE_OPAQUE to draw all
+ * @retval 		None
+ */
+void BandImage(uint16_t x, uint16_t y, const ili9341_image_t * image, uint32_t transparent);
+
+/**
+ * @brief  		Send an image in blocks of rows decoded into the band memories
+ * @param[in] 	x: X position of top left corner of the image
+ * @param[in]  	y: Y position of top left corner of the image
+ * @param[in]  	columns: Columns of the image inside the LCD
+ * @param[in]  	rows: Rows of the image inside the LCD
+ * @param[in]  	image: Compressed image
+ * @retval 		None
+ */
+void ImageBlocks(uint16_t x, uint16_t y, uint16_t columns, uint16_t rows, const ili9341_image_t * image);
+
+/**
+ * @brief  		Send an image decoded into two small buffers, one window for the whole image or
+ * 				one for each run of visible pixels of a row
+ * @param[in] 	x: X position of top left corner of the image
+ * @param[in]  	y: Y position of top left corner of the image
+ * @param[in]  	columns: Columns of the image inside the LCD
+ * @param[in]  	rows: Rows of the image inside the LCD
+ * @param[in]  	image: Compressed image
+ * @param[in]  	transparent: Color of the pixels not sent, IMAGE_OPAQUE to send all
+ * @retval 		None
+ */
+void ImageRuns(uint16_t x, uint16_t y, uint16_t columns, uint16_t rows, const ili9341_image_t * image,
+	uint32_t transparent);
+
+/**
+ * @brief  		Mix the foreground and background of a text for every coverage of its font
+ * @param[in]  	font: Anti-aliased font
+ * @param[in]  	foreground: Color for text
+ * @param[in]  	background: Color for text background
+ * @param[out] 	palette: Colors converted with ILI9341_PIXEL, from background to foreground
+ * @retval 		None
+ */
+void TextPalette(const FontAA_t * font, uint16_t foreground, uint16_t background, uint16_t * palette);
+
+/**
+ * @brief  		Get a character of an anti-aliased font
+ * @param[in]  	font: Anti-aliased font
+ * @param[in]  	data: Character
+ * @retval 		Character of the font, NULL when the font does not have it
+ */
+const Glyph_t * TextGlyph(const FontAA_t * font, char data);
+
+/**
+ * @brief  		Start decoding a character from its first pixel
+ * @param[out] 	decoder: Decoder of the character
+ * @param[in]  	font: Anti-aliased font
+ * @param[in]  	glyph: Character of the font
+ * @retval 		None
+ */
+void GlyphBegin(lcd_text_decoder_t * decoder, const FontAA_t * font, const Glyph_t * glyph);
+
+/**
+ * @brief  		Decode the next pixels of the box with ink of a character
+ * @param[in]  	decoder: Decoder of the character
+ * @param[in]  	palette: Colors of the coverages
+ * @param[out] 	pixels: Where the colors are stored, NULL to skip them
+ * @param[in]  	count: Number of pixels
+ * @retval 		None
+ */
+void GlyphDecode(lcd_text_decoder_t * decoder, const uint16_t * palette, uint16_t * pixels, uint32_t count);
+
+/**
+ * @brief  		Decode a row of the cell of a character, the rows must be decoded in order
+ * @param[in]  	decoder: Decoder of the character
+ * @param[in]  	palette: Colors of the coverages
+ * @param[out] 	pixels: Where the colors are stored
+ * @param[in]  	row: Row of the cell
+ * @param[in]  	columns: Columns of the cell inside the LCD
+ * @retval 		None
+ */
+void GlyphRow(lcd_text_decoder_t * decoder, const uint16_t * palette, uint16_t * pixels, uint16_t row,
+	uint16_t columns);
+
+/**
+ * @brief  		Decode the rows of a character cell inside the open band
+ * @param[in] 	x: X position of top left corner of the cell
+ * @param[in]  	y: Y position of top left corner of the cell
+ * @param[in]  	glyph: Character of the font
+ * @param[in]  	font: Anti-aliased font
+ * @param[in]  	palette: Colors of the coverages
+ * @retval 		None
+ */
+void BandText(uint16_t x, uint16_t y, const Glyph_t * glyph, const FontAA_t * font, const uint16_t * palette);
+
+/**
+ * @brief  		Send a character cell in one window, several rows per transfer
+ * @param[in] 	x: X position of top left corner of the cell
+ * @param[in]  	y: Y position of top left corner of the cell
+ * @param[in]  	glyph: Character of the font
+ * @param[in]  	font: Anti-aliased font
+ * @param[in]  	palette: Colors of the coverages
+ * @retval 		None
+ */
+void GlyphSend(uint16_t x, uint16_t y, const Glyph_t * glyph, const FontAA_t * font, const uint16_t * palette);
+
 /*****************************************************************************
  * Private functions declarations
  ****************************************************************************/
@@ -234,97 +661,1089 @@ void SetChipSelect(uint8_t state)
 {
 	if(state)
 	{
-		GPIOSetHigh(ili9341_cs);
+		GPIOSetHigh(ili9341_cs);
+	}
+	else
+	{
+		GPIOSetLow(ili9341_cs);
+	}
+}
+
+#if (ILI9341_SPI_SESSION == 1)
+void SessionBegin(void)
+{
+	if (lcd_session.depth++ == 0)
+	{
+		GPIOSetLow(ili9341_cs);
+	}
+}
+
+void SessionEnd(void)
+{
+	if (--lcd_session.depth == 0)
+	{
+		SessionFlush();
+		/* Wait until the last byte is sent before deselecting the LCD */
+		while(!SpiFree(ili9341_spi));
+		GPIOSetHigh(ili9341_cs);
+	}
+}
+
+void SessionPush(uint8_t dc, uint8_t * data, uint32_t size)
+{
+	if ((lcd_session.stage_count > 0) &&
+		((lcd_session.stage_dc != dc) || (lcd_session.stage_count + size > STAGE_SIZE)))
+	{
+		SessionFlush();
+	}
+	memcpy(&lcd_session.stage[lcd_session.stage_index][lcd_session.stage_count], data, size);
+	lcd_session.stage_count += size;
+	lcd_session.stage_dc = dc;
+}
+
+void SessionFlush(void)
+{
+	if (lcd_session.stage_count > 0)
+	{
+		SessionTransmit(lcd_session.stage_dc, lcd_session.stage[lcd_session.stage_index],
+			lcd_session.stage_count);
+		/* Next bytes go to the other buffer while this one is sent */
+		lcd_session.stage_index ^= 1;
+		lcd_session.stage_count = 0;
+	}
+}
+
+void SessionSelect(uint8_t dc)
+{
+	/* LCD samples DC with the last bit of each byte, so the previous transfer must end first */
+	if (lcd_session.dc != dc)
+	{
+		while(!SpiFree(ili9341_spi));
+		if (dc == DC_DATA)
+		{
+			GPIOSetHigh(ili9341_dc);
+		}
+		else
+		{
+			GPIOSetLow(ili9341_dc);
+		}
+		lcd_session.dc = dc;
+	}
+}
+
+void SessionTransmit(uint8_t dc, uint8_t * data, uint32_t size)
+{
+	SessionSelect(dc);
+	/* SpiWrite waits for the previous transfer, meanwhile the CPU prepares the next data */
+	SpiWrite(ili9341_spi, data, size);
+}
+
+void WriteLCD(lcd_cmd_t * data)
+{
+	SessionBegin();
+	/* If command is NULL don't send command */
+	if (data->cmd != SEND_PIXELS)
+	{
+		SessionPush(DC_COMMAND, &data->cmd, 1);
+	}
+	/* If there are parameters or data to send */
+	if (data->databytes > 0)
+	{
+		/* Short parameters are copied, so they can be on the caller stack */
+		if (data->databytes <= STAGE_SIZE)
+		{
+			SessionPush(DC_DATA, data->data, data->databytes);
+		}
+		else
+		{
+			SessionFlush();
+			SessionTransmit(DC_DATA, data->data, data->databytes);
+		}
+	}
+	SessionEnd();
+}
+
+void SendPixels(uint16_t * pixels, uint32_t count)
+{
+	SessionBegin();
+	SessionFlush();
+	SessionSelect(DC_DATA);
+#if (ILI9341_SPI_16BIT == 1)
+	/* The SPI switches to 16 bits frames after the staged commands are sent */
+	SpiWrite16(ili9341_spi, pixels, count);
+#else
+	SpiWrite(ili9341_spi, (uint8_t *) pixels, count * 2);
+#endif
+	SessionEnd();
+}
+#else
+void SessionBegin(void)
+{
+}
+
+void SessionEnd(void)
+{
+}
+
+void WriteLCD(lcd_cmd_t * data)
+{
+	SpiInit(spi_conf);
+	/* If command is NULL don't send command */
+	if (data->cmd != NULL)
+	{
+		/* Send command */
+		GPIOSetLow(ili9341_dc);
+		SpiWrite(ili9341_spi, &data->cmd, 1);
+	}
+	/* If there are parameters or data to send */
+	if (data->databytes != NULL)
+	{
+		/* Send parameters or data */
+		GPIOSetHigh(ili9341_dc);
+		SpiWrite(ili9341_spi, data->data, data->databytes);
+	}
+}
+
+void SendPixels(uint16_t * pixels, uint32_t count)
+{
+	SpiInit(spi_conf);
+	GPIOSetHigh(ili9341_dc);
+#if (ILI9341_SPI_16BIT == 1)
+	SpiWrite16(ili9341_spi, pixels, count);
+#else
+	SpiWrite(ili9341_spi, (uint8_t *) pixels, count * 2);
+#endif
+}
+#endif
+
+void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	static uint16_t aux;
+	/* The lower column must be send first */
+	if (x0 > x1)
+	{
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	/* The lower row must be send first */
+	if (y0 > y1)
+	{
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	uint8_t columns[] = {HighByte(x0), LowByte(x0), HighByte(x1), LowByte(x1)};
+	lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
+	uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
+	lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
+	WriteLCD(&lcd_columns);
+	WriteLCD(&lcd_rows);
+}
+
+void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+	static uint16_t i;
+	static int32_t pixels_count;
+	static int16_t x_dist, y_dist;
+	static uint16_t pixel[MAX_VALUE_PIXELS];
+
+	/* Inside a band the area is composed in memory */
+	if (lcd_band.open)
+	{
+		BandFill(x0, y0, x1, y1, color);
+		return;
+	}
+
+	x_dist = x1 - x0;
+	y_dist = y1 - y0;
+	if (x0 > x1)
+	{
+		x_dist = - x_dist;
+	}
+	if (y0 > y1)
+	{
+		y_dist = - y_dist;
+	}
+	/* Number of pixels to write */
+	pixels_count = (x_dist + 1) * (y_dist + 1);
+	SessionBegin();
+	/* Define area to fill, the previous pixels are out once the window is sent */
+	SetCursorPosition(x0, y0, x1, y1);
+
+	/* The buffer keeps the last color, it is filled again only when the color changes */
+	if (pixel[0] != ILI9341_PIXEL(color))
+	{
+		for (i = 0; i < MAX_VALUE_PIXELS; i++)
+		{
+			pixel[i] = ILI9341_PIXEL(color);
+		}
+	}
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
+	WriteLCD(&lcd_write);
+
+	while(pixels_count - MAX_VALUE_PIXELS > 0)
+	{
+		SendPixels(pixel, MAX_VALUE_PIXELS);
+		pixels_count -= MAX_VALUE_PIXELS;
+	}
+	SendPixels(pixel, pixels_count);
+	SessionEnd();
+}
+
+void ExpandGlyph(const Font_t * font, char data, uint16_t foreground, uint16_t background,
+	uint16_t * pixels, uint32_t stride)
+{
+	uint16_t i, j;
+	uint16_t char_row, fore, back;
+	uint16_t * pixel;
+
+	fore = ILI9341_PIXEL(foreground);
+	back = ILI9341_PIXEL(background);
+	for (i = 0; i < font->FontHeight; i++)
+	{
+		/* each 16bits data of a font character draws a full row of that character */
+		char_row = font->data[(data - ' ') * font->FontHeight + i];
+		pixel = pixels + i * stride;
+		for (j = 0; j < font->FontWidth; j++)
+		{
+			*pixel++ = (char_row & (MSK_BIT16 >> j)) ? fore : back;
+		}
+	}
+}
+
+uint8_t * GlyphLookup(const Font_t * font, char data, uint16_t foreground, uint16_t background)
+{
+	lcd_glyph_t * glyph;
+	uint32_t hash, size, other, i;
+
+	/* Characters of the same font and colors go to consecutive entries */
+	hash = ((uint32_t) (uintptr_t) font ^ ((uint32_t) foreground << 16) ^ background) * 2654435761UL;
+	hash = (hash >> 24) + (uint8_t) (data - ' ');
+	glyph = &lcd_glyph_cache.index[hash & (ILI9341_GLYPH_CACHE_ENTRIES - 1)];
+	if ((glyph->font == font) && (glyph->data == data) &&
+		(glyph->foreground == foreground) && (glyph->background == background))
+	{
+		lcd_glyph_cache.stats.hits++;
+		return &lcd_glyph_cache.glyphs[glyph->offset];
+	}
+	lcd_glyph_cache.stats.misses++;
+
+	size = font->FontWidth * font->FontHeight * 2;
+	if (size > lcd_glyph_cache.stats.size)
+	{
+		return NULL;
+	}
+	/* Glyphs are not split at the end of the memory */
+	if (lcd_glyph_cache.next + size > lcd_glyph_cache.stats.size)
+	{
+		lcd_glyph_cache.next = 0;
+	}
+	/* Discard the glyph with the same hash and the ones stored where the new one goes */
+	for (i = 0; i < ILI9341_GLYPH_CACHE_ENTRIES; i++)
+	{
+		if (lcd_glyph_cache.index[i].font != NULL)
+		{
+			other = lcd_glyph_cache.index[i].font->FontWidth * lcd_glyph_cache.index[i].font->FontHeight * 2;
+			if ((&lcd_glyph_cache.index[i] == glyph) ||
+				((lcd_glyph_cache.index[i].offset < lcd_glyph_cache.next + size) &&
+				(lcd_glyph_cache.index[i].offset + other > lcd_glyph_cache.next)))
+			{
+				lcd_glyph_cache.index[i].font = NULL;
+				lcd_glyph_cache.stats.evictions++;
+				lcd_glyph_cache.stats.glyphs--;
+				lcd_glyph_cache.stats.used -= other;
+			}
+		}
+	}
+
+	glyph->font = font;
+	glyph->data = data;
+	glyph->foreground = foreground;
+	glyph->background = background;
+	glyph->offset = lcd_glyph_cache.next;
+	lcd_glyph_cache.next += size;
+	lcd_glyph_cache.stats.glyphs++;
+	lcd_glyph_cache.stats.used += size;
+	ExpandGlyph(font, data, foreground, background, (uint16_t *) &lcd_glyph_cache.glyphs[glyph->offset],
+		font->FontWidth);
+	return &lcd_glyph_cache.glyphs[glyph->offset];
+}
+
+void DrawStringCached(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background)
+{
+	uint16_t lcd_x, lcd_y;
+	uint32_t row_bytes, stride, count, limit, i, j;
+	uint8_t * pixels;
+
+	lcd_x = x;
+	lcd_y = y;
+	row_bytes = font->FontWidth * 2;
+	limit = lcd_glyph_cache.line_size / (row_bytes * font->FontHeight);
+
+	SessionBegin();
+	while (*str != '\0')	/* End of string */
+	{
+		/* New line, as in ILI9341DrawString */
+		if (*str == '\n')
+		{
+			lcd_y += font->FontHeight + 1;
+			/* if after \n is also \r, than go to the left of the screen */
+			if (*(str + 1) == '\r')
+			{
+				lcd_x = 0;
+				str++;
+			}
+			else
+			{
+				lcd_x = x;
+			}
+			str++;
+			continue;
+		}
+		if (*str == '\r')
+		{
+			str++;
+			continue;
+		}
+
+		/* Characters past the end of the line are wrapped by ILI9341DrawChar */
+		if ((limit == 0) || ((lcd_x + font->FontWidth) > lcd_orientation.width))
+		{
+			ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
+			str++;
+			lcd_x += font->FontWidth;
+			continue;
+		}
+
+		/* Run of characters of the same line that fits in the line buffer */
+		count = 0;
+		while ((str[count] != '\0') && (str[count] != '\n') && (str[count] != '\r') && (count < limit) &&
+			((lcd_x + (count + 1) * font->FontWidth) <= lcd_orientation.width))
+		{
+			count++;
+		}
+
+		/* The previous run may still be being sent from the line buffer */
+		while(!SpiFree(ili9341_spi));
+		stride = count * row_bytes;
+		for (i = 0; i < count; i++)
+		{
+			pixels = GlyphLookup(font, str[i], foreground, background);
+			if (pixels == NULL)
+			{
+				ExpandGlyph(font, str[i], foreground, background, (uint16_t *) &lcd_glyph_cache.line[i * row_bytes],
+					stride / 2);
+			}
+			else
+			{
+				for (j = 0; j < font->FontHeight; j++)
+				{
+					memcpy(&lcd_glyph_cache.line[j * stride + i * row_bytes], &pixels[j * row_bytes], row_bytes);
+				}
+			}
+		}
+
+		/* One window and one transfer for the whole run */
+		SetCursorPosition(lcd_x, lcd_y, lcd_x + count * font->FontWidth - 1, lcd_y + font->FontHeight - 1);
+		lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
+		WriteLCD(&lcd_write);
+		SendPixels((uint16_t *) lcd_glyph_cache.line, count * font->FontWidth * font->FontHeight);
+		str += count;
+		lcd_x += count * font->FontWidth;
+	}
+	SessionEnd();
+}
+
+void BandFill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+	uint16_t aux, x, y;
+	uint16_t pixel;
+	uint16_t * row;
+
+	if (x0 > x1)
+	{
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1)
+	{
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Only the rows of the band are kept */
+	if ((x0 >= lcd_orientation.width) || (y1 < lcd_band.y0) || (y0 > lcd_band.y1))
+	{
+		return;
+	}
+	if (x1 >= lcd_orientation.width)
+	{
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y0 < lcd_band.y0)
+	{
+		y0 = lcd_band.y0;
+	}
+	if (y1 > lcd_band.y1)
+	{
+		y1 = lcd_band.y1;
+	}
+	pixel = ILI9341_PIXEL(color);
+	for (y = y0; y <= y1; y++)
+	{
+		row = lcd_band.memory[lcd_band.current] + (uint32_t) (y - lcd_band.y0) * lcd_orientation.width;
+		for (x = x0; x <= x1; x++)
+		{
+			row[x] = pixel;
+		}
+	}
+}
+
+void BandGlyph(uint16_t x, uint16_t y, char data, const Font_t * font, uint16_t foreground, uint16_t background)
+{
+	uint16_t i, j, first, last, columns;
+	uint16_t char_row, fore, back;
+	uint16_t * pixel;
+
+	if ((x >= lcd_orientation.width) || (y > lcd_band.y1) || (y + font->FontHeight <= lcd_band.y0))
+	{
+		return;
+	}
+	/* Rows of the character inside the band and columns inside the LCD */
+	first = (y < lcd_band.y0) ? lcd_band.y0 - y : 0;
+	last = (y + font->FontHeight - 1 > lcd_band.y1) ? lcd_band.y1 - y : font->FontHeight - 1;
+	columns = (x + font->FontWidth > lcd_orientation.width) ? lcd_orientation.width - x : font->FontWidth;
+	fore = ILI9341_PIXEL(foreground);
+	back = ILI9341_PIXEL(background);
+	for (i = first; i <= last; i++)
+	{
+		char_row = font->data[(data - ' ') * font->FontHeight + i];
+		pixel = lcd_band.memory[lcd_band.current] +
+			(uint32_t) (y + i - lcd_band.y0) * lcd_orientation.width + x;
+		for (j = 0; j < columns; j++)
+		{
+			*pixel++ = (char_row & (MSK_BIT16 >> j)) ? fore : back;
+		}
+	}
+}
+
+void BandPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t * pic)
+{
+	uint16_t i, first, last, columns;
+	uint16_t * row;
+	const uint8_t * data;
+#if (ILI9341_SPI_16BIT == 1)
+	uint16_t j;
+#endif
+
+	if ((x >= lcd_orientation.width) || (y > lcd_band.y1) || (y + height <= lcd_band.y0))
+	{
+		return;
+	}
+	first = (y < lcd_band.y0) ? lcd_band.y0 - y : 0;
+	last = (y + height - 1 > lcd_band.y1) ? lcd_band.y1 - y : height - 1;
+	columns = (x + width > lcd_orientation.width) ? lcd_orientation.width - x : width;
+	for (i = first; i <= last; i++)
+	{
+		row = lcd_band.memory[lcd_band.current] + (uint32_t) (y + i - lcd_band.y0) * lcd_orientation.width + x;
+		data = pic + (uint32_t) i * width * 2;
+#if (ILI9341_SPI_16BIT == 1)
+		/* Pictures are stored high byte first, the band keeps native colors */
+		for (j = 0; j < columns; j++)
+		{
+			row[j] = (uint16_t) ((data[2 * j] << 8) | data[2 * j + 1]);
+		}
+#else
+		/* Pictures are already stored in the order they are sent */
+		memcpy(row, data, columns * 2);
+#endif
+	}
+}
+
+void Span(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	int16_t aux;
+
+	if (x0 > x1)
+	{
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1)
+	{
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Runs outside the LCD are skipped and the rest is cut at the borders */
+	if ((x1 < 0) || (y1 < 0) || (x0 >= lcd_orientation.width) || (y0 >= lcd_orientation.height))
+	{
+		return;
+	}
+	if (x0 < 0)
+	{
+		x0 = 0;
+	}
+	if (y0 < 0)
+	{
+		y0 = 0;
+	}
+	if (x1 >= lcd_orientation.width)
+	{
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y1 >= lcd_orientation.height)
+	{
+		y1 = lcd_orientation.height - 1;
+	}
+	Fill(x0, y0, x1, y1, color);
+}
+
+void LineSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	int16_t run_x, run_y;
+	uint8_t x_major;
+
+	/* Bresenham with y_dist negative, so the error works in every octant */
+	x_dist = (x1 > x0) ? x1 - x0 : x0 - x1;
+	y_dist = (y1 > y0) ? y0 - y1 : y1 - y0;
+	x_grow = (x0 < x1) ? RIGHT : LEFT;
+	y_grow = (y0 < y1) ? DOWN : UP;
+	x_major = (x_dist >= -y_dist);
+	error = x_dist + y_dist;
+
+	SessionBegin();
+	run_x = x0;
+	run_y = y0;
+	while ((x0 != x1) || (y0 != y1))
+	{
+		error_2 = 2 * error;
+		if (error_2 >= y_dist)
+		{
+			error += y_dist;
+			x0 += x_grow;
+		}
+		if (error_2 <= x_dist)
+		{
+			error += x_dist;
+			y0 += y_grow;
+		}
+		/* A run ends when the line leaves its row, or its column if the line is steep */
+		if (x_major ? (y0 != run_y) : (x0 != run_x))
+		{
+			if (x_major)
+			{
+				Span(run_x, run_y, x0 - x_grow, run_y, color);
+			}
+			else
+			{
+				Span(run_x, run_y, run_x, y0 - y_grow, color);
+			}
+			run_x = x0;
+			run_y = y0;
+		}
+	}
+	Span(run_x, run_y, x0, y0, color);
+	SessionEnd();
+}
+
+void CircleSpans(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint8_t filled)
+{
+	int16_t f, ddF_x, ddF_y, x, y, next_y, start;
+	uint8_t next;
+
+	f = 1 - r;
+	ddF_x = 1;
+	ddF_y = -2 * r;
+	x = 0;
+	y = r;
+	start = 0;
+
+	SessionBegin();
+	while (1)
+	{
+		/* Each step gives a row of a filled circle near its center */
+		if (filled)
+		{
+			Span(x0 - y, y0 + x, x0 + y, y0 + x, color);
+			if (x > 0)
+			{
+				Span(x0 - y, y0 - x, x0 + y, y0 - x, color);
+			}
+		}
+		/* Next point of the octant, as in the midpoint algorithm */
+		next = (x < y);
+		next_y = y;
+		if (next)
+		{
+			if (f >= 0)
+			{
+				next_y--;
+				ddF_y += 2;
+				f += ddF_y;
+			}
+			ddF_x += 2;
+			f += ddF_x;
+		}
+		/* Points from start to x share the distance y, they are a run in every octant */
+		if (!next || (next_y != y))
+		{
+			if (filled)
+			{
+				Span(x0 - x, y0 + y, x0 + x, y0 + y, color);
+				Span(x0 - x, y0 - y, x0 + x, y0 - y, color);
+			}
+			else if (start == 0)
+			{
+				Span(x0 - x, y0 + y, x0 + x, y0 + y, color);
+				Span(x0 - x, y0 - y, x0 + x, y0 - y, color);
+				Span(x0 + y, y0 - x, x0 + y, y0 + x, color);
+				Span(x0 - y, y0 - x, x0 - y, y0 + x, color);
+			}
+			else
+			{
+				Span(x0 + start, y0 + y, x0 + x, y0 + y, color);
+				Span(x0 - x, y0 + y, x0 - start, y0 + y, color);
+				Span(x0 + start, y0 - y, x0 + x, y0 - y, color);
+				Span(x0 - x, y0 - y, x0 - start, y0 - y, color);
+				Span(x0 + y, y0 + start, x0 + y, y0 + x, color);
+				Span(x0 - y, y0 + start, x0 - y, y0 + x, color);
+				Span(x0 + y, y0 - x, x0 + y, y0 - start, color);
+				Span(x0 - y, y0 - x, x0 - y, y0 - start, color);
+			}
+			start = x + 1;
+		}
+		if (!next)
+		{
+			break;
+		}
+		x++;
+		y = next_y;
+	}
+	SessionEnd();
+}
+
+lcd_image_decoder_t * ImageSeek(const ili9341_image_t * image, uint32_t pixel)
+{
+	uint8_t i;
+	lcd_image_decoder_t * decoder = NULL;
+
+	for (i = 0; i < ILI9341_IMAGE_DECODERS; i++)
+	{
+		if (lcd_images.decoder[i].image == image)
+		{
+			decoder = &lcd_images.decoder[i];
+			break;
+		}
+	}
+	if (decoder == NULL)
+	{
+		decoder = &lcd_images.decoder[lcd_images.next];
+		lcd_images.next = (lcd_images.next + 1) % ILI9341_IMAGE_DECODERS;
+		decoder->image = NULL;
+	}
+	/* The operations can only be decoded forward */
+	if ((decoder->image == NULL) || (decoder->pixel > pixel))
+	{
+		memset(decoder, 0, sizeof(lcd_image_decoder_t));
+		decoder->image = image;
+		decoder->next = image->data;
+	}
+	ImageDecode(decoder, NULL, pixel - decoder->pixel, IMAGE_OPAQUE);
+	return decoder;
+}
+
+void ImageDecode(lcd_image_decoder_t * decoder, uint16_t * pixels, uint32_t count, uint32_t transparent)
+{
+	const uint8_t * next = decoder->next;
+	uint16_t color = decoder->color;
+	uint16_t pixel, r, g, b;
+	int16_t half;
+	uint32_t n;
+	uint8_t op;
+
+	decoder->pixel += count;
+	while (count > 0)
+	{
+		if (decoder->run == 0)
+		{
+			op = *next++;
+			decoder->run = 1;
+			r = color >> 11;
+			g = (color >> 5) & 0x3F;
+			b = color & 0x1F;
+			if (op == IMAGE_COLOR)
+			{
+				color = (uint16_t) ((next[0] << 8) | next[1]);
+				next += 2;
+				decoder->index[ImageHash(color >> 11, (color >> 5) & 0x3F, color & 0x1F)] = color;
+			}
+			else
+			{
+				switch (op & IMAGE_OP_MASK)
+				{
+				case IMAGE_INDEX:
+					color = decoder->index[op];
+					break;
+				case IMAGE_DIFF:
+					r = (r + ((op >> 4) & 0x03) - 2) & 0x1F;
+					g = (g + ((op >> 2) & 0x03) - 2) & 0x3F;
+					b = (b + (op & 0x03) - 2) & 0x1F;
+					color = (r << 11) | (g << 5) | b;
+					decoder->index[ImageHash(r, g, b)] = color;
+					break;
+				case IMAGE_LUMA:
+					/* Red and blue change around half of the green, which has one more bit */
+					half = ((op & 0x3F) >> 1) - 16;
+					r = (r + half + (*next >> 4) - 8) & 0x1F;
+					g = (g + (op & 0x3F) - 32) & 0x3F;
+					b = (b + half + (*next & 0x0F) - 8) & 0x1F;
+					next++;
+					color = (r << 11) | (g << 5) | b;
+					decoder->index[ImageHash(r, g, b)] = color;
+					break;
+				default:
+					decoder->run = (op & 0x3F) + 1;
+					break;
+				}
+			}
+		}
+		n = (decoder->run < count) ? decoder->run : count;
+		decoder->run -= n;
+		count -= n;
+		if (pixels == NULL)
+		{
+			continue;
+		}
+		if (color == transparent)
+		{
+			pixels += n;
+			continue;
+		}
+		pixel = ILI9341_PIXEL(color);
+		while (n-- > 0)
+		{
+			*pixels++ = pixel;
+		}
+	}
+	decoder->next = next;
+	decoder->color = color;
+}
+
+void BandImage(uint16_t x, uint16_t y, const ili9341_image_t * image, uint32_t transparent)
+{
+	uint16_t i, first, last, columns;
+	uint16_t * row;
+	lcd_image_decoder_t * decoder;
+
+	if ((x >= lcd_orientation.width) || (y > lcd_band.y1) || (y + image->height <= lcd_band.y0) ||
+		(image->width == 0))
+	{
+		return;
+	}
+	first = (y < lcd_band.y0) ? lcd_band.y0 - y : 0;
+	last = (y + image->height - 1 > lcd_band.y1) ? lcd_band.y1 - y : image->height - 1;
+	columns = (x + image->width > lcd_orientation.width) ? lcd_orientation.width - x : image->width;
+	/* The rows above the band were decoded by the previous band */
+	decoder = ImageSeek(image, (uint32_t) first * image->width);
+	for (i = first; i <= last; i++)
+	{
+		row = lcd_band.memory[lcd_band.current] + (uint32_t) (y + i - lcd_band.y0) * lcd_orientation.width + x;
+		ImageDecode(decoder, row, columns, transparent);
+		ImageDecode(decoder, NULL, image->width - columns, transparent);
+	}
+}
+
+void ImageBlocks(uint16_t x, uint16_t y, uint16_t columns, uint16_t rows, const ili9341_image_t * image)
+{
+	uint16_t i, row, lines, count;
+	uint16_t * pixels;
+	lcd_image_decoder_t * decoder;
+
+	/* As many rows as fit in a band memory and in a transfer */
+	lines = lcd_band.size / (columns * 2);
+	if (lines > MAX_TRANSFER / 2 / columns)
+	{
+		lines = MAX_TRANSFER / 2 / columns;
+	}
+	decoder = ImageSeek(image, 0);
+	SessionBegin();
+	for (row = 0; row < rows; row += count)
+	{
+		count = (rows - row < lines) ? rows - row : lines;
+		/* The memories are used as the bands, with one the previous block must be out */
+		if (lcd_band.buffers == 1)
+		{
+			while(!SpiFree(ili9341_spi));
+		}
+		pixels = lcd_band.memory[lcd_band.current];
+		for (i = 0; i < count; i++)
+		{
+			ImageDecode(decoder, pixels + (uint32_t) i * columns, columns, IMAGE_OPAQUE);
+			ImageDecode(decoder, NULL, image->width - columns, IMAGE_OPAQUE);
+		}
+		ILI9341WritePixels(x, y + row, x + columns - 1, y + row + count - 1, pixels);
+		if (lcd_band.buffers == 2)
+		{
+			lcd_band.current ^= 1;
+		}
+	}
+	SessionEnd();
+}
+
+void ImageRuns(uint16_t x, uint16_t y, uint16_t columns, uint16_t rows, const ili9341_image_t * image,
+	uint32_t transparent)
+{
+	static uint16_t pixel[2][MAX_VALUE_PIXELS];
+	uint16_t row, done, n, start, end;
+	uint16_t count = 0;
+	uint16_t key = ILI9341_PIXEL((uint16_t) transparent);
+	uint8_t k = 0, sent;
+	lcd_image_decoder_t * decoder;
+	lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
+
+	decoder = ImageSeek(image, 0);
+	SessionBegin();
+	if (transparent == IMAGE_OPAQUE)
+	{
+		SetCursorPosition(x, y, x + columns - 1, y + rows - 1);
+		WriteLCD(&lcd_write);
 	}
-	else
+	for (row = 0; row < rows; row++)
 	{
-		GPIOSetLow(ili9341_cs);
+		for (done = 0; done < columns; done += n)
+		{
+			n = (columns - done < MAX_VALUE_PIXELS - count) ? columns - done : MAX_VALUE_PIXELS - count;
+			ImageDecode(decoder, &pixel[k][count], n, IMAGE_OPAQUE);
+			if (transparent == IMAGE_OPAQUE)
+			{
+				/* Each full buffer is sent while the other one is decoded */
+				count += n;
+				if (count == MAX_VALUE_PIXELS)
+				{
+					SendPixels(pixel[k], count);
+					k ^= 1;
+					count = 0;
+				}
+				continue;
+			}
+			/* Each run of visible pixels goes to its own window, which waits for the
+			   previous pixels, so the buffer is only changed when something was sent */
+			sent = 0;
+			for (start = 0; start < n; start = end)
+			{
+				while ((start < n) && (pixel[k][start] == key))
+				{
+					start++;
+				}
+				end = start;
+				while ((end < n) && (pixel[k][end] != key))
+				{
+					end++;
+				}
+				if (end > start)
+				{
+					SetCursorPosition(x + done + start, y + row, x + done + end - 1, y + row);
+					WriteLCD(&lcd_write);
+					SendPixels(&pixel[k][start], end - start);
+					sent = 1;
+				}
+			}
+			if (sent)
+			{
+				k ^= 1;
+			}
+		}
+		ImageDecode(decoder, NULL, image->width - columns, IMAGE_OPAQUE);
+	}
+	if (count > 0)
+	{
+		SendPixels(pixel[k], count);
 	}
+	SessionEnd();
 }
 
-void WriteLCD(lcd_cmd_t * data)
+void TextPalette(const FontAA_t * font, uint16_t foreground, uint16_t background, uint16_t * palette)
 {
-	SpiInit(spi_conf);
-	/* If command is NULL don't send command */
-	if (data->cmd != NULL)
+	uint16_t level, max, r, g, b;
+
+	max = (1 << font->bpp) - 1;
+	for (level = 0; level <= max; level++)
 	{
-		/* Send command */
-		GPIOSetLow(ili9341_dc);
-		SpiWrite(ili9341_spi, &data->cmd, 1);
+		/* Each component is mixed on its own and rounded */
+		r = ((background >> 11) * (max - level) + (foreground >> 11) * level + max / 2) / max;
+		g = (((background >> 5) & 0x3F) * (max - level) + ((foreground >> 5) & 0x3F) * level + max / 2) / max;
+		b = ((background & 0x1F) * (max - level) + (foreground & 0x1F) * level + max / 2) / max;
+		palette[level] = ILI9341_PIXEL((uint16_t) ((r << 11) | (g << 5) | b));
 	}
-	/* If there are parameters or data to send */
-	if (data->databytes != NULL)
+}
+
+const Glyph_t * TextGlyph(const FontAA_t * font, char data)
+{
+	uint8_t code = (uint8_t) data;
+
+	if ((code < font->first) || (code - font->first >= font->count) ||
+		(font->glyphs[code - font->first].advance == 0))
 	{
-		/* Send parameters or data */
-		GPIOSetHigh(ili9341_dc);
-		SpiWrite(ili9341_spi, data->data, data->databytes);
+		return NULL;
 	}
+	return &font->glyphs[code - font->first];
 }
 
-void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+void GlyphBegin(lcd_text_decoder_t * decoder, const FontAA_t * font, const Glyph_t * glyph)
 {
-	static uint16_t aux;
-	/* The lower column must be send first */
-	if (x0 > x1)
+	decoder->glyph = glyph;
+	decoder->next = font->data + glyph->offset;
+	decoder->bpp = font->bpp;
+	decoder->run = 0;
+	decoder->shift = 0;
+}
+
+void GlyphDecode(lcd_text_decoder_t * decoder, const uint16_t * palette, uint16_t * pixels, uint32_t count)
+{
+	uint16_t pixel;
+	uint32_t n;
+	uint8_t code;
+
+	while (count > 0)
 	{
-		aux = x0;
-		x0 = x1;
-		x1 = aux;
+		if (decoder->run == 0)
+		{
+			decoder->run = 1;
+			if (decoder->glyph->packed)
+			{
+				if (decoder->shift == 0)
+				{
+					decoder->bits = *decoder->next++;
+					decoder->shift = 8;
+				}
+				decoder->shift -= decoder->bpp;
+				decoder->level = (decoder->bits >> decoder->shift) & ((1 << decoder->bpp) - 1);
+			}
+			else
+			{
+				code = *decoder->next++;
+				if (code & GLYPH_BLEND)
+				{
+					decoder->run = ((code >> 4) & 0x07) + 1;
+					decoder->level = code & 0x0F;
+				}
+				else
+				{
+					decoder->run = (code & 0x3F) + 1;
+					decoder->level = (code & GLYPH_FORE) ? (1 << decoder->bpp) - 1 : 0;
+				}
+			}
+		}
+		n = (decoder->run < count) ? decoder->run : count;
+		decoder->run -= n;
+		count -= n;
+		if (pixels == NULL)
+		{
+			continue;
+		}
+		pixel = palette[decoder->level];
+		while (n-- > 0)
+		{
+			*pixels++ = pixel;
+		}
 	}
-	/* The lower row must be send first */
-	if (y0 > y1)
+}
+
+void GlyphRow(lcd_text_decoder_t * decoder, const uint16_t * palette, uint16_t * pixels, uint16_t row,
+	uint16_t columns)
+{
+	const Glyph_t * glyph = decoder->glyph;
+	uint16_t j, left, ink;
+
+	/* Rows of the cell above and below the ink */
+	if ((row < glyph->y) || (row >= glyph->y + glyph->height))
 	{
-		aux = y0;
-		y0 = y1;
-		y1 = aux;
+		for (j = 0; j < columns; j++)
+		{
+			pixels[j] = palette[0];
+		}
+		return;
+	}
+	left = (glyph->x < columns) ? glyph->x : columns;
+	ink = (left + glyph->width > columns) ? columns - left : glyph->width;
+	for (j = 0; j < left; j++)
+	{
+		pixels[j] = palette[0];
+	}
+	GlyphDecode(decoder, palette, pixels + left, ink);
+	GlyphDecode(decoder, palette, NULL, glyph->width - ink);
+	for (j = left + ink; j < columns; j++)
+	{
+		pixels[j] = palette[0];
 	}
-	uint8_t columns[] = {HighByte(x0), LowByte(x0), HighByte(x1), LowByte(x1)};
-	lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
-	uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
-	lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
-	WriteLCD(&lcd_columns);
-	WriteLCD(&lcd_rows);
 }
 
-void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+void BandText(uint16_t x, uint16_t y, const Glyph_t * glyph, const FontAA_t * font, const uint16_t * palette)
 {
-	static uint16_t i;
-	static int32_t bytes_count;
-	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint16_t i, first, last, columns, skipped;
+	lcd_text_decoder_t decoder;
 
-	x_dist = x1 - x0;
-	y_dist = y1 - y0;
-	if (x0 > x1)
+	if ((x >= lcd_orientation.width) || (y > lcd_band.y1) || (y + font->height <= lcd_band.y0))
 	{
-		x_dist = - x_dist;
+		return;
 	}
-	if (y0 > y1)
+	first = (y < lcd_band.y0) ? lcd_band.y0 - y : 0;
+	last = (y + font->height - 1 > lcd_band.y1) ? lcd_band.y1 - y : font->height - 1;
+	columns = (x + glyph->advance > lcd_orientation.width) ? lcd_orientation.width - x : glyph->advance;
+	GlyphBegin(&decoder, font, glyph);
+	/* The ink rows above the band are decoded again, characters are small */
+	if (first > glyph->y)
 	{
-		y_dist = - y_dist;
+		skipped = (first - glyph->y < glyph->height) ? first - glyph->y : glyph->height;
+		GlyphDecode(&decoder, palette, NULL, (uint32_t) skipped * glyph->width);
 	}
-	/* Number of bytes to write. We have to write 2 bytes/pixel (16bits color) */
-	bytes_count = (x_dist + 1) * (y_dist + 1) * 2;
-	/* Define area to fill */
-	SetCursorPosition(x0, y0, x1, y1);
-
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2)
+	for (i = first; i <= last; i++)
 	{
-		pixel[i] = HighByte(color);
-		pixel[i + 1] = LowByte(color);
+		GlyphRow(&decoder, palette, lcd_band.memory[lcd_band.current] +
+			(uint32_t) (y + i - lcd_band.y0) * lcd_orientation.width + x, i, columns);
 	}
-	/* Start writing LCD memory */
+}
+
+void GlyphSend(uint16_t x, uint16_t y, const Glyph_t * glyph, const FontAA_t * font, const uint16_t * palette)
+{
+	static uint16_t pixel[2][TEXT_PIXELS];
+	static uint8_t k;
+	uint16_t i, columns, rows;
+	uint16_t count = 0;
+	lcd_text_decoder_t decoder;
 	lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
-	WriteLCD(&lcd_write);
 
-	while(bytes_count - MAX_VALUE_SIZE > 0)
+	if ((x >= lcd_orientation.width) || (y >= lcd_orientation.height))
 	{
-		lcd_cmd_t lcd_pixel = {SEND_PIXELS, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
+		return;
+	}
+	columns = (x + glyph->advance > lcd_orientation.width) ? lcd_orientation.width - x : glyph->advance;
+	rows = (y + font->height > lcd_orientation.height) ? lcd_orientation.height - y : font->height;
+	GlyphBegin(&decoder, font, glyph);
+	SessionBegin();
+	SetCursorPosition(x, y, x + columns - 1, y + rows - 1);
+	WriteLCD(&lcd_write);
+	for (i = 0; i < rows; i++)
+	{
+		/* Each full buffer is sent while the other one is decoded, also by the next character */
+		if (count + columns > TEXT_PIXELS)
+		{
+			SendPixels(pixel[k], count);
+			k ^= 1;
+			count = 0;
+		}
+		GlyphRow(&decoder, palette, &pixel[k][count], i, columns);
+		count += columns;
 	}
-	lcd_cmd_t lcd_pixel = {SEND_PIXELS, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	SendPixels(pixel[k], count);
+	k ^= 1;
+	SessionEnd();
 }
 
 /*****************************************************************************
@@ -335,7 +1754,12 @@ uint8_t ILI9341Init(uint8_t spi_port, uint8_t gpio_cs, uint8_t gpio_dc, uint8_t
 {
 	/* SPI configuration */
 	spi_conf.port = spi_port;
+#if (ILI9341_SPI_SESSION == 1)
+	/* CS is held low by the driver during the whole drawing operation */
+	spi_conf.SetCS = NULL;
+#else
 	spi_conf.SetCS = SetChipSelect;
+#endif
 	ili9341_spi = spi_port;
 	/* GPIOs configuration and initialization */
 	ili9341_cs = gpio_cs;
@@ -353,6 +1777,17 @@ uint8_t ILI9341Init(uint8_t spi_port, uint8_t gpio_cs, uint8_t gpio_dc, uint8_t
 	}
 	/* CS start in high state */
 	GPIOSetHigh(ili9341_cs);
+#if (ILI9341_SPI_SESSION == 1)
+	/* SPI port is configured only once */
+	if (!SpiInit(spi_conf))
+	{
+		return ERROR;
+	}
+	GPIOSetHigh(ili9341_dc);
+	lcd_session.dc = DC_DATA;
+	lcd_session.depth = 0;
+	lcd_session.stage_count = 0;
+#endif
 
 	/* RST must be held low for minimum 10µsec after VCC have been applied */
 	DelayUs(10);
@@ -379,11 +1814,19 @@ uint8_t ILI9341Init(uint8_t spi_port, uint8_t gpio_cs, uint8_t gpio_dc, uint8_t
 
 void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color)
 {
+	if (lcd_band.open)
+	{
+		BandFill(x, y, x, y, color);
+		return;
+	}
+	SessionBegin();
 	/* Define area (pixel) to fill */
 	SetCursorPosition(x, y, x, y);
 	uint8_t pixels[] = {HighByte(color), LowByte(color)};
+	/* A single pixel is staged with its command, in 8 bits frames */
 	lcd_cmd_t lcd_pixels = {MEM_WRITE, sizeof(pixels), pixels};
 	WriteLCD(&lcd_pixels);
+	SessionEnd();
 }
 
 void ILI9341Fill(uint16_t color)
@@ -428,13 +1871,37 @@ void ILI9341Rotate(ili9341_orientation_t orientation)
 	WriteLCD(&lcd_mem_acc);
 }
 
+uint8_t ILI9341SetScrollArea(uint16_t top, uint16_t height)
+{
+	uint16_t bottom;
+
+	/* The LCD scrolls along the rows of the frame memory, the rows of ILI9341_Portrait_1 */
+	if ((lcd_orientation.orientation != ILI9341_Portrait_1) || (height == 0) || (top + height > ILI9341_HEIGHT))
+	{
+		return ERROR;
+	}
+	bottom = ILI9341_HEIGHT - top - height;
+	uint8_t area[] = {HighByte(top), LowByte(top), HighByte(height), LowByte(height), HighByte(bottom), LowByte(bottom)};
+	lcd_cmd_t lcd_area = {VERT_SCROLL_DEF, sizeof(area), area};
+	WriteLCD(&lcd_area);
+	return SUCCESS;
+}
+
+void ILI9341SetScrollStart(uint16_t row)
+{
+	uint8_t start[] = {HighByte(row), LowByte(row)};
+	lcd_cmd_t lcd_start = {VERT_SCROLL_START, sizeof(start), start};
+	WriteLCD(&lcd_start);
+}
+
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background)
 {
 	static uint16_t i, j, k;
-	static uint16_t char_row;
+	static uint16_t char_row, fore, back;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	static int32_t pixels_count, index;
+	static uint16_t buffers[2][MAX_VALUE_PIXELS];
+	static uint16_t * pixel;
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -447,10 +1914,20 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 		lcd_x = 0;
 	}
 
+	/* Inside a band the character is expanded in memory */
+	if (lcd_band.open)
+	{
+		BandGlyph(lcd_x, lcd_y, data, font, foreground, background);
+		return;
+	}
+
+	SessionBegin();
 	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->FontWidth - 1, lcd_y + font->FontHeight - 1);
 
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->FontHeight * font->FontWidth * 2;
+	/* Number of pixels to write */
+	pixels_count = font->FontHeight * font->FontWidth;
+	fore = ILI9341_PIXEL(foreground);
+	back = ILI9341_PIXEL(background);
 
 	/* Start writing LCD memory */
 	lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
@@ -459,6 +1936,7 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 	/* Draw font data */
 	/* go through character rows */
 	k = 0;
+	pixel = buffers[0];
 	for (i = 0; i < font->FontHeight; i++)
 	{
 		/* each 16bits data of a font character draws a full row of that character */
@@ -466,41 +1944,44 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 		/* go through character columns */
 		for (j = 0; j < font->FontWidth; j++)
 		{
+			index = j + i * font->FontWidth - k * MAX_VALUE_PIXELS;
 			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE)
+			if (index >= MAX_VALUE_PIXELS)
 			{
-				lcd_cmd_t lcd_pixels = {SEND_PIXELS, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
+				SendPixels(pixel, MAX_VALUE_PIXELS);
+				pixels_count -= MAX_VALUE_PIXELS;
+				index -= MAX_VALUE_PIXELS;
 				k++;
+				/* Fill the other buffer while this one is sent */
+				pixel = buffers[k & 1];
 			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (char_row & (MSK_BIT16 >> j))
-			{
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else
-			{
-				pixel[2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
+			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character,
+			   if bit = 1 put foreground color */
+			pixel[index] = (char_row & (MSK_BIT16 >> j)) ? fore : back;
 		}
 	}
 	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {SEND_PIXELS, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	SendPixels(pixel, pixels_count);
+	SessionEnd();
 }
 
 void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background)
 {
 	static uint16_t lcd_x, lcd_y;
 
+	/* Inside a band the characters are expanded straight in memory */
+	if ((lcd_glyph_cache.index != NULL) && !lcd_band.open)
+	{
+		DrawStringCached(x, y, str, font, foreground, background);
+		return;
+	}
+
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
 
+	/* The whole string is sent in a single session */
+	SessionBegin();
 	while (*str != '\0')	/* End of string */
 	{
 		/* New line */
@@ -530,6 +2011,7 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 		str++;
 		lcd_x += font->FontWidth;
 	}
+	SessionEnd();
 }
 
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height)
@@ -546,10 +2028,78 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 	*width = w;
 }
 
-void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+void ILI9341DrawText(uint16_t x, uint16_t y, const char * str, const FontAA_t * font, uint16_t foreground,
+	uint16_t background)
 {
-	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	uint16_t palette[TEXT_LEVELS];
+	uint16_t lcd_x = x, lcd_y = y;
+	const Glyph_t * glyph;
+
+	TextPalette(font, foreground, background, palette);
+	/* The whole text is sent in a single session */
+	SessionBegin();
+	for (; *str != '\0'; str++)
+	{
+		if (*str == '\n')
+		{
+			lcd_y += font->height;
+			lcd_x = x;
+			continue;
+		}
+		/* Carriage returns and characters missing in the font take no room */
+		glyph = TextGlyph(font, *str);
+		if (glyph == NULL)
+		{
+			continue;
+		}
+		/* If at the end of a line of display, go to new line, as ILI9341DrawChar */
+		if ((lcd_x + glyph->advance > lcd_orientation.width) && (lcd_x > 0))
+		{
+			lcd_y += font->height;
+			lcd_x = 0;
+		}
+		if (lcd_band.open)
+		{
+			BandText(lcd_x, lcd_y, glyph, font, palette);
+		}
+		else
+		{
+			GlyphSend(lcd_x, lcd_y, glyph, font, palette);
+		}
+		lcd_x += glyph->advance;
+	}
+	SessionEnd();
+}
+
+void ILI9341GetTextSize(const char * str, const FontAA_t * font, uint16_t * width, uint16_t * height)
+{
+	uint16_t w = 0, lines = 1;
+	const Glyph_t * glyph;
+
+	*width = 0;
+	for (; *str != '\0'; str++)
+	{
+		if (*str == '\n')
+		{
+			lines++;
+			w = 0;
+			continue;
+		}
+		glyph = TextGlyph(font, *str);
+		if (glyph != NULL)
+		{
+			w += glyph->advance;
+		}
+		if (w > *width)
+		{
+			*width = w;
+		}
+	}
+	*height = lines * font->height;
+}
 
+void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
 	/* Check for overflow */
 	if (x0 >= lcd_orientation.width)
 	{
@@ -568,6 +2118,11 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 		y1 = lcd_orientation.height - 1;
 	}
 
+#if (ILI9341_SPANS == 1)
+	LineSpans(x0, y0, x1, y1, color);
+#else
+	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+
 	/* Calculate x y distances and determine grow direction */
 	x_dist = x1 - x0;
 	y_dist = y1 - y0;
@@ -590,6 +2145,7 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 		y_grow = DOWN;
 	}
 
+	SessionBegin();
 	/* Vertical or horizontal line */
 	if (x_dist == 0 || y_dist == 0)
 	{
@@ -631,14 +2187,18 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 			}
 		}
 	}
+	SessionEnd();
+#endif
 }
 
 void ILI9341DrawRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
 {
+	SessionBegin();
 	ILI9341DrawLine(x0, y0, x1, y0, color);		/* Draw top line */
 	ILI9341DrawLine(x1, y0, x1, y1, color);		/* Draw right line */
 	ILI9341DrawLine(x0, y1, x1, y1, color);		/* Draw bottom line */
 	ILI9341DrawLine(x0, y0, x0, y1, color);		/* Draw left line */
+	SessionEnd();
 }
 
 void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
@@ -648,6 +2208,9 @@ void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 
 void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 {
+#if (ILI9341_SPANS == 1)
+	CircleSpans(x0, y0, r, color, 0);
+#else
 	static int16_t f, ddF_x, ddF_y, x, y;
 
 	f = 1 - r;
@@ -656,6 +2219,7 @@ void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 	x = 0;
 	y = r;
 
+	SessionBegin();
 	ILI9341DrawPixel(x0, y0 + r, color);
 	ILI9341DrawPixel(x0, y0 - r, color);
 	ILI9341DrawPixel(x0 + r, y0, color);
@@ -683,10 +2247,15 @@ void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
         ILI9341DrawPixel(x0 + y, y0 - x, color);
         ILI9341DrawPixel(x0 - y, y0 - x, color);
     }
+	SessionEnd();
+#endif
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 {
+#if (ILI9341_SPANS == 1)
+	CircleSpans(x0, y0, r, color, 1);
+#else
 	static int16_t f, ddF_x, ddF_y, x, y;
 
 	f = 1 - r;
@@ -695,6 +2264,7 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 	x = 0;
 	y = r;
 
+	SessionBegin();
     ILI9341DrawPixel(x0, y0 + r, color);
     ILI9341DrawPixel(x0, y0 - r, color);
     ILI9341DrawPixel(x0 + r, y0, color);
@@ -719,14 +2289,21 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
         ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
         ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
     }
+	SessionEnd();
+#endif
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic)
 {
-	static uint16_t i, j;
-	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	static uint32_t bytes_count, size;
+
+	if (lcd_band.open)
+	{
+		BandPicture(x, y, width, height, pic);
+		return;
+	}
 
+	SessionBegin();
 	SetCursorPosition(x, y, x + width - 1, y + height - 1);
 
 	/* Number of bytes to write. We have to write 2 bytes/pixel */
@@ -736,22 +2313,223 @@ void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
 	lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
 	WriteLCD(&lcd_write);
 
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0)
+	/* Pictures are stored high byte first, so they are sent straight from their memory in
+	   8 bits frames */
+	while(bytes_count > 0)
+	{
+		size = (bytes_count > MAX_TRANSFER) ? MAX_TRANSFER : bytes_count;
+		lcd_cmd_t lcd_pixel = {SEND_PIXELS, size, (uint8_t *) pic};
+		WriteLCD(&lcd_pixel);
+		bytes_count -= size;
+		pic += size;
+	}
+	SessionEnd();
+}
+
+void ILI9341DrawImage(uint16_t x, uint16_t y, const ili9341_image_t * image)
+{
+	uint16_t columns, rows;
+
+	if (lcd_band.open)
+	{
+		BandImage(x, y, image, IMAGE_OPAQUE);
+		return;
+	}
+	if ((x >= lcd_orientation.width) || (y >= lcd_orientation.height) || (image->width == 0) ||
+		(image->height == 0))
+	{
+		return;
+	}
+	columns = (x + image->width > lcd_orientation.width) ? lcd_orientation.width - x : image->width;
+	rows = (y + image->height > lcd_orientation.height) ? lcd_orientation.height - y : image->height;
+	if (lcd_band.memory[0] != NULL)
+	{
+		ImageBlocks(x, y, columns, rows, image);
+	}
+	else
+	{
+		ImageRuns(x, y, columns, rows, image, IMAGE_OPAQUE);
+	}
+}
+
+void ILI9341DrawSprite(uint16_t x, uint16_t y, const ili9341_image_t * image, uint16_t transparent)
+{
+	uint16_t columns, rows;
+
+	if (lcd_band.open)
+	{
+		BandImage(x, y, image, transparent);
+		return;
+	}
+	if ((x >= lcd_orientation.width) || (y >= lcd_orientation.height) || (image->width == 0) ||
+		(image->height == 0))
+	{
+		return;
+	}
+	columns = (x + image->width > lcd_orientation.width) ? lcd_orientation.width - x : image->width;
+	rows = (y + image->height > lcd_orientation.height) ? lcd_orientation.height - y : image->height;
+	ImageRuns(x, y, columns, rows, image, transparent);
+}
+
+void ILI9341BeginDrawing(void)
+{
+	SessionBegin();
+}
+
+void ILI9341EndDrawing(void)
+{
+	SessionEnd();
+}
+
+void ILI9341WritePixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t * pixels)
+{
+	SessionBegin();
+	SetCursorPosition(x0, y0, x1, y1);
+	lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
+	WriteLCD(&lcd_write);
+	/* Sent straight from the caller buffer, inside a drawing it returns once the transfer starts */
+	SendPixels(pixels, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+	SessionEnd();
+}
+
+uint8_t ILI9341BandInit(uint8_t * memory, uint8_t * second, uint32_t size)
+{
+	/* The previous bands may be being sent */
+	if (lcd_band.memory[0] != NULL)
+	{
+		while(!SpiFree(ili9341_spi));
+	}
+	memset(&lcd_band, 0, sizeof(lcd_band));
+	if (memory == NULL)
+	{
+		return SUCCESS;
+	}
+	/* At least one row in every orientation */
+	if (size < ILI9341_HEIGHT * 2)
+	{
+		return ERROR;
+	}
+	lcd_band.memory[0] = (uint16_t *) memory;
+	lcd_band.memory[1] = (uint16_t *) second;
+	lcd_band.buffers = (second != NULL) ? 2 : 1;
+	lcd_band.size = size;
+	return SUCCESS;
+}
+
+uint16_t ILI9341BandBegin(uint16_t y0, uint16_t y1, uint16_t background)
+{
+	uint16_t lines;
+
+	if ((lcd_band.memory[0] == NULL) || (y0 > y1) || (y0 >= lcd_orientation.height))
+	{
+		return 0;
+	}
+	if (y1 >= lcd_orientation.height)
+	{
+		y1 = lcd_orientation.height - 1;
+	}
+	lines = lcd_band.size / (lcd_orientation.width * 2);
+	if (y1 - y0 + 1 > lines)
+	{
+		y1 = y0 + lines - 1;
+	}
+	/* The memory is sent straight from the band, with one memory the previous band must be
+	   out. With two the other memory was sent before the last band started */
+	if (lcd_band.buffers == 1)
+	{
+		while(!SpiFree(ili9341_spi));
+	}
+	lcd_band.y0 = y0;
+	lcd_band.y1 = y1;
+	lcd_band.open = 1;
+	BandFill(0, lcd_band.y0, lcd_orientation.width - 1, lcd_band.y1, background);
+	return y1 - y0 + 1;
+}
+
+void ILI9341BandEnd(void)
+{
+	if (!lcd_band.open)
+	{
+		return;
+	}
+	lcd_band.open = 0;
+	ILI9341WritePixels(0, lcd_band.y0, lcd_orientation.width - 1, lcd_band.y1,
+		lcd_band.memory[lcd_band.current]);
+	/* The next band is composed while this one is sent */
+	if (lcd_band.buffers == 2)
+	{
+		lcd_band.current ^= 1;
+	}
+}
+
+void ILI9341BandRender(uint16_t y0, uint16_t y1, uint16_t background, ili9341_band_draw_t draw, void * context)
+{
+	uint16_t y, lines;
+
+	/* A single session, so each band returns as soon as its transfer starts */
+	SessionBegin();
+	for (y = y0; y <= y1; y += lines)
 	{
-		for (i = 0; i < MAX_VALUE_SIZE; i++)
+		lines = ILI9341BandBegin(y, y1, background);
+		if (lines == 0)
 		{
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+			break;
 		}
-		lcd_cmd_t lcd_pixel = {SEND_PIXELS, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
+		draw(context);
+		ILI9341BandEnd();
+	}
+	SessionEnd();
+}
+
+uint8_t ILI9341GlyphCacheInit(uint8_t * memory, uint32_t size, uint32_t line_size)
+{
+	uint32_t index_size = ILI9341_GLYPH_CACHE_ENTRIES * sizeof(lcd_glyph_t);
+
+	/* The line buffer of the previous memory may be being sent */
+	if (lcd_glyph_cache.line != NULL)
+	{
+		while(!SpiFree(ili9341_spi));
+	}
+	memset(&lcd_glyph_cache, 0, sizeof(lcd_glyph_cache));
+	if (memory == NULL)
+	{
+		return SUCCESS;
 	}
-	for (i = 0; i < bytes_count; i++)
+	/* Line buffer keeps the glyphs 4 bytes aligned */
+	line_size &= ~3UL;
+	if (index_size + line_size > size)
+	{
+		return ERROR;
+	}
+	lcd_glyph_cache.index = (lcd_glyph_t *) memory;
+	lcd_glyph_cache.line = memory + index_size;
+	lcd_glyph_cache.line_size = line_size;
+	lcd_glyph_cache.glyphs = lcd_glyph_cache.line + line_size;
+	lcd_glyph_cache.stats.size = size - index_size - line_size;
+	ILI9341GlyphCacheClear();
+	return SUCCESS;
+}
+
+void ILI9341GlyphCacheClear(void)
+{
+	uint32_t i;
+
+	if (lcd_glyph_cache.index != NULL)
 	{
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+		for (i = 0; i < ILI9341_GLYPH_CACHE_ENTRIES; i++)
+		{
+			lcd_glyph_cache.index[i].font = NULL;
+		}
 	}
-	lcd_cmd_t lcd_pixel = {SEND_PIXELS, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	lcd_glyph_cache.next = 0;
+	lcd_glyph_cache.stats.hits = 0;
+	lcd_glyph_cache.stats.misses = 0;
+	lcd_glyph_cache.stats.evictions = 0;
+	lcd_glyph_cache.stats.glyphs = 0;
+	lcd_glyph_cache.stats.used = 0;
+}
+
+void ILI9341GlyphCacheGetStats(ili9341_glyph_stats_t * stats)
+{
+	*stats = lcd_glyph_cache.stats;
 }
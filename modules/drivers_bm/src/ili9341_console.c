@@ -0,0 +1,302 @@
+/*! @file ili9341_console.c
+ * @brief  Text console with hardware vertical scrolling for the ILI9341 driver
+ *
+ * The grid has a row of cells for every line of the console, in the rows of the frame memory
+ * from the first row of the console down. The row shown at the top is the oldest line: the
+ * scrolling start of the LCD points to it, and a new line in a full console takes it and moves
+ * the start to the next one. The text of a row is compared with the cells and the runs that
+ * differ are drawn with ILI9341DrawString.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ */
+
+#include "ili9341_console.h"
+#include "ili9341.h"
+#include "fonts.h"
+#include "chip.h"
+#include <string.h>
+
+/*****************************************************************************
+ * Private macros/types/enumerations/variables definitions
+ ****************************************************************************/
+
+#ifndef NULL
+	#define NULL 0
+#endif
+
+#define FIRST_CHAR ' '				/*!< First character of the fonts */
+#define LAST_CHAR '~'				/*!< Last character of the fonts */
+
+/**
+ * @brief Text console
+ */
+typedef struct
+{
+	Font_t * font;										/*!< Font of the console, NULL when closed */
+	uint16_t y;											/*!< First row of the LCD */
+	uint8_t lines;										/*!< Lines of the console */
+	uint8_t columns;									/*!< Characters of each line */
+	uint16_t foreground;								/*!< Color for the text */
+	uint16_t background;								/*!< Color for the background */
+	uint8_t first;										/*!< Row of the grid shown at the top */
+	uint8_t used;										/*!< Rows of the grid with lines */
+	uint8_t row;										/*!< Row of the grid of the line being written */
+	uint8_t open;										/*!< The line being written has a row */
+	uint8_t cursor;										/*!< Position of the next character */
+	uint8_t length;										/*!< Characters of the line being written */
+	char line[ILI9341_CONSOLE_COLUMNS];					/*!< Line being written, padded with spaces */
+	char cells[ILI9341_CONSOLE_ROWS][ILI9341_CONSOLE_COLUMNS];	/*!< Characters on the LCD */
+	uint16_t colors[ILI9341_CONSOLE_ROWS];				/*!< Text color of each row on the LCD */
+	ili9341_console_stats_t stats;						/*!< Statistics */
+} lcd_console_t;
+
+lcd_console_t lcd_console;					/*!< Text console, closed at start */
+
+/*****************************************************************************
+ * Public types/enumerations/variables declarations
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Private functions definitions
+ ****************************************************************************/
+
+/**
+ * @brief  		Draw the runs of cells of a row of the grid that differ from a text
+ * @param[in]  	row: Row of the grid
+ * @param[in]  	text: Characters of the row, one per column
+ * @param[in]  	color: Color for the text
+ * @retval 		None
+ */
+void ConsoleDrawRow(uint8_t row, const char * text, uint16_t color);
+
+/**
+ * @brief  		Take a row of the grid for a new line, the oldest one when the grid is full
+ * @retval 		None
+ */
+void ConsoleNewRow(void);
+
+/**
+ * @brief  		Draw the line being written, taking a row for it the first time
+ * @retval 		None
+ */
+void ConsoleShow(void);
+
+/**
+ * @brief  		Append the line being written and start an empty one
+ * @retval 		None
+ */
+void ConsoleEndLine(void);
+
+/*****************************************************************************
+ * Private functions declarations
+ ****************************************************************************/
+
+void ConsoleDrawRow(uint8_t row, const char * text, uint16_t color)
+{
+	char run[ILI9341_CONSOLE_COLUMNS + 1];
+	char * cells = lcd_console.cells[row];
+	uint8_t i, first;
+	uint16_t y;
+
+	y = lcd_console.y + row * lcd_console.font->FontHeight;
+	i = 0;
+	while (i < lcd_console.columns)
+	{
+		/* A space looks the same in any color */
+		if ((text[i] == cells[i]) && ((text[i] == ' ') || (color == lcd_console.colors[row])))
+		{
+			i++;
+			continue;
+		}
+		first = i;
+		while ((i < lcd_console.columns) &&
+			!((text[i] == cells[i]) && ((text[i] == ' ') || (color == lcd_console.colors[row]))))
+		{
+			i++;
+		}
+		memcpy(run, &text[first], i - first);
+		run[i - first] = '\0';
+		ILI9341DrawString(first * lcd_console.font->FontWidth, y, run, lcd_console.font, color,
+			lcd_console.background);
+		lcd_console.stats.drawn += i - first;
+	}
+	memcpy(cells, text, lcd_console.columns);
+	lcd_console.colors[row] = color;
+}
+
+void ConsoleNewRow(void)
+{
+	if (lcd_console.used < lcd_console.lines)
+	{
+		lcd_console.row = lcd_console.used;
+		lcd_console.used++;
+		return;
+	}
+	/* The oldest line goes to the bottom of the console and the others go up a line */
+	lcd_console.row = lcd_console.first;
+	lcd_console.first = (lcd_console.first + 1) % lcd_console.lines;
+	ILI9341SetScrollStart(lcd_console.y + lcd_console.first * lcd_console.font->FontHeight);
+	lcd_console.stats.scrolls++;
+}
+
+void ConsoleShow(void)
+{
+	uint32_t drawn = lcd_console.stats.drawn;
+
+	ILI9341BeginDrawing();
+	if (!lcd_console.open)
+	{
+		ConsoleNewRow();
+		lcd_console.open = 1;
+	}
+	ConsoleDrawRow(lcd_console.row, lcd_console.line, lcd_console.foreground);
+	ILI9341EndDrawing();
+	lcd_console.stats.skipped += lcd_console.columns - (lcd_console.stats.drawn - drawn);
+}
+
+void ConsoleEndLine(void)
+{
+	ConsoleShow();
+	lcd_console.stats.lines++;
+	lcd_console.open = 0;
+	memset(lcd_console.line, ' ', sizeof(lcd_console.line));
+	lcd_console.cursor = 0;
+	lcd_console.length = 0;
+}
+
+/*****************************************************************************
+ * Public functions declarations
+ ****************************************************************************/
+
+uint8_t ILI9341ConsoleInit(uint16_t y, uint8_t lines, Font_t * font, uint16_t foreground, uint16_t background)
+{
+	uint16_t height = lines * font->FontHeight;
+
+	if ((lines == 0) || (lines > ILI9341_CONSOLE_ROWS) || (ILI9341SetScrollArea(y, height) == ERROR))
+	{
+		return ERROR;
+	}
+	ILI9341SetScrollStart(y);
+	ILI9341DrawFilledRectangle(0, y, ILI9341_WIDTH - 1, y + height - 1, background);
+
+	lcd_console.font = font;
+	lcd_console.y = y;
+	lcd_console.lines = lines;
+	lcd_console.columns = ILI9341_WIDTH / font->FontWidth;
+	if (lcd_console.columns > ILI9341_CONSOLE_COLUMNS)
+	{
+		lcd_console.columns = ILI9341_CONSOLE_COLUMNS;
+	}
+	lcd_console.foreground = foreground;
+	lcd_console.background = background;
+	lcd_console.first = 0;
+	lcd_console.used = 0;
+	lcd_console.open = 0;
+	lcd_console.cursor = 0;
+	lcd_console.length = 0;
+	memset(lcd_console.line, ' ', sizeof(lcd_console.line));
+	memset(lcd_console.cells, ' ', sizeof(lcd_console.cells));
+	return SUCCESS;
+}
+
+void ILI9341ConsoleEnd(void)
+{
+	if (lcd_console.font == NULL)
+	{
+		return;
+	}
+	ILI9341SetScrollArea(0, ILI9341_HEIGHT);
+	ILI9341SetScrollStart(0);
+	lcd_console.font = NULL;
+}
+
+void ILI9341ConsolePrint(const char * str)
+{
+	char data;
+
+	if (lcd_console.font == NULL)
+	{
+		return;
+	}
+	for (; *str != '\0'; str++)
+	{
+		data = *str;
+		if (data == '\n')
+		{
+			ConsoleEndLine();
+		}
+		else if (data == '\r')
+		{
+			lcd_console.cursor = 0;
+		}
+		else
+		{
+			/* A full line continues in the next one when more characters come */
+			if (lcd_console.cursor == lcd_console.columns)
+			{
+				ConsoleEndLine();
+			}
+			lcd_console.line[lcd_console.cursor] = ((data >= FIRST_CHAR) && (data <= LAST_CHAR)) ? data : ' ';
+			lcd_console.cursor++;
+			if (lcd_console.cursor > lcd_console.length)
+			{
+				lcd_console.length = lcd_console.cursor;
+			}
+		}
+	}
+}
+
+void ILI9341ConsoleFlush(void)
+{
+	if ((lcd_console.font != NULL) && (lcd_console.open || (lcd_console.length > 0)))
+	{
+		ConsoleShow();
+	}
+}
+
+void ILI9341ConsoleColor(uint16_t foreground)
+{
+	lcd_console.foreground = foreground;
+}
+
+void ILI9341ConsoleClear(void)
+{
+	char blank[ILI9341_CONSOLE_COLUMNS];
+	uint8_t row;
+
+	if (lcd_console.font == NULL)
+	{
+		return;
+	}
+	memset(blank, ' ', sizeof(blank));
+	ILI9341BeginDrawing();
+	for (row = 0; row < lcd_console.lines; row++)
+	{
+		ConsoleDrawRow(row, blank, lcd_console.foreground);
+	}
+	/* All the rows are empty, the grid starts again from the first one */
+	lcd_console.first = 0;
+	lcd_console.used = 0;
+	ILI9341SetScrollStart(lcd_console.y);
+	ILI9341EndDrawing();
+
+	lcd_console.open = 0;
+	lcd_console.cursor = 0;
+	lcd_console.length = 0;
+	memset(lcd_console.line, ' ', sizeof(lcd_console.line));
+}
+
+void ILI9341ConsoleGetStats(ili9341_console_stats_t * stats)
+{
+	*stats = lcd_console.stats;
+}
+
+void ILI9341ConsoleClearStats(void)
+{
+	memset(&lcd_console.stats, 0, sizeof(lcd_console.stats));
+}
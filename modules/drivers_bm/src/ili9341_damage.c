@@ -0,0 +1,489 @@
+/*! @file ili9341_damage.c
+ * @brief  Damage tracking for the ILI9341 driver
+ *
+ * Every item keeps what is on the LCD (shown) and what was recorded since the last flush.
+ * Recording an item compares both and adds the rectangles that differ, for strings only
+ * the characters that changed. The flush draws the recorded state of every item inside
+ * every dirty rectangle, using the drawing functions of ili9341.c.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ *
+ */
+
+#include "ili9341_damage.h"
+#include "ili9341.h"
+#include "fonts.h"
+#include "cycles.h"
+#include <string.h>
+
+/*****************************************************************************
+ * Private macros/types/enumerations/variables definitions
+ ****************************************************************************/
+
+#ifndef NULL
+	#define NULL 0
+#endif
+
+#define ITEM_FREE 0					/*!< Entry of the items table not used */
+#define ITEM_STRING 1				/*!< String item */
+#define ITEM_RECTANGLE 2			/*!< Filled rectangle item */
+
+/**
+ * @brief Rectangle on the LCD, both corners included
+ */
+typedef struct
+{
+	uint16_t x0;						/*!< X coordinate of top left point */
+	uint16_t y0;						/*!< Y coordinate of top left point */
+	uint16_t x1;						/*!< X coordinate of bottom right point */
+	uint16_t y1;						/*!< Y coordinate of bottom right point */
+} lcd_rect_t;
+
+/**
+ * @brief State of an item, as recorded or as shown on the LCD
+ */
+typedef struct
+{
+	Font_t * font;						/*!< Font of a string */
+	uint16_t foreground;				/*!< String color */
+	uint16_t background;				/*!< String background or rectangle color */
+	uint8_t length;						/*!< Characters of the string */
+	char text[ILI9341_DAMAGE_TEXT + 1];	/*!< Characters of the string */
+} lcd_item_state_t;
+
+/**
+ * @brief Item remembered by the damage tracking layer
+ */
+typedef struct
+{
+	uint8_t type;						/*!< ITEM_FREE, ITEM_STRING or ITEM_RECTANGLE */
+	uint8_t visible;					/*!< The shown state is on the LCD */
+	lcd_rect_t area;					/*!< Position, for strings x0 and y0 only */
+	lcd_item_state_t recorded;			/*!< State recorded since the last flush */
+	lcd_item_state_t shown;				/*!< State on the LCD */
+} lcd_item_t;
+
+/**
+ * @brief Damage tracking layer
+ */
+typedef struct
+{
+	lcd_item_t items[ILI9341_DAMAGE_ITEMS];	/*!< Items in drawing order */
+	lcd_rect_t rects[ILI9341_DAMAGE_RECTS];	/*!< Dirty rectangles, none of them touch */
+	uint8_t rect_count;						/*!< Number of dirty rectangles */
+	uint8_t window_open;					/*!< A rate window has been started */
+	uint32_t window_start;					/*!< Cycle counter at the start of the window */
+	uint32_t window_requested;				/*!< Requested pixels at the start of the window */
+	uint32_t window_pushed;					/*!< Pushed pixels at the start of the window */
+	ili9341_damage_stats_t stats;			/*!< Statistics */
+} lcd_damage_t;
+
+lcd_damage_t lcd_damage;					/*!< Damage tracking layer, empty at start */
+
+/*****************************************************************************
+ * Public types/enumerations/variables declarations
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Private functions definitions
+ ****************************************************************************/
+
+/**
+ * @brief  		Find an item by type and position, or take a free entry for it
+ * @param[in]  	type: ITEM_STRING or ITEM_RECTANGLE
+ * @param[in]  	area: Position of the item
+ * @retval 		Pointer to the item, NULL when the table is full
+ */
+lcd_item_t * DamageFindItem(uint8_t type, const lcd_rect_t * area);
+
+/**
+ * @brief  		Add a dirty rectangle, merging it with the ones it touches
+ * @param[in]  	x0: X coordinate of top left point
+ * @param[in]  	y0: Y coordinate of top left point
+ * @param[in]  	x1: X coordinate of bottom right point
+ * @param[in]  	y1: Y coordinate of bottom right point
+ * @retval 		None
+ */
+void DamageAddRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @brief  		Fill the intersection of two rectangles
+ * @param[in]  	area: Rectangle to fill
+ * @param[in]  	clip: Dirty rectangle
+ * @param[in]  	color: Fill color
+ * @retval 		None
+ */
+void DamageFillClipped(const lcd_rect_t * area, const lcd_rect_t * clip, uint16_t color);
+
+/**
+ * @brief  		Erase inside a dirty rectangle what the shown string covers and the recorded one does not
+ * @param[in]  	item: Item to erase
+ * @param[in]  	clip: Dirty rectangle
+ * @retval 		None
+ */
+void DamageEraseItem(const lcd_item_t * item, const lcd_rect_t * clip);
+
+/**
+ * @brief  		Draw the recorded state of an item inside a dirty rectangle
+ * @param[in]  	item: Item to draw
+ * @param[in]  	clip: Dirty rectangle
+ * @retval 		None
+ */
+void DamageDrawItem(const lcd_item_t * item, const lcd_rect_t * clip);
+
+/**
+ * @brief  		Update the rates of the statistics when a second has passed
+ * @retval 		None
+ */
+void DamageUpdateRates(void);
+
+/*****************************************************************************
+ * Private functions declarations
+ ****************************************************************************/
+
+lcd_item_t * DamageFindItem(uint8_t type, const lcd_rect_t * area)
+{
+	uint8_t i;
+	lcd_item_t * item;
+
+	for (i = 0; i < ILI9341_DAMAGE_ITEMS; i++)
+	{
+		item = &lcd_damage.items[i];
+		if (item->type == ITEM_FREE)
+		{
+			/* Entries are taken in order and never released one by one */
+			memset(item, 0, sizeof(lcd_item_t));
+			item->type = type;
+			item->area = *area;
+			return item;
+		}
+		if ((item->type == type) && (item->area.x0 == area->x0) && (item->area.y0 == area->y0) &&
+			((type == ITEM_STRING) || ((item->area.x1 == area->x1) && (item->area.y1 == area->y1))))
+		{
+			return item;
+		}
+	}
+	return NULL;
+}
+
+void DamageAddRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	uint8_t i, best;
+	uint32_t growth, best_growth;
+	lcd_rect_t * rect;
+	lcd_rect_t merged;
+
+	i = 0;
+	while (i < lcd_damage.rect_count)
+	{
+		rect = &lcd_damage.rects[i];
+		if ((x0 <= rect->x1 + 1) && (rect->x0 <= x1 + 1) && (y0 <= rect->y1 + 1) && (rect->y0 <= y1 + 1))
+		{
+			/* The union may touch rectangles already checked, start again without this one */
+			if (rect->x0 < x0) x0 = rect->x0;
+			if (rect->y0 < y0) y0 = rect->y0;
+			if (rect->x1 > x1) x1 = rect->x1;
+			if (rect->y1 > y1) y1 = rect->y1;
+			*rect = lcd_damage.rects[--lcd_damage.rect_count];
+			lcd_damage.stats.merges++;
+			i = 0;
+		}
+		else
+		{
+			i++;
+		}
+	}
+
+	if (lcd_damage.rect_count == ILI9341_DAMAGE_RECTS)
+	{
+		/* No room, merge with the rectangle whose area grows the least and check again */
+		best = 0;
+		best_growth = UINT32_MAX;
+		for (i = 0; i < lcd_damage.rect_count; i++)
+		{
+			rect = &lcd_damage.rects[i];
+			merged.x0 = (rect->x0 < x0) ? rect->x0 : x0;
+			merged.y0 = (rect->y0 < y0) ? rect->y0 : y0;
+			merged.x1 = (rect->x1 > x1) ? rect->x1 : x1;
+			merged.y1 = (rect->y1 > y1) ? rect->y1 : y1;
+			growth = (uint32_t)(merged.x1 - merged.x0 + 1) * (merged.y1 - merged.y0 + 1) -
+				(uint32_t)(rect->x1 - rect->x0 + 1) * (rect->y1 - rect->y0 + 1);
+			if (growth < best_growth)
+			{
+				best_growth = growth;
+				best = i;
+			}
+		}
+		rect = &lcd_damage.rects[best];
+		merged.x0 = (rect->x0 < x0) ? rect->x0 : x0;
+		merged.y0 = (rect->y0 < y0) ? rect->y0 : y0;
+		merged.x1 = (rect->x1 > x1) ? rect->x1 : x1;
+		merged.y1 = (rect->y1 > y1) ? rect->y1 : y1;
+		*rect = lcd_damage.rects[--lcd_damage.rect_count];
+		lcd_damage.stats.merges++;
+		DamageAddRect(merged.x0, merged.y0, merged.x1, merged.y1);
+		return;
+	}
+
+	rect = &lcd_damage.rects[lcd_damage.rect_count++];
+	rect->x0 = x0;
+	rect->y0 = y0;
+	rect->x1 = x1;
+	rect->y1 = y1;
+}
+
+void DamageFillClipped(const lcd_rect_t * area, const lcd_rect_t * clip, uint16_t color)
+{
+	lcd_rect_t fill;
+
+	fill.x0 = (area->x0 > clip->x0) ? area->x0 : clip->x0;
+	fill.y0 = (area->y0 > clip->y0) ? area->y0 : clip->y0;
+	fill.x1 = (area->x1 < clip->x1) ? area->x1 : clip->x1;
+	fill.y1 = (area->y1 < clip->y1) ? area->y1 : clip->y1;
+	if ((fill.x0 <= fill.x1) && (fill.y0 <= fill.y1))
+	{
+		ILI9341DrawFilledRectangle(fill.x0, fill.y0, fill.x1, fill.y1, color);
+		lcd_damage.stats.pushed += (uint32_t)(fill.x1 - fill.x0 + 1) * (fill.y1 - fill.y0 + 1);
+	}
+}
+
+void DamageEraseItem(const lcd_item_t * item, const lcd_rect_t * clip)
+{
+	const lcd_item_state_t * recorded = &item->recorded;
+	const lcd_item_state_t * shown = &item->shown;
+	uint16_t width, height, shown_width, shown_height;
+	lcd_rect_t erase;
+
+	if ((item->type != ITEM_STRING) || !item->visible)
+	{
+		return;
+	}
+
+	width = recorded->length * recorded->font->FontWidth;
+	height = recorded->font->FontHeight;
+	shown_width = shown->length * shown->font->FontWidth;
+	shown_height = shown->font->FontHeight;
+	if (shown_width > width)
+	{
+		erase.x0 = item->area.x0 + width;
+		erase.y0 = item->area.y0;
+		erase.x1 = item->area.x0 + shown_width - 1;
+		erase.y1 = item->area.y0 + shown_height - 1;
+		DamageFillClipped(&erase, clip, shown->background);
+	}
+	if ((shown_height > height) && (width > 0) && (shown_width > 0))
+	{
+		erase.x0 = item->area.x0;
+		erase.y0 = item->area.y0 + height;
+		erase.x1 = item->area.x0 + ((shown_width < width) ? shown_width : width) - 1;
+		erase.y1 = item->area.y0 + shown_height - 1;
+		DamageFillClipped(&erase, clip, shown->background);
+	}
+}
+
+void DamageDrawItem(const lcd_item_t * item, const lcd_rect_t * clip)
+{
+	const lcd_item_state_t * recorded = &item->recorded;
+	uint16_t width, height;
+	uint16_t first, last;
+	char run[ILI9341_DAMAGE_TEXT + 1];
+
+	if (item->type == ITEM_RECTANGLE)
+	{
+		DamageFillClipped(&item->area, clip, recorded->background);
+		return;
+	}
+
+	width = recorded->length * recorded->font->FontWidth;
+	height = recorded->font->FontHeight;
+
+	/* Draw the characters whose cells touch the dirty rectangle */
+	if ((width == 0) || (clip->x1 < item->area.x0) || (clip->x0 > item->area.x0 + width - 1) ||
+		(clip->y1 < item->area.y0) || (clip->y0 > item->area.y0 + height - 1))
+	{
+		return;
+	}
+	first = (clip->x0 > item->area.x0) ? (clip->x0 - item->area.x0) / recorded->font->FontWidth : 0;
+	last = (clip->x1 - item->area.x0) / recorded->font->FontWidth;
+	if (last >= recorded->length)
+	{
+		last = recorded->length - 1;
+	}
+	memcpy(run, &recorded->text[first], last - first + 1);
+	run[last - first + 1] = '\0';
+	ILI9341DrawString(item->area.x0 + first * recorded->font->FontWidth, item->area.y0, run,
+		recorded->font, recorded->foreground, recorded->background);
+	lcd_damage.stats.pushed += (uint32_t)(last - first + 1) * recorded->font->FontWidth * height;
+}
+
+void DamageUpdateRates(void)
+{
+	uint32_t now, elapsed, frequency;
+
+	now = Read_Cycles();
+	if (!lcd_damage.window_open)
+	{
+		lcd_damage.window_open = 1;
+		lcd_damage.window_start = now;
+		lcd_damage.window_requested = lcd_damage.stats.requested;
+		lcd_damage.window_pushed = lcd_damage.stats.pushed;
+		return;
+	}
+	elapsed = now - lcd_damage.window_start;
+	frequency = Cycles_Frequency();
+	if (elapsed >= frequency)
+	{
+		lcd_damage.stats.requested_per_second = (uint32_t)((uint64_t)(lcd_damage.stats.requested -
+			lcd_damage.window_requested) * frequency / elapsed);
+		lcd_damage.stats.pushed_per_second = (uint32_t)((uint64_t)(lcd_damage.stats.pushed -
+			lcd_damage.window_pushed) * frequency / elapsed);
+		lcd_damage.window_start = now;
+		lcd_damage.window_requested = lcd_damage.stats.requested;
+		lcd_damage.window_pushed = lcd_damage.stats.pushed;
+	}
+}
+
+/*****************************************************************************
+ * Public functions declarations
+ ****************************************************************************/
+
+void ILI9341DamageReset(void)
+{
+	memset(lcd_damage.items, 0, sizeof(lcd_damage.items));
+	lcd_damage.rect_count = 0;
+}
+
+void ILI9341DamageString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background)
+{
+	lcd_rect_t area = {x, y, x, y};
+	lcd_item_t * item;
+	lcd_item_state_t * recorded;
+	lcd_item_state_t * shown;
+	uint8_t length, longest, i, first;
+
+	for (length = 0; (length < ILI9341_DAMAGE_TEXT) && (str[length] != '\0') && (str[length] != '\n'); length++);
+	lcd_damage.stats.requested += (uint32_t)length * font->FontWidth * font->FontHeight;
+
+	item = DamageFindItem(ITEM_STRING, &area);
+	if (item == NULL)
+	{
+		ILI9341DrawString(x, y, str, font, foreground, background);
+		lcd_damage.stats.pushed += (uint32_t)length * font->FontWidth * font->FontHeight;
+		lcd_damage.stats.overflows++;
+		return;
+	}
+
+	recorded = &item->recorded;
+	shown = &item->shown;
+	recorded->font = font;
+	recorded->foreground = foreground;
+	recorded->background = background;
+	recorded->length = length;
+	memcpy(recorded->text, str, length);
+	recorded->text[length] = '\0';
+
+	if (!item->visible || (shown->font != font) || (shown->foreground != foreground) ||
+		(shown->background != background))
+	{
+		/* Everything changes, the old string is covered or erased */
+		if (item->visible && (shown->length > 0))
+		{
+			DamageAddRect(x, y, x + shown->length * shown->font->FontWidth - 1, y + shown->font->FontHeight - 1);
+		}
+		if (length > 0)
+		{
+			DamageAddRect(x, y, x + length * font->FontWidth - 1, y + font->FontHeight - 1);
+		}
+		return;
+	}
+
+	/* Same style, only the runs of characters that differ are dirty */
+	longest = (length > shown->length) ? length : shown->length;
+	i = 0;
+	while (i < longest)
+	{
+		if ((i < length) && (i < shown->length) && (recorded->text[i] == shown->text[i]))
+		{
+			i++;
+			continue;
+		}
+		first = i;
+		while ((i < longest) && !((i < length) && (i < shown->length) && (recorded->text[i] == shown->text[i])))
+		{
+			i++;
+		}
+		DamageAddRect(x + first * font->FontWidth, y, x + i * font->FontWidth - 1, y + font->FontHeight - 1);
+	}
+}
+
+void ILI9341DamageFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+	lcd_rect_t area;
+	lcd_item_t * item;
+
+	area.x0 = (x0 < x1) ? x0 : x1;
+	area.y0 = (y0 < y1) ? y0 : y1;
+	area.x1 = (x0 < x1) ? x1 : x0;
+	area.y1 = (y0 < y1) ? y1 : y0;
+	lcd_damage.stats.requested += (uint32_t)(area.x1 - area.x0 + 1) * (area.y1 - area.y0 + 1);
+
+	item = DamageFindItem(ITEM_RECTANGLE, &area);
+	if (item == NULL)
+	{
+		ILI9341DrawFilledRectangle(area.x0, area.y0, area.x1, area.y1, color);
+		lcd_damage.stats.pushed += (uint32_t)(area.x1 - area.x0 + 1) * (area.y1 - area.y0 + 1);
+		lcd_damage.stats.overflows++;
+		return;
+	}
+
+	item->recorded.background = color;
+	if (!item->visible || (item->shown.background != color))
+	{
+		DamageAddRect(area.x0, area.y0, area.x1, area.y1);
+	}
+}
+
+void ILI9341DamageFlush(void)
+{
+	uint8_t i, j;
+
+	for (i = 0; i < lcd_damage.rect_count; i++)
+	{
+		/* Erase first, so the items below an old string are drawn again over the erased area */
+		for (j = 0; (j < ILI9341_DAMAGE_ITEMS) && (lcd_damage.items[j].type != ITEM_FREE); j++)
+		{
+			DamageEraseItem(&lcd_damage.items[j], &lcd_damage.rects[i]);
+		}
+		for (j = 0; (j < ILI9341_DAMAGE_ITEMS) && (lcd_damage.items[j].type != ITEM_FREE); j++)
+		{
+			DamageDrawItem(&lcd_damage.items[j], &lcd_damage.rects[i]);
+		}
+	}
+	lcd_damage.stats.rects += lcd_damage.rect_count;
+	lcd_damage.rect_count = 0;
+
+	/* Every difference was in some rectangle, the recorded state is now on the LCD */
+	for (j = 0; (j < ILI9341_DAMAGE_ITEMS) && (lcd_damage.items[j].type != ITEM_FREE); j++)
+	{
+		lcd_damage.items[j].shown = lcd_damage.items[j].recorded;
+		lcd_damage.items[j].visible = 1;
+	}
+
+	lcd_damage.stats.flushes++;
+	DamageUpdateRates();
+}
+
+void ILI9341DamageGetStats(ili9341_damage_stats_t * stats)
+{
+	*stats = lcd_damage.stats;
+}
+
+void ILI9341DamageClearStats(void)
+{
+	memset(&lcd_damage.stats, 0, sizeof(lcd_damage.stats));
+	lcd_damage.window_open = 0;
+}
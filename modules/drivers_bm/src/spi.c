@@ -11,7 +11,7 @@
  * is the only one implemented in the EDU-CIAA NXP. However, it remains compatible
  * for future upgrades.
  *
- * @note This driver is limited to transfer data only in 8 bits format.
+ * @note This driver transfers data in 8 bits frames, SpiWrite16 writes 16 bits frames.
  *
  * @author Albano Peñalva
  *
@@ -22,6 +22,8 @@
  * | 09/11/2018 | Document creation		                         						|
  * | 17/12/2018 | Added capability to transfer data in Polling, Interrupt and DMA modes |
  * | 20/12/2018 | Added capability to handle CS pin	 			 						|
+ * | 17/10/2026 | Added callback at the end of each transfer							|
+ * | 17/10/2026 | Added 16 bits frames writes, halfword DMA transfers					|
  *
  */
 
@@ -45,6 +47,10 @@
 #define PORT_SCK1 	0xF		/*!< SSP1 SCK at pin PF.4 */
 #define PIN_SCK1 	0x4
 
+#define DMA_MAX_TRANSFER	4095	/*!< Maximum number of transfers of a GPDMA descriptor */
+#define DMA_DESCRIPTORS		16		/*!< Descriptors chained in a long write, longer ones continue with a new list */
+#define DMA_SSP1_TX_REQUEST	12		/*!< DMAMUX request line of SSP1 Tx, with function 0 */
+
 /*! SPI1 global variables */
 Chip_SSP_DATA_SETUP_T ssp1_data;		/*!< Data setup structure */
 transferMode_t ssp1_transfer_mode;
@@ -54,6 +60,13 @@ uint8_t ssp1_dma_tx_completed;			/*!< Store dma data transmit status */
 uint8_t dma_ch_ssp1_tx;					/*!< DMA channel for SSP tx */
 uint8_t dma_ch_ssp1_rx;					/*!< DMA channel for SSP rx */
 void (* SetCS1) (uint8_t);				/*!< Pointer function to set SPI1 CS pin state */
+DMA_TransferDescriptor_t ssp1_dma_descriptors[DMA_DESCRIPTORS];	/*!< Linked list for long DMA writes */
+void (* TransferCallback1) (void);		/*!< Pointer function called when a SPI1 transfer ends */
+uint32_t ssp1_clock_mode;				/*!< Phase and polarity of the SPI1 frames */
+uint32_t ssp1_frame_bits = SSP_BITS_8;	/*!< Current size of the SPI1 frames */
+uint8_t * ssp1_dma_next;				/*!< Data of a long DMA write not yet in the linked list */
+uint32_t ssp1_dma_left;					/*!< DMA transfers of a long write not yet in the linked list */
+uint32_t ssp1_dma_width;				/*!< Width of the DMA transfers of a long write */
 
 /*****************************************************************************
  * Public types/enumerations/variables declarations
@@ -63,10 +76,92 @@ void (* SetCS1) (uint8_t);				/*!< Pointer function to set SPI1 CS pin state */
  * Private functions definitions
  ****************************************************************************/
 
+/**
+ * @brief		Set the size of the SPI1 frames
+ * @param[in]	bits SSP_BITS_8 or SSP_BITS_16
+ * @return		None
+ * @note		The port must be free, the SSP is reconfigured only when the size changes
+ */
+void Spi1FrameSize(uint32_t bits);
+
+/**
+ * @brief		Start the SSP1 Tx DMA channel on a linked list of descriptors
+ * @param[in]	channel DMA channel taken for SSP1 Tx
+ * @param[in]	descriptor First descriptor, loaded in the channel
+ * @return		None
+ * @note		Chip_GPDMA_SGTransfer takes the destination of the first descriptor as a connection,
+ * 				but Chip_GPDMA_PrepareDescriptor leaves there the address of the SSP data register
+ */
+void Spi1DmaStart(uint8_t channel, const DMA_TransferDescriptor_t * descriptor);
+
+/**
+ * @brief		Send the next part of a long DMA write, ssp1_dma_next and ssp1_dma_left
+ * @return		None
+ * @note		Up to DMA_DESCRIPTORS x 4095 transfers are chained in a list, DMA_IRQHandler starts
+ * 				the next list when the previous one ends
+ */
+void Spi1DmaWrite(void);
+
 /*****************************************************************************
  * Private functions declarations
  ****************************************************************************/
 
+void Spi1FrameSize(uint32_t bits)
+{
+	if (ssp1_frame_bits != bits)
+	{
+		Chip_SSP_SetFormat(LPC_SSP1, bits, SSP_FRAMEFORMAT_SPI, ssp1_clock_mode);
+		ssp1_frame_bits = bits;
+	}
+}
+
+void Spi1DmaStart(uint8_t channel, const DMA_TransferDescriptor_t * descriptor)
+{
+	GPDMA_CH_CFG_T config;
+	GPDMA_CH_T * dma_channel = &LPC_GPDMA->CH[channel];
+
+	/* Destination address of the SSP1 Tx connection */
+	Chip_GPDMA_InitChannelCfg(LPC_GPDMA, &config, channel, descriptor->src, GPDMA_CONN_SSP1_Tx,
+		0, GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+	/* Request line of SSP1 Tx, as Chip_GPDMA_Transfer sets it */
+	LPC_CREG->DMAMUX &= ~(0x03 << (2 * DMA_SSP1_TX_REQUEST));
+	LPC_GPDMA->INTTCCLEAR = (1UL << channel);
+	LPC_GPDMA->INTERRCLR = (1UL << channel);
+	LPC_GPDMA->CONFIG = GPDMA_DMACConfig_E;
+	while (!(LPC_GPDMA->CONFIG & GPDMA_DMACConfig_E));
+	dma_channel->SRCADDR = config.SrcAddr;
+	dma_channel->DESTADDR = config.DstAddr;
+	dma_channel->LLI = descriptor->lli;
+	dma_channel->CONTROL = descriptor->ctrl;
+	dma_channel->CONFIG = GPDMA_DMACCxConfig_IE | GPDMA_DMACCxConfig_ITC |
+		GPDMA_DMACCxConfig_TransferType(GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA) |
+		GPDMA_DMACCxConfig_DestPeripheral(DMA_SSP1_TX_REQUEST);
+	Chip_GPDMA_ChannelCmd(LPC_GPDMA, channel, ENABLE);
+}
+
+void Spi1DmaWrite(void)
+{
+	uint32_t descriptor = 0;
+	uint32_t size;
+
+	while ((ssp1_dma_left > 0) && (descriptor < DMA_DESCRIPTORS))
+	{
+		size = (ssp1_dma_left > DMA_MAX_TRANSFER) ? DMA_MAX_TRANSFER : ssp1_dma_left;
+		ssp1_dma_left -= size;
+		Chip_GPDMA_PrepareDescriptor(LPC_GPDMA, &ssp1_dma_descriptors[descriptor],
+			(uint32_t) ssp1_dma_next, GPDMA_CONN_SSP1_Tx, size, GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA,
+			((ssp1_dma_left > 0) && (descriptor + 1 < DMA_DESCRIPTORS)) ?
+			&ssp1_dma_descriptors[descriptor + 1] : NULL);
+		/* LPCOpen prepares SSP descriptors with byte width */
+		ssp1_dma_descriptors[descriptor].ctrl = (ssp1_dma_descriptors[descriptor].ctrl &
+			~(GPDMA_DMACCxControl_SWidth(0x07) | GPDMA_DMACCxControl_DWidth(0x07))) |
+			GPDMA_DMACCxControl_SWidth(ssp1_dma_width) | GPDMA_DMACCxControl_DWidth(ssp1_dma_width);
+		ssp1_dma_next += size << ssp1_dma_width;
+		descriptor++;
+	}
+	Spi1DmaStart(dma_ch_ssp1_tx, &ssp1_dma_descriptors[0]);
+}
+
 /*****************************************************************************
  * Public functions declarations
  ****************************************************************************/
@@ -92,21 +187,23 @@ uint8_t SpiInit(spiConfig_t spi)
 		switch(spi.clk_mode)
 		{
 		case MODE0:
-			Chip_SSP_SetFormat(LPC_SSP1, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA0_CPOL0);
+			ssp1_clock_mode = SSP_CLOCK_CPHA0_CPOL0;
 			break;
 
 		case MODE1:
-			Chip_SSP_SetFormat(LPC_SSP1, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA1_CPOL0);
+			ssp1_clock_mode = SSP_CLOCK_CPHA1_CPOL0;
 			break;
 
 		case MODE2:
-			Chip_SSP_SetFormat(LPC_SSP1, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA0_CPOL1);
+			ssp1_clock_mode = SSP_CLOCK_CPHA0_CPOL1;
 			break;
 
 		case MODE3:
-			Chip_SSP_SetFormat(LPC_SSP1, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA1_CPOL1);
+			ssp1_clock_mode = SSP_CLOCK_CPHA1_CPOL1;
 			break;
 		}
+		Chip_SSP_SetFormat(LPC_SSP1, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, ssp1_clock_mode);
+		ssp1_frame_bits = SSP_BITS_8;
 		Chip_SSP_SetBitRate(LPC_SSP1, spi.bitrate);
 		Chip_SSP_Enable(LPC_SSP1);
 		ssp1_transfer_mode = spi.transfer_mode;
@@ -117,6 +214,7 @@ uint8_t SpiInit(spiConfig_t spi)
 
 		case SPI_INTERRUPT:
 			/* Setting SSP interrupt */
+			NVIC_SetPriority(SSP1_IRQn, SPI_IRQ_PRIORITY);
 			NVIC_EnableIRQ(SSP1_IRQn);
 			break;
 
@@ -125,7 +223,7 @@ uint8_t SpiInit(spiConfig_t spi)
 			Chip_GPDMA_Init(LPC_GPDMA);
 			/* Setting GPDMA interrupt */
 			NVIC_DisableIRQ(DMA_IRQn);
-			NVIC_SetPriority(DMA_IRQn, ((0x01 << 3) | 0x01));
+			NVIC_SetPriority(DMA_IRQn, SPI_IRQ_PRIORITY);
 			NVIC_EnableIRQ(DMA_IRQn);
 			break;
 		}
@@ -148,6 +246,7 @@ void SpiRead(spiPort_t port, uint8_t * rx_buffer, uint32_t rx_buffer_size)
 	case SPI_1:
 		/* Wait until SPI port is free */
 		while(!ssp1_transfer_completed);
+		Spi1FrameSize(SSP_BITS_8);
 		ssp1_transfer_completed = FALSE;
 		/* If CS controlled by driver, activate CS */
 		if (SetCS1 != NULL)
@@ -171,6 +270,10 @@ void SpiRead(spiPort_t port, uint8_t * rx_buffer, uint32_t rx_buffer_size)
 			{
 				SetCS1(HIGH);
 			}
+			if (TransferCallback1 != NULL)
+			{
+				TransferCallback1();
+			}
 			break;
 
 		case SPI_INTERRUPT:
@@ -211,6 +314,7 @@ void SpiWrite(spiPort_t port, uint8_t * tx_buffer, uint32_t tx_buffer_size)
 	case SPI_1:
 		/* Wait untill SPI port is free */
 		while(!ssp1_transfer_completed);
+		Spi1FrameSize(SSP_BITS_8);
 		ssp1_transfer_completed = FALSE;
 		/* If CS controlled by driver, activate CS */
 		if (SetCS1 != NULL)
@@ -234,6 +338,10 @@ void SpiWrite(spiPort_t port, uint8_t * tx_buffer, uint32_t tx_buffer_size)
 			{
 				SetCS1(HIGH);
 			}
+			if (TransferCallback1 != NULL)
+			{
+				TransferCallback1();
+			}
 			break;
 
 		case SPI_INTERRUPT:
@@ -257,9 +365,89 @@ void SpiWrite(spiPort_t port, uint8_t * tx_buffer, uint32_t tx_buffer_size)
 			/* Get DMA channels for tx */
 			dma_ch_ssp1_tx = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_SSP1_Tx);
 			Chip_SSP_DMA_Enable(LPC_SSP1);
-			/* data tx_buffer --> SSP */
-			Chip_GPDMA_Transfer(LPC_GPDMA, dma_ch_ssp1_tx, (uint32_t) tx_buffer, GPDMA_CONN_SSP1_Tx,
-				GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, tx_buffer_size);
+			if (tx_buffer_size <= DMA_MAX_TRANSFER)
+			{
+				/* data tx_buffer --> SSP */
+				Chip_GPDMA_Transfer(LPC_GPDMA, dma_ch_ssp1_tx, (uint32_t) tx_buffer, GPDMA_CONN_SSP1_Tx,
+					GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, tx_buffer_size);
+			}
+			else
+			{
+				/* Longer writes are split in linked lists, the DMA goes through each one in a single transfer */
+				ssp1_dma_next = tx_buffer;
+				ssp1_dma_left = tx_buffer_size;
+				ssp1_dma_width = GPDMA_WIDTH_BYTE;
+				Spi1DmaWrite();
+			}
+			break;
+		}
+		break;
+	}
+}
+
+void SpiWrite16(spiPort_t port, uint16_t * tx_buffer, uint32_t tx_buffer_count)
+{
+	switch(port)
+	{
+	case SPI_1:
+		/* Wait untill SPI port is free, the frame size can only change between transfers */
+		while(!ssp1_transfer_completed);
+		Spi1FrameSize(SSP_BITS_16);
+		ssp1_transfer_completed = FALSE;
+		/* If CS controlled by driver, activate CS */
+		if (SetCS1 != NULL)
+		{
+			SetCS1(LOW);
+		}
+
+		switch(ssp1_transfer_mode)
+		{
+		case SPI_POLLING:
+			/* Initialize data setup structure, the length is always in bytes */
+			ssp1_data.tx_data = tx_buffer;
+			ssp1_data.tx_cnt = 0;
+			ssp1_data.rx_data = NULL;
+			ssp1_data.rx_cnt = 0;
+			ssp1_data.length = tx_buffer_count * 2;
+			Chip_SSP_RWFrames_Blocking(LPC_SSP1, &ssp1_data);
+			ssp1_transfer_completed = TRUE;
+			/* If CS controlled by driver, deactivate CS */
+			if (SetCS1 != NULL)
+			{
+				SetCS1(HIGH);
+			}
+			if (TransferCallback1 != NULL)
+			{
+				TransferCallback1();
+			}
+			break;
+
+		case SPI_INTERRUPT:
+			/* Initialize data setup structure, the length is always in bytes */
+			ssp1_data.tx_data = tx_buffer;
+			ssp1_data.tx_cnt = 0;
+			ssp1_data.rx_data = NULL;
+			ssp1_data.rx_cnt = 0;
+			ssp1_data.length = tx_buffer_count * 2;
+			/* flush dummy data from SSP FiFO */
+			Chip_SSP_Int_FlushData(LPC_SSP1);
+			/* transmit first frame */
+			Chip_SSP_Int_RWFrames16Bits(LPC_SSP1, &ssp1_data);
+			/* enable interrupt */
+			Chip_SSP_Int_Enable(LPC_SSP1);
+			break;
+
+		case SPI_DMA:
+			ssp1_dma_rx_completed = TRUE;
+			ssp1_dma_tx_completed = FALSE;
+			/* Get DMA channels for tx */
+			dma_ch_ssp1_tx = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_SSP1_Tx);
+			Chip_SSP_DMA_Enable(LPC_SSP1);
+			/* Halfword transfers, each one moves a whole frame and the sizes count frames */
+			ssp1_dma_next = (uint8_t *) tx_buffer;
+			ssp1_dma_left = tx_buffer_count;
+			ssp1_dma_width = GPDMA_WIDTH_HALFWORD;
+			Spi1DmaWrite();
 			break;
 		}
 		break;
@@ -273,6 +461,7 @@ void SpiReadWrite(spiPort_t port, uint8_t * tx_buffer, uint8_t * rx_buffer, uint
 	case SPI_1:
 		/* Wait untill SPI port is free */
 		while(!ssp1_transfer_completed);
+		Spi1FrameSize(SSP_BITS_8);
 		ssp1_transfer_completed = FALSE;
 		/* If CS controlled by driver, activate CS */
 		if (SetCS1 != NULL)
@@ -296,6 +485,10 @@ void SpiReadWrite(spiPort_t port, uint8_t * tx_buffer, uint8_t * rx_buffer, uint
 			{
 				SetCS1(HIGH);
 			}
+			if (TransferCallback1 != NULL)
+			{
+				TransferCallback1();
+			}
 			break;
 
 		case SPI_INTERRUPT:
@@ -338,12 +531,23 @@ uint8_t SpiFree(spiPort_t port)
 	switch(port)
 		{
 		case SPI_1:
-			transfer_completed = ssp1_transfer_completed;
+			/* DMA ends when the last byte is written to the FIFO, the port is free when it is shifted out */
+			transfer_completed = ssp1_transfer_completed && !Chip_SSP_GetStatus(LPC_SSP1, SSP_STAT_BSY);
 			break;
 		}
 	return transfer_completed;
 }
 
+void SpiSetTransferCallback(spiPort_t port, void (* callback) (void))
+{
+	switch(port)
+	{
+	case SPI_1:
+		TransferCallback1 = callback;
+		break;
+	}
+}
+
 uint8_t SpiDeInit(spiPort_t port)
 {
 	uint8_t ret_value;
@@ -372,7 +576,14 @@ void SSP1_IRQHandler(void)
 {
 	/* Disable all interrupt */
 	Chip_SSP_Int_Disable(LPC_SSP1);
-	Chip_SSP_Int_RWFrames8Bits(LPC_SSP1, &ssp1_data);
+	if (ssp1_frame_bits == SSP_BITS_16)
+	{
+		Chip_SSP_Int_RWFrames16Bits(LPC_SSP1, &ssp1_data);
+	}
+	else
+	{
+		Chip_SSP_Int_RWFrames8Bits(LPC_SSP1, &ssp1_data);
+	}
 	if ((ssp1_data.rx_cnt != ssp1_data.length) || (ssp1_data.tx_cnt != ssp1_data.length))
 	{
 		/* enable all interrupts */
@@ -386,6 +597,10 @@ void SSP1_IRQHandler(void)
 		{
 			SetCS1(HIGH);
 		}
+		if (TransferCallback1 != NULL)
+		{
+			TransferCallback1();
+		}
 	}
 }
 
@@ -407,11 +622,21 @@ void DMA_IRQHandler(void)
 	{
 		if (Chip_GPDMA_Interrupt(LPC_GPDMA, dma_ch_ssp1_tx) == SUCCESS)
 		{
-			ssp1_dma_tx_completed = TRUE;
+			if (ssp1_dma_left > 0)
+			{
+				/* A long write goes on with the next linked list */
+				Spi1DmaWrite();
+			}
+			else
+			{
+				ssp1_dma_tx_completed = TRUE;
+			}
 		}
 	}
 	if (ssp1_dma_rx_completed && ssp1_dma_tx_completed)
 	{
+		/* The last bytes are still in the FIFO, at most 8 frames */
+		while (Chip_SSP_GetStatus(LPC_SSP1, SSP_STAT_BSY));
 		ssp1_transfer_completed = TRUE;
 		Chip_SSP_DMA_Disable(LPC_SSP1);
 		/* If CS controlled by driver, deactivate CS */
@@ -419,5 +644,9 @@ void DMA_IRQHandler(void)
 		{
 			SetCS1(HIGH);
 		}
+		if (TransferCallback1 != NULL)
+		{
+			TransferCallback1();
+		}
 	}
 }
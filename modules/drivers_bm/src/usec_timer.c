@@ -0,0 +1,112 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @brief Contador de microsegundos con una comparación programable
+ **
+ ** El TIMER1 cuenta libremente desde que se inicializa, sin reiniciarse en
+ ** ninguna comparación, y el MR0 solo tiene habilitada la interrupción
+ ** mientras hay un instante programado.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.17 | fiuner          | Version inicial del archivo                             |
+ **
+ ** @addtogroup drivers_bm Controladores
+ ** @brief Controladores de la EDU-CIAA sin sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+#include "usec_timer.h"
+
+/* === Definicion y Macros ===================================================================== */
+
+/** @brief Temporizador usado como contador de microsegundos */
+#define TIMER               LPC_TIMER1
+
+/** @brief Reloj del temporizador */
+#define TIMER_CLOCK         CLK_MX_TIMER1
+
+/** @brief Registro de comparación que genera la interrupción */
+#define MATCH               0
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void Init_Usec_Timer(uint32_t priority) {
+   Chip_TIMER_Init(TIMER);
+   Chip_TIMER_Disable(TIMER);
+   Chip_TIMER_Reset(TIMER);
+   Chip_TIMER_PrescaleSet(TIMER, Chip_Clock_GetRate(TIMER_CLOCK) / 1000000 - 1);
+   Chip_TIMER_MatchDisableInt(TIMER, MATCH);
+   Chip_TIMER_ResetOnMatchDisable(TIMER, MATCH);
+   Chip_TIMER_StopOnMatchDisable(TIMER, MATCH);
+   Chip_TIMER_ClearMatch(TIMER, MATCH);
+   Chip_TIMER_Enable(TIMER);
+
+   NVIC_SetPriority(USEC_TIMER_IRQn, priority);
+   NVIC_ClearPendingIRQ(USEC_TIMER_IRQn);
+   NVIC_EnableIRQ(USEC_TIMER_IRQn);
+}
+
+uint32_t Read_Usec_Timer(void) {
+   return Chip_TIMER_ReadCount(TIMER);
+}
+
+void Set_Usec_Timer_Match(uint32_t when) {
+   Chip_TIMER_SetMatch(TIMER, MATCH, when);
+   Chip_TIMER_MatchEnableInt(TIMER, MATCH);
+
+   /* La comparación solo se produce cuando el contador pasa a valer when, si
+    * ya lo alcanzo antes de escribir el registro no habria interrupción
+    * hasta la vuelta siguiente */
+   if ((int32_t) (when - Chip_TIMER_ReadCount(TIMER)) <= 0) {
+      NVIC_SetPendingIRQ(USEC_TIMER_IRQn);
+   }
+}
+
+void Clear_Usec_Timer_Match(void) {
+   Chip_TIMER_MatchDisableInt(TIMER, MATCH);
+   Chip_TIMER_ClearMatch(TIMER, MATCH);
+   NVIC_ClearPendingIRQ(USEC_TIMER_IRQn);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
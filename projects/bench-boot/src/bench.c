@@ -0,0 +1,391 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones de la creación estatica de los objetos del sistema
+ **
+ ** Describe un sistema de ocho tareas, colas, semaforos, mutex, grupos de
+ ** eventos y temporizadores con las tablas de static_system, y mide en ciclos
+ ** del procesador la duración de StaticSystemCreate, que usa la memoria
+ ** definida en tiempo de compilación, y la de crear los mismos objetos con
+ ** las funciones que piden la memoria a pvPortMalloc. Entre cada medición
+ ** los objetos se eliminan, y las tareas del sistema tienen menor prioridad
+ ** que la tarea de control por lo que nunca llegan a ejecutarse.
+ **
+ ** Cuentan como errores los objetos que no se pudieron crear y, en la
+ ** creación estatica, los pedidos al heap, que se cuentan con traceMALLOC.
+ ** Ademas de la tabla se informa la memoria que ocupan los objetos, conocida
+ ** en tiempo de compilación con STATIC_SYSTEM_RAM, y la que consume del heap
+ ** la creación dinámica. En PLATFORM=host cada tarea es un hilo, por lo que
+ ** crear y eliminar tareas cuesta mucho mas que en la placa.
+ **
+ ** La salida tiene el mismo formato que la de bench-kernel:
+ **
+ **     # bench-boot platform=edu-ciaa cpu_hz=204000000 counter_hz=204000000 ...
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     create_static,22,100,...
+ **     # memory objects=22 static_bytes=6360 heap_bytes=6720 heap_allocations=32
+ **
+ ** El parametro es la cantidad de objetos del sistema.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "cycles.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         100    /*!< Veces que se crea el sistema en cada prueba */
+#endif
+
+#define PRIORIDAD_CONTROL     ( configMAX_PRIORITIES - 1 )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+
+#define PRIORIDAD_TRABAJO     ( tskIDLE_PRIORITY + 1 )
+#define PILA_TRABAJO          ( configMINIMAL_STACK_SIZE * 2 )
+
+/** @brief Tareas del sistema */
+#define STATIC_SYSTEM_TASKS(TASK)                                                                  \
+   TASK(entrada, Trabajo, NULL, PILA_TRABAJO, PRIORIDAD_TRABAJO)                                   \
+   TASK(filtro, Trabajo, NULL, PILA_TRABAJO, PRIORIDAD_TRABAJO)                                    \
+   TASK(regulador, Trabajo, NULL, PILA_TRABAJO, PRIORIDAD_TRABAJO + 1)                             \
+   TASK(salida, Trabajo, NULL, PILA_TRABAJO, PRIORIDAD_TRABAJO)                                    \
+   TASK(pantalla, Trabajo, NULL, PILA_TRABAJO * 2, PRIORIDAD_TRABAJO)                              \
+   TASK(teclado, Trabajo, NULL, PILA_TRABAJO, PRIORIDAD_TRABAJO + 1)                               \
+   TASK(registro, Trabajo, NULL, PILA_TRABAJO, PRIORIDAD_TRABAJO)                                  \
+   TASK(supervisor, Trabajo, NULL, PILA_TRABAJO, PRIORIDAD_TRABAJO + 2)
+
+/** @brief Colas del sistema */
+#define STATIC_SYSTEM_QUEUES(QUEUE)                                                                \
+   QUEUE(muestras, 16, sizeof(uint32_t))                                                           \
+   QUEUE(comandos, 8, 16)                                                                          \
+   QUEUE(dibujos, 8, 32)                                                                           \
+   QUEUE(mensajes, 4, 64)
+
+/** @brief Semaforos del sistema */
+#define STATIC_SYSTEM_SEMAPHORES(SEMAPHORE)                                                        \
+   SEMAPHORE(conversion, 1, 0)                                                                     \
+   SEMAPHORE(transmision, 1, 0)                                                                    \
+   SEMAPHORE(teclas, 8, 0)                                                                         \
+   SEMAPHORE(buffers, 4, 4)
+
+/** @brief Mutex del sistema */
+#define STATIC_SYSTEM_MUTEXES(MUTEX)                                                               \
+   MUTEX(uart)                                                                                     \
+   MUTEX(spi)
+
+/** @brief Grupos de eventos del sistema */
+#define STATIC_SYSTEM_EVENTS(EVENTS)                                                               \
+   EVENTS(estados)                                                                                 \
+   EVENTS(alarmas)
+
+/** @brief Temporizadores del sistema */
+#define STATIC_SYSTEM_TIMERS(TIMER)                                                                \
+   TIMER(parpadeo, pdMS_TO_TICKS(500), pdTRUE, Temporizador)                                       \
+   TIMER(vigilancia, pdMS_TO_TICKS(1000), pdFALSE, Temporizador)
+
+/** @brief Crea un objeto del sistema con la memoria del heap */
+#define CREAR_TAREA(name, function, parameters, stack, priority)                                   \
+   xTaskCreate(function, #name, stack, parameters, priority, &name);
+#define CREAR_COLA(name, length, size)               name = xQueueCreate(length, size);
+#define CREAR_SEMAFORO(name, maximum, initial)       name = xSemaphoreCreateCounting(maximum, initial);
+#define CREAR_MUTEX(name)                            name = xSemaphoreCreateMutex();
+#define CREAR_EVENTOS(name)                          name = xEventGroupCreate();
+#define CREAR_TEMPORIZADOR(name, period, reload, function)                                         \
+   name = xTimerCreate(#name, period, reload, NULL, function);
+
+/** @brief Elimina un objeto del sistema */
+#define ELIMINAR_TAREA(name, ...)                    vTaskDelete(name);
+#define ELIMINAR_COLA(name, ...)                     vQueueDelete(name);
+#define ELIMINAR_SEMAFORO(name, ...)                 vSemaphoreDelete(name);
+#define ELIMINAR_EVENTOS(name)                       vEventGroupDelete(name);
+#define ELIMINAR_TEMPORIZADOR(name, ...)             xTimerDelete(name, portMAX_DELAY);
+
+/** @brief Cuenta un objeto del sistema que no se pudo crear */
+#define VERIFICAR(name, ...)                         faltantes += (name == NULL);
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+#include "static_system.h"
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;            /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;              /*!< Menor valor medido */
+   uint32_t maximo;              /*!< Mayor valor medido */
+   uint32_t errores;             /*!< Mediciones en las que falló la verificación */
+   uint64_t total;               /*!< Suma de todas las mediciones */
+} resultado_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Tarea del sistema, nunca llega a ejecutarse durante las pruebas */
+void Trabajo(void * parametros);
+
+/** @brief Función de los temporizadores del sistema, que nunca se arrancan */
+void Temporizador(TimerHandle_t temporizador);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Crea los objetos del sistema con la memoria del heap */
+static void CrearDinamico(void);
+
+/** @brief Elimina los objetos del sistema y cuenta los que no se habian creado */
+static uint32_t Eliminar(void);
+
+/** @brief Envia una fila de la tabla de resultados */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+/** @brief Bloque de control y pila de la tarea de control, que tampoco usa el heap */
+static StaticTask_t control_tcb;
+static StackType_t control_pila[PILA_CONTROL];
+
+static resultado_t resultados[2];
+static uint32_t sobrecarga;
+
+/** @brief Pedidos al heap desde el arranque */
+static volatile uint32_t pedidos;
+
+/* === Definiciones de variables externas ================================== */
+
+/** @brief Memoria y referencias de los objetos del sistema, y StaticSystemCreate */
+STATIC_SYSTEM_DEFINE();
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+}
+
+static void CrearDinamico(void) {
+   STATIC_SYSTEM_QUEUES(CREAR_COLA)
+   STATIC_SYSTEM_SEMAPHORES(CREAR_SEMAFORO)
+   STATIC_SYSTEM_MUTEXES(CREAR_MUTEX)
+   STATIC_SYSTEM_EVENTS(CREAR_EVENTOS)
+   STATIC_SYSTEM_TIMERS(CREAR_TEMPORIZADOR)
+   STATIC_SYSTEM_TASKS(CREAR_TAREA)
+}
+
+static uint32_t Eliminar(void) {
+   uint32_t faltantes = 0;
+
+   STATIC_SYSTEM_TASKS(VERIFICAR)
+   STATIC_SYSTEM_QUEUES(VERIFICAR)
+   STATIC_SYSTEM_SEMAPHORES(VERIFICAR)
+   STATIC_SYSTEM_MUTEXES(VERIFICAR)
+   STATIC_SYSTEM_EVENTS(VERIFICAR)
+   STATIC_SYSTEM_TIMERS(VERIFICAR)
+   if (faltantes > 0) {
+      return faltantes;
+   }
+
+   STATIC_SYSTEM_TASKS(ELIMINAR_TAREA)
+   STATIC_SYSTEM_QUEUES(ELIMINAR_COLA)
+   STATIC_SYSTEM_SEMAPHORES(ELIMINAR_SEMAFORO)
+   STATIC_SYSTEM_MUTEXES(ELIMINAR_SEMAFORO)
+   STATIC_SYSTEM_EVENTS(ELIMINAR_EVENTOS)
+   STATIC_SYSTEM_TIMERS(ELIMINAR_TEMPORIZADOR)
+
+   /* La tarea de servicio procesa la eliminación de los temporizadores antes
+      de que su memoria se vuelva a usar */
+   vTaskDelay(1);
+   return 0;
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado) {
+   char linea[112];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void BootCountMalloc(void) {
+   pedidos++;
+}
+
+void Trabajo(void * parametros) {
+   while (1) {
+      vTaskSuspend(NULL);
+   }
+}
+
+void Temporizador(TimerHandle_t temporizador) {
+}
+
+void Control(void * parametros) {
+   char linea[160];
+   uint32_t inicio, fin;
+   uint32_t anterior;
+   uint32_t indice;
+   size_t libres = 0;
+   size_t ocupados = 0;
+   uint32_t pedidos_dinamico = 0;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < 1000; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-boot platform=%s cpu_hz=%lu counter_hz=%lu "
+      "heap=%d samples=%d overhead=%lu boot_allocations=%lu\r\n", PLATAFORMA,
+      (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(), FREERTOS_HEAP_TYPE,
+      BENCH_SAMPLES, (unsigned long) sobrecarga, (unsigned long) pedidos);
+   Enviar(linea);
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   memset(resultados, 0, sizeof(resultados));
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      anterior = pedidos;
+      inicio = Read_Cycles();
+      StaticSystemCreate();
+      fin = Read_Cycles();
+      Acumular(&resultados[0], fin - inicio);
+      resultados[0].errores += pedidos - anterior;
+      resultados[0].errores += Eliminar();
+
+      anterior = pedidos;
+      libres = xPortGetFreeHeapSize();
+      inicio = Read_Cycles();
+      CrearDinamico();
+      fin = Read_Cycles();
+      Acumular(&resultados[1], fin - inicio);
+      pedidos_dinamico = pedidos - anterior;
+      if (libres > xPortGetFreeHeapSize()) {
+         ocupados = libres - xPortGetFreeHeapSize();
+      }
+      resultados[1].errores += Eliminar();
+   }
+   Informar("create_static", STATIC_SYSTEM_OBJECTS, &resultados[0]);
+   Informar("create_dynamic", STATIC_SYSTEM_OBJECTS, &resultados[1]);
+
+   snprintf(linea, sizeof(linea), "# memory objects=%lu static_bytes=%lu heap_bytes=%lu "
+      "heap_allocations=%lu\r\n", (unsigned long) STATIC_SYSTEM_OBJECTS,
+      (unsigned long) STATIC_SYSTEM_RAM, (unsigned long) ocupados,
+      (unsigned long) pedidos_dinamico);
+   Enviar(linea);
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+
+   xTaskCreateStatic(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, control_pila,
+                     &control_tcb);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
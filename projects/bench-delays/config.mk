@@ -0,0 +1,26 @@
+# Compile options
+VERBOSE=y
+OPT=2
+USE_NANO=y
+SEMIHOST=n
+USE_FPU=y
+
+# Libraries
+USE_LPCOPEN=y
+USE_SAPI=n
+USE_FREERTOS=y
+LOAD_INRAM=n
+
+# Delayed task list under test, the values can be overridden from the
+# command line to compare both implementations, for example:
+#   make PROJECT_PATH=projects PROJECT_NAME=bench-delays DELAYED_WHEEL=1
+# Objects are not rebuilt when these values change, run make clean in between
+FREERTOS_HEAP_TYPE ?= 4
+DELAYED_WHEEL ?= 0
+DELAYED_WHEEL_SLOTS ?= 64
+BENCH_SAMPLES ?= 1000
+
+DEFINES += CPU=lpc4337
+DEFINES += configUSE_DELAYED_TASK_WHEEL=$(DELAYED_WHEEL)
+DEFINES += configDELAYED_TASK_WHEEL_SLOTS=$(DELAYED_WHEEL_SLOTS)
+DEFINES += BENCH_SAMPLES=$(BENCH_SAMPLES)
@@ -0,0 +1,366 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones de la lista de tareas demoradas
+ **
+ ** Mide en ciclos del procesador el tiempo que el kernel ocupa en procesar
+ ** cada tick y el costo de bloquear una tarea con vTaskDelayUntil cuando hay
+ ** 1, 10, 30 y 100 tareas periodicas demoradas. Sirve para comparar las
+ ** listas ordenadas del kernel con la rueda de tareas demoradas que se elige
+ ** con DELAYED_WHEEL en config.mk.
+ **
+ ** Las tareas periodicas imitan a las de los proyectos de ejemplo, con
+ ** periodos entre 5 y 1000 ticks. El procesamiento del tick se mide con los
+ ** puntos de traza traceTASK_INCREMENT_TICK y traceTASK_INCREMENT_TICK_EXIT,
+ ** definidos en FreeRTOSConfig.h, durante BENCH_SAMPLES ticks consecutivos,
+ ** por lo que incluye los ticks sin tareas que despertar y el peor caso
+ ** aparece en la columna max. El bloqueo se mide desde que una tarea llama
+ ** a vTaskDelayUntil hasta que se ejecuta una tarea de menor prioridad.
+ **
+ ** La salida tiene el mismo formato que la de bench-kernel:
+ **
+ **     # bench-delays platform=edu-ciaa cpu_hz=204000000 counter_hz=204000000 ...
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     tick,10,1000,95,130,640,637,0
+ **
+ ** El parametro es la cantidad de tareas periodicas. Las pruebas que no
+ ** entran en el heap se informan con una línea de comentario.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "cycles.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         1000   /*!< Ticks medidos en cada prueba */
+#endif
+
+#ifndef FREERTOS_HEAP_TYPE
+#define FREERTOS_HEAP_TYPE    0      /*!< Tipo de heap desconocido */
+#endif
+
+#if FREERTOS_HEAP_TYPE == 1
+#error Las pruebas eliminan las tareas, heap_1 no permite liberar memoria
+#endif
+
+#define PRIORIDAD_BAJA        ( tskIDLE_PRIORITY + 1 )
+#define PRIORIDAD_MEDIA       ( tskIDLE_PRIORITY + 2 )
+#define PRIORIDAD_CONTROL     ( configMAX_PRIORITIES - 1 )
+
+#define PILA_PRUEBA           ( configMINIMAL_STACK_SIZE )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+
+/** @brief Cantidad maxima de tareas periodicas */
+#define TAREAS_MAXIMO         100
+
+/** @brief Ticks que se espera antes de medir, para que todas las tareas esten demoradas */
+#define ESPERA_INICIAL        ( ( TickType_t ) 20 )
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;   /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;     /*!< Menor valor medido */
+   uint32_t maximo;     /*!< Mayor valor medido */
+   uint32_t errores;    /*!< Mediciones en las que falló la verificación */
+   uint64_t total;      /*!< Suma de todas las mediciones */
+} resultado_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Tarea periodica, recibe su periodo en ticks como parametro */
+void Periodica(void * parametros);
+
+/** @brief Mide el tiempo desde que una tarea periodica se bloqueo hasta que esta tarea toma el procesador */
+void Girar(void * parametros);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Genera periodos pseudoaleatorios reproducibles */
+static uint32_t Azar(void);
+
+/** @brief Crea la cantidad pedida de tareas periodicas
+ **
+ ** @returns false si no hay memoria suficiente, en ese caso no deja ninguna tarea creada
+ */
+static bool Crear(uint32_t total);
+
+/** @brief Elimina las tareas periodicas */
+static void Eliminar(void);
+
+/** @brief Envia una fila de la tabla de resultados */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+/** @brief Cantidades de tareas periodicas en cada prueba */
+static const uint8_t CANTIDADES[] = {1, 10, 30, TAREAS_MAXIMO};
+
+/** @brief Periodos de las tareas periodicas, en ticks */
+static const uint16_t PERIODOS[] = {5, 10, 20, 50, 100, 250, 500, 1000};
+
+static TaskHandle_t tareas[TAREAS_MAXIMO];
+static uint32_t cantidad;
+static uint32_t semilla = 1;
+
+static resultado_t resultados[2];
+static uint32_t sobrecarga;
+
+static volatile bool midiendo;
+static volatile bool bloqueando;
+static volatile uint32_t inicio_bloqueo;
+static uint32_t inicio_tick;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+}
+
+static uint32_t Azar(void) {
+   semilla = semilla * 1103515245u + 12345u;
+   return semilla >> 8;
+}
+
+static bool Crear(uint32_t total) {
+   uintptr_t periodo;
+
+   for (cantidad = 0; cantidad < total; cantidad++) {
+      periodo = PERIODOS[Azar() % (sizeof(PERIODOS) / sizeof(PERIODOS[0]))];
+      if (xTaskCreate(Periodica, "Periodica", PILA_PRUEBA, (void *) periodo, PRIORIDAD_MEDIA,
+                      &tareas[cantidad]) != pdPASS) {
+         Eliminar();
+         return false;
+      }
+   }
+   return true;
+}
+
+static void Eliminar(void) {
+   while (cantidad > 0) {
+      cantidad--;
+      vTaskDelete(tareas[cantidad]);
+   }
+   /* La tarea inactiva libera la memoria de las tareas eliminadas */
+   vTaskDelay(ESPERA_INICIAL);
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado) {
+   char linea[96];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void BenchTickEnter(void) {
+   inicio_tick = Read_Cycles();
+}
+
+void BenchTickExit(void) {
+   if (midiendo) {
+      Acumular(&resultados[0], Read_Cycles() - inicio_tick);
+      if (resultados[0].muestras >= BENCH_SAMPLES) {
+         midiendo = false;
+      }
+   }
+}
+
+void Periodica(void * parametros) {
+   const TickType_t periodo = (TickType_t) (uintptr_t) parametros;
+   TickType_t ultimo = xTaskGetTickCount();
+
+   while (1) {
+      inicio_bloqueo = Read_Cycles();
+      bloqueando = true;
+      vTaskDelayUntil(&ultimo, periodo);
+      /* vTaskDelayUntil devuelve el tick en el que debia despertar */
+      if (midiendo && (xTaskGetTickCount() != ultimo)) {
+         resultados[1].errores++;
+      }
+   }
+}
+
+void Girar(void * parametros) {
+   while (1) {
+      if (bloqueando) {
+         bloqueando = false;
+         if (midiendo) {
+            Acumular(&resultados[1], Read_Cycles() - inicio_bloqueo);
+         }
+      }
+   }
+}
+
+void Control(void * parametros) {
+   char linea[160];
+   uint32_t anterior;
+   uint32_t indice;
+   TaskHandle_t tarea;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-delays platform=%s cpu_hz=%lu counter_hz=%lu "
+      "tick_hz=%lu heap=%d delayed_wheel=%d wheel_slots=%d samples=%d overhead=%lu\r\n",
+      PLATAFORMA, (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(),
+      (unsigned long) configTICK_RATE_HZ, FREERTOS_HEAP_TYPE, configUSE_DELAYED_TASK_WHEEL,
+      configDELAYED_TASK_WHEEL_SLOTS, BENCH_SAMPLES, (unsigned long) sobrecarga);
+   Enviar(linea);
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   xTaskCreate(Girar, "Girar", PILA_PRUEBA, NULL, PRIORIDAD_BAJA, &tarea);
+   configASSERT(tarea != NULL);
+
+   for (indice = 0; indice < sizeof(CANTIDADES); indice++) {
+      if (!Crear(CANTIDADES[indice])) {
+         snprintf(linea, sizeof(linea), "# tasks=%u skipped, heap too small\r\n", CANTIDADES[indice]);
+         Enviar(linea);
+         continue;
+      }
+      vTaskDelay(ESPERA_INICIAL);
+
+      /* La tarea de control tambien queda demorada mientras espera, igual
+       * con cualquier cantidad de tareas */
+      memset(resultados, 0, sizeof(resultados));
+      midiendo = true;
+      while (midiendo) {
+         vTaskDelay(1);
+      }
+      Informar("tick", cantidad, &resultados[0]);
+      Informar("delay_block", cantidad, &resultados[1]);
+
+      Eliminar();
+   }
+   vTaskDelete(tarea);
+
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+
+   xTaskCreate(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, NULL);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
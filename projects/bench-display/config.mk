@@ -0,0 +1,23 @@
+# Compile options
+VERBOSE=y
+OPT=2
+USE_NANO=y
+SEMIHOST=n
+USE_FPU=y
+
+# Libraries
+USE_LPCOPEN=y
+USE_SAPI=n
+USE_FREERTOS=y
+LOAD_INRAM=n
+
+# heap_5 takes the free space of every RAM bank from the linker script and
+# places each buffer in the bank class requested, the values can be
+# overridden from the command line, for example:
+#   make PROJECT_PATH=projects PROJECT_NAME=bench-display BENCH_SAMPLES=400
+# Objects are not rebuilt when these values change, run make clean in between
+FREERTOS_HEAP_TYPE ?= 5
+BENCH_SAMPLES ?= 200
+
+DEFINES += CPU=lpc4337
+DEFINES += BENCH_SAMPLES=$(BENCH_SAMPLES)
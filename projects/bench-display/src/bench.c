@@ -0,0 +1,398 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones de la ubicación de los buffers de DMA de la pantalla
+ **
+ ** Envia bandas de pixeles al ILI9341 por SPI con DMA desde un buffer
+ ** asignado con HeapRegionsAlloc en la RAM local o en la RAM AHB, y mide en
+ ** ciclos del procesador la duración de cada banda. Mientras el DMA lee el
+ ** buffer la tarea trabaja sobre su pila, que heap_5 ubica en la RAM local,
+ ** contando las vueltas de un lazo que lee y escribe un arreglo en la pila.
+ **
+ ** Con el buffer en la RAM local el DMA y el procesador compiten por el
+ ** mismo banco en la matriz de buses, con el buffer en la RAM AHB cada uno
+ ** usa su banco. La diferencia se observa en la cantidad de vueltas del lazo
+ ** por banda mas que en la duración de la banda, que depende sobre todo de
+ ** la frecuencia del SPI. En PLATFORM=host la transferencia es inmediata y
+ ** no hay matriz de buses, por lo que solo se verifica la ubicación de los
+ ** buffers y el funcionamiento del programa. Ademas las tareas corren en
+ ** hilos con su propia pila, que no pertenece a ningún banco.
+ **
+ ** La salida tiene el mismo formato que la de bench-kernel:
+ **
+ **     # bench-display platform=edu-ciaa cpu_hz=204000000 ... tcb=local stack=local
+ **     # region name=RamLoc40 class=local start=0x10080c40 size=37824
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     dma_band_local,3840,200,124410,124562,125020,610598,0
+ **     # throughput test=dma_band_local param=3840 bytes_per_s=6282000 cpu_loops=4210
+ **
+ ** El parametro es el tamaño de cada banda en bytes. Cuentan como errores
+ ** los buffers que no se pudieron asignar en la clase pedida.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "heap_regions.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "gpio.h"
+#include "spi.h"
+#include "ili9341.h"
+#include "cycles.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         200    /*!< Bandas enviadas en cada prueba */
+#endif
+
+#ifndef FREERTOS_HEAP_TYPE
+#define FREERTOS_HEAP_TYPE    0      /*!< Tipo de heap desconocido */
+#endif
+
+#if FREERTOS_HEAP_TYPE != 5
+#error La ubicación de los buffers por banco de RAM necesita heap_5
+#endif
+
+#define PRIORIDAD_CONTROL     ( configMAX_PRIORITIES - 1 )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+
+/** @brief Terminales del ILI9341 */
+#define LCD_CS                GPIO_0
+#define LCD_DC                GPIO_6
+#define LCD_RST               GPIO_7
+
+/** @brief Dimensiones de la pantalla */
+#define ANCHO                 240
+#define ALTO                  320
+
+/** @brief Lineas de cada banda, el DMA transfiere hasta 4095 bytes por vez */
+#define LINEAS_BANDA          8
+
+/** @brief Tamaño de cada banda en bytes, con pixeles de 16 bits */
+#define BYTES_BANDA           ( ANCHO * LINEAS_BANDA * 2 )
+
+/** @brief Comandos del ILI9341 */
+#define LCD_COLUMNAS          0x2A
+#define LCD_FILAS             0x2B
+#define LCD_ESCRIBIR          0x2C
+
+/** @brief Palabras del arreglo que recorre el lazo mientras trabaja el DMA */
+#define PALABRAS_LAZO         16
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;            /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;              /*!< Menor valor medido */
+   uint32_t maximo;              /*!< Mayor valor medido */
+   uint32_t errores;             /*!< Mediciones en las que falló la verificación */
+   uint64_t total;               /*!< Suma de todas las mediciones */
+} resultado_t;
+
+/** @brief Prueba con el buffer de pixeles en una clase de ubicación */
+typedef struct prueba_s {
+   const char * nombre;          /*!< Nombre de la prueba en la tabla de resultados */
+   HeapClass_t clase;            /*!< Clase de ubicación del buffer */
+} prueba_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Envia un comando al ILI9341 y espera que termine la transferencia */
+static void Comando(uint8_t comando, uint8_t * parametros, uint32_t cantidad);
+
+/** @brief Selecciona la pantalla completa como ventana e inicia la escritura de pixeles */
+static void Ventana(void);
+
+/** @brief Envia las bandas de una prueba desde un buffer de la clase indicada */
+static void Medir(const prueba_t * prueba);
+
+/** @brief Envia una fila de la tabla de resultados y el caudal obtenido */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado,
+                     uint32_t vueltas);
+
+/** @brief Envia los bancos de RAM que forman el heap */
+static void InformarRegiones(void);
+
+/** @brief Nombre de una clase de ubicación */
+static const char * NombreClase(HeapClass_t clase);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+/** @brief Pruebas, una por cada clase de ubicación del buffer */
+static const prueba_t PRUEBAS[] = {
+   {"dma_band_local", HEAP_CLASS_LOCAL},
+   {"dma_band_ahb", HEAP_CLASS_AHB},
+};
+
+static resultado_t resultado;
+static uint32_t sobrecarga;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+}
+
+static void Comando(uint8_t comando, uint8_t * parametros, uint32_t cantidad) {
+   /* El comando y sus parametros deben quedar en la pila mientras el DMA los lee */
+   GPIOSetLow(LCD_DC);
+   SpiWrite(SPI_1, &comando, 1);
+   while (!SpiFree(SPI_1)) {
+   }
+   GPIOSetHigh(LCD_DC);
+   if (cantidad > 0) {
+      SpiWrite(SPI_1, parametros, cantidad);
+      while (!SpiFree(SPI_1)) {
+      }
+   }
+}
+
+static void Ventana(void) {
+   uint8_t columnas[] = {0, 0, (ANCHO - 1) >> 8, (ANCHO - 1) & 0xFF};
+   uint8_t filas[] = {0, 0, (ALTO - 1) >> 8, (ALTO - 1) & 0xFF};
+
+   Comando(LCD_COLUMNAS, columnas, sizeof(columnas));
+   Comando(LCD_FILAS, filas, sizeof(filas));
+   Comando(LCD_ESCRIBIR, NULL, 0);
+}
+
+static void Medir(const prueba_t * prueba) {
+   volatile uint32_t pila[PALABRAS_LAZO];
+   uint32_t inicio, fin, muestra;
+   uint32_t vueltas = 0;
+   uint16_t * pixeles;
+   uint32_t indice;
+
+   memset(&resultado, 0, sizeof(resultado));
+   memset((void *) pila, 0, sizeof(pila));
+
+   pixeles = HeapRegionsAlloc(prueba->clase, BYTES_BANDA);
+   if ((pixeles == NULL) || (HeapRegionsClassOf(pixeles) != prueba->clase)) {
+      resultado.errores++;
+      Informar(prueba->nombre, BYTES_BANDA, &resultado, 0);
+      vPortFree(pixeles);
+      return;
+   }
+
+   /* Franjas de colores que se desplazan en cada pantalla */
+   for (indice = 0; indice < BYTES_BANDA / 2; indice++) {
+      pixeles[indice] = (uint16_t) (0x1F << (((indice / ANCHO) % 3) * 5 + 1));
+   }
+
+   /* El driver del ILI9341 selecciona la pantalla solo durante cada dibujo,
+      las transferencias directas de la prueba la seleccionan aca */
+   GPIOSetLow(LCD_CS);
+   for (muestra = 0; muestra < BENCH_SAMPLES; muestra++) {
+      if (muestra % (ALTO / LINEAS_BANDA) == 0) {
+         Ventana();
+      }
+
+      inicio = Read_Cycles();
+      SpiWrite(SPI_1, (uint8_t *) pixeles, BYTES_BANDA);
+      /* El procesador trabaja sobre su pila mientras el DMA lee el buffer */
+      while (!SpiFree(SPI_1)) {
+         pila[vueltas % PALABRAS_LAZO] += pila[(vueltas + 1) % PALABRAS_LAZO] + 1;
+         vueltas++;
+      }
+      fin = Read_Cycles();
+      Acumular(&resultado, fin - inicio);
+   }
+   GPIOSetHigh(LCD_CS);
+
+   vPortFree(pixeles);
+   Informar(prueba->nombre, BYTES_BANDA, &resultado, vueltas / BENCH_SAMPLES);
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado,
+                     uint32_t vueltas) {
+   char linea[112];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+   uint64_t caudal = 0;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+   if (promedio > 0) {
+      caudal = (uint64_t) parametro * Cycles_Frequency() / promedio;
+   }
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+
+   snprintf(linea, sizeof(linea), "# throughput test=%s param=%lu bytes_per_s=%lu cpu_loops=%lu\r\n",
+      prueba, (unsigned long) parametro, (unsigned long) caudal, (unsigned long) vueltas);
+   Enviar(linea);
+}
+
+static void InformarRegiones(void) {
+   char linea[112];
+   HeapRegionInfo_t region;
+   UBaseType_t indice;
+
+   for (indice = 0; HeapRegionsGet(indice, &region); indice++) {
+      snprintf(linea, sizeof(linea), "# region name=%s class=%s start=%p size=%lu\r\n",
+         region.name, NombreClase(region.placement), (void *) region.start,
+         (unsigned long) region.size);
+      Enviar(linea);
+   }
+}
+
+static const char * NombreClase(HeapClass_t clase) {
+   switch (clase) {
+   case HEAP_CLASS_LOCAL:
+      return "local";
+   case HEAP_CLASS_AHB:
+      return "ahb";
+   default:
+      return "none";
+   }
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void Control(void * parametros) {
+   char linea[160];
+   uint32_t anterior;
+   uint32_t indice;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < 1000; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-display platform=%s cpu_hz=%lu counter_hz=%lu "
+      "heap=%d samples=%d overhead=%lu tcb=%s stack=%s\r\n", PLATAFORMA,
+      (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(), FREERTOS_HEAP_TYPE,
+      BENCH_SAMPLES, (unsigned long) sobrecarga,
+      NombreClase(HeapRegionsClassOf(xTaskGetCurrentTaskHandle())),
+      NombreClase(HeapRegionsClassOf(&anterior)));
+   Enviar(linea);
+   InformarRegiones();
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   ILI9341Init(SPI_1, LCD_CS, LCD_DC, LCD_RST);
+   for (indice = 0; indice < sizeof(PRUEBAS) / sizeof(PRUEBAS[0]); indice++) {
+      Medir(&PRUEBAS[indice]);
+   }
+
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+
+   /* La pila y el TCB se piden a heap_5, que los ubica en la RAM local */
+   xTaskCreate(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, NULL);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,511 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones del gestor de memoria dinámica
+ **
+ ** Mide en ciclos del procesador la duración de pvPortMalloc y vPortFree con
+ ** una carga aleatoria reproducible, para comparar los gestores de memoria
+ ** de FreeRTOS que se eligen con FREERTOS_HEAP_TYPE en config.mk. En cada
+ ** paso se elige al azar una de RANURAS posiciones: si esta vacia se pide un
+ ** bloque de tamaño aleatorio y si esta ocupada se libera, de forma que la
+ ** mitad de las posiciones quedan ocupadas y el heap se fragmenta con el uso.
+ **
+ ** Cada bloque se llena con un patron que se verifica antes de liberarlo, y
+ ** cuentan como errores los pedidos que fallan, los bloques desalineados y
+ ** los patrones dañados. Ademas de la fila con el minimo, el promedio y el
+ ** maximo se informan los percentiles de cada medición, obtenidos de un
+ ** histograma con cuatro divisiones por cada potencia de dos, y el estado
+ ** del heap al terminar cada prueba, que con heap_6 incluye el bloque libre
+ ** mas grande, la fragmentación y la cantidad de pedidos atendidos.
+ **
+ ** La misma carga se repite con tres conjuntos de bloques de mem_pool, de
+ ** 32, 256 y 1024 bytes, usados como clases de tamaño, con sus bloques en
+ ** los bancos RamAHB16 y RamAHB32. Los pedidos que no encuentran un bloque
+ ** libre en su clase ni en las mayores cuentan como errores.
+ **
+ ** La salida tiene el mismo formato que la de bench-kernel:
+ **
+ **     # bench-heap platform=edu-ciaa cpu_hz=204000000 counter_hz=204000000 ...
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     malloc,256,10012,180,260,610,1274,0
+ **     # percentiles test=malloc param=256 p50=255 p90=319 p99=447 p999=575
+ **
+ ** El parametro es el tamaño maximo de los bloques pedidos, en bytes.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mem_pool.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "cycles.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         20000  /*!< Pasos de la carga aleatoria en cada prueba */
+#endif
+
+#ifndef FREERTOS_HEAP_TYPE
+#define FREERTOS_HEAP_TYPE    0      /*!< Tipo de heap desconocido */
+#endif
+
+#if FREERTOS_HEAP_TYPE == 1
+#error Las pruebas liberan memoria, heap_1 no lo permite
+#elif FREERTOS_HEAP_TYPE == 3
+#error heap_3 usa la biblioteca de C y no tiene un heap propio que medir
+#endif
+
+#define PRIORIDAD_CONTROL     ( configMAX_PRIORITIES - 1 )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+
+/** @brief Posiciones de la carga aleatoria, en promedio la mitad estan ocupadas */
+#define RANURAS               64
+
+/** @brief Tamaño minimo de los bloques pedidos */
+#define TAMANIO_MINIMO        8
+
+/** @brief Tamaños de bloque y cantidad de bloques de las clases de tamaño */
+#define CLASE_CHICA           32
+#define BLOQUES_CHICA         64
+#define CLASE_MEDIANA         256
+#define BLOQUES_MEDIANA       48
+#define CLASE_GRANDE          1024
+#define BLOQUES_GRANDE        28
+
+/** @brief Cantidad de clases de tamaño */
+#define CLASES                3
+
+/** @brief Cubetas del histograma, cuatro por cada potencia de dos de 32 bits */
+#define CUBETAS               128
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;            /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;              /*!< Menor valor medido */
+   uint32_t maximo;              /*!< Mayor valor medido */
+   uint32_t errores;             /*!< Mediciones en las que falló la verificación */
+   uint64_t total;               /*!< Suma de todas las mediciones */
+   uint32_t cubetas[CUBETAS];    /*!< Histograma de las mediciones */
+} resultado_t;
+
+/** @brief Bloque pedido en una de las posiciones de la carga aleatoria */
+typedef struct bloque_s {
+   uint8_t * puntero;            /*!< Memoria asignada, NULL si la posición esta libre */
+   uint16_t tamanio;             /*!< Tamaño pedido */
+   uint8_t patron;               /*!< Valor con el que se lleno el bloque */
+} bloque_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Cubeta del histograma que corresponde a una medición */
+static uint32_t Cubeta(uint32_t cuentas);
+
+/** @brief Mayor valor que se acumula en una cubeta del histograma */
+static uint32_t LimiteCubeta(uint32_t cubeta);
+
+/** @brief Valor por debajo del cual estan las milesimas pedidas de las mediciones */
+static uint32_t Percentil(const resultado_t * resultado, uint32_t milesimas);
+
+/** @brief Genera tamaños y posiciones pseudoaleatorios reproducibles */
+static uint32_t Azar(void);
+
+/** @brief Pide un bloque para una posición y lo llena con un patron */
+static void Pedir(bloque_t * bloque, uint32_t maximo);
+
+/** @brief Verifica el patron de un bloque y lo libera */
+static void Liberar(bloque_t * bloque);
+
+/** @brief Ejecuta la carga aleatoria con bloques de hasta el tamaño indicado */
+static void Cargar(uint32_t maximo);
+
+/** @brief Envia una fila de la tabla de resultados y los percentiles */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado);
+
+/** @brief Envia el estado del heap al terminar una prueba */
+static void InformarHeap(uint32_t parametro);
+
+/** @brief Envia el uso de las clases de tamaño al terminar una prueba */
+static void InformarClases(uint32_t parametro);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+/** @brief Tamaños maximos de los bloques pedidos en cada prueba */
+static const uint16_t MAXIMOS[] = {32, 256, 1024};
+
+#if FREERTOS_HEAP_TYPE == 5
+/** @brief Memoria entregada a heap_5 como una única región */
+static uint8_t region[configTOTAL_HEAP_SIZE];
+
+/** @brief Regiones de heap_5, terminadas con una región vacia */
+static const HeapRegion_t REGIONES[] = {
+   {region, sizeof(region)},
+   {NULL, 0},
+};
+#endif
+
+/** @brief Memoria de las clases de tamaño en los bancos de RAM que no usa el heap */
+MEM_POOL_BUFFER(memoria_chica, BLOQUES_CHICA, CLASE_CHICA, RamAHB16);
+MEM_POOL_BUFFER(memoria_mediana, BLOQUES_MEDIANA, CLASE_MEDIANA, RamAHB16);
+MEM_POOL_BUFFER(memoria_grande, BLOQUES_GRANDE, CLASE_GRANDE, RamAHB32);
+
+/** @brief Clases de tamaño, de menor a mayor */
+static MemPoolHandle_t clases[CLASES];
+
+/** @brief Los pedidos se atienden con las clases de tamaño en lugar del heap */
+static bool usar_clases;
+
+static bloque_t bloques[RANURAS];
+static uint32_t semilla = 1;
+
+static resultado_t resultados[2];
+static uint32_t sobrecarga;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+   resultado->cubetas[Cubeta(cuentas)]++;
+}
+
+static uint32_t Cubeta(uint32_t cuentas) {
+   uint32_t bit;
+
+   if (cuentas < 4) {
+      return cuentas;
+   }
+   bit = 31 - __builtin_clz(cuentas);
+   return 4 * (bit - 1) + ((cuentas >> (bit - 2)) & 3);
+}
+
+static uint32_t LimiteCubeta(uint32_t cubeta) {
+   uint32_t bit;
+
+   if (cubeta < 4) {
+      return cubeta;
+   }
+   bit = cubeta / 4 + 1;
+   return ((4 + (cubeta % 4) + 1) << (bit - 2)) - 1;
+}
+
+static uint32_t Percentil(const resultado_t * resultado, uint32_t milesimas) {
+   uint32_t objetivo = (uint32_t) (((uint64_t) resultado->muestras * milesimas + 999) / 1000);
+   uint32_t acumulado = 0;
+   uint32_t cubeta;
+
+   for (cubeta = 0; cubeta < CUBETAS; cubeta++) {
+      acumulado += resultado->cubetas[cubeta];
+      if ((acumulado > 0) && (acumulado >= objetivo)) {
+         break;
+      }
+   }
+   if (cubeta == CUBETAS) {
+      return 0;
+   }
+   /* El limite de la cubeta puede superar al maximo medido */
+   return (LimiteCubeta(cubeta) < resultado->maximo) ? LimiteCubeta(cubeta) : resultado->maximo;
+}
+
+static uint32_t Azar(void) {
+   semilla = semilla * 1103515245u + 12345u;
+   return semilla >> 8;
+}
+
+static void Pedir(bloque_t * bloque, uint32_t maximo) {
+   uint32_t inicio, fin;
+   uint16_t tamanio = TAMANIO_MINIMO + Azar() % (maximo - TAMANIO_MINIMO + 1);
+   uint8_t * puntero;
+
+   inicio = Read_Cycles();
+   if (usar_clases) {
+      puntero = MemPoolClassAlloc(clases, CLASES, tamanio, 0);
+   } else {
+      puntero = pvPortMalloc(tamanio);
+   }
+   fin = Read_Cycles();
+   Acumular(&resultados[0], fin - inicio);
+
+   if ((puntero == NULL) || (((uintptr_t) puntero & portBYTE_ALIGNMENT_MASK) != 0)) {
+      resultados[0].errores++;
+      return;
+   }
+   bloque->puntero = puntero;
+   bloque->tamanio = tamanio;
+   bloque->patron = (uint8_t) Azar();
+   memset(puntero, bloque->patron, tamanio);
+}
+
+static void Liberar(bloque_t * bloque) {
+   uint32_t inicio, fin;
+   uint16_t indice;
+
+   for (indice = 0; indice < bloque->tamanio; indice++) {
+      if (bloque->puntero[indice] != bloque->patron) {
+         resultados[1].errores++;
+         break;
+      }
+   }
+
+   inicio = Read_Cycles();
+   if (usar_clases) {
+      MemPoolClassFree(clases, CLASES, bloque->puntero);
+   } else {
+      vPortFree(bloque->puntero);
+   }
+   fin = Read_Cycles();
+   Acumular(&resultados[1], fin - inicio);
+
+   bloque->puntero = NULL;
+}
+
+static void Cargar(uint32_t maximo) {
+   uint32_t muestra;
+   bloque_t * bloque;
+
+   memset(resultados, 0, sizeof(resultados));
+   for (muestra = 0; muestra < BENCH_SAMPLES; muestra++) {
+      bloque = &bloques[Azar() % RANURAS];
+      if (bloque->puntero == NULL) {
+         Pedir(bloque, maximo);
+      } else {
+         Liberar(bloque);
+      }
+   }
+   if (usar_clases) {
+      InformarClases(maximo);
+   } else {
+      InformarHeap(maximo);
+   }
+
+   /* Las pruebas siguientes empiezan con todos los bloques libres */
+   for (muestra = 0; muestra < RANURAS; muestra++) {
+      if (bloques[muestra].puntero != NULL) {
+         Liberar(&bloques[muestra]);
+      }
+   }
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado) {
+   char linea[112];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+
+   snprintf(linea, sizeof(linea), "# percentiles test=%s param=%lu p50=%lu p90=%lu p99=%lu p999=%lu\r\n",
+      prueba, (unsigned long) parametro, (unsigned long) Percentil(resultado, 500),
+      (unsigned long) Percentil(resultado, 900), (unsigned long) Percentil(resultado, 990),
+      (unsigned long) Percentil(resultado, 999));
+   Enviar(linea);
+}
+
+static void InformarHeap(uint32_t parametro) {
+   char linea[160];
+
+#if FREERTOS_HEAP_TYPE == 6
+   HeapStats_t estado;
+
+   vPortGetHeapStats(&estado);
+   snprintf(linea, sizeof(linea), "# heap param=%lu free=%lu largest=%lu free_blocks=%lu "
+      "fragmentation_permille=%lu allocations=%lu frees=%lu\r\n", (unsigned long) parametro,
+      (unsigned long) estado.xAvailableHeapSpaceInBytes,
+      (unsigned long) estado.xSizeOfLargestFreeBlockInBytes,
+      (unsigned long) estado.xNumberOfFreeBlocks, (unsigned long) estado.xFragmentationPerMille,
+      (unsigned long) estado.xNumberOfSuccessfulAllocations,
+      (unsigned long) estado.xNumberOfSuccessfulFrees);
+#else
+   snprintf(linea, sizeof(linea), "# heap param=%lu free=%lu\r\n", (unsigned long) parametro,
+      (unsigned long) xPortGetFreeHeapSize());
+#endif
+   Enviar(linea);
+}
+
+static void InformarClases(uint32_t parametro) {
+   char linea[160];
+   MemPoolStats_t estado;
+   uint32_t indice;
+
+   for (indice = 0; indice < CLASES; indice++) {
+      MemPoolGetStats(clases[indice], &estado);
+      snprintf(linea, sizeof(linea), "# pool param=%lu size=%lu count=%lu used=%lu high_water=%lu "
+         "allocations=%lu failures=%lu\r\n", (unsigned long) parametro, (unsigned long) estado.size,
+         (unsigned long) estado.count, (unsigned long) estado.used,
+         (unsigned long) estado.high_water, (unsigned long) estado.allocations,
+         (unsigned long) estado.failures);
+      Enviar(linea);
+   }
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void Control(void * parametros) {
+   char linea[160];
+   uint32_t anterior;
+   uint32_t indice;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < 1000; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-heap platform=%s cpu_hz=%lu counter_hz=%lu "
+      "heap=%d heap_size=%lu slots=%d samples=%d overhead=%lu\r\n", PLATAFORMA,
+      (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(), FREERTOS_HEAP_TYPE,
+      (unsigned long) configTOTAL_HEAP_SIZE, RANURAS, BENCH_SAMPLES, (unsigned long) sobrecarga);
+   Enviar(linea);
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   for (indice = 0; indice < sizeof(MAXIMOS) / sizeof(MAXIMOS[0]); indice++) {
+      Cargar(MAXIMOS[indice]);
+      Informar("malloc", MAXIMOS[indice], &resultados[0]);
+      Informar("free", MAXIMOS[indice], &resultados[1]);
+   }
+
+   clases[0] = MemPoolCreate(BLOQUES_CHICA, CLASE_CHICA, memoria_chica);
+   clases[1] = MemPoolCreate(BLOQUES_MEDIANA, CLASE_MEDIANA, memoria_mediana);
+   clases[2] = MemPoolCreate(BLOQUES_GRANDE, CLASE_GRANDE, memoria_grande);
+   configASSERT((clases[0] != NULL) && (clases[1] != NULL) && (clases[2] != NULL));
+
+   usar_clases = true;
+   for (indice = 0; indice < sizeof(MAXIMOS) / sizeof(MAXIMOS[0]); indice++) {
+      Cargar(MAXIMOS[indice]);
+      Informar("pool_alloc", MAXIMOS[indice], &resultados[0]);
+      Informar("pool_free", MAXIMOS[indice], &resultados[1]);
+   }
+   usar_clases = false;
+
+   for (indice = 0; indice < CLASES; indice++) {
+      MemPoolDelete(clases[indice]);
+   }
+
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+#if FREERTOS_HEAP_TYPE == 5
+   /* Una región del mismo tamaño que el heap de los otros gestores en lugar de los bancos
+      de RAM que heap_5 toma del enlazador, para que las mediciones sean comparables */
+   vPortDefineHeapRegions(REGIONES);
+#endif
+
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+
+   xTaskCreate(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, NULL);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
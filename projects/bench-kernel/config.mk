@@ -0,0 +1,26 @@
+# Compile options
+VERBOSE=y
+OPT=2
+USE_NANO=y
+SEMIHOST=n
+USE_FPU=y
+
+# Libraries
+USE_LPCOPEN=y
+USE_SAPI=n
+USE_FREERTOS=y
+LOAD_INRAM=n
+
+# Kernel configuration under test, each value can be overridden from the
+# command line to compare configurations, for example:
+#   make PROJECT_PATH=projects PROJECT_NAME=bench-kernel FREERTOS_HEAP_TYPE=2 TICK_RATE_HZ=100
+# Objects are not rebuilt when these values change, run make clean in between
+FREERTOS_HEAP_TYPE ?= 4
+TICK_RATE_HZ ?= 1000
+OPTIMISED_TASK_SELECTION ?= 1
+BENCH_SAMPLES ?= 1000
+
+DEFINES += CPU=lpc4337
+DEFINES += configTICK_RATE_HZ=$(TICK_RATE_HZ)
+DEFINES += configUSE_PORT_OPTIMISED_TASK_SELECTION=$(OPTIMISED_TASK_SELECTION)
+DEFINES += BENCH_SAMPLES=$(BENCH_SAMPLES)
@@ -0,0 +1,848 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones de latencia de los servicios del kernel
+ **
+ ** Mide en ciclos del procesador el costo de los cambios de contexto y de los
+ ** objetos de sincronización de FreeRTOS. Cada prueba crea las tareas que
+ ** necesita, toma BENCH_SAMPLES muestras y al terminar avisa a la tarea de
+ ** control, que elimina las tareas y envía una fila con el resultado por la
+ ** USB-UART.
+ **
+ ** La salida es una tabla CSV precedida por una línea de comentario con la
+ ** configuración del kernel, para poder comparar corridas con distinto tipo de
+ ** heap, frecuencia de tick o método de selección de tareas:
+ **
+ **     # bench-kernel platform=edu-ciaa cpu_hz=204000000 counter_hz=204000000 ...
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     yield,0,1000,160,163,410,799,0
+ **
+ ** Los valores min, avg y max están expresados en cuentas del contador, que
+ ** son ciclos en la EDU-CIAA y nanosegundos en la PC. Ya tienen descontado el
+ ** costo de leer el contador. La columna errors cuenta las muestras en las
+ ** que el kernel no se comportó como se esperaba.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "ref_queue.h"
+#include "us_timer.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "cycles.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         1000   /*!< Muestras tomadas en cada prueba */
+#endif
+
+#ifndef FREERTOS_HEAP_TYPE
+#define FREERTOS_HEAP_TYPE    0      /*!< Tipo de heap desconocido */
+#endif
+
+#if FREERTOS_HEAP_TYPE == 1
+#error Las pruebas eliminan tareas y colas, heap_1 no permite liberar memoria
+#endif
+
+#define PRIORIDAD_BAJA        ( tskIDLE_PRIORITY + 1 )
+#define PRIORIDAD_MEDIA       ( tskIDLE_PRIORITY + 2 )
+#define PRIORIDAD_ALTA        ( tskIDLE_PRIORITY + 3 )
+#define PRIORIDAD_CONTROL     ( configMAX_PRIORITIES - 1 )
+
+#define PILA_PRUEBA           ( configMINIMAL_STACK_SIZE * 2 )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+
+#define TAREAS_PRUEBA         2      /*!< Cantidad maxima de tareas por prueba */
+#define TAMANIO_MAXIMO        64     /*!< Tamaño maximo de los elementos de las colas */
+#define TAMANIO_FLUJO         1024   /*!< Tamaño maximo de los mensajes de las pruebas de flujo */
+#define LARGO_FLUJO           8      /*!< Capacidad de las colas de las pruebas de flujo */
+#define LARGO_RAFAGA          16     /*!< Capacidad de la cola y rafaga maxima de las pruebas por lotes */
+#define EVENTO_PRUEBA         ( 1 << 0 )
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;   /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;     /*!< Menor valor medido */
+   uint32_t maximo;     /*!< Mayor valor medido */
+   uint32_t errores;    /*!< Mediciones en las que falló la verificación */
+   uint64_t total;      /*!< Suma de todas las mediciones */
+} resultado_t;
+
+/** @brief Mensaje de tiempo enviado por cola en tp6-colas y tp7-interrupciones */
+typedef struct tiempo_s {
+   uint8_t decimas;
+   uint8_t segundos;
+   uint8_t minutos;
+} tiempo_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Cede el procesador continuamente a otra tarea de la misma prioridad */
+void Ceder(void * parametros);
+
+/** @brief Mide la duración de dos cambios de contexto con taskYIELD */
+void MedirCeder(void * parametros);
+
+/** @brief Registra el contador sin bloquearse, detecta cuando la otra tarea se bloqueo */
+void Girar(void * parametros);
+
+/** @brief Mide el bloqueo y el despertar de una tarea con vTaskDelay */
+void MedirDemora(void * parametros);
+
+/** @brief Devuelve por la cola de vuelta cada elemento recibido en la cola de ida */
+void Eco(void * parametros);
+
+/** @brief Mide el tiempo de ida y vuelta de un elemento entre dos tareas */
+void MedirCola(void * parametros);
+
+/** @brief Devuelve el semaforo de vuelta cada vez que recibe el semaforo de ida */
+void EcoSemaforo(void * parametros);
+
+/** @brief Mide el tiempo de ida y vuelta de un semaforo entre dos tareas */
+void MedirSemaforo(void * parametros);
+
+/** @brief Toma el mutex y despierta a la tarea de alta prioridad que lo reclama */
+void RetenerMutex(void * parametros);
+
+/** @brief Mide el costo de tomar un mutex retenido por una tarea de menor prioridad */
+void MedirMutex(void * parametros);
+
+/** @brief Registra el contador y activa el evento de prueba */
+void ActivarEvento(void * parametros);
+
+/** @brief Mide el tiempo desde que se activa un evento hasta que despierta la tarea */
+void MedirEvento(void * parametros);
+
+/** @brief Envia mensajes copiandolos en una cola */
+void ProducirCopia(void * parametros);
+
+/** @brief Recibe los mensajes copiados y mide el tiempo desde que se empezo a completarlos */
+void ConsumirCopia(void * parametros);
+
+/** @brief Envia mensajes pasando referencias a bloques de una cola de referencias */
+void ProducirReferencia(void * parametros);
+
+/** @brief Recibe las referencias, usa y libera los bloques y mide el tiempo desde que se obtuvieron */
+void ConsumirReferencia(void * parametros);
+
+/** @brief Envia rafagas de bytes de a uno por vez a la tarea ConsumirUnitario */
+void ProducirUnitario(void * parametros);
+
+/** @brief Recibe de a un byte las rafagas de ProducirUnitario y mide su duración */
+void ConsumirUnitario(void * parametros);
+
+/** @brief Envia rafagas de bytes en un solo lote a la tarea ConsumirLote */
+void ProducirLote(void * parametros);
+
+/** @brief Recibe en lotes las rafagas de ProducirLote y mide su duración */
+void ConsumirLote(void * parametros);
+
+/** @brief Mide cuanto excede UsTimerDelay a la demora pedida mientras otra tarea usa el procesador */
+void MedirDemoraUs(void * parametros);
+
+/** @brief Mide en la interrupción la diferencia entre el intervalo de dos vencimientos y el periodo */
+static void MedirPeriodoUs(UsTimerHandle_t timer, void * context, BaseType_t * woken);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Pone en cero las estadisticas de la prueba */
+static void Iniciar(void);
+
+/** @brief Crea una tarea de la prueba en curso */
+static void Crear(TaskFunction_t tarea, UBaseType_t prioridad);
+
+/** @brief Espera el fin de la prueba en curso y elimina sus tareas */
+static void Esperar(void);
+
+/** @brief Avisa a la tarea de control que termino la prueba y se suspende */
+static void Terminar(void);
+
+/** @brief Envia una fila de la tabla de resultados */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+/** @brief Tamaños de los elementos usados en las pruebas de colas */
+static const uint8_t TAMANIOS[] = {1, 2, 4, 8, 16, 32, 64};
+
+/** @brief Largos de las rafagas usadas en las pruebas de envio por lotes */
+static const uint8_t RAFAGAS[] = {1, 4, 8, LARGO_RAFAGA};
+
+/** @brief Demoras y periodos en microsegundos usados en las pruebas de temporizadores */
+static const uint16_t MICROSEGUNDOS[] = {10, 100, 1000};
+
+/** @brief Tamaños de los mensajes usados en las pruebas de flujo */
+static const uint16_t TAMANIOS_FLUJO[] = {sizeof(tiempo_t), 16, 64, 256, TAMANIO_FLUJO};
+
+static TaskHandle_t control;
+static TaskHandle_t tareas[TAREAS_PRUEBA];
+static TaskHandle_t alta;
+static uint32_t cantidad;
+
+static resultado_t resultados[2];
+static uint32_t sobrecarga;
+
+static volatile uint32_t marca;
+static volatile uint32_t inicio_bloqueo;
+static volatile bool bloqueando;
+
+static QueueHandle_t ida;
+static QueueHandle_t vuelta;
+static SemaphoreHandle_t semaforo_ida;
+static SemaphoreHandle_t semaforo_vuelta;
+static SemaphoreHandle_t mutex;
+static EventGroupHandle_t eventos;
+static size_t tamanio;
+
+static QueueHandle_t flujo;
+static RefQueueHandle_t referencias;
+static uint8_t origen[TAMANIO_FLUJO];
+static uint8_t destino[TAMANIO_FLUJO];
+
+static uint32_t microsegundos;
+static bool vencido;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+}
+
+static void Iniciar(void) {
+   memset(resultados, 0, sizeof(resultados));
+   bloqueando = false;
+   cantidad = 0;
+}
+
+static void Crear(TaskFunction_t tarea, UBaseType_t prioridad) {
+   configASSERT(cantidad < TAREAS_PRUEBA);
+   xTaskCreate(tarea, "Prueba", PILA_PRUEBA, NULL, prioridad, &tareas[cantidad]);
+   configASSERT(tareas[cantidad] != NULL);
+   cantidad++;
+}
+
+static void Esperar(void) {
+   ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+   while (cantidad > 0) {
+      cantidad--;
+      vTaskDelete(tareas[cantidad]);
+   }
+}
+
+static void Terminar(void) {
+   xTaskNotifyGive(control);
+   vTaskSuspend(NULL);
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado) {
+   char linea[96];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void Ceder(void * parametros) {
+   while (1) {
+      taskYIELD();
+   }
+}
+
+void MedirCeder(void * parametros) {
+   uint32_t anterior;
+
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      anterior = Read_Cycles();
+      taskYIELD();
+      Acumular(&resultados[0], (Read_Cycles() - anterior) / 2);
+   }
+   Terminar();
+}
+
+void Girar(void * parametros) {
+   while (1) {
+      if (bloqueando) {
+         bloqueando = false;
+         Acumular(&resultados[0], Read_Cycles() - inicio_bloqueo);
+      }
+      marca = Read_Cycles();
+   }
+}
+
+void MedirDemora(void * parametros) {
+   while (resultados[1].muestras < BENCH_SAMPLES) {
+      bloqueando = true;
+      inicio_bloqueo = Read_Cycles();
+      vTaskDelay(1);
+      Acumular(&resultados[1], Read_Cycles() - marca);
+   }
+   Terminar();
+}
+
+void Eco(void * parametros) {
+   uint8_t elemento[TAMANIO_MAXIMO];
+
+   while (1) {
+      xQueueReceive(ida, elemento, portMAX_DELAY);
+      xQueueSend(vuelta, elemento, portMAX_DELAY);
+   }
+}
+
+void MedirCola(void * parametros) {
+   uint8_t elemento[TAMANIO_MAXIMO];
+   uint32_t anterior;
+   uint32_t indice;
+
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      memset(elemento, resultados[0].muestras, tamanio);
+      anterior = Read_Cycles();
+      xQueueSend(ida, elemento, portMAX_DELAY);
+      xQueueReceive(vuelta, elemento, portMAX_DELAY);
+      Acumular(&resultados[0], Read_Cycles() - anterior);
+      for (indice = 0; indice < tamanio; indice++) {
+         if (elemento[indice] != (uint8_t) (resultados[0].muestras - 1)) {
+            resultados[0].errores++;
+            break;
+         }
+      }
+   }
+   Terminar();
+}
+
+void EcoSemaforo(void * parametros) {
+   while (1) {
+      xSemaphoreTake(semaforo_ida, portMAX_DELAY);
+      xSemaphoreGive(semaforo_vuelta);
+   }
+}
+
+void MedirSemaforo(void * parametros) {
+   uint32_t anterior;
+
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      anterior = Read_Cycles();
+      xSemaphoreGive(semaforo_ida);
+      xSemaphoreTake(semaforo_vuelta, portMAX_DELAY);
+      Acumular(&resultados[0], Read_Cycles() - anterior);
+   }
+   Terminar();
+}
+
+void RetenerMutex(void * parametros) {
+   while (1) {
+      xSemaphoreTake(mutex, portMAX_DELAY);
+      xTaskNotifyGive(alta);
+      /* La tarea de alta prioridad se bloqueo en el mutex y esta tarea debe
+       * heredar su prioridad para poder liberarlo */
+      if (uxTaskPriorityGet(NULL) != PRIORIDAD_ALTA) {
+         resultados[0].errores++;
+      }
+      xSemaphoreGive(mutex);
+   }
+}
+
+void MedirMutex(void * parametros) {
+   uint32_t anterior;
+
+   alta = xTaskGetCurrentTaskHandle();
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      anterior = Read_Cycles();
+      xSemaphoreTake(mutex, portMAX_DELAY);
+      Acumular(&resultados[0], Read_Cycles() - anterior);
+      xSemaphoreGive(mutex);
+   }
+   Terminar();
+}
+
+void ActivarEvento(void * parametros) {
+   while (1) {
+      marca = Read_Cycles();
+      xEventGroupSetBits(eventos, EVENTO_PRUEBA);
+   }
+}
+
+void MedirEvento(void * parametros) {
+   EventBits_t bits;
+
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      bits = xEventGroupWaitBits(eventos, EVENTO_PRUEBA, pdTRUE, pdTRUE, portMAX_DELAY);
+      Acumular(&resultados[0], Read_Cycles() - marca);
+      if ((bits & EVENTO_PRUEBA) == 0) {
+         resultados[0].errores++;
+      }
+   }
+   Terminar();
+}
+
+void ProducirCopia(void * parametros) {
+   uint32_t indice;
+
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      marca = Read_Cycles();
+      memset(origen, indice, tamanio);
+      xQueueSend(flujo, origen, portMAX_DELAY);
+   }
+   vTaskSuspend(NULL);
+}
+
+void ConsumirCopia(void * parametros) {
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      xQueueReceive(flujo, destino, portMAX_DELAY);
+      if (destino[tamanio - 1] != (uint8_t) resultados[0].muestras) {
+         resultados[0].errores++;
+      }
+      Acumular(&resultados[0], Read_Cycles() - marca);
+   }
+   Terminar();
+}
+
+void ProducirReferencia(void * parametros) {
+   uint8_t * bloque;
+   uint32_t indice;
+
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      marca = Read_Cycles();
+      bloque = RefQueueAcquire(referencias, portMAX_DELAY);
+      memset(bloque, indice, tamanio);
+      RefQueueSend(referencias, bloque);
+   }
+   vTaskSuspend(NULL);
+}
+
+void ConsumirReferencia(void * parametros) {
+   uint8_t * bloque;
+
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      bloque = RefQueueReceive(referencias, portMAX_DELAY);
+      if (bloque[tamanio - 1] != (uint8_t) resultados[0].muestras) {
+         resultados[0].errores++;
+      }
+      RefQueueRelease(referencias, bloque);
+      Acumular(&resultados[0], Read_Cycles() - marca);
+   }
+   Terminar();
+}
+
+void ProducirUnitario(void * parametros) {
+   uint32_t indice;
+   uint32_t posicion;
+
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      for (posicion = 0; posicion < tamanio; posicion++) {
+         origen[posicion] = (uint8_t) (indice + posicion);
+      }
+      marca = Read_Cycles();
+      for (posicion = 0; posicion < tamanio; posicion++) {
+         xQueueSend(flujo, &origen[posicion], portMAX_DELAY);
+      }
+   }
+   vTaskSuspend(NULL);
+}
+
+void ConsumirUnitario(void * parametros) {
+   uint32_t posicion;
+
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      for (posicion = 0; posicion < tamanio; posicion++) {
+         xQueueReceive(flujo, &destino[posicion], portMAX_DELAY);
+      }
+      Acumular(&resultados[0], Read_Cycles() - marca);
+      for (posicion = 0; posicion < tamanio; posicion++) {
+         if (destino[posicion] != (uint8_t) (resultados[0].muestras - 1 + posicion)) {
+            resultados[0].errores++;
+         }
+      }
+   }
+   Terminar();
+}
+
+void ProducirLote(void * parametros) {
+   uint32_t indice;
+   uint32_t posicion;
+
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      for (posicion = 0; posicion < tamanio; posicion++) {
+         origen[posicion] = (uint8_t) (indice + posicion);
+      }
+      marca = Read_Cycles();
+      for (posicion = 0; posicion < tamanio;) {
+         posicion += xQueueSendMultiple(flujo, &origen[posicion], tamanio - posicion, portMAX_DELAY);
+      }
+   }
+   vTaskSuspend(NULL);
+}
+
+void ConsumirLote(void * parametros) {
+   uint32_t posicion;
+
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      for (posicion = 0; posicion < tamanio;) {
+         posicion += xQueueReceiveMultiple(flujo, &destino[posicion], tamanio - posicion, portMAX_DELAY);
+      }
+      Acumular(&resultados[0], Read_Cycles() - marca);
+      for (posicion = 0; posicion < tamanio; posicion++) {
+         if (destino[posicion] != (uint8_t) (resultados[0].muestras - 1 + posicion)) {
+            resultados[0].errores++;
+         }
+      }
+   }
+   Terminar();
+}
+
+void MedirDemoraUs(void * parametros) {
+   const uint32_t pedido = microsegundos * (Cycles_Frequency() / 1000000);
+   uint32_t anterior;
+   uint32_t medido;
+
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      anterior = Read_Cycles();
+      UsTimerDelay(microsegundos);
+      medido = Read_Cycles() - anterior;
+      if (medido < pedido) {
+         resultados[0].errores++;
+         medido = pedido;
+      }
+      Acumular(&resultados[0], medido - pedido);
+   }
+   Terminar();
+}
+
+static void MedirPeriodoUs(UsTimerHandle_t timer, void * context, BaseType_t * woken) {
+   const uint32_t periodo = microsegundos * (Cycles_Frequency() / 1000000);
+   uint32_t ahora = Read_Cycles();
+   uint32_t intervalo = ahora - marca;
+
+   if (vencido) {
+      Acumular(&resultados[0], (intervalo > periodo) ? intervalo - periodo : periodo - intervalo);
+   }
+   vencido = true;
+   marca = ahora;
+
+   if (resultados[0].muestras >= BENCH_SAMPLES) {
+      UsTimerStopFromISR(timer);
+      vTaskNotifyGiveFromISR(control, woken);
+   }
+}
+
+void Control(void * parametros) {
+   uint8_t elemento[TAMANIO_MAXIMO];
+   char linea[160];
+   uint32_t anterior;
+   uint32_t indice;
+   QueueHandle_t cola;
+   uint8_t * bloque;
+   UsTimerHandle_t temporizador;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-kernel platform=%s cpu_hz=%lu counter_hz=%lu "
+      "tick_hz=%lu heap=%d optimised_selection=%d samples=%d overhead=%lu\r\n",
+      PLATAFORMA, (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(),
+      (unsigned long) configTICK_RATE_HZ, FREERTOS_HEAP_TYPE,
+      configUSE_PORT_OPTIMISED_TASK_SELECTION, BENCH_SAMPLES, (unsigned long) sobrecarga);
+   Enviar(linea);
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   /* Cambio de contexto entre dos tareas de igual prioridad */
+   Iniciar();
+   Crear(Ceder, PRIORIDAD_MEDIA);
+   Crear(MedirCeder, PRIORIDAD_MEDIA);
+   Esperar();
+   Informar("yield", 0, &resultados[0]);
+
+   /* Bloqueo con vTaskDelay y despertar desde la interrupción del tick */
+   Iniciar();
+   Crear(Girar, PRIORIDAD_BAJA);
+   Crear(MedirDemora, PRIORIDAD_ALTA);
+   Esperar();
+   Informar("delay_block", 1, &resultados[0]);
+   Informar("delay_wake", 1, &resultados[1]);
+
+   /* Envio y recepción en la misma tarea, sin cambios de contexto */
+   for (indice = 0; indice < sizeof(TAMANIOS); indice++) {
+      tamanio = TAMANIOS[indice];
+      cola = xQueueCreate(1, tamanio);
+      Iniciar();
+      while (resultados[0].muestras < BENCH_SAMPLES) {
+         anterior = Read_Cycles();
+         xQueueSend(cola, elemento, 0);
+         xQueueReceive(cola, elemento, 0);
+         Acumular(&resultados[0], Read_Cycles() - anterior);
+      }
+      vQueueDelete(cola);
+      Informar("queue_local", tamanio, &resultados[0]);
+   }
+
+   /* Ida y vuelta de un elemento entre dos tareas */
+   for (indice = 0; indice < sizeof(TAMANIOS); indice++) {
+      tamanio = TAMANIOS[indice];
+      ida = xQueueCreate(1, tamanio);
+      vuelta = xQueueCreate(1, tamanio);
+      Iniciar();
+      Crear(MedirCola, PRIORIDAD_BAJA);
+      Crear(Eco, PRIORIDAD_ALTA);
+      Esperar();
+      vQueueDelete(ida);
+      vQueueDelete(vuelta);
+      Informar("queue_roundtrip", tamanio, &resultados[0]);
+   }
+
+   /* Ida y vuelta de dos semaforos binarios entre dos tareas */
+   semaforo_ida = xSemaphoreCreateBinary();
+   semaforo_vuelta = xSemaphoreCreateBinary();
+   Iniciar();
+   Crear(MedirSemaforo, PRIORIDAD_BAJA);
+   Crear(EcoSemaforo, PRIORIDAD_ALTA);
+   Esperar();
+   vSemaphoreDelete(semaforo_ida);
+   vSemaphoreDelete(semaforo_vuelta);
+   Informar("semaphore_pingpong", 0, &resultados[0]);
+
+   /* Herencia de prioridad: bloqueo en el mutex, ejecución de la tarea que
+    * lo retiene con la prioridad heredada y devolución del mutex */
+   mutex = xSemaphoreCreateMutex();
+   Iniciar();
+   Crear(MedirMutex, PRIORIDAD_ALTA);
+   Crear(RetenerMutex, PRIORIDAD_BAJA);
+   Esperar();
+   vSemaphoreDelete(mutex);
+   Informar("mutex_inherit", 0, &resultados[0]);
+
+   /* Latencia desde xEventGroupSetBits hasta que despierta la tarea que espera */
+   eventos = xEventGroupCreate();
+   Iniciar();
+   Crear(MedirEvento, PRIORIDAD_ALTA);
+   Crear(ActivarEvento, PRIORIDAD_BAJA);
+   Esperar();
+   vEventGroupDelete(eventos);
+   Informar("event_wake", 0, &resultados[0]);
+
+   /* Mensajes copiados en una cola, como los tiempos parciales de
+    * tp7-interrupciones, y pasados por referencia. Primero el costo propio de
+    * cada metodo en una sola tarea, y despues el flujo hacia una tarea de
+    * mayor prioridad, como la tarea Display de tp7-interrupciones */
+   for (indice = 0; indice < sizeof(TAMANIOS_FLUJO) / sizeof(TAMANIOS_FLUJO[0]); indice++) {
+      tamanio = TAMANIOS_FLUJO[indice];
+      flujo = xQueueCreate(LARGO_FLUJO, tamanio);
+      referencias = RefQueueCreate(LARGO_FLUJO, tamanio);
+      configASSERT((flujo != NULL) && (referencias != NULL));
+
+      Iniciar();
+      while (resultados[0].muestras < BENCH_SAMPLES) {
+         anterior = Read_Cycles();
+         memset(origen, resultados[0].muestras, tamanio);
+         xQueueSend(flujo, origen, 0);
+         xQueueReceive(flujo, destino, 0);
+         Acumular(&resultados[0], Read_Cycles() - anterior);
+      }
+      Informar("queue_copy_local", tamanio, &resultados[0]);
+
+      Iniciar();
+      while (resultados[0].muestras < BENCH_SAMPLES) {
+         anterior = Read_Cycles();
+         bloque = RefQueueAcquire(referencias, 0);
+         memset(bloque, resultados[0].muestras, tamanio);
+         RefQueueSend(referencias, bloque);
+         bloque = RefQueueReceive(referencias, 0);
+         RefQueueRelease(referencias, bloque);
+         Acumular(&resultados[0], Read_Cycles() - anterior);
+      }
+      Informar("refqueue_local", tamanio, &resultados[0]);
+
+      Iniciar();
+      Crear(ProducirCopia, PRIORIDAD_BAJA);
+      Crear(ConsumirCopia, PRIORIDAD_ALTA);
+      Esperar();
+      Informar("queue_copy_stream", tamanio, &resultados[0]);
+
+      Iniciar();
+      Crear(ProducirReferencia, PRIORIDAD_BAJA);
+      Crear(ConsumirReferencia, PRIORIDAD_ALTA);
+      Esperar();
+      Informar("refqueue_stream", tamanio, &resultados[0]);
+
+      vQueueDelete(flujo);
+      RefQueueDelete(referencias);
+   }
+
+   /* Rafagas de bytes hacia una tarea de mayor prioridad, como los datos
+    * recibidos por una UART, enviadas de a uno o en un solo lote. El lote
+    * copia todos los bytes en una sección critica y despierta una sola vez
+    * a la tarea que recibe */
+   for (indice = 0; indice < sizeof(RAFAGAS); indice++) {
+      tamanio = RAFAGAS[indice];
+      flujo = xQueueCreate(LARGO_RAFAGA, sizeof(uint8_t));
+      configASSERT(flujo != NULL);
+
+      Iniciar();
+      Crear(ProducirUnitario, PRIORIDAD_BAJA);
+      Crear(ConsumirUnitario, PRIORIDAD_ALTA);
+      Esperar();
+      Informar("queue_burst_single", tamanio, &resultados[0]);
+
+      Iniciar();
+      Crear(ProducirLote, PRIORIDAD_BAJA);
+      Crear(ConsumirLote, PRIORIDAD_ALTA);
+      Esperar();
+      Informar("queue_burst_multiple", tamanio, &resultados[0]);
+
+      vQueueDelete(flujo);
+   }
+
+   /* Demoras de microsegundos que ceden el procesador a una tarea de menor
+    * prioridad, y vencimientos de un temporizador periodico atendidos en la
+    * interrupción del contador. La columna errors cuenta las demoras mas
+    * cortas que lo pedido y los periodos perdidos */
+   for (indice = 0; indice < sizeof(MICROSEGUNDOS) / sizeof(MICROSEGUNDOS[0]); indice++) {
+      microsegundos = MICROSEGUNDOS[indice];
+
+      Iniciar();
+      Crear(Girar, PRIORIDAD_BAJA);
+      Crear(MedirDemoraUs, PRIORIDAD_ALTA);
+      Esperar();
+      Informar("us_delay_late", microsegundos, &resultados[0]);
+
+      temporizador = UsTimerCreate(MedirPeriodoUs, NULL, US_TIMER_ISR);
+      configASSERT(temporizador != NULL);
+      Iniciar();
+      vencido = false;
+      UsTimerStart(temporizador, microsegundos, microsegundos);
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      resultados[0].errores = UsTimerMissed(temporizador);
+      UsTimerDelete(temporizador);
+      Informar("us_periodic_jitter", microsegundos, &resultados[0]);
+   }
+
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+   UsTimerInit();
+
+   xTaskCreate(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, &control);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,42 @@
+# Compile options
+VERBOSE=y
+OPT=2
+USE_NANO=y
+SEMIHOST=n
+USE_FPU=y
+
+# Libraries
+USE_LPCOPEN=y
+USE_SAPI=n
+USE_FREERTOS=y
+LOAD_INRAM=n
+
+# Repetitions of each drawing, bytes of the glyph cache, bytes of the two
+# bands of the display server and of each band of the driver, SPI mode of the
+# ILI9341 driver, 1 streams every drawing through a single session and 0
+# configures the port again for every command, rasterizer mode, 1 sends
+# lines and circles as runs of pixels and 0 pixel by pixel, pixel frames, 1
+# sends the pixels in 16 bits SPI frames and 0 in 8 bits frames, and SCK
+# frequency, by default the highest of the SSP, 204 MHz / 2. The values can be
+# overridden from the command line, e.g.:
+#   make PROJECT_PATH=projects PROJECT_NAME=bench-lcd LCD_SPI_SESSION=0
+# Objects are not rebuilt when these values change, run make clean in between
+FREERTOS_HEAP_TYPE ?= 4
+BENCH_SAMPLES ?= 20
+GLYPH_CACHE_SIZE ?= 20480
+BAND_MEMORY ?= 8192
+LCD_BAND_SIZE ?= 7680
+LCD_SPI_SESSION ?= 1
+LCD_SPANS ?= 1
+LCD_SPI_16BIT ?= 1
+LCD_SPI_BITRATE ?= 102000000
+
+DEFINES += CPU=lpc4337
+DEFINES += BENCH_SAMPLES=$(BENCH_SAMPLES)
+DEFINES += GLYPH_CACHE_SIZE=$(GLYPH_CACHE_SIZE)
+DEFINES += BAND_MEMORY=$(BAND_MEMORY)
+DEFINES += LCD_BAND_SIZE=$(LCD_BAND_SIZE)
+DEFINES += ILI9341_SPI_SESSION=$(LCD_SPI_SESSION)
+DEFINES += ILI9341_SPANS=$(LCD_SPANS)
+DEFINES += ILI9341_SPI_16BIT=$(LCD_SPI_16BIT)
+DEFINES += ILI9341_SPI_BITRATE=$(LCD_SPI_BITRATE)
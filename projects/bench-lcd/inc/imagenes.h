@@ -0,0 +1,101 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef IMAGENES_H    /*! @cond    */
+#define IMAGENES_H    /*! @endcond */
+
+/** @file imagenes.h
+ **
+ ** @brief Imagenes comprimidas de las pruebas de bench-lcd
+ **
+ ** Los archivos imagen_*.c se generan a partir de los PNG de la carpeta img
+ ** con scripts/image/png2image.py, desde la raiz del repositorio:
+ **
+ **     python3 scripts/image/png2image.py projects/bench-lcd/img/fondo.png \
+ **         -n imagen_fondo -o projects/bench-lcd/src/imagen_fondo.c
+ **     python3 scripts/image/png2image.py projects/bench-lcd/img/panel.png \
+ **         -n imagen_panel -r -o projects/bench-lcd/src/imagen_panel.c
+ **     python3 scripts/image/png2image.py projects/bench-lcd/img/foto.png \
+ **         -n imagen_foto -r -o projects/bench-lcd/src/imagen_foto.c
+ **     python3 scripts/image/png2image.py projects/bench-lcd/img/icono.png \
+ **         -n imagen_icono -r -t 0xF81F -b 0x2945 -o projects/bench-lcd/src/imagen_icono.c
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include "ili9341.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Color transparente del icono */
+#define ICONO_TRANSPARENTE    ILI9341_MAGENTA
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/* === Declaraciones de variables externas ================================= */
+
+/** @brief Fondo de pantalla: barra de estado y degradé vertical, ver ColorFondo */
+extern const ili9341_image_t imagen_fondo;
+
+/** @brief Boton redondeado con borde, degradé, simbolo y barras de texto suavizados */
+extern const ili9341_image_t imagen_panel;
+extern const uint8_t imagen_panel_pic[];
+
+/** @brief Plasma con ruido, como una fotografía, el peor caso de la compresión */
+extern const ili9341_image_t imagen_foto;
+extern const uint8_t imagen_foto_pic[];
+
+/** @brief Icono circular, fuera del circulo tiene el color ICONO_TRANSPARENTE */
+extern const ili9341_image_t imagen_icono;
+extern const uint8_t imagen_icono_pic[];
+
+/* === Declaraciones de funciones externas ================================= */
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* IMAGENES_H */
@@ -0,0 +1,1578 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones de las funciones de dibujo del ILI9341
+ **
+ ** Llena la pantalla completa con ILI9341Fill, la envia desde un bloque de
+ ** pixeles con ILI9341WritePixels y desde una imagen con ILI9341DrawPicture,
+ ** dibuja cadenas con
+ ** ILI9341DrawString y pixeles sueltos con ILI9341DrawPixel, y mide en
+ ** ciclos del procesador la duración de cada dibujo. Las cadenas se dibujan
+ ** sin y con la cache de glifos, que ocupa GLYPH_CACHE_SIZE bytes en la RAM
+ ** AHB; la prueba draw_clock redibuja un reloj "%02d:%02d:%02d" con
+ ** font_16x26 como tp7-interrupciones. Las pruebas dashboard redibujan el
+ ** reloj y cuatro parciales como la tarea Display de tp6-colas, directamente
+ ** o con la capa ili9341_damage que solo envia los caracteres que cambian.
+ ** La prueba server_dashboard publica el mismo tablero en el servidor de
+ ** pantalla, que lo dibuja en franjas de BAND_MEMORY / 2 bytes desde su
+ ** propia tarea; la medición es solo lo que tarda la tarea en publicar los
+ ** comandos y la verificación espera antes el fin del cuadro. Las pruebas
+ ** draw_line, draw_circle y draw_filled_circle dibujan lineas diagonales y
+ ** circulos de radio RADIO, y las pruebas gauge dibujan un indicador con un
+ ** circulo relleno, su borde, una aguja y un centro, directamente o compuesto
+ ** en la banda de ILI9341BandBegin; las pruebas gauge_clock agregan un reloj
+ ** y dibujan el cuadro con ILI9341BandRender, que compone cada banda mientras
+ ** el DMA envia la anterior desde la otra memoria de LCD_BAND_SIZE bytes. El modo del SPI del driver se elige al
+ ** compilar con LCD_SPI_SESSION, para comparar la sesión única con la
+ ** configuración del puerto en cada comando, y el del dibujo de lineas y
+ ** circulos con LCD_SPANS, para comparar las tiras de pixeles con el dibujo
+ ** pixel por pixel. Las pruebas image dibujan con ILI9341DrawImage las
+ ** imagenes comprimidas de imagenes.h, un fondo de pantalla, un panel y una
+ ** foto, y las pruebas picture los mismos pixeles sin comprimir con
+ ** ILI9341DrawPicture; sprite_icon dibuja un icono con transparencia y las
+ ** pruebas ui_screen el fondo, el panel y el icono, directamente o en bandas
+ ** con ILI9341BandRender. Las pruebas draw_text dibujan la cadena de
+ ** draw_string con ILI9341DrawText y la fuente suavizada font_sans_18, y las
+ ** pruebas draw_digits los segundos y centesimas del reloj con font_digits_64,
+ ** directamente o en bandas. Las pruebas console agregan una linea a un
+ ** registro de CONSOLA_LINEAS lineas: console_redraw redibuja todas las
+ ** lineas visibles y console_append usa ili9341_console, que mueve el inicio
+ ** del desplazamiento vertical y solo dibuja los caracteres que cambian
+ ** respecto de la linea que reemplaza. Con LCD_SPI_16BIT se elige si los
+ ** pixeles salen en tramas de 16 bits desde colores nativos o en tramas de 8
+ ** bits, y con LCD_SPI_BITRATE la frecuencia del SCK, por defecto la mayor
+ ** del SSP:
+ **
+ **     make PROJECT_PATH=projects PROJECT_NAME=bench-lcd LCD_SPI_SESSION=0
+ **     make PROJECT_PATH=projects PROJECT_NAME=bench-lcd LCD_SPANS=0
+ **     make PROJECT_PATH=projects PROJECT_NAME=bench-lcd LCD_SPI_16BIT=0
+ **
+ ** En PLATFORM=host el SPI y la pantalla son simulados y SpiInit no tiene
+ ** costo, por lo que los tiempos no reflejan la diferencia. En cambio se
+ ** informa por cada dibujo la cantidad de configuraciones del puerto y de
+ ** transferencias que recibe la pantalla simulada, y se verifica el color
+ ** de la pantalla despues de cada llenado y los pixeles de cada cadena.
+ **
+ ** La salida tiene el mismo formato que la de bench-kernel:
+ **
+ **     # bench-lcd platform=edu-ciaa cpu_hz=204000000 ... spans=1 frame_bits=16 bitrate=102000000
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     # image name=background width=240 height=320 raw_bytes=153600 bytes=1304 ratio=0.8%
+ **     # font name=digits_64 bpp=4 height=43 chars=27 bytes=3504 cell_bytes=13072 ratio=26%
+ **     ...
+ **     ili9341_fill,76800,20,...
+ **     # spi_link test=ili9341_fill frame_bits=16 bitrate=102000000 bits_per_second=... efficiency=...%
+ **     # spi test=ili9341_fill inits=0 transfers=610 bytes=154733 frames=77372
+ **     write_pixels,76800,20,...
+ **     ...
+ **     draw_clock_cached,8,20,...
+ **     # glyph_cache test=draw_clock_cached hits=149 misses=11 evictions=0 ...
+ **     ...
+ **     dashboard_damage,16640,20,...
+ **     # damage test=dashboard_damage requested=... pushed=... saved=...%
+ **     draw_line,240,20,...
+ **     # raster test=draw_line pixels_per_second=...
+ **     ...
+ **     image_background,76800,20,...
+ **     ...
+ **     console_append,34,20,...
+ **     # console test=console_append lines=20 scrolls=8 drawn=... skipped=... saved=...%
+ **     server_dashboard,16640,20,...
+ **     # display_server test=server_dashboard frames=20 bands=... post_avg_ns=...
+ **     # end
+ **
+ ** El parametro es la cantidad de pixeles o caracteres de cada dibujo. Las
+ ** lineas "# spi" solo se envian en PLATFORM=host, con valores por dibujo,
+ ** las lineas "# glyph_cache" y "# damage" tienen los valores de toda la
+ ** prueba; requested son los pixeles que pidieron los dibujos y pushed los
+ ** que se enviaron a la pantalla. La linea "# raster" tiene los pixeles
+ ** dibujados por segundo, con el promedio de la prueba; con LCD_SPANS=0 la
+ ** prueba draw_line informa errores porque el dibujo anterior termina la
+ ** linea cuando una de las dos coordenadas llega al final. La linea
+ ** "# spi_link" tiene los bits de pixeles enviados por segundo y su relación
+ ** con la frecuencia del SCK; las imagenes de draw_picture tienen el byte alto
+ ** primero y salen siempre en tramas de 8 bits. Las lineas "# image" tienen
+ ** el tamaño de cada imagen sin comprimir y comprimida, lo que ocupa en la
+ ** flash, y su relación, y las lineas "# font" lo que ocupa cada fuente y lo
+ ** que ocuparian sus celdas guardadas enteras con los mismos bits por pixel.
+ ** La linea "# console" tiene las lineas agregadas, las que desplazaron la
+ ** consola y las celdas dibujadas y salteadas porque el panel ya las mostraba.
+ ** La linea "# display_server" tiene los
+ ** cuadros, los cuadros por segundo esperando cada uno, las franjas y pixeles del servidor, las veces que espero al SPI, el
+ ** tiempo que uso para componer las franjas y la duración de las
+ ** publicaciones.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "gpio.h"
+#include "spi.h"
+#include "ili9341.h"
+#include "ili9341_damage.h"
+#include "ili9341_console.h"
+#include "display_server.h"
+#include "fonts.h"
+#include "cycles.h"
+#include "imagenes.h"
+#ifdef PLATFORM_HOST
+#include "host_board.h"
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         20     /*!< Repeticiones de cada dibujo */
+#endif
+
+#ifndef GLYPH_CACHE_SIZE
+#define GLYPH_CACHE_SIZE      20480  /*!< Memoria de la cache de glifos */
+#endif
+
+#ifndef BAND_MEMORY
+#define BAND_MEMORY           8192   /*!< Memoria de las dos franjas del servidor de pantalla */
+#endif
+
+#ifndef LCD_BAND_SIZE
+#define LCD_BAND_SIZE         7680   /*!< Memoria de cada banda del driver, 16 filas de 240 pixeles */
+#endif
+
+#if (ILI9341_SPI_16BIT == 1)
+#define BITS_TRAMA            16     /*!< Bits de las tramas del SPI con los pixeles */
+#else
+#define BITS_TRAMA            8
+#endif
+
+#define PRIORIDAD_CONTROL     ( tskIDLE_PRIORITY + 1 )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+#define PRIORIDAD_PANTALLA    ( tskIDLE_PRIORITY + 1 )
+
+/** @brief Terminales del ILI9341 */
+#define LCD_CS                GPIO_0
+#define LCD_DC                GPIO_6
+#define LCD_RST               GPIO_7
+
+/** @brief Texto de la prueba de cadenas */
+#define TEXTO                 "Sesion SPI ILI9341"
+
+/** @brief Buffer de linea de la cache, alcanza para TEXTO completo con font_11x18 */
+#define LINEA_CACHE           ( (sizeof(TEXTO) - 1) * 11 * 18 * 2 )
+
+/** @brief Posición del reloj */
+#define RELOJ_X               100
+#define RELOJ_Y               25
+
+/** @brief Tablero como el de tp6-colas: reloj y cuatro parciales, uno nuevo cada VUELTA dibujos */
+#define PARCIALES             4
+#define PARCIAL_Y             100
+#define PARCIAL_PASO          30
+#define VUELTA                10
+#define PIXELES_TABLERO       ( (1 + PARCIALES) * 8 * 16 * 26 )
+
+/** @brief Circulos centrados en la pantalla y pixeles que dibuja el algoritmo del punto medio */
+#define CENTRO_X              120
+#define CENTRO_Y              160
+#define RADIO                 100
+#define PIXELES_LINEA         240
+#define PIXELES_CIRCULO       564
+#define PIXELES_CIRCULO_LLENO 31689
+
+/** @brief Indicador: filas que ocupa, posiciones de la aguja y tamaño del centro */
+#define INDICADOR_Y0          ( CENTRO_Y - RADIO - 20 )
+#define INDICADOR_Y1          ( CENTRO_Y + RADIO + 19 )
+#define PIXELES_INDICADOR     ( ILI9341_WIDTH * (INDICADOR_Y1 - INDICADOR_Y0 + 1) )
+#define POSICIONES            8
+#define CENTRO_LADO           5
+#define INDICADOR_RELOJ_X     ( CENTRO_X - 64 )
+#define INDICADOR_RELOJ_Y     ( CENTRO_Y + 30 )
+
+/** @brief Filas de los bloques que repiten las pruebas write_pixels y draw_picture */
+#define FILAS_PIXELES         ( LCD_BAND_SIZE / (2 * ILI9341_WIDTH) )
+#define FILAS_IMAGEN          ( BAND_MEMORY / (2 * ILI9341_WIDTH) )
+
+/** @brief Posiciones de las imagenes comprimidas, el icono va sobre el degradé del fondo */
+#define PANEL_X               40
+#define PANEL_Y               128
+#define FOTO_X                60
+#define FOTO_Y                115
+#define ICONO_X               96
+#define ICONO_Y               48
+#define PIXELES_PANEL         ( 160 * 64 )
+#define PIXELES_FOTO          ( 120 * 90 )
+#define PIXELES_ICONO         ( 48 * 48 )
+
+/** @brief Filas de la barra de estado de la imagen de fondo */
+#define BARRA_ESTADO          24
+
+/* Segundos y centesimas del reloj con font_digits_64 */
+#define DIGITOS_X             25
+#define DIGITOS_Y             140
+#define DIGITOS               5
+
+/* Consola de texto de las pruebas console, debajo de una barra fija */
+#define CONSOLA_Y             40
+#define CONSOLA_LINEAS        12
+#define CONSOLA_COLUMNAS      ( ILI9341_WIDTH / 7 )
+#define CONSOLA_ALARMA        7
+
+/** @brief Color esperado en los pixeles transparentes de VerificarBloque */
+#define SIN_TRANSPARENCIA     ( -1 )
+#define SOBRE_FONDO           ( -2 )
+
+#ifdef PLATFORM_HOST
+#define SECCION_CACHE
+#define SECCION_BANDA
+#else
+#define SECCION_CACHE         __attribute__((section(".bss.$RamAHB32")))
+#define SECCION_BANDA         __attribute__((section(".bss.$RamAHB16")))
+#endif
+
+/** @brief Colores de los llenados, se alternan en cada repetición */
+#define COLOR_PAR             ILI9341_NAVY
+#define COLOR_IMPAR           ILI9341_DARKGREEN
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;            /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;              /*!< Menor valor medido */
+   uint32_t maximo;              /*!< Mayor valor medido */
+   uint32_t errores;             /*!< Mediciones en las que falló la verificación */
+   uint64_t total;               /*!< Suma de todas las mediciones */
+} resultado_t;
+
+/** @brief Dibujo que se repite en una prueba */
+typedef void (*dibujo_t)(uint32_t muestra);
+
+/** @brief Verificación de un dibujo fuera de la medición, devuelve false si falla */
+typedef bool (*verificacion_t)(uint32_t muestra);
+
+/** @brief Descripción de una prueba */
+typedef struct prueba_s {
+   const char * nombre;          /*!< Nombre de la prueba en la tabla de resultados */
+   uint32_t parametro;           /*!< Pixeles o caracteres de cada dibujo */
+   dibujo_t dibujo;              /*!< Función que dibuja una vez */
+   verificacion_t verificacion;  /*!< Función que verifica el dibujo, NULL si no hay */
+   bool cache;                   /*!< Dibuja con la cache de glifos */
+   bool danio;                   /*!< Dibuja con el seguimiento de regiones modificadas */
+   bool servidor;                /*!< Publica el dibujo en el servidor de pantalla */
+   bool trazo;                   /*!< Informa los pixeles dibujados por segundo */
+   bool enlace;                  /*!< Informa la velocidad efectiva del SPI */
+   bool consola;                 /*!< Dibuja en la consola de texto con desplazamiento */
+} prueba_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Llena la pantalla completa */
+static void Llenar(uint32_t muestra);
+
+/** @brief Envia la pantalla completa con ILI9341WritePixels, en bloques de FILAS_PIXELES filas */
+static void EscribirPixeles(uint32_t muestra);
+
+/** @brief Dibuja la pantalla completa con ILI9341DrawPicture, en bloques de FILAS_IMAGEN filas */
+static void DibujarImagen(uint32_t muestra);
+
+/** @brief Prepara los pixeles de write_pixels en las bandas y la imagen de draw_picture */
+static void PrepararBloques(void);
+
+/** @brief Dibuja la imagen comprimida del fondo en la pantalla completa */
+static void Fondo(uint32_t muestra);
+
+/** @brief Dibuja la imagen comprimida del panel */
+static void Panel(uint32_t muestra);
+
+/** @brief Dibuja el panel sin comprimir con ILI9341DrawPicture */
+static void PanelSinComprimir(uint32_t muestra);
+
+/** @brief Dibuja la imagen comprimida de la foto */
+static void Foto(uint32_t muestra);
+
+/** @brief Dibuja la foto sin comprimir con ILI9341DrawPicture */
+static void FotoSinComprimir(uint32_t muestra);
+
+/** @brief Borra el lugar del icono y lo dibuja con ILI9341DrawSprite */
+static void Icono(uint32_t muestra);
+
+/** @brief Dibuja directamente el fondo, el panel y el icono */
+static void Pantalla(uint32_t muestra);
+
+/** @brief Dibuja el fondo, el panel y el icono banda por banda */
+static void PantallaBanda(uint32_t muestra);
+
+/** @brief Dibuja las imagenes de la pantalla, llamada en cada banda */
+static void PartesPantalla(void * contexto);
+
+/** @brief Dibuja la cadena de texto con una fuente suavizada */
+static void TextoSuave(uint32_t muestra);
+
+/** @brief Dibuja la cadena de texto suavizada en bandas */
+static void TextoSuaveBanda(uint32_t muestra);
+
+/** @brief Dibuja la cadena de texto suavizada, llamada en cada banda */
+static void PartesTextoSuave(void * contexto);
+
+/** @brief Dibuja el reloj con los digitos grandes suavizados */
+static void Digitos(uint32_t muestra);
+
+/** @brief Dibuja el reloj con los digitos grandes en bandas */
+static void DigitosBanda(uint32_t muestra);
+
+/** @brief Dibuja el reloj con los digitos grandes, llamada en cada banda */
+static void PartesDigitos(void * contexto);
+
+/** @brief Dibuja una cadena de texto */
+static void Cadena(uint32_t muestra);
+
+/** @brief Agrega una linea al registro redibujando todas las lineas visibles */
+static void Registro(uint32_t muestra);
+
+/** @brief Agrega una linea al registro en la consola con desplazamiento */
+static void RegistroConsola(uint32_t muestra);
+
+/** @brief Genera una linea del registro y devuelve su color */
+static uint16_t LineaRegistro(uint32_t linea, char * texto, uint32_t tamano);
+
+/** @brief Verifica las lineas visibles del registro como las muestra el panel */
+static bool VerificarRegistro(uint32_t muestra);
+
+/** @brief Dibuja un pixel */
+static void Pixel(uint32_t muestra);
+
+/** @brief Dibuja un reloj con minutos, segundos y centesimas */
+static void Reloj(uint32_t muestra);
+
+/** @brief Dibuja el tablero completo, como la tarea Display de tp6-colas */
+static void Tablero(uint32_t muestra);
+
+/** @brief Registra el tablero en la capa de regiones modificadas y envia solo los cambios */
+static void TableroDanio(uint32_t muestra);
+
+/** @brief Dibuja una linea diagonal, alternando entre lineas horizontales y verticales */
+static void Linea(uint32_t muestra);
+
+/** @brief Dibuja el borde de un circulo */
+static void Circulo(uint32_t muestra);
+
+/** @brief Dibuja un circulo relleno */
+static void CirculoRelleno(uint32_t muestra);
+
+/** @brief Dibuja el indicador directamente, borrando antes su fondo */
+static void Indicador(uint32_t muestra);
+
+/** @brief Compone el indicador en bandas y las envia */
+static void IndicadorBanda(uint32_t muestra);
+
+/** @brief Dibuja las partes del indicador */
+static void PartesIndicador(uint32_t muestra);
+
+/** @brief Dibuja directamente el indicador con un reloj */
+static void IndicadorReloj(uint32_t muestra);
+
+/** @brief Dibuja el indicador con un reloj banda por banda */
+static void IndicadorRelojBanda(uint32_t muestra);
+
+/** @brief Dibuja las partes del indicador y el reloj, llamada en cada banda */
+static void PartesIndicadorReloj(void * contexto);
+
+/** @brief Verifica el indicador y su reloj */
+static bool VerificarIndicadorReloj(uint32_t muestra);
+
+/** @brief Color de una fila de la imagen de fondo, el mismo que usa la imagen */
+static uint16_t ColorFondo(uint16_t y);
+
+/** @brief Verifica los bordes de la imagen de fondo */
+static bool VerificarFondo(uint32_t muestra);
+
+/** @brief Verifica los pixeles del panel */
+static bool VerificarPanel(uint32_t muestra);
+
+/** @brief Verifica los pixeles de la foto */
+static bool VerificarFoto(uint32_t muestra);
+
+/** @brief Verifica el icono y el color que queda en sus pixeles transparentes */
+static bool VerificarIcono(uint32_t muestra);
+
+/** @brief Verifica el fondo, el panel y el icono */
+static bool VerificarPantalla(uint32_t muestra);
+
+/** @brief Verifica los pixeles de la cadena de texto suavizada */
+static bool VerificarTextoSuave(uint32_t muestra);
+
+/** @brief Verifica los pixeles del reloj con los digitos grandes */
+static bool VerificarDigitos(uint32_t muestra);
+
+/** @brief Verifica en la pantalla simulada cada celda de un texto con una fuente suavizada,
+ **        decodificando los caracteres y mezclando los colores por su cuenta */
+static bool VerificarFuente(uint16_t x, uint16_t y, const char * texto, const FontAA_t * fuente,
+                            uint16_t frente, uint16_t fondo);
+
+/** @brief Mezcla dos colores RGB565 segun la cobertura de un pixel */
+static uint16_t Mezclar(uint16_t frente, uint16_t fondo, uint16_t nivel, uint16_t maximo);
+
+/** @brief Compara una zona de la pantalla con una imagen sin comprimir, con el byte alto primero */
+static bool VerificarBloque(uint16_t x, uint16_t y, uint16_t ancho, uint16_t alto,
+                            const uint8_t * imagen, int32_t detras);
+
+/** @brief Calcula los extremos de la linea de una repetición */
+static void ExtremosLinea(uint32_t muestra, int16_t * x0, int16_t * y0, int16_t * x1, int16_t * y1);
+
+/** @brief Verifica los pixeles de la linea */
+static bool VerificarLinea(uint32_t muestra);
+
+/** @brief Verifica los pixeles del borde del circulo */
+static bool VerificarCirculo(uint32_t muestra);
+
+/** @brief Verifica el borde y el centro del circulo relleno */
+static bool VerificarCirculoRelleno(uint32_t muestra);
+
+/** @brief Verifica el fondo, el borde, la aguja y el centro del indicador */
+static bool VerificarIndicador(uint32_t muestra);
+
+/** @brief Verifica el color de un pixel de la pantalla simulada */
+static bool VerificarPixel(int16_t x, int16_t y, uint16_t color);
+
+/** @brief Publica el tablero completo en el servidor de pantalla */
+static void TableroServidor(uint32_t muestra);
+
+/** @brief Espera que el servidor termine el cuadro y verifica el tablero */
+static bool VerificarServidor(uint32_t muestra);
+
+/** @brief Arma el texto de un parcial del tablero para una repetición */
+static void TextoParcial(uint32_t muestra, uint32_t parcial, char * texto, uint32_t tamano);
+
+/** @brief Arma el texto del reloj para una repetición */
+static void TextoReloj(uint32_t muestra, char * texto, uint32_t tamano);
+
+/** @brief Verifica el color de la pantalla despues de un llenado */
+static bool VerificarLlenado(uint32_t muestra);
+
+/** @brief Verifica la primera y la ultima fila de la imagen de draw_picture */
+static bool VerificarImagen(uint32_t muestra);
+
+/** @brief Verifica los pixeles de la cadena de texto */
+static bool VerificarCadena(uint32_t muestra);
+
+/** @brief Verifica los pixeles del reloj */
+static bool VerificarReloj(uint32_t muestra);
+
+/** @brief Verifica los pixeles del reloj y de los parciales del tablero */
+static bool VerificarTablero(uint32_t muestra);
+
+/** @brief Verifica en la pantalla simulada los pixeles de una cadena de una linea */
+static bool VerificarTexto(uint16_t x, uint16_t y, const char * texto, const Font_t * fuente,
+                           uint16_t frente, uint16_t fondo);
+
+/** @brief Repite el dibujo de una prueba midiendo cada repetición */
+static void Medir(const prueba_t * prueba);
+
+/** @brief Envia una fila de la tabla de resultados */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado);
+
+/** @brief Envia el tamaño de una imagen comprimida y sin comprimir */
+static void InformarImagen(const char * nombre, const ili9341_image_t * imagen);
+
+/** @brief Envia lo que ocupa una fuente suavizada y sus celdas sin comprimir */
+static void InformarFuente(const char * nombre, const FontAA_t * fuente);
+
+/** @brief Envia lo que ocupa una fuente de ancho fijo de un bit por pixel */
+static void InformarFuenteFija(const char * nombre, const Font_t * fuente);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+/** @brief Pruebas de dibujo */
+static const prueba_t PRUEBAS[] = {
+   {"ili9341_fill", ILI9341_WIDTH * ILI9341_HEIGHT, Llenar, VerificarLlenado, false, false, false,
+    true, true, false},
+   {"write_pixels", ILI9341_WIDTH * ILI9341_HEIGHT, EscribirPixeles, VerificarLlenado, false, false,
+    false, true, true, false},
+   {"draw_picture", ILI9341_WIDTH * ILI9341_HEIGHT, DibujarImagen, VerificarImagen, false, false,
+    false, true, true, false},
+   {"draw_string", sizeof(TEXTO) - 1, Cadena, VerificarCadena, false, false, false, false, false,
+    false},
+   {"draw_pixel", 1, Pixel, NULL, false, false, false, true, false, false},
+   {"draw_clock", 8, Reloj, VerificarReloj, false, false, false, false, false, false},
+   {"draw_string_cached", sizeof(TEXTO) - 1, Cadena, VerificarCadena, true, false, false, false,
+    false, false},
+   {"draw_clock_cached", 8, Reloj, VerificarReloj, true, false, false, false, false, false},
+   {"dashboard", PIXELES_TABLERO, Tablero, VerificarTablero, true, false, false, false, false,
+    false},
+   {"dashboard_damage", PIXELES_TABLERO, TableroDanio, VerificarTablero, true, true, false, false,
+    false, false},
+   {"draw_line", PIXELES_LINEA, Linea, VerificarLinea, false, false, false, true, false, false},
+   {"draw_circle", PIXELES_CIRCULO, Circulo, VerificarCirculo, false, false, false, true, false,
+    false},
+   {"draw_filled_circle", PIXELES_CIRCULO_LLENO, CirculoRelleno, VerificarCirculoRelleno, false,
+    false, false, true, false, false},
+   {"gauge", PIXELES_INDICADOR, Indicador, VerificarIndicador, false, false, false, true, false,
+    false},
+   {"gauge_band", PIXELES_INDICADOR, IndicadorBanda, VerificarIndicador, false, false, false, true,
+    false, false},
+   {"gauge_clock", PIXELES_INDICADOR, IndicadorReloj, VerificarIndicadorReloj, false, false, false,
+    true, false, false},
+   {"gauge_clock_band", PIXELES_INDICADOR, IndicadorRelojBanda, VerificarIndicadorReloj, false,
+    false, false, true, false, false},
+   {"image_background", ILI9341_WIDTH * ILI9341_HEIGHT, Fondo, VerificarFondo, false, false, false,
+    true, true, false},
+   {"image_panel", PIXELES_PANEL, Panel, VerificarPanel, false, false, false, true, false, false},
+   {"picture_panel", PIXELES_PANEL, PanelSinComprimir, VerificarPanel, false, false, false, true,
+    false, false},
+   {"image_photo", PIXELES_FOTO, Foto, VerificarFoto, false, false, false, true, false, false},
+   {"picture_photo", PIXELES_FOTO, FotoSinComprimir, VerificarFoto, false, false, false, true,
+    false, false},
+   {"sprite_icon", PIXELES_ICONO, Icono, VerificarIcono, false, false, false, true, false, false},
+   {"ui_screen", ILI9341_WIDTH * ILI9341_HEIGHT, Pantalla, VerificarPantalla, false, false, false,
+    true, true, false},
+   {"ui_screen_band", ILI9341_WIDTH * ILI9341_HEIGHT, PantallaBanda, VerificarPantalla, false,
+    false, false, true, true, false},
+   {"draw_text", sizeof(TEXTO) - 1, TextoSuave, VerificarTextoSuave, false, false, false, false,
+    false, false},
+   {"draw_text_band", sizeof(TEXTO) - 1, TextoSuaveBanda, VerificarTextoSuave, false, false, false,
+    false, false, false},
+   {"draw_digits", DIGITOS, Digitos, VerificarDigitos, false, false, false, false, false, false},
+   {"draw_digits_band", DIGITOS, DigitosBanda, VerificarDigitos, false, false, false, false, false,
+    false},
+   {"console_redraw", CONSOLA_COLUMNAS, Registro, VerificarRegistro, false, false, false, false,
+    false, false},
+   {"console_append", CONSOLA_COLUMNAS, RegistroConsola, VerificarRegistro, false, false, false,
+    false, false, true},
+   {"server_dashboard", PIXELES_TABLERO, TableroServidor, VerificarServidor, false, false, true,
+    false, false, false},
+};
+
+/** @brief Extremos de la aguja del indicador, a 90 pixeles del centro */
+static const int16_t AGUJA[POSICIONES][2] = {
+   {CENTRO_X + 90, CENTRO_Y}, {CENTRO_X + 64, CENTRO_Y - 64}, {CENTRO_X, CENTRO_Y - 90},
+   {CENTRO_X - 64, CENTRO_Y - 64}, {CENTRO_X - 90, CENTRO_Y}, {CENTRO_X - 64, CENTRO_Y + 64},
+   {CENTRO_X, CENTRO_Y + 90}, {CENTRO_X + 64, CENTRO_Y + 64},
+};
+
+/** @brief Memoria de la cache de glifos, en la RAM AHB para que la lea el DMA */
+static uint8_t cache[GLYPH_CACHE_SIZE] SECCION_CACHE __attribute__((aligned(4)));
+
+/** @brief Memoria de las franjas del servidor de pantalla, tambien la lee el DMA */
+static uint8_t franjas[BAND_MEMORY] SECCION_CACHE __attribute__((aligned(4)));
+
+/** @brief Memorias de las bandas del indicador, en otro banco de la RAM AHB */
+static uint8_t banda[LCD_BAND_SIZE] SECCION_BANDA __attribute__((aligned(4)));
+static uint8_t otra_banda[LCD_BAND_SIZE] SECCION_BANDA __attribute__((aligned(4)));
+
+/** @brief El servidor se inicia recien en su primera prueba */
+static bool servidor_iniciado;
+
+static resultado_t resultado;
+static uint32_t sobrecarga;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+}
+
+static void Llenar(uint32_t muestra) {
+   ILI9341Fill((muestra & 1) ? COLOR_IMPAR : COLOR_PAR);
+}
+
+static void EscribirPixeles(uint32_t muestra) {
+   uint16_t * pixeles = (uint16_t *) ((muestra & 1) ? otra_banda : banda);
+   uint16_t y, ultima;
+
+   /* Dentro del dibujo cada bloque sale por el DMA mientras se envia la ventana del siguiente */
+   ILI9341BeginDrawing();
+   for (y = 0; y < ILI9341_HEIGHT; y += FILAS_PIXELES) {
+      ultima = (y + FILAS_PIXELES > ILI9341_HEIGHT) ? ILI9341_HEIGHT - 1 : y + FILAS_PIXELES - 1;
+      ILI9341WritePixels(0, y, ILI9341_WIDTH - 1, ultima, pixeles);
+   }
+   ILI9341EndDrawing();
+}
+
+static void DibujarImagen(uint32_t muestra) {
+   uint16_t y, alto;
+
+   (void) muestra;
+   ILI9341BeginDrawing();
+   for (y = 0; y < ILI9341_HEIGHT; y += FILAS_IMAGEN) {
+      alto = (y + FILAS_IMAGEN > ILI9341_HEIGHT) ? ILI9341_HEIGHT - y : FILAS_IMAGEN;
+      ILI9341DrawPicture(0, y, ILI9341_WIDTH, alto, franjas);
+   }
+   ILI9341EndDrawing();
+}
+
+static void PrepararBloques(void) {
+   uint32_t indice;
+   uint16_t color;
+
+   /* Las bandas tienen los colores de VerificarLlenado como los guarda el driver */
+   for (indice = 0; indice < sizeof(banda) / 2; indice++) {
+      ((uint16_t *) banda)[indice] = ILI9341_PIXEL(COLOR_PAR);
+      ((uint16_t *) otra_banda)[indice] = ILI9341_PIXEL(COLOR_IMPAR);
+   }
+   /* La imagen tiene el byte alto primero, la mitad de arriba de un color y la de abajo de otro */
+   for (indice = 0; indice < sizeof(franjas) / 2; indice++) {
+      color = (indice < (FILAS_IMAGEN / 2) * ILI9341_WIDTH) ? COLOR_PAR : COLOR_IMPAR;
+      franjas[2 * indice] = (uint8_t) (color >> 8);
+      franjas[2 * indice + 1] = (uint8_t) color;
+   }
+}
+
+static void Fondo(uint32_t muestra) {
+   (void) muestra;
+   ILI9341DrawImage(0, 0, &imagen_fondo);
+}
+
+static void Panel(uint32_t muestra) {
+   (void) muestra;
+   ILI9341DrawImage(PANEL_X, PANEL_Y, &imagen_panel);
+}
+
+static void PanelSinComprimir(uint32_t muestra) {
+   (void) muestra;
+   ILI9341DrawPicture(PANEL_X, PANEL_Y, imagen_panel.width, imagen_panel.height,
+                      imagen_panel_pic);
+}
+
+static void Foto(uint32_t muestra) {
+   (void) muestra;
+   ILI9341DrawImage(FOTO_X, FOTO_Y, &imagen_foto);
+}
+
+static void FotoSinComprimir(uint32_t muestra) {
+   (void) muestra;
+   ILI9341DrawPicture(FOTO_X, FOTO_Y, imagen_foto.width, imagen_foto.height, imagen_foto_pic);
+}
+
+static void Icono(uint32_t muestra) {
+   ILI9341DrawFilledRectangle(ICONO_X, ICONO_Y, ICONO_X + imagen_icono.width - 1,
+                              ICONO_Y + imagen_icono.height - 1,
+                              (muestra & 1) ? COLOR_IMPAR : COLOR_PAR);
+   ILI9341DrawSprite(ICONO_X, ICONO_Y, &imagen_icono, ICONO_TRANSPARENTE);
+}
+
+static void Pantalla(uint32_t muestra) {
+   PartesPantalla(&muestra);
+}
+
+static void PantallaBanda(uint32_t muestra) {
+   ILI9341BandRender(0, ILI9341_HEIGHT - 1, ILI9341_BLACK, PartesPantalla, &muestra);
+}
+
+static void PartesPantalla(void * contexto) {
+   (void) contexto;
+   /* En cada banda las imagenes siguen desde donde termino la anterior */
+   ILI9341DrawImage(0, 0, &imagen_fondo);
+   ILI9341DrawImage(PANEL_X, PANEL_Y, &imagen_panel);
+   ILI9341DrawSprite(ICONO_X, ICONO_Y, &imagen_icono, ICONO_TRANSPARENTE);
+}
+
+static void TextoSuave(uint32_t muestra) {
+   PartesTextoSuave(&muestra);
+}
+
+static void TextoSuaveBanda(uint32_t muestra) {
+   uint16_t y = (uint16_t) ((muestra % 16) * font_sans_18.height);
+
+   ILI9341BandRender(y, y + font_sans_18.height - 1, ILI9341_BLUE, PartesTextoSuave, &muestra);
+}
+
+static void PartesTextoSuave(void * contexto) {
+   uint32_t muestra = *(uint32_t *) contexto;
+
+   /* Las mismas filas que draw_string, con la altura de la fuente */
+   ILI9341DrawText(0, (uint16_t) ((muestra % 16) * font_sans_18.height), TEXTO, &font_sans_18,
+                   ILI9341_WHITE, ILI9341_BLUE);
+}
+
+static void Digitos(uint32_t muestra) {
+   PartesDigitos(&muestra);
+}
+
+static void DigitosBanda(uint32_t muestra) {
+   ILI9341BandRender(DIGITOS_Y, DIGITOS_Y + font_digits_64.height - 1, ILI9341_WHITE,
+                     PartesDigitos, &muestra);
+}
+
+static void PartesDigitos(void * contexto) {
+   uint32_t muestra = *(uint32_t *) contexto;
+   char texto[12];
+
+   /* Solo los segundos y las centesimas entran en el ancho de la pantalla */
+   TextoReloj(muestra, texto, sizeof(texto));
+   ILI9341DrawText(DIGITOS_X, DIGITOS_Y, &texto[3], &font_digits_64, ILI9341_BLACK, ILI9341_WHITE);
+}
+
+static void Cadena(uint32_t muestra) {
+   ILI9341DrawString(0, (uint16_t) ((muestra % 16) * 18), TEXTO, &font_11x18, ILI9341_WHITE,
+                     ILI9341_BLUE);
+}
+
+static void Registro(uint32_t muestra) {
+   char linea[40];
+   char texto[40];
+   uint32_t visibles = (muestra < CONSOLA_LINEAS) ? muestra + 1 : CONSOLA_LINEAS;
+   uint32_t fila;
+   uint16_t color;
+
+   /* Sin desplazamiento cada linea nueva mueve todas las anteriores una fila hacia arriba */
+   ILI9341BeginDrawing();
+   for (fila = 0; fila < visibles; fila++) {
+      color = LineaRegistro(muestra + 1 - visibles + fila, linea, sizeof(linea));
+      snprintf(texto, sizeof(texto), "%-*s", CONSOLA_COLUMNAS, linea);
+      ILI9341DrawString(0, CONSOLA_Y + fila * font_7x10.FontHeight, texto, &font_7x10, color,
+                        ILI9341_BLACK);
+   }
+   ILI9341EndDrawing();
+}
+
+static void RegistroConsola(uint32_t muestra) {
+   char linea[40];
+
+   ILI9341ConsoleColor(LineaRegistro(muestra, linea, sizeof(linea) - 1));
+   strcat(linea, "\n");
+   ILI9341ConsolePrint(linea);
+}
+
+static uint16_t LineaRegistro(uint32_t linea, char * texto, uint32_t tamano) {
+   bool alarma = (linea % CONSOLA_ALARMA) == CONSOLA_ALARMA - 1;
+
+   /* Las lineas de la misma fila de la consola comparten casi todos los caracteres */
+   snprintf(texto, tamano, "t=%07lu adc=%04lu %s", (unsigned long) (linea * 125),
+            (unsigned long) ((linea * 37) % 1024), alarma ? "ALARMA" : "ok");
+   return alarma ? ILI9341_YELLOW : ILI9341_WHITE;
+}
+
+static void Pixel(uint32_t muestra) {
+   ILI9341DrawPixel((uint16_t) (muestra % ILI9341_WIDTH), (uint16_t) (muestra % ILI9341_HEIGHT),
+                    ILI9341_YELLOW);
+}
+
+static void Reloj(uint32_t muestra) {
+   char texto[12];
+
+   TextoReloj(muestra, texto, sizeof(texto));
+   ILI9341DrawString(RELOJ_X, RELOJ_Y, texto, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+}
+
+static void Tablero(uint32_t muestra) {
+   char texto[12];
+   uint32_t parcial;
+
+   TextoReloj(muestra, texto, sizeof(texto));
+   ILI9341DrawString(RELOJ_X, RELOJ_Y, texto, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+   for (parcial = 0; parcial < PARCIALES; parcial++) {
+      TextoParcial(muestra, parcial, texto, sizeof(texto));
+      ILI9341DrawString(RELOJ_X, PARCIAL_Y + parcial * PARCIAL_PASO, texto, &font_16x26,
+                        ILI9341_BLACK, ILI9341_WHITE);
+   }
+}
+
+static void TableroDanio(uint32_t muestra) {
+   char texto[12];
+   uint32_t parcial;
+
+   TextoReloj(muestra, texto, sizeof(texto));
+   ILI9341DamageString(RELOJ_X, RELOJ_Y, texto, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+   for (parcial = 0; parcial < PARCIALES; parcial++) {
+      TextoParcial(muestra, parcial, texto, sizeof(texto));
+      ILI9341DamageString(RELOJ_X, PARCIAL_Y + parcial * PARCIAL_PASO, texto, &font_16x26,
+                          ILI9341_BLACK, ILI9341_WHITE);
+   }
+   ILI9341DamageFlush();
+}
+
+static void Linea(uint32_t muestra) {
+   int16_t x0, y0, x1, y1;
+
+   ExtremosLinea(muestra, &x0, &y0, &x1, &y1);
+   ILI9341DrawLine(x0, y0, x1, y1, (muestra & 1) ? COLOR_IMPAR : COLOR_PAR);
+}
+
+static void Circulo(uint32_t muestra) {
+   ILI9341DrawCircle(CENTRO_X, CENTRO_Y, RADIO, (muestra & 1) ? COLOR_IMPAR : COLOR_PAR);
+}
+
+static void CirculoRelleno(uint32_t muestra) {
+   ILI9341DrawFilledCircle(CENTRO_X, CENTRO_Y, RADIO, (muestra & 1) ? COLOR_IMPAR : COLOR_PAR);
+}
+
+static void Indicador(uint32_t muestra) {
+   ILI9341DrawFilledRectangle(0, INDICADOR_Y0, ILI9341_WIDTH - 1, INDICADOR_Y1, ILI9341_WHITE);
+   PartesIndicador(muestra);
+}
+
+static void IndicadorBanda(uint32_t muestra) {
+   uint16_t y, lineas;
+
+   /* Cada banda recibe todas las partes y guarda solo sus filas */
+   for (y = INDICADOR_Y0; y <= INDICADOR_Y1; y += lineas) {
+      lineas = ILI9341BandBegin(y, INDICADOR_Y1, ILI9341_WHITE);
+      if (lineas == 0) {
+         break;
+      }
+      PartesIndicador(muestra);
+      ILI9341BandEnd();
+   }
+}
+
+static void PartesIndicador(uint32_t muestra) {
+   const int16_t * aguja = AGUJA[muestra % POSICIONES];
+
+   ILI9341DrawFilledCircle(CENTRO_X, CENTRO_Y, RADIO, ILI9341_NAVY);
+   ILI9341DrawCircle(CENTRO_X, CENTRO_Y, RADIO, ILI9341_ORANGE2);
+   ILI9341DrawLine(CENTRO_X, CENTRO_Y, aguja[0], aguja[1], ILI9341_YELLOW);
+   ILI9341DrawFilledRectangle(CENTRO_X - CENTRO_LADO, CENTRO_Y - CENTRO_LADO,
+                              CENTRO_X + CENTRO_LADO, CENTRO_Y + CENTRO_LADO, ILI9341_RED);
+}
+
+static void IndicadorReloj(uint32_t muestra) {
+   ILI9341DrawFilledRectangle(0, INDICADOR_Y0, ILI9341_WIDTH - 1, INDICADOR_Y1, ILI9341_WHITE);
+   PartesIndicadorReloj(&muestra);
+}
+
+static void IndicadorRelojBanda(uint32_t muestra) {
+   ILI9341BandRender(INDICADOR_Y0, INDICADOR_Y1, ILI9341_WHITE, PartesIndicadorReloj, &muestra);
+}
+
+static void PartesIndicadorReloj(void * contexto) {
+   uint32_t muestra = *(uint32_t *) contexto;
+   char texto[12];
+
+   PartesIndicador(muestra);
+   TextoReloj(muestra, texto, sizeof(texto));
+   ILI9341DrawString(INDICADOR_RELOJ_X, INDICADOR_RELOJ_Y, texto, &font_16x26, ILI9341_WHITE,
+                     ILI9341_NAVY);
+}
+
+static void ExtremosLinea(uint32_t muestra, int16_t * x0, int16_t * y0, int16_t * x1, int16_t * y1) {
+   int16_t paso = (int16_t) ((muestra / 2) % 8);
+
+   /* Lineas de PIXELES_LINEA pixeles, horizontales en las muestras pares y verticales en las impares */
+   if ((muestra & 1) == 0) {
+      *x0 = 0;
+      *y0 = 10 + paso * 30;
+      *x1 = PIXELES_LINEA - 1;
+      *y1 = *y0 + 60;
+   } else {
+      *x0 = 10 + paso * 20;
+      *y0 = 0;
+      *x1 = *x0 + 60;
+      *y1 = PIXELES_LINEA - 1;
+   }
+}
+
+static void TableroServidor(uint32_t muestra) {
+   char texto[12];
+   uint32_t parcial;
+
+   TextoReloj(muestra, texto, sizeof(texto));
+   DisplayServerString(RELOJ_X, RELOJ_Y, texto, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+   for (parcial = 0; parcial < PARCIALES; parcial++) {
+      TextoParcial(muestra, parcial, texto, sizeof(texto));
+      DisplayServerString(RELOJ_X, PARCIAL_Y + parcial * PARCIAL_PASO, texto, &font_16x26,
+                          ILI9341_BLACK, ILI9341_WHITE);
+   }
+   DisplayServerFrame(xTaskGetCurrentTaskHandle());
+}
+
+static void TextoParcial(uint32_t muestra, uint32_t parcial, char * texto, uint32_t tamano) {
+   /* El parcial mas reciente es el ultimo multiplo de VUELTA, los anteriores se desplazan */
+   if (muestra / VUELTA < parcial + 1) {
+      snprintf(texto, tamano, "--:--:--");
+   } else {
+      TextoReloj((muestra / VUELTA - parcial) * VUELTA, texto, tamano);
+   }
+}
+
+static void TextoReloj(uint32_t muestra, char * texto, uint32_t tamano) {
+   snprintf(texto, tamano, "%02d:%02d:%02d", (int) ((muestra / 6000) % 60),
+      (int) ((muestra / 100) % 60), (int) (muestra % 100));
+}
+
+static bool VerificarLlenado(uint32_t muestra) {
+#ifdef PLATFORM_HOST
+   uint16_t color = (muestra & 1) ? COLOR_IMPAR : COLOR_PAR;
+
+   /* Las esquinas opuestas de la pantalla deben tener el color del llenado */
+   return (HostDisplayGetPixel(0, 0) == color) &&
+      (HostDisplayGetPixel(ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1) == color);
+#else
+   return true;
+#endif
+}
+
+static bool VerificarImagen(uint32_t muestra) {
+   (void) muestra;
+#ifdef PLATFORM_HOST
+   /* La primera fila es del primer bloque y la ultima de la mitad de abajo del ultimo */
+   return (HostDisplayGetPixel(0, 0) == COLOR_PAR) &&
+      (HostDisplayGetPixel(ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1) == COLOR_IMPAR);
+#else
+   return true;
+#endif
+}
+
+static bool VerificarCadena(uint32_t muestra) {
+   return VerificarTexto(0, (uint16_t) ((muestra % 16) * 18), TEXTO, &font_11x18, ILI9341_WHITE,
+                         ILI9341_BLUE);
+}
+
+static bool VerificarReloj(uint32_t muestra) {
+   char texto[12];
+
+   TextoReloj(muestra, texto, sizeof(texto));
+   return VerificarTexto(RELOJ_X, RELOJ_Y, texto, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+}
+
+static bool VerificarRegistro(uint32_t muestra) {
+   char linea[40];
+   char texto[40];
+   uint32_t visibles = (muestra < CONSOLA_LINEAS) ? muestra + 1 : CONSOLA_LINEAS;
+   uint32_t fila;
+   uint16_t color;
+
+   /* La linea mas nueva queda abajo, aunque en la memoria este en cualquier fila */
+   for (fila = 0; fila < visibles; fila++) {
+      color = LineaRegistro(muestra + 1 - visibles + fila, linea, sizeof(linea));
+      snprintf(texto, sizeof(texto), "%-*s", CONSOLA_COLUMNAS, linea);
+      if (!VerificarTexto(0, CONSOLA_Y + fila * font_7x10.FontHeight, texto, &font_7x10, color,
+                          ILI9341_BLACK)) {
+         return false;
+      }
+   }
+   return true;
+}
+
+static bool VerificarTablero(uint32_t muestra) {
+   char texto[12];
+   uint32_t parcial;
+
+   if (!VerificarReloj(muestra)) {
+      return false;
+   }
+   for (parcial = 0; parcial < PARCIALES; parcial++) {
+      TextoParcial(muestra, parcial, texto, sizeof(texto));
+      if (!VerificarTexto(RELOJ_X, PARCIAL_Y + parcial * PARCIAL_PASO, texto, &font_16x26,
+                          ILI9341_BLACK, ILI9341_WHITE)) {
+         return false;
+      }
+   }
+   return true;
+}
+
+static bool VerificarLinea(uint32_t muestra) {
+   int16_t x0, y0, x1, y1, dx, dy, sx, sy, error, error2;
+   uint16_t color = (muestra & 1) ? COLOR_IMPAR : COLOR_PAR;
+
+   /* Bresenham pixel por pixel, como referencia del dibujo en tiras */
+   ExtremosLinea(muestra, &x0, &y0, &x1, &y1);
+   dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+   dy = (y1 > y0) ? y0 - y1 : y1 - y0;
+   sx = (x0 < x1) ? 1 : -1;
+   sy = (y0 < y1) ? 1 : -1;
+   error = dx + dy;
+   while (true) {
+      if (!VerificarPixel(x0, y0, color)) {
+         return false;
+      }
+      if ((x0 == x1) && (y0 == y1)) {
+         return true;
+      }
+      error2 = 2 * error;
+      if (error2 >= dy) {
+         error += dy;
+         x0 += sx;
+      }
+      if (error2 <= dx) {
+         error += dx;
+         y0 += sy;
+      }
+   }
+}
+
+static bool VerificarCirculo(uint32_t muestra) {
+   uint16_t color = (muestra & 1) ? COLOR_IMPAR : COLOR_PAR;
+   int16_t f = 1 - RADIO, ddx = 1, ddy = -2 * RADIO, x = 0, y = RADIO;
+   bool correcto = true;
+
+   /* Algoritmo del punto medio, los ocho octantes de cada punto */
+   while (correcto) {
+      correcto = VerificarPixel(CENTRO_X + x, CENTRO_Y + y, color) &&
+                 VerificarPixel(CENTRO_X - x, CENTRO_Y + y, color) &&
+                 VerificarPixel(CENTRO_X + x, CENTRO_Y - y, color) &&
+                 VerificarPixel(CENTRO_X - x, CENTRO_Y - y, color) &&
+                 VerificarPixel(CENTRO_X + y, CENTRO_Y + x, color) &&
+                 VerificarPixel(CENTRO_X - y, CENTRO_Y + x, color) &&
+                 VerificarPixel(CENTRO_X + y, CENTRO_Y - x, color) &&
+                 VerificarPixel(CENTRO_X - y, CENTRO_Y - x, color);
+      if (x >= y) {
+         break;
+      }
+      if (f >= 0) {
+         y--;
+         ddy += 2;
+         f += ddy;
+      }
+      x++;
+      ddx += 2;
+      f += ddx;
+   }
+   return correcto;
+}
+
+static bool VerificarCirculoRelleno(uint32_t muestra) {
+   /* El borde del circulo relleno son los pixeles del circulo */
+   return VerificarCirculo(muestra) &&
+      VerificarPixel(CENTRO_X, CENTRO_Y, (muestra & 1) ? COLOR_IMPAR : COLOR_PAR);
+}
+
+static bool VerificarIndicador(uint32_t muestra) {
+   const int16_t * aguja = AGUJA[muestra % POSICIONES];
+
+   return VerificarPixel(0, INDICADOR_Y0, ILI9341_WHITE) &&
+      VerificarPixel(ILI9341_WIDTH - 1, INDICADOR_Y1, ILI9341_WHITE) &&
+      VerificarPixel(CENTRO_X, CENTRO_Y - RADIO, ILI9341_ORANGE2) &&
+      VerificarPixel(CENTRO_X - RADIO / 2, CENTRO_Y - RADIO / 3, ILI9341_NAVY) &&
+      VerificarPixel(aguja[0], aguja[1], ILI9341_YELLOW) &&
+      VerificarPixel(CENTRO_X, CENTRO_Y, ILI9341_RED);
+}
+
+static bool VerificarIndicadorReloj(uint32_t muestra) {
+   char texto[12];
+
+   TextoReloj(muestra, texto, sizeof(texto));
+   return VerificarIndicador(muestra) && VerificarTexto(INDICADOR_RELOJ_X, INDICADOR_RELOJ_Y,
+                                                         texto, &font_16x26, ILI9341_WHITE,
+                                                         ILI9341_NAVY);
+}
+
+static uint16_t ColorFondo(uint16_t y) {
+   uint16_t fila;
+
+   if (y < BARRA_ESTADO) {
+      return (3 << 11) | (6 << 5) | 6;
+   }
+   fila = y - BARRA_ESTADO;
+   return ((1 + fila * 6 / 295) << 11) | ((10 + fila * 30 / 295) << 5) | (8 + fila * 16 / 295);
+}
+
+static bool VerificarFondo(uint32_t muestra) {
+   uint16_t y;
+
+   (void) muestra;
+   for (y = 0; y < ILI9341_HEIGHT; y++) {
+      if (!VerificarPixel(0, y, ColorFondo(y)) ||
+          !VerificarPixel(ILI9341_WIDTH - 1, y, ColorFondo(y))) {
+         return false;
+      }
+   }
+   return true;
+}
+
+static bool VerificarPanel(uint32_t muestra) {
+   (void) muestra;
+   return VerificarBloque(PANEL_X, PANEL_Y, imagen_panel.width, imagen_panel.height,
+                          imagen_panel_pic, SIN_TRANSPARENCIA);
+}
+
+static bool VerificarFoto(uint32_t muestra) {
+   (void) muestra;
+   return VerificarBloque(FOTO_X, FOTO_Y, imagen_foto.width, imagen_foto.height, imagen_foto_pic,
+                          SIN_TRANSPARENCIA);
+}
+
+static bool VerificarIcono(uint32_t muestra) {
+   return VerificarBloque(ICONO_X, ICONO_Y, imagen_icono.width, imagen_icono.height,
+                          imagen_icono_pic, (muestra & 1) ? COLOR_IMPAR : COLOR_PAR);
+}
+
+static bool VerificarPantalla(uint32_t muestra) {
+   (void) muestra;
+   /* El panel y el icono no llegan a los bordes, que quedan con el fondo */
+   return VerificarFondo(muestra) && VerificarPanel(muestra) &&
+      VerificarBloque(ICONO_X, ICONO_Y, imagen_icono.width, imagen_icono.height,
+                      imagen_icono_pic, SOBRE_FONDO);
+}
+
+static bool VerificarTextoSuave(uint32_t muestra) {
+   return VerificarFuente(0, (uint16_t) ((muestra % 16) * font_sans_18.height), TEXTO,
+                          &font_sans_18, ILI9341_WHITE, ILI9341_BLUE);
+}
+
+static bool VerificarDigitos(uint32_t muestra) {
+   char texto[12];
+
+   TextoReloj(muestra, texto, sizeof(texto));
+   return VerificarFuente(DIGITOS_X, DIGITOS_Y, &texto[3], &font_digits_64, ILI9341_BLACK,
+                          ILI9341_WHITE);
+}
+
+static bool VerificarFuente(uint16_t x, uint16_t y, const char * texto, const FontAA_t * fuente,
+                            uint16_t frente, uint16_t fondo) {
+#ifdef PLATFORM_HOST
+   const Glyph_t * glifo;
+   const uint8_t * datos;
+   uint16_t maximo = (1 << fuente->bpp) - 1;
+   uint32_t fila, columna, pixel;
+   uint8_t codigo, nivel, repeticion;
+
+   for (; *texto != '\0'; texto++) {
+      glifo = &fuente->glyphs[(uint8_t) *texto - fuente->first];
+      datos = fuente->data + glifo->offset;
+      pixel = 0;
+      repeticion = 0;
+      nivel = 0;
+      for (fila = 0; fila < fuente->height; fila++) {
+         for (columna = 0; columna < glifo->advance; columna++) {
+            if ((fila < glifo->y) || (fila >= glifo->y + glifo->height) ||
+                (columna < glifo->x) || (columna >= glifo->x + glifo->width)) {
+               /* Fuera de la caja con tinta la celda tiene el fondo */
+               if (!VerificarPixel(x + columna, y + fila, fondo)) {
+                  return false;
+               }
+               continue;
+            }
+            if (glifo->packed) {
+               nivel = (datos[pixel * fuente->bpp / 8] >> (8 - fuente->bpp - pixel * fuente->bpp % 8)) &
+                       maximo;
+            } else if (repeticion == 0) {
+               codigo = *datos++;
+               if (codigo & 0x80) {
+                  repeticion = ((codigo >> 4) & 0x07) + 1;
+                  nivel = codigo & 0x0F;
+               } else {
+                  repeticion = (codigo & 0x3F) + 1;
+                  nivel = (codigo & 0x40) ? maximo : 0;
+               }
+            }
+            if (!glifo->packed) {
+               repeticion--;
+            }
+            pixel++;
+            if (!VerificarPixel(x + columna, y + fila, Mezclar(frente, fondo, nivel, maximo))) {
+               return false;
+            }
+         }
+      }
+      x += glifo->advance;
+   }
+#endif
+   return true;
+}
+
+static uint16_t Mezclar(uint16_t frente, uint16_t fondo, uint16_t nivel, uint16_t maximo) {
+   uint16_t rojo, verde, azul;
+
+   rojo = ((frente >> 11) * nivel + (fondo >> 11) * (maximo - nivel) + maximo / 2) / maximo;
+   verde = (((frente >> 5) & 0x3F) * nivel + ((fondo >> 5) & 0x3F) * (maximo - nivel) + maximo / 2) /
+           maximo;
+   azul = ((frente & 0x1F) * nivel + (fondo & 0x1F) * (maximo - nivel) + maximo / 2) / maximo;
+   return (uint16_t) ((rojo << 11) | (verde << 5) | azul);
+}
+
+static bool VerificarBloque(uint16_t x, uint16_t y, uint16_t ancho, uint16_t alto,
+                            const uint8_t * imagen, int32_t detras) {
+   uint16_t fila, columna;
+   uint16_t esperado;
+
+   for (fila = 0; fila < alto; fila++) {
+      for (columna = 0; columna < ancho; columna++) {
+         esperado = (uint16_t) ((imagen[0] << 8) | imagen[1]);
+         imagen += 2;
+         if ((detras != SIN_TRANSPARENCIA) && (esperado == ICONO_TRANSPARENTE)) {
+            esperado = (detras == SOBRE_FONDO) ? ColorFondo(y + fila) : (uint16_t) detras;
+         }
+         if (!VerificarPixel(x + columna, y + fila, esperado)) {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+static bool VerificarPixel(int16_t x, int16_t y, uint16_t color) {
+#ifdef PLATFORM_HOST
+   /* La orientación por defecto invierte las columnas de la memoria */
+   return HostDisplayGetPixel(ILI9341_WIDTH - 1 - x, y) == color;
+#else
+   return true;
+#endif
+}
+
+static bool VerificarServidor(uint32_t muestra) {
+   /* Un cuadro que no termina en un segundo se cuenta como error */
+   if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000)) == 0) {
+      return false;
+   }
+   return VerificarTablero(muestra);
+}
+
+static bool VerificarTexto(uint16_t x, uint16_t y, const char * texto, const Font_t * fuente,
+                           uint16_t frente, uint16_t fondo) {
+#ifdef PLATFORM_HOST
+   uint32_t caracter, fila, columna;
+   uint16_t bits, esperado;
+
+   for (caracter = 0; texto[caracter] != '\0'; caracter++) {
+      for (fila = 0; fila < fuente->FontHeight; fila++) {
+         bits = fuente->data[(texto[caracter] - ' ') * fuente->FontHeight + fila];
+         for (columna = 0; columna < fuente->FontWidth; columna++) {
+            esperado = (bits & (0x8000 >> columna)) ? frente : fondo;
+            /* La orientación por defecto invierte las columnas de la memoria, y las filas se
+               verifican como las muestra el panel con la consola desplazada */
+            if (HostDisplayGetScreenPixel(ILI9341_WIDTH - 1 -
+                                          (x + caracter * fuente->FontWidth + columna),
+                                          y + fila) != esperado) {
+               return false;
+            }
+         }
+      }
+   }
+#endif
+   return true;
+}
+
+static void Medir(const prueba_t * prueba) {
+   char linea[192];
+   uint32_t inicio, fin;
+   uint32_t muestra;
+   uint32_t tasa = 0;
+   uint32_t bits;
+   uint32_t comienzo, duracion;
+   ili9341_glyph_stats_t glifos;
+   ili9341_damage_stats_t danio;
+   ili9341_console_stats_t consola;
+   DisplayServerStats_t pantalla;
+#ifdef PLATFORM_HOST
+   host_spi_stats_t spi;
+
+   HostSpiResetStats();
+#endif
+
+   /* La cache empieza vacia en cada prueba */
+   if (prueba->cache) {
+      ILI9341GlyphCacheInit(cache, sizeof(cache), LINEA_CACHE);
+   } else {
+      ILI9341GlyphCacheInit(NULL, 0, 0);
+   }
+   /* La capa de regiones modificadas empieza sin nada en pantalla */
+   if (prueba->danio) {
+      ILI9341DamageReset();
+      ILI9341DamageClearStats();
+   }
+   /* La consola empieza vacia y desplaza sus lineas en el area debajo de la barra */
+   if (prueba->consola) {
+      ILI9341ConsoleInit(CONSOLA_Y, CONSOLA_LINEAS, &font_7x10, ILI9341_WHITE, ILI9341_BLACK);
+      ILI9341ConsoleClearStats();
+   }
+   /* El servidor instala una función en el fin de cada transferencia del SPI, por eso se
+      inicia despues de las pruebas que dibujan directamente */
+   if (prueba->servidor) {
+      if (!servidor_iniciado) {
+         servidor_iniciado = (DisplayServerStart(franjas, sizeof(franjas), PRIORIDAD_PANTALLA) ==
+                              pdPASS);
+      }
+      DisplayServerClearStats();
+   }
+
+   memset(&resultado, 0, sizeof(resultado));
+   comienzo = Read_Cycles();
+   for (muestra = 0; muestra < BENCH_SAMPLES; muestra++) {
+      inicio = Read_Cycles();
+      prueba->dibujo(muestra);
+      fin = Read_Cycles();
+      Acumular(&resultado, fin - inicio);
+      if ((prueba->verificacion != NULL) && !prueba->verificacion(muestra)) {
+         resultado.errores++;
+      }
+   }
+   /* Cuadros por segundo de toda la prueba, con la tarea esperando cada cuadro */
+   duracion = Read_Cycles() - comienzo;
+   Informar(prueba->nombre, prueba->parametro, &resultado);
+
+   if (prueba->trazo && (resultado.total > 0)) {
+      snprintf(linea, sizeof(linea), "# raster test=%s pixels_per_second=%lu\r\n", prueba->nombre,
+         (unsigned long) ((uint64_t) prueba->parametro * resultado.muestras * Cycles_Frequency() /
+         resultado.total));
+      Enviar(linea);
+   }
+
+   if (prueba->enlace && (resultado.total > 0)) {
+      bits = (uint32_t) ((uint64_t) prueba->parametro * 16 * resultado.muestras *
+         Cycles_Frequency() / resultado.total);
+      snprintf(linea, sizeof(linea), "# spi_link test=%s frame_bits=%d bitrate=%lu "
+         "bits_per_second=%lu efficiency=%lu%%\r\n", prueba->nombre, BITS_TRAMA,
+         (unsigned long) ILI9341_SPI_BITRATE, (unsigned long) bits,
+         (unsigned long) ((uint64_t) bits * 100 / ILI9341_SPI_BITRATE));
+      Enviar(linea);
+   }
+
+#ifdef PLATFORM_HOST
+   HostSpiGetStats(&spi);
+   snprintf(linea, sizeof(linea), "# spi test=%s inits=%lu transfers=%lu bytes=%lu frames=%lu\r\n",
+      prueba->nombre, (unsigned long) (spi.inits / BENCH_SAMPLES),
+      (unsigned long) (spi.transfers / BENCH_SAMPLES), (unsigned long) (spi.bytes / BENCH_SAMPLES),
+      (unsigned long) (spi.frames / BENCH_SAMPLES));
+   Enviar(linea);
+#endif
+
+   if (prueba->cache) {
+      ILI9341GlyphCacheGetStats(&glifos);
+      if (glifos.hits + glifos.misses > 0) {
+         tasa = 100 * glifos.hits / (glifos.hits + glifos.misses);
+      }
+      snprintf(linea, sizeof(linea), "# glyph_cache test=%s hits=%lu misses=%lu evictions=%lu "
+         "glyphs=%lu used=%lu size=%lu hit_rate=%lu%%\r\n", prueba->nombre,
+         (unsigned long) glifos.hits, (unsigned long) glifos.misses,
+         (unsigned long) glifos.evictions, (unsigned long) glifos.glyphs,
+         (unsigned long) glifos.used, (unsigned long) glifos.size, (unsigned long) tasa);
+      Enviar(linea);
+   }
+
+   if (prueba->danio) {
+      ILI9341DamageGetStats(&danio);
+      tasa = 0;
+      if (danio.requested > 0) {
+         tasa = 100 - (uint32_t) (100ULL * danio.pushed / danio.requested);
+      }
+      snprintf(linea, sizeof(linea), "# damage test=%s requested=%lu pushed=%lu rects=%lu "
+         "merges=%lu overflows=%lu saved=%lu%%\r\n", prueba->nombre,
+         (unsigned long) danio.requested, (unsigned long) danio.pushed,
+         (unsigned long) danio.rects, (unsigned long) danio.merges,
+         (unsigned long) danio.overflows, (unsigned long) tasa);
+      Enviar(linea);
+   }
+
+   if (prueba->consola) {
+      ILI9341ConsoleGetStats(&consola);
+      tasa = 0;
+      if (consola.drawn + consola.skipped > 0) {
+         tasa = 100 * consola.skipped / (consola.drawn + consola.skipped);
+      }
+      snprintf(linea, sizeof(linea), "# console test=%s lines=%lu scrolls=%lu drawn=%lu "
+         "skipped=%lu saved=%lu%%\r\n", prueba->nombre, (unsigned long) consola.lines,
+         (unsigned long) consola.scrolls, (unsigned long) consola.drawn,
+         (unsigned long) consola.skipped, (unsigned long) tasa);
+      Enviar(linea);
+      /* Las pruebas siguientes dibujan en la pantalla sin desplazamiento */
+      ILI9341ConsoleEnd();
+   }
+
+   if (prueba->servidor) {
+      DisplayServerGetStats(&pantalla);
+      snprintf(linea, sizeof(linea), "# display_server test=%s frames=%lu fps=%lu bands=%lu "
+         "pixels=%lu replaced=%lu dropped=%lu waits=%lu render_ns=%lu post_max_ns=%lu "
+         "post_avg_ns=%lu\r\n", prueba->nombre, (unsigned long) pantalla.frames,
+         (unsigned long) ((uint64_t) pantalla.frames * Cycles_Frequency() / (duracion + 1)),
+         (unsigned long) pantalla.bands, (unsigned long) pantalla.pixels, (unsigned long) pantalla.replaced,
+         (unsigned long) pantalla.dropped, (unsigned long) pantalla.waits,
+         (unsigned long) ((uint64_t) pantalla.render * 1000000000ULL / Cycles_Frequency()),
+         (unsigned long) ((uint64_t) pantalla.post_max * 1000000000ULL / Cycles_Frequency()),
+         (unsigned long) ((uint64_t) pantalla.post_average * 1000000000ULL / Cycles_Frequency()));
+      Enviar(linea);
+   }
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado) {
+   char linea[112];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+}
+
+static void InformarImagen(const char * nombre, const ili9341_image_t * imagen) {
+   char linea[112];
+   uint32_t pixeles = (uint32_t) imagen->width * imagen->height;
+
+   snprintf(linea, sizeof(linea), "# image name=%s width=%u height=%u raw_bytes=%lu bytes=%lu "
+      "ratio=%lu.%lu%%\r\n", nombre, imagen->width, imagen->height, (unsigned long) (pixeles * 2),
+      (unsigned long) imagen->size, (unsigned long) (100 * imagen->size / (pixeles * 2)),
+      (unsigned long) (1000 * imagen->size / (pixeles * 2) % 10));
+   Enviar(linea);
+}
+
+static void InformarFuente(const char * nombre, const FontAA_t * fuente) {
+   char linea[112];
+   uint32_t bytes = fuente->size + fuente->count * sizeof(Glyph_t);
+   uint32_t celdas = 0;
+   uint16_t indice;
+
+   /* Lo que ocuparian las celdas de los caracteres guardadas enteras con los mismos bits */
+   for (indice = 0; indice < fuente->count; indice++) {
+      celdas += ((uint32_t) fuente->glyphs[indice].advance * fuente->height * fuente->bpp + 7) / 8;
+   }
+   snprintf(linea, sizeof(linea), "# font name=%s bpp=%u height=%u chars=%u bytes=%lu "
+      "cell_bytes=%lu ratio=%lu%%\r\n", nombre, fuente->bpp, fuente->height, fuente->count,
+      (unsigned long) bytes, (unsigned long) celdas, (unsigned long) (100 * bytes / celdas));
+   Enviar(linea);
+}
+
+static void InformarFuenteFija(const char * nombre, const Font_t * fuente) {
+   char linea[112];
+   /* Una fila de 16 bits por cada fila de los 95 caracteres */
+   uint32_t bytes = 95 * fuente->FontHeight * 2;
+   uint32_t celdas = (95 * fuente->FontWidth * fuente->FontHeight + 7) / 8;
+
+   snprintf(linea, sizeof(linea), "# font name=%s bpp=1 height=%u chars=95 bytes=%lu "
+      "cell_bytes=%lu ratio=%lu%%\r\n", nombre, fuente->FontHeight, (unsigned long) bytes,
+      (unsigned long) celdas, (unsigned long) (100 * bytes / celdas));
+   Enviar(linea);
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void Control(void * parametros) {
+   char linea[160];
+   uint32_t anterior;
+   uint32_t indice;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < 1000; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-lcd platform=%s cpu_hz=%lu counter_hz=%lu "
+      "heap=%d samples=%d overhead=%lu session=%d spans=%d frame_bits=%d bitrate=%lu\r\n",
+      PLATAFORMA, (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(),
+      FREERTOS_HEAP_TYPE, BENCH_SAMPLES, (unsigned long) sobrecarga, ILI9341_SPI_SESSION,
+      ILI9341_SPANS, BITS_TRAMA, (unsigned long) ILI9341_SPI_BITRATE);
+   Enviar(linea);
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   ILI9341Init(SPI_1, LCD_CS, LCD_DC, LCD_RST);
+   ILI9341BandInit(banda, otra_banda, sizeof(banda));
+   PrepararBloques();
+   InformarImagen("background", &imagen_fondo);
+   InformarImagen("panel", &imagen_panel);
+   InformarImagen("photo", &imagen_foto);
+   InformarImagen("icon", &imagen_icono);
+   InformarFuenteFija("11x18", &font_11x18);
+   InformarFuenteFija("16x26", &font_16x26);
+   InformarFuente("sans_18", &font_sans_18);
+   InformarFuente("digits_64", &font_digits_64);
+   for (indice = 0; indice < sizeof(PRUEBAS) / sizeof(PRUEBAS[0]); indice++) {
+      Medir(&PRUEBAS[indice]);
+   }
+
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+
+   xTaskCreate(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, NULL);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
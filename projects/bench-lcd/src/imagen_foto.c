@@ -0,0 +1,2142 @@
+/* Generado con scripts/image/png2image.py a partir de foto.png, no editar */
+
+#include "ili9341.h"
+
+/* 120x90 pixeles, 12462 bytes en lugar de 21600 */
+static const uint8_t imagen_foto_data[] = {
+   0xFE, 0x7B, 0x11, 0xA5, 0x86, 0xA2, 0x87, 0xA3, 0x96, 0x7E, 0x79, 0x71, 0x9F, 0xB8, 0x9D, 0xA9,
+   0x9D, 0xB9, 0x76, 0x72, 0x9D, 0xA8, 0x66, 0x76, 0xC0, 0x7E, 0x30, 0x6E, 0xC0, 0x37, 0xA2, 0x78,
+   0xA2, 0x78, 0x1B, 0xA3, 0x68, 0xA3, 0x68, 0x5A, 0xA3, 0x68, 0x46, 0x5F, 0x57, 0x52, 0x9D, 0x9A,
+   0x53, 0x9C, 0x89, 0x67, 0x9C, 0x89, 0x6B, 0x55, 0x5A, 0x54, 0x5A, 0x5E, 0x6D, 0x5E, 0xA2, 0x87,
+   0x5A, 0x55, 0xC0, 0x7E, 0x6F, 0x62, 0x7A, 0xC0, 0x05, 0x7B, 0x77, 0xC0, 0x76, 0x66, 0x21, 0x66,
+   0x7E, 0xA3, 0x88, 0x7E, 0x6D, 0xA3, 0x88, 0xA2, 0x87, 0x7E, 0x5A, 0xA3, 0x97, 0xC0, 0x55, 0xA2,
+   0x88, 0x01, 0x6F, 0x7E, 0x01, 0xC0, 0x7F, 0xC1, 0x08, 0x03, 0x3B, 0x2F, 0x3B, 0xC0, 0x66, 0x31,
+   0x29, 0x66, 0x51, 0x1C, 0x24, 0x66, 0x1C, 0xC0, 0x66, 0x24, 0x1C, 0x24, 0xC0, 0x29, 0x36, 0x31,
+   0x03, 0x34, 0x7E, 0xA2, 0x77, 0x7A, 0x0E, 0x7E, 0xC0, 0x7E, 0x65, 0x7F, 0x12, 0x1A, 0xC0, 0x03,
+   0x15, 0xA2, 0x86, 0x12, 0x79, 0x9F, 0xB9, 0x71, 0x9D, 0xB9, 0x9D, 0xB9, 0x9D, 0xB9, 0x76, 0x9D,
+   0xA9, 0x7A, 0x61, 0x7E, 0xC0, 0x66, 0x22, 0xC0, 0x6E, 0x38, 0x35, 0x37, 0xA2, 0x68, 0x1B, 0x2E,
+   0x01, 0x4E, 0x0E, 0x1A, 0x16, 0x09, 0x57, 0x36, 0x10, 0x57, 0x3D, 0x51, 0x56, 0x55, 0x6E, 0x14,
+   0x5D, 0xC0, 0x6E, 0x59, 0x07, 0x0C, 0x65, 0x0C, 0x7A, 0x52, 0x76, 0xC0, 0x77, 0x7A, 0x6B, 0x12,
+   0x66, 0x7F, 0xA2, 0x88, 0x3D, 0xC0, 0xA2, 0x87, 0xA2, 0x87, 0xA3, 0x87, 0x36, 0xC0, 0x3B, 0xA3,
+   0x87, 0x69, 0x7E, 0x7F, 0x0E, 0x16, 0xC0, 0x66, 0x16, 0x6E, 0x16, 0xC1, 0x0E, 0x1D, 0x09, 0x15,
+   0x66, 0x3C, 0x5A, 0x34, 0x3B, 0x03, 0x9D, 0x89, 0x36, 0xC4, 0x51, 0x6F, 0x3B, 0x36, 0x03, 0xC0,
+   0x6E, 0x69, 0x06, 0x09, 0x0E, 0xC0, 0x1E, 0x55, 0x1E, 0x65, 0x1A, 0x51, 0x7F, 0x7E, 0xC0, 0x09,
+   0x11, 0xA2, 0x97, 0x70, 0x3E, 0x76, 0x9D, 0xC9, 0x9B, 0xB9, 0x9F, 0xB9, 0x65, 0x33, 0x76, 0x60,
+   0xC0, 0x25, 0x61, 0x25, 0x14, 0x19, 0xC0, 0x25, 0x5E, 0xA3, 0x78, 0x4E, 0xA2, 0x79, 0x2C, 0x4E,
+   0xA4, 0x67, 0x0C, 0x5E, 0x1E, 0x57, 0x0D, 0x36, 0x29, 0x17, 0x9C, 0x89, 0x67, 0x41, 0x1C, 0x55,
+   0x59, 0xA2, 0x78, 0x6D, 0x5A, 0x00, 0xA2, 0x78, 0xC0, 0x02, 0xA2, 0x98, 0x00, 0xC0, 0x66, 0x7F,
+   0x14, 0x03, 0x0D, 0xC0, 0x21, 0x7E, 0xA2, 0x88, 0xA2, 0x87, 0x7E, 0xA2, 0x77, 0xA2, 0x87, 0xA2,
+   0x87, 0xA2, 0x77, 0x08, 0x09, 0x16, 0x66, 0x1E, 0x55, 0x1E, 0x7A, 0x55, 0x1A, 0x15, 0x55, 0x12,
+   0x1A, 0x12, 0x6E, 0x1E, 0x51, 0x16, 0xC0, 0x56, 0xC1, 0x09, 0x5A, 0x62, 0xC0, 0x39, 0x08, 0x34,
+   0x6B, 0x34, 0x3B, 0x34, 0xC0, 0x08, 0x01, 0x6F, 0x01, 0xA3, 0x88, 0x0E, 0x16, 0x11, 0x1E, 0xC0,
+   0x21, 0x69, 0x55, 0x1A, 0x7A, 0x55, 0x66, 0x7E, 0x1E, 0x15, 0x11, 0x3E, 0x2B, 0x9D, 0xB9, 0x05,
+   0x9F, 0xB9, 0x71, 0x9D, 0xA9, 0x25, 0x65, 0x65, 0x19, 0x69, 0x6F, 0xC0, 0x12, 0x0D, 0x19, 0xC0,
+   0x25, 0x22, 0xA4, 0x67, 0x4F, 0xA4, 0x67, 0xA2, 0x57, 0xA2, 0x68, 0xA2, 0x58, 0x1D, 0x46, 0x6F,
+   0x9D, 0x8A, 0x34, 0x2E, 0x1C, 0x9D, 0x9A, 0x52, 0x9D, 0x99, 0x56, 0x5A, 0x69, 0x55, 0x14, 0x55,
+   0xA2, 0x77, 0x6E, 0x0F, 0x55, 0x0F, 0xC0, 0x66, 0x05, 0x7F, 0x62, 0xA2, 0x98, 0x1C, 0x24, 0xA2,
+   0x88, 0x3D, 0xA2, 0x87, 0x6E, 0x29, 0x69, 0x34, 0x08, 0x01, 0x09, 0x1E, 0x55, 0x7A, 0x0B, 0x1A,
+   0x1D, 0x66, 0x0C, 0xC1, 0x7E, 0x11, 0xC0, 0x56, 0x11, 0x0E, 0x09, 0x1A, 0x12, 0xC1, 0x16, 0x1E,
+   0x41, 0x67, 0x6E, 0x09, 0x01, 0x6E, 0x7F, 0xC1, 0x01, 0x09, 0x15, 0x06, 0x0E, 0x09, 0xA3, 0x88,
+   0x16, 0xC0, 0x1E, 0xC0, 0x17, 0x12, 0x7A, 0x1D, 0x55, 0x11, 0xC1, 0x14, 0x1A, 0x11, 0x9E, 0xB8,
+   0x2B, 0x9C, 0xC9, 0x71, 0x35, 0x33, 0x2A, 0x9D, 0xA9, 0x6E, 0x6E, 0x65, 0x65, 0x12, 0x6E, 0xC0,
+   0x12, 0x0D, 0xC0, 0x19, 0xC0, 0x5A, 0x27, 0xA4, 0x58, 0x08, 0xA4, 0x58, 0xA3, 0x68, 0xA3, 0x67,
+   0x11, 0x1A, 0x0F, 0xA0, 0x8A, 0x9D, 0x8A, 0x9C, 0x89, 0x63, 0x0A, 0x66, 0x38, 0x21, 0x1C, 0x59,
+   0x56, 0x6E, 0x6E, 0x55, 0x69, 0x5A, 0xA2, 0x88, 0x66, 0x7A, 0x14, 0x66, 0x7F, 0x21, 0x1C, 0xA2,
+   0x88, 0x69, 0x3D, 0xA2, 0x87, 0xA3, 0x87, 0xA2, 0x87, 0xA3, 0x87, 0x34, 0xA3, 0x87, 0xA2, 0x97,
+   0xC0, 0x79, 0xC0, 0xA1, 0xA8, 0xC0, 0x0C, 0x65, 0x7A, 0x66, 0x66, 0xC0, 0x7E, 0xC0, 0x55, 0x39,
+   0xA2, 0x87, 0x03, 0x6F, 0xC0, 0x0C, 0x1D, 0x51, 0x1A, 0x15, 0x56, 0xA2, 0x78, 0x12, 0x1E, 0xC0,
+   0x1B, 0x16, 0xC1, 0x56, 0x66, 0x0E, 0x16, 0x0E, 0x16, 0xC0, 0x65, 0x1E, 0x12, 0xC0, 0x1A, 0xC0,
+   0x15, 0x65, 0x11, 0x0C, 0x7E, 0x00, 0x14, 0x0F, 0x11, 0x3E, 0x9D, 0xC9, 0x9C, 0xB9, 0x71, 0x35,
+   0x31, 0x25, 0x60, 0x6E, 0x0D, 0x12, 0x69, 0xA2, 0x78, 0x65, 0x1C, 0x17, 0xC1, 0x12, 0xC0, 0x67,
+   0x25, 0x5A, 0xA3, 0x78, 0x37, 0x16, 0xA3, 0x68, 0x01, 0x0C, 0x09, 0x0A, 0x6F, 0x53, 0x9D, 0x9A,
+   0x9D, 0x8A, 0x9D, 0x9A, 0x9D, 0x9A, 0x9D, 0x99, 0x56, 0x21, 0xC0, 0x55, 0x6E, 0x56, 0x6E, 0xC1,
+   0x65, 0x5A, 0x76, 0x0F, 0x12, 0x66, 0x21, 0x30, 0x69, 0x7E, 0xA4, 0x77, 0x79, 0xA4, 0x77, 0x3B,
+   0x34, 0xA4, 0x87, 0x0E, 0x7D, 0xA1, 0xA9, 0x65, 0x11, 0x7A, 0x66, 0x01, 0xC0, 0x3A, 0x69, 0xC0,
+   0x62, 0x7E, 0x51, 0x2E, 0xC1, 0x2B, 0x6E, 0x6F, 0x32, 0x6F, 0x6E, 0x14, 0x18, 0x09, 0x15, 0xC0,
+   0x5A, 0x66, 0x1E, 0x66, 0x59, 0xC0, 0x16, 0x0A, 0x16, 0x0A, 0x16, 0x1E, 0xC2, 0x21, 0x1A, 0xC0,
+   0x09, 0xC1, 0x0C, 0xC0, 0x7A, 0x00, 0x0F, 0x3E, 0xC0, 0x2B, 0x9E, 0xB8, 0x9B, 0xCA, 0x9D, 0xB9,
+   0x22, 0x75, 0xC0, 0x69, 0x6E, 0x65, 0x1C, 0x69, 0x6E, 0xC0, 0x6F, 0x66, 0x15, 0x66, 0x1C, 0x12,
+   0x6F, 0x19, 0x25, 0x5E, 0xA3, 0x68, 0xA2, 0x58, 0x29, 0x3C, 0x4E, 0xA4, 0x58, 0x56, 0x0E, 0x52,
+   0x36, 0x9D, 0x9A, 0x9D, 0x9A, 0x9D, 0x89, 0x3D, 0x9C, 0x89, 0xC0, 0x6E, 0x55, 0x6E, 0x56, 0x6E,
+   0xC0, 0x51, 0x7A, 0x0F, 0x17, 0x52, 0x7A, 0x21, 0x7A, 0xA2, 0x88, 0xA2, 0x87, 0x6E, 0xA2, 0x87,
+   0xA3, 0x87, 0xA2, 0x87, 0xA4, 0x76, 0x0E, 0x1B, 0x7A, 0x1A, 0x18, 0x60, 0x3E, 0x06, 0x2B, 0x33,
+   0x1D, 0x66, 0x7A, 0xC0, 0x66, 0x65, 0x7F, 0xC0, 0x0A, 0x1B, 0x18, 0xC0, 0xA2, 0x78, 0x33, 0x6B,
+   0xA2, 0x67, 0x39, 0xA2, 0x77, 0x6F, 0x0C, 0x11, 0x09, 0x1A, 0x56, 0x7F, 0x59, 0x1E, 0xC1, 0x55,
+   0x1E, 0xC0, 0x12, 0xC0, 0x17, 0x12, 0x1A, 0x66, 0xC0, 0x7E, 0x11, 0x0C, 0x11, 0x0C, 0x00, 0x03,
+   0xC1, 0x9E, 0xB9, 0x20, 0x9C, 0xB9, 0x35, 0x22, 0x25, 0x69, 0x65, 0xC0, 0xA2, 0x77, 0x6E, 0x26,
+   0x65, 0x6E, 0x6F, 0x1F, 0x26, 0x61, 0x21, 0x0B, 0x6F, 0x67, 0x1E, 0x67, 0x27, 0xA3, 0x68, 0xA2,
+   0x58, 0x18, 0xA4, 0x57, 0x03, 0xA2, 0x59, 0x56, 0xA2, 0x68, 0x9C, 0x8A, 0x67, 0x9B, 0x9A, 0x53,
+   0x52, 0x3D, 0x52, 0x51, 0xC0, 0x6E, 0x5A, 0x55, 0x14, 0x0F, 0xC0, 0x7E, 0x1E, 0x51, 0x7F, 0x65,
+   0x24, 0xC0, 0x3D, 0xA2, 0x87, 0xA2, 0x87, 0xA2, 0x87, 0x36, 0xA3, 0x87, 0xA2, 0x87, 0x0E, 0xA1,
+   0xA7, 0x7E, 0x76, 0x00, 0x06, 0x76, 0x2E, 0x61, 0x7A, 0x72, 0x61, 0x66, 0xC1, 0x7A, 0x03, 0x37,
+   0xC0, 0x08, 0xC0, 0x5E, 0x16, 0x20, 0x1D, 0x2E, 0x3F, 0x3C, 0x6E, 0x5E, 0x00, 0x11, 0xC0, 0x5A,
+   0x6B, 0x1A, 0x12, 0xC1, 0x6E, 0x12, 0xC1, 0x7F, 0x12, 0x65, 0x1A, 0x0E, 0x7F, 0xC0, 0x11, 0x0C,
+   0xC0, 0x7A, 0x00, 0x0F, 0x66, 0x3E, 0x9B, 0xEA, 0x9D, 0xB8, 0x72, 0x9D, 0xB9, 0x25, 0x65, 0xC0,
+   0x64, 0x10, 0x6E, 0x6E, 0xC0, 0xA2, 0x77, 0xC0, 0x6E, 0x24, 0xC0, 0x1F, 0x15, 0x67, 0x0B, 0x6B,
+   0x19, 0xC0, 0xA2, 0x68, 0x3A, 0x0D, 0xA3, 0x58, 0xA3, 0x68, 0x00, 0x09, 0xA2, 0x69, 0x42, 0x52,
+   0x53, 0x9D, 0x9A, 0x9C, 0x9A, 0x52, 0x3D, 0x9D, 0x99, 0xC0, 0x5A, 0x55, 0xC0, 0x5A, 0xC0, 0x65,
+   0x6B, 0xC0, 0x12, 0xC0, 0x21, 0xC0, 0x7F, 0x3D, 0x69, 0xA3, 0x98, 0xA3, 0x87, 0xA3, 0x87, 0x34,
+   0xA3, 0x87, 0xA2, 0x97, 0x1E, 0x75, 0x18, 0x00, 0xA0, 0xA8, 0x9D, 0xA9, 0x72, 0x71, 0x76, 0x08,
+   0x76, 0x35, 0xC0, 0x7E, 0x51, 0x33, 0x55, 0x6F, 0xC0, 0x3A, 0xC0, 0x06, 0x5A, 0x0D, 0x5A, 0xA3,
+   0x79, 0x31, 0x5E, 0x3C, 0x39, 0xA2, 0x77, 0xC0, 0xA2, 0x78, 0x11, 0x09, 0xA2, 0x78, 0x51, 0x1A,
+   0xC0, 0x56, 0xC2, 0x1A, 0x12, 0x1A, 0xC2, 0x7A, 0x18, 0xC0, 0x0C, 0x00, 0x7B, 0x03, 0x3E, 0x03,
+   0xFE, 0xE3, 0x2B, 0x9C, 0xA9, 0x9E, 0xB8, 0x2A, 0x9D, 0xA9, 0x69, 0x6E, 0x17, 0x10, 0xA2, 0x77,
+   0xC0, 0xA2, 0x77, 0x6E, 0x65, 0x29, 0x61, 0x1F, 0xC0, 0x67, 0x10, 0x17, 0x0D, 0x6F, 0xC0, 0xA2,
+   0x68, 0xA4, 0x58, 0xA3, 0x68, 0xA3, 0x58, 0x3C, 0xA3, 0x68, 0x09, 0x5F, 0x0E, 0x01, 0x36, 0x9D,
+   0x8A, 0x62, 0x52, 0x9D, 0x9A, 0x56, 0x65, 0x41, 0xC0, 0x5A, 0x7E, 0x5A, 0x65, 0xA2, 0x88, 0x12,
+   0xC1, 0x7F, 0x30, 0x38, 0x05, 0x6E, 0xA2, 0x87, 0xA3, 0x87, 0x3B, 0x01, 0xA3, 0x98, 0x16, 0xA1,
+   0xA7, 0x15, 0xA0, 0xA7, 0x3E, 0x3F, 0x9C, 0xA8, 0x61, 0x9F, 0xB9, 0x62, 0x3A, 0x62, 0x7A, 0x27,
+   0x7B, 0x22, 0x2A, 0x27, 0xC2, 0x5A, 0x30, 0x3A, 0x37, 0xA3, 0x79, 0x5E, 0xA2, 0x78, 0x1D, 0x5F,
+   0x6E, 0xA3, 0x78, 0x5E, 0x00, 0x6B, 0x11, 0x15, 0x1A, 0x15, 0x55, 0x1A, 0x5A, 0x7B, 0x55, 0x21,
+   0x12, 0xC1, 0x15, 0x1A, 0xC0, 0x09, 0xC0, 0x7F, 0x00, 0xC0, 0x03, 0xC0, 0x3E, 0x14, 0x3A, 0x9D,
+   0xB9, 0x2A, 0x61, 0x65, 0x0B, 0xA2, 0x78, 0x69, 0x6E, 0xA2, 0x77, 0x6E, 0x6E, 0x29, 0xC1, 0x61,
+   0xA1, 0x8A, 0x15, 0x1C, 0x62, 0xC0, 0x6F, 0x67, 0x33, 0xA3, 0x68, 0xA2, 0x57, 0xA3, 0x58, 0x39,
+   0x00, 0xA3, 0x69, 0x5B, 0x0E, 0x53, 0x9C, 0x8A, 0x62, 0x9D, 0x9A, 0x05, 0x9D, 0x89, 0x66, 0x41,
+   0x7F, 0x5E, 0x65, 0x55, 0xA2, 0x88, 0x03, 0x0F, 0x12, 0x0D, 0x6F, 0x1C, 0x29, 0xC0, 0x05, 0xA2,
+   0x77, 0xA3, 0x97, 0x2E, 0x34, 0xA4, 0x87, 0x7D, 0x7E, 0x75, 0x11, 0x3E, 0x71, 0x71, 0x0C, 0x72,
+   0x37, 0x35, 0x33, 0x66, 0x65, 0x25, 0x2A, 0x61, 0xC0, 0x25, 0x2A, 0x51, 0x25, 0x27, 0xA2, 0x78,
+   0x35, 0xC0, 0xA2, 0x68, 0x6E, 0xA2, 0x68, 0xA2, 0x77, 0x4A, 0xA2, 0x78, 0x3C, 0xA2, 0x77, 0x5F,
+   0x5A, 0x09, 0xA2, 0x88, 0x55, 0x15, 0x5A, 0x21, 0x12, 0xC3, 0x6E, 0x12, 0xC0, 0x15, 0x6E, 0x09,
+   0x0E, 0x11, 0x09, 0x0C, 0x00, 0x0C, 0x00, 0x03, 0x3D, 0x25, 0x61, 0x19, 0x6D, 0x0B, 0xA2, 0x78,
+   0x69, 0x1F, 0x6E, 0x6E, 0xC0, 0x65, 0x29, 0xC0, 0x1F, 0x15, 0x10, 0x17, 0x6B, 0x19, 0xC0, 0x22,
+   0x35, 0x08, 0xA4, 0x58, 0x30, 0xA4, 0x68, 0x11, 0x21, 0x42, 0x46, 0x63, 0x9D, 0x9A, 0x9B, 0x9B,
+   0x56, 0x52, 0x52, 0x65, 0x56, 0x0D, 0x5E, 0x66, 0x69, 0xA2, 0x78, 0x03, 0xA2, 0x88, 0x0A, 0x7E,
+   0x1C, 0x69, 0x30, 0x7E, 0x6D, 0xA4, 0x87, 0xA2, 0x87, 0xA3, 0x87, 0xA3, 0x87, 0x7D, 0xA3, 0x87,
+   0x75, 0x75, 0xA1, 0xA8, 0x01, 0x2B, 0x9F, 0xB9, 0x9C, 0xA8, 0x9E, 0xB9, 0x66, 0x75, 0x61, 0x2A,
+   0xC0, 0x25, 0x19, 0x1E, 0x19, 0x66, 0x19, 0xC0, 0x25, 0x22, 0x27, 0x33, 0xA2, 0x78, 0x45, 0xA3,
+   0x78, 0xA2, 0x78, 0x5E, 0xA3, 0x78, 0x5E, 0x4A, 0x3E, 0x00, 0x0C, 0x6F, 0x1A, 0xC1, 0x12, 0x6E,
+   0x12, 0x6F, 0xC5, 0x12, 0xC0, 0x7A, 0x1A, 0xC0, 0x09, 0xC0, 0x18, 0x00, 0x07, 0x06, 0x9D, 0xB9,
+   0x25, 0xC0, 0x65, 0x6E, 0x0B, 0xA3, 0x78, 0x6E, 0x1F, 0xC0, 0x6E, 0x29, 0xC0, 0x24, 0x1F, 0x66,
+   0x66, 0x67, 0x66, 0x66, 0x19, 0xC0, 0x33, 0x3A, 0x0A, 0xA3, 0x68, 0x3C, 0xA3, 0x68, 0xA2, 0x58,
+   0x5B, 0x42, 0x53, 0x36, 0x9D, 0x9A, 0x9C, 0x89, 0x9D, 0x9A, 0x6B, 0x51, 0x55, 0x56, 0x5A, 0x6E,
+   0x65, 0x0F, 0xC2, 0x7F, 0x65, 0x1C, 0xA2, 0x87, 0x38, 0x3D, 0x7E, 0xA2, 0x76, 0xA4, 0x87, 0x2F,
+   0xA2, 0x87, 0xA2, 0x87, 0x7D, 0x7E, 0xA0, 0xA7, 0x71, 0x72, 0x71, 0x16, 0x76, 0x06, 0x71, 0x76,
+   0x2A, 0x25, 0x19, 0xC0, 0x66, 0x19, 0xC0, 0x14, 0x25, 0xC2, 0x2A, 0x38, 0x56, 0x32, 0xA3, 0x78,
+   0x5A, 0xA4, 0x68, 0xA2, 0x77, 0x5E, 0xA2, 0x68, 0x03, 0x00, 0x11, 0x6F, 0x1A, 0x12, 0xC1, 0x6F,
+   0x55, 0x0A, 0xA2, 0x78, 0x66, 0x1E, 0xC0, 0x1B, 0x16, 0x0A, 0x0F, 0x1E, 0x61, 0x12, 0x1A, 0x65,
+   0x6B, 0x65, 0x1D, 0x37, 0x38, 0x9C, 0xA9, 0x25, 0x19, 0x69, 0x0B, 0x10, 0x6E, 0x6E, 0xC0, 0xA2,
+   0x77, 0x6E, 0x24, 0x1A, 0x26, 0x21, 0x10, 0x6F, 0x12, 0x6F, 0x14, 0x22, 0x3A, 0x08, 0xA2, 0x58,
+   0x2B, 0x3E, 0xA4, 0x58, 0x0D, 0x5B, 0x57, 0x3B, 0x9D, 0x9A, 0x9D, 0x9A, 0x9D, 0x9A, 0x9D, 0x89,
+   0x52, 0xC0, 0x5A, 0x55, 0x6E, 0x6E, 0x69, 0x56, 0xC0, 0x14, 0x0F, 0x0A, 0xC0, 0xA2, 0x98, 0x1C,
+   0xA3, 0x88, 0x3D, 0x69, 0x17, 0xA2, 0x87, 0x3B, 0xA2, 0x86, 0xA3, 0x98, 0x64, 0x0E, 0xA0, 0xA8,
+   0x39, 0x2B, 0x71, 0x9C, 0xB9, 0x08, 0x30, 0x65, 0xA0, 0xA9, 0x25, 0x65, 0x66, 0xC1, 0x19, 0x1E,
+   0x19, 0x65, 0x14, 0xC0, 0x2A, 0x22, 0x6E, 0xA2, 0x68, 0x06, 0x5A, 0xA3, 0x68, 0xA2, 0x78, 0x4D,
+   0x3C, 0xA2, 0x77, 0x5A, 0x0C, 0x6E, 0x5F, 0x52, 0x6E, 0x6F, 0xC0, 0x1B, 0x52, 0x7E, 0x0E, 0x7F,
+   0x51, 0x0E, 0x16, 0x1D, 0x16, 0xC0, 0x1E, 0x0A, 0x1E, 0x12, 0x1A, 0xC1, 0x61, 0xFE, 0xEA, 0xAA,
+   0x24, 0x22, 0x19, 0x65, 0xC0, 0x6E, 0xA2, 0x77, 0xC0, 0x15, 0xC0, 0x26, 0x65, 0x26, 0x15, 0x1C,
+   0x66, 0xC0, 0x12, 0x6F, 0x19, 0x31, 0x38, 0xA2, 0x58, 0xA3, 0x68, 0xA3, 0x58, 0xA5, 0x67, 0x0C,
+   0x4A, 0xA1, 0x7A, 0x52, 0x57, 0x9D, 0x9A, 0x9B, 0x9B, 0x9D, 0x9A, 0x51, 0x57, 0x50, 0x21, 0x55,
+   0x59, 0x5A, 0x6E, 0x6E, 0xC1, 0x05, 0x7F, 0x08, 0x7F, 0x67, 0x65, 0x7F, 0xA3, 0x98, 0xA2, 0x87,
+   0xA2, 0x87, 0xA3, 0x87, 0x3B, 0xA4, 0x86, 0x09, 0xA3, 0x97, 0x79, 0x0C, 0x3E, 0x33, 0x2C, 0x9D,
+   0xB9, 0x37, 0x35, 0x71, 0x62, 0x25, 0x61, 0x6E, 0x14, 0x69, 0x19, 0x6E, 0x14, 0x1E, 0x19, 0x25,
+   0x19, 0x2A, 0x4A, 0x35, 0x03, 0x5E, 0xA2, 0x78, 0xA2, 0x67, 0x33, 0x3C, 0xA2, 0x67, 0x0C, 0x5A,
+   0x1A, 0xC0, 0x46, 0x66, 0x6F, 0x52, 0x15, 0x01, 0x10, 0x01, 0xC2, 0x10, 0x15, 0x09, 0xA2, 0x88,
+   0xC0, 0x0E, 0x1B, 0xC0, 0x0F, 0xC0, 0x7A, 0x7F, 0xFE, 0xEA, 0xCA, 0x35, 0x22, 0x19, 0xC1, 0x69,
+   0x6E, 0x6E, 0x65, 0xC1, 0x6E, 0x1C, 0xC0, 0x17, 0x12, 0x1E, 0x14, 0x25, 0x22, 0xA3, 0x78, 0x37,
+   0xA3, 0x68, 0xA5, 0x68, 0xA3, 0x58, 0x00, 0x5F, 0x0F, 0x1D, 0x9C, 0x89, 0x9D, 0x8A, 0x63, 0x9C,
+   0x8A, 0x9D, 0x99, 0x9D, 0x8A, 0x6E, 0xC0, 0x59, 0x5A, 0x59, 0x6E, 0xC0, 0x55, 0xC0, 0x6E, 0x0F,
+   0x0A, 0x66, 0x76, 0x7B, 0x1C, 0x7E, 0xA2, 0x88, 0x6D, 0xA4, 0x87, 0xA2, 0x87, 0x2F, 0xA4, 0x87,
+   0x7D, 0x7D, 0x79, 0x71, 0x3E, 0x33, 0x2C, 0x9B, 0xB9, 0x37, 0x72, 0xA0, 0xA8, 0x2A, 0x19, 0xC4,
+   0x1E, 0x61, 0x6B, 0x19, 0x25, 0x22, 0x36, 0x35, 0xA2, 0x78, 0x5E, 0xA2, 0x68, 0xA2, 0x67, 0x2E,
+   0x2D, 0xA4, 0x68, 0x00, 0x0E, 0x6B, 0x12, 0x6F, 0x42, 0xC0, 0x6B, 0x51, 0x6F, 0x66, 0x3B, 0x7E,
+   0xC0, 0x34, 0x3B, 0xC0, 0x34, 0x3C, 0x08, 0xC0, 0x7D, 0x0E, 0xC1, 0x11, 0x1E, 0x55, 0xFE, 0xDA,
+   0xAA, 0x32, 0x9F, 0xB9, 0x22, 0x19, 0x14, 0xA2, 0x77, 0x65, 0x1E, 0x64, 0xA2, 0x78, 0x66, 0x0B,
+   0x12, 0xC1, 0x1E, 0x19, 0x14, 0x2A, 0x30, 0xA4, 0x67, 0x4E, 0xA4, 0x58, 0x2D, 0xA5, 0x68, 0x1A,
+   0x5B, 0x0E, 0x08, 0x9D, 0x9A, 0x24, 0x9C, 0x8A, 0x3D, 0x9D, 0x99, 0x41, 0x6E, 0x5A, 0x55, 0xA2,
+   0x77, 0xA2, 0x77, 0x55, 0xA2, 0x77, 0xC0, 0x56, 0x7A, 0xC0, 0x14, 0x9D, 0x99, 0xA1, 0xAA, 0x66,
+   0x0D, 0x21, 0x7E, 0x31, 0xA4, 0x87, 0xA2, 0x77, 0x36, 0x10, 0x09, 0x1E, 0x74, 0x0C, 0x9F, 0xB8,
+   0x2B, 0x9D, 0xB9, 0x9E, 0xB9, 0x71, 0x75, 0x72, 0x2A, 0x25, 0x19, 0x66, 0x19, 0x6E, 0xC0, 0x19,
+   0x14, 0x19, 0xC0, 0x5A, 0x22, 0xA3, 0x78, 0x5F, 0xA2, 0x67, 0x5A, 0x18, 0x26, 0xA2, 0x77, 0xA2,
+   0x58, 0x0C, 0x0E, 0x5B, 0x56, 0x6F, 0x09, 0x15, 0x56, 0x66, 0x2F, 0x6B, 0xC0, 0x56, 0x7A, 0x56,
+   0xC1, 0x69, 0x36, 0x6E, 0xC1, 0x34, 0x03, 0x3C, 0x15, 0xC0, 0x69, 0x16, 0xFE, 0xDA, 0xEA, 0x72,
+   0x35, 0x71, 0x25, 0xC0, 0x14, 0x1E, 0x61, 0x6E, 0x0D, 0x1E, 0x12, 0x1E, 0x19, 0x0D, 0x25, 0x2A,
+   0x27, 0x35, 0x0B, 0xA3, 0x58, 0x1D, 0xA5, 0x58, 0xA2, 0x68, 0xA2, 0x68, 0x9E, 0x69, 0x11, 0x10,
+   0x31, 0x9D, 0x89, 0x9D, 0x9B, 0x9D, 0x9A, 0x24, 0x41, 0x5A, 0x6E, 0x59, 0x5D, 0xA2, 0x77, 0x6E,
+   0x5E, 0x6E, 0x55, 0x7A, 0x11, 0x66, 0x76, 0x66, 0x77, 0x7B, 0x62, 0x21, 0x24, 0xA3, 0x88, 0xA2,
+   0x87, 0xA2, 0x87, 0x2E, 0xA3, 0x97, 0x0E, 0xA2, 0x97, 0x1A, 0x9D, 0xA9, 0x3E, 0x2B, 0x71, 0x9E,
+   0xB9, 0x0B, 0x35, 0x33, 0x27, 0x71, 0x25, 0x19, 0x6E, 0x62, 0x19, 0xC2, 0x25, 0x5A, 0xA3, 0x78,
+   0x3A, 0x37, 0xA4, 0x68, 0x13, 0xA4, 0x67, 0x01, 0x4A, 0xA3, 0x78, 0x1A, 0x56, 0x6B, 0x5E, 0x09,
+   0x08, 0x03, 0x56, 0x36, 0x9D, 0x99, 0x1C, 0xC0, 0x17, 0x55, 0x17, 0x66, 0x17, 0x12, 0x1C, 0x7E,
+   0x15, 0x24, 0x1D, 0x6E, 0x36, 0x03, 0xC0, 0x3C, 0x10, 0x18, 0x9F, 0xB9, 0x0B, 0x35, 0x38, 0x9D,
+   0xA9, 0x25, 0xC0, 0x65, 0x14, 0x69, 0x19, 0x14, 0x1E, 0x14, 0x25, 0x6F, 0x4E, 0x3A, 0xA2, 0x68,
+   0xA3, 0x68, 0xA4, 0x57, 0xA3, 0x68, 0xA2, 0x68, 0x4A, 0xA1, 0x7A, 0x56, 0x9D, 0x8B, 0x9C, 0x9A,
+   0x1C, 0x12, 0x9C, 0x89, 0x52, 0x21, 0x55, 0x5E, 0x00, 0xA2, 0x77, 0x59, 0x5E, 0xA2, 0x77, 0x69,
+   0xA2, 0x78, 0x66, 0xC1, 0x07, 0x7B, 0x9D, 0xAA, 0xA0, 0xA9, 0x14, 0x66, 0x7B, 0x7A, 0xA2, 0x87,
+   0xA2, 0x87, 0xA3, 0x87, 0xA4, 0x87, 0x03, 0xA3, 0x86, 0x7E, 0x79, 0x79, 0x9F, 0xB9, 0x9C, 0xB8,
+   0x72, 0x9D, 0xB9, 0x71, 0x76, 0x9D, 0xB9, 0x7A, 0x9D, 0x98, 0x25, 0x65, 0x25, 0xC0, 0x19, 0x25,
+   0x19, 0x22, 0x27, 0x38, 0x35, 0xA2, 0x67, 0xA3, 0x79, 0x18, 0xA4, 0x67, 0x01, 0x0F, 0x5E, 0x5B,
+   0x12, 0x5F, 0x52, 0x56, 0x67, 0x9D, 0x9A, 0x56, 0x52, 0x17, 0x66, 0x56, 0x66, 0xC0, 0x55, 0x05,
+   0x3D, 0xC0, 0x6E, 0x0A, 0xC0, 0x6E, 0x65, 0x12, 0xA2, 0x87, 0x5A, 0xA3, 0x97, 0xC0, 0x3B, 0xC0,
+   0x29, 0x18, 0x19, 0x3C, 0x32, 0x76, 0x7A, 0x22, 0xC0, 0x25, 0xC1, 0x2A, 0x6F, 0x27, 0x30, 0x32,
+   0xA3, 0x78, 0xA3, 0x78, 0x2C, 0x2B, 0x3E, 0xA3, 0x78, 0x9F, 0x69, 0x6F, 0xA0, 0x7A, 0x9D, 0x8A,
+   0x9D, 0x9A, 0x1C, 0x0A, 0x9D, 0x9A, 0x9D, 0x89, 0x5A, 0x55, 0xA2, 0x66, 0x5E, 0x5D, 0x5D, 0xA3,
+   0x77, 0x6E, 0x5D, 0xC3, 0x7A, 0x9D, 0x9A, 0x7B, 0x72, 0x77, 0x62, 0xA0, 0xAA, 0x7A, 0x7B, 0x7F,
+   0x7D, 0xA4, 0x87, 0xA2, 0x76, 0xA6, 0x86, 0x10, 0x7D, 0x7D, 0x79, 0x71, 0x2D, 0x26, 0x9F, 0xB9,
+   0x9C, 0xA8, 0x0B, 0x35, 0x33, 0x65, 0x7B, 0x25, 0xC1, 0x55, 0x6B, 0x31, 0x33, 0x6E, 0x3A, 0x5F,
+   0xA3, 0x68, 0x18, 0x2B, 0xA2, 0x67, 0x5F, 0xA3, 0x78, 0x5B, 0x5F, 0x52, 0x5F, 0x08, 0x52, 0x9D,
+   0x9A, 0x51, 0x6B, 0x9D, 0x9A, 0xC0, 0x3D, 0x66, 0x65, 0x6B, 0x38, 0x55, 0x24, 0x29, 0xC0, 0x38,
+   0x3D, 0x29, 0x3D, 0x7E, 0xC0, 0xA2, 0x87, 0xC0, 0x1C, 0x7E, 0xA2, 0x87, 0xA2, 0xF2, 0x7A, 0x72,
+   0x16, 0x71, 0x3C, 0x3A, 0xC0, 0x7A, 0x66, 0x51, 0x6F, 0x35, 0xC0, 0x37, 0x08, 0x5F, 0xA3, 0x78,
+   0xA2, 0x67, 0x2D, 0xA4, 0x68, 0x5A, 0xA2, 0x68, 0x1E, 0x09, 0x57, 0x36, 0x9B, 0x9B, 0x9D, 0x89,
+   0x62, 0x29, 0x19, 0x14, 0x55, 0xA2, 0x66, 0xA3, 0x67, 0xA2, 0x76, 0xA2, 0x67, 0x5D, 0x59, 0x6E,
+   0xA2, 0x88, 0x55, 0xC1, 0x77, 0x66, 0x77, 0x14, 0x9D, 0xAB, 0x76, 0x9D, 0xBA, 0xA1, 0x9A, 0x19,
+   0x21, 0xA2, 0x98, 0xA2, 0x86, 0xA5, 0x87, 0x36, 0x08, 0xA2, 0x86, 0x7D, 0xA0, 0xA8, 0x00, 0x76,
+   0x71, 0x18, 0x7A, 0x9D, 0xB9, 0x3A, 0x35, 0x7A, 0x61, 0xC0, 0x7F, 0x66, 0x27, 0x38, 0xC0, 0x3A,
+   0x6F, 0x08, 0xA2, 0x68, 0x2C, 0x3F, 0x32, 0xA4, 0x68, 0x46, 0x15, 0x1E, 0x0E, 0x10, 0x56, 0x9D,
+   0x9A, 0x24, 0x12, 0x5A, 0x9D, 0x9A, 0x66, 0x51, 0x56, 0x24, 0x55, 0x1C, 0x59, 0x1C, 0x55, 0x19,
+   0x1C, 0x21, 0x1C, 0x21, 0x7F, 0x24, 0x29, 0x38, 0xA2, 0x87, 0xC0, 0x6E, 0x17, 0xA9, 0xD0, 0x01,
+   0x2B, 0x2E, 0x18, 0x16, 0x7A, 0x65, 0x66, 0xC0, 0x66, 0x08, 0x5A, 0x7F, 0x5D, 0x18, 0xA2, 0x78,
+   0xA2, 0x67, 0x3E, 0xA2, 0x68, 0x1A, 0x52, 0x5A, 0xA0, 0x7A, 0x34, 0x9D, 0x9B, 0x9C, 0x9A, 0x56,
+   0x38, 0x1C, 0x59, 0x59, 0xA2, 0x67, 0x5D, 0xA2, 0x56, 0xA2, 0x76, 0xA3, 0x67, 0xA2, 0x77, 0xA2,
+   0x66, 0xC0, 0x59, 0x6E, 0xC1, 0x16, 0x20, 0x62, 0x9D, 0xAA, 0xA0, 0xAA, 0x9D, 0xAA, 0x73, 0x9F,
+   0xBA, 0x9D, 0xAA, 0x77, 0x1C, 0xA2, 0x87, 0xA4, 0x87, 0x7E, 0xA4, 0x76, 0xA4, 0x86, 0xA2, 0x76,
+   0xA2, 0x97, 0x0D, 0xA2, 0x97, 0x71, 0x01, 0x2E, 0x72, 0x9D, 0xA9, 0x71, 0x37, 0x35, 0xC0, 0x7A,
+   0x56, 0x65, 0xA3, 0x88, 0x3A, 0x6F, 0x03, 0x5E, 0xA2, 0x78, 0xA2, 0x67, 0xA3, 0x68, 0x39, 0xA3,
+   0x68, 0xA2, 0x78, 0x1A, 0x42, 0x57, 0x56, 0x67, 0x9D, 0x8A, 0x17, 0x52, 0x51, 0x52, 0x66, 0x1C,
+   0x21, 0x5A, 0x65, 0x5A, 0x65, 0xC0, 0xA2, 0x78, 0x08, 0x14, 0x7A, 0x0F, 0x12, 0x6B, 0x12, 0x1C,
+   0x24, 0x29, 0x7F, 0x29, 0xA2, 0x88, 0x7E, 0xFE, 0xBC, 0x4E, 0x76, 0x65, 0x76, 0x30, 0x33, 0x61,
+   0x18, 0xC3, 0x6E, 0x6F, 0x2B, 0x01, 0x3E, 0x00, 0x11, 0x46, 0x5B, 0x0E, 0x10, 0x52, 0x9B, 0x9A,
+   0x9D, 0x9B, 0x36, 0x63, 0x1C, 0x45, 0x14, 0x4D, 0xA2, 0x66, 0xA3, 0x76, 0x4D, 0xA2, 0x66, 0xA2,
+   0x77, 0xA2, 0x66, 0x6E, 0x5E, 0x6E, 0x6E, 0x22, 0x61, 0x6B, 0x7F, 0x20, 0x62, 0x77, 0x9D, 0xBB,
+   0x73, 0x73, 0x9D, 0xBA, 0x72, 0x19, 0x1C, 0x38, 0xA3, 0x87, 0xA3, 0x87, 0xA4, 0x86, 0x10, 0xA2,
+   0x86, 0x7D, 0x75, 0x00, 0xA0, 0xA8, 0x3F, 0x71, 0x9C, 0x98, 0x76, 0x76, 0x66, 0x3A, 0x56, 0x7F,
+   0xC0, 0x6E, 0x03, 0x5E, 0x0A, 0xA3, 0x79, 0x29, 0xA3, 0x68, 0x3E, 0xA3, 0x68, 0x1A, 0x17, 0x16,
+   0x09, 0x57, 0x52, 0x9C, 0x9A, 0x9D, 0x8A, 0x62, 0x9D, 0x89, 0x52, 0x21, 0x51, 0x6E, 0x55, 0x5E,
+   0x6E, 0xC0, 0x6E, 0x59, 0x0F, 0x55, 0x0F, 0x00, 0x0A, 0xC0, 0x62, 0x7F, 0x7E, 0x52, 0x0D, 0x1C,
+   0xC0, 0x7E, 0x7E, 0x1A, 0x61, 0x11, 0x7A, 0x3E, 0x39, 0x3C, 0xC0, 0x30, 0x2B, 0x3C, 0xC0, 0x2D,
+   0x39, 0xA2, 0x77, 0x5A, 0x11, 0x5B, 0x6F, 0x41, 0x57, 0x52, 0x9D, 0x8A, 0x63, 0x9C, 0x8A, 0x9D,
+   0x99, 0x52, 0x1C, 0x1E, 0x44, 0xA3, 0x67, 0x5C, 0xA4, 0x56, 0xA2, 0x66, 0xA2, 0x66, 0x5D, 0xA3,
+   0x77, 0x22, 0x6E, 0x59, 0x65, 0x1D, 0xC0, 0x66, 0x66, 0x22, 0x72, 0x7B, 0x16, 0x9D, 0xBB, 0x9D,
+   0xBA, 0x9E, 0xAB, 0x9F, 0xBA, 0x9D, 0xAA, 0x1E, 0x1C, 0x2C, 0xA3, 0x88, 0xA5, 0x86, 0x2E, 0xA5,
+   0x86, 0xA2, 0x86, 0x75, 0x1A, 0x75, 0x03, 0x61, 0x9F, 0xB9, 0x9D, 0xA9, 0x76, 0x66, 0x61, 0x66,
+   0x7E, 0xC0, 0x00, 0xA2, 0x87, 0x16, 0x1B, 0xA3, 0x78, 0x5F, 0x2D, 0xA2, 0x68, 0xA2, 0x78, 0x1A,
+   0x56, 0x5B, 0x09, 0x53, 0x9D, 0x9A, 0x24, 0x9C, 0x8A, 0x66, 0x29, 0x56, 0x51, 0x5A, 0xA2, 0x77,
+   0x59, 0x59, 0x6E, 0xA2, 0x77, 0x6E, 0x55, 0x6E, 0xC0, 0x6F, 0xC0, 0x05, 0x67, 0x66, 0x7E, 0x77,
+   0x62, 0x7F, 0x17, 0x66, 0x1C, 0x7E, 0xC0, 0xFE, 0xAC, 0x70, 0x65, 0x1A, 0x7A, 0x51, 0x0C, 0x7A,
+   0xC0, 0x55, 0xC0, 0x0F, 0x6E, 0xC0, 0x09, 0xC0, 0x15, 0x1E, 0x56, 0x6B, 0x9D, 0x89, 0x6B, 0x31,
+   0x9D, 0x8A, 0x9C, 0x9A, 0x3D, 0x24, 0x21, 0x45, 0xA2, 0x77, 0x4D, 0xA2, 0x65, 0x4D, 0xA4, 0x66,
+   0xA3, 0x66, 0x5D, 0xA2, 0x67, 0xA2, 0x76, 0x5E, 0x6E, 0xC0, 0x61, 0x6E, 0x16, 0x1B, 0x27, 0x62,
+   0x62, 0x77, 0x72, 0x73, 0x9E, 0xBB, 0x9D, 0xBA, 0x9D, 0xBB, 0x77, 0x9D, 0xBB, 0xA1, 0xA9, 0xA2,
+   0x88, 0x05, 0xA2, 0x87, 0xA3, 0x86, 0x34, 0xA3, 0x97, 0xA2, 0x87, 0xA1, 0xA8, 0x60, 0x14, 0x61,
+   0x72, 0x71, 0x76, 0x51, 0x7E, 0x66, 0x61, 0x6F, 0x1B, 0x20, 0x5F, 0x2E, 0x5E, 0x3E, 0x00, 0x09,
+   0x5F, 0x5A, 0x57, 0x6B, 0x9C, 0x8A, 0x52, 0x9C, 0x9A, 0x05, 0x3D, 0x52, 0x1C, 0x59, 0x45, 0x6E,
+   0xA2, 0x66, 0xA2, 0x77, 0x49, 0xA2, 0x77, 0xA2, 0x77, 0x6E, 0x55, 0xC0, 0xA2, 0x88, 0x55, 0x0C,
+   0x7A, 0x67, 0x7A, 0x67, 0x76, 0x9D, 0x9A, 0xA1, 0xA9, 0x9D, 0xA9, 0x00, 0x7F, 0x7F, 0x1C, 0xB1,
+   0x80, 0x7E, 0xA2, 0x87, 0xC0, 0x1A, 0xC0, 0x66, 0x65, 0x6E, 0x7F, 0xC0, 0x1A, 0xC0, 0x5A, 0x1E,
+   0x56, 0xC0, 0x42, 0x08, 0x3B, 0x2E, 0x9C, 0x9A, 0x9D, 0x9A, 0x3D, 0x30, 0x0D, 0x0F, 0x5D, 0xA3,
+   0x66, 0x4D, 0xA2, 0x66, 0xA5, 0x66, 0xA2, 0x66, 0xA2, 0x66, 0x5D, 0x22, 0x27, 0xC0, 0x65, 0x69,
+   0xC0, 0x6F, 0x1B, 0xC0, 0x27, 0xC0, 0x76, 0x9D, 0xAA, 0x77, 0x73, 0x9C, 0xBB, 0x9D, 0xBA, 0x9E,
+   0xAB, 0x9D, 0xBA, 0x9F, 0xBB, 0xA1, 0xA9, 0x30, 0x3D, 0xA2, 0x86, 0xA3, 0x87, 0x36, 0x10, 0xA2,
+   0x86, 0x1E, 0x60, 0xA1, 0xA8, 0x76, 0x61, 0x3C, 0x2B, 0x29, 0x65, 0x18, 0x2C, 0x1D, 0x2C, 0x29,
+   0xA2, 0x67, 0xA2, 0x78, 0x3E, 0x5E, 0x09, 0x5B, 0x1E, 0x42, 0x52, 0x3B, 0x9D, 0x9A, 0x17, 0x3D,
+   0x38, 0x24, 0x21, 0x45, 0x59, 0xA2, 0x66, 0x5D, 0xA3, 0x78, 0xA2, 0x66, 0x5D, 0x6E, 0x5D, 0xA2,
+   0x87, 0x5E, 0x1B, 0xC0, 0x66, 0x11, 0x16, 0x77, 0x66, 0x07, 0x66, 0xA0, 0xA9, 0x67, 0x05, 0x66,
+   0x0A, 0x7B, 0x12, 0x08, 0x6D, 0x0E, 0x7E, 0x65, 0xA2, 0x88, 0x65, 0x1E, 0x12, 0x1E, 0xC0, 0x0A,
+   0x16, 0xC0, 0x6B, 0x56, 0x56, 0x3B, 0x9D, 0x99, 0x29, 0x9C, 0x9A, 0x52, 0x9D, 0x89, 0x1C, 0x59,
+   0x5A, 0xA2, 0x66, 0x5D, 0xA3, 0x66, 0xA3, 0x66, 0x4D, 0xA4, 0x56, 0xA2, 0x76, 0xA2, 0x67, 0x5D,
+   0x6E, 0x69, 0xC0, 0x65, 0xC0, 0x6E, 0x20, 0x19, 0x14, 0x66, 0x6F, 0x66, 0x7B, 0x9D, 0xAB, 0x9F,
+   0xBA, 0x9D, 0xBB, 0x9D, 0xBB, 0x11, 0x00, 0x77, 0xA1, 0xAA, 0x1C, 0x29, 0xA4, 0x87, 0xA3, 0x87,
+   0x36, 0xA2, 0x86, 0xA2, 0x87, 0xA3, 0x97, 0x65, 0x7A, 0x79, 0x9D, 0xA9, 0x39, 0x7A, 0x3F, 0x61,
+   0xC0, 0x26, 0x33, 0x3F, 0x5E, 0x3E, 0x6F, 0x11, 0x56, 0x12, 0x5B, 0x0E, 0x08, 0x36, 0x52, 0x9C,
+   0x9A, 0x9C, 0x89, 0x38, 0x24, 0x46, 0x59, 0xA2, 0x66, 0x49, 0xA3, 0x76, 0xA3, 0x67, 0x5D, 0xA3,
+   0x77, 0x5D, 0x5D, 0xC0, 0xA2, 0x77, 0x18, 0x69, 0xC0, 0xA2, 0x88, 0x18, 0x7A, 0x77, 0x66, 0x66,
+   0x73, 0x62, 0x9F, 0xBA, 0x67, 0x72, 0x77, 0x62, 0x77, 0xAE, 0x93, 0x7E, 0x0D, 0x65, 0x7E, 0xC0,
+   0x0E, 0x7E, 0x66, 0x16, 0x09, 0x0E, 0x6B, 0x0D, 0x08, 0x3B, 0x36, 0x29, 0x9C, 0x99, 0x52, 0x31,
+   0x56, 0x52, 0x45, 0xA2, 0x77, 0x59, 0xA3, 0x66, 0xA2, 0x66, 0x07, 0xA5, 0x66, 0x4C, 0xA3, 0x67,
+   0xA2, 0x77, 0x22, 0x6D, 0xC0, 0x65, 0x20, 0xC0, 0x61, 0xA2, 0x77, 0xC0, 0x0F, 0x14, 0xC1, 0xA1,
+   0x8A, 0x62, 0x72, 0x73, 0x9D, 0xBB, 0x0C, 0x9D, 0xBB, 0x9D, 0xCB, 0x9F, 0xBB, 0x76, 0x21, 0x38,
+   0xA2, 0x87, 0xA4, 0x76, 0xA2, 0x87, 0x34, 0x15, 0x68, 0xA1, 0xA8, 0x69, 0x7A, 0x71, 0x7F, 0x39,
+   0xC0, 0x30, 0x3C, 0x6E, 0xC1, 0x5A, 0xA3, 0x78, 0x56, 0x5F, 0x12, 0x5B, 0x56, 0x9D, 0x9A, 0x2F,
+   0x9D, 0x9B, 0x17, 0x3D, 0x51, 0x52, 0x59, 0x5E, 0x5D, 0xA2, 0x56, 0xA2, 0x66, 0xA3, 0x77, 0x11,
+   0x6E, 0xA3, 0x66, 0x18, 0xA3, 0x77, 0x69, 0x6E, 0x51, 0x1D, 0x25, 0x22, 0x20, 0x66, 0x6B, 0x76,
+   0x62, 0x7B, 0x9D, 0xAA, 0x9D, 0xBB, 0x77, 0x76, 0x73, 0x77, 0x0A, 0xAB, 0xC6, 0x5A, 0x3B, 0x03,
+   0xC0, 0x08, 0x0D, 0xC0, 0x10, 0x0D, 0x10, 0x03, 0x08, 0x03, 0x2E, 0x61, 0x57, 0x9D, 0x99, 0x05,
+   0x29, 0x6B, 0x21, 0x56, 0x59, 0xA2, 0x66, 0x02, 0xA4, 0x66, 0x4C, 0xA4, 0x55, 0x20, 0xA2, 0x56,
+   0x27, 0xA2, 0x66, 0x65, 0x69, 0xC0, 0x66, 0x69, 0xC0, 0x66, 0x08, 0xC0, 0x14, 0x6F, 0x69, 0x1B,
+   0x27, 0x62, 0x7B, 0x9D, 0xBA, 0x9D, 0xBB, 0x9D, 0xBB, 0x9D, 0xBB, 0x9C, 0xCB, 0x73, 0x77, 0x7A,
+   0x38, 0xA2, 0x87, 0x17, 0xA3, 0x87, 0x3B, 0x10, 0x0E, 0x1E, 0x61, 0xA2, 0x97, 0x61, 0x7A, 0x65,
+   0x3E, 0x39, 0xC1, 0x3E, 0x0F, 0x00, 0x5F, 0x1A, 0x56, 0x5A, 0x53, 0x56, 0x63, 0x29, 0x17, 0x9B,
+   0x9A, 0x38, 0x21, 0x0A, 0xA2, 0x77, 0x4D, 0xA3, 0x76, 0x4D, 0xA4, 0x55, 0x5D, 0xA4, 0x66, 0x48,
+   0x27, 0x54, 0x6E, 0x6E, 0x20, 0x1B, 0xC0, 0x20, 0x6B, 0x1B, 0x6B, 0x62, 0x7E, 0x63, 0x72, 0x7B,
+   0x73, 0x72, 0x9C, 0xAA, 0x77, 0x73, 0x77, 0x17, 0x24, 0x29, 0x69, 0x36, 0x55, 0x3B, 0x2F, 0xA2,
+   0x88, 0x3B, 0x36, 0x2E, 0x29, 0xC0, 0x24, 0x17, 0x52, 0x31, 0x3D, 0x9D, 0x99, 0x56, 0x45, 0x69,
+   0x4D, 0xA4, 0x66, 0x49, 0x07, 0xA4, 0x66, 0xA2, 0x55, 0xA2, 0x77, 0xA3, 0x67, 0x5D, 0x69, 0x6E,
+   0x61, 0xA2, 0x77, 0x08, 0x6F, 0xC0, 0x0F, 0xC0, 0x14, 0x08, 0x0F, 0x14, 0xC0, 0xA1, 0x8A, 0x62,
+   0x13, 0x73, 0x9F, 0xCA, 0x9D, 0xBB, 0x0C, 0x9E, 0xBA, 0x9E, 0xBB, 0x62, 0x21, 0x7E, 0xA3, 0x98,
+   0x17, 0xA2, 0x76, 0xA5, 0x97, 0x10, 0x09, 0xA2, 0x87, 0x12, 0x7E, 0x61, 0x7A, 0xC0, 0x7A, 0x65,
+   0xC0, 0x00, 0x0F, 0x5E, 0x5A, 0x1A, 0x12, 0x56, 0x5B, 0x01, 0x2F, 0x53, 0x52, 0x9B, 0x9A, 0x52,
+   0x52, 0x5E, 0x40, 0xA2, 0x66, 0xA4, 0x66, 0xA1, 0x56, 0xA4, 0x66, 0xA2, 0x55, 0xA3, 0x77, 0x5D,
+   0x1D, 0x27, 0x20, 0xC2, 0x65, 0x20, 0xC0, 0x14, 0x6B, 0x65, 0x27, 0x61, 0x18, 0x72, 0xA1, 0x9A,
+   0x9D, 0xBA, 0x73, 0x72, 0x9D, 0xAB, 0x9F, 0xBA, 0x9D, 0xAA, 0xA4, 0xDA, 0x17, 0x1F, 0x5A, 0x69,
+   0xA2, 0x88, 0x65, 0x2E, 0x29, 0xC0, 0x66, 0xC0, 0x1C, 0x17, 0xC0, 0x9D, 0x9A, 0x31, 0x38, 0x21,
+   0x66, 0x59, 0x55, 0xA2, 0x67, 0xA2, 0x67, 0x5C, 0xA3, 0x67, 0xA3, 0x66, 0xA2, 0x66, 0x27, 0x58,
+   0xA2, 0x67, 0x6D, 0xC0, 0x0F, 0xC0, 0xA2, 0x77, 0x9D, 0xA9, 0xC1, 0x0F, 0xC0, 0x6E, 0xC0, 0x19,
+   0xC0, 0x20, 0x62, 0x22, 0x72, 0x77, 0x9C, 0xBB, 0x9C, 0xBB, 0x9E, 0xBA, 0x9D, 0xBB, 0x73, 0x12,
+   0x66, 0xA2, 0x98, 0x31, 0xA4, 0x87, 0xA3, 0x87, 0xA4, 0x76, 0xA2, 0x87, 0x0E, 0x7E, 0x79, 0x65,
+   0x7E, 0x7A, 0x7A, 0x51, 0x14, 0x56, 0x14, 0x11, 0xC0, 0x5B, 0x5E, 0x6B, 0x9D, 0x8A, 0x6F, 0x3B,
+   0x9D, 0x99, 0x53, 0x9C, 0x9A, 0x9D, 0x89, 0x66, 0x45, 0x55, 0xA3, 0x67, 0x4C, 0xA5, 0x66, 0x4C,
+   0xA5, 0x56, 0xA2, 0x66, 0x1B, 0x1D, 0xA2, 0x77, 0x64, 0x66, 0xA2, 0x77, 0x14, 0xC0, 0x19, 0x0F,
+   0x14, 0xC1, 0x6F, 0xC0, 0x62, 0x6F, 0x9D, 0xAA, 0x76, 0x73, 0xA0, 0xAA, 0x9C, 0xAA, 0x73, 0x9D,
+   0xBA, 0x77, 0xA2, 0xEB, 0x59, 0x7F, 0xC0, 0xA2, 0x87, 0xC1, 0xA2, 0x87, 0x1C, 0x61, 0x5A, 0x6B,
+   0x7A, 0x0A, 0x05, 0x31, 0x30, 0x51, 0xC0, 0x5E, 0x59, 0x55, 0xA3, 0x77, 0x4D, 0xA2, 0x66, 0xA3,
+   0x77, 0xA2, 0x55, 0xA3, 0x77, 0xA2, 0x66, 0x18, 0x27, 0x65, 0xC0, 0x6E, 0x61, 0x6E, 0x61, 0x6E,
+   0x03, 0xC1, 0x14, 0x08, 0x0F, 0x14, 0x20, 0x27, 0x1D, 0x77, 0x9D, 0xBA, 0x11, 0x9E, 0xBA, 0x9D,
+   0xBC, 0x9C, 0xAA, 0x05, 0x77, 0x21, 0x29, 0xA3, 0x98, 0x17, 0x2E, 0xA2, 0x87, 0x10, 0x6D, 0xA2,
+   0x87, 0x79, 0x76, 0x1A, 0x61, 0x7E, 0xC0, 0x66, 0x11, 0x6B, 0x59, 0x15, 0x5A, 0x5A, 0x67, 0x56,
+   0x5B, 0x9B, 0xAB, 0x9D, 0x8A, 0x9D, 0x9A, 0x3D, 0x9D, 0x99, 0x41, 0xA2, 0x77, 0x4D, 0x5D, 0xA3,
+   0x56, 0xA2, 0x66, 0xA5, 0x55, 0xA2, 0x66, 0x22, 0x1D, 0x6D, 0x20, 0x61, 0x6E, 0xC0, 0x08, 0xC0,
+   0x14, 0x0F, 0x14, 0x0F, 0xC0, 0x14, 0x20, 0xC0, 0x1B, 0x1D, 0x72, 0x73, 0x9D, 0xAA, 0x9F, 0xBB,
+   0x73, 0x9C, 0xAA, 0xA0, 0xA9, 0x3D, 0xC0, 0xA2, 0x87, 0x36, 0x05, 0x0A, 0x69, 0x7F, 0x5A, 0x12,
+   0x0A, 0xC0, 0x05, 0xC0, 0x3D, 0x30, 0x21, 0x0D, 0x21, 0x41, 0xA2, 0x77, 0x59, 0xA2, 0x66, 0x5D,
+   0x16, 0xA2, 0x66, 0x25, 0x4C, 0xA3, 0x77, 0x1D, 0x69, 0x20, 0x65, 0xC0, 0x66, 0x14, 0x08, 0x66,
+   0x0F, 0xC0, 0x03, 0x0F, 0x08, 0x14, 0xC0, 0x1B, 0x27, 0x9D, 0xAA, 0x25, 0x9C, 0xAA, 0x9D, 0xBB,
+   0x9C, 0xBB, 0x05, 0x9E, 0xBB, 0x62, 0xA0, 0xA9, 0x21, 0x29, 0xA4, 0x87, 0xA2, 0x87, 0xA3, 0x87,
+   0x34, 0x01, 0x09, 0xA2, 0x87, 0x79, 0x1A, 0x15, 0x7A, 0x55, 0x7A, 0x09, 0x18, 0x0E, 0x1A, 0xC0,
+   0x5B, 0x16, 0x56, 0x3C, 0x2F, 0x29, 0x17, 0x0A, 0x38, 0x24, 0x45, 0x45, 0xA2, 0x66, 0xA3, 0x56,
+   0xA3, 0x66, 0xA4, 0x55, 0xA2, 0x66, 0x22, 0x1D, 0x1B, 0x20, 0x14, 0xC0, 0x03, 0xC2, 0x6F, 0x03,
+   0x0F, 0xC0, 0x19, 0xC0, 0x14, 0xC0, 0x27, 0x66, 0x13, 0x9F, 0xBA, 0x73, 0x73, 0x9C, 0xBB, 0x72,
+   0x9F, 0xAB, 0x38, 0xC1, 0x69, 0x36, 0x3D, 0x7E, 0x36, 0xC0, 0xA2, 0x88, 0x05, 0x3D, 0x61, 0x38,
+   0x24, 0x30, 0x21, 0x66, 0x5E, 0x59, 0x59, 0x5D, 0xA3, 0x77, 0x5E, 0xA2, 0x65, 0xA2, 0x66, 0xA3,
+   0x67, 0x5D, 0xA4, 0x66, 0x1D, 0x22, 0x64, 0x6E, 0xC0, 0x19, 0x0F, 0x14, 0xC3, 0x0F, 0x20, 0x19,
+   0x20, 0x66, 0x22, 0x73, 0x16, 0x9D, 0xAA, 0x9F, 0xCB, 0x9C, 0xAB, 0x9D, 0xBB, 0x9F, 0xBA, 0x9D,
+   0xBA, 0xA1, 0x9A, 0x24, 0x31, 0xA3, 0x88, 0xA4, 0x86, 0x2E, 0x34, 0xA3, 0x87, 0x0E, 0xA2, 0x97,
+   0x65, 0x1A, 0x7A, 0xC0, 0x65, 0xC0, 0x09, 0x6E, 0x09, 0x1A, 0x12, 0x5A, 0x6F, 0x06, 0x67, 0x3B,
+   0x9B, 0x9B, 0x0A, 0x3D, 0x9C, 0x89, 0xC0, 0x03, 0x5E, 0xA3, 0x66, 0x0C, 0xA3, 0x65, 0xA5, 0x56,
+   0x4D, 0xA2, 0x66, 0x27, 0x14, 0x66, 0xC0, 0x14, 0x0F, 0x61, 0x6E, 0xC0, 0x3E, 0xC0, 0x0F, 0x03,
+   0x14, 0xC0, 0x6E, 0x6B, 0x66, 0x62, 0x77, 0x73, 0x73, 0x0A, 0x9D, 0xAB, 0x9F, 0xBB, 0x72, 0x30,
+   0x69, 0xC0, 0x3D, 0x31, 0xC0, 0x3D, 0x31, 0xC0, 0x3D, 0x6E, 0x3D, 0x38, 0x29, 0x1C, 0x7E, 0x21,
+   0x55, 0x6E, 0x55, 0xA2, 0x67, 0x6E, 0xA2, 0x66, 0x5D, 0x4D, 0xA4, 0x66, 0xA2, 0x66, 0xA3, 0x67,
+   0x59, 0xA2, 0x66, 0x69, 0x6E, 0x69, 0xC0, 0x66, 0x14, 0xC0, 0x0F, 0x69, 0x19, 0x14, 0x0F, 0x14,
+   0xC0, 0x20, 0x6B, 0x18, 0x73, 0x72, 0x9D, 0xBB, 0x9E, 0xBB, 0x9D, 0xBA, 0x9D, 0xBB, 0x9F, 0xBB,
+   0x62, 0x21, 0x29, 0x31, 0xA5, 0x87, 0xA2, 0x87, 0xA2, 0x76, 0xA5, 0x87, 0x7E, 0x7D, 0x1E, 0x7A,
+   0x65, 0x0E, 0x7F, 0x65, 0xC0, 0x09, 0x1D, 0x1A, 0x15, 0x5A, 0x1E, 0x42, 0x66, 0x34, 0x2E, 0x9D,
+   0x9A, 0x52, 0x29, 0xC0, 0x41, 0x5A, 0x00, 0xA3, 0x66, 0x07, 0xA4, 0x55, 0xA2, 0x66, 0x22, 0x5D,
+   0x69, 0x6D, 0x19, 0x08, 0x6B, 0x3E, 0xC1, 0x03, 0x6B, 0x3E, 0x0F, 0x03, 0x0F, 0x19, 0x20, 0x0F,
+   0xA2, 0x79, 0x1D, 0x72, 0x73, 0x9E, 0xBA, 0x9D, 0xAB, 0x9E, 0xBB, 0x9D, 0xBA, 0x00, 0xA0, 0xDB,
+   0xC1, 0x38, 0xC1, 0x3D, 0xC0, 0x2C, 0x31, 0xC0, 0x29, 0x38, 0x24, 0xC0, 0x5A, 0x12, 0x56, 0x6E,
+   0x6E, 0x5D, 0x00, 0xA2, 0x66, 0xA3, 0x77, 0x07, 0xA3, 0x77, 0xA2, 0x66, 0xA3, 0x77, 0x48, 0xA3,
+   0x78, 0x58, 0xC0, 0x20, 0x66, 0x20, 0x65, 0x6E, 0x62, 0x19, 0xC0, 0x14, 0x20, 0xC0, 0x6B, 0x66,
+   0x62, 0x77, 0x73, 0x9E, 0xBA, 0x9C, 0xAA, 0x9F, 0xBB, 0x9B, 0xBB, 0x9F, 0xBA, 0x72, 0x7B, 0x24,
+   0x31, 0xA3, 0x88, 0x1C, 0xA3, 0x97, 0x34, 0x06, 0x0E, 0x79, 0xA2, 0x87, 0x15, 0xC0, 0x65, 0xC0,
+   0x7A, 0x6E, 0xC0, 0x6B, 0x6E, 0x46, 0x1E, 0xC0, 0x9D, 0x8A, 0x5B, 0x62, 0x2E, 0x9C, 0x9A, 0x36,
+   0x38, 0x9D, 0x89, 0x5E, 0x59, 0xA2, 0x56, 0xA3, 0x66, 0xA3, 0x66, 0xA4, 0x55, 0x4C, 0xA3, 0x66,
+   0x22, 0x69, 0x6E, 0x08, 0x0F, 0x65, 0x3E, 0xC0, 0x66, 0xC0, 0x3E, 0xC0, 0x0F, 0xC0, 0x6E, 0x19,
+   0x20, 0xC0, 0x1B, 0x9F, 0xAB, 0x9D, 0xAA, 0x9F, 0xBA, 0x9D, 0xBB, 0x9D, 0xBB, 0x73, 0x9D, 0xCB,
+   0x9D, 0xAA, 0x24, 0xC1, 0x29, 0xC0, 0x38, 0x3D, 0x65, 0x38, 0xC0, 0x29, 0x38, 0x29, 0x30, 0x1C,
+   0x21, 0x51, 0x6E, 0x56, 0x6E, 0x58, 0x5E, 0xA3, 0x67, 0x6D, 0x4D, 0xA2, 0x76, 0xA3, 0x67, 0x5D,
+   0xA3, 0x77, 0x59, 0xA3, 0x77, 0x5A, 0xA2, 0x77, 0x61, 0xA2, 0x77, 0x66, 0x20, 0xC1, 0x65, 0x1B,
+   0x20, 0x22, 0x1D, 0x76, 0x11, 0x77, 0x9E, 0xBA, 0x9C, 0xAB, 0x73, 0x73, 0x9E, 0xBA, 0x77, 0x12,
+   0x1C, 0x24, 0xA5, 0x87, 0x17, 0x2E, 0x3B, 0xA2, 0x87, 0x09, 0xA2, 0x87, 0x79, 0xC0, 0x15, 0x79,
+   0x6F, 0x11, 0x66, 0xC1, 0x1D, 0x55, 0x12, 0x66, 0x5E, 0xA0, 0x8A, 0x10, 0x52, 0x9B, 0x9A, 0x17,
+   0x0A, 0x38, 0x9D, 0x88, 0x46, 0x5D, 0xA2, 0x66, 0xA3, 0x56, 0xA5, 0x66, 0xA3, 0x55, 0xA3, 0x66,
+   0x5D, 0x22, 0x64, 0x6E, 0xC0, 0x65, 0x66, 0x66, 0xC1, 0x39, 0x03, 0xC1, 0x0F, 0xA2, 0x77, 0x14,
+   0xC0, 0x27, 0x9D, 0xA9, 0xA0, 0x9A, 0x9E, 0xBA, 0x9C, 0xAA, 0x9E, 0xBB, 0x07, 0x9D, 0xBB, 0xA0,
+   0xA9, 0x77, 0x1C, 0xC0, 0x38, 0x24, 0x29, 0x38, 0x29, 0x2C, 0x38, 0x3D, 0x38, 0x29, 0x24, 0xC0,
+   0x1C, 0xC0, 0x21, 0x51, 0x0A, 0x69, 0x14, 0x00, 0x05, 0xA3, 0x67, 0x6D, 0x5D, 0xA3, 0x67, 0x5D,
+   0xA2, 0x67, 0xA3, 0x77, 0x59, 0x13, 0xA3, 0x87, 0x56, 0x69, 0xA2, 0x78, 0x65, 0x16, 0x1B, 0x16,
+   0x6F, 0x16, 0x67, 0x76, 0x63, 0x76, 0x73, 0x73, 0x9E, 0xBA, 0x73, 0x73, 0x9D, 0xAA, 0x77, 0x1C,
+   0x29, 0x3D, 0xA3, 0x97, 0xA3, 0x87, 0xA3, 0x87, 0x3C, 0x09, 0x6E, 0xA2, 0x97, 0x65, 0x1A, 0x76,
+   0x69, 0x61, 0xA2, 0x88, 0x00, 0x7F, 0x00, 0x0C, 0x5A, 0x6F, 0x5E, 0x52, 0x57, 0x10, 0x52, 0x9C,
+   0x8A, 0x52, 0x9C, 0x9A, 0x30, 0x9D, 0x98, 0x5E, 0x4D, 0xA2, 0x66, 0x07, 0xA4, 0x55, 0xA3, 0x66,
+   0x20, 0x4D, 0x1B, 0x65, 0xA2, 0x78, 0x0F, 0xC2, 0x65, 0x3E, 0x0F, 0x03, 0xC0, 0xA2, 0x78, 0x08,
+   0x19, 0x1B, 0xC0, 0x22, 0x72, 0x9D, 0xBB, 0x73, 0x9E, 0xBA, 0x9C, 0xAB, 0x9E, 0xBA, 0x73, 0x9D,
+   0xAA, 0x7B, 0xA1, 0xA9, 0x21, 0x7A, 0x6E, 0x38, 0x29, 0x38, 0x3D, 0x31, 0x3D, 0x38, 0x3D, 0x62,
+   0x29, 0x24, 0x30, 0x21, 0xC0, 0x0A, 0xC0, 0x6D, 0x5A, 0xA2, 0x67, 0xA2, 0x77, 0x5D, 0x5D, 0x5D,
+   0xA2, 0x76, 0xA3, 0x78, 0x48, 0x6E, 0xA2, 0x67, 0x69, 0xA3, 0x78, 0xC0, 0x1D, 0xC0, 0x7F, 0x65,
+   0x56, 0x27, 0x61, 0x7B, 0x77, 0x9D, 0xAA, 0x9D, 0xAA, 0xA0, 0xAA, 0x9C, 0xAA, 0xA0, 0xA9, 0x0F,
+   0x08, 0xA1, 0x9A, 0x1C, 0x38, 0x3D, 0xA3, 0x97, 0xA2, 0x77, 0x36, 0xA2, 0x76, 0xA3, 0x98, 0x7D,
+   0x69, 0x1A, 0x61, 0x7E, 0x7A, 0x66, 0x51, 0x0F, 0x65, 0x3B, 0x6E, 0x14, 0x09, 0xC0, 0x5F, 0x6F,
+   0x0E, 0x06, 0x63, 0x2E, 0x9B, 0x9A, 0x9D, 0x9A, 0x29, 0x51, 0x5A, 0x05, 0xA3, 0x66, 0xA3, 0x67,
+   0xA2, 0x55, 0xA4, 0x55, 0x13, 0xA2, 0x66, 0xA2, 0x76, 0x69, 0x6E, 0xC1, 0x61, 0xC1, 0x0F, 0xC0,
+   0x69, 0x14, 0xC0, 0x6E, 0x14, 0x16, 0xC0, 0x13, 0x77, 0x9E, 0xBA, 0x9C, 0xBB, 0x73, 0x9E, 0xBA,
+   0x9C, 0xAA, 0xA0, 0xAA, 0x12, 0x21, 0x66, 0x29, 0xC1, 0x38, 0x3D, 0x31, 0xC0, 0x3D, 0x31, 0xC0,
+   0x29, 0xC1, 0x30, 0x21, 0x1C, 0xC0, 0x0D, 0xA2, 0x78, 0x69, 0x14, 0x59, 0xA2, 0x77, 0x59, 0xA2,
+   0x77, 0x5E, 0x48, 0x0C, 0x5D, 0xA2, 0x77, 0x1B, 0x59, 0x6E, 0x5A, 0x20, 0x18, 0x20, 0x66, 0x20,
+   0x1B, 0x11, 0x77, 0x7B, 0x9D, 0xAA, 0x77, 0x9C, 0xBA, 0xA0, 0x9A, 0x00, 0x9F, 0xBA, 0x12, 0x0D,
+   0x24, 0xA4, 0x87, 0x6E, 0xA2, 0x86, 0xA3, 0x87, 0x34, 0xA4, 0x87, 0x7D, 0x69, 0x7A, 0x7A, 0x09,
+   0xA1, 0xA8, 0x61, 0x66, 0x7A, 0x32, 0xA2, 0x88, 0x3E, 0xA2, 0x88, 0x45, 0x14, 0x4A, 0x1A, 0x5B,
+   0x5A, 0x53, 0x9D, 0x9A, 0x22, 0x53, 0x0A, 0x38, 0x9D, 0x89, 0x45, 0xA2, 0x77, 0x48, 0xA4, 0x55,
+   0x0C, 0xA3, 0x66, 0xA4, 0x56, 0x5C, 0xA3, 0x67, 0x69, 0xC0, 0x19, 0x62, 0x69, 0xC0, 0x0F, 0x6E,
+   0x0F, 0x14, 0x08, 0x14, 0x6F, 0xC0, 0x62, 0x27, 0x72, 0x9C, 0xAA, 0x9E, 0xBB, 0x9D, 0xBB, 0x9E,
+   0xBA, 0x9D, 0xBB, 0x9D, 0xAA, 0xA2, 0x99, 0x1C, 0x29, 0x38, 0x29, 0xC0, 0x38, 0x31, 0xC0, 0x3D,
+   0x31, 0x3D, 0x31, 0xA2, 0x78, 0x05, 0x38, 0x3D, 0x29, 0x24, 0x38, 0x29, 0x24, 0x0D, 0x21, 0x1E,
+   0x55, 0x59, 0x59, 0xA3, 0x88, 0x49, 0x6D, 0xA2, 0x67, 0x6D, 0x5E, 0x16, 0x6E, 0x6D, 0x6F, 0x55,
+   0xC0, 0x65, 0x16, 0x25, 0x9D, 0x99, 0x7B, 0x76, 0x11, 0x77, 0x72, 0x62, 0x77, 0x77, 0x7B, 0x21,
+   0x24, 0x3D, 0xA3, 0x97, 0xA3, 0x87, 0xA2, 0x87, 0xA4, 0x76, 0x7E, 0xA2, 0x86, 0x7A, 0x1A, 0x66,
+   0x75, 0x61, 0x06, 0x01, 0x61, 0x6F, 0x2B, 0x30, 0x01, 0x56, 0xA2, 0x77, 0x5A, 0xA2, 0x78, 0x0E,
+   0x57, 0xA2, 0x78, 0x43, 0x08, 0x9D, 0x9A, 0x24, 0x9C, 0x8A, 0x3D, 0x9D, 0x99, 0x41, 0x49, 0xA4,
+   0x66, 0xA2, 0x56, 0xA3, 0x66, 0xA4, 0x55, 0xA2, 0x66, 0xA3, 0x66, 0x49, 0xA3, 0x77, 0x69, 0xC1,
+   0x65, 0x20, 0x69, 0x14, 0x66, 0xC0, 0x20, 0x66, 0x66, 0x1D, 0x62, 0xA0, 0xA9, 0x9D, 0xBB, 0x73,
+   0x9B, 0xCB, 0x9E, 0xAB, 0x9E, 0xBA, 0x72, 0x0D, 0x24, 0x29, 0x3D, 0x33, 0x38, 0x29, 0x7E, 0xA2,
+   0x88, 0x55, 0xC0, 0x0A, 0x36, 0x0A, 0x05, 0x0A, 0x05, 0x02, 0x3D, 0xC0, 0x29, 0x38, 0x1C, 0xA2,
+   0x88, 0x21, 0x1C, 0x59, 0x5A, 0x65, 0x5E, 0xA2, 0x77, 0x59, 0xA2, 0x77, 0x0C, 0x5D, 0x7E, 0x49,
+   0xA2, 0x88, 0x55, 0xA2, 0x88, 0xC0, 0x59, 0x66, 0x07, 0x7B, 0x66, 0x72, 0x7B, 0x62, 0x7B, 0x08,
+   0x17, 0x0D, 0x24, 0xC0, 0x3D, 0xA3, 0x97, 0xA3, 0x77, 0xA3, 0x97, 0xA3, 0x87, 0x15, 0x68, 0xA1,
+   0xA8, 0x7A, 0x09, 0x7A, 0x7A, 0x32, 0x2D, 0x2B, 0x7E, 0x62, 0x6E, 0xC0, 0x2B, 0x3C, 0x01, 0x0F,
+   0x0C, 0x09, 0x12, 0x5A, 0x57, 0x10, 0x36, 0x52, 0x9D, 0x9A, 0x3D, 0x1C, 0x6E, 0x45, 0x5D, 0xA2,
+   0x55, 0xA3, 0x67, 0xA3, 0x66, 0xA4, 0x55, 0xA3, 0x67, 0x5D, 0x1D, 0x69, 0x6E, 0x6E, 0x1B, 0x65,
+   0x20, 0xC1, 0x1B, 0x20, 0x6B, 0x72, 0x62, 0x73, 0x73, 0x11, 0x0C, 0x9F, 0xBA, 0x9C, 0xAA, 0x9F,
+   0xBB, 0x7A, 0x24, 0x38, 0xA3, 0x87, 0x17, 0x9A, 0x8A, 0x31, 0xA2, 0x88, 0x55, 0x6F, 0x0A, 0xC0,
+   0x69, 0x17, 0xC0, 0x0A, 0xC3, 0x05, 0x0A, 0x3D, 0xC0, 0x38, 0x29, 0xC0, 0x1C, 0x0D, 0xC0, 0x59,
+   0xA2, 0x78, 0xC0, 0x59, 0x6E, 0x6E, 0x55, 0xA2, 0x77, 0x5A, 0x69, 0xC0, 0x6E, 0x6B, 0x05, 0x66,
+   0x6B, 0x7A, 0x62, 0x7F, 0x77, 0x7A, 0x0D, 0x1C, 0x24, 0x29, 0xA3, 0x98, 0xA2, 0x76, 0xA4, 0x87,
+   0xA3, 0x87, 0x7D, 0x0E, 0xA2, 0x87, 0x1E, 0x1A, 0x75, 0x7A, 0x72, 0x2D, 0x3A, 0x50, 0x7B, 0x65,
+   0x7A, 0x56, 0xA2, 0x88, 0x1D, 0x26, 0xA3, 0x78, 0x06, 0x5B, 0x5E, 0x09, 0x5F, 0x57, 0x5B, 0x3B,
+   0x9D, 0x9A, 0x08, 0x05, 0x30, 0x21, 0x45, 0x59, 0xA2, 0x66, 0xA4, 0x56, 0xA2, 0x66, 0xA2, 0x55,
+   0xA4, 0x66, 0xA2, 0x66, 0x5D, 0x5E, 0x69, 0x6E, 0x6E, 0x61, 0x20, 0xC0, 0x16, 0xC0, 0x6F, 0x77,
+   0x9D, 0xAA, 0x76, 0x9D, 0xBB, 0x9E, 0xBA, 0x9D, 0xAB, 0x9E, 0xBA, 0x9D, 0xBB, 0x77, 0x21, 0x30,
+   0x79, 0xA4, 0x77, 0xA2, 0x87, 0xA4, 0x86, 0x3D, 0x7E, 0xC1, 0xA2, 0x87, 0x5A, 0x17, 0xC0, 0x08,
+   0x17, 0x6E, 0x17, 0xC0, 0x1C, 0x17, 0xC0, 0x0A, 0x05, 0x36, 0x05, 0x3D, 0x38, 0x55, 0x24, 0xC0,
+   0x56, 0x55, 0x5A, 0xC0, 0x6E, 0x6E, 0x6E, 0x59, 0xC3, 0x00, 0x0F, 0xC0, 0x66, 0x14, 0x66, 0x66,
+   0x21, 0xC0, 0x30, 0x29, 0x36, 0x12, 0x6D, 0x31, 0x6E, 0xA4, 0x86, 0x69, 0xA2, 0x87, 0x7D, 0x75,
+   0x76, 0x76, 0x01, 0x2B, 0x33, 0x9D, 0xA9, 0x7B, 0x65, 0x66, 0xC0, 0x1B, 0xC1, 0xA2, 0x78, 0x26,
+   0xA2, 0x77, 0x3E, 0xA2, 0x78, 0x5F, 0x4A, 0x5A, 0x57, 0x53, 0x36, 0x9D, 0x9A, 0x9C, 0x8A, 0x29,
+   0x1C, 0x59, 0x14, 0x5D, 0xA3, 0x66, 0xA2, 0x56, 0xA2, 0x66, 0xA2, 0x66, 0xA2, 0x66, 0xA2, 0x77,
+   0xA2, 0x67, 0x6D, 0x5E, 0xC3, 0x62, 0x13, 0x7B, 0x72, 0x77, 0x77, 0x9B, 0xBB, 0x9F, 0xBB, 0x9C,
+   0xAA, 0x9F, 0xBA, 0x03, 0x21, 0x1C, 0x3D, 0xA2, 0x87, 0xA3, 0x86, 0x3B, 0xA3, 0x87, 0x0A, 0x6E,
+   0x0A, 0xA2, 0x87, 0xC0, 0x6E, 0x24, 0xC2, 0x6E, 0xC0, 0x24, 0x29, 0xC0, 0x24, 0xC0, 0x1C, 0x17,
+   0x0A, 0xC0, 0x05, 0x3D, 0xC0, 0x38, 0xC0, 0x56, 0x51, 0x21, 0x51, 0xA2, 0x78, 0x51, 0x12, 0x5A,
+   0xC0, 0x7E, 0x03, 0xC0, 0x0F, 0x17, 0x1E, 0x12, 0x21, 0xC0, 0x30, 0x69, 0x38, 0xA3, 0x87, 0x6D,
+   0xA4, 0x87, 0x6E, 0xA3, 0x97, 0x10, 0x0E, 0x7E, 0x1A, 0x66, 0x0C, 0x61, 0x9F, 0xB8, 0x2B, 0x75,
+   0x62, 0x76, 0x65, 0x66, 0x7A, 0x6F, 0x05, 0xC0, 0x16, 0x5A, 0x2C, 0x26, 0x3C, 0xA2, 0x67, 0x0C,
+   0x5E, 0x47, 0x6F, 0x43, 0x9D, 0x9A, 0x9B, 0x9A, 0x53, 0x9C, 0x99, 0x52, 0x21, 0x45, 0x59, 0xA2,
+   0x66, 0xA3, 0x67, 0xA3, 0x66, 0xA2, 0x66, 0x5D, 0xA3, 0x77, 0xA2, 0x66, 0x1D, 0x25, 0x5E, 0xC0,
+   0x66, 0x25, 0x20, 0x6B, 0x9C, 0xA9, 0xA0, 0xA9, 0x9D, 0xAB, 0x9D, 0xBA, 0x9F, 0xAB, 0x72, 0x9D,
+   0xBB, 0x12, 0xC0, 0x30, 0xA3, 0x97, 0x6E, 0x2E, 0x2F, 0xA3, 0x87, 0xA3, 0x97, 0x0A, 0x6E, 0xA2,
+   0x87, 0x66, 0xA2, 0x87, 0x29, 0x2E, 0x61, 0xA2, 0x88, 0x2E, 0x69, 0x36, 0xC0, 0x27, 0x36, 0xC1,
+   0x29, 0x55, 0x29, 0x17, 0x7E, 0x0F, 0x0A, 0x05, 0xC0, 0x38, 0xC0, 0x51, 0xC1, 0x55, 0x21, 0xC0,
+   0x51, 0x7F, 0xC1, 0x21, 0x1C, 0x21, 0x1C, 0xA2, 0x87, 0x7E, 0x3D, 0x0A, 0xC0, 0xA3, 0x87, 0x2E,
+   0x3B, 0xA3, 0x87, 0x7E, 0xA2, 0x86, 0x61, 0xA2, 0x97, 0x0E, 0xA0, 0xA8, 0x03, 0x3C, 0x9D, 0xA8,
+   0x2C, 0x9D, 0xA9, 0x65, 0x08, 0x37, 0xC0, 0x7F, 0xC0, 0x37, 0x6E, 0x5B, 0x6E, 0xA3, 0x78, 0xA3,
+   0x78, 0x2B, 0x39, 0xA3, 0x68, 0x5A, 0xA2, 0x79, 0x5A, 0x42, 0x34, 0x9D, 0x9B, 0x17, 0x9D, 0x9A,
+   0x38, 0x9C, 0x88, 0x12, 0x59, 0xA2, 0x67, 0x5D, 0xA2, 0x66, 0xA3, 0x67, 0x5D, 0xA3, 0x77, 0x5D,
+   0x5E, 0x69, 0x6E, 0xC0, 0x16, 0x66, 0x7F, 0x9D, 0xAA, 0x62, 0x73, 0x73, 0x73, 0x0F, 0x62, 0x12,
+   0x7B, 0x24, 0xA4, 0x87, 0xA4, 0x76, 0x2E, 0xA4, 0x86, 0x15, 0x1E, 0x1A, 0xFE, 0x72, 0xD1, 0x1C,
+   0xC1, 0x2E, 0x7A, 0x55, 0x3B, 0xC1, 0x7E, 0x08, 0x03, 0xC0, 0x34, 0x6F, 0x03, 0x3B, 0x2F, 0x3B,
+   0x2E, 0x22, 0x29, 0x51, 0x7B, 0x17, 0x0F, 0x61, 0x05, 0x3D, 0xC1, 0x51, 0x38, 0x29, 0x24, 0xC1,
+   0x29, 0xC0, 0x7A, 0x3D, 0x69, 0xA2, 0x88, 0x7E, 0x1C, 0xA2, 0x87, 0x3B, 0x03, 0x01, 0x0E, 0x79,
+   0x21, 0x50, 0xA1, 0xA8, 0x76, 0x71, 0x3F, 0x9C, 0xA8, 0x7B, 0x61, 0x9D, 0xA9, 0x3C, 0x7B, 0x61,
+   0xC1, 0x7E, 0x35, 0x06, 0x37, 0xA2, 0x78, 0xA2, 0x78, 0xA3, 0x68, 0x49, 0xA3, 0x79, 0x0F, 0x0C,
+   0x1A, 0x46, 0x0E, 0x9D, 0x9A, 0x3B, 0x1C, 0x9D, 0x9A, 0x52, 0x24, 0x41, 0xA2, 0x77, 0x5A, 0xA2,
+   0x66, 0x5D, 0x4D, 0xA3, 0x77, 0x5D, 0xA2, 0x77, 0x6D, 0x56, 0xC0, 0xA2, 0x77, 0x11, 0x7A, 0x67,
+   0x62, 0x73, 0x77, 0x02, 0x9F, 0xBA, 0x77, 0x0D, 0xA2, 0x88, 0x7E, 0xA4, 0x87, 0x0B, 0xA6, 0x76,
+   0x34, 0xA3, 0x97, 0xA2, 0x86, 0xA0, 0xA8, 0x79, 0xFE, 0x7A, 0xF1, 0x6D, 0xA2, 0x88, 0xC0, 0x36,
+   0x3B, 0x2F, 0x03, 0x59, 0xA2, 0x88, 0x3C, 0x6E, 0x7F, 0x6E, 0x01, 0x10, 0x59, 0x0D, 0x10, 0x0D,
+   0x3C, 0x3B, 0x36, 0xC0, 0x2E, 0x31, 0x52, 0xC0, 0x17, 0xC0, 0x12, 0x0A, 0xC4, 0x05, 0x0A, 0xC0,
+   0x12, 0x17, 0xC0, 0x24, 0x29, 0x3B, 0x03, 0x0D, 0x15, 0x7D, 0x1E, 0x7A, 0x65, 0x7A, 0x70, 0x62,
+   0x75, 0x72, 0x75, 0x9D, 0xBA, 0x61, 0x37, 0x7B, 0x61, 0x7E, 0x51, 0xC1, 0x38, 0x30, 0xA3, 0x78,
+   0xC0, 0x00, 0xA4, 0x67, 0x29, 0x3A, 0xA2, 0x57, 0xA2, 0x68, 0x15, 0x5A, 0x5F, 0x53, 0x9D, 0x9A,
+   0x9B, 0x9B, 0x9D, 0x8A, 0x05, 0x9C, 0x89, 0x56, 0x59, 0x5E, 0x6E, 0x48, 0xA2, 0x67, 0x6D, 0x5D,
+   0xA2, 0x77, 0x5A, 0xA2, 0x77, 0x61, 0xA2, 0x88, 0x0C, 0x66, 0x7B, 0x77, 0x62, 0x9D, 0xBA, 0x7B,
+   0x77, 0x76, 0xA2, 0x88, 0x7E, 0xA3, 0x98, 0xA4, 0x86, 0x2E, 0xA4, 0x86, 0x0E, 0x1E, 0x1A, 0x9F,
+   0xB8, 0x71, 0xFE, 0x83, 0x31, 0x6E, 0xC0, 0x3B, 0xC0, 0x03, 0xC0, 0x10, 0x55, 0x10, 0x0E, 0xC1,
+   0x7F, 0x69, 0x0E, 0xC0, 0x16, 0x0E, 0x09, 0x0E, 0x15, 0x01, 0x08, 0x6E, 0x03, 0x3B, 0xC0, 0x22,
+   0x31, 0x2E, 0x29, 0x52, 0xC0, 0x1F, 0x55, 0x24, 0xC0, 0x1C, 0x24, 0xC0, 0x2E, 0xC0, 0x36, 0x3B,
+   0x01, 0x7F, 0x09, 0x16, 0x1E, 0x65, 0x75, 0x7A, 0x75, 0x76, 0x3A, 0x9D, 0xA8, 0x76, 0x72, 0x60,
+   0x76, 0x35, 0x38, 0x61, 0x6F, 0x61, 0xC0, 0x27, 0x56, 0x33, 0x35, 0x6F, 0x5E, 0xA3, 0x68, 0x2C,
+   0xA2, 0x67, 0xA2, 0x68, 0x4E, 0xA3, 0x79, 0x1A, 0x47, 0x52, 0x53, 0x36, 0x17, 0x66, 0x9C, 0x8A,
+   0x51, 0x45, 0x0F, 0xC0, 0x0A, 0x5D, 0x5E, 0xA2, 0x77, 0x59, 0x6E, 0xC0, 0x6E, 0x0C, 0x7A, 0x6B,
+   0x9D, 0xA9, 0x02, 0x76, 0x9F, 0xBA, 0x66, 0xA1, 0xAA, 0x21, 0x7E, 0xA4, 0x87, 0xA4, 0x86, 0x3B,
+   0xA2, 0x87, 0xA3, 0x97, 0x1E, 0x74, 0x71, 0x01, 0x9D, 0xB9, 0x24, 0xA2, 0x77, 0x36, 0x3B, 0x6E,
+   0x79, 0x10, 0xC0, 0x15, 0x1D, 0x55, 0x69, 0x7F, 0x1E, 0x51, 0xC0, 0x6E, 0x1E, 0xC0, 0x16, 0x66,
+   0x16, 0xC0, 0x0E, 0xC0, 0x52, 0x6E, 0x01, 0x08, 0xC0, 0x66, 0xC0, 0x2F, 0x3B, 0xC0, 0x2E, 0xC0,
+   0x69, 0xC0, 0x3B, 0xC0, 0x34, 0x6E, 0x01, 0x15, 0x0E, 0x16, 0x1E, 0x61, 0x7E, 0x18, 0x65, 0x3E,
+   0x76, 0x26, 0x7A, 0x9D, 0xB9, 0x61, 0x75, 0x7B, 0x35, 0x76, 0x22, 0xA2, 0x88, 0x65, 0x22, 0x7F,
+   0x22, 0xC0, 0x33, 0x30, 0x35, 0x37, 0x14, 0x1B, 0xA3, 0x68, 0x5E, 0xA3, 0x68, 0x0C, 0x4E, 0x1E,
+   0x09, 0x01, 0x27, 0x24, 0x9C, 0x89, 0x52, 0x38, 0x21, 0x56, 0x12, 0x49, 0x6E, 0x5D, 0x02, 0x6D,
+   0xA2, 0x88, 0x55, 0x6B, 0xC0, 0x66, 0x76, 0x7B, 0x7B, 0x9D, 0xA9, 0x12, 0x21, 0x7F, 0x3D, 0x7E,
+   0x24, 0xA2, 0x77, 0xA5, 0x86, 0xA2, 0x96, 0x79, 0x79, 0x71, 0x9E, 0xB9, 0x9E, 0xB8, 0x9C, 0xA9,
+   0xFE, 0x83, 0x50, 0x2E, 0x2F, 0x08, 0x65, 0x0D, 0x09, 0x6E, 0xC0, 0x7E, 0xC0, 0x1E, 0xC0, 0x69,
+   0xC0, 0x7B, 0x51, 0x21, 0x1A, 0x12, 0xC0, 0x56, 0x12, 0x6B, 0x0A, 0xC0, 0x16, 0xC0, 0x0E, 0xC0,
+   0x10, 0x01, 0x10, 0x3C, 0x08, 0x6E, 0x08, 0xC0, 0x0D, 0x08, 0x10, 0x09, 0xC0, 0x0E, 0xA2, 0x87,
+   0x1E, 0xC0, 0x12, 0x15, 0x65, 0x7A, 0x75, 0x2D, 0x2B, 0x71, 0x61, 0x72, 0xA0, 0xA8, 0x06, 0x35,
+   0x7A, 0x61, 0x66, 0x7A, 0xC0, 0x2A, 0x25, 0xC0, 0xA2, 0x78, 0x27, 0x33, 0xA2, 0x77, 0x37, 0x5F,
+   0xA4, 0x67, 0x29, 0x2B, 0x3E, 0xA3, 0x68, 0x15, 0x1E, 0x0E, 0x10, 0x2F, 0x67, 0x9B, 0x9B, 0x56,
+   0x9C, 0x89, 0x30, 0x9D, 0x88, 0x6F, 0x59, 0x59, 0xA2, 0x87, 0x46, 0x69, 0xA2, 0x77, 0x6F, 0x0A,
+   0x7B, 0xC0, 0x62, 0x7B, 0x7A, 0x0D, 0xA2, 0x88, 0x1C, 0xA4, 0x87, 0xA2, 0x87, 0xA3, 0x87, 0xA4,
+   0x86, 0xA4, 0x76, 0x79, 0x1E, 0x15, 0x70, 0x9E, 0xB9, 0x1D, 0x9E, 0xB9, 0x06, 0x36, 0x3B, 0x7E,
+   0x08, 0x0D, 0x09, 0x0E, 0x7E, 0x1E, 0xC0, 0x51, 0x1A, 0x56, 0x15, 0x1A, 0x65, 0x7F, 0x51, 0x15,
+   0x0E, 0x1A, 0xC0, 0x15, 0x12, 0x1A, 0x52, 0x12, 0x1E, 0x16, 0xC1, 0x66, 0x5A, 0xC1, 0x66, 0x0E,
+   0x09, 0x6F, 0x6D, 0x0E, 0x16, 0xC0, 0x1E, 0x12, 0xC0, 0x1A, 0x1D, 0x61, 0x7A, 0x7A, 0x2D, 0xA0,
+   0xA8, 0x9D, 0xA9, 0x1B, 0x62, 0x75, 0x06, 0x3A, 0x38, 0x27, 0x22, 0x25, 0x66, 0x25, 0xC0, 0x2A,
+   0x51, 0x2A, 0x22, 0x5E, 0x35, 0x5A, 0x08, 0xA3, 0x78, 0x1D, 0x3F, 0xA2, 0x68, 0x00, 0xA2, 0x69,
+   0x5F, 0x56, 0x42, 0x03, 0x36, 0x1C, 0x9D, 0x9A, 0x3D, 0x66, 0x51, 0x21, 0x55, 0x5A, 0x69, 0x05,
+   0x6E, 0x55, 0x0A, 0xC1, 0x05, 0x14, 0x0F, 0x12, 0x7B, 0x30, 0xA3, 0x87, 0x7E, 0xA3, 0x87, 0x2E,
+   0xA4, 0x86, 0x09, 0x1E, 0x1A, 0x0C, 0x9D, 0xB9, 0x9D, 0xC9, 0x9D, 0xB9, 0x9D, 0xC9, 0x9D, 0xB9,
+   0x36, 0x2F, 0x03, 0x08, 0x09, 0x0E, 0xA2, 0x88, 0x69, 0x1E, 0x65, 0x66, 0x15, 0x1A, 0x15, 0x7E,
+   0x65, 0xC0, 0x0C, 0xC0, 0x11, 0xC1, 0x56, 0x11, 0x5A, 0x15, 0x0E, 0x1A, 0x0D, 0xA2, 0x88, 0x59,
+   0x1E, 0x66, 0x55, 0x6F, 0x0A, 0x1E, 0x1B, 0x0A, 0xC0, 0x16, 0x69, 0x1E, 0x12, 0xC0, 0x65, 0x0E,
+   0x09, 0x00, 0x7A, 0x76, 0x61, 0x29, 0x61, 0x7A, 0x9D, 0xA9, 0x76, 0x32, 0x35, 0x33, 0x27, 0x66,
+   0x66, 0x20, 0x2A, 0x61, 0x25, 0xC0, 0x2A, 0x6F, 0x45, 0x35, 0xA2, 0x78, 0x5E, 0x5E, 0xA3, 0x68,
+   0x3C, 0x3E, 0xA3, 0x78, 0x15, 0x1E, 0x52, 0x5B, 0x34, 0x67, 0x1C, 0x9D, 0x9A, 0x66, 0x9D, 0x89,
+   0x6B, 0x51, 0x55, 0x5A, 0x6E, 0x65, 0xA2, 0x78, 0x51, 0x6E, 0x14, 0xC0, 0x7A, 0x0A, 0x0D, 0x7E,
+   0x38, 0xC0, 0xA3, 0x87, 0xA2, 0x87, 0x2E, 0xA4, 0x86, 0x7D, 0xA2, 0x86, 0x1A, 0x75, 0x3E, 0x9D,
+   0xC9, 0x9B, 0xC9, 0x06, 0x9D, 0xA9, 0x9D, 0xB8, 0xFE, 0x83, 0x71, 0x2F, 0x08, 0x6E, 0x69, 0xA2,
+   0x97, 0xC1, 0x12, 0x1A, 0xC0, 0x0E, 0x66, 0x0C, 0xC0, 0x7A, 0xC0, 0x51, 0xC2, 0x7E, 0x5A, 0x0C,
+   0x7E, 0x0C, 0x11, 0x09, 0x0E, 0x1A, 0xC0, 0x66, 0x12, 0xC0, 0x66, 0x12, 0x1E, 0x55, 0x12, 0x6E,
+   0x1E, 0x17, 0x21, 0x50, 0x1A, 0x09, 0x0C, 0x14, 0x66, 0x3E, 0x3C, 0x75, 0x76, 0x61, 0x62, 0x9D,
+   0xA9, 0x7A, 0x32, 0x30, 0x24, 0xA1, 0xA9, 0x2A, 0xC1, 0x25, 0xC0, 0x2A, 0x25, 0x22, 0xA2, 0x78,
+   0x6E, 0x32, 0x03, 0x5E, 0x1B, 0xA3, 0x68, 0x3C, 0xA2, 0x67, 0x14, 0x0E, 0x1E, 0x56, 0x52, 0x34,
+   0x67, 0x9D, 0x9A, 0x52, 0x9C, 0x89, 0x67, 0x51, 0x29, 0x56, 0x51, 0xA2, 0x78, 0x55, 0x7E, 0x51,
+   0x17, 0x0F, 0x7A, 0xC0, 0x1C, 0xC0, 0xA2, 0x88, 0x3D, 0x7E, 0xA3, 0x87, 0xA4, 0x76, 0xA3, 0x97,
+   0x6D, 0xA2, 0x87, 0xA2, 0x96, 0x71, 0xA0, 0xA8, 0x9C, 0xB8, 0x18, 0x00, 0x3A, 0x27, 0x25, 0xFE,
+   0x8B, 0x91, 0x6E, 0x03, 0x01, 0x7E, 0x0E, 0x69, 0xA2, 0x98, 0x7A, 0x06, 0x1A, 0x61, 0x0C, 0x14,
+   0x9D, 0x99, 0x7E, 0x39, 0x3E, 0x39, 0xC0, 0x7E, 0xC0, 0x3E, 0x7F, 0x3E, 0x0F, 0x3B, 0x0C, 0xC0,
+   0x04, 0xA2, 0x77, 0x7F, 0x0E, 0x1A, 0x06, 0x6F, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0xC0, 0x15, 0x0E,
+   0xC0, 0x09, 0x0C, 0x3B, 0x3E, 0x39, 0x30, 0x7A, 0x2C, 0x66, 0x9D, 0xA9, 0x7A, 0x61, 0x32, 0x35,
+   0x76, 0xC0, 0x7A, 0x55, 0x62, 0xA2, 0x88, 0x1D, 0x36, 0x27, 0xC0, 0x33, 0x5A, 0xA3, 0x78, 0x5E,
+   0x0A, 0x18, 0xA4, 0x67, 0x3C, 0xA2, 0x67, 0x09, 0x1A, 0x1E, 0x5A, 0x53, 0x34, 0x2E, 0x66, 0x9C,
+   0x9A, 0x05, 0x9D, 0x89, 0x24, 0x29, 0x56, 0x51, 0x6E, 0xC0, 0x56, 0xC0, 0xA2, 0x88, 0x12, 0x6B,
+   0x21, 0xC0, 0x7F, 0x79, 0x3D, 0xA4, 0x86, 0xA2, 0x87, 0xA3, 0x87, 0xA3, 0x87, 0xA3, 0x97, 0x78,
+   0x7A, 0xA0, 0xA7, 0x3C, 0x9D, 0xB9, 0x9D, 0xC9, 0x3A, 0x27, 0x25, 0x65, 0xFE, 0x8B, 0x71, 0x36,
+   0xA2, 0x87, 0x6D, 0x7E, 0xC0, 0x7D, 0xA2, 0x88, 0x7A, 0x1A, 0x0E, 0x0C, 0x14, 0x3B, 0x3E, 0xC0,
+   0x39, 0x2D, 0x7A, 0xA2, 0x88, 0x3C, 0x30, 0x3C, 0x2D, 0xA2, 0x88, 0xC0, 0x5E, 0x3E, 0x3B, 0x0F,
+   0x0C, 0x6E, 0xC0, 0x6F, 0x15, 0x65, 0x15, 0x09, 0x0E, 0x1A, 0x15, 0xC0, 0x09, 0xC1, 0x0C, 0x65,
+   0x3B, 0x3E, 0x01, 0x3C, 0x76, 0x75, 0x18, 0x76, 0x76, 0x65, 0x37, 0x32, 0xA1, 0xA8, 0x62, 0xC1,
+   0x22, 0x27, 0x22, 0xA2, 0x88, 0x33, 0x6E, 0x35, 0x6F, 0x5D, 0xA3, 0x79, 0x16, 0x31, 0x3F, 0x5E,
+   0x00, 0x1D, 0x15, 0x4A, 0x57, 0x10, 0x56, 0x9D, 0x9A, 0x24, 0x17, 0x9C, 0x89, 0x6B, 0x52, 0x65,
+   0x1C, 0x6E, 0x56, 0x69, 0x0D, 0x12, 0x0D, 0x21, 0xC0, 0x1C, 0x30, 0x69, 0x3D, 0xA3, 0x97, 0xA2,
+   0x87, 0xA3, 0x87, 0xA3, 0x87, 0x6D, 0xA3, 0x97, 0xA1, 0xA8, 0x11, 0x76, 0x3A, 0x9C, 0xB8, 0x9D,
+   0xB9, 0x9C, 0xB9, 0x2A, 0x61, 0xC0, 0xFE, 0x83, 0x51, 0x2E, 0xA2, 0x87, 0x03, 0x01, 0x0E, 0x7A,
+   0x1E, 0x21, 0x1A, 0x1D, 0x9D, 0x98, 0x0F, 0x3E, 0xC0, 0x2D, 0xA2, 0x88, 0x61, 0xC0, 0x2B, 0x3A,
+   0xC0, 0x3F, 0x2B, 0x30, 0xC0, 0x39, 0x01, 0x3E, 0x6E, 0x56, 0x6F, 0x00, 0x0C, 0x09, 0x7E, 0x09,
+   0x1D, 0x15, 0x1A, 0xC0, 0x09, 0x1D, 0x11, 0x0C, 0x11, 0x0C, 0x00, 0x03, 0x7A, 0x30, 0x3F, 0x61,
+   0x61, 0x18, 0x75, 0x7B, 0x08, 0x66, 0x7A, 0x66, 0x35, 0x65, 0x6B, 0x29, 0x38, 0xC0, 0x5E, 0x06,
+   0x37, 0xA3, 0x88, 0x46, 0xA2, 0x78, 0xA3, 0x78, 0xA2, 0x67, 0x2D, 0xA3, 0x78, 0x0C, 0x15, 0x21,
+   0x46, 0x0E, 0x57, 0x62, 0x9C, 0x8A, 0x66, 0x9C, 0x8A, 0x36, 0x52, 0x7B, 0x55, 0x1C, 0x6E, 0x1C,
+   0x59, 0x21, 0x12, 0xC0, 0x66, 0x24, 0xC0, 0xA2, 0x88, 0x6E, 0x36, 0x17, 0xA2, 0x87, 0xA2, 0x76,
+   0xA4, 0x87, 0x0E, 0x7D, 0x1A, 0x11, 0x39, 0x2E, 0x9C, 0xB8, 0x37, 0x9F, 0xB9, 0x2A, 0x9D, 0xA9,
+   0x6D, 0x24, 0xA2, 0x77, 0x7E, 0x03, 0xA2, 0x87, 0x6E, 0x68, 0x7E, 0xA1, 0xA9, 0x65, 0x7A, 0x0C,
+   0x7A, 0x3E, 0x7A, 0x2D, 0x3F, 0x2B, 0x7A, 0x6E, 0x2E, 0xC0, 0x26, 0x33, 0x3F, 0x55, 0x6F, 0x01,
+   0xC0, 0x3E, 0x6E, 0x0F, 0x00, 0xA2, 0x88, 0x11, 0x0C, 0x5E, 0x7F, 0x0E, 0x15, 0x0E, 0xC0, 0x1A,
+   0x0E, 0x18, 0x1D, 0x11, 0x14, 0x03, 0x3E, 0xC0, 0x01, 0x30, 0x61, 0x7B, 0x76, 0x1B, 0x19, 0x66,
+   0x51, 0x7A, 0x06, 0x37, 0x06, 0xC0, 0x37, 0x06, 0x03, 0xC0, 0x05, 0xA3, 0x88, 0x1B, 0x5E, 0x26,
+   0x30, 0xA4, 0x68, 0x0C, 0x15, 0x1A, 0x46, 0xA1, 0x8A, 0x9D, 0x99, 0x53, 0x9D, 0x89, 0x24, 0x17,
+   0x9D, 0x99, 0x52, 0x56, 0xC0, 0x66, 0xC0, 0x0D, 0x1C, 0x5A, 0x7E, 0xC1, 0x0D, 0x21, 0x29, 0xC0,
+   0xA3, 0x98, 0x0A, 0x6D, 0xA4, 0x87, 0x03, 0x69, 0xA3, 0x87, 0xA1, 0xA7, 0x1A, 0x0C, 0x2D, 0x9F,
+   0xC9, 0x9C, 0xB9, 0x06, 0x9C, 0xA8, 0x25, 0x61, 0x6D, 0xFE, 0x7B, 0x11, 0x29, 0x36, 0x03, 0x6E,
+   0x09, 0x0E, 0xA2, 0x97, 0xC0, 0x1A, 0x15, 0x0C, 0x7A, 0x61, 0x65, 0x01, 0x30, 0x2B, 0x26, 0x2E,
+   0x66, 0x2E, 0x29, 0x2E, 0x1F, 0x2B, 0x3F, 0x30, 0x2D, 0x39, 0xA2, 0x87, 0x0F, 0x6E, 0xC0, 0x11,
+   0x6F, 0x55, 0x1D, 0x1A, 0x61, 0x1A, 0x15, 0xC0, 0x09, 0x0E, 0x18, 0x0E, 0x09, 0x0C, 0x65, 0x3B,
+   0x39, 0x01, 0x66, 0x30, 0x29, 0x31, 0x9D, 0x99, 0x20, 0x62, 0x65, 0x66, 0x7E, 0xC0, 0x6B, 0x0D,
+   0x05, 0x0A, 0xC0, 0x20, 0x5A, 0x29, 0x33, 0x5E, 0xA2, 0x68, 0x00, 0x09, 0x15, 0x46, 0x6B, 0x56,
+   0x52, 0x6B, 0x36, 0x9D, 0x9A, 0x17, 0x9D, 0x89, 0x3D, 0x66, 0x51, 0x56, 0xC1, 0x21, 0xC0, 0x51,
+   0x1C, 0x21, 0x1C, 0x24, 0xC0, 0x38, 0x02, 0xA2, 0x97, 0xA2, 0x77, 0xA3, 0x87, 0x2F, 0xA3, 0x87,
+   0xA2, 0x87, 0xA1, 0xA7, 0x79, 0x00, 0x9E, 0xB9, 0x29, 0x19, 0x37, 0x9E, 0xB9, 0x2A, 0x61, 0x6E,
+   0xFE, 0x72, 0xB1, 0xA4, 0x86, 0xC0, 0xA4, 0x76, 0x6E, 0xA2, 0x87, 0x7D, 0x7E, 0x65, 0x7A, 0x15,
+   0x65, 0x0C, 0x75, 0x39, 0x3C, 0x2B, 0xC0, 0x7E, 0x1F, 0x29, 0x1D, 0x29, 0x69, 0x33, 0x26, 0x2B,
+   0x04, 0x3C, 0x39, 0x03, 0x0F, 0x55, 0xC0, 0xA2, 0x78, 0x6F, 0x55, 0x1D, 0x1A, 0xC0, 0x51, 0x1A,
+   0xC0, 0x15, 0x1A, 0xC1, 0x15, 0x09, 0xC0, 0x0C, 0x0F, 0xC0, 0x03, 0x76, 0x2D, 0x30, 0x26, 0x1F,
+   0x76, 0xC0, 0x2C, 0x20, 0x52, 0xC1, 0x1B, 0x1D, 0x29, 0x6E, 0x6F, 0x3C, 0x39, 0x03, 0x00, 0xA3,
+   0x79, 0x1A, 0x12, 0x16, 0x52, 0x10, 0x08, 0x36, 0x9D, 0x8A, 0x9D, 0x99, 0x7B, 0x52, 0x9D, 0x89,
+   0xC0, 0x6B, 0x65, 0x45, 0x7B, 0x55, 0x12, 0x7F, 0x0D, 0x1C, 0x69, 0x24, 0xC0, 0x38, 0x6D, 0xA2,
+   0x88, 0xA3, 0x87, 0xA4, 0x86, 0xA2, 0x87, 0x6D, 0xA2, 0x97, 0xA2, 0x86, 0x1D, 0x0F, 0x3C, 0x9C,
+   0xB8, 0x9E, 0xB9, 0x37, 0x9E, 0xB9, 0x2A, 0x25, 0x64, 0x0A, 0x69, 0xA2, 0x88, 0xA3, 0x87, 0x2F,
+   0xA2, 0x88, 0x01, 0xA2, 0x87, 0xA2, 0x97, 0x61, 0x7E, 0x69, 0x0C, 0x75, 0x3E, 0x7A, 0x61, 0x2B,
+   0xC0, 0x2E, 0x51, 0x2E, 0x66, 0x2E, 0x2B, 0x30, 0xC0, 0x3C, 0x01, 0x3E, 0xC0, 0x00, 0xA2, 0x88,
+   0x5A, 0x56, 0xA2, 0x88, 0x09, 0xA2, 0x78, 0x56, 0xC0, 0x7F, 0x0D, 0x12, 0x1E, 0x12, 0x21, 0x1A,
+   0xC0, 0x12, 0x15, 0xC0, 0x7A, 0x1D, 0x0C, 0x0F, 0xC0, 0x3E, 0x7E, 0x01, 0x3C, 0x30, 0xC0, 0x2B,
+   0x7E, 0x2B, 0x33, 0x2B, 0xC0, 0x30, 0x3C, 0x06, 0x0F, 0x0C, 0x11, 0x0E, 0x12, 0x1E, 0x52, 0x56,
+   0x6F, 0x9D, 0x9A, 0x3B, 0x52, 0x17, 0x0A, 0xC0, 0x38, 0x24, 0x56, 0xC0, 0x55, 0xA2, 0x88, 0x55,
+   0x0D, 0xA2, 0x78, 0x12, 0x21, 0x1C, 0x21, 0x1C, 0x24, 0x38, 0x6D, 0x7E, 0xA3, 0x87, 0xA3, 0x88,
+   0x2F, 0xA4, 0x76, 0x7E, 0xA2, 0x97, 0x1A, 0x0C, 0x39, 0x9E, 0xB8, 0x9C, 0xB9, 0x9D, 0xB9, 0x71,
+   0x9E, 0xB9, 0x60, 0xC0, 0x38, 0x05, 0x17, 0xA2, 0x87, 0xA3, 0x87, 0xA2, 0x87, 0xA2, 0x87, 0x15,
+   0x11, 0x6D, 0x1A, 0x65, 0x66, 0xA0, 0xA8, 0x65, 0x66, 0x75, 0x3F, 0x2B, 0xC0, 0x33, 0x2E, 0x26,
+   0x2E, 0x33, 0x30, 0x04, 0x32, 0x39, 0xA3, 0x88, 0x0F, 0x56, 0xA2, 0x77, 0x1D, 0xC0, 0x56, 0x5A,
+   0xC0, 0x1E, 0x55, 0x1E, 0x0F, 0x6B, 0x6E, 0x1E, 0xC3, 0x12, 0x7F, 0xC0, 0x15, 0x0E, 0x09, 0x1D,
+   0x11, 0x00, 0x14, 0x9D, 0x99, 0xC0, 0x3E, 0x7F, 0xC0, 0x3E, 0x03, 0x3E, 0xC0, 0xA2, 0x78, 0x14,
+   0x0C, 0x09, 0x1D, 0x12, 0xC0, 0x16, 0xC0, 0x52, 0x5B, 0x66, 0x36, 0x24, 0x17, 0x56, 0x0A, 0x9D,
+   0x99, 0x52, 0xC0, 0x55, 0x6F, 0x1C, 0x55, 0x5A, 0x7E, 0xC1, 0x6F, 0x21, 0xC1, 0x24, 0x38, 0x02,
+   0x7E, 0xA3, 0x87, 0x29, 0x2F, 0x10, 0x16, 0x79, 0x1A, 0x0C, 0x3E, 0x2B, 0x9D, 0xC9, 0x9D, 0xB9,
+   0x71, 0x72, 0x2A, 0x19, 0xFE, 0x62, 0x31, 0x3D, 0x6D, 0x17, 0x1C, 0xA3, 0x87, 0xA3, 0x97, 0xA3,
+   0x87, 0x69, 0xA2, 0x97, 0x61, 0x1A, 0x11, 0x0C, 0x7A, 0x3E, 0x01, 0xC0, 0x61, 0x2B, 0xC0, 0x7F,
+   0x69, 0x3F, 0x30, 0xC0, 0x2D, 0xA3, 0x88, 0x0F, 0x51, 0x11, 0x56, 0x1D, 0x1A, 0xC0, 0x12, 0xC0,
+   0x5A, 0x16, 0xC0, 0x6F, 0x0E, 0xC0, 0x7F, 0x0E, 0xC0, 0x66, 0xC0, 0x0E, 0xC0, 0xA2, 0x87, 0x61,
+   0x16, 0x1E, 0x12, 0x6E, 0x7B, 0x65, 0x65, 0x15, 0x69, 0x11, 0x09, 0x11, 0x0C, 0x11, 0x6F, 0x0E,
+   0x09, 0x0E, 0x15, 0x1A, 0x12, 0x1E, 0x16, 0xC0, 0x42, 0x62, 0x2F, 0x36, 0x29, 0x9D, 0x9A, 0x52,
+   0x05, 0x3D, 0x24, 0x6F, 0x24, 0x56, 0x55, 0xA2, 0x78, 0x51, 0xC0, 0x69, 0x6F, 0x7A, 0xC1, 0x0D,
+   0xA2, 0x88, 0x1C, 0x24, 0x38, 0xA3, 0x87, 0x17, 0x29, 0x36, 0xA3, 0x87, 0x7D, 0x16, 0x1A, 0x61,
+   0x9F, 0xB8, 0x9D, 0xB9, 0x9D, 0xB9, 0x9F, 0xB9, 0x9C, 0xA9, 0x9F, 0xB8, 0x72, 0x25, 0x21, 0x38,
+   0x6E, 0xA3, 0x97, 0x17, 0x29, 0xA2, 0x87, 0x08, 0xA2, 0x87, 0x16, 0x7E, 0x65, 0x7A, 0x7E, 0x00,
+   0x3B, 0xA1, 0xA8, 0x01, 0x66, 0x30, 0xC2, 0x35, 0x2D, 0x32, 0x39, 0x3B, 0x00, 0x0C, 0x1D, 0x1A,
+   0xC1, 0x5A, 0x1E, 0x16, 0xC0, 0x6B, 0x56, 0xC0, 0x10, 0x55, 0xC0, 0x66, 0x08, 0xC2, 0x01, 0x10,
+   0x15, 0x69, 0xC0, 0x16, 0xC1, 0x65, 0x6E, 0x12, 0x0A, 0x7A, 0x1A, 0x6B, 0x12, 0x0D, 0x12, 0x0D,
+   0x1E, 0x12, 0x1E, 0x0A, 0x0E, 0x66, 0xC0, 0x10, 0x34, 0x6B, 0x29, 0x52, 0x66, 0x52, 0x05, 0x31,
+   0x56, 0x6B, 0x55, 0x66, 0x5E, 0x51, 0xA2, 0x87, 0x51, 0xA2, 0x78, 0x03, 0x14, 0x66, 0xC0, 0x17,
+   0x62, 0x6F, 0x21, 0x1C, 0x38, 0x31, 0xA4, 0x87, 0x6D, 0x2E, 0x34, 0x01, 0xA2, 0x97, 0x7D, 0x75,
+   0x00, 0x3E, 0x33, 0x13, 0x9F, 0xB9, 0x71, 0x71, 0x76, 0x21, 0x24, 0x29, 0xA2, 0x87, 0xA3, 0x88,
+   0xA3, 0x97, 0xA3, 0x87, 0xA2, 0x87, 0x01, 0x0E, 0x1B, 0x12, 0xC0, 0xA1, 0xA8, 0x09, 0xA1, 0xA8,
+   0x66, 0x3E, 0x7E, 0x32, 0x7B, 0xC0, 0x6E, 0xC0, 0x3E, 0xC0, 0x6E, 0x00, 0xA2, 0x78, 0xC0, 0x5A,
+   0x56, 0xA2, 0x78, 0x56, 0x16, 0xC0, 0x56, 0x66, 0x15, 0x9D, 0x99, 0x6B, 0x5A, 0x2F, 0x36, 0xC0,
+   0x3B, 0xC0, 0x36, 0xC0, 0x3B, 0x36, 0x3B, 0x03, 0xC0, 0x08, 0x7E, 0x55, 0x15, 0xC0, 0x7E, 0x0E,
+   0x16, 0x66, 0x1B, 0xC0, 0x16, 0xC1, 0x0E, 0x1D, 0x0E, 0x09, 0x5A, 0x08, 0x03, 0x2F, 0x2E, 0x66,
+   0x52, 0x9D, 0x9A, 0x05, 0xC0, 0x52, 0x51, 0x6E, 0x52, 0x21, 0x1E, 0x55, 0xC0, 0x69, 0x6F, 0xC0,
+   0x55, 0xC1, 0x14, 0x0F, 0x7E, 0x1E, 0x21, 0x30, 0x7A, 0x3D, 0x0A, 0xA2, 0x87, 0xA3, 0x87, 0x2F,
+   0xA3, 0x88, 0x0E, 0xA2, 0x97, 0x12, 0x75, 0xA0, 0xA8, 0x9D, 0xB9, 0x9C, 0xA8, 0x71, 0x72, 0x9F,
+   0xB9, 0x61, 0xFE, 0x51, 0xEF, 0x1C, 0x24, 0x38, 0x02, 0xA2, 0x97, 0xA2, 0x77, 0x2E, 0x03, 0xA2,
+   0x76, 0x0E, 0x7D, 0x7E, 0x61, 0x09, 0xA2, 0x88, 0x61, 0x7A, 0x66, 0x3E, 0x6E, 0x3E, 0x03, 0x0A,
+   0x03, 0x07, 0x0C, 0x09, 0xC0, 0xA2, 0x78, 0x56, 0x1E, 0x16, 0xC0, 0x52, 0x15, 0x10, 0x08, 0x66,
+   0x3B, 0x2E, 0x29, 0x7E, 0x42, 0x7A, 0xC0, 0x1C, 0x24, 0xC1, 0x1C, 0x24, 0x29, 0xC0, 0x69, 0x2E,
+   0x36, 0x2F, 0x34, 0x6E, 0x08, 0x6E, 0x08, 0x01, 0x15, 0x10, 0x0D, 0xC0, 0x10, 0x0D, 0x03, 0x3B,
+   0x03, 0x2E, 0xC0, 0x24, 0xC0, 0x52, 0x52, 0x66, 0x3D, 0x38, 0x41, 0x66, 0x21, 0xC0, 0x41, 0x14,
+   0xC1, 0x6E, 0x55, 0x6E, 0x0A, 0xC0, 0x66, 0x19, 0x9D, 0x99, 0x7A, 0x6B, 0x7E, 0x1C, 0x30, 0x79,
+   0x6E, 0xA4, 0x87, 0x6D, 0xA4, 0x87, 0x08, 0x6D, 0x7D, 0xA1, 0xA8, 0x1A, 0x0C, 0xA0, 0xA8, 0x3C,
+   0x71, 0x72, 0x9D, 0xA8, 0x71, 0x14, 0x62, 0x7E, 0xA1, 0xA9, 0x38, 0xA3, 0x87, 0xA3, 0x87, 0x29,
+   0x2F, 0x08, 0x09, 0x07, 0x1E, 0x65, 0x1A, 0x61, 0x7E, 0x0C, 0xC0, 0x7A, 0x55, 0x7A, 0x00, 0x0F,
+   0x0C, 0x1D, 0x18, 0x59, 0x56, 0xA2, 0x78, 0x67, 0x16, 0x52, 0x15, 0x01, 0x66, 0x2F, 0x57, 0x29,
+   0x66, 0xC0, 0x66, 0x42, 0x0A, 0xC0, 0x65, 0x0A, 0xC0, 0x55, 0x0A, 0x66, 0x0A, 0x7E, 0x55, 0x12,
+   0x69, 0x24, 0xC1, 0x2E, 0xC0, 0x36, 0x31, 0xC0, 0xA2, 0x77, 0x36, 0x3B, 0xC0, 0x36, 0xC0, 0x2E,
+   0xC1, 0x24, 0x10, 0x12, 0x3E, 0x02, 0x05, 0x2C, 0x56, 0x6E, 0x52, 0x5A, 0x69, 0x6E, 0x14, 0x69,
+   0x5A, 0x6E, 0xC1, 0x55, 0x6F, 0x00, 0x0F, 0xC0, 0x62, 0x14, 0x66, 0x66, 0x21, 0xC0, 0xA2, 0x88,
+   0x2C, 0xA4, 0x77, 0x6D, 0xA3, 0x98, 0xA2, 0x76, 0x3C, 0x09, 0x7D, 0xA2, 0x87, 0x0E, 0x76, 0x71,
+   0x76, 0x9D, 0xB9, 0x61, 0xA0, 0xA8, 0xFE, 0x42, 0x0E, 0x0F, 0x76, 0x7A, 0xA2, 0x88, 0x3D, 0xA3,
+   0x97, 0xA2, 0x77, 0x36, 0x34, 0x01, 0xA2, 0x87, 0x16, 0x79, 0xC0, 0x79, 0x1D, 0x66, 0xC0, 0x0C,
+   0x7E, 0x0C, 0xC0, 0x5A, 0xC0, 0x0E, 0x1A, 0x12, 0x6F, 0xC0, 0x52, 0x5A, 0x56, 0x6B, 0x2F, 0x36,
+   0x2E, 0x62, 0x52, 0xC0, 0x52, 0x66, 0x3D, 0xC0, 0x2C, 0x3D, 0x51, 0x38, 0xC0, 0x29, 0x3D, 0x29,
+   0x3D, 0x65, 0x3D, 0xC0, 0x69, 0x0A, 0x65, 0x0A, 0x03, 0x17, 0x1F, 0x24, 0x17, 0x1C, 0xC0, 0x24,
+   0x1C, 0x24, 0x17, 0xC0, 0x66, 0x0A, 0xC0, 0x3D, 0xC1, 0x30, 0x51, 0xC0, 0x21, 0xC0, 0x59, 0x51,
+   0x6E, 0x5A, 0x59, 0x00, 0x6E, 0x6F, 0xC0, 0x55, 0x7E, 0x05, 0x7F, 0xC0, 0x00, 0xA1, 0xAA, 0x9D,
+   0x99, 0x17, 0x6B, 0x21, 0xC0, 0x7A, 0x31, 0xA3, 0x88, 0xA4, 0x86, 0x6E, 0xA4, 0x86, 0x6E, 0x0E,
+   0xA2, 0x97, 0x61, 0x7D, 0x0C, 0x75, 0x3C, 0x75, 0x66, 0x05, 0x73, 0x76, 0x7B, 0xA2, 0x98, 0x3D,
+   0x7E, 0xA4, 0x76, 0x29, 0xA2, 0x87, 0xA4, 0x76, 0x06, 0x7E, 0x16, 0x65, 0x1A, 0xC0, 0x09, 0xC0,
+   0x18, 0x69, 0x5A, 0x11, 0x5B, 0x0E, 0x15, 0x5A, 0x1E, 0x16, 0xC0, 0x57, 0x01, 0x67, 0xC0, 0x29,
+   0x66, 0x52, 0x52, 0xC0, 0x05, 0x31, 0x2C, 0x5A, 0x30, 0x65, 0xC0, 0x56, 0xC0, 0x55, 0xC0, 0x21,
+   0x1C, 0xC0, 0x29, 0x30, 0xC0, 0x38, 0xC1, 0x3D, 0x31, 0xA2, 0x78, 0x65, 0x05, 0x0A, 0x55, 0x0A,
+   0x3E, 0x0A, 0xC0, 0x3B, 0x02, 0x36, 0x3D, 0x31, 0x3D, 0x30, 0x24, 0x1C, 0x21, 0xC0, 0x5A, 0x69,
+   0x0F, 0x6E, 0x55, 0x6E, 0x5D, 0xA2, 0x78, 0x65, 0xC0, 0x6E, 0x5A, 0xC0, 0x0F, 0x56, 0x05, 0x6B,
+   0x61, 0x7B, 0x7B, 0x7A, 0x1E, 0x1C, 0xC0, 0x38, 0x3D, 0xA4, 0x86, 0x6E, 0xA3, 0x97, 0x08, 0x7E,
+   0x6D, 0xA2, 0x97, 0x1A, 0x1D, 0x11, 0x76, 0x9D, 0xA9, 0x79, 0x07, 0x9F, 0xBA, 0x73, 0x12, 0x21,
+   0x38, 0xA2, 0x87, 0x6E, 0x1C, 0xA3, 0x87, 0x03, 0x10, 0xA2, 0x87, 0x69, 0x1E, 0xC0, 0x65, 0x1A,
+   0xC0, 0x66, 0x09, 0x1A, 0xC2, 0x5A, 0x52, 0x1B, 0x1D, 0x51, 0x5B, 0x9D, 0x9A, 0x27, 0x2E, 0x1C,
+   0x66, 0x9D, 0x89, 0x36, 0x3D, 0x24, 0x30, 0x51, 0x21, 0x51, 0x6E, 0x56, 0xC0, 0x12, 0xC0, 0x0A,
+   0xA2, 0x88, 0x0F, 0x12, 0x1E, 0x12, 0x21, 0x1C, 0x65, 0xC0, 0x30, 0xC0, 0x24, 0x38, 0xC0, 0x69,
+   0x38, 0x29, 0x38, 0xC0, 0x3D, 0x38, 0xC0, 0x29, 0x38, 0x30, 0xC0, 0x50, 0x1C, 0xC0, 0x12, 0x0A,
+   0x0F, 0xC0, 0x6D, 0x5A, 0x6E, 0x59, 0x6E, 0x07, 0x6E, 0x6E, 0x65, 0x5A, 0x05, 0x11, 0x0C, 0x07,
+   0x66, 0x76, 0x0F, 0x66, 0x14, 0x1E, 0x66, 0x21, 0x38, 0x3D, 0xA2, 0x87, 0x17, 0x6D, 0xA4, 0x87,
+   0x08, 0xA2, 0x87, 0x16, 0x69, 0x1A, 0xC0, 0x75, 0x66, 0x75, 0xFE, 0x32, 0x8C, 0x73, 0x9F, 0xBB,
+   0x76, 0x67, 0x24, 0x3D, 0xA2, 0x87, 0xA3, 0x87, 0x2E, 0xA3, 0x97, 0x08, 0x09, 0x1D, 0x64, 0x0F,
+   0x7F, 0x65, 0xC0, 0x1A, 0x12, 0xC0, 0x66, 0x12, 0xC0, 0x1E, 0x1B, 0x0E, 0x15, 0x9D, 0x99, 0x57,
+   0x2E, 0x62, 0x52, 0x52, 0x3D, 0xC0, 0x29, 0x66, 0x56, 0x21, 0x5A, 0x51, 0x6E, 0x14, 0xC0, 0x55,
+   0xC0, 0x6E, 0xC0, 0x05, 0xC1, 0x14, 0x05, 0x14, 0x62, 0x69, 0x0A, 0x7A, 0x6E, 0x1C, 0x21, 0x1C,
+   0xC0, 0x30, 0x24, 0xC0, 0x1C, 0x30, 0x1C, 0x24, 0x29, 0x24, 0x1C, 0x21, 0x0D, 0xC0, 0x1E, 0x0F,
+   0xC0, 0x05, 0xC0, 0x59, 0x00, 0xC0, 0xA3, 0x77, 0xC0, 0x59, 0x5A, 0x6E, 0x7E, 0xC0, 0x07, 0x7A,
+   0x6F, 0x76, 0x52, 0x7A, 0x00, 0x7F, 0x62, 0x7F, 0x12, 0x21, 0x24, 0x29, 0x31, 0xA3, 0x88, 0x1F,
+   0xA2, 0x77, 0x36, 0xA2, 0x76, 0x15, 0x7D, 0x7E, 0x65, 0xC0, 0x7A, 0x7E, 0xFE, 0x2A, 0xAC, 0x9E,
+   0xBA, 0x73, 0x73, 0x0D, 0x1C, 0x2C, 0xA2, 0x77, 0x17, 0x29, 0x7E, 0x08, 0x06, 0x09, 0x1B, 0x65,
+   0x1E, 0x12, 0x7F, 0x12, 0x21, 0x59, 0x12, 0x6B, 0x16, 0x66, 0x6F, 0x09, 0x08, 0x2F, 0x2E, 0x62,
+   0x56, 0x0A, 0x66, 0x3D, 0x9D, 0x99, 0x6E, 0x52, 0x0D, 0x5E, 0x14, 0x55, 0x6E, 0x00, 0xC0, 0xA3,
+   0x78, 0x51, 0xC0, 0xA2, 0x87, 0x07, 0x7A, 0x02, 0x7F, 0x00, 0x7F, 0x3B, 0x0F, 0x14, 0x66, 0x03,
+   0xA2, 0x88, 0xC0, 0x0D, 0x6E, 0x0D, 0x6F, 0x7E, 0x1C, 0xC0, 0x21, 0xC1, 0x1C, 0x21, 0x19, 0x12,
+   0x0F, 0xC0, 0x69, 0x6E, 0x5A, 0x3B, 0x00, 0xA2, 0x77, 0x02, 0xA2, 0x77, 0x69, 0xA2, 0x78, 0x55,
+   0xC0, 0x6E, 0xC0, 0x7E, 0x0C, 0x07, 0x7B, 0x66, 0x7A, 0x62, 0x00, 0x77, 0x08, 0x6B, 0x19, 0x24,
+   0x29, 0x38, 0x36, 0xA2, 0x88, 0xA4, 0x86, 0x31, 0xA2, 0x87, 0xA2, 0x77, 0x7E, 0x09, 0xA2, 0x87,
+   0x69, 0x7A, 0xC0, 0xFE, 0x2A, 0xCC, 0x9D, 0xBA, 0x00, 0x9F, 0xBB, 0x7F, 0x1C, 0x38, 0x36, 0xA3,
+   0x98, 0x24, 0x27, 0x08, 0x01, 0x09, 0x0E, 0xA2, 0x97, 0x55, 0x1E, 0x65, 0xC0, 0x56, 0x1E, 0x0A,
+   0x1E, 0x16, 0x0E, 0x01, 0x6F, 0x62, 0x52, 0x52, 0x52, 0x62, 0x3D, 0x2C, 0x42, 0xC0, 0x21, 0x55,
+   0x5A, 0x5D, 0xC0, 0xA2, 0x77, 0x59, 0x59, 0x5E, 0xA2, 0x88, 0x07, 0x6E, 0x7E, 0x66, 0xC0, 0x07,
+   0x7A, 0x05, 0x6F, 0x62, 0x7A, 0x7B, 0xC0, 0x3B, 0x7B, 0xC0, 0x7A, 0x66, 0x6B, 0xA2, 0x88, 0x0A,
+   0x7A, 0xC0, 0x12, 0x1E, 0x0D, 0x12, 0xC0, 0x1E, 0x55, 0xC0, 0x08, 0x05, 0x6E, 0xC0, 0x59, 0xA2,
+   0x77, 0xC0, 0x6E, 0x11, 0x16, 0x55, 0x7E, 0x0C, 0x69, 0x6F, 0xC0, 0x0C, 0x07, 0x16, 0x66, 0x66,
+   0x7A, 0x14, 0x66, 0x76, 0x67, 0x1E, 0x61, 0x30, 0x65, 0x3D, 0xA2, 0x87, 0xA2, 0x87, 0xA2, 0x87,
+   0x2E, 0x2F, 0xA4, 0x77, 0x7E, 0x1D, 0x69, 0x65, 0x7E, 0xFE, 0x2A, 0xCB, 0x0C, 0x00, 0x73, 0x1E,
+   0x21, 0x38, 0x6D, 0xA3, 0x88, 0x24, 0xA3, 0x87, 0xA2, 0x87, 0x01, 0x09, 0xC0, 0x16, 0xC0, 0x7E,
+   0xC0, 0x55, 0xC0, 0x1E, 0x16, 0x66, 0x0E, 0xC0, 0x01, 0x6B, 0x36, 0x2E, 0x9C, 0x99, 0x53, 0x66,
+   0x38, 0x55, 0x21, 0xC0, 0x59, 0x55, 0xA2, 0x67, 0x59, 0xA2, 0x77, 0x5E, 0x6E, 0x59, 0x5D, 0xC0,
+   0xA2, 0x77, 0x7E, 0x52, 0x11, 0xC0, 0x7B, 0x0C, 0x7B, 0x7A, 0x9D, 0x9A, 0x02, 0x7F, 0x0F, 0x66,
+   0x05, 0x66, 0x7B, 0x66, 0x08, 0x6F, 0x61, 0xC0, 0x6B, 0xC0, 0x6E, 0xC0, 0x03, 0x17, 0x0F, 0x14,
+   0xC1, 0x6E, 0x55, 0x6E, 0x59, 0xA2, 0x78, 0x55, 0x7E, 0xA2, 0x67, 0xC0, 0x69, 0x5A, 0xC0, 0xA2,
+   0x87, 0x5A, 0x19, 0x0C, 0x7E, 0x52, 0x7A, 0x66, 0x62, 0x7B, 0x7B, 0x66, 0x08, 0x7B, 0x66, 0x21,
+   0x7A, 0x29, 0xA2, 0x87, 0xA2, 0x88, 0x7E, 0xA3, 0x87, 0x22, 0xA4, 0x87, 0xC0, 0x01, 0x0E, 0xC0,
+   0x7E, 0xFE, 0x2A, 0xEC, 0x9C, 0xBA, 0x00, 0x9F, 0xBB, 0x7A, 0x21, 0x29, 0x0A, 0x7E, 0xA4, 0x76,
+   0xA2, 0x87, 0xA2, 0x77, 0x3C, 0x06, 0x0E, 0x1E, 0x56, 0x1E, 0xC0, 0x65, 0x1E, 0xC1, 0x16, 0x1D,
+   0x01, 0x39, 0x67, 0x29, 0x52, 0x52, 0x0A, 0x38, 0x30, 0x9D, 0x98, 0x5E, 0x5A, 0x6E, 0x5D, 0x59,
+   0xA2, 0x67, 0x07, 0x6E, 0x5D, 0x6E, 0xA3, 0x77, 0xC0, 0x59, 0xA2, 0x88, 0x55, 0xC0, 0x7A, 0x6B,
+   0x51, 0x7B, 0x66, 0x66, 0x76, 0x67, 0x66, 0x76, 0x6B, 0x76, 0x66, 0x6B, 0x0F, 0x66, 0x66, 0x14,
+   0x66, 0xC1, 0x14, 0x0F, 0x65, 0x08, 0x14, 0x08, 0x14, 0x6D, 0x5A, 0x55, 0x6E, 0x6E, 0x6E, 0x5A,
+   0x69, 0x6E, 0x07, 0x7E, 0x5E, 0x65, 0x11, 0xC0, 0x66, 0xC0, 0x07, 0x02, 0x7A, 0x7F, 0x9D, 0xAA,
+   0x7B, 0xC0, 0x77, 0x66, 0x7A, 0x7B, 0xC0, 0x38, 0x55, 0xA3, 0x98, 0x6E, 0xA3, 0x87, 0x24, 0x2E,
+   0x3B, 0xA2, 0x87, 0xC0, 0x01, 0x15, 0x95, 0x08, 0x9D, 0xBC, 0x00, 0x14, 0x12, 0x7B, 0x38, 0x6D,
+   0xA5, 0x87, 0x24, 0xA3, 0x87, 0xA2, 0x87, 0x01, 0x0E, 0x7A, 0x6E, 0x69, 0x1E, 0x65, 0x56, 0x0F,
+   0x16, 0xC1, 0x06, 0x6B, 0x34, 0x3B, 0x9D, 0x9A, 0x9D, 0x9A, 0x66, 0x3D, 0x38, 0x9D, 0x89, 0xC0,
+   0x5E, 0x55, 0xA2, 0x66, 0x59, 0xA2, 0x66, 0xA2, 0x67, 0x5D, 0xA2, 0x77, 0x6D, 0x5E, 0x6E, 0x59,
+   0xA2, 0x77, 0x6B, 0x7E, 0x51, 0x25, 0x66, 0x66, 0xC0, 0x77, 0xC0, 0x62, 0x62, 0x07, 0x77, 0x76,
+   0x62, 0x66, 0x7F, 0x67, 0x76, 0x6E, 0x7B, 0x14, 0x55, 0x7B, 0xC0, 0x55, 0x14, 0x00, 0x14, 0x00,
+   0x14, 0x05, 0x0A, 0x6E, 0x0C, 0x69, 0x5A, 0xA2, 0x87, 0x5E, 0xC0, 0x6E, 0x69, 0x6E, 0x56, 0xC0,
+   0x14, 0x0C, 0x66, 0xC0, 0x66, 0xA1, 0xA9, 0x52, 0x05, 0x66, 0x77, 0xC0, 0x7B, 0x7A, 0x1C, 0xC0,
+   0x30, 0x38, 0xA2, 0x77, 0x7E, 0x17, 0xC0, 0x29, 0x36, 0x6E, 0xC0, 0x39, 0x0D, 0x0C, 0x9E, 0xBA,
+   0x9C, 0xAA, 0xA1, 0xAA, 0x72, 0x30, 0x3D, 0xA3, 0x97, 0xA2, 0x77, 0x2E, 0x03, 0x08, 0x06, 0xA2,
+   0x97, 0xC1, 0x7E, 0xC1, 0x65, 0x1E, 0xC0, 0x5A, 0x67, 0x15, 0x01, 0x03, 0x36, 0x9C, 0x89, 0x17,
+   0x0A, 0x3D, 0x30, 0x51, 0x0D, 0x5E, 0x05, 0xA3, 0x77, 0xA2, 0x66, 0x0C, 0x5D, 0xA2, 0x77, 0xA2,
+   0x66, 0x6E, 0xA2, 0x77, 0x55, 0xA2, 0x77, 0x6E, 0x55, 0xA2, 0x88, 0x56, 0x20, 0x1B, 0x6F, 0x61,
+   0x7B, 0x62, 0x7B, 0x66, 0x62, 0x72, 0x0C, 0x7B, 0x61, 0x67, 0x76, 0x00, 0x7F, 0x66, 0x66, 0x7F,
+   0x05, 0x7A, 0xC0, 0x6B, 0x14, 0x08, 0xC0, 0x14, 0x19, 0x0A, 0x6E, 0x0A, 0x00, 0xA2, 0x77, 0xC0,
+   0x6E, 0x5A, 0x69, 0x6F, 0x69, 0x16, 0x69, 0x16, 0x0F, 0x16, 0x51, 0xA1, 0xA9, 0x0C, 0x76, 0x7B,
+   0x00, 0x7B, 0x7B, 0x61, 0x7F, 0x0D, 0x21, 0x30, 0x69, 0x38, 0xA3, 0x87, 0x7E, 0xC0, 0x24, 0x6E,
+   0x22, 0x6E, 0xA3, 0x98, 0x56, 0x0F, 0x9C, 0xAB, 0x9F, 0xCA, 0x77, 0x1C, 0x38, 0xA2, 0x87, 0xA2,
+   0x87, 0x29, 0x27, 0xA4, 0x87, 0x01, 0x0E, 0x7E, 0xC0, 0x79, 0x1E, 0x12, 0x7F, 0x1E, 0x12, 0x5A,
+   0x16, 0xC0, 0x09, 0x3C, 0x3B, 0x2E, 0x24, 0x9D, 0x8A, 0x52, 0x3D, 0x9D, 0x99, 0x41, 0x5A, 0x59,
+   0xA2, 0x67, 0xA2, 0x76, 0xA2, 0x66, 0xA2, 0x66, 0x5D, 0x20, 0x59, 0x5D, 0xA2, 0x77, 0x5A, 0x1D,
+   0x6E, 0x6E, 0x65, 0x22, 0x27, 0x25, 0x1D, 0x7A, 0x66, 0x77, 0x16, 0x62, 0x66, 0xA0, 0xAA, 0x66,
+   0x62, 0x77, 0x66, 0x62, 0xA1, 0xA9, 0x66, 0xC0, 0x66, 0x7B, 0x66, 0xC2, 0x65, 0x0F, 0x14, 0x65,
+   0x00, 0x14, 0x55, 0x19, 0x40, 0x6F, 0x7E, 0x5E, 0x02, 0x6E, 0x0C, 0x7E, 0x51, 0xA2, 0x78, 0x65,
+   0xC0, 0x14, 0x11, 0x76, 0xC0, 0x62, 0x66, 0x7F, 0x19, 0x66, 0xC0, 0x7B, 0x7A, 0xC0, 0x1C, 0x38,
+   0x3D, 0x69, 0x7E, 0xA2, 0x88, 0x17, 0x29, 0xC0, 0x31, 0xC0, 0xA2, 0x77, 0x97, 0x39, 0x0A, 0x08,
+   0x0D, 0x1C, 0x3D, 0xA2, 0x87, 0x17, 0xA5, 0x86, 0xA2, 0x87, 0x6E, 0xA2, 0x87, 0x79, 0x6D, 0x7F,
+   0x65, 0x1A, 0x12, 0xC0, 0x6E, 0x12, 0x56, 0x6F, 0xC0, 0x5B, 0x52, 0x3B, 0x2E, 0x62, 0x9C, 0x89,
+   0x67, 0x9D, 0x9A, 0x1C, 0x55, 0x5A, 0x19, 0x4D, 0x5C, 0xA2, 0x67, 0xA2, 0x66, 0xA3, 0x77, 0x5D,
+   0x5D, 0xA2, 0x77, 0x1D, 0x22, 0x69, 0x6E, 0x6E, 0x52, 0xC1, 0x27, 0x22, 0x61, 0x7B, 0x66, 0x7B,
+   0x62, 0x73, 0x0C, 0x7B, 0x76, 0x63, 0x7A, 0x67, 0x00, 0x7F, 0x62, 0x66, 0x7E, 0x7F, 0x56, 0x17,
+   0x0A, 0x17, 0x0A, 0x17, 0x51, 0x0A, 0x0F, 0x6E, 0x08, 0x14, 0x59, 0xC0, 0x59, 0x7F, 0x5A, 0x69,
+   0x02, 0x7E, 0x6E, 0x07, 0xC0, 0x0F, 0x02, 0x16, 0x66, 0x00, 0x7F, 0x66, 0x62, 0x7F, 0xC0, 0x7F,
+   0x1C, 0xC0, 0x7E, 0x6E, 0x38, 0x3D, 0x69, 0xA3, 0x88, 0x7E, 0xC0, 0xA2, 0x87, 0xC0, 0xA3, 0x87,
+   0xC0, 0x96, 0x4A, 0x9D, 0xAA, 0xA0, 0xA9, 0x1C, 0x38, 0xA2, 0x87, 0x17, 0xA3, 0x87, 0x3B, 0x3C,
+   0x09, 0x0E, 0x79, 0x7E, 0x7F, 0x12, 0x7A, 0x69, 0x15, 0x59, 0x12, 0xC0, 0x6F, 0x41, 0x6B, 0x53,
+   0x66, 0x2E, 0x9D, 0x9A, 0x17, 0x9C, 0x89, 0x38, 0x9D, 0x89, 0x0D, 0xA2, 0x67, 0x54, 0xA3, 0x67,
+   0x4D, 0xA2, 0x76, 0xA4, 0x56, 0xA2, 0x77, 0x48, 0x1B, 0x5A, 0xA3, 0x87, 0x45, 0xC0, 0x69, 0x6F,
+   0x11, 0xC0, 0x25, 0x18, 0x7A, 0x66, 0x7B, 0x62, 0x7B, 0x9D, 0xAA, 0x77, 0x7B, 0x9C, 0x99, 0xA0,
+   0xA9, 0x67, 0x62, 0x76, 0x62, 0x7B, 0xC0, 0x76, 0x6F, 0x7A, 0xC2, 0x7F, 0x12, 0x0D, 0xC0, 0x6F,
+   0x55, 0xC0, 0xA2, 0x87, 0x0F, 0x03, 0x14, 0xC0, 0x05, 0x6E, 0x6E, 0xC1, 0x55, 0x6E, 0x00, 0x05,
+   0xC0, 0x0F, 0x0A, 0xC0, 0x66, 0x7E, 0x14, 0x62, 0x17, 0x12, 0x1C, 0x21, 0x1C, 0xA2, 0x87, 0x2C,
+   0xA3, 0x88, 0x36, 0xA2, 0x88, 0x6D, 0x24, 0xC1, 0x6E, 0xA2, 0x87, 0x0F, 0x9D, 0xBB, 0x7A, 0xA2,
+   0x98, 0xA2, 0x87, 0xA5, 0x87, 0xA2, 0x87, 0x36, 0xA3, 0x87, 0x09, 0x6D, 0x1E, 0x69, 0x66, 0x75,
+   0x6E, 0x09, 0xA2, 0x88, 0x0E, 0x6F, 0xC1, 0x12, 0x56, 0x6F, 0x52, 0x53, 0x36, 0x29, 0x9B, 0x9A,
+   0x05, 0x9C, 0x89, 0x1C, 0x21, 0x14, 0x0F, 0x59, 0xA2, 0x56, 0xA4, 0x66, 0xA2, 0x66, 0x5D, 0xA3,
+   0x77, 0x5D, 0xA2, 0x77, 0x27, 0x6D, 0x51, 0xA2, 0x78, 0x65, 0x11, 0x6F, 0x25, 0x6B, 0x27, 0x66,
+   0x76, 0x62, 0x0C, 0x77, 0x77, 0x9D, 0xAA, 0xA1, 0xA9, 0x9D, 0xAA, 0x67, 0x7B, 0x00, 0x7B, 0x76,
+   0x6B, 0x66, 0xC0, 0x0D, 0x1C, 0x59, 0x0D, 0x21, 0x65, 0x1C, 0xC1, 0x21, 0x1C, 0x0D, 0xC1, 0x0A,
+   0x0F, 0x65, 0x14, 0x55, 0x14, 0x05, 0x6E, 0x6E, 0xC0, 0x0A, 0x7E, 0x0F, 0x05, 0x66, 0x7F, 0x14,
+   0x7A, 0x52, 0x7F, 0x21, 0x1C, 0x21, 0x7E, 0x38, 0x31, 0xA2, 0x88, 0x6E, 0x7E, 0xC0, 0x6E, 0x69,
+   0xA3, 0x88, 0x65, 0xA2, 0x88, 0x03, 0x1C, 0x24, 0x38, 0x12, 0xA2, 0x76, 0x36, 0x3C, 0x09, 0xA3,
+   0x87, 0x65, 0xA1, 0xA9, 0x65, 0x7A, 0x69, 0x66, 0x65, 0xC0, 0x11, 0x6F, 0x11, 0x0E, 0x1A, 0x1E,
+   0x1B, 0x09, 0x3C, 0x57, 0x9C, 0x9A, 0x56, 0x05, 0x9D, 0x89, 0x52, 0x19, 0x59, 0x59, 0x16, 0x5C,
+   0x4D, 0xA4, 0x66, 0xA3, 0x77, 0xA2, 0x66, 0x20, 0x6E, 0x59, 0x5E, 0xC0, 0x6E, 0x65, 0x66, 0x16,
+   0x67, 0x2C, 0x27, 0x62, 0x20, 0x9D, 0xAA, 0x77, 0x77, 0x62, 0x77, 0x72, 0x9D, 0xAA, 0xA1, 0x9A,
+   0x72, 0x05, 0x7B, 0xC0, 0x66, 0xA2, 0x98, 0xC0, 0x61, 0x1C, 0xC0, 0x30, 0xC1, 0x38, 0x30, 0xC1,
+   0x65, 0x1C, 0xC1, 0x0D, 0xC0, 0x21, 0x0D, 0x0A, 0xA2, 0x87, 0x0F, 0xC1, 0x14, 0x08, 0x14, 0xC1,
+   0x03, 0x17, 0x0A, 0xA2, 0x88, 0x21, 0x19, 0x0D, 0x21, 0x29, 0x38, 0xC0, 0x69, 0xA2, 0x88, 0x69,
+   0xA3, 0x88, 0x12, 0xA3, 0x87, 0x55, 0xA2, 0x88, 0x7E, 0x51, 0x96, 0x7C, 0xA1, 0xA9, 0x6E, 0xA4,
+   0x87, 0xA4, 0x86, 0x36, 0xA3, 0x87, 0xA2, 0x87, 0x78, 0xA2, 0x88, 0x75, 0x0E, 0x7A, 0x76, 0x51,
+   0x7A, 0xC0, 0x6E, 0xC0, 0x5A, 0x11, 0xC0, 0x46, 0x6F, 0x1E, 0x46, 0x53, 0x9D, 0x9A, 0x1D, 0x57,
+   0x05, 0x9D, 0x99, 0x42, 0x21, 0x59, 0x45, 0xA3, 0x66, 0xA3, 0x67, 0x5D, 0x5C, 0xA4, 0x56, 0x5D,
+   0x5E, 0x6D, 0xA2, 0x77, 0x6E, 0x18, 0x22, 0x66, 0x22, 0x1D, 0x20, 0x27, 0x66, 0x25, 0x73, 0x9D,
+   0x99, 0xA0, 0xAA, 0x72, 0x63, 0x9D, 0xAA, 0x72, 0x0A, 0x73, 0xC0, 0x77, 0x7A, 0x66, 0xC0, 0xA2,
+   0x98, 0x1C, 0x29, 0xC0, 0x7E, 0x3D, 0xC0, 0x31, 0x3D, 0xC1, 0x38, 0x3D, 0x38, 0xC1, 0x24, 0x1C,
+   0x24, 0x21, 0xC0, 0x0D, 0x21, 0x5A, 0x12, 0xC1, 0x17, 0x52, 0xC1, 0x12, 0xC0, 0x0D, 0x21, 0x24,
+   0x21, 0x30, 0x38, 0xC1, 0xA2, 0x87, 0xC0, 0xA2, 0x77, 0x7A, 0x6E, 0x1F, 0x6E, 0xC0, 0x6E, 0x36,
+   0x1C, 0x31, 0xA3, 0x88, 0xA3, 0x87, 0x3B, 0xA3, 0x87, 0xA2, 0x97, 0x6D, 0x75, 0x1A, 0x61, 0xA0,
+   0xA8, 0x03, 0x76, 0x66, 0x01, 0x61, 0xC0, 0x3C, 0x3E, 0x03, 0x5F, 0x6F, 0x0B, 0xA1, 0x8A, 0x56,
+   0x57, 0x9D, 0x9A, 0x36, 0x1C, 0x0A, 0x3D, 0x52, 0x9D, 0x88, 0x5E, 0x5D, 0xA2, 0x77, 0x4C, 0xA3,
+   0x67, 0xA3, 0x77, 0x4C, 0xA2, 0x77, 0xA2, 0x66, 0x5A, 0x6D, 0x5A, 0x6E, 0x6E, 0x18, 0x1D, 0x7A,
+   0x13, 0xA1, 0xA9, 0x1B, 0x66, 0x7B, 0x72, 0x9D, 0xAA, 0x63, 0x9F, 0xBA, 0x63, 0x7B, 0x9D, 0xA9,
+   0xA0, 0xAA, 0x66, 0x7F, 0x65, 0x7B, 0x30, 0x65, 0x3D, 0x7E, 0x6E, 0x55, 0x0A, 0x7E, 0xC0, 0x0A,
+   0x17, 0x51, 0x0A, 0x6E, 0x0A, 0xC0, 0x3D, 0x05, 0x31, 0x3D, 0x24, 0xC0, 0x1C, 0x30, 0x50, 0x21,
+   0x1C, 0xC0, 0x59, 0x1C, 0x21, 0x1C, 0x15, 0xC0, 0x1C, 0x24, 0xC2, 0x6E, 0x2C, 0x05, 0x55, 0xA3,
+   0x98, 0x17, 0x55, 0xA3, 0x98, 0x56, 0xA2, 0x87, 0x2E, 0x7A, 0x55, 0x2C, 0x0A, 0x29, 0x31, 0xA5,
+   0x86, 0xA2, 0x87, 0x69, 0x75, 0x09, 0x7A, 0x75, 0x32, 0x2B, 0x7E, 0x66, 0x66, 0xC0, 0x59, 0x2B,
+   0x3C, 0x01, 0xA2, 0x68, 0x0C, 0x0E, 0x1A, 0x5B, 0x16, 0x43, 0x62, 0x24, 0x17, 0x36, 0x9D, 0x9A,
+   0x15, 0x5F, 0x44, 0xA2, 0x77, 0xA3, 0x66, 0x5D, 0x07, 0xA4, 0x66, 0xA2, 0x66, 0x59, 0xA3, 0x77,
+   0x25, 0x5A, 0x69, 0xC0, 0x27, 0x13, 0x7A, 0x6B, 0x20, 0x62, 0x62, 0x73, 0x7B, 0x72, 0x73, 0x9D,
+   0xAA, 0x77, 0x62, 0xA1, 0xAA, 0x62, 0x7A, 0x7F, 0xA2, 0x87, 0xC0, 0x3D, 0xA2, 0x87, 0x65, 0x0A,
+   0xA3, 0x87, 0x17, 0xA2, 0x87, 0x55, 0x24, 0xC0, 0x5A, 0x7E, 0x24, 0x1C, 0x24, 0x66, 0x12, 0xC0,
+   0x5A, 0x0A, 0x36, 0x66, 0x38, 0x55, 0x38, 0xC0, 0x30, 0x65, 0x29, 0x52, 0x30, 0x29, 0x30, 0x24,
+   0x30, 0x24, 0x38, 0xC0, 0x3D, 0xC0, 0x7E, 0x59, 0x0A, 0x17, 0xC0, 0x6E, 0xC0, 0xA3, 0x87, 0x61,
+   0xA2, 0x88, 0x6E, 0x2E, 0x12, 0xA4, 0x76, 0x2F, 0xA3, 0x87, 0xA3, 0x97, 0x69, 0x0B, 0xA0, 0xA8,
+   0x71, 0x62, 0x75, 0x72, 0x65, 0x7A, 0x51, 0x7B, 0xC0, 0x5A, 0x6E, 0x1D, 0x2B, 0xA3, 0x78, 0x4A,
+   0xA3, 0x88, 0x1A, 0x52, 0x5F, 0x57, 0x52, 0x36, 0x17, 0x0A, 0x38, 0x41, 0x56, 0x5D, 0x5D, 0xA2,
+   0x66, 0x5D, 0x02, 0xA3, 0x77, 0x5D, 0xA4, 0x66, 0x6E, 0x45, 0x6D, 0x6E, 0x22, 0x11, 0x6F, 0x7A,
+   0x7B, 0x25, 0x9D, 0xAA, 0x7B, 0x9D, 0xAA, 0x72, 0x63, 0x73, 0x76, 0x7B, 0x72, 0x7B, 0x21, 0x24,
+   0x6E, 0x3D, 0x69, 0xA2, 0x88, 0x17, 0x1C, 0xA2, 0x87, 0xC0, 0xA2, 0x87, 0xC0, 0x6E, 0xC1, 0x34,
+   0x7F, 0x3B, 0x36, 0x3B, 0x2E, 0x31, 0x41, 0x29, 0x66, 0x9D, 0x9A, 0x0A, 0xC2, 0x9D, 0x99, 0x3D,
+   0x31, 0x38, 0xC1, 0x2C, 0x38, 0xC1, 0x31, 0x2C, 0x3D, 0x69, 0x0A, 0xC1, 0x6D, 0x1C, 0x65, 0x29,
+   0x65, 0x29, 0x7E, 0x59, 0x7F, 0x2F, 0x29, 0x2F, 0xA3, 0x87, 0xA2, 0x97, 0xA2, 0x87, 0x0E, 0xA0,
+   0xA8, 0x61, 0x30, 0x76, 0x71, 0x76, 0x62, 0xC0, 0x69, 0x66, 0x56, 0x6E, 0xA2, 0x88, 0x5E, 0xA2,
+   0x78, 0x33, 0xA2, 0x68, 0x4A, 0x09, 0xA2, 0x78, 0x46, 0x57, 0x57, 0x9D, 0x9A, 0x1C, 0x9D, 0x99,
+   0x38, 0x51, 0x41, 0x5A, 0xA2, 0x66, 0x59, 0xA3, 0x66, 0xA3, 0x77, 0xA2, 0x67, 0x5D, 0xA2, 0x66,
+   0x6E, 0x25, 0x55, 0xA2, 0x77, 0x66, 0xC1, 0x25, 0x66, 0x9D, 0xAA, 0x7B, 0x72, 0x9D, 0xAA, 0xA0,
+   0x9A, 0x07, 0x77, 0xA0, 0xA9, 0x62, 0x7F, 0x76, 0xA2, 0x87, 0x38, 0xA2, 0x87, 0x12, 0x17, 0xA2,
+   0x87, 0x6D, 0x27, 0x34, 0xA2, 0x88, 0xC0, 0x15, 0x65, 0xC0, 0x15, 0xC0, 0x09, 0x15, 0x51, 0x6F,
+   0x08, 0x66, 0x3B, 0x36, 0xC0, 0x52, 0x6E, 0x24, 0x17, 0xC0, 0x12, 0x3E, 0x6F, 0xC0, 0x05, 0x0A,
+   0x05, 0x51, 0xC0, 0x6E, 0x05, 0xC0, 0x0A, 0x05, 0x0A, 0x17, 0xC0, 0x6E, 0x29, 0x24, 0x22, 0x2E,
+   0x7E, 0x2F, 0xC1, 0x08, 0x3B, 0x15, 0x79, 0x7D, 0x75, 0x75, 0xA0, 0xA8, 0x33, 0x18, 0x76, 0x76,
+   0x61, 0x7A, 0x51, 0x7A, 0x66, 0x35, 0x32, 0x03, 0x5A, 0xA4, 0x77, 0x5F, 0x26, 0xA4, 0x67, 0xA2,
+   0x58, 0x5E, 0xA1, 0x8A, 0x46, 0x15, 0x3B, 0x24, 0x17, 0x9C, 0x89, 0x52, 0x52, 0x59, 0x0F, 0xA2,
+   0x66, 0x5D, 0xA2, 0x66, 0x5D, 0xA4, 0x66, 0x1B, 0x5D, 0x59, 0x7F, 0x20, 0x55, 0x20, 0x16, 0xC0,
+   0x76, 0x67, 0x77, 0x9D, 0xAA, 0x77, 0x72, 0x0F, 0x62, 0xA1, 0xA9, 0x62, 0xA2, 0x88, 0x7F, 0x31,
+   0xA3, 0x88, 0xA2, 0x87, 0xA2, 0x77, 0xA3, 0x97, 0x2F, 0x08, 0x69, 0x15, 0x69, 0x7E, 0xC0, 0x69,
+   0x16, 0x7E, 0x16, 0x1E, 0x16, 0xC0, 0x6E, 0x67, 0x51, 0x01, 0x7F, 0x08, 0x66, 0xC0, 0x9D, 0x89,
+   0x36, 0x66, 0x56, 0x24, 0x56, 0x17, 0xC1, 0x56, 0x0A, 0xC0, 0x7E, 0xC1, 0x17, 0xC1, 0x1C, 0x24,
+   0x59, 0x31, 0x2E, 0x3B, 0xC0, 0x03, 0xC0, 0x08, 0x65, 0xC0, 0x09, 0x1B, 0x71, 0x79, 0xA0, 0xA8,
+   0x9D, 0xB9, 0x9D, 0xB8, 0x72, 0x9D, 0xB9, 0x06, 0x35, 0x7A, 0x66, 0xC0, 0x65, 0x66, 0x33, 0xC0,
+   0x35, 0x37, 0xA3, 0x78, 0x5F, 0x2C, 0x3F, 0x4E, 0xA3, 0x68, 0x5B, 0x1E, 0x9D, 0x8A, 0x5B, 0x2E,
+   0x9C, 0x99, 0x9D, 0x9A, 0x53, 0x51, 0x41, 0x5E, 0x6D, 0x49, 0xA2, 0x66, 0xA2, 0x67, 0xA2, 0x76,
+   0x5E, 0xA3, 0x77, 0x55, 0xA3, 0x88, 0x51, 0x25, 0x11, 0x7F, 0x62, 0x66, 0x77, 0x73, 0x76, 0x9D,
+   0xAA, 0x7B, 0x72, 0x67, 0x7A, 0x24, 0x38, 0x3D, 0xA2, 0x87, 0x17, 0x2E, 0x3B, 0x6D, 0xA3, 0x98,
+   0x1D, 0x6D, 0x65, 0x1E, 0x65, 0x7A, 0x6E, 0xC0, 0x65, 0x1A, 0xC0, 0x15, 0x12, 0xC1, 0x0F, 0x66,
+   0x6F, 0x1D, 0x09, 0x01, 0x7F, 0x03, 0x3B, 0x36, 0x31, 0x29, 0x66, 0xC0, 0x1C, 0x24, 0x17, 0xC0,
+   0x65, 0x1C, 0x17, 0x24, 0xC0, 0x55, 0x29, 0x31, 0x2E, 0x36, 0x3B, 0x03, 0x34, 0x03, 0x6E, 0x6E,
+   0x08, 0x01, 0x1E, 0x1A, 0x75, 0x9D, 0xB9, 0x3F, 0x2C, 0x9C, 0xA8, 0x72, 0x35, 0x7A, 0x76, 0x65,
+   0x66, 0xC1, 0x65, 0x25, 0x36, 0x27, 0x38, 0x37, 0xA2, 0x78, 0xA3, 0x68, 0x4E, 0x2D, 0xA3, 0x68,
+   0xA2, 0x79, 0x4E, 0x5B, 0x53, 0x2F, 0x21, 0x9D, 0x9A, 0x62, 0x9C, 0x89, 0x55, 0x46, 0x59, 0xA2,
+   0x66, 0x5E, 0xA2, 0x76, 0xA2, 0x77, 0x4D, 0xA2, 0x87, 0x5E, 0x55, 0xC0, 0x16, 0x66, 0x66, 0x7B,
+   0x62, 0x62, 0xA1, 0xA9, 0x9D, 0xAA, 0x73, 0x76, 0x0A, 0xA2, 0x98, 0x24, 0x3D, 0x7E, 0xA2, 0x77,
+   0xA3, 0x97, 0xA3, 0x87, 0xA2, 0x87, 0xA2, 0x76, 0x7E, 0x79, 0x12, 0x66, 0x7E, 0x7E, 0x65, 0xC0,
+   0x61, 0x7F, 0x00, 0x0F, 0x00, 0xA2, 0x88, 0x00, 0x11, 0x5A, 0x15, 0x6E, 0x12, 0xC0, 0x0A, 0x6F,
+   0x56, 0xC0, 0x01, 0x66, 0x03, 0x2F, 0x36, 0x3B, 0x31, 0xC0, 0x24, 0xC1, 0x2E, 0x24, 0x69, 0xC0,
+   0x29, 0x31, 0x36, 0x3B, 0x03, 0x34, 0x03, 0xA2, 0x77, 0xC0, 0x06, 0xC0, 0x09, 0x06,
+};
+
+const ili9341_image_t imagen_foto = {120, 90, sizeof(imagen_foto_data), imagen_foto_data};
+
+/* Los mismos pixeles sin comprimir, para ILI9341DrawPicture */
+const uint8_t imagen_foto_pic[] = {
+   0x7B, 0x11, 0x8B, 0xB1, 0x93, 0xF1, 0xA4, 0x50, 0xAC, 0x70, 0xB4, 0x6F, 0xBC, 0x2E, 0xCC, 0x0D,
+   0xCB, 0xAC, 0xD3, 0x4B, 0xDB, 0x2B, 0xE2, 0xEB, 0xE2, 0x89, 0xE2, 0x69, 0xEA, 0x49, 0xEA, 0x49,
+   0xF2, 0x69, 0xEA, 0x49, 0xEA, 0x69, 0xEA, 0x69, 0xE2, 0x89, 0xE2, 0xCA, 0xE3, 0x0B, 0xDB, 0x2B,
+   0xD3, 0x8C, 0xCB, 0xED, 0xC3, 0xED, 0xBC, 0x4E, 0xAC, 0x2E, 0xA4, 0x4F, 0x9C, 0x30, 0x93, 0xF0,
+   0x8B, 0x90, 0x83, 0x51, 0x72, 0xD0, 0x72, 0xB1, 0x62, 0x30, 0x62, 0x31, 0x5A, 0x10, 0x52, 0x10,
+   0x49, 0xEE, 0x41, 0xEE, 0x3A, 0x0E, 0x3A, 0x2D, 0x32, 0x4D, 0x3A, 0x8D, 0x32, 0x8D, 0x2A, 0x6C,
+   0x2A, 0x6C, 0x32, 0x8C, 0x32, 0xAD, 0x32, 0x6D, 0x3A, 0x6D, 0x3A, 0x6D, 0x3A, 0x2D, 0x42, 0x2E,
+   0x4A, 0x0F, 0x4A, 0x0F, 0x51, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x59, 0xF0, 0x62, 0x10, 0x6A, 0x71,
+   0x72, 0x91, 0x72, 0xB0, 0x7B, 0x11, 0x83, 0x51, 0x8B, 0x71, 0x83, 0x71, 0x93, 0xD1, 0x93, 0xD1,
+   0x8B, 0xB0, 0x93, 0xF1, 0x93, 0xF0, 0x94, 0x11, 0x9C, 0x31, 0x93, 0xF0, 0x93, 0xF0, 0x9C, 0x11,
+   0x9C, 0x11, 0x9C, 0x11, 0x93, 0xF1, 0x93, 0xD1, 0x8B, 0xB1, 0x8B, 0x90, 0x8B, 0xB1, 0x8B, 0xB1,
+   0x8B, 0x91, 0x8B, 0x71, 0x83, 0x51, 0x83, 0x31, 0x7A, 0xF0, 0x7B, 0x11, 0x83, 0x31, 0x83, 0x11,
+   0x7B, 0x11, 0x7B, 0x11, 0x7A, 0xF1, 0x83, 0x31, 0x7B, 0x11, 0x83, 0x31, 0x83, 0x31, 0x83, 0x51,
+   0x8B, 0x91, 0x8B, 0x71, 0x93, 0xD1, 0x8B, 0xB0, 0x93, 0xD0, 0x94, 0x10, 0x9C, 0x10, 0x9C, 0x30,
+   0xA4, 0x50, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x70, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F,
+   0x93, 0xD1, 0x9C, 0x31, 0xA4, 0x70, 0xAC, 0x4F, 0xB4, 0x4E, 0xC4, 0x2E, 0xCB, 0xED, 0xD3, 0x8C,
+   0xDB, 0x2B, 0xE2, 0xCA, 0xEA, 0xAA, 0xEA, 0x49, 0xF2, 0x49, 0xF2, 0x08, 0xFA, 0x28, 0xFA, 0x28,
+   0xFA, 0x08, 0xF2, 0x08, 0xF2, 0x08, 0xF2, 0x28, 0xF2, 0x69, 0xEA, 0x69, 0xE2, 0x89, 0xDA, 0xCA,
+   0xDB, 0x2B, 0xD3, 0x8C, 0xCB, 0xED, 0xBC, 0x0D, 0xB4, 0x4E, 0xB4, 0x6F, 0xA4, 0x50, 0x9C, 0x10,
+   0x93, 0xF1, 0x8B, 0x91, 0x7A, 0xF0, 0x72, 0xD1, 0x6A, 0x71, 0x62, 0x30, 0x5A, 0x10, 0x51, 0xEF,
+   0x52, 0x0F, 0x4A, 0x0F, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x4E, 0x3A, 0x4D, 0x32, 0x4D, 0x32, 0x6D,
+   0x32, 0x4C, 0x32, 0x6D, 0x3A, 0x6D, 0x32, 0x2D, 0x3A, 0x0D, 0x3A, 0x0D, 0x41, 0xEE, 0x49, 0xEE,
+   0x49, 0xEF, 0x51, 0xEF, 0x51, 0xCF, 0x59, 0xF0, 0x62, 0x31, 0x6A, 0x71, 0x6A, 0x71, 0x72, 0xB1,
+   0x7A, 0xF1, 0x83, 0x51, 0x8B, 0x91, 0x8B, 0x91, 0x8B, 0xB1, 0x94, 0x11, 0x94, 0x10, 0x9C, 0x30,
+   0xA4, 0x51, 0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x30, 0xA4, 0x50, 0xA4, 0x70, 0xA4, 0x50,
+   0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x30, 0xA4, 0x51, 0x9C, 0x10, 0x9C, 0x31, 0x9C, 0x11, 0x93, 0xD0,
+   0x8B, 0xD0, 0x8B, 0xB0, 0x8B, 0xB1, 0x93, 0xD1, 0x83, 0x70, 0x8B, 0x91, 0x8B, 0x91, 0x8B, 0x91,
+   0x8B, 0x91, 0x8B, 0x91, 0x8B, 0x91, 0x83, 0x50, 0x83, 0x71, 0x8B, 0xB1, 0x8B, 0x91, 0x93, 0xD1,
+   0x93, 0xD1, 0x93, 0xF1, 0x93, 0xF0, 0x94, 0x10, 0x9C, 0x10, 0x9C, 0x30, 0x9C, 0x30, 0xAC, 0x70,
+   0xA4, 0x4F, 0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x6F, 0xAC, 0x2E, 0xB4, 0x4F, 0xBC, 0x6F, 0xBC, 0x6F,
+   0x9C, 0x10, 0xA4, 0x30, 0xB4, 0x70, 0xBC, 0x2E, 0xC3, 0xED, 0xCB, 0xCD, 0xDB, 0x6C, 0xDA, 0xCA,
+   0xEA, 0xAA, 0xEA, 0x89, 0xF2, 0x49, 0xFA, 0x29, 0xF9, 0xE7, 0xF9, 0xE7, 0xFA, 0x08, 0xF9, 0xC7,
+   0xFA, 0x08, 0xF9, 0xC7, 0xF9, 0xE7, 0xF9, 0xE7, 0xFA, 0x08, 0xF2, 0x28, 0xF2, 0x89, 0xE2, 0xA9,
+   0xE2, 0xEB, 0xDB, 0x6C, 0xCB, 0x8C, 0xCC, 0x0D, 0xBC, 0x2E, 0xB4, 0x4E, 0xAC, 0x70, 0xA4, 0x51,
+   0x94, 0x11, 0x8B, 0x91, 0x83, 0x51, 0x7A, 0xF1, 0x6A, 0x70, 0x6A, 0x51, 0x5A, 0x10, 0x59, 0xF0,
+   0x51, 0xCF, 0x49, 0xCE, 0x4A, 0x0F, 0x4A, 0x2E, 0x42, 0x2E, 0x3A, 0x0D, 0x3A, 0x4E, 0x3A, 0x4E,
+   0x32, 0x2D, 0x42, 0x6E, 0x3A, 0x0D, 0x3A, 0x0D, 0x39, 0xED, 0x42, 0x0E, 0x4A, 0x0F, 0x49, 0xCE,
+   0x51, 0xCF, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x30, 0x6A, 0x71, 0x72, 0xB1, 0x7A, 0xD1, 0x7B, 0x11,
+   0x83, 0x51, 0x8B, 0x91, 0x8B, 0xD1, 0x93, 0xF1, 0x9C, 0x10, 0xA4, 0x50, 0xA4, 0x30, 0xAC, 0x70,
+   0xA4, 0x4F, 0xAC, 0x70, 0xB4, 0x70, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x4F, 0xAC, 0x2E, 0xAC, 0x4F,
+   0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x6F, 0xAC, 0x70, 0xA4, 0x2F, 0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x30,
+   0x9C, 0x30, 0x9C, 0x30, 0x9C, 0x10, 0x94, 0x10, 0x93, 0xD0, 0x93, 0xD0, 0x8B, 0xD0, 0x93, 0xF1,
+   0x8B, 0xB0, 0x8B, 0xB1, 0x8B, 0xB0, 0x8B, 0xB1, 0x8B, 0xB0, 0x8B, 0xB0, 0x93, 0xF1, 0x93, 0xF0,
+   0x94, 0x11, 0x93, 0xF0, 0x9C, 0x51, 0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x30, 0xAC, 0x70, 0xAC, 0x70,
+   0xB4, 0x70, 0xB4, 0x6F, 0xAC, 0x4E, 0xB4, 0x6F, 0xBC, 0x6F, 0xB4, 0x4E, 0xB4, 0x2E, 0xBC, 0x4E,
+   0xAC, 0x70, 0xB4, 0x4F, 0xBC, 0x4E, 0xC3, 0xED, 0xCB, 0x8C, 0xD3, 0x2B, 0xDA, 0xCA, 0xEA, 0xAA,
+   0xF2, 0x69, 0xF2, 0x08, 0xFA, 0x08, 0xF9, 0xE7, 0xF9, 0xC6, 0xF9, 0xE7, 0xF9, 0xE6, 0xFA, 0x07,
+   0xFA, 0x07, 0xF9, 0xE6, 0xF9, 0xC6, 0xF9, 0xE7, 0xF9, 0xE7, 0xFA, 0x08, 0xF2, 0x08, 0xF2, 0x89,
+   0xE2, 0xAA, 0xE3, 0x2B, 0xD3, 0x6B, 0xCB, 0xAC, 0xBB, 0xED, 0xBC, 0x6F, 0xAC, 0x4F, 0xAC, 0x70,
+   0x9C, 0x10, 0x8B, 0xB0, 0x83, 0x71, 0x7B, 0x11, 0x72, 0xB1, 0x6A, 0x71, 0x62, 0x10, 0x59, 0xF0,
+   0x51, 0xF0, 0x51, 0xEF, 0x49, 0xCE, 0x4A, 0x0F, 0x41, 0xEE, 0x42, 0x2E, 0x42, 0x4E, 0x42, 0x2E,
+   0x3A, 0x0D, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x0E, 0x41, 0xEE, 0x4A, 0x0F, 0x49, 0xCF, 0x5A, 0x10,
+   0x59, 0xF0, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x71, 0x72, 0xB1, 0x72, 0xD1, 0x83, 0x51, 0x83, 0x50,
+   0x8B, 0xB0, 0x93, 0xF1, 0x93, 0xF0, 0x9C, 0x10, 0xAC, 0x70, 0xA4, 0x4F, 0xAC, 0x4F, 0xAC, 0x4E,
+   0xB4, 0x6F, 0xBC, 0x6F, 0xBC, 0x4F, 0xBC, 0x2E, 0xBC, 0x2E, 0xBC, 0x2E, 0xC4, 0x4E, 0xBC, 0x4E,
+   0xBC, 0x4E, 0xB4, 0x2E, 0xBC, 0x4E, 0xB4, 0x4E, 0xB4, 0x2E, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F,
+   0xAC, 0x4F, 0xA4, 0x50, 0xAC, 0x70, 0x9C, 0x2F, 0x9C, 0x10, 0x9C, 0x30, 0x9C, 0x10, 0x93, 0xF0,
+   0x94, 0x10, 0x9C, 0x31, 0x9C, 0x31, 0x9C, 0x31, 0x93, 0xF0, 0x9C, 0x10, 0x9C, 0x31, 0x94, 0x10,
+   0x9C, 0x30, 0x9C, 0x10, 0xA4, 0x71, 0xA4, 0x50, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x6F,
+   0xAC, 0x4F, 0xB4, 0x4F, 0xBC, 0x6F, 0xB4, 0x4E, 0xBC, 0x4E, 0xBC, 0x4E, 0xBC, 0x4E, 0xC4, 0x4E,
+   0xB4, 0x6F, 0xBC, 0x4E, 0xCC, 0x0D, 0xCB, 0x8C, 0xDB, 0x0B, 0xE2, 0xCA, 0xEA, 0x69, 0xF2, 0x49,
+   0xFA, 0x28, 0xF9, 0xC7, 0xF9, 0xE7, 0xFA, 0x07, 0xF9, 0xE6, 0xF9, 0xC5, 0xF9, 0xE6, 0xFA, 0x06,
+   0xFA, 0x06, 0xF9, 0xE6, 0xF9, 0xC6, 0xF9, 0xC6, 0xF9, 0xE7, 0xF9, 0xE7, 0xF1, 0xE7, 0xF2, 0x28,
+   0xEA, 0xAA, 0xE2, 0xCA, 0xDB, 0x4C, 0xD3, 0xAD, 0xCC, 0x0D, 0xBC, 0x4E, 0xB4, 0x6F, 0xA4, 0x4F,
+   0xA4, 0x51, 0x93, 0xF1, 0x83, 0x70, 0x83, 0x31, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x51, 0x5A, 0x10,
+   0x59, 0xF0, 0x51, 0xEF, 0x49, 0xCF, 0x49, 0xEF, 0x4A, 0x0F, 0x41, 0xEE, 0x41, 0xED, 0x39, 0xED,
+   0x42, 0x2E, 0x42, 0x0E, 0x4A, 0x0E, 0x4A, 0x0F, 0x49, 0xEF, 0x52, 0x10, 0x5A, 0x10, 0x59, 0xF0,
+   0x62, 0x31, 0x62, 0x30, 0x6A, 0x71, 0x72, 0xB1, 0x7B, 0x11, 0x83, 0x51, 0x8B, 0xB1, 0x8B, 0xB0,
+   0x94, 0x10, 0xA4, 0x50, 0xA4, 0x50, 0xAC, 0x4F, 0xAC, 0x4F, 0xBC, 0x6F, 0xBC, 0x6F, 0xBC, 0x2E,
+   0xBC, 0x0D, 0xC4, 0x0D, 0xC3, 0xED, 0xC3, 0xCD, 0xC3, 0xCD, 0xCB, 0xED, 0xCB, 0xED, 0xC3, 0xCC,
+   0xC3, 0xCD, 0xCC, 0x0D, 0xC4, 0x0D, 0xC4, 0x2E, 0xC4, 0x2E, 0xBC, 0x2E, 0xBC, 0x6F, 0xB4, 0x2E,
+   0xB4, 0x6F, 0xB4, 0x4F, 0xAC, 0x2F, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x70,
+   0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x30, 0x9C, 0x10, 0x9C, 0x30, 0xA4, 0x50, 0x9C, 0x30,
+   0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x2F, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F,
+   0xB4, 0x4F, 0xB4, 0x2E, 0xBC, 0x4E, 0xBC, 0x2E, 0xC4, 0x4E, 0xBC, 0x0D, 0xC4, 0x4E, 0xC4, 0x2E,
+   0xBC, 0x4E, 0xC3, 0xED, 0xD3, 0x8C, 0xDB, 0x0B, 0xE2, 0xCA, 0xEA, 0x69, 0xFA, 0x29, 0xFA, 0x08,
+   0xF9, 0xC6, 0xF9, 0xE6, 0xF9, 0xC6, 0xF9, 0xE6, 0xF9, 0xE5, 0xFA, 0x26, 0xFA, 0x05, 0xFA, 0x26,
+   0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xF9, 0xE6, 0xF9, 0xE6, 0xF9, 0xC7, 0xFA, 0x08, 0xF2, 0x08,
+   0xF2, 0x69, 0xE2, 0x89, 0xDB, 0x0B, 0xD3, 0x6C, 0xCB, 0xED, 0xBC, 0x2E, 0xB4, 0x2E, 0xA4, 0x2F,
+   0xA4, 0x50, 0x9C, 0x11, 0x93, 0xB1, 0x83, 0x51, 0x7A, 0xF1, 0x72, 0x91, 0x6A, 0x30, 0x62, 0x10,
+   0x5A, 0x10, 0x5A, 0x10, 0x51, 0xEF, 0x52, 0x0F, 0x49, 0xEF, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F,
+   0x49, 0xEE, 0x41, 0xEE, 0x49, 0xCE, 0x49, 0xEF, 0x51, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x31,
+   0x62, 0x30, 0x6A, 0x50, 0x72, 0xD1, 0x7A, 0xD0, 0x83, 0x51, 0x8B, 0xB1, 0x8B, 0xB0, 0x9C, 0x31,
+   0x9C, 0x30, 0xA4, 0x4F, 0xB4, 0x70, 0xB4, 0x4F, 0xBC, 0x4E, 0xC4, 0x4E, 0xC4, 0x2E, 0xCB, 0xED,
+   0xCB, 0xED, 0xD3, 0xAD, 0xD3, 0xAC, 0xD3, 0xAC, 0xD3, 0x6C, 0xDB, 0x8C, 0xD3, 0x4B, 0xD3, 0x8C,
+   0xD3, 0x8C, 0xD3, 0x8C, 0xCB, 0x8C, 0xCB, 0xAC, 0xCB, 0xCD, 0xC3, 0xCC, 0xC3, 0xED, 0xC4, 0x0D,
+   0xC4, 0x4E, 0xBC, 0x4F, 0xB4, 0x2E, 0xB4, 0x4F, 0xB4, 0x4F, 0xAC, 0x4F, 0xAC, 0x2F, 0xAC, 0x70,
+   0xAC, 0x50, 0xA4, 0x4F, 0xA4, 0x4F, 0xA4, 0x50, 0xA4, 0x2F, 0xA4, 0x50, 0xA4, 0x2F, 0xA4, 0x50,
+   0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xB4, 0x70, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x2E,
+   0xB4, 0x2E, 0xB4, 0x2E, 0xBC, 0x2E, 0xBC, 0x2E, 0xC4, 0x2E, 0xBC, 0x0D, 0xC4, 0x2E, 0xC3, 0xED,
+   0xC3, 0xED, 0xCB, 0x8C, 0xDB, 0x4B, 0xE2, 0xAA, 0xEA, 0x49, 0xF2, 0x08, 0xF9, 0xE7, 0xF9, 0xE7,
+   0xF9, 0xE6, 0xFA, 0x06, 0xF9, 0xE5, 0xFA, 0x26, 0xFA, 0x25, 0xFA, 0x45, 0xFA, 0x45, 0xFA, 0x66,
+   0xFA, 0x46, 0xFA, 0x25, 0xFA, 0x05, 0xFA, 0x26, 0xF9, 0xE6, 0xFA, 0x07, 0xF9, 0xE7, 0xFA, 0x08,
+   0xF2, 0x28, 0xEA, 0x89, 0xDA, 0xCA, 0xD3, 0x6C, 0xCB, 0xCD, 0xBB, 0xED, 0xB4, 0x6F, 0xAC, 0x4F,
+   0x9C, 0x30, 0x93, 0xF0, 0x8B, 0x91, 0x83, 0x31, 0x7A, 0xD1, 0x6A, 0x70, 0x6A, 0x71, 0x59, 0xF0,
+   0x59, 0xF0, 0x5A, 0x10, 0x51, 0xEF, 0x52, 0x0F, 0x49, 0xEF, 0x4A, 0x0F, 0x4A, 0x0F, 0x41, 0xCE,
+   0x49, 0xCE, 0x49, 0xEF, 0x52, 0x0F, 0x49, 0xCF, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x10, 0x6A, 0x51,
+   0x72, 0x91, 0x72, 0xB1, 0x7A, 0xF1, 0x83, 0x51, 0x8B, 0x91, 0x94, 0x11, 0x9C, 0x30, 0xA4, 0x70,
+   0xAC, 0x70, 0xB4, 0x6F, 0xBC, 0x4F, 0xBC, 0x0D, 0xC3, 0xED, 0xCC, 0x0D, 0xCB, 0x8C, 0xD3, 0xAC,
+   0xD3, 0x4B, 0xD3, 0x2B, 0xDB, 0x2B, 0xDB, 0x2B, 0xDB, 0x0B, 0xDA, 0xEA, 0xE3, 0x0B, 0xE3, 0x0B,
+   0xDA, 0xEA, 0xDB, 0x2B, 0xD3, 0x2B, 0xD3, 0x2B, 0xD3, 0x6C, 0xD3, 0xAC, 0xD3, 0xAD, 0xCB, 0xED,
+   0xC3, 0xCD, 0xC4, 0x0D, 0xC4, 0x2E, 0xBC, 0x2E, 0xBC, 0x4E, 0xB4, 0x2E, 0xB4, 0x6F, 0xAC, 0x4F,
+   0xB4, 0x70, 0xAC, 0x6F, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x4F, 0xAC, 0x70, 0xAC, 0x70,
+   0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x6F, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x4F, 0xB4, 0x4F, 0xBC, 0x6F,
+   0xBC, 0x4E, 0xBC, 0x2E, 0xBC, 0x4E, 0xBC, 0x2E, 0xBC, 0x0D, 0xC4, 0x0D, 0xC4, 0x0D, 0xC4, 0x0D,
+   0xD3, 0xCD, 0xDB, 0x4B, 0xE2, 0xCA, 0xEA, 0x69, 0xF2, 0x08, 0xFA, 0x08, 0xFA, 0x07, 0xF9, 0xE6,
+   0xF9, 0xE6, 0xFA, 0x26, 0xFA, 0x46, 0xFA, 0x66, 0xFA, 0x45, 0xFA, 0x65, 0xFA, 0x86, 0xFA, 0x65,
+   0xFA, 0x66, 0xFA, 0x25, 0xFA, 0x46, 0xF9, 0xE5, 0xFA, 0x06, 0xF9, 0xE7, 0xFA, 0x07, 0xF9, 0xE8,
+   0xF2, 0x28, 0xEA, 0x89, 0xDA, 0xCA, 0xD3, 0x2B, 0xCB, 0xAC, 0xC4, 0x0D, 0xB4, 0x4F, 0xAC, 0x2F,
+   0xA4, 0x70, 0x93, 0xF0, 0x93, 0xD1, 0x83, 0x30, 0x7A, 0xF1, 0x72, 0xB1, 0x6A, 0x71, 0x62, 0x31,
+   0x59, 0xF0, 0x59, 0xF0, 0x5A, 0x10, 0x52, 0x10, 0x49, 0xEF, 0x4A, 0x0F, 0x49, 0xEF, 0x49, 0xEF,
+   0x52, 0x0F, 0x52, 0x10, 0x49, 0xCF, 0x51, 0xF0, 0x51, 0xCF, 0x62, 0x10, 0x62, 0x10, 0x6A, 0x71,
+   0x72, 0xB1, 0x7A, 0xF1, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xF1, 0x9C, 0x31, 0x9C, 0x30, 0xAC, 0x4F,
+   0xB4, 0x6F, 0xBC, 0x4F, 0xBC, 0x0D, 0xCC, 0x0D, 0xD3, 0xED, 0xD3, 0x8C, 0xD3, 0x4B, 0xDB, 0x4B,
+   0xE3, 0x0B, 0xE2, 0xCA, 0xE2, 0xAA, 0xE2, 0xAA, 0xE2, 0xAA, 0xEA, 0xAA, 0xE2, 0xAA, 0xE2, 0x89,
+   0xE2, 0x89, 0xE2, 0xCA, 0xE2, 0xCA, 0xDA, 0xEA, 0xDB, 0x0B, 0xDB, 0x4B, 0xD3, 0x4B, 0xD3, 0x8C,
+   0xD3, 0xCD, 0xCB, 0xCD, 0xCB, 0xED, 0xC4, 0x0D, 0xBC, 0x0D, 0xBC, 0x4E, 0xBC, 0x4E, 0xB4, 0x4E,
+   0xB4, 0x4F, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F,
+   0xAC, 0x4F, 0xB4, 0x70, 0xAC, 0x4F, 0xAC, 0x2E, 0xB4, 0x6F, 0xB4, 0x4E, 0xBC, 0x6F, 0xBC, 0x6F,
+   0xBC, 0x4E, 0xBC, 0x2E, 0xBC, 0x2E, 0xC4, 0x2E, 0xBC, 0x0D, 0xC4, 0x2E, 0xC4, 0x0E, 0xC3, 0xED,
+   0xDB, 0x4C, 0xE2, 0xEA, 0xEA, 0xAA, 0xF2, 0x49, 0xFA, 0x08, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xC5,
+   0xFA, 0x05, 0xFA, 0x25, 0xFA, 0x45, 0xFA, 0x45, 0xFA, 0x85, 0xFA, 0x85, 0xFA, 0xA5, 0xFA, 0x85,
+   0xFA, 0x85, 0xFA, 0x65, 0xFA, 0x25, 0xFA, 0x06, 0xF9, 0xE5, 0xF9, 0xE6, 0xF9, 0xE7, 0xF9, 0xE7,
+   0xF2, 0x28, 0xEA, 0x89, 0xE2, 0xEA, 0xD3, 0x4B, 0xCB, 0xAC, 0xBC, 0x0D, 0xB4, 0x2E, 0xAC, 0x70,
+   0x9C, 0x30, 0x93, 0xF0, 0x8B, 0xB1, 0x83, 0x51, 0x7A, 0xD1, 0x72, 0x91, 0x6A, 0x71, 0x62, 0x10,
+   0x62, 0x10, 0x5A, 0x10, 0x51, 0xEF, 0x51, 0xEF, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xCE, 0x49, 0xCF,
+   0x49, 0xCF, 0x51, 0xEF, 0x51, 0xEF, 0x5A, 0x10, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x71, 0x6A, 0x70,
+   0x7A, 0xD1, 0x83, 0x31, 0x8B, 0x91, 0x8B, 0xB0, 0x94, 0x10, 0xA4, 0x50, 0xAC, 0x70, 0xB4, 0x4F,
+   0xBC, 0x4F, 0xBC, 0x0D, 0xCC, 0x0D, 0xCB, 0xAC, 0xD3, 0x6C, 0xDB, 0x2B, 0xE3, 0x0B, 0xE2, 0xCA,
+   0xEA, 0xAA, 0xEA, 0x69, 0xEA, 0x69, 0xF2, 0x89, 0xEA, 0x48, 0xF2, 0x49, 0xEA, 0x28, 0xEA, 0x49,
+   0xEA, 0x49, 0xEA, 0x89, 0xEA, 0x89, 0xEA, 0xAA, 0xE2, 0xAA, 0xE2, 0xEA, 0xDA, 0xEA, 0xDB, 0x4C,
+   0xDB, 0x8C, 0xD3, 0xAC, 0xCB, 0xCD, 0xC3, 0xCD, 0xC4, 0x0D, 0xC4, 0x0D, 0xC4, 0x4E, 0xBC, 0x4E,
+   0xB4, 0x2E, 0xB4, 0x6F, 0xAC, 0x2E, 0xB4, 0x6F, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F,
+   0xAC, 0x4F, 0xB4, 0x6F, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F, 0xBC, 0x6F,
+   0xBC, 0x4F, 0xBC, 0x4F, 0xBC, 0x2E, 0xBC, 0x0D, 0xC4, 0x0E, 0xC4, 0x0D, 0xC3, 0xED, 0xC4, 0x0D,
+   0xE3, 0x2B, 0xE2, 0xAA, 0xF2, 0x69, 0xFA, 0x28, 0xF9, 0xC7, 0xF9, 0xC6, 0xF9, 0xE6, 0xFA, 0x06,
+   0xFA, 0x05, 0xFA, 0x45, 0xFA, 0x45, 0xFA, 0x85, 0xFA, 0xA5, 0xFA, 0x84, 0xFA, 0xA5, 0xFA, 0x64,
+   0xFA, 0x65, 0xFA, 0x65, 0xFA, 0x46, 0xFA, 0x05, 0xFA, 0x06, 0xF9, 0xC6, 0xF9, 0xE7, 0xF9, 0xE7,
+   0xF2, 0x28, 0xEA, 0xAA, 0xE3, 0x0B, 0xD3, 0x6C, 0xCB, 0xCD, 0xC4, 0x2E, 0xB4, 0x2E, 0xAC, 0x4F,
+   0x9C, 0x30, 0x93, 0xF0, 0x8B, 0x91, 0x7B, 0x31, 0x7A, 0xF1, 0x72, 0xB1, 0x6A, 0x51, 0x62, 0x31,
+   0x62, 0x10, 0x51, 0xCF, 0x51, 0xCF, 0x49, 0xCF, 0x51, 0xEF, 0x49, 0xEF, 0x49, 0xCE, 0x52, 0x0F,
+   0x51, 0xEF, 0x51, 0xEF, 0x51, 0xEF, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x51, 0x72, 0x91, 0x72, 0xB1,
+   0x7A, 0xF1, 0x83, 0x51, 0x8B, 0xB1, 0x93, 0xF0, 0xA4, 0x51, 0xA4, 0x50, 0xB4, 0x6F, 0xB4, 0x4F,
+   0xC4, 0x4E, 0xC3, 0xED, 0xD3, 0xCD, 0xD3, 0x4B, 0xD3, 0x0A, 0xE2, 0xEA, 0xE2, 0xAA, 0xEA, 0x89,
+   0xEA, 0x49, 0xF2, 0x49, 0xF2, 0x28, 0xFA, 0x29, 0xF2, 0x08, 0xFA, 0x28, 0xF2, 0x28, 0xF2, 0x28,
+   0xF2, 0x28, 0xF2, 0x28, 0xEA, 0x28, 0xEA, 0x49, 0xEA, 0x89, 0xE2, 0x89, 0xE2, 0xEB, 0xDB, 0x0B,
+   0xDB, 0x4C, 0xD3, 0x4B, 0xCB, 0x6C, 0xCB, 0x8C, 0xCB, 0xED, 0xC4, 0x0D, 0xBC, 0x0D, 0xBC, 0x0E,
+   0xBC, 0x4E, 0xB4, 0x4F, 0xB4, 0x6F, 0xB4, 0x4F, 0xAC, 0x2E, 0xB4, 0x6F, 0xAC, 0x6F, 0xB4, 0x70,
+   0xAC, 0x4F, 0xB4, 0x70, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F, 0xB4, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F,
+   0xB4, 0x2E, 0xB4, 0x2E, 0xBC, 0x4F, 0xBC, 0x0D, 0xBC, 0x0D, 0xC4, 0x0D, 0xC4, 0x0D, 0xC3, 0xED,
+   0xE2, 0xEB, 0xEA, 0x89, 0xF2, 0x28, 0xFA, 0x28, 0xF9, 0xE7, 0xF9, 0xC6, 0xF9, 0xE5, 0xFA, 0x26,
+   0xFA, 0x25, 0xFA, 0x45, 0xFA, 0x85, 0xFA, 0xA5, 0xFA, 0xC5, 0xFA, 0xA5, 0xFA, 0xA5, 0xFA, 0xA5,
+   0xFA, 0x64, 0xFA, 0x86, 0xFA, 0x25, 0xFA, 0x26, 0xF9, 0xE6, 0xF9, 0xE6, 0xFA, 0x07, 0xF9, 0xE8,
+   0xF2, 0x49, 0xEA, 0xAA, 0xDA, 0xEA, 0xCB, 0x4B, 0xC3, 0xCD, 0xBC, 0x0D, 0xB4, 0x6F, 0xAC, 0x70,
+   0x9C, 0x30, 0x93, 0xF1, 0x83, 0x71, 0x83, 0x31, 0x7A, 0xD1, 0x72, 0x91, 0x62, 0x30, 0x62, 0x10,
+   0x51, 0xCF, 0x59, 0xF0, 0x52, 0x10, 0x51, 0xEF, 0x49, 0xCE, 0x52, 0x0F, 0x49, 0xCE, 0x49, 0xEF,
+   0x51, 0xEF, 0x51, 0xCF, 0x51, 0xF0, 0x59, 0xF0, 0x62, 0x30, 0x62, 0x30, 0x72, 0x91, 0x72, 0xD1,
+   0x83, 0x31, 0x83, 0x71, 0x8B, 0xB0, 0x9C, 0x31, 0xA4, 0x50, 0xAC, 0x70, 0xB4, 0x4F, 0xBC, 0x4E,
+   0xC3, 0xED, 0xCB, 0xAC, 0xD3, 0x6B, 0xD3, 0x0A, 0xDA, 0xCA, 0xE2, 0x89, 0xEA, 0x69, 0xF2, 0x49,
+   0xF2, 0x29, 0xF2, 0x08, 0xFA, 0x08, 0xFA, 0x28, 0xF9, 0xE7, 0xF9, 0xE7, 0xFA, 0x08, 0xFA, 0x28,
+   0xF1, 0xE7, 0xFA, 0x08, 0xF2, 0x28, 0xF2, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xE2, 0xAA, 0xE2, 0xCA,
+   0xDB, 0x0B, 0xDB, 0x4B, 0xCB, 0x4B, 0xCB, 0x8C, 0xCB, 0xCD, 0xCC, 0x0D, 0xC4, 0x2E, 0xBC, 0x2E,
+   0xB4, 0x2E, 0xBC, 0x6F, 0xB4, 0x4E, 0xB4, 0x4F, 0xAC, 0x4F, 0xB4, 0x70, 0xAC, 0x4F, 0xAC, 0x4F,
+   0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xB4, 0x4F, 0xB4, 0x6F,
+   0xB4, 0x2E, 0xB4, 0x4E, 0xBC, 0x4E, 0xB4, 0x2E, 0xBC, 0x2E, 0xBC, 0x0D, 0xBC, 0x2E, 0xBC, 0x0D,
+   0xE2, 0xAA, 0xF2, 0x89, 0xFA, 0x08, 0xF9, 0xC7, 0xF9, 0xE7, 0xFA, 0x06, 0xF9, 0xE5, 0xFA, 0x26,
+   0xFA, 0x25, 0xFA, 0x65, 0xFA, 0x85, 0xFA, 0xA5, 0xFA, 0xA5, 0xFA, 0x84, 0xFA, 0xA5, 0xFA, 0xA5,
+   0xFA, 0x65, 0xFA, 0x25, 0xFA, 0x05, 0xFA, 0x06, 0xFA, 0x07, 0xF9, 0xE7, 0xF9, 0xE7, 0xF2, 0x08,
+   0xEA, 0x69, 0xE2, 0xCA, 0xDB, 0x4C, 0xCB, 0xAC, 0xCC, 0x2E, 0xBC, 0x4E, 0xB4, 0x70, 0xA4, 0x30,
+   0x94, 0x10, 0x93, 0xD1, 0x8B, 0x71, 0x7A, 0xD1, 0x72, 0xB1, 0x6A, 0x71, 0x62, 0x31, 0x62, 0x10,
+   0x59, 0xF0, 0x51, 0xCF, 0x49, 0xEF, 0x49, 0xCF, 0x49, 0xCE, 0x4A, 0x0F, 0x49, 0xCE, 0x52, 0x0F,
+   0x49, 0xCF, 0x51, 0xEF, 0x59, 0xF0, 0x59, 0xEF, 0x62, 0x31, 0x6A, 0x51, 0x6A, 0x70, 0x7A, 0xF1,
+   0x83, 0x31, 0x8B, 0x91, 0x93, 0xF1, 0x9C, 0x10, 0xA4, 0x70, 0xAC, 0x4F, 0xB4, 0x2E, 0xC4, 0x4E,
+   0xCB, 0xED, 0xCB, 0x8C, 0xDB, 0x6C, 0xDA, 0xEA, 0xEA, 0xAA, 0xEA, 0x8A, 0xF2, 0x69, 0xF2, 0x28,
+   0xFA, 0x28, 0xFA, 0x28, 0xFA, 0x08, 0xF9, 0xE7, 0xFA, 0x07, 0xF9, 0xE7, 0xF9, 0xC7, 0xF9, 0xE7,
+   0xF9, 0xE7, 0xFA, 0x08, 0xF2, 0x08, 0xF2, 0x28, 0xF2, 0x49, 0xF2, 0x8A, 0xE2, 0x69, 0xE2, 0xCA,
+   0xE3, 0x0B, 0xDB, 0x2B, 0xDB, 0x8C, 0xD3, 0xAC, 0xC3, 0xAC, 0xC3, 0xED, 0xBC, 0x0D, 0xBC, 0x2E,
+   0xBC, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x6F, 0xAC, 0x4F, 0xAC, 0x70,
+   0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x4F,
+   0xB4, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x2E, 0xB4, 0x2E, 0xBC, 0x4F, 0xBC, 0x0D, 0xBC, 0x0E,
+   0xEA, 0xAA, 0xF2, 0x49, 0xFA, 0x08, 0xFA, 0x08, 0xF9, 0xE7, 0xFA, 0x07, 0xF9, 0xE5, 0xFA, 0x46,
+   0xFA, 0x66, 0xFA, 0x65, 0xFA, 0x65, 0xFA, 0x85, 0xFA, 0xA5, 0xFA, 0xA5, 0xFA, 0x85, 0xFA, 0x65,
+   0xFA, 0x45, 0xFA, 0x25, 0xFA, 0x06, 0xF9, 0xE6, 0xF9, 0xC6, 0xF9, 0xE7, 0xF9, 0xE7, 0xF2, 0x49,
+   0xEA, 0x89, 0xDA, 0xEA, 0xD3, 0x4B, 0xCB, 0xCD, 0xC4, 0x2E, 0xB4, 0x6F, 0xAC, 0x70, 0x9C, 0x30,
+   0x93, 0xF1, 0x8B, 0x91, 0x83, 0x31, 0x72, 0xB0, 0x6A, 0x50, 0x6A, 0x51, 0x62, 0x10, 0x59, 0xEF,
+   0x51, 0xCF, 0x49, 0xCF, 0x49, 0xEF, 0x49, 0xCE, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xEF,
+   0x52, 0x10, 0x51, 0xEF, 0x59, 0xF0, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x71, 0x72, 0x91, 0x72, 0xD0,
+   0x83, 0x51, 0x8B, 0x90, 0x93, 0xD0, 0x9C, 0x10, 0xA4, 0x2F, 0xAC, 0x4F, 0xBC, 0x4E, 0xC4, 0x0D,
+   0xCB, 0xCD, 0xD3, 0x8C, 0xDB, 0x0B, 0xE2, 0xEB, 0xEA, 0xAA, 0xF2, 0x69, 0xFA, 0x49, 0xFA, 0x28,
+   0xFA, 0x08, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xC7, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xC7, 0xFA, 0x08,
+   0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x28, 0xF2, 0x69, 0xEA, 0x49, 0xE2, 0x69, 0xE2, 0xCA,
+   0xDA, 0xCA, 0xDB, 0x4C, 0xDB, 0x8C, 0xD3, 0xAC, 0xCB, 0xED, 0xC4, 0x0D, 0xBC, 0x0D, 0xBC, 0x4E,
+   0xBC, 0x6F, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x4F, 0xA4, 0x2F,
+   0xA4, 0x70, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x70, 0xA4, 0x50, 0xA4, 0x2F, 0xA4, 0x4F,
+   0xAC, 0x70, 0xAC, 0x2F, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x4E, 0xB4, 0x4F, 0xB4, 0x2E, 0xBC, 0x6F,
+   0xE2, 0x89, 0xF2, 0x69, 0xF1, 0xE8, 0xFA, 0x08, 0xF9, 0xE7, 0xF9, 0xE6, 0xF9, 0xE5, 0xFA, 0x05,
+   0xFA, 0x25, 0xFA, 0x45, 0xFA, 0x45, 0xFA, 0x85, 0xFA, 0xA5, 0xFA, 0x85, 0xFA, 0x45, 0xFA, 0x66,
+   0xFA, 0x46, 0xFA, 0x05, 0xFA, 0x26, 0xF9, 0xE6, 0xFA, 0x07, 0xF9, 0xC7, 0xF2, 0x08, 0xEA, 0x89,
+   0xE2, 0xCA, 0xD3, 0x0B, 0xCB, 0x8C, 0xC3, 0xED, 0xBC, 0x6F, 0xAC, 0x2F, 0xA4, 0x30, 0x9C, 0x11,
+   0x8B, 0xB1, 0x83, 0x51, 0x7A, 0xF1, 0x72, 0x91, 0x62, 0x30, 0x59, 0xF0, 0x59, 0xF0, 0x51, 0xF0,
+   0x49, 0xCF, 0x49, 0xEF, 0x4A, 0x0F, 0x4A, 0x0E, 0x41, 0xEE, 0x41, 0xEE, 0x4A, 0x0F, 0x49, 0xEF,
+   0x49, 0xCF, 0x49, 0xCF, 0x5A, 0x10, 0x59, 0xF0, 0x62, 0x51, 0x6A, 0x71, 0x6A, 0x70, 0x7A, 0xF1,
+   0x83, 0x31, 0x8B, 0xB1, 0x93, 0xF0, 0xA4, 0x51, 0xA4, 0x2F, 0xB4, 0x4E, 0xC4, 0x4E, 0xC3, 0xCD,
+   0xCB, 0x8C, 0xD3, 0x4B, 0xDA, 0xCA, 0xE2, 0xCA, 0xEA, 0x49, 0xEA, 0x28, 0xFA, 0x29, 0xFA, 0x08,
+   0xF9, 0xE7, 0xF9, 0xC7, 0xF9, 0xC7, 0xF9, 0xC7, 0xF9, 0xE7, 0xFA, 0x07, 0xF9, 0xE7, 0xF9, 0xC6,
+   0xF9, 0xC7, 0xF9, 0xC7, 0xFA, 0x28, 0xF2, 0x08, 0xF2, 0x28, 0xEA, 0x69, 0xEA, 0xAA, 0xE2, 0xAA,
+   0xDB, 0x0B, 0xDB, 0x4C, 0xCB, 0x6B, 0xCB, 0xCD, 0xCC, 0x0D, 0xC4, 0x0D, 0xBC, 0x2E, 0xBC, 0x4E,
+   0xB4, 0x6F, 0xAC, 0x2F, 0xAC, 0x4F, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x70, 0x9C, 0x30, 0xA4, 0x50,
+   0x9C, 0x30, 0xA4, 0x51, 0x9C, 0x10, 0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x51, 0xA4, 0x50, 0xA4, 0x50,
+   0xAC, 0x70, 0xA4, 0x2F, 0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x2E,
+   0xEA, 0xAA, 0xEA, 0x28, 0xF2, 0x08, 0xF9, 0xE7, 0xF9, 0xC6, 0xF9, 0xC6, 0xF9, 0xE6, 0xFA, 0x26,
+   0xFA, 0x26, 0xFA, 0x25, 0xFA, 0x25, 0xFA, 0x66, 0xFA, 0x45, 0xFA, 0x66, 0xFA, 0x25, 0xFA, 0x26,
+   0xFA, 0x06, 0xFA, 0x06, 0xF9, 0xE6, 0xFA, 0x07, 0xF9, 0xE7, 0xFA, 0x29, 0xF2, 0x69, 0xE2, 0xAA,
+   0xDB, 0x0B, 0xCB, 0x6C, 0xCC, 0x0D, 0xBC, 0x2E, 0xAC, 0x2E, 0xA4, 0x50, 0x9C, 0x10, 0x93, 0xF1,
+   0x8B, 0x91, 0x7A, 0xF1, 0x72, 0x91, 0x6A, 0x50, 0x62, 0x31, 0x59, 0xEF, 0x5A, 0x10, 0x51, 0xEF,
+   0x49, 0xEE, 0x41, 0xEE, 0x42, 0x0E, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x2E, 0x41, 0xEE, 0x4A, 0x0F,
+   0x49, 0xEE, 0x52, 0x0F, 0x51, 0xF0, 0x51, 0xCF, 0x59, 0xF0, 0x6A, 0x51, 0x72, 0x91, 0x7A, 0xD1,
+   0x83, 0x31, 0x8B, 0xB1, 0x9C, 0x31, 0x9C, 0x10, 0xAC, 0x70, 0xB4, 0x6F, 0xBC, 0x2E, 0xC3, 0xED,
+   0xD3, 0xAC, 0xDB, 0x6C, 0xE3, 0x0B, 0xE2, 0x89, 0xEA, 0x69, 0xF2, 0x28, 0xF1, 0xE8, 0xFA, 0x08,
+   0xF9, 0xC7, 0xF9, 0xE7, 0xF9, 0xC7, 0xF9, 0xC6, 0xF9, 0xE7, 0xFA, 0x07, 0xF9, 0xC7, 0xFA, 0x07,
+   0xF9, 0xE7, 0xFA, 0x08, 0xF9, 0xE7, 0xFA, 0x28, 0xEA, 0x28, 0xEA, 0x69, 0xE2, 0xAA, 0xDA, 0xCA,
+   0xDB, 0x0B, 0xD3, 0x4B, 0xD3, 0xAC, 0xCB, 0xCD, 0xC4, 0x0D, 0xBC, 0x2E, 0xB4, 0x2E, 0xB4, 0x6F,
+   0xB4, 0x6F, 0xA4, 0x4F, 0xA4, 0x2F, 0xA4, 0x50, 0x9C, 0x10, 0x9C, 0x31, 0x93, 0xF0, 0x9C, 0x11,
+   0x93, 0xF0, 0x93, 0xF0, 0x93, 0xF0, 0x93, 0xF0, 0x9C, 0x11, 0x9C, 0x31, 0x9C, 0x10, 0xA4, 0x51,
+   0xA4, 0x51, 0x9C, 0x30, 0xA4, 0x70, 0xA4, 0x70, 0xA4, 0x4F, 0xA4, 0x4F, 0xAC, 0x4F, 0xB4, 0x70,
+   0xEA, 0xCA, 0xEA, 0x69, 0xF2, 0x08, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xE6, 0xFA, 0x06,
+   0xFA, 0x26, 0xFA, 0x05, 0xFA, 0x05, 0xFA, 0x05, 0xFA, 0x25, 0xFA, 0x26, 0xFA, 0x26, 0xFA, 0x06,
+   0xF9, 0xE6, 0xFA, 0x07, 0xF9, 0xC7, 0xFA, 0x08, 0xF2, 0x08, 0xF2, 0x69, 0xE2, 0x89, 0xDA, 0xEA,
+   0xDB, 0x8C, 0xCB, 0xED, 0xBC, 0x0D, 0xB4, 0x2E, 0xA4, 0x4F, 0xA4, 0x51, 0x93, 0xD0, 0x83, 0x70,
+   0x83, 0x31, 0x72, 0xB1, 0x6A, 0x50, 0x59, 0xF0, 0x5A, 0x10, 0x5A, 0x10, 0x52, 0x0F, 0x4A, 0x0F,
+   0x42, 0x0E, 0x42, 0x2E, 0x42, 0x2E, 0x3A, 0x0D, 0x3A, 0x0D, 0x3A, 0x2D, 0x42, 0x2E, 0x42, 0x0E,
+   0x41, 0xEE, 0x49, 0xCE, 0x51, 0xCF, 0x59, 0xF0, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x70, 0x7A, 0xF1,
+   0x83, 0x31, 0x8B, 0x90, 0x9C, 0x11, 0xA4, 0x30, 0xAC, 0x4F, 0xB4, 0x4E, 0xBC, 0x0D, 0xC3, 0xED,
+   0xD3, 0xAC, 0xDB, 0x6C, 0xDA, 0xCA, 0xE2, 0x89, 0xEA, 0x49, 0xFA, 0x49, 0xFA, 0x28, 0xF9, 0xE7,
+   0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xE7, 0xFA, 0x07, 0xF9, 0xC6, 0xF9, 0xC7,
+   0xF9, 0xE7, 0xFA, 0x08, 0xF2, 0x08, 0xFA, 0x49, 0xEA, 0x69, 0xEA, 0xAA, 0xE2, 0xCA, 0xDB, 0x0B,
+   0xD3, 0x4B, 0xD3, 0x8C, 0xC3, 0xAC, 0xC4, 0x2E, 0xBC, 0x0D, 0xB4, 0x4E, 0xB4, 0x4F, 0xAC, 0x4F,
+   0xAC, 0x70, 0x9C, 0x30, 0x9C, 0x30, 0x9C, 0x31, 0x93, 0xF0, 0x94, 0x11, 0x93, 0xF1, 0x8B, 0xB1,
+   0x93, 0xD1, 0x93, 0xD1, 0x8B, 0xB0, 0x8B, 0xB1, 0x8B, 0xB1, 0x8B, 0xB0, 0x93, 0xD0, 0x93, 0xF1,
+   0x93, 0xF1, 0x9C, 0x10, 0x9C, 0x30, 0x9C, 0x30, 0x9C, 0x30, 0xA4, 0x30, 0xAC, 0x70, 0xA4, 0x4F,
+   0xDA, 0xAA, 0xE2, 0x69, 0xF2, 0x49, 0xF2, 0x08, 0xF9, 0xE7, 0xF9, 0xC7, 0xFA, 0x07, 0xF9, 0xE6,
+   0xFA, 0x07, 0xF9, 0xE5, 0xFA, 0x26, 0xFA, 0x06, 0xF9, 0xE5, 0xF9, 0xE6, 0xF9, 0xE6, 0xF9, 0xE6,
+   0xFA, 0x07, 0xF9, 0xE7, 0xF9, 0xC7, 0xFA, 0x28, 0xEA, 0x49, 0xEA, 0xCA, 0xDA, 0xEA, 0xD3, 0x6C,
+   0xC3, 0xAC, 0xC4, 0x4E, 0xB4, 0x6F, 0xAC, 0x70, 0x9C, 0x30, 0x93, 0xF1, 0x8B, 0x91, 0x83, 0x31,
+   0x72, 0xB1, 0x6A, 0x71, 0x62, 0x10, 0x51, 0xCF, 0x51, 0xEF, 0x49, 0xEF, 0x41, 0xCE, 0x42, 0x0E,
+   0x42, 0x4E, 0x3A, 0x2D, 0x3A, 0x6D, 0x3A, 0x6D, 0x32, 0x4D, 0x3A, 0x4D, 0x3A, 0x4D, 0x42, 0x4E,
+   0x39, 0xED, 0x4A, 0x0F, 0x49, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x30, 0x6A, 0x50, 0x7A, 0xD1,
+   0x7B, 0x11, 0x8B, 0x91, 0x9C, 0x11, 0x9C, 0x10, 0xAC, 0x70, 0xB4, 0x4E, 0xBC, 0x2E, 0xCC, 0x0D,
+   0xCB, 0x8C, 0xD3, 0x2B, 0xE2, 0xEB, 0xEA, 0xAA, 0xF2, 0x89, 0xFA, 0x49, 0xFA, 0x28, 0xFA, 0x08,
+   0xF9, 0xE7, 0xF9, 0xC7, 0xF9, 0xE7, 0xFA, 0x07, 0xFA, 0x07, 0xF9, 0xE7, 0xF9, 0xC7, 0xF9, 0xE7,
+   0xF9, 0xE7, 0xF1, 0xE7, 0xF2, 0x08, 0xF2, 0x69, 0xEA, 0x8A, 0xE2, 0xCA, 0xDA, 0xCA, 0xD3, 0x2B,
+   0xCB, 0x6C, 0xCB, 0xAC, 0xBB, 0xED, 0xBC, 0x2E, 0xB4, 0x4E, 0xAC, 0x4F, 0xA4, 0x2F, 0xA4, 0x50,
+   0x9C, 0x10, 0x9C, 0x31, 0x94, 0x11, 0x93, 0xF1, 0x8B, 0x90, 0x8B, 0x91, 0x8B, 0x91, 0x83, 0x71,
+   0x8B, 0x71, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51, 0x83, 0x50, 0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0xB1,
+   0x8B, 0xB1, 0x8B, 0xB0, 0x93, 0xD1, 0x93, 0xD0, 0x9C, 0x31, 0x9C, 0x31, 0x9C, 0x30, 0xA4, 0x50,
+   0xDA, 0xEA, 0xE2, 0xAA, 0xEA, 0x69, 0xF2, 0x28, 0xFA, 0x08, 0xFA, 0x08, 0xF9, 0xC7, 0xFA, 0x07,
+   0xF9, 0xC6, 0xF9, 0xE6, 0xF9, 0xC6, 0xFA, 0x07, 0xF9, 0xE6, 0xFA, 0x07, 0xF9, 0xE7, 0xF9, 0xC6,
+   0xFA, 0x08, 0xFA, 0x28, 0xF2, 0x28, 0xEA, 0x69, 0xEA, 0xCA, 0xDB, 0x2B, 0xD3, 0x4B, 0xCB, 0xED,
+   0xC4, 0x2E, 0xBC, 0x6F, 0xA4, 0x2F, 0xA4, 0x30, 0x9C, 0x11, 0x8B, 0x71, 0x7B, 0x10, 0x72, 0xB1,
+   0x6A, 0x51, 0x62, 0x10, 0x51, 0xCF, 0x49, 0xCF, 0x49, 0xEF, 0x41, 0xEE, 0x3A, 0x0D, 0x3A, 0x4D,
+   0x3A, 0x6D, 0x32, 0x8D, 0x32, 0xAD, 0x2A, 0x8C, 0x32, 0x8C, 0x32, 0x8D, 0x32, 0x6D, 0x3A, 0x4D,
+   0x3A, 0x2D, 0x42, 0x0E, 0x4A, 0x0F, 0x49, 0xCF, 0x5A, 0x10, 0x62, 0x10, 0x6A, 0x71, 0x72, 0xB1,
+   0x7A, 0xF1, 0x83, 0x71, 0x93, 0xD1, 0x9C, 0x30, 0xAC, 0x70, 0xB4, 0x6F, 0xB4, 0x0E, 0xC3, 0xED,
+   0xCB, 0x8C, 0xD3, 0x4B, 0xE3, 0x0B, 0xEA, 0xCA, 0xEA, 0x69, 0xF2, 0x49, 0xF2, 0x28, 0xF9, 0xE7,
+   0xFA, 0x08, 0xF9, 0xE7, 0xFA, 0x07, 0xF9, 0xC7, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xE7, 0xF9, 0xE7,
+   0xFA, 0x08, 0xF2, 0x08, 0xF2, 0x69, 0xEA, 0x89, 0xE2, 0x89, 0xE3, 0x0B, 0xD3, 0x0B, 0xD3, 0x8C,
+   0xCB, 0xED, 0xBB, 0xED, 0xBC, 0x4E, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x50, 0xA4, 0x70, 0x9C, 0x10,
+   0x93, 0xF1, 0x93, 0xD1, 0x8B, 0xB1, 0x8B, 0x91, 0x83, 0x30, 0x7B, 0x11, 0x7B, 0x11, 0x7A, 0xF1,
+   0x72, 0xD0, 0x7A, 0xF1, 0x7A, 0xD1, 0x7A, 0xF1, 0x7A, 0xD1, 0x7B, 0x11, 0x83, 0x31, 0x7B, 0x10,
+   0x83, 0x31, 0x83, 0x30, 0x83, 0x50, 0x8B, 0x91, 0x93, 0xD1, 0x93, 0xD1, 0x93, 0xD0, 0x9C, 0x11,
+   0xD3, 0x2B, 0xE3, 0x0B, 0xEA, 0xCA, 0xEA, 0x69, 0xF2, 0x69, 0xF2, 0x08, 0xFA, 0x08, 0xFA, 0x08,
+   0xF9, 0xE7, 0xF9, 0xC7, 0xF9, 0xC6, 0xF9, 0xE7, 0xF9, 0xC7, 0xFA, 0x07, 0xF9, 0xC7, 0xFA, 0x08,
+   0xFA, 0x29, 0xEA, 0x49, 0xEA, 0x89, 0xE2, 0xCA, 0xDB, 0x2B, 0xD3, 0xAC, 0xCC, 0x0D, 0xC4, 0x4E,
+   0xB4, 0x4E, 0xAC, 0x70, 0xA4, 0x50, 0x93, 0xF1, 0x8B, 0x71, 0x7B, 0x11, 0x7A, 0xD1, 0x6A, 0x50,
+   0x62, 0x10, 0x5A, 0x10, 0x51, 0xEF, 0x4A, 0x0F, 0x3A, 0x0D, 0x3A, 0x4D, 0x32, 0x4C, 0x2A, 0x6C,
+   0x2A, 0xAC, 0x2A, 0xAB, 0x2A, 0xEC, 0x2A, 0xCC, 0x2A, 0xCC, 0x2A, 0xCC, 0x2A, 0x8C, 0x32, 0x8D,
+   0x32, 0x2D, 0x42, 0x2E, 0x4A, 0x0F, 0x49, 0xEF, 0x51, 0xF0, 0x59, 0xF0, 0x62, 0x30, 0x6A, 0x70,
+   0x72, 0xD0, 0x83, 0x51, 0x93, 0xD1, 0x9C, 0x30, 0xA4, 0x50, 0xAC, 0x4F, 0xB4, 0x4E, 0xC4, 0x2E,
+   0xCB, 0xAC, 0xD3, 0x6C, 0xDB, 0x0B, 0xE2, 0xCA, 0xEA, 0xAA, 0xF2, 0x49, 0xFA, 0x49, 0xF1, 0xE7,
+   0xFA, 0x08, 0xF9, 0xE7, 0xFA, 0x08, 0xFA, 0x08, 0xF9, 0xE7, 0xFA, 0x08, 0xF9, 0xE7, 0xF2, 0x08,
+   0xF2, 0x28, 0xF2, 0x69, 0xEA, 0x69, 0xE2, 0xA9, 0xE3, 0x0B, 0xD3, 0x2B, 0xD3, 0xAC, 0xCB, 0xED,
+   0xC4, 0x2E, 0xBC, 0x4E, 0xB4, 0x4F, 0xAC, 0x4F, 0xA4, 0x70, 0x9C, 0x30, 0x94, 0x10, 0x93, 0xF1,
+   0x8B, 0x91, 0x83, 0x71, 0x7B, 0x31, 0x7A, 0xF1, 0x7A, 0xD1, 0x72, 0xB1, 0x72, 0x91, 0x72, 0x91,
+   0x6A, 0x70, 0x72, 0x91, 0x6A, 0x71, 0x6A, 0x71, 0x6A, 0x91, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xD1,
+   0x72, 0xB0, 0x7A, 0xD1, 0x83, 0x11, 0x7B, 0x11, 0x8B, 0x71, 0x8B, 0x71, 0x8B, 0xB1, 0x8B, 0xB1,
+   0xD3, 0x6C, 0xD3, 0x2B, 0xE3, 0x0B, 0xE2, 0xA9, 0xE2, 0x69, 0xEA, 0x49, 0xF2, 0x49, 0xF2, 0x08,
+   0xF2, 0x08, 0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x28, 0xFA, 0x49, 0xF2, 0x28, 0xEA, 0x49,
+   0xE2, 0x69, 0xE2, 0xCA, 0xE3, 0x2B, 0xDB, 0x6C, 0xCB, 0x8C, 0xC3, 0xED, 0xC4, 0x4E, 0xAC, 0x2E,
+   0xAC, 0x4F, 0xA4, 0x51, 0x93, 0xF1, 0x8B, 0x91, 0x7B, 0x11, 0x72, 0xB1, 0x6A, 0x51, 0x59, 0xF0,
+   0x51, 0xF0, 0x49, 0xCF, 0x42, 0x0E, 0x3A, 0x2E, 0x32, 0x4D, 0x2A, 0x6C, 0x2A, 0xCC, 0x2A, 0xEC,
+   0x23, 0x0B, 0x23, 0x0B, 0x23, 0x0B, 0x23, 0x0B, 0x23, 0x0B, 0x2B, 0x0B, 0x22, 0xAB, 0x2A, 0xAC,
+   0x32, 0x6C, 0x3A, 0x4D, 0x3A, 0x0D, 0x4A, 0x0F, 0x52, 0x0F, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x50,
+   0x7A, 0xD1, 0x7B, 0x10, 0x93, 0xD1, 0x9C, 0x11, 0xA4, 0x30, 0xAC, 0x4F, 0xB4, 0x4E, 0xBC, 0x0D,
+   0xC3, 0xAC, 0xCB, 0x6C, 0xDB, 0x4C, 0xDA, 0xCA, 0xEA, 0xCA, 0xEA, 0x69, 0xF2, 0x49, 0xF2, 0x28,
+   0xFA, 0x29, 0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x08, 0xF1, 0xE7, 0xF1, 0xE8, 0xFA, 0x29, 0xF2, 0x49,
+   0xF2, 0x69, 0xEA, 0x89, 0xE2, 0xAA, 0xDB, 0x0B, 0xD3, 0x2B, 0xCB, 0x8C, 0xC3, 0xCC, 0xBB, 0xED,
+   0xBC, 0x4E, 0xB4, 0x4F, 0xAC, 0x70, 0xA4, 0x30, 0x9C, 0x51, 0x93, 0xF1, 0x8B, 0xB1, 0x83, 0x51,
+   0x7B, 0x10, 0x7B, 0x11, 0x72, 0xB1, 0x72, 0xB1, 0x6A, 0x71, 0x6A, 0x51, 0x6A, 0x30, 0x6A, 0x31,
+   0x6A, 0x51, 0x62, 0x30, 0x62, 0x10, 0x62, 0x30, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x71, 0x62, 0x30,
+   0x6A, 0x71, 0x72, 0x91, 0x72, 0x91, 0x7A, 0xD1, 0x7A, 0xD1, 0x7B, 0x11, 0x83, 0x31, 0x8B, 0x71,
+   0xCB, 0xAC, 0xD3, 0xAC, 0xDB, 0x6C, 0xDB, 0x0B, 0xE2, 0xCA, 0xE2, 0xA9, 0xEA, 0x89, 0xEA, 0x89,
+   0xF2, 0x89, 0xF2, 0x69, 0xEA, 0x28, 0xEA, 0x49, 0xEA, 0x69, 0xEA, 0x69, 0xE2, 0x89, 0xE2, 0xCA,
+   0xDA, 0xEB, 0xDB, 0x4C, 0xD3, 0x8C, 0xC3, 0xAC, 0xC4, 0x2E, 0xBC, 0x2E, 0xB4, 0x6F, 0xAC, 0x70,
+   0x9C, 0x10, 0x93, 0xF1, 0x8B, 0x91, 0x7A, 0xF1, 0x6A, 0x90, 0x6A, 0x50, 0x62, 0x30, 0x51, 0xF0,
+   0x4A, 0x0F, 0x41, 0xEE, 0x3A, 0x2D, 0x32, 0x8D, 0x32, 0xCC, 0x2B, 0x0C, 0x23, 0x2B, 0x1B, 0x2A,
+   0x1B, 0x4A, 0x23, 0x8B, 0x1B, 0x6A, 0x1B, 0x6A, 0x1B, 0x6A, 0x23, 0x4B, 0x23, 0x2B, 0x2B, 0x0C,
+   0x32, 0xCC, 0x32, 0x6D, 0x3A, 0x4D, 0x41, 0xED, 0x4A, 0x0F, 0x51, 0xF0, 0x5A, 0x10, 0x6A, 0x51,
+   0x72, 0x90, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xF1, 0x9C, 0x30, 0xA4, 0x4F, 0xB4, 0x4F, 0xBC, 0x0D,
+   0xC3, 0xED, 0xCB, 0xAC, 0xD3, 0x2B, 0xDB, 0x2B, 0xE2, 0xCA, 0xEA, 0x89, 0xEA, 0x69, 0xF2, 0x69,
+   0xF2, 0x28, 0xF2, 0x28, 0xFA, 0x49, 0xFA, 0x29, 0xF2, 0x28, 0xF2, 0x69, 0xF2, 0x69, 0xEA, 0x89,
+   0xEA, 0xAA, 0xE2, 0xCA, 0xDB, 0x0B, 0xDB, 0x6C, 0xD3, 0xCD, 0xC3, 0xCC, 0xC4, 0x4E, 0xB4, 0x2E,
+   0xB4, 0x4F, 0xAC, 0x70, 0x9C, 0x30, 0x9C, 0x11, 0x93, 0xF1, 0x8B, 0x91, 0x83, 0x31, 0x7A, 0xD1,
+   0x72, 0xD1, 0x6A, 0x71, 0x6A, 0x51, 0x62, 0x10, 0x59, 0xF0, 0x62, 0x10, 0x59, 0xEF, 0x59, 0xF0,
+   0x51, 0xEF, 0x59, 0xF0, 0x51, 0xCF, 0x51, 0xF0, 0x59, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x5A, 0x10,
+   0x62, 0x31, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x51, 0x72, 0x91, 0x72, 0x91, 0x72, 0xB1, 0x7A, 0xF1,
+   0xC4, 0x0D, 0xCB, 0xED, 0xCB, 0x8C, 0xD3, 0x8C, 0xD3, 0x2B, 0xDB, 0x0B, 0xE3, 0x0B, 0xE2, 0xEA,
+   0xE2, 0xCA, 0xE2, 0xCA, 0xE2, 0xAA, 0xE2, 0xCA, 0xDA, 0xCA, 0xE2, 0xEB, 0xDB, 0x0A, 0xD3, 0x2B,
+   0xD3, 0x6C, 0xCB, 0xAC, 0xC3, 0xED, 0xBC, 0x2E, 0xB4, 0x6F, 0xAC, 0x2F, 0xA4, 0x2F, 0x9C, 0x31,
+   0x8B, 0xB0, 0x83, 0x51, 0x7A, 0xD1, 0x72, 0xB1, 0x6A, 0x51, 0x59, 0xF0, 0x51, 0xEF, 0x49, 0xEE,
+   0x42, 0x2E, 0x3A, 0x4D, 0x2A, 0x8C, 0x2A, 0xCB, 0x23, 0x2B, 0x23, 0x6B, 0x1B, 0xAA, 0x1B, 0xAA,
+   0x13, 0xA9, 0x13, 0xC9, 0x13, 0xC9, 0x13, 0xC9, 0x13, 0xA9, 0x1B, 0xAA, 0x1B, 0x6A, 0x1B, 0x0A,
+   0x2B, 0x0C, 0x2A, 0xAC, 0x32, 0x6D, 0x42, 0x4E, 0x41, 0xEE, 0x49, 0xCF, 0x59, 0xF0, 0x62, 0x30,
+   0x72, 0xB1, 0x7A, 0xD1, 0x83, 0x51, 0x93, 0xD1, 0x94, 0x10, 0xA4, 0x50, 0xAC, 0x2F, 0xBC, 0x6F,
+   0xC4, 0x2E, 0xCB, 0xED, 0xD3, 0x8C, 0xDB, 0x4C, 0xDA, 0xEB, 0xE2, 0xAA, 0xE2, 0x89, 0xEA, 0x69,
+   0xEA, 0x69, 0xF2, 0x69, 0xEA, 0x49, 0xEA, 0x28, 0xF2, 0x89, 0xEA, 0x89, 0xEA, 0xAA, 0xE2, 0xAA,
+   0xDA, 0xCA, 0xDB, 0x0B, 0xD3, 0x4B, 0xCB, 0xAC, 0xC3, 0xCD, 0xBC, 0x2E, 0xBC, 0x6F, 0xB4, 0x6F,
+   0xA4, 0x2F, 0x9C, 0x10, 0x93, 0xF0, 0x93, 0xD1, 0x83, 0x71, 0x7A, 0xF1, 0x72, 0xB1, 0x6A, 0x70,
+   0x62, 0x30, 0x62, 0x10, 0x59, 0xF0, 0x5A, 0x10, 0x52, 0x10, 0x51, 0xEF, 0x49, 0xEF, 0x49, 0xCE,
+   0x49, 0xCE, 0x4A, 0x0F, 0x49, 0xEE, 0x4A, 0x0F, 0x52, 0x0F, 0x49, 0xEF, 0x51, 0xEF, 0x51, 0xF0,
+   0x51, 0xEF, 0x59, 0xF0, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x51, 0x62, 0x30, 0x6A, 0x71, 0x72, 0x91,
+   0xBC, 0x4E, 0xC4, 0x2E, 0xC4, 0x0D, 0xCB, 0xED, 0xCB, 0xAC, 0xD3, 0xAC, 0xD3, 0x6B, 0xD3, 0x2B,
+   0xD3, 0x2B, 0xD3, 0x2B, 0xD3, 0x2B, 0xD3, 0x2B, 0xD3, 0x4B, 0xD3, 0x6C, 0xCB, 0x8C, 0xCB, 0xED,
+   0xC3, 0xED, 0xBC, 0x0D, 0xBC, 0x4E, 0xAC, 0x2E, 0xA4, 0x2F, 0x9C, 0x30, 0x9C, 0x11, 0x93, 0xD1,
+   0x83, 0x30, 0x7A, 0xD1, 0x6A, 0x70, 0x6A, 0x31, 0x59, 0xF0, 0x49, 0xCF, 0x4A, 0x0F, 0x3A, 0x2E,
+   0x32, 0x6D, 0x32, 0xCC, 0x22, 0xEB, 0x1B, 0x2A, 0x1B, 0x6A, 0x13, 0xA9, 0x13, 0xC9, 0x0B, 0xE9,
+   0x0C, 0x09, 0x0C, 0x29, 0x0C, 0x09, 0x0B, 0xC8, 0x0B, 0xC9, 0x13, 0xEA, 0x1B, 0xAA, 0x1B, 0x6A,
+   0x23, 0x4B, 0x2A, 0xEC, 0x32, 0xAD, 0x3A, 0x6E, 0x42, 0x0E, 0x49, 0xCE, 0x51, 0xF0, 0x59, 0xF0,
+   0x6A, 0x51, 0x72, 0xB1, 0x7B, 0x11, 0x8B, 0x91, 0x9C, 0x11, 0xA4, 0x50, 0xAC, 0x6F, 0xB4, 0x4E,
+   0xBC, 0x0D, 0xCC, 0x0D, 0xD3, 0xCD, 0xDB, 0x8C, 0xD3, 0x0A, 0xDA, 0xEA, 0xE2, 0xCA, 0xE2, 0xAA,
+   0xEA, 0x89, 0xE2, 0x69, 0xEA, 0x8A, 0xEA, 0x8A, 0xEA, 0xAA, 0xE2, 0xAA, 0xDA, 0xCA, 0xDA, 0xEA,
+   0xDB, 0x4C, 0xD3, 0x6C, 0xCB, 0xCD, 0xC3, 0xED, 0xBC, 0x4E, 0xB4, 0x6F, 0xAC, 0x6F, 0xA4, 0x50,
+   0x9C, 0x10, 0x93, 0xF1, 0x8B, 0xB1, 0x83, 0x31, 0x72, 0xD1, 0x72, 0x91, 0x62, 0x30, 0x59, 0xF0,
+   0x5A, 0x10, 0x51, 0xCF, 0x51, 0xEF, 0x49, 0xCE, 0x41, 0xEE, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x2E,
+   0x3A, 0x2D, 0x42, 0x2E, 0x3A, 0x0D, 0x42, 0x2E, 0x3A, 0x0D, 0x42, 0x0E, 0x42, 0x0E, 0x41, 0xCE,
+   0x49, 0xEF, 0x52, 0x0F, 0x49, 0xCF, 0x51, 0xCF, 0x59, 0xF0, 0x59, 0xF0, 0x62, 0x10, 0x6A, 0x30,
+   0xB4, 0x6F, 0xB4, 0x2E, 0xBC, 0x4E, 0xC4, 0x4E, 0xC3, 0xED, 0xC3, 0xCD, 0xCB, 0xCD, 0xCB, 0xCD,
+   0xCB, 0xAC, 0xCB, 0x8C, 0xCB, 0xCD, 0xCB, 0xCD, 0xC3, 0xAC, 0xC3, 0xCD, 0xC4, 0x0D, 0xBC, 0x0D,
+   0xBC, 0x4E, 0xB4, 0x4F, 0xB4, 0x70, 0xA4, 0x2F, 0x9C, 0x10, 0x93, 0xD0, 0x83, 0x70, 0x83, 0x31,
+   0x72, 0xB1, 0x6A, 0x50, 0x62, 0x10, 0x59, 0xF0, 0x52, 0x10, 0x41, 0xEE, 0x3A, 0x4E, 0x32, 0x6C,
+   0x2A, 0xEC, 0x23, 0x2B, 0x1B, 0x6A, 0x13, 0x89, 0x13, 0xE9, 0x0C, 0x09, 0x0C, 0x29, 0x04, 0x28,
+   0x04, 0x07, 0x04, 0x28, 0x04, 0x28, 0x04, 0x08, 0x03, 0xE8, 0x0C, 0x09, 0x13, 0xC9, 0x1B, 0xCA,
+   0x1B, 0x6A, 0x23, 0x0B, 0x2A, 0xAB, 0x32, 0x6D, 0x42, 0x4E, 0x41, 0xEE, 0x52, 0x10, 0x59, 0xF0,
+   0x6A, 0x30, 0x72, 0x91, 0x83, 0x31, 0x83, 0x71, 0x94, 0x11, 0x9C, 0x50, 0xA4, 0x2F, 0xB4, 0x6F,
+   0xBC, 0x4E, 0xC4, 0x0D, 0xC3, 0xCC, 0xD3, 0xAC, 0xD3, 0x4B, 0xDB, 0x2B, 0xDB, 0x0B, 0xDA, 0xCA,
+   0xDA, 0xAA, 0xE2, 0xCA, 0xE2, 0xCA, 0xDA, 0xAA, 0xE2, 0xEA, 0xDB, 0x0B, 0xDB, 0x2B, 0xDB, 0x8C,
+   0xD3, 0xAD, 0xC3, 0xAC, 0xBB, 0xED, 0xBC, 0x2E, 0xB4, 0x6F, 0xAC, 0x4F, 0xA4, 0x50, 0x9C, 0x10,
+   0x93, 0xD1, 0x8B, 0x71, 0x83, 0x31, 0x72, 0xB1, 0x72, 0x91, 0x62, 0x30, 0x5A, 0x10, 0x51, 0xCF,
+   0x49, 0xCF, 0x4A, 0x0F, 0x42, 0x0E, 0x3A, 0x0D, 0x3A, 0x2D, 0x3A, 0x6D, 0x3A, 0x8D, 0x32, 0x6C,
+   0x32, 0x8C, 0x32, 0x8C, 0x32, 0xAD, 0x32, 0xAD, 0x32, 0x6C, 0x32, 0x4D, 0x32, 0x2D, 0x3A, 0x4D,
+   0x42, 0x2E, 0x41, 0xEE, 0x4A, 0x0F, 0x52, 0x0F, 0x51, 0xEF, 0x59, 0xF0, 0x62, 0x10, 0x62, 0x10,
+   0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x6F, 0xBC, 0x6F, 0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E,
+   0xBC, 0x0D, 0xBC, 0x0D, 0xC4, 0x2E, 0xC4, 0x4E, 0xC4, 0x4E, 0xB4, 0x2E, 0xB4, 0x2E, 0xB4, 0x4F,
+   0xAC, 0x70, 0xA4, 0x50, 0xA4, 0x51, 0x93, 0xF0, 0x93, 0xF1, 0x8B, 0x71, 0x7B, 0x11, 0x72, 0x91,
+   0x6A, 0x71, 0x62, 0x10, 0x5A, 0x10, 0x49, 0xEF, 0x4A, 0x2F, 0x3A, 0x4E, 0x32, 0x8C, 0x22, 0xAB,
+   0x23, 0x2B, 0x1B, 0x8A, 0x13, 0xA9, 0x0B, 0xE9, 0x0C, 0x28, 0x04, 0x48, 0x04, 0x68, 0x04, 0x68,
+   0x04, 0x27, 0x04, 0x47, 0x04, 0x27, 0x04, 0x47, 0x04, 0x68, 0x04, 0x28, 0x03, 0xE8, 0x0B, 0xC9,
+   0x13, 0x89, 0x1B, 0x4A, 0x2B, 0x0C, 0x32, 0xAC, 0x3A, 0x4D, 0x42, 0x2E, 0x49, 0xCF, 0x59, 0xF0,
+   0x62, 0x31, 0x72, 0x91, 0x7A, 0xD1, 0x83, 0x30, 0x8B, 0xB0, 0x9C, 0x10, 0xA4, 0x50, 0xB4, 0x70,
+   0xB4, 0x2E, 0xC4, 0x4E, 0xC4, 0x0D, 0xCB, 0xCD, 0xD3, 0x8C, 0xDB, 0x6C, 0xD3, 0x2B, 0xDB, 0x4B,
+   0xDB, 0x2B, 0xDA, 0xEA, 0xDB, 0x0B, 0xDB, 0x2B, 0xDB, 0x4B, 0xD3, 0x6C, 0xD3, 0x8C, 0xCB, 0xAC,
+   0xC3, 0xED, 0xBC, 0x0D, 0xB4, 0x2E, 0xAC, 0x4F, 0xA4, 0x4F, 0x9C, 0x30, 0x9C, 0x31, 0x8B, 0xB1,
+   0x83, 0x71, 0x7A, 0xF1, 0x72, 0x91, 0x6A, 0x71, 0x62, 0x31, 0x59, 0xF0, 0x51, 0xEF, 0x41, 0xCE,
+   0x41, 0xEE, 0x3A, 0x2D, 0x3A, 0x6D, 0x2A, 0x6C, 0x2A, 0xAC, 0x2A, 0xEC, 0x2B, 0x0C, 0x22, 0xEB,
+   0x22, 0xEB, 0x2B, 0x2C, 0x23, 0x0B, 0x22, 0xEB, 0x2A, 0xEB, 0x2A, 0xCC, 0x32, 0xCC, 0x32, 0xAD,
+   0x3A, 0x8D, 0x32, 0x2D, 0x42, 0x4E, 0x41, 0xED, 0x41, 0xCE, 0x49, 0xEF, 0x52, 0x10, 0x59, 0xF0,
+   0x9C, 0x10, 0xA4, 0x30, 0xAC, 0x70, 0xAC, 0x70, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4F, 0xB4, 0x2E,
+   0xB4, 0x4E, 0xBC, 0x6F, 0xBC, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F, 0xAC, 0x6F, 0xAC, 0x70, 0xA4, 0x50,
+   0xA4, 0x50, 0x94, 0x10, 0x93, 0xF1, 0x8B, 0xB1, 0x83, 0x71, 0x7A, 0xF1, 0x72, 0x91, 0x6A, 0x71,
+   0x62, 0x31, 0x51, 0xCF, 0x49, 0xEF, 0x42, 0x0E, 0x3A, 0x6D, 0x2A, 0x8C, 0x22, 0xCB, 0x23, 0x6B,
+   0x1B, 0xAA, 0x13, 0xE9, 0x0C, 0x08, 0x04, 0x48, 0x04, 0x68, 0x04, 0x68, 0x04, 0x47, 0x04, 0x46,
+   0x04, 0x46, 0x04, 0x67, 0x04, 0x47, 0x04, 0x47, 0x04, 0x68, 0x04, 0x68, 0x0C, 0x48, 0x0B, 0xE8,
+   0x13, 0xC9, 0x1B, 0x8A, 0x23, 0x0B, 0x2A, 0xAB, 0x32, 0x6D, 0x3A, 0x0D, 0x49, 0xEF, 0x5A, 0x10,
+   0x62, 0x31, 0x6A, 0x71, 0x72, 0xB0, 0x7B, 0x10, 0x8B, 0x91, 0x9C, 0x11, 0xA4, 0x50, 0xAC, 0x70,
+   0xAC, 0x2E, 0xBC, 0x4E, 0xC4, 0x2E, 0xC3, 0xED, 0xCB, 0xCD, 0xCB, 0x8C, 0xD3, 0x6C, 0xD3, 0x4B,
+   0xD3, 0x2B, 0xDB, 0x6C, 0xD3, 0x4B, 0xDB, 0x6C, 0xD3, 0x6C, 0xCB, 0xAC, 0xCB, 0xED, 0xC3, 0xED,
+   0xBC, 0x0D, 0xB4, 0x2E, 0xAC, 0x2F, 0xAC, 0x70, 0x9C, 0x30, 0x93, 0xF0, 0x8B, 0xB1, 0x83, 0x51,
+   0x7A, 0xF1, 0x6A, 0x71, 0x6A, 0x51, 0x62, 0x10, 0x5A, 0x10, 0x49, 0xEF, 0x41, 0xEE, 0x3A, 0x2D,
+   0x32, 0x4C, 0x32, 0xAD, 0x2A, 0xEC, 0x23, 0x0B, 0x23, 0x2B, 0x1B, 0x4A, 0x23, 0x8A, 0x1B, 0xAA,
+   0x1B, 0x8A, 0x1B, 0x8A, 0x1B, 0x6A, 0x1B, 0x4A, 0x1B, 0x6A, 0x23, 0x4B, 0x23, 0x2B, 0x22, 0xCB,
+   0x22, 0xAB, 0x32, 0xAC, 0x32, 0x8D, 0x3A, 0x2D, 0x3A, 0x0D, 0x42, 0x0E, 0x4A, 0x0F, 0x51, 0xEF,
+   0x93, 0xF1, 0x94, 0x10, 0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x2F, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x70,
+   0xAC, 0x4F, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x2F, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x51, 0x9C, 0x31,
+   0x94, 0x11, 0x8B, 0xB1, 0x83, 0x50, 0x83, 0x51, 0x7A, 0xD1, 0x72, 0x91, 0x62, 0x30, 0x59, 0xF0,
+   0x51, 0xEF, 0x49, 0xEF, 0x42, 0x2E, 0x3A, 0x4D, 0x32, 0xAC, 0x2B, 0x0B, 0x1B, 0x2A, 0x13, 0xAA,
+   0x13, 0xE9, 0x0C, 0x29, 0x04, 0x48, 0x04, 0x68, 0x04, 0x67, 0x04, 0x67, 0x04, 0x46, 0x04, 0x46,
+   0x04, 0x66, 0x04, 0x67, 0x04, 0x66, 0x04, 0x46, 0x04, 0x26, 0x04, 0x47, 0x04, 0x27, 0x0C, 0x28,
+   0x0B, 0xC9, 0x1B, 0xAA, 0x23, 0x4B, 0x2A, 0xEC, 0x32, 0x8D, 0x3A, 0x0D, 0x41, 0xEE, 0x52, 0x10,
+   0x59, 0xF0, 0x62, 0x30, 0x72, 0xB1, 0x7B, 0x11, 0x8B, 0x91, 0x93, 0xD0, 0x9C, 0x10, 0xAC, 0x70,
+   0xAC, 0x4F, 0xB4, 0x4F, 0xBC, 0x4E, 0xBB, 0xED, 0xC3, 0xCD, 0xCB, 0xCD, 0xD3, 0xCD, 0xD3, 0x8C,
+   0xD3, 0x8C, 0xCB, 0x6C, 0xD3, 0xAC, 0xD3, 0xCD, 0xCB, 0xED, 0xC3, 0xED, 0xC4, 0x0E, 0xBC, 0x4E,
+   0xB4, 0x2E, 0xAC, 0x4F, 0xA4, 0x50, 0x9C, 0x30, 0x93, 0xF1, 0x8B, 0x91, 0x83, 0x51, 0x7A, 0xD1,
+   0x6A, 0x50, 0x6A, 0x51, 0x62, 0x10, 0x51, 0xF0, 0x49, 0xEF, 0x42, 0x2E, 0x32, 0x2D, 0x32, 0x8C,
+   0x2A, 0xEC, 0x23, 0x0B, 0x23, 0x6B, 0x1B, 0x8A, 0x13, 0xA9, 0x13, 0xA9, 0x13, 0xE9, 0x0B, 0xC9,
+   0x0B, 0xC8, 0x0B, 0xC8, 0x14, 0x09, 0x0B, 0xC9, 0x13, 0xC9, 0x1B, 0xAA, 0x1B, 0x8A, 0x1B, 0x6A,
+   0x23, 0x2B, 0x22, 0xEB, 0x32, 0xCC, 0x32, 0xAD, 0x3A, 0x6D, 0x42, 0x4E, 0x42, 0x0E, 0x49, 0xEF,
+   0x8B, 0xB1, 0x93, 0xD1, 0x94, 0x11, 0x93, 0xF0, 0x9C, 0x10, 0x9C, 0x10, 0x9C, 0x30, 0xA4, 0x50,
+   0xA4, 0x30, 0xA4, 0x50, 0x9C, 0x10, 0x9C, 0x30, 0x9C, 0x31, 0x94, 0x11, 0x93, 0xF1, 0x8B, 0xB1,
+   0x8B, 0x91, 0x83, 0x51, 0x7A, 0xD0, 0x72, 0x90, 0x6A, 0x50, 0x62, 0x30, 0x59, 0xF0, 0x49, 0xCF,
+   0x4A, 0x0F, 0x42, 0x0E, 0x3A, 0x6D, 0x32, 0xAC, 0x22, 0xCB, 0x23, 0x6B, 0x13, 0x89, 0x0B, 0xE9,
+   0x0C, 0x29, 0x04, 0x48, 0x04, 0x67, 0x04, 0x67, 0x04, 0x46, 0x04, 0x67, 0x04, 0x67, 0x04, 0x26,
+   0x04, 0x66, 0x04, 0x66, 0x04, 0x26, 0x04, 0x46, 0x04, 0x46, 0x04, 0x46, 0x04, 0x68, 0x04, 0x28,
+   0x0B, 0xE8, 0x13, 0xA9, 0x1B, 0x4A, 0x22, 0xEB, 0x2A, 0x8C, 0x3A, 0x2D, 0x4A, 0x0F, 0x51, 0xEF,
+   0x5A, 0x10, 0x6A, 0x51, 0x72, 0x91, 0x7B, 0x11, 0x83, 0x51, 0x8B, 0xB0, 0x9C, 0x31, 0x9C, 0x2F,
+   0xAC, 0x4F, 0xAC, 0x4E, 0xB4, 0x4E, 0xBC, 0x0D, 0xC4, 0x2E, 0xC3, 0xCD, 0xC3, 0xCD, 0xCB, 0xAC,
+   0xCB, 0xCD, 0xCB, 0xED, 0xCB, 0xED, 0xCB, 0xED, 0xC3, 0xED, 0xC4, 0x4E, 0xBC, 0x2E, 0xB4, 0x4F,
+   0xAC, 0x4F, 0xA4, 0x50, 0x9C, 0x30, 0x93, 0xD0, 0x8B, 0x90, 0x83, 0x31, 0x7A, 0xF1, 0x6A, 0x71,
+   0x62, 0x30, 0x59, 0xF0, 0x51, 0xEF, 0x4A, 0x0F, 0x42, 0x2E, 0x32, 0x6D, 0x2A, 0xAC, 0x2B, 0x0C,
+   0x1B, 0x4A, 0x1B, 0x6A, 0x13, 0xC9, 0x0B, 0xC9, 0x0C, 0x29, 0x0C, 0x28, 0x0C, 0x48, 0x04, 0x07,
+   0x04, 0x28, 0x0C, 0x48, 0x04, 0x48, 0x0C, 0x28, 0x0C, 0x08, 0x0C, 0x09, 0x13, 0xE9, 0x13, 0xA9,
+   0x1B, 0xAA, 0x1B, 0x4A, 0x22, 0xEB, 0x2A, 0xCC, 0x32, 0xAC, 0x3A, 0x6D, 0x42, 0x4E, 0x42, 0x0E,
+   0x8B, 0x71, 0x83, 0x71, 0x8B, 0xB1, 0x93, 0xD1, 0x93, 0xD1, 0x93, 0xF1, 0x94, 0x11, 0x94, 0x11,
+   0x9C, 0x11, 0x94, 0x11, 0x9C, 0x11, 0x93, 0xD1, 0x93, 0xF1, 0x93, 0xD1, 0x83, 0x71, 0x83, 0x30,
+   0x7B, 0x11, 0x72, 0xB0, 0x72, 0x91, 0x62, 0x30, 0x62, 0x31, 0x5A, 0x10, 0x51, 0xF0, 0x49, 0xEF,
+   0x42, 0x2E, 0x32, 0x2D, 0x32, 0xAD, 0x22, 0xCB, 0x1B, 0x4A, 0x1B, 0xAA, 0x0B, 0xE9, 0x0C, 0x29,
+   0x04, 0x68, 0x04, 0x47, 0x04, 0x46, 0x04, 0x46, 0x04, 0x26, 0x04, 0x25, 0x04, 0x25, 0x04, 0x05,
+   0x04, 0x25, 0x04, 0x25, 0x04, 0x46, 0x04, 0x67, 0x04, 0x66, 0x04, 0x47, 0x04, 0x68, 0x04, 0x28,
+   0x0C, 0x29, 0x13, 0xC9, 0x1B, 0x6A, 0x23, 0x0B, 0x2A, 0xAC, 0x3A, 0x2D, 0x41, 0xEE, 0x49, 0xCF,
+   0x51, 0xCF, 0x6A, 0x51, 0x72, 0x91, 0x7A, 0xF1, 0x83, 0x51, 0x8B, 0xB1, 0x9C, 0x11, 0x9C, 0x30,
+   0xAC, 0x70, 0xAC, 0x2F, 0xBC, 0x6F, 0xBC, 0x2E, 0xC4, 0x2E, 0xC4, 0x0D, 0xC3, 0xED, 0xC3, 0xCD,
+   0xC3, 0xCD, 0xC3, 0xCD, 0xC3, 0xED, 0xC4, 0x2E, 0xBC, 0x0D, 0xB4, 0x2E, 0xB4, 0x6F, 0xAC, 0x4F,
+   0xA4, 0x4F, 0x9C, 0x10, 0x93, 0xF0, 0x93, 0xB1, 0x83, 0x51, 0x7A, 0xF1, 0x6A, 0x50, 0x6A, 0x51,
+   0x5A, 0x10, 0x49, 0xCF, 0x4A, 0x0F, 0x3A, 0x2E, 0x3A, 0x8D, 0x2A, 0xAC, 0x23, 0x2B, 0x1B, 0x4A,
+   0x1B, 0xCA, 0x0B, 0xC8, 0x0C, 0x29, 0x04, 0x07, 0x04, 0x27, 0x04, 0x47, 0x04, 0x67, 0x04, 0x47,
+   0x04, 0x47, 0x04, 0x67, 0x04, 0x68, 0x04, 0x47, 0x04, 0x48, 0x04, 0x08, 0x0C, 0x28, 0x0B, 0xE9,
+   0x13, 0xA9, 0x1B, 0xAA, 0x23, 0x6B, 0x2B, 0x2B, 0x2A, 0xAB, 0x32, 0x8C, 0x3A, 0x4D, 0x42, 0x2E,
+   0x7A, 0xF1, 0x83, 0x31, 0x83, 0x51, 0x83, 0x50, 0x8B, 0x91, 0x83, 0x70, 0x8B, 0xB1, 0x8B, 0x90,
+   0x93, 0xD1, 0x8B, 0xB1, 0x8B, 0x91, 0x83, 0x71, 0x83, 0x51, 0x83, 0x51, 0x83, 0x31, 0x7A, 0xF1,
+   0x72, 0xB1, 0x6A, 0x50, 0x6A, 0x71, 0x62, 0x10, 0x59, 0xF0, 0x49, 0xCF, 0x49, 0xCE, 0x39, 0xED,
+   0x3A, 0x6D, 0x2A, 0x6C, 0x22, 0xCB, 0x23, 0x4B, 0x13, 0x89, 0x13, 0xC9, 0x0C, 0x29, 0x04, 0x48,
+   0x04, 0x47, 0x04, 0x67, 0x04, 0x26, 0x04, 0x66, 0x04, 0x25, 0x04, 0x46, 0x04, 0x46, 0x04, 0x26,
+   0x04, 0x26, 0x04, 0x46, 0x04, 0x25, 0x04, 0x26, 0x04, 0x46, 0x04, 0x46, 0x04, 0x68, 0x04, 0x28,
+   0x03, 0xE8, 0x0B, 0xA9, 0x23, 0x8A, 0x2B, 0x2B, 0x2A, 0xAC, 0x3A, 0x6D, 0x4A, 0x2F, 0x49, 0xEF,
+   0x5A, 0x10, 0x62, 0x30, 0x72, 0x91, 0x7A, 0xF1, 0x7B, 0x30, 0x93, 0xD1, 0x9C, 0x11, 0x9C, 0x10,
+   0xA4, 0x50, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x2E, 0xBC, 0x2E, 0xBC, 0x2E, 0xC4, 0x2E, 0xC4, 0x0D,
+   0xC4, 0x0D, 0xBC, 0x0D, 0xC4, 0x2E, 0xBC, 0x4E, 0xB4, 0x4E, 0xB4, 0x6F, 0xAC, 0x4F, 0xA4, 0x2F,
+   0x9C, 0x30, 0x93, 0xF0, 0x8B, 0x90, 0x83, 0x51, 0x7B, 0x11, 0x6A, 0x70, 0x62, 0x30, 0x59, 0xF0,
+   0x52, 0x10, 0x41, 0xCE, 0x3A, 0x0D, 0x3A, 0x8D, 0x22, 0xAB, 0x23, 0x2B, 0x13, 0x69, 0x13, 0xC9,
+   0x0B, 0xE8, 0x04, 0x28, 0x04, 0x68, 0x04, 0x67, 0x04, 0x67, 0x04, 0x67, 0x04, 0x67, 0x04, 0x46,
+   0x04, 0x67, 0x04, 0x67, 0x04, 0x46, 0x04, 0x47, 0x04, 0x26, 0x04, 0x68, 0x04, 0x27, 0x04, 0x08,
+   0x0B, 0xC8, 0x13, 0xEA, 0x1B, 0x8A, 0x23, 0x4B, 0x2B, 0x0B, 0x2A, 0xAC, 0x3A, 0x8D, 0x3A, 0x2D,
+   0x72, 0xB1, 0x7A, 0xF1, 0x83, 0x11, 0x7B, 0x11, 0x7B, 0x10, 0x83, 0x51, 0x83, 0x30, 0x83, 0x71,
+   0x83, 0x51, 0x83, 0x51, 0x83, 0x31, 0x83, 0x31, 0x7B, 0x11, 0x7A, 0xF1, 0x7A, 0xF1, 0x72, 0x91,
+   0x6A, 0x50, 0x6A, 0x51, 0x5A, 0x10, 0x59, 0xF0, 0x51, 0xEF, 0x49, 0xCE, 0x42, 0x0E, 0x3A, 0x4E,
+   0x32, 0x6C, 0x2A, 0xCC, 0x23, 0x2B, 0x1B, 0x6A, 0x13, 0xEA, 0x0B, 0xE8, 0x04, 0x28, 0x04, 0x47,
+   0x04, 0x47, 0x04, 0x26, 0x04, 0x26, 0x04, 0x66, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x26,
+   0x04, 0x26, 0x04, 0x46, 0x04, 0x46, 0x04, 0x66, 0x04, 0x66, 0x04, 0x67, 0x04, 0x27, 0x04, 0x48,
+   0x0C, 0x08, 0x13, 0xE9, 0x1B, 0x6A, 0x22, 0xEB, 0x32, 0xAC, 0x3A, 0x4D, 0x42, 0x0E, 0x51, 0xEF,
+   0x51, 0xCF, 0x62, 0x10, 0x6A, 0x50, 0x7A, 0xD1, 0x83, 0x31, 0x8B, 0xB1, 0x93, 0xF1, 0x9C, 0x30,
+   0xA4, 0x50, 0xAC, 0x4F, 0xAC, 0x2E, 0xB4, 0x4E, 0xBC, 0x4E, 0xC4, 0x4E, 0xBC, 0x0D, 0xC4, 0x4E,
+   0xBC, 0x2E, 0xC4, 0x4E, 0xBC, 0x4E, 0xBC, 0x4E, 0xB4, 0x4F, 0xAC, 0x6F, 0xAC, 0x70, 0x9C, 0x10,
+   0x9C, 0x31, 0x8B, 0xB1, 0x83, 0x50, 0x7B, 0x11, 0x72, 0x91, 0x62, 0x30, 0x62, 0x10, 0x51, 0xEF,
+   0x49, 0xCE, 0x42, 0x2E, 0x32, 0x4C, 0x32, 0xEC, 0x23, 0x0A, 0x1B, 0xAA, 0x13, 0xE9, 0x0C, 0x08,
+   0x04, 0x28, 0x04, 0x68, 0x04, 0x46, 0x04, 0x26, 0x04, 0x66, 0x04, 0x46, 0x04, 0x46, 0x04, 0x66,
+   0x04, 0x26, 0x04, 0x46, 0x04, 0x46, 0x04, 0x46, 0x04, 0x67, 0x04, 0x67, 0x04, 0x27, 0x04, 0x48,
+   0x03, 0xE8, 0x0B, 0xC8, 0x13, 0x89, 0x23, 0x8B, 0x23, 0x0B, 0x2A, 0xCC, 0x32, 0x6C, 0x3A, 0x4D,
+   0x72, 0x91, 0x6A, 0x90, 0x72, 0xB1, 0x72, 0xB1, 0x7A, 0xF1, 0x7A, 0xF1, 0x7A, 0xF1, 0x83, 0x31,
+   0x7B, 0x11, 0x7A, 0xD0, 0x72, 0xD0, 0x72, 0xD1, 0x7A, 0xD1, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x50,
+   0x62, 0x31, 0x59, 0xF0, 0x59, 0xF0, 0x52, 0x10, 0x4A, 0x0F, 0x41, 0xEE, 0x42, 0x4E, 0x32, 0x6D,
+   0x2A, 0xAC, 0x2B, 0x0C, 0x1B, 0x4A, 0x1B, 0xAA, 0x13, 0xE9, 0x04, 0x08, 0x04, 0x68, 0x04, 0x47,
+   0x04, 0x47, 0x04, 0x67, 0x04, 0x26, 0x04, 0x46, 0x04, 0x05, 0x04, 0x25, 0x04, 0x05, 0x04, 0x05,
+   0x04, 0x05, 0x04, 0x46, 0x04, 0x25, 0x04, 0x26, 0x04, 0x46, 0x04, 0x67, 0x04, 0x68, 0x04, 0x28,
+   0x0C, 0x09, 0x13, 0xA9, 0x1B, 0x4A, 0x2B, 0x0B, 0x32, 0xAD, 0x32, 0x2D, 0x41, 0xEE, 0x49, 0xCF,
+   0x5A, 0x10, 0x62, 0x30, 0x72, 0x91, 0x7A, 0xF1, 0x83, 0x71, 0x8B, 0xB1, 0x9C, 0x11, 0x9C, 0x30,
+   0xA4, 0x70, 0xAC, 0x6F, 0xB4, 0x4F, 0xB4, 0x6F, 0xB4, 0x2E, 0xBC, 0x4E, 0xBC, 0x4E, 0xBC, 0x2E,
+   0xBC, 0x4E, 0xBC, 0x4F, 0xB4, 0x4E, 0xB4, 0x4F, 0xAC, 0x4F, 0xA4, 0x4F, 0xA4, 0x30, 0x9C, 0x10,
+   0x94, 0x11, 0x8B, 0x71, 0x7B, 0x11, 0x72, 0xB1, 0x6A, 0x71, 0x62, 0x10, 0x51, 0xCF, 0x52, 0x0F,
+   0x42, 0x2E, 0x3A, 0x4D, 0x2A, 0xAC, 0x22, 0xEB, 0x1B, 0x8A, 0x13, 0xC9, 0x0C, 0x09, 0x04, 0x28,
+   0x04, 0x47, 0x04, 0x67, 0x04, 0x26, 0x04, 0x46, 0x04, 0x46, 0x04, 0x25, 0x04, 0x25, 0x04, 0x46,
+   0x04, 0x26, 0x04, 0x46, 0x04, 0x26, 0x04, 0x26, 0x04, 0x46, 0x04, 0x67, 0x04, 0x67, 0x04, 0x47,
+   0x04, 0x28, 0x0B, 0xE8, 0x13, 0xA9, 0x13, 0x49, 0x23, 0x2B, 0x2A, 0xEC, 0x2A, 0x6C, 0x3A, 0x6D,
+   0x6A, 0x71, 0x6A, 0x71, 0x72, 0xB1, 0x6A, 0x70, 0x72, 0x91, 0x72, 0xB1, 0x72, 0xB0, 0x7A, 0xD1,
+   0x72, 0xD1, 0x7A, 0xD1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0x91, 0x72, 0x91, 0x6A, 0x71, 0x62, 0x31,
+   0x5A, 0x10, 0x51, 0xCF, 0x5A, 0x10, 0x49, 0xCF, 0x4A, 0x0F, 0x42, 0x0E, 0x3A, 0x4D, 0x32, 0x6C,
+   0x2A, 0xEC, 0x23, 0x2B, 0x23, 0x8B, 0x13, 0xA9, 0x14, 0x09, 0x04, 0x28, 0x04, 0x27, 0x04, 0x67,
+   0x04, 0x46, 0x04, 0x46, 0x04, 0x26, 0x04, 0x46, 0x04, 0x25, 0x04, 0x05, 0x04, 0x26, 0x04, 0x26,
+   0x04, 0x05, 0x04, 0x26, 0x04, 0x25, 0x04, 0x46, 0x04, 0x46, 0x04, 0x47, 0x04, 0x68, 0x04, 0x08,
+   0x14, 0x09, 0x13, 0x89, 0x1B, 0x2A, 0x22, 0xAB, 0x32, 0x6C, 0x42, 0x2E, 0x41, 0xEE, 0x51, 0xEF,
+   0x5A, 0x10, 0x62, 0x30, 0x72, 0xB1, 0x7A, 0xF1, 0x83, 0x51, 0x8B, 0xB0, 0x93, 0xF0, 0x9C, 0x10,
+   0xA4, 0x50, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x4F, 0xBC, 0x4F, 0xB4, 0x2E, 0xBC, 0x2E, 0xB4, 0x2E,
+   0xBC, 0x4F, 0xB4, 0x4E, 0xB4, 0x6F, 0xB4, 0x6F, 0xAC, 0x70, 0xA4, 0x50, 0x9C, 0x30, 0x93, 0xD0,
+   0x8B, 0x90, 0x83, 0x51, 0x7A, 0xF1, 0x72, 0xB1, 0x6A, 0x51, 0x62, 0x10, 0x51, 0xEF, 0x41, 0xCE,
+   0x3A, 0x0D, 0x2A, 0x6C, 0x22, 0xCB, 0x1B, 0x4A, 0x13, 0x89, 0x0C, 0x09, 0x04, 0x28, 0x04, 0x47,
+   0x04, 0x67, 0x04, 0x46, 0x04, 0x46, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x26,
+   0x04, 0x05, 0x04, 0x26, 0x04, 0x26, 0x04, 0x66, 0x04, 0x66, 0x04, 0x46, 0x04, 0x46, 0x04, 0x68,
+   0x04, 0x48, 0x03, 0xE8, 0x13, 0xC9, 0x1B, 0x8A, 0x23, 0x4B, 0x2A, 0xCC, 0x32, 0x8C, 0x3A, 0x6E,
+   0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x50, 0x6A, 0x70, 0x6A, 0x71, 0x72, 0x91, 0x6A, 0x70,
+   0x6A, 0x70, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x71, 0x6A, 0x30, 0x6A, 0x51, 0x62, 0x10, 0x62, 0x31,
+   0x5A, 0x10, 0x59, 0xF0, 0x52, 0x10, 0x4A, 0x0F, 0x42, 0x0E, 0x3A, 0x2D, 0x3A, 0x8D, 0x32, 0xAD,
+   0x2A, 0xEB, 0x23, 0x2A, 0x1B, 0x8A, 0x13, 0xA9, 0x14, 0x29, 0x04, 0x28, 0x04, 0x48, 0x04, 0x26,
+   0x04, 0x46, 0x04, 0x46, 0x04, 0x66, 0x04, 0x26, 0x04, 0x46, 0x04, 0x46, 0x04, 0x46, 0x04, 0x46,
+   0x04, 0x46, 0x04, 0x26, 0x04, 0x67, 0x04, 0x66, 0x04, 0x67, 0x04, 0x47, 0x04, 0x48, 0x0C, 0x09,
+   0x13, 0xA9, 0x13, 0x49, 0x2B, 0x2B, 0x2A, 0xAC, 0x32, 0x4D, 0x42, 0x2E, 0x49, 0xCE, 0x51, 0xF0,
+   0x62, 0x10, 0x6A, 0x50, 0x72, 0xB1, 0x83, 0x31, 0x83, 0x71, 0x8B, 0xB0, 0x94, 0x10, 0x9C, 0x30,
+   0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x6F, 0xBC, 0x6F, 0xBC, 0x6F, 0xBC, 0x4E, 0xBC, 0x4E, 0xB4, 0x2E,
+   0xB4, 0x4E, 0xB4, 0x2E, 0xB4, 0x6F, 0xAC, 0x4F, 0xA4, 0x4F, 0xA4, 0x70, 0x94, 0x10, 0x93, 0xF1,
+   0x8B, 0xB1, 0x7B, 0x11, 0x72, 0xB1, 0x6A, 0x71, 0x59, 0xF0, 0x59, 0xF0, 0x49, 0xCE, 0x41, 0xEE,
+   0x3A, 0x4D, 0x2A, 0xAC, 0x23, 0x0A, 0x1B, 0xAA, 0x0B, 0xC9, 0x04, 0x08, 0x04, 0x68, 0x04, 0x46,
+   0x04, 0x26, 0x04, 0x26, 0x04, 0x46, 0x04, 0x26, 0x03, 0xE5, 0x04, 0x05, 0x04, 0x05, 0x03, 0xE5,
+   0x03, 0xE5, 0x04, 0x26, 0x04, 0x05, 0x04, 0x46, 0x04, 0x46, 0x04, 0x66, 0x04, 0x67, 0x04, 0x47,
+   0x04, 0x07, 0x0B, 0xE8, 0x13, 0xA9, 0x1B, 0x6A, 0x23, 0x0A, 0x22, 0xAB, 0x32, 0x8D, 0x3A, 0x4D,
+   0x62, 0x31, 0x62, 0x30, 0x62, 0x30, 0x6A, 0x71, 0x6A, 0x50, 0x6A, 0x50, 0x6A, 0x71, 0x6A, 0x50,
+   0x6A, 0x50, 0x6A, 0x71, 0x6A, 0x91, 0x6A, 0x71, 0x6A, 0x51, 0x62, 0x30, 0x59, 0xF0, 0x62, 0x10,
+   0x5A, 0x10, 0x51, 0xEF, 0x52, 0x0F, 0x49, 0xEE, 0x42, 0x2E, 0x42, 0x4E, 0x3A, 0x8D, 0x32, 0xAC,
+   0x22, 0xCB, 0x23, 0x4B, 0x1B, 0x8A, 0x13, 0xEA, 0x0B, 0xE9, 0x04, 0x28, 0x04, 0x27, 0x04, 0x47,
+   0x04, 0x46, 0x04, 0x46, 0x04, 0x26, 0x04, 0x46, 0x04, 0x46, 0x04, 0x26, 0x04, 0x25, 0x04, 0x66,
+   0x04, 0x46, 0x04, 0x26, 0x04, 0x46, 0x04, 0x46, 0x04, 0x67, 0x04, 0x68, 0x04, 0x08, 0x0B, 0xC9,
+   0x13, 0x89, 0x1B, 0x2A, 0x2A, 0xEC, 0x32, 0x8C, 0x3A, 0x2D, 0x4A, 0x0F, 0x49, 0xCF, 0x5A, 0x10,
+   0x62, 0x30, 0x6A, 0x50, 0x7A, 0xF1, 0x83, 0x31, 0x83, 0x70, 0x94, 0x11, 0x9C, 0x31, 0xA4, 0x50,
+   0xAC, 0x70, 0xB4, 0x70, 0xB4, 0x4F, 0xB4, 0x4E, 0xBC, 0x6F, 0xBC, 0x4E, 0xBC, 0x4E, 0xB4, 0x2E,
+   0xBC, 0x6F, 0xB4, 0x6F, 0xB4, 0x4F, 0xAC, 0x4F, 0xAC, 0x70, 0x9C, 0x30, 0x9C, 0x10, 0x8B, 0xB0,
+   0x83, 0x71, 0x7B, 0x11, 0x72, 0xD1, 0x62, 0x30, 0x62, 0x30, 0x51, 0xEF, 0x49, 0xEF, 0x3A, 0x0D,
+   0x32, 0x6C, 0x22, 0xCB, 0x1B, 0x4A, 0x13, 0x89, 0x0C, 0x09, 0x04, 0x28, 0x04, 0x27, 0x04, 0x46,
+   0x04, 0x66, 0x04, 0x25, 0x04, 0x26, 0x03, 0xE5, 0x03, 0xE5, 0x03, 0xE5, 0x04, 0x05, 0x04, 0x06,
+   0x03, 0xE5, 0x04, 0x26, 0x04, 0x05, 0x04, 0x26, 0x04, 0x66, 0x04, 0x67, 0x04, 0x26, 0x04, 0x68,
+   0x04, 0x28, 0x0B, 0xE8, 0x13, 0xA9, 0x23, 0x6A, 0x23, 0x0B, 0x32, 0xCD, 0x3A, 0x6D, 0x3A, 0x0D,
+   0x62, 0x10, 0x62, 0x10, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x71,
+   0x6A, 0x30, 0x6A, 0x50, 0x6A, 0x50, 0x62, 0x30, 0x6A, 0x51, 0x62, 0x10, 0x62, 0x10, 0x5A, 0x10,
+   0x51, 0xEF, 0x49, 0xCF, 0x49, 0xEF, 0x4A, 0x0F, 0x42, 0x2E, 0x3A, 0x0D, 0x32, 0x4C, 0x32, 0xAC,
+   0x22, 0xCB, 0x23, 0x2B, 0x1B, 0x6A, 0x1B, 0xCA, 0x0B, 0xC8, 0x0C, 0x29, 0x04, 0x27, 0x04, 0x27,
+   0x04, 0x67, 0x04, 0x47, 0x04, 0x67, 0x04, 0x46, 0x04, 0x66, 0x04, 0x26, 0x04, 0x66, 0x04, 0x66,
+   0x04, 0x46, 0x04, 0x67, 0x04, 0x67, 0x04, 0x68, 0x04, 0x48, 0x04, 0x08, 0x0B, 0xE9, 0x13, 0xAA,
+   0x23, 0x6B, 0x22, 0xEB, 0x32, 0xCD, 0x32, 0x2D, 0x42, 0x0E, 0x49, 0xCE, 0x51, 0xCF, 0x62, 0x10,
+   0x6A, 0x50, 0x72, 0xB1, 0x7B, 0x11, 0x8B, 0x71, 0x8B, 0xB0, 0x94, 0x10, 0x9C, 0x30, 0xA4, 0x2F,
+   0xAC, 0x6F, 0xB4, 0x4F, 0xB4, 0x4F, 0xB4, 0x2E, 0xB4, 0x2E, 0xBC, 0x2E, 0xBC, 0x4E, 0xBC, 0x4E,
+   0xBC, 0x4F, 0xBC, 0x6F, 0xAC, 0x4F, 0xAC, 0x70, 0xAC, 0x70, 0x9C, 0x10, 0x94, 0x11, 0x93, 0xD1,
+   0x83, 0x71, 0x7A, 0xF1, 0x6A, 0x70, 0x6A, 0x51, 0x59, 0xF0, 0x52, 0x10, 0x4A, 0x0F, 0x3A, 0x4E,
+   0x32, 0xAD, 0x2B, 0x0C, 0x23, 0x8B, 0x13, 0xA9, 0x0C, 0x08, 0x04, 0x48, 0x04, 0x47, 0x04, 0x67,
+   0x04, 0x25, 0x04, 0x26, 0x04, 0x05, 0x03, 0xE5, 0x03, 0xE5, 0x03, 0xC5, 0x03, 0xC5, 0x03, 0xE5,
+   0x03, 0xE5, 0x04, 0x26, 0x04, 0x26, 0x04, 0x46, 0x04, 0x66, 0x04, 0x67, 0x04, 0x67, 0x04, 0x47,
+   0x0C, 0x29, 0x0B, 0xC9, 0x1B, 0xAA, 0x23, 0x4B, 0x2A, 0xEC, 0x32, 0xAD, 0x42, 0x4E, 0x41, 0xEE,
+   0x62, 0x10, 0x62, 0x10, 0x62, 0x10, 0x62, 0x30, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x50,
+   0x6A, 0x51, 0x6A, 0x51, 0x62, 0x30, 0x6A, 0x51, 0x62, 0x30, 0x62, 0x31, 0x59, 0xF0, 0x5A, 0x10,
+   0x51, 0xCF, 0x51, 0xEF, 0x49, 0xCF, 0x49, 0xEF, 0x41, 0xED, 0x3A, 0x0D, 0x32, 0x6D, 0x32, 0x8C,
+   0x22, 0xAB, 0x22, 0xEA, 0x1B, 0x4A, 0x13, 0x69, 0x13, 0xC9, 0x0B, 0xC8, 0x0C, 0x28, 0x04, 0x28,
+   0x04, 0x68, 0x04, 0x27, 0x04, 0x67, 0x04, 0x47, 0x04, 0x67, 0x04, 0x67, 0x04, 0x67, 0x04, 0x46,
+   0x04, 0x47, 0x04, 0x67, 0x04, 0x48, 0x04, 0x28, 0x0C, 0x08, 0x0B, 0xC8, 0x13, 0xA9, 0x23, 0x6A,
+   0x22, 0xEB, 0x2A, 0xAC, 0x32, 0x6D, 0x42, 0x2E, 0x4A, 0x0F, 0x51, 0xEF, 0x59, 0xF0, 0x62, 0x10,
+   0x72, 0xB1, 0x7A, 0xF1, 0x83, 0x71, 0x8B, 0xB1, 0x93, 0xF1, 0x9C, 0x10, 0xA4, 0x50, 0xAC, 0x4F,
+   0xAC, 0x4F, 0xB4, 0x4F, 0xBC, 0x4E, 0xBC, 0x6F, 0xBC, 0x4E, 0xBC, 0x2E, 0xBC, 0x2E, 0xBC, 0x2E,
+   0xBC, 0x6F, 0xB4, 0x4E, 0xAC, 0x4F, 0xAC, 0x2F, 0xA4, 0x4F, 0xA4, 0x51, 0x9C, 0x11, 0x93, 0xD1,
+   0x83, 0x30, 0x7A, 0xF1, 0x72, 0xB1, 0x6A, 0x51, 0x59, 0xEF, 0x49, 0xCF, 0x41, 0xEE, 0x3A, 0x2D,
+   0x2A, 0x8C, 0x2B, 0x2C, 0x1B, 0x8A, 0x13, 0xE9, 0x0C, 0x08, 0x04, 0x48, 0x04, 0x26, 0x04, 0x46,
+   0x04, 0x46, 0x04, 0x25, 0x04, 0x05, 0x03, 0xE5, 0x03, 0xE5, 0x03, 0xE5, 0x03, 0xC5, 0x04, 0x05,
+   0x04, 0x05, 0x04, 0x05, 0x04, 0x26, 0x04, 0x66, 0x04, 0x46, 0x04, 0x46, 0x04, 0x68, 0x04, 0x07,
+   0x0C, 0x09, 0x1B, 0xCA, 0x1B, 0x4A, 0x2B, 0x0C, 0x2A, 0x8C, 0x32, 0x2D, 0x42, 0x2E, 0x4A, 0x0F,
+   0x59, 0xF0, 0x59, 0xF0, 0x6A, 0x51, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x51, 0x62, 0x30, 0x6A, 0x30,
+   0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x51, 0x62, 0x30, 0x62, 0x10, 0x62, 0x10, 0x59, 0xF0, 0x59, 0xF0,
+   0x5A, 0x10, 0x51, 0xCF, 0x49, 0xCF, 0x49, 0xCE, 0x4A, 0x0F, 0x3A, 0x0D, 0x3A, 0x2D, 0x32, 0x8D,
+   0x32, 0xAC, 0x2A, 0xCB, 0x23, 0x2B, 0x1B, 0x4A, 0x13, 0x8A, 0x13, 0xEA, 0x0B, 0xE9, 0x03, 0xE8,
+   0x0C, 0x48, 0x04, 0x28, 0x04, 0x27, 0x04, 0x68, 0x04, 0x47, 0x04, 0x27, 0x04, 0x47, 0x04, 0x27,
+   0x04, 0x48, 0x04, 0x27, 0x04, 0x08, 0x0B, 0xE8, 0x0B, 0xA9, 0x13, 0x89, 0x1B, 0x4A, 0x23, 0x0B,
+   0x32, 0xCC, 0x3A, 0x8D, 0x42, 0x4E, 0x41, 0xEE, 0x49, 0xCF, 0x59, 0xF0, 0x62, 0x30, 0x6A, 0x71,
+   0x7A, 0xD1, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xD0, 0x9C, 0x10, 0x9C, 0x30, 0xAC, 0x70, 0xAC, 0x4F,
+   0xB4, 0x6F, 0xBC, 0x4F, 0xBC, 0x4E, 0xBC, 0x0D, 0xC4, 0x4E, 0xBC, 0x0D, 0xC4, 0x2E, 0xBC, 0x0D,
+   0xBC, 0x2E, 0xB4, 0x2E, 0xB4, 0x4F, 0xAC, 0x6F, 0xA4, 0x2F, 0x9C, 0x10, 0x9C, 0x11, 0x93, 0xD1,
+   0x83, 0x51, 0x7B, 0x11, 0x72, 0x91, 0x62, 0x31, 0x59, 0xCF, 0x51, 0xEF, 0x42, 0x0E, 0x3A, 0x4D,
+   0x2A, 0x8C, 0x23, 0x0B, 0x1B, 0x6A, 0x13, 0xE9, 0x04, 0x08, 0x04, 0x47, 0x04, 0x26, 0x04, 0x67,
+   0x04, 0x26, 0x04, 0x26, 0x04, 0x26, 0x04, 0x26, 0x04, 0x05, 0x03, 0xE5, 0x04, 0x26, 0x04, 0x05,
+   0x04, 0x05, 0x04, 0x46, 0x04, 0x25, 0x04, 0x66, 0x04, 0x47, 0x04, 0x47, 0x04, 0x48, 0x0C, 0x08,
+   0x13, 0xA9, 0x1B, 0x6A, 0x2B, 0x2B, 0x2A, 0xAC, 0x3A, 0x6D, 0x42, 0x2E, 0x41, 0xCE, 0x49, 0xCF,
+   0x59, 0xF0, 0x5A, 0x10, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x51, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x71,
+   0x6A, 0x50, 0x6A, 0x71, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x31, 0x62, 0x30, 0x62, 0x10, 0x62, 0x31,
+   0x5A, 0x10, 0x5A, 0x10, 0x49, 0xCF, 0x49, 0xCF, 0x49, 0xEE, 0x41, 0xEE, 0x3A, 0x2E, 0x3A, 0x6E,
+   0x32, 0x8D, 0x2A, 0xAC, 0x22, 0xCB, 0x23, 0x0A, 0x23, 0x6B, 0x13, 0x69, 0x13, 0x89, 0x0B, 0xC9,
+   0x0B, 0xC8, 0x0C, 0x29, 0x0C, 0x29, 0x04, 0x28, 0x04, 0x28, 0x0C, 0x49, 0x0C, 0x28, 0x04, 0x08,
+   0x0C, 0x29, 0x0B, 0xE8, 0x13, 0xE9, 0x1B, 0xCA, 0x1B, 0x6A, 0x1B, 0x0A, 0x2B, 0x0C, 0x2A, 0x8C,
+   0x3A, 0x8D, 0x42, 0x2E, 0x49, 0xEE, 0x52, 0x10, 0x59, 0xF0, 0x6A, 0x51, 0x6A, 0x71, 0x7A, 0xD1,
+   0x7B, 0x11, 0x8B, 0x91, 0x8B, 0xD0, 0x9C, 0x31, 0xA4, 0x50, 0xA4, 0x4F, 0xB4, 0x6F, 0xB4, 0x2E,
+   0xBC, 0x4E, 0xC4, 0x4E, 0xC4, 0x2E, 0xBB, 0xED, 0xC4, 0x2E, 0xC4, 0x0D, 0xBB, 0xED, 0xBC, 0x0D,
+   0xC4, 0x4E, 0xB4, 0x2E, 0xB4, 0x2E, 0xAC, 0x4F, 0xAC, 0x70, 0x9C, 0x30, 0x94, 0x10, 0x93, 0xD1,
+   0x83, 0x71, 0x72, 0xD0, 0x6A, 0x70, 0x62, 0x30, 0x59, 0xEF, 0x51, 0xEF, 0x41, 0xEE, 0x3A, 0x4D,
+   0x32, 0xAD, 0x22, 0xEB, 0x1B, 0x6A, 0x0B, 0xA9, 0x03, 0xE8, 0x04, 0x27, 0x04, 0x26, 0x04, 0x46,
+   0x04, 0x46, 0x04, 0x46, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x26, 0x04, 0x26, 0x04, 0x25,
+   0x04, 0x46, 0x04, 0x46, 0x04, 0x66, 0x04, 0x46, 0x04, 0x27, 0x04, 0x27, 0x03, 0xE8, 0x0B, 0xC9,
+   0x1B, 0x8A, 0x23, 0x0B, 0x2A, 0xCC, 0x3A, 0x8D, 0x3A, 0x0D, 0x4A, 0x0F, 0x51, 0xEF, 0x5A, 0x10,
+   0x59, 0xF0, 0x62, 0x30, 0x62, 0x30, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x50, 0x6A, 0x50,
+   0x6A, 0x71, 0x6A, 0x50, 0x6A, 0x50, 0x62, 0x30, 0x62, 0x30, 0x62, 0x30, 0x62, 0x31, 0x5A, 0x10,
+   0x59, 0xF0, 0x59, 0xF0, 0x51, 0xCF, 0x52, 0x10, 0x52, 0x0F, 0x4A, 0x0F, 0x42, 0x0E, 0x42, 0x4E,
+   0x3A, 0x4D, 0x3A, 0x8D, 0x32, 0xAD, 0x22, 0xAB, 0x22, 0xEB, 0x1B, 0x0A, 0x1B, 0x4A, 0x1B, 0x8A,
+   0x13, 0x89, 0x13, 0xA9, 0x0B, 0xA9, 0x13, 0xE9, 0x0B, 0xC9, 0x13, 0xE9, 0x13, 0xC9, 0x13, 0xE9,
+   0x13, 0xC9, 0x13, 0x89, 0x1B, 0x6A, 0x23, 0x6B, 0x23, 0x0B, 0x2A, 0xEC, 0x32, 0x6C, 0x3A, 0x6E,
+   0x3A, 0x0D, 0x49, 0xEE, 0x51, 0xEF, 0x51, 0xCF, 0x62, 0x10, 0x72, 0x91, 0x72, 0xB1, 0x7A, 0xF0,
+   0x83, 0x50, 0x8B, 0xB0, 0x9C, 0x31, 0xA4, 0x50, 0xA4, 0x4F, 0xAC, 0x4F, 0xB4, 0x4F, 0xB4, 0x2E,
+   0xC4, 0x4E, 0xC4, 0x0D, 0xC3, 0xED, 0xCB, 0xED, 0xC3, 0xCC, 0xCC, 0x0D, 0xC3, 0xED, 0xCC, 0x2E,
+   0xBC, 0x0D, 0xC4, 0x4E, 0xB4, 0x4E, 0xB4, 0x6F, 0xAC, 0x70, 0xA4, 0x70, 0x9C, 0x31, 0x93, 0xD1,
+   0x83, 0x50, 0x7B, 0x11, 0x72, 0xB1, 0x6A, 0x51, 0x59, 0xF0, 0x49, 0xCF, 0x4A, 0x0F, 0x3A, 0x0D,
+   0x32, 0x8C, 0x22, 0xEB, 0x1B, 0x4A, 0x13, 0xCA, 0x0B, 0xE8, 0x04, 0x48, 0x04, 0x47, 0x04, 0x47,
+   0x04, 0x66, 0x04, 0x26, 0x04, 0x25, 0x04, 0x25, 0x04, 0x26, 0x04, 0x46, 0x04, 0x26, 0x04, 0x46,
+   0x04, 0x25, 0x04, 0x46, 0x04, 0x67, 0x04, 0x67, 0x04, 0x27, 0x0C, 0x29, 0x13, 0xE9, 0x13, 0x69,
+   0x23, 0x2B, 0x2A, 0xCC, 0x3A, 0x8D, 0x42, 0x2E, 0x41, 0xCE, 0x52, 0x10, 0x59, 0xF0, 0x62, 0x30,
+   0x6A, 0x51, 0x62, 0x30, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x50, 0x6A, 0x50, 0x6A, 0x71, 0x6A, 0x50,
+   0x6A, 0x71, 0x6A, 0x50, 0x6A, 0x91, 0x72, 0x91, 0x6A, 0x51, 0x6A, 0x71, 0x62, 0x30, 0x62, 0x10,
+   0x6A, 0x51, 0x62, 0x30, 0x62, 0x10, 0x51, 0xCF, 0x5A, 0x10, 0x52, 0x10, 0x49, 0xEF, 0x41, 0xEE,
+   0x39, 0xED, 0x42, 0x4E, 0x32, 0x4D, 0x32, 0x6C, 0x2A, 0xAC, 0x2A, 0xCB, 0x22, 0xEB, 0x23, 0x2B,
+   0x23, 0x4B, 0x23, 0x6A, 0x23, 0x8B, 0x1B, 0x6A, 0x1B, 0x6A, 0x1B, 0x49, 0x1B, 0x6A, 0x23, 0x8B,
+   0x1B, 0x2A, 0x23, 0x2B, 0x2B, 0x0B, 0x2A, 0xCC, 0x32, 0xAD, 0x3A, 0x6D, 0x3A, 0x2D, 0x42, 0x0E,
+   0x49, 0xEF, 0x51, 0xF0, 0x5A, 0x10, 0x62, 0x10, 0x6A, 0x71, 0x7A, 0xD1, 0x83, 0x31, 0x8B, 0x71,
+   0x93, 0xF1, 0x9C, 0x11, 0xA4, 0x50, 0xAC, 0x50, 0xB4, 0x6F, 0xB4, 0x4F, 0xBC, 0x2E, 0xBB, 0xED,
+   0xCC, 0x0D, 0xCB, 0xED, 0xCB, 0xAC, 0xCB, 0xCD, 0xCB, 0x8C, 0xCB, 0xAC, 0xCB, 0xED, 0xC3, 0xCD,
+   0xC4, 0x0D, 0xBC, 0x0D, 0xBC, 0x4E, 0xB4, 0x4E, 0xAC, 0x2F, 0xAC, 0x70, 0x9C, 0x31, 0x93, 0xF1,
+   0x8B, 0x91, 0x83, 0x31, 0x72, 0xB1, 0x6A, 0x71, 0x62, 0x10, 0x51, 0xCF, 0x41, 0xCE, 0x42, 0x4E,
+   0x32, 0x8D, 0x2A, 0xEC, 0x23, 0x6B, 0x1B, 0xAA, 0x14, 0x09, 0x04, 0x08, 0x04, 0x68, 0x04, 0x67,
+   0x04, 0x67, 0x04, 0x67, 0x04, 0x46, 0x04, 0x67, 0x04, 0x66, 0x04, 0x46, 0x04, 0x26, 0x04, 0x26,
+   0x04, 0x67, 0x04, 0x47, 0x04, 0x27, 0x04, 0x28, 0x03, 0xE8, 0x13, 0xE9, 0x1B, 0x8A, 0x23, 0x4B,
+   0x2A, 0xAB, 0x32, 0x6D, 0x42, 0x2E, 0x49, 0xEE, 0x51, 0xCF, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x71,
+   0x6A, 0x31, 0x6A, 0x51, 0x62, 0x30, 0x6A, 0x50, 0x72, 0x91, 0x6A, 0x70, 0x6A, 0x70, 0x72, 0xB1,
+   0x6A, 0x70, 0x72, 0xB1, 0x72, 0x91, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x91, 0x6A, 0x71, 0x6A, 0x71,
+   0x62, 0x30, 0x6A, 0x51, 0x59, 0xF0, 0x62, 0x31, 0x5A, 0x10, 0x59, 0xF0, 0x51, 0xEF, 0x49, 0xEF,
+   0x49, 0xCE, 0x41, 0xEE, 0x42, 0x2E, 0x3A, 0x2D, 0x3A, 0x6D, 0x32, 0x6D, 0x2A, 0x8C, 0x32, 0xAC,
+   0x22, 0xAB, 0x2A, 0xEC, 0x22, 0xCB, 0x2B, 0x0C, 0x2B, 0x0C, 0x23, 0x0B, 0x22, 0xEB, 0x22, 0xCB,
+   0x2A, 0xCC, 0x2A, 0xAC, 0x32, 0x6C, 0x3A, 0x6D, 0x3A, 0x2D, 0x42, 0x2E, 0x49, 0xEE, 0x52, 0x0F,
+   0x51, 0xCF, 0x62, 0x10, 0x62, 0x10, 0x6A, 0x71, 0x7A, 0xD1, 0x7B, 0x31, 0x8B, 0x91, 0x93, 0xF1,
+   0x9C, 0x31, 0x9C, 0x2F, 0xAC, 0x4F, 0xB4, 0x4F, 0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x2E, 0xC3, 0xCC,
+   0xC3, 0xAC, 0xCB, 0x8C, 0xD3, 0xAC, 0xD3, 0x6C, 0xD3, 0x8C, 0xD3, 0x8C, 0xCB, 0x8C, 0xCB, 0xCD,
+   0xCB, 0xED, 0xC4, 0x2E, 0xBC, 0x2E, 0xB4, 0x2E, 0xAC, 0x4F, 0xA4, 0x4F, 0x9C, 0x30, 0x9C, 0x11,
+   0x8B, 0x91, 0x83, 0x51, 0x7A, 0xF1, 0x6A, 0x71, 0x59, 0xF0, 0x5A, 0x10, 0x49, 0xEF, 0x42, 0x0E,
+   0x32, 0x4C, 0x2A, 0xAC, 0x23, 0x0B, 0x1B, 0x8A, 0x13, 0xEA, 0x0C, 0x09, 0x04, 0x28, 0x04, 0x27,
+   0x04, 0x47, 0x04, 0x67, 0x04, 0x47, 0x04, 0x26, 0x04, 0x67, 0x04, 0x67, 0x04, 0x67, 0x04, 0x47,
+   0x04, 0x67, 0x04, 0x68, 0x0C, 0x28, 0x0B, 0xE8, 0x13, 0xA9, 0x1B, 0x6A, 0x23, 0x0B, 0x2A, 0xAC,
+   0x3A, 0x8D, 0x3A, 0x0D, 0x49, 0xEF, 0x51, 0xEF, 0x62, 0x10, 0x6A, 0x51, 0x72, 0xB1, 0x7A, 0xF1,
+   0x62, 0x30, 0x6A, 0x50, 0x72, 0x91, 0x6A, 0x70, 0x6A, 0x91, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB0,
+   0x7A, 0xF1, 0x7A, 0xF1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0x91,
+   0x72, 0xB1, 0x6A, 0x71, 0x6A, 0x71, 0x6A, 0x51, 0x62, 0x30, 0x62, 0x30, 0x59, 0xF0, 0x51, 0xCF,
+   0x51, 0xCF, 0x49, 0xCE, 0x4A, 0x0F, 0x4A, 0x0F, 0x42, 0x0E, 0x42, 0x2E, 0x42, 0x4E, 0x3A, 0x2D,
+   0x3A, 0x6D, 0x32, 0x6D, 0x32, 0x6C, 0x32, 0x6C, 0x32, 0x8C, 0x32, 0x8D, 0x32, 0x6C, 0x32, 0x4C,
+   0x32, 0x4D, 0x3A, 0x4D, 0x3A, 0x0D, 0x42, 0x2E, 0x4A, 0x0F, 0x52, 0x0F, 0x51, 0xCF, 0x59, 0xF0,
+   0x62, 0x10, 0x62, 0x30, 0x72, 0x91, 0x72, 0xD0, 0x83, 0x51, 0x8B, 0xB1, 0x93, 0xD0, 0x9C, 0x30,
+   0xA4, 0x70, 0xAC, 0x70, 0xB4, 0x6F, 0xBC, 0x4E, 0xC4, 0x4E, 0xCC, 0x0E, 0xC3, 0xAC, 0xD3, 0xAD,
+   0xCB, 0x6B, 0xD3, 0x6C, 0xD3, 0x4B, 0xDB, 0x4B, 0xD3, 0x2B, 0xDB, 0x6C, 0xD3, 0x4B, 0xCB, 0x6C,
+   0xCB, 0xCD, 0xCC, 0x0D, 0xC4, 0x0E, 0xBC, 0x2E, 0xB4, 0x2E, 0xAC, 0x4F, 0xA4, 0x30, 0x9C, 0x31,
+   0x8B, 0xB1, 0x83, 0x51, 0x72, 0xD0, 0x72, 0x91, 0x62, 0x31, 0x5A, 0x10, 0x49, 0xEF, 0x41, 0xEE,
+   0x3A, 0x2D, 0x32, 0xAD, 0x2A, 0xEC, 0x1B, 0x2A, 0x1B, 0xAA, 0x13, 0xE9, 0x0C, 0x08, 0x04, 0x28,
+   0x04, 0x27, 0x04, 0x47, 0x04, 0x67, 0x04, 0x26, 0x04, 0x67, 0x04, 0x67, 0x04, 0x27, 0x04, 0x27,
+   0x04, 0x48, 0x0C, 0x29, 0x0B, 0xC9, 0x13, 0xA9, 0x1B, 0x4A, 0x2B, 0x0B, 0x2A, 0xAC, 0x3A, 0x6D,
+   0x42, 0x0E, 0x49, 0xEF, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x30, 0x72, 0xB1, 0x7A, 0xF1, 0x8B, 0x71,
+   0x6A, 0x71, 0x72, 0x91, 0x72, 0x91, 0x72, 0x91, 0x7A, 0xD1, 0x72, 0xD1, 0x7A, 0xF1, 0x7A, 0xF1,
+   0x72, 0xD0, 0x7A, 0xF1, 0x7B, 0x11, 0x7A, 0xF1, 0x7A, 0xF1, 0x7B, 0x11, 0x7A, 0xF1, 0x7A, 0xF1,
+   0x72, 0xB1, 0x72, 0x91, 0x6A, 0x70, 0x72, 0x91, 0x6A, 0x71, 0x6A, 0x51, 0x62, 0x30, 0x62, 0x10,
+   0x62, 0x10, 0x59, 0xF0, 0x51, 0xCF, 0x49, 0xCF, 0x49, 0xCF, 0x49, 0xEF, 0x4A, 0x0F, 0x4A, 0x2F,
+   0x42, 0x2E, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x2E, 0x3A, 0x0D, 0x42, 0x2E, 0x42, 0x2E,
+   0x42, 0x0E, 0x4A, 0x0F, 0x49, 0xEF, 0x49, 0xCF, 0x5A, 0x10, 0x5A, 0x10, 0x62, 0x31, 0x62, 0x30,
+   0x6A, 0x70, 0x7A, 0xD1, 0x7A, 0xF0, 0x8B, 0x71, 0x8B, 0x91, 0x9C, 0x11, 0x9C, 0x10, 0xA4, 0x50,
+   0xAC, 0x6F, 0xB4, 0x4E, 0xBC, 0x2E, 0xC4, 0x0E, 0xCB, 0xED, 0xCB, 0x8C, 0xD3, 0xAC, 0xD3, 0x4B,
+   0xDB, 0x4C, 0xDB, 0x2B, 0xDB, 0x0B, 0xDB, 0x0B, 0xDB, 0x2B, 0xDB, 0x2B, 0xDB, 0x2B, 0xDB, 0x6C,
+   0xCB, 0x6C, 0xCB, 0xAC, 0xC3, 0xED, 0xC4, 0x2E, 0xBC, 0x4F, 0xAC, 0x4F, 0xA4, 0x4F, 0x9C, 0x30,
+   0x93, 0xF1, 0x8B, 0x91, 0x83, 0x31, 0x72, 0xB1, 0x62, 0x30, 0x59, 0xF0, 0x51, 0xEF, 0x4A, 0x0F,
+   0x42, 0x2E, 0x3A, 0x8D, 0x2A, 0xCC, 0x23, 0x0B, 0x1B, 0x4A, 0x13, 0x89, 0x13, 0xC9, 0x0C, 0x09,
+   0x0C, 0x28, 0x04, 0x48, 0x04, 0x48, 0x04, 0x48, 0x04, 0x48, 0x04, 0x48, 0x04, 0x08, 0x03, 0xE8,
+   0x0B, 0xE9, 0x13, 0xA9, 0x1B, 0x8A, 0x23, 0x6B, 0x22, 0xCB, 0x32, 0xAD, 0x32, 0x2D, 0x42, 0x0E,
+   0x49, 0xCE, 0x5A, 0x10, 0x59, 0xF0, 0x6A, 0x71, 0x72, 0xB1, 0x7B, 0x10, 0x8B, 0xB1, 0x94, 0x11,
+   0x72, 0xB1, 0x72, 0xD1, 0x72, 0xB1, 0x7A, 0xF1, 0x7A, 0xF1, 0x7B, 0x11, 0x83, 0x31, 0x83, 0x31,
+   0x83, 0x31, 0x83, 0x31, 0x83, 0x51, 0x83, 0x51, 0x83, 0x31, 0x83, 0x51, 0x83, 0x51, 0x83, 0x31,
+   0x83, 0x31, 0x7B, 0x11, 0x7A, 0xF1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x71, 0x6A, 0x71,
+   0x6A, 0x51, 0x6A, 0x51, 0x62, 0x31, 0x59, 0xF0, 0x5A, 0x10, 0x51, 0xCF, 0x52, 0x10, 0x49, 0xCF,
+   0x51, 0xEF, 0x49, 0xEF, 0x49, 0xEF, 0x52, 0x0F, 0x49, 0xCE, 0x49, 0xCE, 0x49, 0xEF, 0x52, 0x0F,
+   0x52, 0x10, 0x51, 0xEF, 0x5A, 0x10, 0x5A, 0x10, 0x62, 0x31, 0x62, 0x30, 0x6A, 0x51, 0x72, 0xB1,
+   0x72, 0xD0, 0x83, 0x51, 0x83, 0x71, 0x93, 0xD1, 0x9C, 0x11, 0x9C, 0x30, 0xA4, 0x50, 0xB4, 0x6F,
+   0xB4, 0x4F, 0xBC, 0x2E, 0xBB, 0xED, 0xCB, 0xCC, 0xCB, 0x8C, 0xD3, 0x6B, 0xD3, 0x2B, 0xDB, 0x0B,
+   0xDA, 0xEA, 0xDA, 0xCA, 0xE2, 0xCA, 0xE2, 0xEB, 0xDA, 0xCA, 0xDA, 0xCA, 0xDB, 0x0B, 0xD3, 0x0B,
+   0xDB, 0x6C, 0xCB, 0x6C, 0xCB, 0xCD, 0xC4, 0x0D, 0xBC, 0x2E, 0xB4, 0x4E, 0xA4, 0x2F, 0xA4, 0x50,
+   0x94, 0x11, 0x8B, 0xB1, 0x7B, 0x10, 0x72, 0xD1, 0x6A, 0x50, 0x62, 0x10, 0x5A, 0x10, 0x49, 0xEF,
+   0x41, 0xEE, 0x3A, 0x2D, 0x32, 0x8D, 0x2A, 0xEC, 0x23, 0x2B, 0x1B, 0x4A, 0x1B, 0xAA, 0x13, 0xE9,
+   0x0B, 0xE9, 0x14, 0x09, 0x0C, 0x29, 0x0C, 0x29, 0x0C, 0x09, 0x14, 0x09, 0x13, 0xE9, 0x13, 0xEA,
+   0x13, 0x69, 0x23, 0x6A, 0x23, 0x0B, 0x2A, 0xAB, 0x32, 0x8D, 0x3A, 0x4D, 0x41, 0xEE, 0x51, 0xEF,
+   0x51, 0xEF, 0x62, 0x31, 0x72, 0x91, 0x72, 0xB1, 0x83, 0x71, 0x8B, 0x90, 0x93, 0xF0, 0xA4, 0x50,
+   0x72, 0xB1, 0x72, 0xD1, 0x7B, 0x11, 0x7A, 0xF1, 0x83, 0x31, 0x83, 0x51, 0x83, 0x71, 0x83, 0x30,
+   0x8B, 0x71, 0x83, 0x71, 0x83, 0x70, 0x8B, 0x91, 0x8B, 0x91, 0x83, 0x70, 0x8B, 0x91, 0x8B, 0x91,
+   0x8B, 0x91, 0x83, 0x51, 0x7B, 0x30, 0x83, 0x51, 0x7A, 0xF1, 0x83, 0x11, 0x72, 0xD1, 0x72, 0xB1,
+   0x72, 0x91, 0x72, 0x91, 0x6A, 0x51, 0x6A, 0x51, 0x62, 0x10, 0x62, 0x10, 0x62, 0x10, 0x59, 0xEF,
+   0x5A, 0x10, 0x5A, 0x10, 0x51, 0xCF, 0x59, 0xF0, 0x59, 0xF0, 0x59, 0xF0, 0x5A, 0x10, 0x59, 0xF0,
+   0x5A, 0x10, 0x59, 0xF0, 0x62, 0x30, 0x6A, 0x50, 0x6A, 0x71, 0x72, 0xB1, 0x72, 0xB1, 0x7B, 0x11,
+   0x83, 0x71, 0x8B, 0xB1, 0x94, 0x11, 0x9C, 0x31, 0xA4, 0x70, 0xA4, 0x2F, 0xB4, 0x6F, 0xB4, 0x4E,
+   0xC4, 0x4E, 0xC4, 0x0D, 0xCB, 0xCD, 0xCB, 0x6B, 0xDB, 0x6C, 0xDB, 0x0B, 0xDA, 0xEA, 0xE2, 0xCA,
+   0xE2, 0x89, 0xE2, 0x89, 0xEA, 0xAA, 0xEA, 0xAA, 0xE2, 0x89, 0xE2, 0xA9, 0xDA, 0xAA, 0xDA, 0xCA,
+   0xDB, 0x2B, 0xDB, 0x8C, 0xCB, 0x8C, 0xC3, 0xCD, 0xBC, 0x2E, 0xB4, 0x2E, 0xB4, 0x70, 0xAC, 0x70,
+   0x9C, 0x30, 0x8B, 0xB0, 0x83, 0x51, 0x7A, 0xF1, 0x72, 0x91, 0x6A, 0x51, 0x59, 0xCF, 0x51, 0xEF,
+   0x49, 0xEE, 0x42, 0x2E, 0x3A, 0x4D, 0x32, 0x8C, 0x2A, 0xEC, 0x23, 0x0B, 0x23, 0x6B, 0x1B, 0x8A,
+   0x13, 0xAA, 0x13, 0xA9, 0x13, 0xC9, 0x13, 0xC9, 0x13, 0xA9, 0x13, 0x89, 0x1B, 0xAA, 0x1B, 0x4A,
+   0x1B, 0x0A, 0x22, 0xCB, 0x2A, 0x8C, 0x32, 0x4D, 0x42, 0x2E, 0x41, 0xEE, 0x51, 0xEF, 0x59, 0xF0,
+   0x62, 0x10, 0x72, 0x91, 0x7B, 0x11, 0x83, 0x71, 0x93, 0xF1, 0x9C, 0x31, 0xAC, 0x70, 0xB4, 0x6F,
+   0x72, 0xD1, 0x7B, 0x11, 0x7B, 0x11, 0x7B, 0x11, 0x83, 0x71, 0x8B, 0x71, 0x83, 0x50, 0x8B, 0xB1,
+   0x8B, 0xB1, 0x8B, 0xB1, 0x93, 0xD1, 0x93, 0xF1, 0x93, 0xD1, 0x93, 0xD1, 0x8B, 0xB0, 0x8B, 0xD1,
+   0x93, 0xD1, 0x8B, 0xB1, 0x8B, 0x90, 0x8B, 0xB1, 0x83, 0x71, 0x83, 0x50, 0x83, 0x51, 0x7B, 0x10,
+   0x83, 0x11, 0x7A, 0xF1, 0x72, 0xD1, 0x72, 0x90, 0x72, 0x91, 0x6A, 0x71, 0x6A, 0x71, 0x6A, 0x71,
+   0x62, 0x30, 0x6A, 0x51, 0x62, 0x30, 0x62, 0x10, 0x62, 0x10, 0x62, 0x10, 0x62, 0x30, 0x62, 0x30,
+   0x6A, 0x30, 0x6A, 0x71, 0x6A, 0x70, 0x72, 0xB1, 0x7A, 0xD1, 0x7B, 0x11, 0x83, 0x51, 0x8B, 0xB1,
+   0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x30, 0xA4, 0x2F, 0xB4, 0x70, 0xAC, 0x2E, 0xBC, 0x4E, 0xC4, 0x2E,
+   0xCB, 0xED, 0xD3, 0xCD, 0xD3, 0x4B, 0xDB, 0x4C, 0xDB, 0x0B, 0xDA, 0xAA, 0xE2, 0xA9, 0xEA, 0xAA,
+   0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xF2, 0x89, 0xEA, 0x69, 0xEA, 0xAA, 0xE2, 0x89, 0xE2, 0xCA,
+   0xE3, 0x0B, 0xDB, 0x6C, 0xCB, 0x6B, 0xCB, 0xCD, 0xC4, 0x2E, 0xBC, 0x2E, 0xB4, 0x6F, 0xA4, 0x4F,
+   0x9C, 0x30, 0x93, 0xD0, 0x8B, 0xB1, 0x7B, 0x11, 0x72, 0xB1, 0x6A, 0x71, 0x62, 0x10, 0x51, 0xCF,
+   0x52, 0x0F, 0x4A, 0x0F, 0x42, 0x4E, 0x3A, 0x6D, 0x2A, 0x8C, 0x2A, 0xEC, 0x23, 0x0B, 0x23, 0x4B,
+   0x23, 0x6A, 0x1B, 0x4A, 0x1B, 0x4A, 0x1B, 0x8A, 0x1B, 0x4A, 0x23, 0x4A, 0x23, 0x2B, 0x22, 0xEB,
+   0x2A, 0xAC, 0x32, 0x8D, 0x32, 0x2D, 0x42, 0x0E, 0x49, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x30,
+   0x72, 0xB1, 0x7A, 0xD0, 0x8B, 0x91, 0x8B, 0xB0, 0x9C, 0x10, 0xA4, 0x4F, 0xB4, 0x4F, 0xBC, 0x4E,
+   0x7A, 0xF1, 0x7B, 0x10, 0x83, 0x51, 0x83, 0x51, 0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0x90, 0x93, 0xD1,
+   0x8B, 0xD0, 0x94, 0x11, 0x93, 0xD0, 0x93, 0xF0, 0x9C, 0x11, 0x9C, 0x31, 0x93, 0xF0, 0x9C, 0x11,
+   0x94, 0x10, 0x94, 0x11, 0x9C, 0x11, 0x94, 0x11, 0x93, 0xD0, 0x8B, 0xB1, 0x8B, 0x91, 0x8B, 0x91,
+   0x83, 0x71, 0x8B, 0x71, 0x83, 0x31, 0x83, 0x31, 0x7A, 0xF1, 0x7A, 0xF1, 0x7A, 0xD1, 0x72, 0xB1,
+   0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0x91, 0x72, 0xB1, 0x72, 0xB1,
+   0x7A, 0xD1, 0x7A, 0xF1, 0x7A, 0xF1, 0x83, 0x31, 0x83, 0x51, 0x8B, 0xB1, 0x93, 0xD1, 0x94, 0x11,
+   0x9C, 0x31, 0xA4, 0x50, 0xAC, 0x70, 0xB4, 0x70, 0xB4, 0x4F, 0xBC, 0x4F, 0xC4, 0x0D, 0xC3, 0xCD,
+   0xCB, 0xAC, 0xD3, 0x6C, 0xDB, 0x4B, 0xE2, 0xEB, 0xE2, 0xAA, 0xE2, 0x89, 0xEA, 0x8A, 0xEA, 0x49,
+   0xF2, 0x69, 0xEA, 0x28, 0xEA, 0x28, 0xEA, 0x28, 0xF2, 0x69, 0xEA, 0x49, 0xEA, 0xAA, 0xEA, 0xAA,
+   0xDA, 0xAA, 0xDB, 0x2B, 0xD3, 0x6C, 0xD3, 0xAD, 0xC3, 0xED, 0xBC, 0x2E, 0xB4, 0x4F, 0xAC, 0x4F,
+   0xA4, 0x70, 0x9C, 0x31, 0x93, 0xD1, 0x83, 0x31, 0x72, 0xD1, 0x72, 0x91, 0x62, 0x10, 0x59, 0xF0,
+   0x51, 0xEF, 0x4A, 0x0F, 0x4A, 0x2F, 0x3A, 0x2D, 0x32, 0x6D, 0x32, 0x8C, 0x2A, 0xAB, 0x2A, 0xEB,
+   0x22, 0xEB, 0x23, 0x2B, 0x22, 0xEA, 0x2B, 0x2B, 0x22, 0xEB, 0x22, 0xCB, 0x2A, 0xCC, 0x32, 0xAD,
+   0x32, 0x6D, 0x3A, 0x0D, 0x42, 0x0E, 0x49, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x30, 0x72, 0x91,
+   0x83, 0x11, 0x83, 0x71, 0x93, 0xF1, 0x9C, 0x30, 0xAC, 0x70, 0xB4, 0x6F, 0xC4, 0x4E, 0xCC, 0x0D,
+   0x83, 0x31, 0x83, 0x51, 0x83, 0x51, 0x8B, 0xB1, 0x8B, 0xB1, 0x93, 0xD1, 0x93, 0xD1, 0x9C, 0x11,
+   0x93, 0xF0, 0x9C, 0x11, 0x9C, 0x30, 0x9C, 0x30, 0x9C, 0x30, 0xA4, 0x51, 0xA4, 0x50, 0x9C, 0x30,
+   0x9C, 0x30, 0xA4, 0x50, 0x9C, 0x30, 0x9C, 0x10, 0x9C, 0x30, 0x9C, 0x31, 0x93, 0xF0, 0x93, 0xF1,
+   0x94, 0x11, 0x93, 0xD1, 0x8B, 0xB1, 0x8B, 0xB1, 0x83, 0x50, 0x8B, 0x71, 0x83, 0x71, 0x83, 0x51,
+   0x7B, 0x11, 0x7B, 0x11, 0x83, 0x11, 0x7A, 0xF0, 0x83, 0x31, 0x83, 0x31, 0x7B, 0x11, 0x83, 0x31,
+   0x83, 0x31, 0x83, 0x71, 0x83, 0x71, 0x8B, 0x91, 0x8B, 0xB1, 0x93, 0xF0, 0x9C, 0x11, 0x9C, 0x10,
+   0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x0D, 0xCB, 0xED, 0xD3, 0xAD,
+   0xD3, 0x4B, 0xDB, 0x2B, 0xE2, 0xEB, 0xE2, 0xA9, 0xEA, 0x89, 0xEA, 0x69, 0xF2, 0x69, 0xF2, 0x28,
+   0xF2, 0x49, 0xF2, 0x08, 0xF2, 0x08, 0xF2, 0x28, 0xEA, 0x08, 0xF2, 0x49, 0xEA, 0x69, 0xEA, 0x8A,
+   0xE2, 0xAA, 0xDB, 0x0B, 0xDB, 0x6C, 0xD3, 0xAC, 0xCB, 0xED, 0xBC, 0x0D, 0xBC, 0x6F, 0xB4, 0x6F,
+   0xA4, 0x50, 0x9C, 0x10, 0x93, 0xD1, 0x8B, 0x91, 0x7A, 0xF1, 0x7A, 0xD1, 0x6A, 0x51, 0x62, 0x10,
+   0x51, 0xEF, 0x49, 0xEF, 0x49, 0xEF, 0x42, 0x0E, 0x3A, 0x2D, 0x32, 0x4D, 0x32, 0x8D, 0x2A, 0x8C,
+   0x2A, 0xAC, 0x2A, 0xAC, 0x2A, 0xCC, 0x2A, 0xAC, 0x32, 0xAC, 0x32, 0xAD, 0x32, 0x4C, 0x32, 0x2D,
+   0x3A, 0x0D, 0x49, 0xEE, 0x49, 0xCE, 0x59, 0xF0, 0x5A, 0x10, 0x62, 0x30, 0x72, 0xB1, 0x83, 0x31,
+   0x8B, 0xB1, 0x93, 0xF1, 0xA4, 0x51, 0xAC, 0x70, 0xB4, 0x4E, 0xBC, 0x0D, 0xCB, 0xED, 0xD3, 0x8C,
+   0x83, 0x31, 0x83, 0x71, 0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0xD1, 0x93, 0xD0, 0x9C, 0x11, 0x9C, 0x11,
+   0x9C, 0x31, 0xA4, 0x51, 0x9C, 0x30, 0x9C, 0x2F, 0xA4, 0x50, 0xAC, 0x70, 0xA4, 0x2F, 0xA4, 0x2F,
+   0xA4, 0x4F, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x50, 0xA4, 0x30, 0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x30,
+   0x9C, 0x30, 0x93, 0xF0, 0x94, 0x10, 0x93, 0xF0, 0x93, 0xF1, 0x93, 0xF1, 0x93, 0xD1, 0x93, 0xD1,
+   0x8B, 0x90, 0x8B, 0xB1, 0x8B, 0xB1, 0x83, 0x71, 0x83, 0x71, 0x83, 0x70, 0x83, 0x70, 0x8B, 0xB1,
+   0x8B, 0xB1, 0x8B, 0xB0, 0x8B, 0xD0, 0x93, 0xF0, 0x9C, 0x31, 0x9C, 0x30, 0xA4, 0x50, 0xAC, 0x70,
+   0xAC, 0x2F, 0xB4, 0x4F, 0xBC, 0x4F, 0xBC, 0x2E, 0xC3, 0xED, 0xCB, 0xCD, 0xCB, 0x6C, 0xD3, 0x6C,
+   0xDB, 0x0B, 0xDA, 0xCA, 0xE2, 0xA9, 0xEA, 0xAA, 0xEA, 0x69, 0xF2, 0x49, 0xF2, 0x08, 0xFA, 0x49,
+   0xFA, 0x28, 0xF2, 0x08, 0xFA, 0x29, 0xF2, 0x08, 0xF2, 0x08, 0xF2, 0x49, 0xEA, 0x49, 0xEA, 0x69,
+   0xE2, 0x89, 0xE2, 0xEB, 0xDB, 0x2B, 0xD3, 0x8C, 0xCB, 0xAC, 0xC4, 0x0D, 0xBC, 0x2E, 0xAC, 0x4E,
+   0xAC, 0x70, 0x9C, 0x10, 0x93, 0xF0, 0x83, 0x70, 0x83, 0x31, 0x72, 0xB0, 0x6A, 0x70, 0x6A, 0x51,
+   0x5A, 0x10, 0x51, 0xF0, 0x51, 0xEF, 0x41, 0xEE, 0x42, 0x0E, 0x3A, 0x2D, 0x32, 0x2D, 0x32, 0x4C,
+   0x3A, 0x8D, 0x32, 0x6C, 0x32, 0x6D, 0x32, 0x6D, 0x32, 0x4D, 0x3A, 0x2D, 0x42, 0x2E, 0x4A, 0x2F,
+   0x49, 0xCE, 0x51, 0xEF, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x71, 0x72, 0x91, 0x83, 0x31, 0x83, 0x71,
+   0x94, 0x11, 0xA4, 0x50, 0xAC, 0x4F, 0xB4, 0x4E, 0xBC, 0x0D, 0xCB, 0xCD, 0xDB, 0x8C, 0xDB, 0x0B,
+   0x83, 0x50, 0x83, 0x71, 0x8B, 0x90, 0x93, 0xF1, 0x93, 0xD0, 0x94, 0x11, 0x9C, 0x10, 0x9C, 0x30,
+   0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x6F, 0xAC, 0x6F, 0xB4, 0x70,
+   0xAC, 0x2F, 0xB4, 0x70, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xA4, 0x2F, 0xAC, 0x4F, 0xAC, 0x50,
+   0xA4, 0x2F, 0xA4, 0x2F, 0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x30, 0x9C, 0x30, 0x9C, 0x11, 0x93, 0xF0,
+   0x9C, 0x11, 0x93, 0xD0, 0x93, 0xF1, 0x94, 0x11, 0x93, 0xF1, 0x93, 0xF1, 0x94, 0x11, 0x93, 0xF1,
+   0x9C, 0x11, 0x9C, 0x10, 0x9C, 0x10, 0x9C, 0x30, 0xA4, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x4F,
+   0xB4, 0x4F, 0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x0D, 0xC3, 0xAC, 0xCB, 0x8C, 0xD3, 0x4B, 0xD3, 0x0A,
+   0xDA, 0xCA, 0xEA, 0xCA, 0xEA, 0xAA, 0xEA, 0x69, 0xF2, 0x69, 0xF2, 0x28, 0xF2, 0x08, 0xFA, 0x08,
+   0xFA, 0x08, 0xFA, 0x28, 0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x49, 0xF2, 0x28, 0xF2, 0x49, 0xF2, 0x89,
+   0xE2, 0x89, 0xDA, 0xAA, 0xDB, 0x2B, 0xD3, 0x6C, 0xCB, 0x8C, 0xC3, 0xED, 0xBC, 0x4E, 0xB4, 0x4F,
+   0xAC, 0x70, 0x9C, 0x30, 0x9C, 0x11, 0x8B, 0x90, 0x8B, 0x71, 0x7A, 0xD1, 0x72, 0xB1, 0x62, 0x30,
+   0x62, 0x31, 0x51, 0xCF, 0x51, 0xF0, 0x49, 0xEF, 0x41, 0xEE, 0x4A, 0x2E, 0x3A, 0x0E, 0x3A, 0x0D,
+   0x3A, 0x4D, 0x3A, 0x6E, 0x3A, 0x4D, 0x42, 0x4E, 0x42, 0x4E, 0x42, 0x0E, 0x4A, 0x0F, 0x52, 0x0F,
+   0x51, 0xCF, 0x5A, 0x10, 0x59, 0xF0, 0x6A, 0x71, 0x72, 0xB1, 0x7B, 0x11, 0x8B, 0x91, 0x94, 0x11,
+   0x9C, 0x10, 0xAC, 0x70, 0xB4, 0x4F, 0xBC, 0x0D, 0xCB, 0xCD, 0xD3, 0x4B, 0xE3, 0x0B, 0xEA, 0xAA,
+   0x8B, 0x91, 0x8B, 0xB1, 0x93, 0xD1, 0x93, 0xF1, 0x94, 0x11, 0x9C, 0x10, 0x9C, 0x30, 0xA4, 0x50,
+   0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x2F, 0xB4, 0x6F, 0xAC, 0x4F, 0xB4, 0x4F, 0xB4, 0x6F, 0xB4, 0x4E,
+   0xBC, 0x6F, 0xB4, 0x2E, 0xB4, 0x4F, 0xB4, 0x4E, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4F, 0xAC, 0x4F,
+   0xB4, 0x6F, 0xAC, 0x2F, 0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x30,
+   0x9C, 0x30, 0x9C, 0x30, 0x9C, 0x30, 0x9C, 0x10, 0x9C, 0x30, 0x9C, 0x10, 0x9C, 0x31, 0x9C, 0x50,
+   0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x4F, 0xB4, 0x6F, 0xBC, 0x6F,
+   0xBC, 0x2E, 0xC4, 0x2E, 0xCC, 0x2E, 0xC3, 0xAC, 0xD3, 0xAC, 0xD3, 0x4B, 0xDB, 0x2B, 0xDA, 0xEB,
+   0xE2, 0xCA, 0xEA, 0xAA, 0xEA, 0x89, 0xF2, 0x69, 0xF2, 0x28, 0xF2, 0x08, 0xFA, 0x08, 0xF9, 0xE8,
+   0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x28, 0xF1, 0xE7, 0xFA, 0x28, 0xF2, 0x08, 0xEA, 0x28, 0xEA, 0x69,
+   0xE2, 0x69, 0xE2, 0xCA, 0xE3, 0x2B, 0xD3, 0x4B, 0xD3, 0xCD, 0xCC, 0x0E, 0xBC, 0x0D, 0xB4, 0x4F,
+   0xAC, 0x70, 0xA4, 0x50, 0x94, 0x10, 0x93, 0xD1, 0x8B, 0x91, 0x7B, 0x11, 0x72, 0xB1, 0x6A, 0x71,
+   0x6A, 0x51, 0x62, 0x10, 0x5A, 0x10, 0x51, 0xEF, 0x49, 0xEF, 0x49, 0xEE, 0x41, 0xEE, 0x42, 0x0E,
+   0x39, 0xED, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x41, 0xEE, 0x4A, 0x0F, 0x49, 0xEF, 0x51, 0xEF,
+   0x59, 0xF0, 0x62, 0x31, 0x6A, 0x91, 0x72, 0xB1, 0x7B, 0x11, 0x83, 0x71, 0x93, 0xF1, 0x9C, 0x10,
+   0xAC, 0x70, 0xB4, 0x6F, 0xBC, 0x2E, 0xC3, 0xCD, 0xD3, 0x6C, 0xDB, 0x0B, 0xEA, 0xAA, 0xF2, 0x49,
+   0x8B, 0x91, 0x8B, 0x90, 0x93, 0xD1, 0x93, 0xF1, 0x9C, 0x10, 0x9C, 0x30, 0xA4, 0x71, 0xA4, 0x70,
+   0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x2F, 0xB4, 0x4F, 0xB4, 0x6F, 0xB4, 0x4F, 0xBC, 0x6F, 0xBC, 0x4E,
+   0xBC, 0x4E, 0xBC, 0x2E, 0xBC, 0x2E, 0xBC, 0x4E, 0xBC, 0x4E, 0xBC, 0x4E, 0xB4, 0x2E, 0xBC, 0x4E,
+   0xB4, 0x4E, 0xB4, 0x4F, 0xB4, 0x4E, 0xB4, 0x6F, 0xAC, 0x2F, 0xB4, 0x70, 0xAC, 0x6F, 0xAC, 0x70,
+   0xAC, 0x50, 0xA4, 0x2F, 0xA4, 0x50, 0xA4, 0x2F, 0xAC, 0x70, 0xA4, 0x70, 0xA4, 0x2F, 0xA4, 0x2F,
+   0xA4, 0x50, 0xA4, 0x4F, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x2E, 0xB4, 0x4E, 0xB4, 0x2E,
+   0xBC, 0x0D, 0xC4, 0x0D, 0xCB, 0xED, 0xCB, 0xAC, 0xD3, 0x6C, 0xD3, 0x2B, 0xDB, 0x2B, 0xDA, 0xCA,
+   0xE2, 0xAA, 0xE2, 0x69, 0xEA, 0x69, 0xF2, 0x49, 0xF2, 0x28, 0xF2, 0x08, 0xF1, 0xE8, 0xF9, 0xE8,
+   0xFA, 0x28, 0xF9, 0xE7, 0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x28, 0xFA, 0x49, 0xEA, 0x28, 0xEA, 0x69,
+   0xEA, 0xAA, 0xE2, 0xCA, 0xDA, 0xEA, 0xD3, 0x4B, 0xCB, 0xCD, 0xC3, 0xED, 0xC4, 0x4E, 0xB4, 0x4F,
+   0xAC, 0x70, 0xA4, 0x30, 0x9C, 0x31, 0x8B, 0xB0, 0x8B, 0x91, 0x7B, 0x11, 0x72, 0xB1, 0x72, 0x91,
+   0x62, 0x30, 0x62, 0x31, 0x59, 0xF0, 0x51, 0xCF, 0x49, 0xCF, 0x49, 0xEF, 0x49, 0xCE, 0x4A, 0x0F,
+   0x41, 0xCE, 0x41, 0xEE, 0x4A, 0x0F, 0x4A, 0x0F, 0x52, 0x0F, 0x49, 0xCF, 0x51, 0xCF, 0x59, 0xEF,
+   0x6A, 0x51, 0x6A, 0x51, 0x72, 0xB1, 0x7A, 0xF1, 0x83, 0x71, 0x93, 0xF1, 0x9C, 0x10, 0xA4, 0x4F,
+   0xB4, 0x6F, 0xBC, 0x4E, 0xC3, 0xED, 0xD3, 0x8C, 0xDA, 0xEA, 0xEA, 0xAA, 0xEA, 0x49, 0xF1, 0xE7,
+   0x83, 0x71, 0x8B, 0x90, 0x93, 0xF1, 0x94, 0x11, 0x94, 0x10, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x50,
+   0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4E, 0xB4, 0x2E, 0xBC, 0x2E, 0xBC, 0x2E, 0xC4, 0x2E,
+   0xC4, 0x2E, 0xBB, 0xED, 0xBB, 0xED, 0xBB, 0xED, 0xBB, 0xED, 0xC4, 0x0D, 0xBC, 0x0D, 0xBC, 0x2E,
+   0xC4, 0x4E, 0xBC, 0x2E, 0xBC, 0x4E, 0xB4, 0x2E, 0xB4, 0x4E, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4F,
+   0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x2F, 0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x4F, 0xAC, 0x4F, 0xAC, 0x6F,
+   0xAC, 0x70, 0xAC, 0x6F, 0xB4, 0x70, 0xAC, 0x2E, 0xB4, 0x6F, 0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x4E,
+   0xC4, 0x2E, 0xC3, 0xED, 0xCB, 0xCD, 0xD3, 0xAC, 0xDB, 0x8C, 0xDB, 0x4B, 0xDB, 0x0B, 0xDA, 0xAA,
+   0xE2, 0xAA, 0xE2, 0x69, 0xEA, 0x49, 0xEA, 0x28, 0xFA, 0x49, 0xFA, 0x28, 0xFA, 0x28, 0xFA, 0x28,
+   0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x28, 0xFA, 0x08, 0xF2, 0x08, 0xF2, 0x49, 0xF2, 0x69, 0xE2, 0x69,
+   0xE2, 0xAA, 0xDA, 0xCA, 0xDB, 0x2B, 0xD3, 0x8C, 0xCB, 0xCD, 0xC4, 0x0D, 0xC4, 0x4E, 0xB4, 0x4E,
+   0xAC, 0x70, 0xA4, 0x50, 0x9C, 0x10, 0x8B, 0xB0, 0x8B, 0x91, 0x83, 0x31, 0x7A, 0xF1, 0x6A, 0x70,
+   0x6A, 0x51, 0x62, 0x10, 0x62, 0x30, 0x5A, 0x10, 0x51, 0xCF, 0x52, 0x10, 0x49, 0xEF, 0x52, 0x0F,
+   0x49, 0xCE, 0x52, 0x0F, 0x49, 0xEF, 0x51, 0xEF, 0x51, 0xEF, 0x59, 0xF0, 0x59, 0xF0, 0x62, 0x31,
+   0x6A, 0x71, 0x72, 0x91, 0x7A, 0xF1, 0x83, 0x71, 0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x30, 0xAC, 0x6F,
+   0xB4, 0x2E, 0xC4, 0x2E, 0xCB, 0xAC, 0xD3, 0x2B, 0xDA, 0xAA, 0xEA, 0x89, 0xF2, 0x28, 0xFA, 0x08,
+   0x8B, 0x91, 0x8B, 0xB1, 0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x10, 0x9C, 0x30, 0x9C, 0x2F, 0xAC, 0x70,
+   0xB4, 0x70, 0xAC, 0x2E, 0xB4, 0x6F, 0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x4E, 0xBB, 0xED, 0xC4, 0x0D,
+   0xC3, 0xCD, 0xC3, 0xED, 0xC3, 0xCD, 0xC3, 0xCD, 0xCB, 0xED, 0xCB, 0xED, 0xC3, 0xED, 0xCC, 0x0E,
+   0xC3, 0xED, 0xC4, 0x2E, 0xBB, 0xED, 0xBC, 0x2E, 0xBC, 0x2E, 0xB4, 0x0E, 0xB4, 0x4E, 0xBC, 0x6F,
+   0xB4, 0x4E, 0xB4, 0x6F, 0xAC, 0x2E, 0xAC, 0x4F, 0xB4, 0x6F, 0xAC, 0x4F, 0xB4, 0x6F, 0xAC, 0x4F,
+   0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4F, 0xB4, 0x4E, 0xB4, 0x4E, 0xB4, 0x2E, 0xBC, 0x2E, 0xBB, 0xED,
+   0xC3, 0xED, 0xC3, 0xCD, 0xCB, 0xAC, 0xD3, 0xAC, 0xDB, 0x6C, 0xDB, 0x4C, 0xDA, 0xEB, 0xE2, 0xEB,
+   0xE2, 0xAA, 0xE2, 0x69, 0xEA, 0x69, 0xF2, 0x49, 0xF2, 0x49, 0xFA, 0x49, 0xF2, 0x28, 0xF1, 0xE8,
+   0xFA, 0x29, 0xF1, 0xE8, 0xFA, 0x49, 0xF2, 0x28, 0xF2, 0x28, 0xF2, 0x49, 0xEA, 0x49, 0xEA, 0xAA,
+   0xE2, 0xCA, 0xDA, 0xEA, 0xD3, 0x2B, 0xD3, 0xAC, 0xCB, 0xCD, 0xC4, 0x0D, 0xB4, 0x2E, 0xB4, 0x6F,
+   0xAC, 0x70, 0xA4, 0x70, 0x9C, 0x31, 0x8B, 0xB0, 0x83, 0x71, 0x83, 0x51, 0x7A, 0xD1, 0x72, 0x91,
+   0x62, 0x30, 0x62, 0x10, 0x62, 0x30, 0x5A, 0x10, 0x51, 0xCF, 0x51, 0xEF, 0x51, 0xEF, 0x49, 0xCF,
+   0x49, 0xCF, 0x52, 0x10, 0x51, 0xEF, 0x51, 0xF0, 0x5A, 0x10, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x30,
+   0x6A, 0x71, 0x7A, 0xF1, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xF1, 0xA4, 0x51, 0xAC, 0x4F, 0xB4, 0x4F,
+   0xC4, 0x4E, 0xCB, 0xCD, 0xD3, 0x6C, 0xE3, 0x0B, 0xEA, 0x89, 0xF2, 0x28, 0xFA, 0x08, 0xF9, 0xE7,
+   0x8B, 0x71, 0x8B, 0x91, 0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x10, 0x9C, 0x10, 0xA4, 0x2F, 0xAC, 0x70,
+   0xB4, 0x70, 0xB4, 0x6F, 0xB4, 0x4E, 0xBC, 0x2E, 0xC4, 0x4E, 0xBB, 0xED, 0xC3, 0xED, 0xC3, 0xED,
+   0xC3, 0xCD, 0xC3, 0xAC, 0xCB, 0xAC, 0xD3, 0xED, 0xCB, 0xCD, 0xCB, 0xAC, 0xCB, 0xCD, 0xC3, 0xAC,
+   0xCB, 0xED, 0xCB, 0xED, 0xC4, 0x0D, 0xC3, 0xED, 0xBB, 0xED, 0xC4, 0x2E, 0xBC, 0x2E, 0xBC, 0x4E,
+   0xBC, 0x4E, 0xBC, 0x6F, 0xB4, 0x4F, 0xB4, 0x2E, 0xB4, 0x4F, 0xB4, 0x2E, 0xB4, 0x4E, 0xB4, 0x6F,
+   0xB4, 0x4F, 0xB4, 0x4F, 0xB4, 0x2E, 0xB4, 0x2E, 0xB4, 0x2E, 0xBC, 0x2E, 0xBC, 0x0D, 0xBB, 0xED,
+   0xC3, 0xED, 0xCB, 0xED, 0xCB, 0xCD, 0xD3, 0xAD, 0xDB, 0x8C, 0xD3, 0x2B, 0xDB, 0x0B, 0xE2, 0xEB,
+   0xE2, 0xCA, 0xE2, 0x89, 0xE2, 0x69, 0xF2, 0x89, 0xF2, 0x49, 0xF2, 0x49, 0xF2, 0x49, 0xF2, 0x08,
+   0xF2, 0x28, 0xF2, 0x08, 0xFA, 0x49, 0xF2, 0x49, 0xF2, 0x69, 0xEA, 0x69, 0xEA, 0x8A, 0xE2, 0xA9,
+   0xE3, 0x0B, 0xDB, 0x0B, 0xDB, 0x8C, 0xD3, 0xCD, 0xCB, 0xED, 0xBC, 0x0D, 0xBC, 0x6F, 0xB4, 0x4F,
+   0xA4, 0x4F, 0x9C, 0x30, 0x9C, 0x11, 0x93, 0xF1, 0x8B, 0x91, 0x83, 0x31, 0x7A, 0xF1, 0x6A, 0x70,
+   0x6A, 0x71, 0x62, 0x31, 0x62, 0x10, 0x59, 0xF0, 0x5A, 0x10, 0x51, 0xF0, 0x51, 0xEF, 0x51, 0xCF,
+   0x51, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x5A, 0x10, 0x59, 0xF0, 0x62, 0x31, 0x62, 0x30, 0x6A, 0x71,
+   0x7A, 0xD1, 0x83, 0x11, 0x8B, 0x71, 0x93, 0xD1, 0x93, 0xF0, 0xA4, 0x50, 0xB4, 0x70, 0xBC, 0x4E,
+   0xC4, 0x2E, 0xD3, 0xAD, 0xDB, 0x2B, 0xE2, 0xCA, 0xEA, 0x49, 0xFA, 0x28, 0xF9, 0xE7, 0xF9, 0xE7,
+   0x83, 0x51, 0x83, 0x71, 0x8B, 0xB1, 0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x30, 0xA4, 0x30, 0xAC, 0x70,
+   0xB4, 0x70, 0xB4, 0x6F, 0xBC, 0x6F, 0xB4, 0x0D, 0xC4, 0x2E, 0xC3, 0xED, 0xC3, 0xED, 0xC3, 0xAC,
+   0xCB, 0xED, 0xCB, 0xAC, 0xCB, 0xAC, 0xCB, 0x8C, 0xD3, 0xAD, 0xD3, 0xAD, 0xD3, 0xCD, 0xCB, 0x8C,
+   0xCB, 0xAC, 0xCB, 0xAC, 0xC3, 0xCD, 0xCB, 0xED, 0xC3, 0xED, 0xC4, 0x0D, 0xBB, 0xED, 0xBC, 0x0E,
+   0xBC, 0x0D, 0xBC, 0x2E, 0xB4, 0x2E, 0xBC, 0x4E, 0xB4, 0x2E, 0xBC, 0x6F, 0xB4, 0x4F, 0xB4, 0x6F,
+   0xB4, 0x6F, 0xB4, 0x2E, 0xBC, 0x6F, 0xBC, 0x4E, 0xBC, 0x2E, 0xBC, 0x4E, 0xBC, 0x2E, 0xBC, 0x0D,
+   0xC4, 0x0D, 0xCC, 0x0D, 0xCB, 0xAC, 0xD3, 0xCD, 0xD3, 0x8C, 0xD3, 0x4B, 0xD3, 0x2B, 0xDB, 0x0A,
+   0xE3, 0x0B, 0xE2, 0xCA, 0xE2, 0xAA, 0xEA, 0xAA, 0xEA, 0x8A, 0xEA, 0x69, 0xEA, 0x48, 0xEA, 0x49,
+   0xEA, 0x48, 0xF2, 0x69, 0xF2, 0x69, 0xEA, 0x89, 0xEA, 0xAA, 0xE2, 0x89, 0xEA, 0xEA, 0xDA, 0xCA,
+   0xDB, 0x0B, 0xDB, 0x6C, 0xD3, 0xAC, 0xC3, 0xAC, 0xC4, 0x0D, 0xBC, 0x2E, 0xB4, 0x4F, 0xB4, 0x70,
+   0xA4, 0x50, 0x9C, 0x30, 0x94, 0x11, 0x93, 0xD1, 0x83, 0x51, 0x83, 0x31, 0x72, 0xB1, 0x6A, 0x70,
+   0x62, 0x30, 0x6A, 0x31, 0x62, 0x10, 0x59, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x51, 0xEF, 0x5A, 0x10,
+   0x51, 0xEF, 0x51, 0xEF, 0x51, 0xCF, 0x62, 0x10, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x70,
+   0x7A, 0xF1, 0x83, 0x31, 0x83, 0x70, 0x93, 0xF1, 0x9C, 0x30, 0xA4, 0x4F, 0xB4, 0x6F, 0xBC, 0x4E,
+   0xC3, 0xCD, 0xD3, 0x8C, 0xDB, 0x0A, 0xE2, 0x89, 0xF2, 0x69, 0xFA, 0x28, 0xF9, 0xC7, 0xF9, 0xE6,
+   0x83, 0x31, 0x83, 0x71, 0x8B, 0x91, 0x93, 0xD1, 0x9C, 0x11, 0x9C, 0x31, 0x9C, 0x2F, 0xA4, 0x4F,
+   0xB4, 0x70, 0xB4, 0x4F, 0xBC, 0x4F, 0xBC, 0x2E, 0xC4, 0x2E, 0xC3, 0xED, 0xCB, 0xED, 0xC3, 0xAC,
+   0xD3, 0xCD, 0xCB, 0x8C, 0xD3, 0x8C, 0xD3, 0xAC, 0xD3, 0x8C, 0xD3, 0x8C, 0xCB, 0x6C, 0xD3, 0xAC,
+   0xD3, 0xCD, 0xCB, 0xAC, 0xCB, 0xCD, 0xCB, 0xED, 0xCB, 0xED, 0xC3, 0xED, 0xC4, 0x0D, 0xC4, 0x2E,
+   0xBC, 0x0D, 0xC4, 0x4E, 0xBC, 0x4E, 0xBC, 0x2E, 0xB4, 0x4E, 0xBC, 0x6F, 0xB4, 0x4E, 0xB4, 0x4F,
+   0xB4, 0x4E, 0xB4, 0x4E, 0xB4, 0x6F, 0xB4, 0x4E, 0xBC, 0x4F, 0xBC, 0x6F, 0xBC, 0x4E, 0xC4, 0x4E,
+   0xC4, 0x0D, 0xC3, 0xED, 0xC3, 0xED, 0xCB, 0xED, 0xCB, 0xAC, 0xCB, 0x6B, 0xD3, 0x6C, 0xDB, 0x4C,
+   0xDB, 0x2B, 0xE3, 0x0B, 0xE2, 0xEB, 0xDA, 0xAA, 0xE2, 0xAA, 0xEA, 0xAA, 0xE2, 0x89, 0xEA, 0xAA,
+   0xEA, 0xAA, 0xE2, 0x89, 0xEA, 0xAA, 0xE2, 0xAA, 0xE2, 0xAA, 0xDA, 0xCA, 0xE3, 0x2B, 0xDB, 0x2B,
+   0xD3, 0x4B, 0xCB, 0x6C, 0xCB, 0xAC, 0xCC, 0x2E, 0xBC, 0x2E, 0xB4, 0x4F, 0xB4, 0x6F, 0xA4, 0x4F,
+   0xA4, 0x71, 0x9C, 0x10, 0x93, 0xD1, 0x83, 0x70, 0x83, 0x31, 0x7A, 0xF1, 0x72, 0x90, 0x6A, 0x50,
+   0x62, 0x30, 0x62, 0x30, 0x62, 0x10, 0x62, 0x10, 0x51, 0xCF, 0x59, 0xF0, 0x51, 0xF0, 0x5A, 0x10,
+   0x5A, 0x10, 0x5A, 0x10, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x30, 0x62, 0x30, 0x72, 0x91, 0x72, 0xB1,
+   0x72, 0xD0, 0x83, 0x51, 0x93, 0xD1, 0x93, 0xD0, 0x9C, 0x30, 0xAC, 0x4F, 0xB4, 0x6F, 0xBC, 0x2E,
+   0xC3, 0xAC, 0xDB, 0x8C, 0xE3, 0x0B, 0xEA, 0xAA, 0xEA, 0x28, 0xFA, 0x08, 0xF9, 0xC7, 0xF9, 0xE6,
+   0x7B, 0x11, 0x83, 0x51, 0x8B, 0x91, 0x93, 0xD1, 0x93, 0xF1, 0x9C, 0x10, 0x9C, 0x30, 0xAC, 0x70,
+   0xAC, 0x70, 0xB4, 0x6F, 0xB4, 0x4F, 0xBC, 0x2E, 0xC4, 0x2E, 0xC3, 0xED, 0xC3, 0xCC, 0xCB, 0xED,
+   0xCB, 0xAC, 0xCB, 0x8C, 0xCB, 0x6C, 0xD3, 0x8C, 0xD3, 0x6C, 0xD3, 0x8C, 0xD3, 0x6C, 0xD3, 0x8C,
+   0xCB, 0x6B, 0xCB, 0x8C, 0xD3, 0xCD, 0xCB, 0xAC, 0xC3, 0xAC, 0xC3, 0xCD, 0xCC, 0x0D, 0xC4, 0x2E,
+   0xC4, 0x4E, 0xC4, 0x4E, 0xBC, 0x4E, 0xBC, 0x6F, 0xB4, 0x4E, 0xBC, 0x6F, 0xB4, 0x6F, 0xB4, 0x2E,
+   0xB4, 0x6F, 0xB4, 0x4F, 0xB4, 0x4F, 0xB4, 0x2E, 0xB4, 0x4E, 0xBC, 0x4F, 0xB4, 0x4E, 0xB4, 0x2E,
+   0xBC, 0x2E, 0xBC, 0x0D, 0xBB, 0xED, 0xC3, 0xCD, 0xCB, 0xED, 0xCB, 0xCD, 0xCB, 0xAC, 0xD3, 0x6C,
+   0xDB, 0x8C, 0xD3, 0x2B, 0xDB, 0x4B, 0xDB, 0x0B, 0xDA, 0xEA, 0xDA, 0xCA, 0xE2, 0xEA, 0xE2, 0xEA,
+   0xE2, 0xEB, 0xE2, 0xEA, 0xDA, 0xCA, 0xDA, 0xEA, 0xDA, 0xEA, 0xDB, 0x4B, 0xD3, 0x4B, 0xD3, 0x6C,
+   0xD3, 0xAC, 0xCB, 0xCC, 0xC4, 0x0D, 0xBC, 0x0D, 0xB4, 0x2E, 0xB4, 0x4F, 0xA4, 0x2F, 0xA4, 0x30,
+   0x9C, 0x10, 0x93, 0xD0, 0x93, 0xD1, 0x8B, 0x91, 0x83, 0x31, 0x7A, 0xF1, 0x6A, 0x90, 0x6A, 0x71,
+   0x6A, 0x51, 0x62, 0x10, 0x59, 0xF0, 0x59, 0xF0, 0x59, 0xF0, 0x5A, 0x10, 0x5A, 0x10, 0x51, 0xCF,
+   0x59, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x62, 0x10, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x91, 0x7A, 0xD1,
+   0x7B, 0x11, 0x83, 0x71, 0x8B, 0x90, 0x93, 0xF0, 0x9C, 0x30, 0xAC, 0x4F, 0xB4, 0x4E, 0xBC, 0x0D,
+   0xCB, 0xCD, 0xD3, 0x6C, 0xE3, 0x0B, 0xE2, 0x89, 0xF2, 0x49, 0xFA, 0x28, 0xF9, 0xE7, 0xFA, 0x07,
+   0x72, 0xB1, 0x83, 0x31, 0x83, 0x31, 0x8B, 0xB1, 0x8B, 0xD1, 0x94, 0x11, 0x9C, 0x30, 0xA4, 0x50,
+   0xA4, 0x2F, 0xAC, 0x2F, 0xB4, 0x4F, 0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x0D, 0xC3, 0xCD, 0xCB, 0xCD,
+   0xCB, 0x8C, 0xCB, 0x8C, 0xD3, 0xAC, 0xCB, 0x6B, 0xD3, 0x6C, 0xD3, 0x4B, 0xD3, 0x6C, 0xD3, 0x6B,
+   0xD3, 0xAC, 0xCB, 0x6C, 0xCB, 0x8C, 0xD3, 0xED, 0xCB, 0xCD, 0xC3, 0xCD, 0xC4, 0x0D, 0xC4, 0x2E,
+   0xBC, 0x0D, 0xBC, 0x0D, 0xBC, 0x4E, 0xBC, 0x6F, 0xB4, 0x4E, 0xBC, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F,
+   0xAC, 0x2E, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4F,
+   0xB4, 0x2E, 0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E, 0xC4, 0x0D, 0xCB, 0xED, 0xC3, 0xAC,
+   0xCB, 0xAC, 0xCB, 0x6C, 0xCB, 0x6B, 0xD3, 0x4B, 0xD3, 0x4B, 0xDB, 0x6C, 0xDB, 0x4B, 0xD3, 0x0B,
+   0xD3, 0x0B, 0xD3, 0x0B, 0xDB, 0x2B, 0xD3, 0x4B, 0xD3, 0x6C, 0xD3, 0x8C, 0xD3, 0xAD, 0xCB, 0xCD,
+   0xC3, 0xCD, 0xC4, 0x0D, 0xBC, 0x0D, 0xBC, 0x6F, 0xB4, 0x6F, 0xAC, 0x4F, 0xA4, 0x50, 0x9C, 0x10,
+   0x9C, 0x11, 0x93, 0xF1, 0x8B, 0x91, 0x7B, 0x31, 0x72, 0xD0, 0x7A, 0xD1, 0x72, 0x91, 0x62, 0x30,
+   0x62, 0x30, 0x62, 0x31, 0x62, 0x10, 0x51, 0xEF, 0x59, 0xF0, 0x51, 0xCF, 0x51, 0xEF, 0x5A, 0x10,
+   0x51, 0xCF, 0x59, 0xF0, 0x59, 0xEF, 0x62, 0x10, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x70, 0x72, 0xB1,
+   0x7B, 0x11, 0x8B, 0x91, 0x93, 0xD1, 0x93, 0xF0, 0xA4, 0x30, 0xAC, 0x6F, 0xBC, 0x6F, 0xC4, 0x2E,
+   0xCB, 0xCD, 0xD3, 0x4B, 0xE3, 0x0B, 0xE2, 0x89, 0xF2, 0x49, 0xFA, 0x28, 0xFA, 0x08, 0xF9, 0xE6,
+   0x72, 0xB1, 0x72, 0xB0, 0x7A, 0xF1, 0x83, 0x51, 0x8B, 0x90, 0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x30,
+   0xAC, 0x70, 0xAC, 0x2F, 0xB4, 0x4F, 0xB4, 0x4E, 0xBC, 0x2E, 0xC4, 0x0D, 0xC3, 0xED, 0xCB, 0xED,
+   0xCB, 0xAC, 0xCB, 0x8C, 0xCB, 0x8C, 0xD3, 0x8C, 0xCB, 0x4B, 0xD3, 0x8C, 0xD3, 0x6C, 0xD3, 0x8C,
+   0xCB, 0x8C, 0xCB, 0xAC, 0xCB, 0xAC, 0xCB, 0xCD, 0xCB, 0xED, 0xC3, 0xED, 0xC3, 0xED, 0xBC, 0x0D,
+   0xC4, 0x4E, 0xBC, 0x4E, 0xB4, 0x2E, 0xBC, 0x6F, 0xB4, 0x2E, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F,
+   0xB4, 0x70, 0xAC, 0x2F, 0xAC, 0x4F, 0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x70, 0xB4, 0x6F, 0xB4, 0x6F,
+   0xAC, 0x4F, 0xB4, 0x4F, 0xB4, 0x4F, 0xBC, 0x4F, 0xBC, 0x6F, 0xBC, 0x2E, 0xC4, 0x2E, 0xC4, 0x2E,
+   0xC3, 0xED, 0xCC, 0x0D, 0xCB, 0xED, 0xCB, 0xCD, 0xCB, 0xAC, 0xCB, 0xAC, 0xCB, 0x8C, 0xD3, 0xAC,
+   0xCB, 0x8C, 0xD3, 0xAC, 0xCB, 0x8C, 0xCB, 0x8C, 0xCB, 0xAC, 0xCB, 0xCD, 0xCC, 0x0D, 0xC4, 0x2E,
+   0xBC, 0x2E, 0xBC, 0x4E, 0xB4, 0x4E, 0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x30, 0x9C, 0x10, 0x9C, 0x31,
+   0x93, 0xD1, 0x8B, 0xB1, 0x83, 0x71, 0x7A, 0xF1, 0x72, 0xB1, 0x72, 0xB1, 0x6A, 0x51, 0x62, 0x10,
+   0x59, 0xF0, 0x59, 0xF0, 0x51, 0xCF, 0x5A, 0x10, 0x51, 0xEF, 0x51, 0xCF, 0x52, 0x10, 0x51, 0xEF,
+   0x5A, 0x10, 0x59, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x70, 0x72, 0x90,
+   0x7A, 0xF0, 0x83, 0x51, 0x8B, 0x90, 0x94, 0x10, 0x9C, 0x30, 0xAC, 0x70, 0xB4, 0x6F, 0xBC, 0x2E,
+   0xC3, 0xCD, 0xD3, 0x8C, 0xDB, 0x0B, 0xE2, 0xAA, 0xEA, 0x69, 0xFA, 0x29, 0xF9, 0xE7, 0xF9, 0xE7,
+   0x6A, 0x51, 0x72, 0x91, 0x7A, 0xF1, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xD1, 0x9C, 0x11, 0x9C, 0x31,
+   0xA4, 0x30, 0xA4, 0x4F, 0xB4, 0x6F, 0xB4, 0x4E, 0xB4, 0x2E, 0xC4, 0x2E, 0xC4, 0x0D, 0xC3, 0xED,
+   0xCB, 0xCC, 0xD3, 0xCD, 0xCB, 0x8C, 0xCB, 0x8C, 0xD3, 0xAC, 0xD3, 0x8C, 0xCB, 0x6C, 0xD3, 0x8C,
+   0xD3, 0xAC, 0xCB, 0xAC, 0xD3, 0xED, 0xC3, 0xCC, 0xC3, 0xCD, 0xCC, 0x2E, 0xC4, 0x2E, 0xBC, 0x0E,
+   0xBC, 0x4E, 0xBC, 0x6F, 0xBC, 0x6F, 0xB4, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x4F,
+   0xAC, 0x70, 0xA4, 0x4F, 0xA4, 0x50, 0xA4, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70,
+   0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x70, 0xB4, 0x70, 0xB4, 0x4F, 0xB4, 0x4E, 0xB4, 0x2E, 0xBC, 0x6F,
+   0xBC, 0x4E, 0xBC, 0x0D, 0xC4, 0x4E, 0xBB, 0xED, 0xBB, 0xED, 0xC3, 0xED, 0xCC, 0x0E, 0xCC, 0x0E,
+   0xC3, 0xED, 0xC4, 0x0D, 0xC3, 0xED, 0xC3, 0xED, 0xC4, 0x2E, 0xC4, 0x4E, 0xBC, 0x2E, 0xB4, 0x2E,
+   0xBC, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x10, 0x94, 0x11, 0x93, 0xF1,
+   0x8B, 0x91, 0x83, 0x31, 0x7A, 0xF1, 0x72, 0xD1, 0x72, 0xB1, 0x6A, 0x50, 0x62, 0x10, 0x62, 0x10,
+   0x59, 0xEF, 0x5A, 0x10, 0x59, 0xF0, 0x51, 0xCF, 0x49, 0xCF, 0x51, 0xEF, 0x51, 0xEF, 0x51, 0xEF,
+   0x52, 0x10, 0x5A, 0x10, 0x5A, 0x10, 0x5A, 0x10, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x91, 0x72, 0xB1,
+   0x7B, 0x11, 0x83, 0x51, 0x8B, 0x90, 0x9C, 0x11, 0xA4, 0x50, 0xAC, 0x4F, 0xB4, 0x6F, 0xBC, 0x2E,
+   0xC3, 0xED, 0xCB, 0x8C, 0xDB, 0x2B, 0xE2, 0xCA, 0xEA, 0x89, 0xF2, 0x49, 0xFA, 0x28, 0xF9, 0xE7,
+   0x62, 0x31, 0x6A, 0x71, 0x6A, 0x90, 0x7A, 0xF1, 0x7B, 0x11, 0x83, 0x71, 0x93, 0xD1, 0x9C, 0x31,
+   0x9C, 0x30, 0xAC, 0x70, 0xAC, 0x2F, 0xB4, 0x6F, 0xBC, 0x4E, 0xBC, 0x2E, 0xC4, 0x2E, 0xC3, 0xED,
+   0xCB, 0xED, 0xCB, 0xED, 0xCB, 0xAC, 0xCB, 0x8C, 0xCB, 0x8C, 0xD3, 0xAD, 0xD3, 0xAC, 0xD3, 0xCD,
+   0xCB, 0xAC, 0xCB, 0xAC, 0xC3, 0xAC, 0xCC, 0x0D, 0xC4, 0x2E, 0xBB, 0xED, 0xBC, 0x4E, 0xB4, 0x2E,
+   0xBC, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xA4, 0x4F, 0xA4, 0x50, 0xA4, 0x50,
+   0xA4, 0x71, 0x9C, 0x30, 0x9C, 0x30, 0xA4, 0x51, 0x9C, 0x30, 0x9C, 0x30, 0x9C, 0x10, 0x9C, 0x10,
+   0x9C, 0x30, 0x9C, 0x30, 0xA4, 0x70, 0xA4, 0x2F, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x6F,
+   0xB4, 0x70, 0xB4, 0x4F, 0xB4, 0x2E, 0xB4, 0x4F, 0xB4, 0x4E, 0xBC, 0x4E, 0xB4, 0x2E, 0xBC, 0x4E,
+   0xBC, 0x2E, 0xBC, 0x4E, 0xBC, 0x6F, 0xB4, 0x4E, 0xB4, 0x2E, 0xB4, 0x4E, 0xB4, 0x4F, 0xB4, 0x6F,
+   0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x50, 0xA4, 0x50, 0x94, 0x10, 0x93, 0xD0, 0x8B, 0x90, 0x8B, 0x91,
+   0x83, 0x51, 0x7A, 0xF1, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x71, 0x62, 0x10, 0x62, 0x31, 0x62, 0x10,
+   0x59, 0xF0, 0x51, 0xCF, 0x52, 0x10, 0x49, 0xCF, 0x49, 0xCF, 0x49, 0xCE, 0x49, 0xEF, 0x51, 0xEF,
+   0x51, 0xEF, 0x51, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x59, 0xF0, 0x62, 0x10, 0x6A, 0x51, 0x72, 0xB1,
+   0x7A, 0xF1, 0x83, 0x51, 0x8B, 0x91, 0x93, 0xF1, 0x9C, 0x10, 0xA4, 0x50, 0xB4, 0x6F, 0xB4, 0x2E,
+   0xC4, 0x0D, 0xCB, 0xAC, 0xD3, 0x4B, 0xE3, 0x2B, 0xE2, 0xAA, 0xF2, 0x89, 0xFA, 0x49, 0xFA, 0x08,
+   0x5A, 0x10, 0x6A, 0x51, 0x6A, 0x71, 0x7A, 0xD1, 0x7A, 0xF1, 0x83, 0x51, 0x8B, 0x91, 0x93, 0xF1,
+   0x9C, 0x31, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x4F, 0xBC, 0x6F, 0xBC, 0x0D, 0xBB, 0xED,
+   0xCC, 0x0D, 0xCB, 0xED, 0xCB, 0xCD, 0xCB, 0xAC, 0xCB, 0xAC, 0xCB, 0xAC, 0xCB, 0xAC, 0xCB, 0xCC,
+   0xC3, 0xAC, 0xC3, 0xCC, 0xC3, 0xCD, 0xBB, 0xED, 0xBC, 0x0D, 0xBC, 0x2E, 0xBC, 0x6F, 0xB4, 0x6F,
+   0xB4, 0x6F, 0xB4, 0x6F, 0xAC, 0x6F, 0xAC, 0x70, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x51, 0x9C, 0x31,
+   0x9C, 0x31, 0x9C, 0x11, 0x93, 0xF0, 0x93, 0xF0, 0x93, 0xD0, 0x93, 0xF1, 0x93, 0xF1, 0x93, 0xF1,
+   0x93, 0xF1, 0x93, 0xF0, 0x9C, 0x11, 0x9C, 0x31, 0x9C, 0x30, 0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x50,
+   0xA4, 0x50, 0xA4, 0x2F, 0xA4, 0x4F, 0xAC, 0x4F, 0xA4, 0x2F, 0xAC, 0x2F, 0xB4, 0x6F, 0xB4, 0x70,
+   0xAC, 0x4F, 0xAC, 0x2F, 0xAC, 0x4F, 0xAC, 0x2F, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x2F,
+   0x9C, 0x30, 0x9C, 0x10, 0x9C, 0x10, 0x9C, 0x11, 0x8B, 0xB0, 0x8B, 0xB1, 0x83, 0x51, 0x7B, 0x11,
+   0x7A, 0xF1, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x50, 0x62, 0x30, 0x62, 0x31, 0x5A, 0x10, 0x59, 0xF0,
+   0x52, 0x10, 0x49, 0xCF, 0x52, 0x0F, 0x49, 0xCE, 0x4A, 0x0F, 0x49, 0xCE, 0x4A, 0x0F, 0x49, 0xEF,
+   0x49, 0xEF, 0x52, 0x0F, 0x51, 0xCF, 0x51, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x6A, 0x51, 0x6A, 0x50,
+   0x7A, 0xD1, 0x7A, 0xF0, 0x83, 0x71, 0x8B, 0xB0, 0x93, 0xF0, 0xA4, 0x30, 0xAC, 0x4F, 0xB4, 0x2E,
+   0xBC, 0x0D, 0xC3, 0xED, 0xD3, 0xAC, 0xD3, 0x0B, 0xE2, 0xEB, 0xEA, 0xAA, 0xF2, 0x69, 0xFA, 0x49,
+   0x5A, 0x10, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x70, 0x72, 0xD1, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xD1,
+   0x93, 0xF0, 0x9C, 0x30, 0xA4, 0x70, 0xAC, 0x4F, 0xAC, 0x4F, 0xBC, 0x6F, 0xB4, 0x2E, 0xC4, 0x4E,
+   0xC4, 0x2E, 0xC3, 0xED, 0xCC, 0x0D, 0xC3, 0xCC, 0xCB, 0xCD, 0xCB, 0xCD, 0xCB, 0xED, 0xCB, 0xED,
+   0xC3, 0xED, 0xC3, 0xED, 0xC4, 0x0D, 0xBC, 0x0D, 0xBC, 0x4E, 0xBC, 0x4E, 0xB4, 0x4E, 0xAC, 0x2E,
+   0xAC, 0x6F, 0xA4, 0x4F, 0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x30, 0x9C, 0x10, 0x9C, 0x31, 0x93, 0xD0,
+   0x93, 0xD1, 0x8B, 0xD1, 0x8B, 0x90, 0x8B, 0x91, 0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0xB1, 0x8B, 0x91,
+   0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0x91, 0x8B, 0xB1, 0x93, 0xD1, 0x93, 0xD1, 0x93, 0xF1, 0x9C, 0x11,
+   0x93, 0xF0, 0x9C, 0x31, 0x9C, 0x31, 0xA4, 0x51, 0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x30, 0xA4, 0x70,
+   0xA4, 0x70, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x30, 0xA4, 0x51, 0x9C, 0x30, 0x9C, 0x10,
+   0x94, 0x10, 0x93, 0xF1, 0x93, 0xD1, 0x8B, 0x90, 0x83, 0x71, 0x83, 0x51, 0x7B, 0x11, 0x72, 0xB1,
+   0x72, 0x91, 0x72, 0x91, 0x6A, 0x51, 0x62, 0x10, 0x62, 0x30, 0x59, 0xF0, 0x5A, 0x10, 0x52, 0x10,
+   0x49, 0xEF, 0x49, 0xEF, 0x49, 0xEE, 0x4A, 0x0F, 0x4A, 0x0F, 0x41, 0xEE, 0x41, 0xEE, 0x41, 0xEE,
+   0x4A, 0x0F, 0x49, 0xEF, 0x52, 0x0F, 0x52, 0x10, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x31, 0x6A, 0x71,
+   0x72, 0xB1, 0x7A, 0xF1, 0x83, 0x51, 0x8B, 0x90, 0x93, 0xF1, 0x9C, 0x30, 0xAC, 0x70, 0xAC, 0x4F,
+   0xB4, 0x2E, 0xC4, 0x2E, 0xCB, 0xCD, 0xCB, 0x4B, 0xD3, 0x0A, 0xDA, 0xCA, 0xEA, 0xAA, 0xEA, 0x69,
+   0x51, 0xEF, 0x59, 0xF0, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x91, 0x7A, 0xD1, 0x7B, 0x11, 0x83, 0x71,
+   0x93, 0xD1, 0x94, 0x10, 0x9C, 0x30, 0xA4, 0x4F, 0xAC, 0x6F, 0xAC, 0x2E, 0xB4, 0x2E, 0xBC, 0x6F,
+   0xBC, 0x2E, 0xC4, 0x2E, 0xC4, 0x0E, 0xC3, 0xED, 0xC4, 0x0D, 0xC3, 0xED, 0xC4, 0x0D, 0xC4, 0x0E,
+   0xC4, 0x0D, 0xBC, 0x0E, 0xBC, 0x2E, 0xB4, 0x2E, 0xB4, 0x2E, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x70,
+   0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x10, 0x9C, 0x31, 0x9C, 0x11, 0x93, 0xF1, 0x93, 0xD1, 0x8B, 0xB1,
+   0x83, 0x71, 0x83, 0x51, 0x8B, 0x71, 0x7B, 0x31, 0x83, 0x31, 0x83, 0x31, 0x7B, 0x11, 0x83, 0x31,
+   0x83, 0x31, 0x83, 0x31, 0x7B, 0x11, 0x83, 0x31, 0x83, 0x51, 0x83, 0x51, 0x83, 0x50, 0x83, 0x71,
+   0x8B, 0x91, 0x8B, 0x90, 0x8B, 0xB0, 0x8B, 0xD0, 0x93, 0xF1, 0x94, 0x11, 0x93, 0xF1, 0x93, 0xF0,
+   0x9C, 0x31, 0x9C, 0x11, 0x94, 0x11, 0x94, 0x11, 0x9C, 0x11, 0x94, 0x11, 0x93, 0xD1, 0x8B, 0xB1,
+   0x93, 0xD1, 0x83, 0x71, 0x83, 0x71, 0x83, 0x31, 0x83, 0x31, 0x7A, 0xF1, 0x72, 0xB1, 0x72, 0x91,
+   0x6A, 0x71, 0x6A, 0x51, 0x5A, 0x10, 0x59, 0xF0, 0x5A, 0x10, 0x5A, 0x10, 0x49, 0xCF, 0x4A, 0x0F,
+   0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x2F, 0x42, 0x0E, 0x42, 0x2E, 0x42, 0x0E, 0x42, 0x0E, 0x41, 0xEE,
+   0x4A, 0x2F, 0x41, 0xCE, 0x49, 0xCE, 0x49, 0xCF, 0x51, 0xEF, 0x59, 0xF0, 0x62, 0x31, 0x6A, 0x30,
+   0x6A, 0x50, 0x7A, 0xD1, 0x7A, 0xF0, 0x8B, 0x71, 0x93, 0xF1, 0x94, 0x10, 0x9C, 0x2F, 0xAC, 0x4F,
+   0xB4, 0x6F, 0xBC, 0x2E, 0xCC, 0x2E, 0xCB, 0xCD, 0xD3, 0x8C, 0xDB, 0x4C, 0xDA, 0xEA, 0xE2, 0xA9,
+   0x4A, 0x0F, 0x49, 0xCF, 0x51, 0xEF, 0x62, 0x10, 0x6A, 0x51, 0x72, 0xB1, 0x7B, 0x11, 0x83, 0x51,
+   0x8B, 0x90, 0x93, 0xF1, 0x9C, 0x10, 0x9C, 0x2F, 0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x2E,
+   0xBC, 0x4E, 0xBC, 0x2E, 0xBC, 0x2E, 0xC4, 0x2E, 0xBC, 0x0D, 0xC4, 0x0D, 0xBC, 0x0D, 0xC4, 0x2E,
+   0xBC, 0x2E, 0xBC, 0x6F, 0xBC, 0x4F, 0xB4, 0x4E, 0xAC, 0x2E, 0xAC, 0x6F, 0xAC, 0x50, 0xA4, 0x50,
+   0x9C, 0x10, 0x9C, 0x31, 0x93, 0xF0, 0x93, 0xD0, 0x8B, 0x90, 0x83, 0x71, 0x83, 0x51, 0x83, 0x31,
+   0x83, 0x31, 0x83, 0x11, 0x72, 0xD1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0x90, 0x72, 0xB1, 0x72, 0xB1,
+   0x6A, 0x90, 0x72, 0xB1, 0x72, 0x91, 0x72, 0xB1, 0x7A, 0xD1, 0x72, 0xB0, 0x7A, 0xD1, 0x7A, 0xD0,
+   0x83, 0x31, 0x83, 0x31, 0x83, 0x31, 0x83, 0x71, 0x83, 0x71, 0x8B, 0x91, 0x8B, 0x71, 0x8B, 0x71,
+   0x8B, 0xB1, 0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0xB1, 0x8B, 0x91, 0x8B, 0x91, 0x83, 0x71, 0x83, 0x71,
+   0x83, 0x71, 0x83, 0x31, 0x7A, 0xF0, 0x7A, 0xD1, 0x72, 0x90, 0x6A, 0x91, 0x72, 0x91, 0x6A, 0x30,
+   0x62, 0x10, 0x62, 0x30, 0x59, 0xF0, 0x51, 0xF0, 0x51, 0xEF, 0x52, 0x0F, 0x4A, 0x0F, 0x4A, 0x0E,
+   0x42, 0x0E, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x2E, 0x3A, 0x0D, 0x3A, 0x2E, 0x3A, 0x0D, 0x42, 0x2E,
+   0x42, 0x2E, 0x41, 0xEE, 0x4A, 0x0F, 0x49, 0xEF, 0x49, 0xCF, 0x5A, 0x10, 0x5A, 0x10, 0x62, 0x51,
+   0x6A, 0x30, 0x72, 0xB1, 0x72, 0xD0, 0x83, 0x31, 0x83, 0x70, 0x93, 0xD0, 0x9C, 0x10, 0xA4, 0x2F,
+   0xAC, 0x6F, 0xB4, 0x4E, 0xBC, 0x2E, 0xC3, 0xED, 0xCB, 0xCD, 0xD3, 0x6C, 0xD3, 0x2B, 0xE3, 0x2B,
+   0x42, 0x0E, 0x49, 0xEF, 0x51, 0xCF, 0x59, 0xCF, 0x62, 0x10, 0x6A, 0x71, 0x7A, 0xD1, 0x7B, 0x11,
+   0x8B, 0x91, 0x8B, 0xB0, 0x93, 0xF0, 0x9C, 0x30, 0xA4, 0x50, 0xAC, 0x4F, 0xAC, 0x4F, 0xB4, 0x4E,
+   0xBC, 0x6F, 0xBC, 0x4F, 0xBC, 0x4F, 0xBC, 0x2E, 0xC4, 0x4E, 0xBC, 0x2E, 0xBC, 0x2E, 0xB4, 0x2E,
+   0xB4, 0x2E, 0xB4, 0x4E, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x30, 0x9C, 0x30,
+   0x94, 0x10, 0x94, 0x11, 0x8B, 0x90, 0x8B, 0x91, 0x83, 0x71, 0x83, 0x31, 0x7A, 0xF1, 0x7A, 0xF1,
+   0x72, 0xB1, 0x72, 0x91, 0x6A, 0x71, 0x6A, 0x71, 0x6A, 0x30, 0x6A, 0x71, 0x62, 0x30, 0x6A, 0x51,
+   0x6A, 0x51, 0x62, 0x30, 0x6A, 0x71, 0x62, 0x30, 0x6A, 0x71, 0x6A, 0x50, 0x6A, 0x71, 0x6A, 0x71,
+   0x6A, 0x70, 0x72, 0xB1, 0x72, 0x90, 0x72, 0xB1, 0x72, 0xB0, 0x7A, 0xF1, 0x83, 0x11, 0x83, 0x31,
+   0x7A, 0xF1, 0x7B, 0x11, 0x7B, 0x11, 0x83, 0x31, 0x7B, 0x11, 0x83, 0x31, 0x7A, 0xF1, 0x7A, 0xF1,
+   0x7A, 0xD1, 0x72, 0xB1, 0x72, 0xB1, 0x6A, 0x71, 0x6A, 0x71, 0x6A, 0x71, 0x62, 0x31, 0x59, 0xF0,
+   0x59, 0xF0, 0x5A, 0x10, 0x5A, 0x10, 0x52, 0x0F, 0x49, 0xCE, 0x49, 0xEE, 0x41, 0xEE, 0x39, 0xED,
+   0x3A, 0x0D, 0x3A, 0x2D, 0x3A, 0x4E, 0x3A, 0x4E, 0x32, 0x2D, 0x3A, 0x4D, 0x3A, 0x2D, 0x42, 0x4E,
+   0x42, 0x4E, 0x3A, 0x0D, 0x4A, 0x2F, 0x41, 0xCE, 0x52, 0x0F, 0x52, 0x10, 0x5A, 0x10, 0x5A, 0x10,
+   0x62, 0x10, 0x6A, 0x50, 0x72, 0xB1, 0x83, 0x31, 0x83, 0x51, 0x93, 0xD1, 0x93, 0xF1, 0x9C, 0x30,
+   0xAC, 0x70, 0xAC, 0x2F, 0xB4, 0x4E, 0xBC, 0x2E, 0xC4, 0x0D, 0xCB, 0xCD, 0xD3, 0xAC, 0xD3, 0x8C,
+   0x3A, 0x2D, 0x41, 0xEE, 0x49, 0xCE, 0x51, 0xCF, 0x62, 0x10, 0x6A, 0x71, 0x72, 0x91, 0x7B, 0x11,
+   0x83, 0x51, 0x8B, 0x91, 0x94, 0x11, 0x94, 0x10, 0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x2F, 0xB4, 0x6F,
+   0xB4, 0x6F, 0xB4, 0x2E, 0xB4, 0x2E, 0xBC, 0x4F, 0xBC, 0x4E, 0xB4, 0x4E, 0xBC, 0x4E, 0xB4, 0x4F,
+   0xB4, 0x4E, 0xB4, 0x4F, 0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x50, 0xA4, 0x50, 0x9C, 0x31, 0x93, 0xF0,
+   0x93, 0xD1, 0x93, 0xD1, 0x83, 0x51, 0x83, 0x31, 0x7A, 0xF1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0x91,
+   0x6A, 0x50, 0x6A, 0x30, 0x62, 0x30, 0x62, 0x31, 0x62, 0x10, 0x62, 0x10, 0x59, 0xF0, 0x59, 0xF0,
+   0x51, 0xCF, 0x51, 0xCF, 0x5A, 0x10, 0x59, 0xF0, 0x59, 0xF0, 0x62, 0x30, 0x62, 0x31, 0x62, 0x31,
+   0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x50, 0x6A, 0x91, 0x6A, 0x70, 0x72, 0x91,
+   0x72, 0xB1, 0x6A, 0x90, 0x72, 0xB1, 0x72, 0x90, 0x72, 0xB1, 0x72, 0xB1, 0x6A, 0x90, 0x6A, 0x91,
+   0x6A, 0x70, 0x6A, 0x71, 0x6A, 0x50, 0x6A, 0x71, 0x62, 0x31, 0x62, 0x10, 0x59, 0xF0, 0x5A, 0x10,
+   0x5A, 0x10, 0x52, 0x10, 0x52, 0x0F, 0x49, 0xEF, 0x4A, 0x0F, 0x41, 0xEE, 0x42, 0x0E, 0x3A, 0x2D,
+   0x3A, 0x6E, 0x3A, 0x4D, 0x3A, 0x4D, 0x3A, 0x6D, 0x32, 0x6D, 0x32, 0x6D, 0x3A, 0x6D, 0x32, 0x4D,
+   0x3A, 0x2D, 0x3A, 0x2E, 0x39, 0xED, 0x41, 0xEE, 0x49, 0xEF, 0x51, 0xEF, 0x52, 0x10, 0x59, 0xF0,
+   0x59, 0xF0, 0x6A, 0x51, 0x6A, 0x71, 0x7A, 0xF1, 0x7B, 0x11, 0x8B, 0x71, 0x93, 0xF1, 0x9C, 0x11,
+   0x9C, 0x30, 0xAC, 0x70, 0xB4, 0x6F, 0xBC, 0x6F, 0xBC, 0x4E, 0xC4, 0x2E, 0xC3, 0xCD, 0xCB, 0xCC,
+   0x32, 0x4D, 0x42, 0x2E, 0x49, 0xEF, 0x51, 0xEF, 0x5A, 0x10, 0x6A, 0x51, 0x72, 0x91, 0x72, 0xB1,
+   0x7B, 0x11, 0x83, 0x71, 0x93, 0xD1, 0x9C, 0x11, 0xA4, 0x51, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x70,
+   0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4F, 0xB4, 0x2E, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F,
+   0xB4, 0x6F, 0xAC, 0x6F, 0xA4, 0x2F, 0xA4, 0x70, 0xA4, 0x51, 0x9C, 0x10, 0x94, 0x11, 0x8B, 0xB1,
+   0x83, 0x70, 0x83, 0x71, 0x7B, 0x11, 0x7A, 0xF1, 0x6A, 0x90, 0x6A, 0x70, 0x6A, 0x71, 0x62, 0x10,
+   0x62, 0x31, 0x59, 0xF0, 0x5A, 0x10, 0x51, 0xCF, 0x51, 0xEF, 0x49, 0xCF, 0x49, 0xCF, 0x51, 0xEF,
+   0x51, 0xEF, 0x49, 0xCF, 0x52, 0x10, 0x49, 0xEF, 0x51, 0xEF, 0x52, 0x10, 0x51, 0xEF, 0x5A, 0x10,
+   0x59, 0xF0, 0x59, 0xCF, 0x59, 0xCF, 0x62, 0x31, 0x62, 0x31, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x51,
+   0x6A, 0x50, 0x6A, 0x51, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x51, 0x6A, 0x51,
+   0x62, 0x30, 0x6A, 0x51, 0x62, 0x31, 0x62, 0x31, 0x59, 0xEF, 0x59, 0xF0, 0x59, 0xF0, 0x51, 0xEF,
+   0x49, 0xCF, 0x49, 0xEF, 0x49, 0xEF, 0x4A, 0x0E, 0x42, 0x0E, 0x42, 0x2E, 0x3A, 0x2D, 0x3A, 0x4D,
+   0x32, 0x4D, 0x32, 0x6D, 0x32, 0x8D, 0x32, 0x6C, 0x2A, 0x6C, 0x32, 0x6C, 0x32, 0x8D, 0x32, 0x6D,
+   0x32, 0x4D, 0x32, 0x2D, 0x3A, 0x0D, 0x42, 0x2E, 0x42, 0x0E, 0x4A, 0x0F, 0x52, 0x10, 0x51, 0xF0,
+   0x5A, 0x10, 0x6A, 0x51, 0x6A, 0x71, 0x72, 0xB1, 0x7A, 0xF1, 0x7B, 0x10, 0x8B, 0x91, 0x93, 0xF1,
+   0x9C, 0x31, 0xA4, 0x50, 0xA4, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xBC, 0x4E, 0xBC, 0x2E, 0xC4, 0x0D,
+   0x32, 0x8C, 0x3A, 0x4D, 0x4A, 0x2F, 0x52, 0x0F, 0x51, 0xF0, 0x62, 0x10, 0x6A, 0x71, 0x72, 0xB1,
+   0x7B, 0x11, 0x83, 0x71, 0x93, 0xD1, 0x93, 0xF1, 0x9C, 0x10, 0xA4, 0x51, 0xA4, 0x2F, 0xA4, 0x4F,
+   0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x4F, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x2F, 0xAC, 0x4F,
+   0xAC, 0x4F, 0xAC, 0x70, 0xA4, 0x70, 0x9C, 0x30, 0x9C, 0x31, 0x93, 0xD0, 0x8B, 0xB1, 0x83, 0x71,
+   0x83, 0x31, 0x7A, 0xF1, 0x72, 0xB1, 0x6A, 0x71, 0x6A, 0x71, 0x62, 0x30, 0x62, 0x10, 0x59, 0xF0,
+   0x5A, 0x10, 0x52, 0x10, 0x49, 0xCF, 0x49, 0xEF, 0x4A, 0x0F, 0x4A, 0x0F, 0x41, 0xEE, 0x41, 0xEE,
+   0x42, 0x0E, 0x42, 0x0E, 0x41, 0xEE, 0x41, 0xEE, 0x41, 0xEE, 0x4A, 0x0F, 0x41, 0xEE, 0x4A, 0x0F,
+   0x49, 0xCF, 0x49, 0xCE, 0x49, 0xCF, 0x51, 0xCF, 0x51, 0xEF, 0x59, 0xF0, 0x5A, 0x10, 0x59, 0xF0,
+   0x59, 0xF0, 0x62, 0x31, 0x62, 0x10, 0x62, 0x10, 0x59, 0xF0, 0x62, 0x31, 0x59, 0xF0, 0x62, 0x10,
+   0x62, 0x30, 0x62, 0x10, 0x59, 0xF0, 0x5A, 0x10, 0x51, 0xCF, 0x51, 0xCF, 0x52, 0x10, 0x49, 0xEF,
+   0x49, 0xEF, 0x41, 0xEE, 0x41, 0xEE, 0x39, 0xED, 0x3A, 0x0D, 0x3A, 0x0D, 0x3A, 0x6D, 0x3A, 0x6D,
+   0x32, 0x6C, 0x2A, 0x6C, 0x2A, 0x8C, 0x32, 0xAC, 0x32, 0xAC, 0x2A, 0x8C, 0x32, 0x8C, 0x32, 0xAD,
+   0x3A, 0x8D, 0x32, 0x4D, 0x3A, 0x4D, 0x3A, 0x0D, 0x42, 0x2E, 0x41, 0xEE, 0x4A, 0x0F, 0x51, 0xEF,
+   0x5A, 0x10, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x50, 0x72, 0xB1, 0x83, 0x11, 0x83, 0x51, 0x8B, 0x91,
+   0x8B, 0xD0, 0x9C, 0x31, 0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x4F, 0xB4, 0x4F, 0xBC, 0x6F,
+   0x2A, 0xAC, 0x3A, 0x6D, 0x42, 0x2E, 0x49, 0xEF, 0x51, 0xCF, 0x59, 0xF0, 0x6A, 0x30, 0x6A, 0x70,
+   0x7A, 0xF1, 0x83, 0x51, 0x8B, 0x71, 0x93, 0xF1, 0x94, 0x10, 0x9C, 0x10, 0xA4, 0x70, 0xA4, 0x4F,
+   0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x70, 0xAC, 0x4F, 0xB4, 0x70, 0xAC, 0x6F, 0xAC, 0x4F, 0xAC, 0x50,
+   0xA4, 0x50, 0xA4, 0x30, 0xA4, 0x51, 0x9C, 0x10, 0x93, 0xF1, 0x8B, 0x90, 0x83, 0x71, 0x83, 0x31,
+   0x7B, 0x11, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x71, 0x62, 0x10, 0x62, 0x30, 0x59, 0xF0, 0x51, 0xCF,
+   0x49, 0xEF, 0x4A, 0x0F, 0x41, 0xEE, 0x42, 0x0E, 0x3A, 0x0D, 0x3A, 0x0D, 0x3A, 0x6E, 0x32, 0x2D,
+   0x32, 0x2D, 0x3A, 0x6D, 0x32, 0x4D, 0x3A, 0x4D, 0x32, 0x2D, 0x3A, 0x4E, 0x3A, 0x0D, 0x42, 0x2E,
+   0x39, 0xED, 0x42, 0x2E, 0x4A, 0x0F, 0x49, 0xEF, 0x49, 0xCE, 0x52, 0x0F, 0x52, 0x0F, 0x51, 0xCF,
+   0x51, 0xEF, 0x51, 0xCF, 0x51, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x59, 0xF0, 0x5A, 0x10, 0x5A, 0x10,
+   0x5A, 0x10, 0x59, 0xF0, 0x5A, 0x10, 0x51, 0xF0, 0x51, 0xEF, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xEE,
+   0x4A, 0x0E, 0x42, 0x0E, 0x39, 0xED, 0x3A, 0x0D, 0x3A, 0x4D, 0x32, 0x2D, 0x32, 0x6D, 0x32, 0x6C,
+   0x32, 0xAD, 0x2A, 0x8C, 0x2A, 0x8C, 0x2A, 0xAC, 0x2A, 0xAC, 0x32, 0xCC, 0x2A, 0xAC, 0x2A, 0x8C,
+   0x32, 0x8D, 0x32, 0x6D, 0x3A, 0x6D, 0x3A, 0x2D, 0x3A, 0x0D, 0x41, 0xEE, 0x49, 0xEE, 0x49, 0xEF,
+   0x51, 0xF0, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x70, 0x72, 0xB1, 0x83, 0x31, 0x8B, 0x71,
+   0x93, 0xB1, 0x93, 0xF1, 0x9C, 0x11, 0x9C, 0x10, 0xA4, 0x50, 0xA4, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F,
+   0x2A, 0xCC, 0x32, 0x6C, 0x3A, 0x0D, 0x49, 0xEF, 0x52, 0x10, 0x59, 0xF0, 0x6A, 0x51, 0x6A, 0x70,
+   0x7A, 0xD1, 0x83, 0x31, 0x83, 0x70, 0x93, 0xF1, 0x93, 0xF0, 0x9C, 0x10, 0x9C, 0x30, 0xAC, 0x70,
+   0xA4, 0x4F, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x4F, 0xA4, 0x2F, 0xAC, 0x70, 0xA4, 0x2F, 0xAC, 0x70,
+   0xA4, 0x50, 0x9C, 0x30, 0x93, 0xF0, 0x94, 0x11, 0x93, 0xD1, 0x8B, 0x91, 0x83, 0x51, 0x7B, 0x11,
+   0x7A, 0xD1, 0x6A, 0x71, 0x6A, 0x30, 0x59, 0xF0, 0x59, 0xF0, 0x5A, 0x10, 0x51, 0xEF, 0x49, 0xEF,
+   0x42, 0x0E, 0x42, 0x0E, 0x42, 0x4E, 0x3A, 0x4D, 0x32, 0x4C, 0x2A, 0x6C, 0x32, 0xAD, 0x2A, 0x8C,
+   0x2A, 0xAC, 0x32, 0xCC, 0x32, 0xAC, 0x32, 0xAC, 0x2A, 0x8C, 0x32, 0x8C, 0x32, 0x6C, 0x32, 0x8D,
+   0x32, 0x4D, 0x3A, 0x4D, 0x42, 0x4E, 0x42, 0x4E, 0x39, 0xED, 0x41, 0xEE, 0x41, 0xEE, 0x49, 0xEE,
+   0x49, 0xCE, 0x49, 0xCF, 0x52, 0x10, 0x49, 0xCF, 0x51, 0xCF, 0x51, 0xCF, 0x51, 0xEF, 0x52, 0x10,
+   0x51, 0xCF, 0x51, 0xEF, 0x51, 0xEF, 0x52, 0x10, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xEE, 0x41, 0xEE,
+   0x42, 0x0E, 0x42, 0x0E, 0x3A, 0x0D, 0x3A, 0x4D, 0x3A, 0x4D, 0x3A, 0x6D, 0x32, 0x8D, 0x32, 0xAD,
+   0x2A, 0x8C, 0x32, 0xAC, 0x2A, 0xAC, 0x2A, 0xAB, 0x2A, 0xCC, 0x2A, 0xCC, 0x2A, 0xAC, 0x2A, 0x8C,
+   0x32, 0xAD, 0x32, 0x8D, 0x32, 0x6D, 0x3A, 0x6D, 0x42, 0x4E, 0x42, 0x2E, 0x4A, 0x0E, 0x49, 0xEF,
+   0x52, 0x10, 0x51, 0xCF, 0x62, 0x31, 0x62, 0x10, 0x6A, 0x71, 0x72, 0xB1, 0x7A, 0xF1, 0x83, 0x31,
+   0x83, 0x71, 0x8B, 0x90, 0x94, 0x11, 0x9C, 0x31, 0xA4, 0x51, 0xA4, 0x50, 0xA4, 0x2F, 0xAC, 0x4F,
+   0x2A, 0xCB, 0x32, 0x6D, 0x3A, 0x0D, 0x41, 0xCE, 0x52, 0x10, 0x5A, 0x10, 0x6A, 0x51, 0x6A, 0x70,
+   0x72, 0xD1, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x10, 0x9C, 0x10, 0xA4, 0x50,
+   0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x4F, 0xA4, 0x4F, 0xAC, 0x70, 0xA4, 0x50, 0xA4, 0x30,
+   0x9C, 0x30, 0x9C, 0x30, 0x93, 0xF0, 0x93, 0xF1, 0x8B, 0x91, 0x83, 0x71, 0x7A, 0xF0, 0x72, 0xB1,
+   0x72, 0x91, 0x6A, 0x51, 0x62, 0x30, 0x5A, 0x10, 0x5A, 0x10, 0x52, 0x0F, 0x49, 0xEE, 0x42, 0x2E,
+   0x3A, 0x2D, 0x3A, 0x6D, 0x32, 0x8D, 0x32, 0xAD, 0x2A, 0xAC, 0x22, 0xCB, 0x22, 0xCB, 0x23, 0x0B,
+   0x2B, 0x2B, 0x22, 0xEB, 0x23, 0x0B, 0x23, 0x0B, 0x2B, 0x0C, 0x22, 0xEB, 0x2A, 0xEC, 0x32, 0xEC,
+   0x2A, 0x8C, 0x2A, 0x6C, 0x32, 0x8D, 0x3A, 0x6D, 0x3A, 0x4D, 0x3A, 0x2D, 0x3A, 0x0D, 0x42, 0x0E,
+   0x41, 0xEE, 0x49, 0xEE, 0x4A, 0x0F, 0x49, 0xCE, 0x49, 0xCE, 0x49, 0xCF, 0x49, 0xCF, 0x49, 0xEF,
+   0x49, 0xEF, 0x49, 0xCE, 0x52, 0x0F, 0x49, 0xEF, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x2F,
+   0x42, 0x0E, 0x42, 0x2E, 0x3A, 0x2D, 0x3A, 0x6E, 0x32, 0x4D, 0x3A, 0x6D, 0x32, 0xAD, 0x32, 0xAD,
+   0x32, 0xAC, 0x2A, 0xAC, 0x2A, 0xAC, 0x32, 0xEC, 0x2A, 0xEC, 0x32, 0xEC, 0x2A, 0xAC, 0x32, 0xCC,
+   0x2A, 0x8C, 0x32, 0x8C, 0x32, 0x6C, 0x32, 0x2C, 0x3A, 0x2D, 0x42, 0x2E, 0x42, 0x0E, 0x49, 0xEE,
+   0x51, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x70, 0x72, 0xB1, 0x7A, 0xD1,
+   0x83, 0x31, 0x83, 0x50, 0x93, 0xD1, 0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x30, 0x9C, 0x30, 0xA4, 0x50,
+   0x2A, 0xEC, 0x32, 0x6C, 0x3A, 0x0D, 0x49, 0xEF, 0x51, 0xEF, 0x5A, 0x10, 0x62, 0x30, 0x72, 0xB1,
+   0x7A, 0xD1, 0x83, 0x51, 0x8B, 0x91, 0x8B, 0xD1, 0x93, 0xD0, 0x94, 0x10, 0x9C, 0x30, 0xAC, 0x70,
+   0xA4, 0x50, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x50,
+   0xA4, 0x51, 0x93, 0xF0, 0x8B, 0xD0, 0x8B, 0xB1, 0x83, 0x51, 0x7B, 0x11, 0x72, 0xD1, 0x72, 0xB1,
+   0x6A, 0x51, 0x62, 0x31, 0x59, 0xCF, 0x51, 0xEF, 0x49, 0xEF, 0x4A, 0x0F, 0x42, 0x2E, 0x3A, 0x2D,
+   0x32, 0x6D, 0x2A, 0x8C, 0x2A, 0xAC, 0x22, 0xCB, 0x22, 0xEB, 0x23, 0x4B, 0x23, 0x4B, 0x1B, 0x4A,
+   0x23, 0x8B, 0x1B, 0x6A, 0x1B, 0x6A, 0x23, 0x6A, 0x23, 0x6B, 0x1B, 0x2A, 0x23, 0x2B, 0x23, 0x0B,
+   0x22, 0xEB, 0x2A, 0xCB, 0x2A, 0xAC, 0x2A, 0x8C, 0x32, 0x6C, 0x32, 0x6D, 0x3A, 0x4D, 0x3A, 0x2D,
+   0x3A, 0x2E, 0x42, 0x2E, 0x42, 0x0E, 0x41, 0xEE, 0x4A, 0x0F, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xEF,
+   0x4A, 0x0F, 0x49, 0xEF, 0x49, 0xCE, 0x49, 0xEE, 0x4A, 0x0F, 0x49, 0xEE, 0x4A, 0x0F, 0x4A, 0x2E,
+   0x42, 0x2E, 0x3A, 0x0D, 0x3A, 0x2D, 0x3A, 0x4D, 0x3A, 0x6D, 0x32, 0x6D, 0x32, 0x6C, 0x32, 0x8C,
+   0x2A, 0x8C, 0x32, 0xAC, 0x2A, 0xCC, 0x2A, 0xAB, 0x2A, 0xCC, 0x2A, 0xCC, 0x2A, 0xAC, 0x2A, 0xAC,
+   0x2A, 0x8C, 0x2A, 0x6C, 0x32, 0x6C, 0x3A, 0x8D, 0x3A, 0x2D, 0x42, 0x2E, 0x42, 0x2E, 0x4A, 0x0F,
+   0x49, 0xEF, 0x51, 0xEF, 0x59, 0xF0, 0x59, 0xF0, 0x6A, 0x51, 0x62, 0x30, 0x72, 0x91, 0x72, 0xB1,
+   0x7B, 0x11, 0x83, 0x31, 0x83, 0x71, 0x8B, 0xB1, 0x93, 0xF1, 0x93, 0xF1, 0x93, 0xF0, 0x9C, 0x31,
+   0x2A, 0xCB, 0x32, 0x6D, 0x3A, 0x0D, 0x4A, 0x0F, 0x51, 0xEF, 0x59, 0xF0, 0x6A, 0x51, 0x6A, 0x70,
+   0x7B, 0x11, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xD1, 0x93, 0xF0, 0x9C, 0x30, 0xA4, 0x30, 0xA4, 0x50,
+   0xA4, 0x4F, 0xAC, 0x70, 0xAC, 0x4F, 0xA4, 0x2F, 0xA4, 0x4F, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x50,
+   0x94, 0x10, 0x94, 0x11, 0x8B, 0xB0, 0x8B, 0xB1, 0x83, 0x51, 0x7A, 0xF1, 0x7A, 0xD1, 0x6A, 0x71,
+   0x6A, 0x51, 0x59, 0xF0, 0x59, 0xF0, 0x52, 0x10, 0x49, 0xEF, 0x42, 0x2E, 0x3A, 0x2D, 0x32, 0x6C,
+   0x2A, 0xAC, 0x22, 0xCB, 0x23, 0x0B, 0x23, 0x2A, 0x1B, 0x4A, 0x1B, 0x6A, 0x13, 0x69, 0x13, 0xA9,
+   0x13, 0xAA, 0x1B, 0xCA, 0x13, 0x89, 0x1B, 0xCA, 0x1B, 0xAA, 0x1B, 0x8A, 0x1B, 0x8A, 0x23, 0x6B,
+   0x23, 0x6B, 0x23, 0x2B, 0x22, 0xEB, 0x22, 0xCB, 0x2A, 0xAC, 0x32, 0x8C, 0x32, 0x4C, 0x32, 0x2C,
+   0x3A, 0x4D, 0x3A, 0x2E, 0x42, 0x0E, 0x42, 0x2E, 0x4A, 0x2F, 0x4A, 0x0F, 0x41, 0xEE, 0x49, 0xEF,
+   0x49, 0xEF, 0x41, 0xCE, 0x4A, 0x0F, 0x41, 0xCE, 0x4A, 0x0F, 0x41, 0xCE, 0x4A, 0x0F, 0x41, 0xEE,
+   0x42, 0x0E, 0x42, 0x2E, 0x3A, 0x2E, 0x3A, 0x2D, 0x32, 0x2D, 0x3A, 0x6D, 0x32, 0x8D, 0x32, 0x8D,
+   0x32, 0xAD, 0x32, 0xAC, 0x32, 0xCC, 0x2A, 0xAC, 0x2A, 0xAC, 0x32, 0xCC, 0x2A, 0xAC, 0x2A, 0x8C,
+   0x2A, 0x8C, 0x2A, 0x6C, 0x3A, 0x8D, 0x32, 0x4D, 0x3A, 0x2D, 0x3A, 0x0D, 0x41, 0xEE, 0x41, 0xEE,
+   0x49, 0xEF, 0x51, 0xEF, 0x59, 0xF0, 0x59, 0xF0, 0x62, 0x31, 0x6A, 0x51, 0x6A, 0x91, 0x72, 0xB1,
+   0x7A, 0xF1, 0x7A, 0xF1, 0x83, 0x51, 0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0xB1, 0x8B, 0xD0, 0x94, 0x11,
+   0x2A, 0xAC, 0x3A, 0x6D, 0x39, 0xED, 0x4A, 0x0F, 0x51, 0xCF, 0x62, 0x31, 0x6A, 0x71, 0x7A, 0xD1,
+   0x7B, 0x11, 0x83, 0x71, 0x93, 0xD1, 0x93, 0xF1, 0x94, 0x10, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x50,
+   0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x4F, 0xAC, 0x70, 0xAC, 0x70, 0xA4, 0x70, 0xA4, 0x51,
+   0x9C, 0x31, 0x93, 0xF0, 0x93, 0xD1, 0x8B, 0x91, 0x7B, 0x10, 0x7A, 0xF1, 0x72, 0xB1, 0x6A, 0x71,
+   0x62, 0x31, 0x59, 0xF0, 0x51, 0xCF, 0x49, 0xEF, 0x41, 0xEE, 0x42, 0x4E, 0x3A, 0x8D, 0x2A, 0xAC,
+   0x22, 0xCB, 0x23, 0x0B, 0x1B, 0x4A, 0x1B, 0x6A, 0x1B, 0xAA, 0x13, 0x89, 0x13, 0xC9, 0x13, 0xE9,
+   0x0B, 0xC8, 0x14, 0x09, 0x0B, 0xE9, 0x13, 0xE9, 0x13, 0xC9, 0x13, 0xEA, 0x13, 0xA9, 0x1B, 0xAA,
+   0x1B, 0x6A, 0x23, 0x6B, 0x23, 0x4B, 0x23, 0x0B, 0x2A, 0xCB, 0x2A, 0xAC, 0x32, 0xAD, 0x32, 0x6C,
+   0x32, 0x4D, 0x3A, 0x2D, 0x3A, 0x0D, 0x42, 0x2E, 0x42, 0x0E, 0x41, 0xEE, 0x4A, 0x0F, 0x41, 0xEE,
+   0x49, 0xEE, 0x49, 0xEE, 0x49, 0xEF, 0x4A, 0x0F, 0x49, 0xEE, 0x49, 0xEE, 0x4A, 0x0F, 0x4A, 0x2F,
+   0x42, 0x0E, 0x42, 0x2E, 0x42, 0x0E, 0x3A, 0x0D, 0x3A, 0x4D, 0x3A, 0x4D, 0x3A, 0x6D, 0x32, 0x6D,
+   0x32, 0x6C, 0x32, 0x8D, 0x32, 0x8C, 0x32, 0xAD, 0x32, 0xAC, 0x32, 0xAD, 0x32, 0xAC, 0x32, 0xAD,
+   0x2A, 0x6C, 0x3A, 0x8D, 0x32, 0x6D, 0x3A, 0x4D, 0x42, 0x4E, 0x3A, 0x0D, 0x42, 0x0E, 0x4A, 0x0F,
+   0x49, 0xCE, 0x51, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x31, 0x62, 0x30, 0x6A, 0x51, 0x72, 0xB1,
+   0x7A, 0xD1, 0x7A, 0xD1, 0x83, 0x31, 0x83, 0x51, 0x83, 0x50, 0x83, 0x70, 0x93, 0xD1, 0x8B, 0xB1,
+   0x32, 0xAC, 0x32, 0x2D, 0x4A, 0x0E, 0x51, 0xEF, 0x59, 0xF0, 0x6A, 0x51, 0x72, 0x91, 0x7A, 0xD1,
+   0x83, 0x51, 0x83, 0x70, 0x93, 0xF1, 0x93, 0xF0, 0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x50, 0xAC, 0x4F,
+   0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x70, 0xAC, 0x70, 0xAC, 0x4F, 0xA4, 0x4F, 0xA4, 0x50, 0xA4, 0x50,
+   0x9C, 0x10, 0x93, 0xD0, 0x8B, 0xB1, 0x83, 0x71, 0x83, 0x31, 0x72, 0xD1, 0x6A, 0x91, 0x6A, 0x71,
+   0x62, 0x10, 0x51, 0xCF, 0x49, 0xCF, 0x41, 0xCE, 0x3A, 0x0E, 0x3A, 0x4D, 0x32, 0x8C, 0x2A, 0xCB,
+   0x22, 0xEA, 0x23, 0x6B, 0x1B, 0x6A, 0x13, 0x89, 0x13, 0xC9, 0x0B, 0xC9, 0x0B, 0xE9, 0x0C, 0x09,
+   0x0C, 0x29, 0x0C, 0x08, 0x0C, 0x09, 0x0C, 0x29, 0x14, 0x09, 0x0B, 0xE9, 0x13, 0xE9, 0x13, 0xC9,
+   0x1B, 0xAA, 0x1B, 0x6A, 0x1B, 0x2A, 0x1B, 0x0A, 0x2B, 0x0C, 0x2A, 0xEC, 0x2A, 0xAC, 0x32, 0x8D,
+   0x32, 0x6D, 0x32, 0x2D, 0x42, 0x4E, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x0E, 0x4A, 0x0F, 0x49, 0xEF,
+   0x49, 0xEF, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xCE, 0x49, 0xEF, 0x4A, 0x0F, 0x49, 0xEE, 0x41, 0xCE,
+   0x4A, 0x0F, 0x41, 0xEE, 0x4A, 0x2F, 0x39, 0xED, 0x3A, 0x0E, 0x42, 0x2E, 0x3A, 0x4E, 0x32, 0x2D,
+   0x32, 0x4D, 0x32, 0x6D, 0x3A, 0x8D, 0x32, 0x4C, 0x32, 0x8D, 0x32, 0x6C, 0x32, 0x6C, 0x3A, 0x8D,
+   0x32, 0x8D, 0x3A, 0x6D, 0x3A, 0x6D, 0x3A, 0x2D, 0x3A, 0x0D, 0x42, 0x2E, 0x4A, 0x2F, 0x4A, 0x0F,
+   0x4A, 0x0F, 0x52, 0x10, 0x5A, 0x10, 0x5A, 0x10, 0x59, 0xF0, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x70,
+   0x72, 0x90, 0x7A, 0xD1, 0x7A, 0xF1, 0x83, 0x51, 0x83, 0x51, 0x8B, 0x71, 0x8B, 0x71, 0x8B, 0xB1,
+   0x3A, 0x8D, 0x42, 0x0E, 0x49, 0xEE, 0x51, 0xCF, 0x59, 0xF0, 0x6A, 0x71, 0x72, 0xB1, 0x7A, 0xF1,
+   0x8B, 0x91, 0x93, 0xD1, 0x93, 0xF1, 0x9C, 0x31, 0xA4, 0x30, 0xA4, 0x4F, 0xAC, 0x70, 0xAC, 0x4F,
+   0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x6F, 0xAC, 0x4F, 0xA4, 0x2F, 0xA4, 0x50, 0xA4, 0x50,
+   0x9C, 0x51, 0x94, 0x11, 0x8B, 0xB1, 0x83, 0x71, 0x83, 0x31, 0x72, 0xB0, 0x72, 0x91, 0x6A, 0x31,
+   0x59, 0xF0, 0x51, 0xCF, 0x49, 0xCF, 0x4A, 0x2F, 0x3A, 0x4E, 0x32, 0x6C, 0x2A, 0xAC, 0x22, 0xEB,
+   0x23, 0x4B, 0x1B, 0x6A, 0x13, 0x89, 0x13, 0xC9, 0x0B, 0xE9, 0x0C, 0x09, 0x0C, 0x08, 0x0C, 0x28,
+   0x0C, 0x48, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x0C, 0x29, 0x0C, 0x09, 0x0B, 0xC8, 0x13, 0xC9,
+   0x13, 0xA9, 0x1B, 0xAA, 0x1B, 0x6A, 0x23, 0x2B, 0x22, 0xEB, 0x2A, 0xEC, 0x32, 0xCC, 0x32, 0x8D,
+   0x3A, 0x8D, 0x3A, 0x6E, 0x3A, 0x0D, 0x42, 0x2E, 0x41, 0xEE, 0x41, 0xCE, 0x49, 0xEE, 0x52, 0x0F,
+   0x49, 0xEF, 0x52, 0x0F, 0x49, 0xCF, 0x52, 0x0F, 0x49, 0xCF, 0x52, 0x0F, 0x49, 0xCE, 0x49, 0xCF,
+   0x49, 0xEF, 0x4A, 0x0F, 0x49, 0xEE, 0x4A, 0x0F, 0x42, 0x0E, 0x42, 0x0E, 0x3A, 0x0D, 0x42, 0x2E,
+   0x3A, 0x2E, 0x3A, 0x2D, 0x32, 0x2D, 0x3A, 0x4D, 0x3A, 0x6D, 0x32, 0x4D, 0x32, 0x4D, 0x3A, 0x6D,
+   0x32, 0x2D, 0x3A, 0x6E, 0x3A, 0x4E, 0x3A, 0x0D, 0x42, 0x2E, 0x42, 0x0E, 0x41, 0xCE, 0x49, 0xEF,
+   0x49, 0xEF, 0x52, 0x10, 0x59, 0xF0, 0x59, 0xF0, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x71,
+   0x6A, 0x70, 0x72, 0xD1, 0x7A, 0xF1, 0x7A, 0xF1, 0x83, 0x31, 0x83, 0x31, 0x8B, 0x91, 0x8B, 0x91,
+   0x42, 0x4E, 0x41, 0xEE, 0x51, 0xEF, 0x59, 0xF0, 0x6A, 0x51, 0x72, 0x91, 0x7A, 0xF1, 0x83, 0x51,
+   0x8B, 0xB1, 0x93, 0xD0, 0x9C, 0x10, 0x9C, 0x30, 0xA4, 0x2F, 0xAC, 0x4F, 0xB4, 0x70, 0xAC, 0x4F,
+   0xB4, 0x4F, 0xB4, 0x4E, 0xB4, 0x4F, 0xAC, 0x4E, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x70, 0x9C, 0x2F,
+   0x9C, 0x30, 0x93, 0xF1, 0x93, 0xD1, 0x83, 0x71, 0x7B, 0x11, 0x7A, 0xF1, 0x6A, 0x70, 0x6A, 0x51,
+   0x59, 0xF0, 0x51, 0xCF, 0x4A, 0x0F, 0x41, 0xED, 0x3A, 0x4D, 0x2A, 0x6C, 0x2A, 0xAB, 0x23, 0x2B,
+   0x23, 0x6B, 0x13, 0x69, 0x13, 0xC9, 0x0B, 0xC9, 0x14, 0x29, 0x04, 0x08, 0x04, 0x08, 0x04, 0x07,
+   0x04, 0x28, 0x04, 0x07, 0x04, 0x07, 0x0C, 0x48, 0x04, 0x08, 0x0C, 0x08, 0x0B, 0xE8, 0x13, 0xE9,
+   0x13, 0xA9, 0x1B, 0xAA, 0x1B, 0x4A, 0x23, 0x2B, 0x2B, 0x2C, 0x22, 0xAB, 0x32, 0xAC, 0x32, 0x8D,
+   0x32, 0x4D, 0x3A, 0x2D, 0x39, 0xED, 0x41, 0xEE, 0x41, 0xEE, 0x49, 0xCE, 0x49, 0xEF, 0x51, 0xEF,
+   0x51, 0xEF, 0x51, 0xEF, 0x51, 0xEF, 0x5A, 0x10, 0x51, 0xEF, 0x51, 0xCF, 0x51, 0xCF, 0x51, 0xF0,
+   0x49, 0xCF, 0x49, 0xCF, 0x52, 0x0F, 0x49, 0xEF, 0x49, 0xCE, 0x4A, 0x0F, 0x4A, 0x0F, 0x41, 0xEE,
+   0x42, 0x0E, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x2E, 0x3A, 0x0D, 0x3A, 0x2D, 0x3A, 0x0D, 0x3A, 0x2D,
+   0x3A, 0x2D, 0x42, 0x2E, 0x42, 0x0E, 0x42, 0x0E, 0x41, 0xEE, 0x4A, 0x0E, 0x4A, 0x0F, 0x49, 0xCF,
+   0x52, 0x0F, 0x51, 0xEF, 0x59, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x62, 0x30, 0x6A, 0x30, 0x72, 0x91,
+   0x6A, 0x70, 0x72, 0xB1, 0x72, 0xD0, 0x83, 0x31, 0x83, 0x31, 0x83, 0x31, 0x83, 0x51, 0x8B, 0x91,
+   0x42, 0x2E, 0x49, 0xCF, 0x51, 0xCF, 0x62, 0x10, 0x6A, 0x50, 0x7A, 0xF1, 0x83, 0x31, 0x8B, 0x91,
+   0x93, 0xF1, 0x9C, 0x10, 0x9C, 0x2F, 0xAC, 0x70, 0xAC, 0x6F, 0xAC, 0x4F, 0xB4, 0x2E, 0xB4, 0x4E,
+   0xB4, 0x2E, 0xBC, 0x6F, 0xB4, 0x4E, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x6F, 0xAC, 0x4F, 0xA4, 0x2F,
+   0xA4, 0x50, 0x9C, 0x10, 0x93, 0xD1, 0x8B, 0x91, 0x83, 0x51, 0x72, 0xB0, 0x72, 0x91, 0x62, 0x10,
+   0x59, 0xF0, 0x5A, 0x10, 0x4A, 0x0F, 0x42, 0x2E, 0x3A, 0x2D, 0x2A, 0x6C, 0x2A, 0xEC, 0x23, 0x2B,
+   0x1B, 0x4A, 0x1B, 0xAA, 0x13, 0xC9, 0x14, 0x09, 0x0C, 0x29, 0x0C, 0x48, 0x04, 0x07, 0x04, 0x48,
+   0x04, 0x27, 0x04, 0x07, 0x04, 0x28, 0x0C, 0x48, 0x0C, 0x49, 0x0C, 0x29, 0x0C, 0x09, 0x13, 0xE9,
+   0x13, 0xA9, 0x13, 0x69, 0x1B, 0x4A, 0x23, 0x2B, 0x22, 0xCB, 0x32, 0xEC, 0x32, 0x8C, 0x32, 0x6D,
+   0x3A, 0x6E, 0x3A, 0x0D, 0x42, 0x0E, 0x49, 0xEE, 0x49, 0xEF, 0x49, 0xCF, 0x49, 0xCF, 0x51, 0xCF,
+   0x59, 0xF0, 0x51, 0xEF, 0x51, 0xCF, 0x5A, 0x10, 0x59, 0xEF, 0x59, 0xF0, 0x59, 0xF0, 0x59, 0xF0,
+   0x5A, 0x10, 0x59, 0xF0, 0x51, 0xCF, 0x51, 0xCF, 0x51, 0xCF, 0x49, 0xCF, 0x49, 0xEF, 0x49, 0xCE,
+   0x4A, 0x0F, 0x41, 0xEE, 0x4A, 0x0F, 0x41, 0xEE, 0x42, 0x0E, 0x42, 0x2E, 0x42, 0x2E, 0x42, 0x0E,
+   0x4A, 0x2E, 0x42, 0x2E, 0x41, 0xEE, 0x41, 0xCE, 0x49, 0xEF, 0x4A, 0x0F, 0x52, 0x0F, 0x49, 0xCF,
+   0x51, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x5A, 0x10, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x50, 0x72, 0x91,
+   0x72, 0xB1, 0x7A, 0xD1, 0x7A, 0xD1, 0x7A, 0xF1, 0x7A, 0xF0, 0x83, 0x51, 0x83, 0x30, 0x8B, 0x71,
+   0x49, 0xCE, 0x59, 0xF0, 0x62, 0x10, 0x6A, 0x51, 0x7A, 0xD1, 0x7B, 0x10, 0x8B, 0x91, 0x93, 0xD0,
+   0x9C, 0x10, 0xA4, 0x70, 0xA4, 0x4F, 0xB4, 0x70, 0xB4, 0x4F, 0xBC, 0x4F, 0xBC, 0x4E, 0xBC, 0x2E,
+   0xBC, 0x0D, 0xBC, 0x0D, 0xBC, 0x4E, 0xBC, 0x6F, 0xBC, 0x4E, 0xB4, 0x4E, 0xB4, 0x6F, 0xAC, 0x70,
+   0xA4, 0x70, 0x9C, 0x10, 0x93, 0xD0, 0x8B, 0xB1, 0x83, 0x31, 0x7B, 0x11, 0x72, 0x91, 0x62, 0x30,
+   0x59, 0xF0, 0x51, 0xF0, 0x49, 0xEF, 0x41, 0xEE, 0x3A, 0x6E, 0x32, 0x8C, 0x22, 0xAB, 0x23, 0x2B,
+   0x23, 0x8B, 0x1B, 0xCA, 0x13, 0xE9, 0x14, 0x09, 0x0C, 0x08, 0x04, 0x28, 0x04, 0x28, 0x04, 0x48,
+   0x04, 0x27, 0x04, 0x07, 0x04, 0x27, 0x04, 0x08, 0x0C, 0x49, 0x0C, 0x29, 0x0B, 0xE9, 0x13, 0xE9,
+   0x13, 0x89, 0x1B, 0x6A, 0x23, 0x4B, 0x23, 0x0B, 0x2A, 0xEC, 0x32, 0xAC, 0x32, 0x4C, 0x3A, 0x6E,
+   0x42, 0x2E, 0x41, 0xEE, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xCF, 0x5A, 0x10, 0x5A, 0x10, 0x59, 0xCF,
+   0x59, 0xF0, 0x59, 0xF0, 0x62, 0x31, 0x62, 0x31, 0x62, 0x31, 0x6A, 0x51, 0x62, 0x31, 0x62, 0x31,
+   0x62, 0x31, 0x62, 0x10, 0x59, 0xF0, 0x59, 0xF0, 0x59, 0xF0, 0x51, 0xCF, 0x51, 0xCF, 0x5A, 0x10,
+   0x51, 0xCF, 0x49, 0xCF, 0x52, 0x0F, 0x49, 0xEF, 0x49, 0xEF, 0x49, 0xEF, 0x4A, 0x0F, 0x49, 0xEE,
+   0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x49, 0xCE, 0x52, 0x0F, 0x49, 0xCF, 0x52, 0x10, 0x5A, 0x10,
+   0x51, 0xF0, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x50, 0x72, 0x91,
+   0x72, 0x90, 0x7A, 0xF1, 0x7A, 0xD1, 0x83, 0x31, 0x7B, 0x10, 0x83, 0x51, 0x8B, 0x71, 0x83, 0x30,
+   0x51, 0xEF, 0x62, 0x10, 0x62, 0x30, 0x72, 0xB1, 0x83, 0x31, 0x8B, 0x91, 0x93, 0xF1, 0x9C, 0x31,
+   0xA4, 0x2F, 0xAC, 0x70, 0xB4, 0x4F, 0xB4, 0x4E, 0xBC, 0x4E, 0xC4, 0x2E, 0xBB, 0xED, 0xC3, 0xED,
+   0xC3, 0xED, 0xC4, 0x0D, 0xC4, 0x0D, 0xBC, 0x0D, 0xBC, 0x4E, 0xBC, 0x4E, 0xAC, 0x2E, 0xAC, 0x4F,
+   0xAC, 0x70, 0x9C, 0x50, 0x94, 0x11, 0x8B, 0xB1, 0x83, 0x30, 0x7B, 0x11, 0x72, 0x91, 0x6A, 0x30,
+   0x59, 0xF0, 0x5A, 0x10, 0x52, 0x0F, 0x41, 0xEE, 0x3A, 0x4D, 0x32, 0xAD, 0x2A, 0xCC, 0x22, 0xEA,
+   0x1B, 0x6A, 0x13, 0x89, 0x0B, 0xA9, 0x0B, 0xC8, 0x0C, 0x08, 0x0C, 0x28, 0x04, 0x08, 0x04, 0x48,
+   0x04, 0x28, 0x04, 0x48, 0x04, 0x28, 0x0C, 0x28, 0x0C, 0x29, 0x0C, 0x09, 0x14, 0x09, 0x1B, 0xCA,
+   0x13, 0x69, 0x23, 0x6B, 0x2B, 0x2B, 0x2A, 0xEC, 0x2A, 0x8C, 0x32, 0x4C, 0x3A, 0x4D, 0x42, 0x0E,
+   0x42, 0x0E, 0x49, 0xEF, 0x51, 0xEF, 0x51, 0xCF, 0x51, 0xCF, 0x62, 0x10, 0x59, 0xF0, 0x62, 0x30,
+   0x62, 0x30, 0x6A, 0x50, 0x6A, 0x71, 0x6A, 0x71, 0x6A, 0x50, 0x6A, 0x71, 0x6A, 0x71, 0x6A, 0x71,
+   0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x51, 0x62, 0x10, 0x59, 0xF0, 0x62, 0x10,
+   0x5A, 0x10, 0x5A, 0x10, 0x51, 0xCF, 0x5A, 0x10, 0x52, 0x10, 0x51, 0xEF, 0x51, 0xEF, 0x51, 0xEF,
+   0x52, 0x0F, 0x49, 0xCF, 0x49, 0xCF, 0x49, 0xCF, 0x51, 0xEF, 0x51, 0xEF, 0x51, 0xCF, 0x5A, 0x10,
+   0x62, 0x10, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x51, 0x72, 0x91, 0x72, 0x91,
+   0x72, 0xD1, 0x7A, 0xD1, 0x7A, 0xF1, 0x83, 0x11, 0x83, 0x31, 0x83, 0x31, 0x83, 0x51, 0x8B, 0x91,
+   0x59, 0xF0, 0x6A, 0x50, 0x72, 0xB1, 0x7B, 0x11, 0x8B, 0xB1, 0x94, 0x11, 0xA4, 0x51, 0xA4, 0x70,
+   0xAC, 0x4F, 0xB4, 0x6F, 0xB4, 0x2E, 0xC4, 0x2E, 0xC4, 0x0D, 0xCB, 0xED, 0xCB, 0xCD, 0xCB, 0xED,
+   0xCB, 0xAC, 0xCB, 0xAC, 0xCB, 0xCD, 0xC3, 0xED, 0xC4, 0x0D, 0xBC, 0x2E, 0xBC, 0x4F, 0xAC, 0x4E,
+   0xAC, 0x70, 0xA4, 0x50, 0x9C, 0x31, 0x93, 0xD1, 0x8B, 0x91, 0x7B, 0x11, 0x72, 0xB1, 0x6A, 0x71,
+   0x62, 0x31, 0x51, 0xCF, 0x49, 0xEF, 0x42, 0x0E, 0x42, 0x4E, 0x32, 0x6C, 0x2A, 0xCC, 0x2B, 0x2C,
+   0x1B, 0x4A, 0x1B, 0x8A, 0x13, 0xC9, 0x0B, 0xC9, 0x0B, 0xE8, 0x03, 0xE8, 0x04, 0x08, 0x04, 0x28,
+   0x04, 0x08, 0x04, 0x28, 0x0C, 0x28, 0x03, 0xE8, 0x14, 0x09, 0x13, 0xC9, 0x13, 0xA9, 0x1B, 0xAA,
+   0x23, 0x6A, 0x23, 0x0A, 0x22, 0xCB, 0x32, 0xAC, 0x32, 0x6D, 0x3A, 0x6E, 0x3A, 0x0D, 0x4A, 0x0F,
+   0x49, 0xEF, 0x52, 0x10, 0x51, 0xEF, 0x59, 0xF0, 0x62, 0x31, 0x62, 0x10, 0x6A, 0x71, 0x72, 0x91,
+   0x72, 0xB1, 0x6A, 0x90, 0x72, 0xB1, 0x7A, 0xD1, 0x7A, 0xD1, 0x72, 0xB1, 0x7A, 0xF1, 0x72, 0xB0,
+   0x72, 0xB1, 0x72, 0xD1, 0x72, 0xB1, 0x72, 0xB1, 0x6A, 0x71, 0x72, 0x91, 0x6A, 0x50, 0x6A, 0x71,
+   0x62, 0x10, 0x62, 0x10, 0x59, 0xF0, 0x62, 0x31, 0x59, 0xEF, 0x5A, 0x10, 0x59, 0xF0, 0x59, 0xF0,
+   0x51, 0xEF, 0x59, 0xF0, 0x5A, 0x10, 0x59, 0xF0, 0x59, 0xEF, 0x59, 0xEF, 0x59, 0xF0, 0x62, 0x10,
+   0x62, 0x10, 0x62, 0x10, 0x62, 0x10, 0x62, 0x30, 0x6A, 0x30, 0x72, 0x91, 0x6A, 0x70, 0x7A, 0xD1,
+   0x7A, 0xF1, 0x72, 0xD0, 0x83, 0x31, 0x7B, 0x11, 0x83, 0x51, 0x83, 0x71, 0x8B, 0x71, 0x83, 0x50,
+   0x6A, 0x30, 0x72, 0xB1, 0x83, 0x51, 0x8B, 0x71, 0x9C, 0x11, 0xA4, 0x51, 0xA4, 0x50, 0xAC, 0x2F,
+   0xB4, 0x2E, 0xBC, 0x2E, 0xC4, 0x0D, 0xC3, 0xCC, 0xCB, 0x8C, 0xD3, 0xAC, 0xD3, 0x8C, 0xD3, 0x6C,
+   0xD3, 0x6C, 0xCB, 0x6B, 0xCB, 0x8C, 0xCB, 0xCD, 0xCB, 0xED, 0xC4, 0x2E, 0xBC, 0x2E, 0xB4, 0x4E,
+   0xB4, 0x6F, 0xAC, 0x70, 0xA4, 0x50, 0x94, 0x11, 0x93, 0xD1, 0x83, 0x31, 0x7A, 0xF1, 0x6A, 0x70,
+   0x62, 0x10, 0x59, 0xEF, 0x52, 0x10, 0x41, 0xEE, 0x42, 0x2E, 0x3A, 0x8D, 0x32, 0xAC, 0x22, 0xCB,
+   0x23, 0x4B, 0x1B, 0x8A, 0x13, 0x89, 0x13, 0xE9, 0x14, 0x09, 0x0C, 0x09, 0x0C, 0x08, 0x0C, 0x08,
+   0x0C, 0x29, 0x03, 0xE8, 0x0B, 0xE8, 0x0B, 0xE9, 0x13, 0xE9, 0x13, 0xA9, 0x13, 0x69, 0x1B, 0x2A,
+   0x23, 0x2B, 0x2A, 0xEB, 0x32, 0xAC, 0x32, 0x4C, 0x3A, 0x2D, 0x39, 0xED, 0x4A, 0x0F, 0x49, 0xCF,
+   0x51, 0xCF, 0x59, 0xF0, 0x62, 0x30, 0x62, 0x30, 0x6A, 0x71, 0x72, 0xB1, 0x72, 0x90, 0x72, 0xB1,
+   0x7B, 0x11, 0x7A, 0xF1, 0x83, 0x31, 0x7B, 0x10, 0x83, 0x31, 0x83, 0x31, 0x7B, 0x31, 0x83, 0x51,
+   0x83, 0x31, 0x7B, 0x11, 0x83, 0x31, 0x83, 0x11, 0x7A, 0xD1, 0x7A, 0xD1, 0x72, 0xD1, 0x72, 0xB1,
+   0x6A, 0x70, 0x6A, 0x50, 0x6A, 0x51, 0x62, 0x30, 0x6A, 0x51, 0x6A, 0x51, 0x62, 0x31, 0x62, 0x10,
+   0x62, 0x30, 0x59, 0xF0, 0x62, 0x31, 0x62, 0x30, 0x62, 0x31, 0x62, 0x10, 0x62, 0x31, 0x62, 0x10,
+   0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x71, 0x6A, 0x71, 0x72, 0x91, 0x6A, 0x90, 0x72, 0xB1, 0x7A, 0xF1,
+   0x7A, 0xF1, 0x7B, 0x11, 0x7B, 0x11, 0x83, 0x71, 0x83, 0x30, 0x8B, 0x71, 0x8B, 0x91, 0x83, 0x71,
+   0x7A, 0xD1, 0x83, 0x51, 0x8B, 0x90, 0x93, 0xF0, 0xA4, 0x50, 0xA4, 0x4F, 0xAC, 0x4E, 0xBC, 0x4E,
+   0xC4, 0x0D, 0xC3, 0xCD, 0xCB, 0xAC, 0xD3, 0x6C, 0xD3, 0x4B, 0xDB, 0x4B, 0xD3, 0x0A, 0xDB, 0x0B,
+   0xDB, 0x0B, 0xD3, 0x0B, 0xD3, 0x2B, 0xD3, 0x4B, 0xCB, 0x8C, 0xCB, 0xED, 0xBB, 0xED, 0xC4, 0x4E,
+   0xB4, 0x6F, 0xAC, 0x2F, 0xA4, 0x50, 0x9C, 0x31, 0x93, 0xF1, 0x8B, 0x91, 0x7A, 0xF1, 0x72, 0xB1,
+   0x6A, 0x51, 0x5A, 0x10, 0x51, 0xF0, 0x4A, 0x0F, 0x42, 0x2E, 0x3A, 0x6D, 0x32, 0x8C, 0x22, 0xAB,
+   0x23, 0x0B, 0x1B, 0x2A, 0x1B, 0xAA, 0x1B, 0xCA, 0x0B, 0xA9, 0x0B, 0xC8, 0x0B, 0xE8, 0x0C, 0x09,
+   0x0B, 0xC8, 0x0B, 0xE9, 0x13, 0xE9, 0x1B, 0xEA, 0x1B, 0xCA, 0x1B, 0x6A, 0x23, 0x6B, 0x23, 0x0B,
+   0x2A, 0xCB, 0x2A, 0x8C, 0x32, 0x4D, 0x3A, 0x2D, 0x42, 0x2E, 0x49, 0xEE, 0x51, 0xEF, 0x5A, 0x10,
+   0x62, 0x10, 0x62, 0x30, 0x6A, 0x71, 0x6A, 0x70, 0x72, 0xB1, 0x7A, 0xF1, 0x7B, 0x11, 0x83, 0x51,
+   0x83, 0x51, 0x8B, 0x91, 0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0xB1, 0x8B, 0xB1, 0x8B, 0xB0, 0x93, 0xD1,
+   0x8B, 0xB1, 0x8B, 0x91, 0x8B, 0xB1, 0x83, 0x71, 0x8B, 0x71, 0x7B, 0x30, 0x83, 0x51, 0x83, 0x31,
+   0x7A, 0xD1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x6A, 0x50, 0x6A, 0x71, 0x6A, 0x50,
+   0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x30, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x51, 0x6A, 0x50,
+   0x6A, 0x30, 0x6A, 0x71, 0x6A, 0x70, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xB1, 0x72, 0xD0, 0x7B, 0x11,
+   0x7A, 0xF0, 0x83, 0x51, 0x83, 0x30, 0x83, 0x51, 0x8B, 0x71, 0x83, 0x70, 0x8B, 0x91, 0x8B, 0x90,
+   0x83, 0x51, 0x8B, 0x90, 0x93, 0xF0, 0xA4, 0x30, 0xAC, 0x70, 0xB4, 0x4E, 0xC4, 0x4E, 0xC4, 0x0D,
+   0xCB, 0xAC, 0xD3, 0x8C, 0xDB, 0x4B, 0xE3, 0x2B, 0xE2, 0xEB, 0xE2, 0xEB, 0xE2, 0xEA, 0xE2, 0xCA,
+   0xDA, 0xAA, 0xDA, 0xCA, 0xE3, 0x0B, 0xDB, 0x2B, 0xDB, 0x6C, 0xD3, 0xAC, 0xCB, 0xED, 0xBB, 0xED,
+   0xB4, 0x2E, 0xB4, 0x6F, 0xA4, 0x4F, 0x9C, 0x30, 0x94, 0x11, 0x8B, 0xB1, 0x7B, 0x11, 0x72, 0xB0,
+   0x6A, 0x51, 0x62, 0x10, 0x51, 0xCF, 0x49, 0xCF, 0x42, 0x0E, 0x3A, 0x0D, 0x32, 0x6C, 0x32, 0xCC,
+   0x2B, 0x0C, 0x23, 0x2B, 0x1B, 0x6A, 0x1B, 0x8A, 0x1B, 0xCA, 0x13, 0xA9, 0x13, 0xE9, 0x13, 0xC9,
+   0x13, 0xC9, 0x13, 0xC9, 0x1B, 0xCA, 0x1B, 0xAA, 0x1B, 0x4A, 0x23, 0x4B, 0x2B, 0x0B, 0x2A, 0xAB,
+   0x32, 0xAD, 0x32, 0x4D, 0x3A, 0x2E, 0x4A, 0x2F, 0x49, 0xEF, 0x52, 0x10, 0x59, 0xF0, 0x62, 0x30,
+   0x6A, 0x51, 0x72, 0x91, 0x7A, 0xD1, 0x7A, 0xF1, 0x83, 0x31, 0x83, 0x50, 0x83, 0x70, 0x8B, 0xB0,
+   0x93, 0xF1, 0x93, 0xF1, 0x9C, 0x31, 0x9C, 0x10, 0x9C, 0x10, 0x9C, 0x31, 0x9C, 0x31, 0x9C, 0x10,
+   0x9C, 0x31, 0x93, 0xF0, 0x94, 0x11, 0x93, 0xF1, 0x93, 0xD1, 0x8B, 0xB1, 0x8B, 0x91, 0x8B, 0x91,
+   0x83, 0x51, 0x83, 0x71, 0x83, 0x31, 0x7A, 0xF1, 0x7A, 0xF1, 0x7A, 0xD1, 0x72, 0x90, 0x72, 0xB1,
+   0x72, 0xB1, 0x72, 0x91, 0x72, 0xB1, 0x72, 0x91, 0x6A, 0x50, 0x6A, 0x50, 0x6A, 0x70, 0x72, 0x91,
+   0x72, 0x91, 0x72, 0xB1, 0x72, 0x91, 0x72, 0xB1, 0x7A, 0xF1, 0x7A, 0xF1, 0x7B, 0x11, 0x83, 0x51,
+   0x83, 0x31, 0x83, 0x50, 0x83, 0x71, 0x8B, 0x91, 0x8B, 0x90, 0x8B, 0x90, 0x8B, 0x90, 0x93, 0xF1,
+   0x8B, 0xB1, 0x9C, 0x31, 0xA4, 0x30, 0xAC, 0x4F, 0xB4, 0x2E, 0xBC, 0x0D, 0xCC, 0x0D, 0xD3, 0xAC,
+   0xD3, 0x2B, 0xDB, 0x0B, 0xE2, 0xEB, 0xE2, 0xAA, 0xEA, 0xAA, 0xE2, 0x69, 0xEA, 0x69, 0xEA, 0x49,
+   0xEA, 0x69, 0xE2, 0x69, 0xE2, 0xAA, 0xDA, 0xAA, 0xE3, 0x2B, 0xDB, 0x4C, 0xCB, 0x6C, 0xCB, 0xED,
+   0xBC, 0x2E, 0xB4, 0x4E, 0xB4, 0x70, 0xA4, 0x50, 0x9C, 0x31, 0x8B, 0xB1, 0x83, 0x31, 0x7A, 0xF1,
+   0x6A, 0x70, 0x62, 0x30, 0x59, 0xF0, 0x51, 0xEF, 0x49, 0xEF, 0x42, 0x2E, 0x3A, 0x4D, 0x32, 0x8C,
+   0x2A, 0xAB, 0x2B, 0x2B, 0x23, 0x4B, 0x1B, 0x6A, 0x13, 0x69, 0x1B, 0x8A, 0x1B, 0xAA, 0x13, 0x89,
+   0x1B, 0xAA, 0x1B, 0x6A, 0x1B, 0x6A, 0x23, 0x4A, 0x23, 0x2B, 0x2B, 0x0C, 0x2A, 0xAC, 0x32, 0x8D,
+   0x3A, 0x4D, 0x42, 0x2E, 0x41, 0xEE, 0x52, 0x0F, 0x51, 0xCF, 0x5A, 0x10, 0x62, 0x31, 0x6A, 0x50,
+   0x72, 0xB1, 0x7A, 0xF1, 0x7B, 0x31, 0x8B, 0x91, 0x8B, 0x90, 0x93, 0xF1, 0x93, 0xF0, 0x9C, 0x31,
+   0x9C, 0x30, 0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x4F, 0xA4, 0x50, 0xAC, 0x70, 0xA4, 0x50, 0xAC, 0x70,
+   0xA4, 0x50, 0xA4, 0x50, 0xA4, 0x70, 0xA4, 0x51, 0x9C, 0x10, 0x93, 0xF0, 0x9C, 0x11, 0x93, 0xF1,
+   0x93, 0xD1, 0x93, 0xD1, 0x83, 0x70, 0x8B, 0x91, 0x8B, 0x71, 0x83, 0x51, 0x83, 0x31, 0x7B, 0x11,
+   0x7A, 0xF1, 0x7A, 0xF1, 0x7A, 0xF1, 0x72, 0xD1, 0x72, 0xB1, 0x72, 0xB1, 0x7A, 0xD1, 0x7A, 0xD1,
+   0x7A, 0xD1, 0x7A, 0xF1, 0x7A, 0xF1, 0x7A, 0xF1, 0x7B, 0x11, 0x83, 0x31, 0x7B, 0x30, 0x8B, 0x71,
+   0x83, 0x71, 0x8B, 0xB1, 0x8B, 0xB1, 0x93, 0xD1, 0x93, 0xD1, 0x93, 0xF1, 0x93, 0xD0, 0x93, 0xD0,
+   0x9C, 0x10, 0xA4, 0x70, 0xAC, 0x2F, 0xB4, 0x2E, 0xC4, 0x2E, 0xCB, 0xCD, 0xD3, 0x6B, 0xDB, 0x2B,
+   0xE2, 0xCA, 0xEA, 0xAA, 0xEA, 0x69, 0xF2, 0x69, 0xF2, 0x49, 0xF2, 0x49, 0xF2, 0x28, 0xF2, 0x08,
+   0xF2, 0x49, 0xF2, 0x49, 0xEA, 0x69, 0xE2, 0x89, 0xE2, 0xEA, 0xDB, 0x0B, 0xDB, 0x6C, 0xD3, 0xCD,
+   0xC3, 0xED, 0xBC, 0x4E, 0xB4, 0x4F, 0xAC, 0x70, 0x9C, 0x10, 0x94, 0x11, 0x83, 0x71, 0x7A, 0xF0,
+   0x72, 0x90, 0x6A, 0x51, 0x62, 0x10, 0x51, 0xCF, 0x49, 0xEF, 0x4A, 0x0E, 0x3A, 0x0D, 0x32, 0x4C,
+   0x2A, 0x8C, 0x2A, 0xCB, 0x22, 0xEB, 0x23, 0x4B, 0x1B, 0x2A, 0x23, 0x8B, 0x1B, 0x4A, 0x23, 0x8B,
+   0x1B, 0x4A, 0x23, 0x6B, 0x23, 0x2B, 0x23, 0x0B, 0x2A, 0xEC, 0x32, 0xAD, 0x3A, 0x8D, 0x3A, 0x2D,
+   0x42, 0x2E, 0x49, 0xEE, 0x49, 0xCF, 0x51, 0xCF, 0x62, 0x10, 0x6A, 0x51, 0x6A, 0x71, 0x72, 0xB1,
+   0x7A, 0xF1, 0x83, 0x71, 0x8B, 0xB1, 0x8B, 0xD0, 0x9C, 0x31, 0xA4, 0x51, 0xA4, 0x70, 0xA4, 0x4F,
+   0xAC, 0x70, 0xAC, 0x4F, 0xB4, 0x4F, 0xB4, 0x6F, 0xB4, 0x6F, 0xB4, 0x4E, 0xB4, 0x6F, 0xB4, 0x6F,
+   0xB4, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F, 0xAC, 0x4F, 0xA4, 0x4F, 0xA4, 0x2F, 0xA4, 0x50, 0xA4, 0x51,
+   0x9C, 0x10, 0x93, 0xF0, 0x9C, 0x11, 0x93, 0xD1, 0x8B, 0xB1, 0x8B, 0x91, 0x8B, 0x71, 0x83, 0x51,
+   0x83, 0x31, 0x83, 0x31, 0x7B, 0x11, 0x83, 0x31, 0x7A, 0xF1, 0x7A, 0xF1, 0x7A, 0xD0, 0x7B, 0x11,
+   0x7A, 0xF1, 0x83, 0x31, 0x83, 0x31, 0x7B, 0x10, 0x83, 0x51, 0x8B, 0x71, 0x83, 0x71, 0x8B, 0x91,
+   0x8B, 0xB1, 0x93, 0xD1, 0x8B, 0xB0, 0x93, 0xD1, 0x93, 0xF1, 0x94, 0x11, 0x93, 0xF1, 0x93, 0xF0,
+   0xAC, 0x70, 0xB4, 0x6F, 0xBC, 0x4E, 0xC3, 0xED, 0xD3, 0xCD, 0xDB, 0x6C, 0xDA, 0xEA, 0xE2, 0xAA,
+   0xEA, 0x69, 0xF2, 0x69, 0xFA, 0x49, 0xFA, 0x28, 0xFA, 0x08, 0xFA, 0x08, 0xFA, 0x08, 0xF9, 0xE7,
+   0xFA, 0x08, 0xFA, 0x49, 0xF2, 0x28, 0xF2, 0x69, 0xE2, 0x89, 0xE2, 0xCA, 0xDB, 0x2B, 0xCB, 0x4B,
+   0xC3, 0xAC, 0xBC, 0x0D, 0xBC, 0x4F, 0xAC, 0x6F, 0xA4, 0x70, 0x9C, 0x31, 0x8B, 0x90, 0x7B, 0x31,
+   0x72, 0xD1, 0x72, 0x91, 0x62, 0x10, 0x59, 0xEF, 0x49, 0xCF, 0x41, 0xCE, 0x3A, 0x0D, 0x32, 0x2D,
+   0x32, 0x6C, 0x32, 0xAC, 0x22, 0xCB, 0x2B, 0x0B, 0x23, 0x2B, 0x1B, 0x0A, 0x1B, 0x0A, 0x23, 0x2B,
+   0x23, 0x0B, 0x22, 0xEB, 0x2A, 0xEC, 0x2A, 0xAC, 0x2A, 0x6C, 0x3A, 0x8D, 0x3A, 0x2D, 0x41, 0xEE,
+   0x49, 0xCE, 0x49, 0xCF, 0x5A, 0x10, 0x62, 0x10, 0x6A, 0x71, 0x72, 0x91, 0x72, 0xD1, 0x83, 0x31,
+   0x8B, 0x91, 0x93, 0xD1, 0x94, 0x10, 0x9C, 0x30, 0xA4, 0x2F, 0xAC, 0x4F, 0xAC, 0x2F, 0xB4, 0x4F,
+   0xBC, 0x6F, 0xBC, 0x4E, 0xBC, 0x4E, 0xBC, 0x0D, 0xC4, 0x2E, 0xBC, 0x0D, 0xC4, 0x2E, 0xBC, 0x0D,
+   0xC4, 0x4E, 0xBC, 0x0D, 0xBC, 0x4E, 0xB4, 0x4E, 0xB4, 0x4F, 0xB4, 0x6F, 0xAC, 0x4F, 0xAC, 0x4F,
+   0xA4, 0x2F, 0xA4, 0x50, 0x9C, 0x30, 0x9C, 0x30, 0x93, 0xF0, 0x93, 0xD0, 0x93, 0xD1, 0x8B, 0x90,
+   0x8B, 0x91, 0x8B, 0xB1, 0x8B, 0x71, 0x8B, 0x71, 0x83, 0x31, 0x83, 0x31, 0x83, 0x31, 0x83, 0x71,
+   0x83, 0x31, 0x83, 0x30, 0x83, 0x30, 0x83, 0x51, 0x8B, 0x71, 0x8B, 0x91, 0x8B, 0xB1, 0x93, 0xD1,
+   0x8B, 0xB0, 0x93, 0xD1, 0x94, 0x11, 0x94, 0x11, 0x94, 0x10, 0x94, 0x10, 0x9C, 0x10, 0x94, 0x10,
+};
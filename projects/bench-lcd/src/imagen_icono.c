@@ -0,0 +1,342 @@
+/* Generado con scripts/image/png2image.py a partir de icono.png, no editar */
+
+#include "ili9341.h"
+
+/* 48x48 pixeles, 647 bytes en lugar de 4608 */
+static const uint8_t imagen_icono_data[] = {
+   0x59, 0xFD, 0xF3, 0xFE, 0x92, 0xC4, 0xA6, 0xB4, 0xA2, 0x97, 0xA5, 0xA5, 0xC2, 0x39, 0x29, 0x00,
+   0x36, 0xE1, 0xFE, 0xB3, 0x63, 0x17, 0xCC, 0x1E, 0x36, 0xDC, 0xFE, 0xDB, 0xE3, 0x17, 0xD0, 0x01,
+   0x36, 0xD8, 0x29, 0x17, 0xD4, 0x29, 0x36, 0xD5, 0xFE, 0xEC, 0x23, 0x17, 0xD6, 0x11, 0x36, 0xD2,
+   0xFE, 0x9B, 0x04, 0x17, 0xDA, 0x0D, 0x36, 0xCF, 0xFE, 0xAB, 0x23, 0x17, 0xDC, 0x11, 0x36, 0xCD,
+   0x0D, 0x17, 0xDE, 0x0D, 0x36, 0xCC, 0x17, 0xCA, 0xA7, 0x6D, 0xA9, 0x4C, 0xA5, 0x6C, 0xA5, 0x6B,
+   0xA2, 0x79, 0xC0, 0x19, 0x1D, 0x1A, 0x35, 0x17, 0xCA, 0x36, 0xCB, 0xFE, 0xEC, 0x23, 0x17, 0xC8,
+   0xAA, 0x4E, 0xAF, 0x1F, 0x31, 0xC8, 0x06, 0x19, 0x17, 0xC8, 0x11, 0x36, 0xC9, 0x29, 0x17, 0xC7,
+   0xA5, 0x7C, 0xFE, 0xFF, 0x5A, 0x31, 0xCC, 0x35, 0x1D, 0x17, 0xC7, 0x29, 0x36, 0xC8, 0x17, 0xC7,
+   0xA8, 0x5D, 0xFE, 0xFF, 0xBD, 0x31, 0xCE, 0x19, 0x01, 0x17, 0xC7, 0x36, 0xC7, 0xFE, 0xDB, 0xE3,
+   0x17, 0xC6, 0xA8, 0x5D, 0x31, 0xC4, 0x95, 0xE3, 0x01, 0x9B, 0xB6, 0x17, 0xC0, 0x05, 0x01, 0x2D,
+   0x31, 0xC4, 0x01, 0x17, 0xC6, 0x9C, 0x7B, 0x36, 0xC6, 0x17, 0xC6, 0x1D, 0x19, 0x31, 0xC2, 0x97,
+   0xD4, 0xFE, 0xFC, 0xC6, 0x17, 0xC6, 0x05, 0xFE, 0xFE, 0xD6, 0x31, 0xC2, 0x19, 0x1D, 0x17, 0xC6,
+   0x36, 0xC5, 0x1E, 0x17, 0xC6, 0x35, 0x31, 0xC2, 0xFE, 0xFD, 0xAD, 0x17, 0xCA, 0x19, 0x31, 0xC2,
+   0x35, 0x17, 0xC6, 0x1E, 0x36, 0xC4, 0x17, 0xC6, 0x19, 0x31, 0xC2, 0x19, 0x17, 0xCC, 0x19, 0x31,
+   0xC2, 0x19, 0x17, 0xC6, 0x36, 0xC4, 0x17, 0xC6, 0x06, 0x31, 0xC1, 0x05, 0x17, 0xCE, 0x05, 0x31,
+   0xC1, 0x06, 0x17, 0xC6, 0x36, 0xC3, 0x00, 0x17, 0xC5, 0xA7, 0x6D, 0x31, 0xC2, 0xFE, 0xFC, 0xC6,
+   0x17, 0xCE, 0x05, 0x31, 0xC2, 0x35, 0x17, 0xC5, 0x00, 0x36, 0xC2, 0x29, 0x17, 0xC5, 0x1A, 0x31,
+   0xC1, 0x2D, 0x17, 0xD0, 0x2D, 0x31, 0xC1, 0x1A, 0x17, 0xC5, 0x29, 0x36, 0xC2, 0x39, 0x17, 0xC5,
+   0xFE, 0xFF, 0x18, 0x31, 0xC1, 0xFE, 0xFD, 0x6B, 0x17, 0xD0, 0x01, 0x31, 0xC1, 0x1D, 0x17, 0xC5,
+   0x39, 0x36, 0xC2, 0x17, 0xC6, 0xFE, 0xFF, 0xBD, 0x31, 0xC1, 0x05, 0x17, 0xD0, 0x05, 0x31, 0xC1,
+   0x19, 0x17, 0xC6, 0x36, 0xC2, 0x17, 0xC6, 0x31, 0xC2, 0x17, 0xD2, 0x31, 0xC2, 0x17, 0xC6, 0x36,
+   0xC2, 0x17, 0xC6, 0x31, 0xC2, 0x17, 0xD2, 0x31, 0xC2, 0x17, 0xC6, 0x36, 0xC2, 0x17, 0xC6, 0x19,
+   0x31, 0xC1, 0x05, 0x17, 0xD0, 0x05, 0x31, 0xC1, 0x19, 0x17, 0xC6, 0x36, 0xC2, 0x39, 0x17, 0xC5,
+   0x1D, 0x31, 0xC1, 0x01, 0x17, 0xD0, 0x01, 0x31, 0xC1, 0x1D, 0x17, 0xC5, 0x39, 0x36, 0xC2, 0x29,
+   0x17, 0xC5, 0x1A, 0x31, 0xC1, 0x2D, 0x17, 0xD0, 0x2D, 0x31, 0xC1, 0x1A, 0x17, 0xC5, 0x29, 0x36,
+   0xC2, 0x00, 0x17, 0xC5, 0x35, 0x31, 0xC2, 0x05, 0x17, 0xCE, 0x05, 0x31, 0xC2, 0x35, 0x17, 0xC5,
+   0x00, 0x36, 0xC3, 0x17, 0xC6, 0x06, 0x31, 0xC1, 0x97, 0xD4, 0x17, 0xCE, 0x05, 0x31, 0xC1, 0x06,
+   0x17, 0xC6, 0x36, 0xC4, 0x17, 0xC6, 0xAA, 0x4E, 0x31, 0xC2, 0x19, 0x17, 0xCC, 0x19, 0x31, 0xC2,
+   0x19, 0x17, 0xC6, 0x36, 0xC4, 0x1E, 0x17, 0xC6, 0xFE, 0xFF, 0x5A, 0x31, 0xC2, 0x19, 0x17, 0xCA,
+   0x19, 0x31, 0xC2, 0x35, 0x17, 0xC6, 0x1E, 0x36, 0xC5, 0x17, 0xC6, 0xA5, 0x7C, 0xFE, 0xFF, 0xBD,
+   0x31, 0xC2, 0x05, 0xFE, 0xFC, 0xC6, 0x17, 0xC6, 0x05, 0xFE, 0xFE, 0xD6, 0x31, 0xC2, 0x19, 0x1D,
+   0x17, 0xC6, 0x36, 0xC6, 0xFE, 0xDB, 0xE3, 0x17, 0xC6, 0xA8, 0x5D, 0x31, 0xC4, 0x2D, 0x01, 0x9B,
+   0xB6, 0x17, 0xC0, 0x05, 0x01, 0x2D, 0x31, 0xC4, 0x01, 0x17, 0xC6, 0x9C, 0x7B, 0x36, 0xC7, 0x17,
+   0xC7, 0xA8, 0x5D, 0x19, 0x31, 0xCE, 0x19, 0x01, 0x17, 0xC7, 0x36, 0xC8, 0x29, 0x17, 0xC7, 0x1D,
+   0x35, 0x31, 0xCC, 0x35, 0x1D, 0x17, 0xC7, 0x29, 0x36, 0xC9, 0x11, 0x17, 0xC8, 0xAA, 0x4E, 0x06,
+   0x31, 0xC8, 0x06, 0x19, 0x17, 0xC8, 0x11, 0x36, 0xCB, 0x17, 0xCA, 0xA7, 0x6D, 0x1A, 0xA5, 0x6C,
+   0xA5, 0x6B, 0x31, 0xC0, 0x19, 0x1D, 0x1A, 0x35, 0x17, 0xCA, 0x36, 0xCC, 0x0D, 0x17, 0xDE, 0x0D,
+   0x36, 0xCD, 0xFE, 0xAB, 0x23, 0x17, 0xDC, 0x11, 0x36, 0xCF, 0x0D, 0x17, 0xDA, 0x0D, 0x36, 0xD2,
+   0xFE, 0xEC, 0x23, 0x17, 0xD6, 0x11, 0x36, 0xD5, 0x29, 0x17, 0xD4, 0x29, 0x36, 0xD8, 0xFE, 0xDB,
+   0xE3, 0x17, 0xD0, 0x01, 0x36, 0xDC, 0x1E, 0x17, 0xCC, 0x1E, 0x36, 0xE1, 0x00, 0x29, 0x39, 0x17,
+   0xC2, 0x39, 0x29, 0x00, 0x36, 0xFD, 0xF3,
+};
+
+const ili9341_image_t imagen_icono = {48, 48, sizeof(imagen_icono_data), imagen_icono_data};
+
+/* Los mismos pixeles sin comprimir, para ILI9341DrawPicture */
+const uint8_t imagen_icono_pic[] = {
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x92, 0xC4, 0xC3, 0x83, 0xD3, 0xC3, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xD3, 0xC3, 0xC3, 0x83, 0x92, 0xC4, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xB3, 0x63, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xB3, 0x63,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xDB, 0xE3, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xDB, 0xE3, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xC3, 0x83, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xC3, 0x83, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xEC, 0x23, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xEC, 0x23, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0x9B, 0x04, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0x9B, 0x04, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xAB, 0x23, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xAB, 0x23,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x9B, 0x04,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0x9B, 0x04, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x4A, 0xFE, 0x72, 0xFF, 0x18, 0xFF, 0xBD, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x18, 0xFE, 0x72, 0xFD, 0x4A, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xEC, 0x23, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xFD, 0xAD, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xFD, 0xAD, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xEC, 0x23, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xC3, 0x83, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x08,
+   0xFF, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A,
+   0xFD, 0x08, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xC3, 0x83, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x6B, 0xFF, 0xBD,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xBD, 0xFD, 0x6B, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xDB, 0xE3, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x94, 0xFD, 0x6B, 0xFC, 0xC6, 0xF4, 0x62,
+   0xF4, 0x62, 0xFC, 0xC6, 0xFD, 0x6B, 0xFE, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x6B, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xDB, 0xE3, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x08, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD6, 0xFC, 0xC6, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFC, 0xC6, 0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFD, 0x08, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xB3, 0x63, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFF, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFD, 0xAD, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0xAD, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xB3, 0x63, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFD, 0xAD, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0xAD,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xAD, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD6,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0x92, 0xC4, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC6,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xFC, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x4A, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0x92, 0xC4, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xC3, 0x83, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFE, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x94, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xFE, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x72, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xC3, 0x83, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xD3, 0xC3, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFF, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x6B, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xFD, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xD3, 0xC3, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC6, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xFC, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC6, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xFC, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xD3, 0xC3, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFF, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x6B, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xFD, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xD3, 0xC3, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xC3, 0x83, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFE, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x94, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xFE, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x72, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xC3, 0x83, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0x92, 0xC4, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC6,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xFC, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x4A, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0x92, 0xC4, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD6,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFD, 0xAD, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0xAD,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xAD, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xB3, 0x63, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFF, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFD, 0xAD, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0xAD, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xB3, 0x63, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x08, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD6, 0xFC, 0xC6, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFC, 0xC6, 0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFD, 0x08, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xDB, 0xE3, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x94, 0xFD, 0x6B, 0xFC, 0xC6, 0xF4, 0x62,
+   0xF4, 0x62, 0xFC, 0xC6, 0xFD, 0x6B, 0xFE, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x6B, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xDB, 0xE3, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x6B, 0xFF, 0xBD,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xBD, 0xFD, 0x6B, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xC3, 0x83, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x08,
+   0xFF, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A,
+   0xFD, 0x08, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xC3, 0x83, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xEC, 0x23, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xFD, 0xAD, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xFD, 0xAD, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xEC, 0x23, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xFD, 0x4A, 0xFE, 0x72, 0xFF, 0x18, 0xFF, 0xBD, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x18, 0xFE, 0x72, 0xFD, 0x4A, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x9B, 0x04,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0x9B, 0x04, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xAB, 0x23, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xAB, 0x23,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0x9B, 0x04, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0x9B, 0x04, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xEC, 0x23, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xEC, 0x23, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xC3, 0x83, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xC3, 0x83, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xDB, 0xE3, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xDB, 0xE3, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xB3, 0x63, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xF4, 0x62, 0xB3, 0x63,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x92, 0xC4, 0xC3, 0x83, 0xD3, 0xC3, 0xF4, 0x62, 0xF4, 0x62,
+   0xF4, 0x62, 0xF4, 0x62, 0xD3, 0xC3, 0xC3, 0x83, 0x92, 0xC4, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+   0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+};
@@ -0,0 +1,1344 @@
+/* Generado con scripts/image/png2image.py a partir de panel.png, no editar */
+
+#include "ili9341.h"
+
+/* 160x64 pixeles, 813 bytes en lugar de 20480 */
+static const uint8_t imagen_panel_data[] = {
+   0xAA, 0x5C, 0xC5, 0xA6, 0x87, 0xAE, 0x98, 0xAF, 0x97, 0xA9, 0x88, 0xA3, 0x98, 0xFD, 0xFD, 0xCC,
+   0x1D, 0x08, 0x3B, 0x2C, 0x37, 0xCA, 0x2C, 0xB7, 0xA8, 0x39, 0xFD, 0xFD, 0xD4, 0x13, 0x2C, 0x37,
+   0xC7, 0xB1, 0x97, 0x1D, 0x39, 0xC0, 0x95, 0x5C, 0x96, 0x7C, 0x9B, 0x7A, 0x9C, 0x79, 0xFD, 0xFD,
+   0xCC, 0x22, 0x0E, 0x19, 0x39, 0xC0, 0x1D, 0x18, 0x37, 0xC5, 0x18, 0x39, 0xC0, 0x96, 0x6C, 0x8F,
+   0x5E, 0x3E, 0xFD, 0xFD, 0xD2, 0x1D, 0x2B, 0x39, 0xC0, 0x18, 0x37, 0xC3, 0x18, 0x39, 0xC0, 0x8D,
+   0x4F, 0x3E, 0xFD, 0xFD, 0xD6, 0x1B, 0x39, 0xC0, 0x18, 0x37, 0xC1, 0x2C, 0x86, 0x96, 0x39, 0x1B,
+   0x94, 0x6C, 0xFD, 0xFD, 0xD8, 0x1B, 0xB3, 0xD2, 0x1D, 0x2C, 0x37, 0xC0, 0x13, 0x39, 0x96, 0x6B,
+   0xFE, 0x2B, 0x58, 0xFD, 0xFD, 0xDA, 0x24, 0xAA, 0xA5, 0x13, 0x37, 0x2C, 0x39, 0xC0, 0xFE, 0x3B,
+   0xD8, 0x9C, 0x8A, 0xFD, 0xFD, 0xDA, 0x13, 0xFE, 0xDF, 0x3D, 0xC0, 0x2C, 0x3B, 0x39, 0x94, 0x5C,
+   0x8D, 0x5F, 0xFD, 0xFD, 0xDC, 0x14, 0xAC, 0xB4, 0x3B, 0x08, 0x39, 0x8A, 0x3F, 0x97, 0x6B, 0xFD,
+   0xFD, 0xDC, 0x3F, 0x39, 0x08, 0x1D, 0x39, 0x13, 0x2F, 0xFD, 0xFD, 0xDC, 0x13, 0x39, 0x1D, 0x39,
+   0xC0, 0xFE, 0x23, 0x37, 0xFD, 0xFD, 0xDE, 0x39, 0xC2, 0x2A, 0xFD, 0xFD, 0xDE, 0x39, 0xC2, 0x2A,
+   0xFD, 0xFD, 0xDE, 0x39, 0xC2, 0x2A, 0xFD, 0xFD, 0xDE, 0x39, 0xC2, 0x2A, 0xFD, 0xFD, 0xDE, 0x39,
+   0xC2, 0x2A, 0xFD, 0xFD, 0xDE, 0x39, 0xC2, 0xFE, 0x23, 0x17, 0xFD, 0xFD, 0xDE, 0x39, 0xC2, 0x25,
+   0xF6, 0xFE, 0xC6, 0xDF, 0xFD, 0xD2, 0x25, 0xD0, 0x39, 0xC2, 0xFE, 0x23, 0x16, 0xF6, 0x2F, 0xFD,
+   0xD2, 0x1E, 0xD0, 0x39, 0xC2, 0x1E, 0xE6, 0xAA, 0xA6, 0xB3, 0xC3, 0x1E, 0xCC, 0x2F, 0xFD, 0xD2,
+   0x1E, 0xD0, 0x39, 0xC2, 0x1E, 0xE4, 0x3A, 0x1C, 0xAA, 0xA5, 0xC0, 0x1E, 0xCC, 0x2F, 0xFD, 0xD2,
+   0x1E, 0xD0, 0x39, 0xC2, 0x1E, 0xE2, 0xAA, 0xA5, 0x1C, 0x31, 0xC2, 0x1E, 0xCC, 0x2F, 0xFD, 0xD2,
+   0x1E, 0xD0, 0x39, 0xC2, 0x1E, 0xE0, 0x33, 0x1C, 0x31, 0xC4, 0x1E, 0xCC, 0x2F, 0xFD, 0xD2, 0x1E,
+   0xD0, 0x39, 0xC2, 0xFE, 0x22, 0xF6, 0xDE, 0xAA, 0xA5, 0x1C, 0x31, 0xC6, 0x19, 0xCC, 0x2F, 0xFD,
+   0xD2, 0x19, 0xD0, 0x39, 0xC2, 0x19, 0xDC, 0x2E, 0x1C, 0x31, 0xC8, 0x19, 0xCC, 0x2F, 0xFD, 0xD2,
+   0x19, 0xD0, 0x39, 0xC2, 0x19, 0xDA, 0x2E, 0x1C, 0x31, 0xCA, 0x19, 0xFD, 0xF2, 0x39, 0xC2, 0x19,
+   0xD8, 0x2E, 0x1C, 0x31, 0xCC, 0x19, 0xFD, 0xF2, 0x39, 0xC2, 0x19, 0xD6, 0x2E, 0x1C, 0x31, 0xCE,
+   0x19, 0xFD, 0xF2, 0x39, 0xC2, 0x19, 0xD4, 0x2E, 0x1C, 0x31, 0xD0, 0x19, 0xFD, 0xF2, 0x39, 0xC2,
+   0xFE, 0x22, 0xD6, 0xD2, 0x2E, 0x1C, 0x31, 0xD2, 0x14, 0xFD, 0xF2, 0x39, 0xC2, 0xFE, 0x22, 0xD5,
+   0xD0, 0xAB, 0x96, 0x1C, 0x31, 0xD4, 0x0D, 0xFD, 0xF2, 0x39, 0xC2, 0x0D, 0xD0, 0xAA, 0x96, 0x1C,
+   0x31, 0xD4, 0x0D, 0xFD, 0xF2, 0x39, 0xC2, 0x0D, 0xD2, 0x26, 0x1C, 0x31, 0xD2, 0x0D, 0xFD, 0xF2,
+   0x39, 0xC2, 0x0D, 0xD4, 0x26, 0xB5, 0xC2, 0x31, 0xD0, 0x0D, 0xFD, 0xF2, 0x39, 0xC2, 0x0D, 0xD6,
+   0x26, 0x15, 0x31, 0xCE, 0x0D, 0xFD, 0xF2, 0x39, 0xC2, 0x0D, 0xD8, 0xAA, 0x95, 0x15, 0x31, 0xCC,
+   0x0D, 0xCC, 0x2F, 0xF4, 0x0D, 0xEC, 0x39, 0xC2, 0xFE, 0x1A, 0xB5, 0xDA, 0x1F, 0x15, 0x31, 0xCA,
+   0x05, 0xCC, 0x2F, 0xF4, 0x05, 0xEC, 0x39, 0xC2, 0x05, 0xDC, 0x1F, 0x15, 0x31, 0xC8, 0x05, 0xCC,
+   0x2F, 0xF4, 0x05, 0xEC, 0x39, 0xC2, 0x05, 0xDE, 0x1F, 0x15, 0x31, 0xC6, 0x05, 0xCC, 0x2F, 0xF4,
+   0x05, 0xEC, 0x39, 0xC2, 0x05, 0xE0, 0x1F, 0xB4, 0xC3, 0x31, 0xC4, 0x05, 0xCC, 0x2F, 0xF4, 0x05,
+   0xEC, 0x39, 0xC2, 0xFE, 0x1A, 0xB4, 0xE2, 0xAA, 0xA6, 0x10, 0x31, 0xC2, 0x3E, 0xCC, 0x2F, 0xF4,
+   0x3E, 0xEC, 0x39, 0xC2, 0x3E, 0xE4, 0x1A, 0x10, 0x31, 0xC0, 0x3E, 0xFD, 0xF2, 0x39, 0xC2, 0x3E,
+   0xE6, 0x1A, 0x10, 0x3E, 0xFD, 0xF2, 0x39, 0xC2, 0xFE, 0x1A, 0x94, 0xFD, 0xFD, 0xDE, 0xFE, 0xDF,
+   0x3D, 0xC2, 0xFE, 0x1A, 0x94, 0xFD, 0xFD, 0xDE, 0xFE, 0xDF, 0x3D, 0xC2, 0xFE, 0x1A, 0x94, 0xFD,
+   0xFD, 0xDE, 0xFE, 0xDF, 0x3D, 0xC2, 0xFE, 0x1A, 0x94, 0xFD, 0xFD, 0xDE, 0xFE, 0xDF, 0x3D, 0xC2,
+   0xFE, 0x1A, 0x94, 0xFD, 0xFD, 0xDE, 0xFE, 0xDF, 0x3D, 0xC2, 0xFE, 0x1A, 0x94, 0xFD, 0xFD, 0xDE,
+   0xFE, 0xDF, 0x3D, 0xC2, 0xFE, 0x1A, 0x94, 0xFD, 0xFD, 0xDE, 0xFE, 0xDF, 0x3D, 0xC2, 0xFE, 0x1A,
+   0x73, 0xFD, 0xFD, 0xDE, 0x39, 0xC2, 0x2D, 0xFD, 0xFD, 0xDE, 0x39, 0xC0, 0x1D, 0x39, 0xFE, 0x33,
+   0x15, 0x2D, 0xFD, 0xFD, 0xDC, 0x1D, 0x39, 0x9D, 0x89, 0x08, 0x39, 0xFE, 0x53, 0xF6, 0x2D, 0xFD,
+   0xFD, 0xDC, 0x13, 0x39, 0x08, 0x3B, 0x39, 0x91, 0x7C, 0x2D, 0xFD, 0xFD, 0xDC, 0x37, 0x39, 0x3B,
+   0x2C, 0x39, 0xC0, 0xFE, 0x32, 0xF4, 0x2D, 0xFD, 0xFD, 0xDA, 0x11, 0x39, 0xC0, 0x2C, 0x9A, 0x89,
+   0xFE, 0x94, 0xF6, 0x39, 0x94, 0x6B, 0x85, 0x6F, 0xFD, 0xFD, 0xDA, 0x10, 0x39, 0x13, 0x37, 0xC0,
+   0x2C, 0x1D, 0x39, 0x88, 0x5E, 0x28, 0xFD, 0xFD, 0xD8, 0x2A, 0x39, 0x1D, 0x2C, 0x37, 0xC1, 0x18,
+   0x39, 0xC0, 0x2A, 0x28, 0xFD, 0xFD, 0xD6, 0x2A, 0x39, 0xC0, 0x18, 0x37, 0xC3, 0x18, 0x39, 0xC0,
+   0x10, 0x11, 0x28, 0xFD, 0xFD, 0xD2, 0x11, 0x10, 0x39, 0xC0, 0x18, 0x37, 0xC5, 0x18, 0x1D, 0x39,
+   0xC0, 0x91, 0x7C, 0x94, 0x6B, 0x11, 0x9B, 0x89, 0xFD, 0xFD, 0xCC, 0x11, 0x0E, 0x37, 0x39, 0xC0,
+   0x1D, 0x18, 0x8F, 0x8A, 0xC7, 0x2C, 0x13, 0x39, 0xFD, 0xFD, 0xD4, 0x13, 0x2C, 0x37, 0xCA, 0x2C,
+   0x3B, 0x08, 0x1D, 0x39, 0xFD, 0xFD, 0xCC, 0x1D, 0x08, 0x3B, 0x2C, 0x37, 0xC5,
+};
+
+const ili9341_image_t imagen_panel = {160, 64, sizeof(imagen_panel_data), imagen_panel_data};
+
+/* Los mismos pixeles sin comprimir, para ILI9341DrawPicture */
+const uint8_t imagen_panel_pic[] = {
+   0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x2A, 0x0B,
+   0x6B, 0xD2, 0xAD, 0xB8, 0xCE, 0xDC, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xCE, 0xDC, 0xAD, 0xB8, 0x6B, 0xD2,
+   0x2A, 0x0B, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x2A, 0x0B, 0x94, 0xF6, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0x94, 0xF6, 0x2A, 0x0B, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x5B, 0x70, 0xCE, 0xDC, 0xDF, 0x3D, 0xDF, 0x3D,
+   0x95, 0xDB, 0x64, 0x9A, 0x43, 0xF9, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x43, 0xF9, 0x64, 0x9A, 0x95, 0xDB,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xCE, 0xDC, 0x5B, 0x70, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x5B, 0x70, 0xDF, 0x3D, 0xDF, 0x3D, 0xA5, 0xFC, 0x43, 0xD9,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x43, 0xD9, 0xA5, 0xFC, 0xDF, 0x3D, 0xDF, 0x3D, 0x5B, 0x70, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x5B, 0x70, 0xDF, 0x3D, 0xDF, 0x3D, 0x6C, 0xDA, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78, 0x2B, 0x78,
+   0x2B, 0x78, 0x2B, 0x78, 0x6C, 0xDA, 0xDF, 0x3D, 0xDF, 0x3D, 0x5B, 0x70, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x2A, 0x0B, 0xCE, 0xDC, 0xDF, 0x3D, 0x6C, 0xDA, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x6C, 0xDA, 0xDF, 0x3D, 0xCE, 0xDC, 0x2A, 0x0B, 0x11, 0x49,
+   0x11, 0x49, 0x94, 0xF6, 0xDF, 0x3D, 0xA5, 0xFB, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0xA5, 0xFB, 0xDF, 0x3D, 0x94, 0xF6, 0x11, 0x49,
+   0x2A, 0x0B, 0xDF, 0x3D, 0xDF, 0x3D, 0x3B, 0xD8, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x3B, 0xD8, 0xDF, 0x3D, 0xDF, 0x3D, 0x2A, 0x0B,
+   0x6B, 0xD2, 0xDF, 0x3D, 0x95, 0xBB, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58,
+   0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x2B, 0x58, 0x95, 0xBB, 0xDF, 0x3D, 0x6B, 0xD2,
+   0xAD, 0xB8, 0xDF, 0x3D, 0x5C, 0x79, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x5C, 0x79, 0xDF, 0x3D, 0xAD, 0xB8,
+   0xCE, 0xDC, 0xDF, 0x3D, 0x3B, 0xD8, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57,
+   0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x23, 0x57, 0x3B, 0xD8, 0xDF, 0x3D, 0xCE, 0xDC,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37,
+   0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0x23, 0x37, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17,
+   0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0x23, 0x17, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x5C, 0x59, 0xC6, 0xBD, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x5C, 0x59, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x5C, 0x58, 0xC6, 0xBD,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x5C, 0x58, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16,
+   0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0x23, 0x16, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x5C, 0x38, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x5C, 0x38, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x5C, 0x38, 0xC6, 0xBD,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x5C, 0x38, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x5C, 0x38, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x5C, 0x38, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6,
+   0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0x22, 0xF6, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x5C, 0x38, 0xC6, 0xBD,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6,
+   0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0x22, 0xD6, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x54, 0x38, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x54, 0x18, 0xC6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x54, 0x18, 0xC6, 0xBD,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x54, 0x18, 0xC6, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x54, 0x18, 0xC6, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x54, 0x17, 0xC6, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5,
+   0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0x22, 0xD5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x54, 0x17, 0xC6, 0xBC,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x54, 0x17, 0xC6, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x54, 0x17, 0xC6, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x54, 0x17, 0xC6, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5,
+   0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0x1A, 0xB5, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x53, 0xF7, 0xC6, 0x9C,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF, 0xC6, 0xDF,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x53, 0xF7, 0xC6, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x53, 0xF7, 0xC6, 0x9C, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4,
+   0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0x1A, 0xB4, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94,
+   0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0x1A, 0x94, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xCE, 0xDC, 0xDF, 0x3D, 0x33, 0x15, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x33, 0x15, 0xDF, 0x3D, 0xCE, 0xDC,
+   0xAD, 0xB8, 0xDF, 0x3D, 0x53, 0xF6, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x53, 0xF6, 0xDF, 0x3D, 0xAD, 0xB8,
+   0x6B, 0xD2, 0xDF, 0x3D, 0x95, 0x59, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x95, 0x59, 0xDF, 0x3D, 0x6B, 0xD2,
+   0x2A, 0x0B, 0xDF, 0x3D, 0xDF, 0x3D, 0x32, 0xF4, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73,
+   0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x1A, 0x73, 0x32, 0xF4, 0xDF, 0x3D, 0xDF, 0x3D, 0x2A, 0x0B,
+   0x11, 0x49, 0x94, 0xF6, 0xDF, 0x3D, 0x9D, 0xBA, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x9D, 0xBA, 0xDF, 0x3D, 0x94, 0xF6, 0x11, 0x49,
+   0x11, 0x49, 0x2A, 0x0B, 0xCE, 0xDC, 0xDF, 0x3D, 0x64, 0x37, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x64, 0x37, 0xDF, 0x3D, 0xCE, 0xDC, 0x2A, 0x0B, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x5B, 0x70, 0xDF, 0x3D, 0xDF, 0x3D, 0x64, 0x37, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x64, 0x37, 0xDF, 0x3D, 0xDF, 0x3D, 0x5B, 0x70, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x5B, 0x70, 0xDF, 0x3D, 0xDF, 0x3D, 0x9D, 0xBA, 0x32, 0xF4,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53, 0x1A, 0x53,
+   0x32, 0xF4, 0x9D, 0xBA, 0xDF, 0x3D, 0xDF, 0x3D, 0x5B, 0x70, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x5B, 0x70, 0xCE, 0xDC, 0xDF, 0x3D, 0xDF, 0x3D,
+   0x95, 0x59, 0x53, 0xD6, 0x32, 0xF4, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52,
+   0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x1A, 0x52, 0x32, 0xF4, 0x53, 0xD6, 0x95, 0x59,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xCE, 0xDC, 0x5B, 0x70, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x2A, 0x0B, 0x94, 0xF6, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0x94, 0xF6, 0x2A, 0x0B, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49,
+   0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x2A, 0x0B,
+   0x6B, 0xD2, 0xAD, 0xB8, 0xCE, 0xDC, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D,
+   0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0xCE, 0xDC, 0xAD, 0xB8, 0x6B, 0xD2,
+   0x2A, 0x0B, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49,
+};
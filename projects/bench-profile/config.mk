@@ -0,0 +1,27 @@
+# Compile options
+VERBOSE=y
+OPT=2
+USE_NANO=y
+SEMIHOST=n
+USE_FPU=y
+
+# Libraries
+USE_LPCOPEN=y
+USE_SAPI=n
+USE_FREERTOS=y
+LOAD_INRAM=n
+
+# Drawings of each test in a round, sampling rate of the profiler and samples
+# collected before the results are sent, the values
+# can be overridden from the command line, for example:
+#   make PROJECT_PATH=projects PROJECT_NAME=bench-profile PROFILE_HZ=5000
+# Objects are not rebuilt when these values change, run make clean in between
+FREERTOS_HEAP_TYPE ?= 4
+BENCH_SAMPLES ?= 50
+PROFILE_HZ ?= 1000
+PROFILE_SAMPLES ?= 1000
+
+DEFINES += CPU=lpc4337
+DEFINES += BENCH_SAMPLES=$(BENCH_SAMPLES)
+DEFINES += PROFILE_HZ=$(PROFILE_HZ)
+DEFINES += PROFILE_SAMPLES=$(PROFILE_SAMPLES)
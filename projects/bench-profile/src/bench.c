@@ -0,0 +1,343 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Perfil de las funciones de dibujo del ILI9341
+ **
+ ** Dibuja cadenas, rectangulos, lineas y circulos en el ILI9341 y mide en
+ ** ciclos del procesador la duración de cada dibujo, mientras el
+ ** perfilador de profiler.h toma PROFILE_HZ muestras por segundo de la
+ ** función en ejecución. Las pruebas se repiten en rondas de BENCH_SAMPLES
+ ** dibujos cada una hasta reunir PROFILE_SAMPLES muestras del perfilador,
+ ** por lo que la cantidad de mediciones depende de la velocidad de la
+ ** plataforma. Al terminar envia el histograma con ProfilerDump,
+ ** que scripts/profile/symbolize.py convierte en un perfil por función y en
+ ** pilas plegadas para un gráfico de llamas:
+ **
+ **     make PLATFORM=host PROJECT_PATH=projects PROJECT_NAME=bench-profile profile
+ **
+ ** En la placa se captura la salida de la USB-UART en un archivo y se
+ ** indica con PROFILE_LOG=archivo en la misma linea de comandos.
+ **
+ ** En PLATFORM=host el SPI y la pantalla son simulados, por lo que el perfil
+ ** muestra el costo de la simulación y no el de las transferencias reales.
+ **
+ ** La salida tiene el mismo formato que la de bench-kernel:
+ **
+ **     # bench-profile platform=edu-ciaa cpu_hz=204000000 counter_hz=204000000 ...
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     draw_string,19,500,...
+ **     # profile hz=1000 samples=1004 dropped=0 used=97 rounds=10
+ **     @profile-begin hz=1000 samples=1004 dropped=0 ref=0x1a0012c5
+ **     ...
+ **     # end
+ **
+ ** El parametro es la cantidad de caracteres o pixeles de cada dibujo.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "gpio.h"
+#include "spi.h"
+#include "ili9341.h"
+#include "fonts.h"
+#include "cycles.h"
+#include "profiler.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         50     /*!< Repeticiones de cada dibujo */
+#endif
+
+#ifndef PROFILE_HZ
+#define PROFILE_HZ            1000   /*!< Muestras por segundo del perfilador */
+#endif
+
+#ifndef PROFILE_SAMPLES
+#define PROFILE_SAMPLES       1000   /*!< Muestras del perfilador que se reunen */
+#endif
+
+/** @brief Rondas de pruebas máximas, por si el perfilador no toma muestras */
+#define RONDAS_MAXIMAS        1000
+
+#define PRIORIDAD_CONTROL     ( tskIDLE_PRIORITY + 1 )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+
+/** @brief Terminales del ILI9341 */
+#define LCD_CS                GPIO_0
+#define LCD_DC                GPIO_6
+#define LCD_RST               GPIO_7
+
+/** @brief Texto de la prueba de cadenas */
+#define TEXTO                 "Perfil del ILI9341 "
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;            /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;              /*!< Menor valor medido */
+   uint32_t maximo;              /*!< Mayor valor medido */
+   uint32_t errores;             /*!< Mediciones en las que falló la verificación */
+   uint64_t total;               /*!< Suma de todas las mediciones */
+} resultado_t;
+
+/** @brief Dibujo que se repite en una prueba */
+typedef void (*dibujo_t)(uint32_t muestra);
+
+/** @brief Descripción de una prueba */
+typedef struct prueba_s {
+   const char * nombre;          /*!< Nombre de la prueba en la tabla de resultados */
+   uint32_t parametro;           /*!< Caracteres o pixeles de cada dibujo */
+   dibujo_t dibujo;              /*!< Función que dibuja una vez */
+} prueba_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Dibuja una cadena de texto */
+static void Cadena(uint32_t muestra);
+
+/** @brief Dibuja un rectangulo relleno */
+static void Rectangulo(uint32_t muestra);
+
+/** @brief Dibuja una linea diagonal */
+static void Linea(uint32_t muestra);
+
+/** @brief Dibuja un circulo */
+static void Circulo(uint32_t muestra);
+
+/** @brief Repite el dibujo de una prueba midiendo cada repetición */
+static void Medir(const prueba_t * prueba, resultado_t * resultado);
+
+/** @brief Envia una fila de la tabla de resultados */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+/** @brief Pruebas de dibujo */
+static const prueba_t PRUEBAS[] = {
+   {"draw_string", sizeof(TEXTO) - 1, Cadena},
+   {"fill_rectangle", 60 * 40, Rectangulo},
+   {"draw_line", 200, Linea},
+   {"draw_circle", 40, Circulo},
+};
+
+static resultado_t resultados[sizeof(PRUEBAS) / sizeof(PRUEBAS[0])];
+static uint32_t sobrecarga;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+}
+
+static void Cadena(uint32_t muestra) {
+   ILI9341DrawString(0, (uint16_t) ((muestra % 16) * 18), TEXTO, &font_11x18, ILI9341_WHITE,
+                     ILI9341_BLUE);
+}
+
+static void Rectangulo(uint32_t muestra) {
+   uint16_t x = (uint16_t) ((muestra % 3) * 60);
+   uint16_t y = (uint16_t) ((muestra % 7) * 40);
+
+   ILI9341DrawFilledRectangle(x, y, x + 59, y + 39, (uint16_t) (muestra * 0x0841));
+}
+
+static void Linea(uint32_t muestra) {
+   ILI9341DrawLine(20, (uint16_t) (muestra % 100), 219, (uint16_t) (muestra % 100 + 200), ILI9341_RED);
+}
+
+static void Circulo(uint32_t muestra) {
+   ILI9341DrawCircle(120, 160, (int16_t) (20 + muestra % 80), ILI9341_GREEN);
+}
+
+static void Medir(const prueba_t * prueba, resultado_t * resultado) {
+   uint32_t inicio, fin;
+   uint32_t muestra;
+
+   for (muestra = 0; muestra < BENCH_SAMPLES; muestra++) {
+      inicio = Read_Cycles();
+      prueba->dibujo(muestra);
+      fin = Read_Cycles();
+      Acumular(resultado, fin - inicio);
+   }
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado) {
+   char linea[112];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void Control(void * parametros) {
+   char linea[160];
+   profiler_stats_t perfil;
+   uint32_t anterior;
+   uint32_t indice;
+   uint32_t rondas = 0;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < 1000; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-profile platform=%s cpu_hz=%lu counter_hz=%lu "
+      "heap=%d samples=%d overhead=%lu profile_hz=%d\r\n", PLATAFORMA,
+      (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(), FREERTOS_HEAP_TYPE,
+      BENCH_SAMPLES, (unsigned long) sobrecarga, PROFILE_HZ);
+   Enviar(linea);
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   ILI9341Init(SPI_1, LCD_CS, LCD_DC, LCD_RST);
+   ILI9341Fill(ILI9341_BLACK);
+
+   memset(resultados, 0, sizeof(resultados));
+   ProfilerClear();
+   ProfilerStart(PROFILE_HZ);
+   do {
+      for (indice = 0; indice < sizeof(PRUEBAS) / sizeof(PRUEBAS[0]); indice++) {
+         Medir(&PRUEBAS[indice], &resultados[indice]);
+      }
+      rondas++;
+      ProfilerGetStats(&perfil);
+   } while ((perfil.samples + perfil.dropped < PROFILE_SAMPLES) && (rondas < RONDAS_MAXIMAS));
+   ProfilerStop();
+
+   for (indice = 0; indice < sizeof(PRUEBAS) / sizeof(PRUEBAS[0]); indice++) {
+      Informar(PRUEBAS[indice].nombre, PRUEBAS[indice].parametro, &resultados[indice]);
+   }
+
+   ProfilerGetStats(&perfil);
+   snprintf(linea, sizeof(linea), "# profile hz=%lu samples=%lu dropped=%lu used=%lu rounds=%lu\r\n",
+      (unsigned long) perfil.frequency, (unsigned long) perfil.samples,
+      (unsigned long) perfil.dropped, (unsigned long) perfil.used, (unsigned long) rondas);
+   Enviar(linea);
+   ProfilerDump(Enviar);
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+
+   xTaskCreate(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, NULL);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
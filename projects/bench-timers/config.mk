@@ -0,0 +1,26 @@
+# Compile options
+VERBOSE=y
+OPT=2
+USE_NANO=y
+SEMIHOST=n
+USE_FPU=y
+
+# Libraries
+USE_LPCOPEN=y
+USE_SAPI=n
+USE_FREERTOS=y
+LOAD_INRAM=n
+
+# Timer service backend under test, the values can be overridden from the
+# command line to compare both implementations, for example:
+#   make PROJECT_PATH=projects PROJECT_NAME=bench-timers TIMER_WHEEL=1
+# Objects are not rebuilt when these values change, run make clean in between
+FREERTOS_HEAP_TYPE ?= 4
+TIMER_WHEEL ?= 0
+TIMER_WHEEL_LEVELS ?= 4
+BENCH_SAMPLES ?= 1000
+
+DEFINES += CPU=lpc4337
+DEFINES += configUSE_TIMER_WHEEL=$(TIMER_WHEEL)
+DEFINES += configTIMER_WHEEL_LEVELS=$(TIMER_WHEEL_LEVELS)
+DEFINES += BENCH_SAMPLES=$(BENCH_SAMPLES)
@@ -0,0 +1,394 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones del servicio de temporizadores de software
+ **
+ ** Mide en ciclos del procesador el costo de arrancar, detener y vencer un
+ ** temporizador de software cuando hay 10, 100, 1000 y 10000 temporizadores
+ ** activos. Sirve para comparar las listas ordenadas del kernel con la rueda
+ ** de tiempos jerarquica que se elige con TIMER_WHEEL en config.mk.
+ **
+ ** En cada prueba la tarea de control crea los temporizadores con periodos
+ ** largos y distintos, para que ninguno venza mientras se mide el arranque y
+ ** la detención de un temporizador de prueba desde una tarea de menor
+ ** prioridad que el servicio de temporizadores. La medición incluye el envio
+ ** del comando y los dos cambios de contexto, que no dependen de la cantidad
+ ** de temporizadores. Despues cambia todos los periodos a unos pocos ticks y
+ ** mide en la función de vencimiento el tiempo entre dos vencimientos
+ ** consecutivos del mismo tick, que es el costo de retirar, recargar y
+ ** despachar un temporizador.
+ **
+ ** La salida tiene el mismo formato que la de bench-kernel:
+ **
+ **     # bench-timers platform=edu-ciaa cpu_hz=204000000 counter_hz=204000000 ...
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     timer_start,10,1000,1210,1235,2410,6053,0
+ **
+ ** El parametro es la cantidad de temporizadores activos. En la fila
+ ** timer_expire la columna errors cuenta los vencimientos atendidos en un
+ ** tick posterior al que correspondia, lo que indica que el servicio de
+ ** temporizadores no alcanza a procesarlos. Las pruebas que no entran en el
+ ** heap se informan con una línea de comentario.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "cycles.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         1000   /*!< Muestras tomadas en cada prueba */
+#endif
+
+#ifndef FREERTOS_HEAP_TYPE
+#define FREERTOS_HEAP_TYPE    0      /*!< Tipo de heap desconocido */
+#endif
+
+#if FREERTOS_HEAP_TYPE == 1
+#error Las pruebas eliminan los temporizadores, heap_1 no permite liberar memoria
+#endif
+
+#define PRIORIDAD_BAJA        ( tskIDLE_PRIORITY + 1 )
+#define PRIORIDAD_CONTROL     ( configMAX_PRIORITIES - 1 )
+
+#define PILA_PRUEBA           ( configMINIMAL_STACK_SIZE * 2 )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+
+/** @brief Periodo minimo de los temporizadores que no deben vencer durante la prueba */
+#define PERIODO_LARGO         ( ( TickType_t ) 1000000 )
+
+/** @brief Periodo minimo de los temporizadores en la prueba de vencimientos
+ **
+ ** Se le suma un tick cada 10 temporizadores, asi vencen en promedio 10 por
+ ** tick con cualquier cantidad y el servicio de temporizadores no se satura
+ ** con las listas ordenadas. Saturado, el servicio se reenvia comandos a su
+ ** propia cola y falla si la cola esta llena. */
+#define PERIODO_CORTO         ( ( TickType_t ) 10 )
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;   /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;     /*!< Menor valor medido */
+   uint32_t maximo;     /*!< Mayor valor medido */
+   uint32_t errores;    /*!< Mediciones en las que falló la verificación */
+   uint64_t total;      /*!< Suma de todas las mediciones */
+} resultado_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Mide el arranque y la detención del temporizador de prueba */
+void MedirComandos(void * parametros);
+
+/** @brief Función de vencimiento de los temporizadores de fondo */
+void Vencer(TimerHandle_t temporizador);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Genera periodos pseudoaleatorios reproducibles */
+static uint32_t Azar(void);
+
+/** @brief Crea y arranca la cantidad pedida de temporizadores de fondo
+ **
+ ** @returns false si no hay memoria suficiente, en ese caso no deja ningun temporizador creado
+ */
+static bool Crear(uint32_t total);
+
+/** @brief Elimina los temporizadores de fondo */
+static void Eliminar(void);
+
+/** @brief Envia una fila de la tabla de resultados */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+/** @brief Cantidades de temporizadores activos en cada prueba */
+static const uint16_t CANTIDADES[] = {10, 100, 1000, 10000};
+
+static TaskHandle_t control;
+static TimerHandle_t * temporizadores;
+static TimerHandle_t sonda;
+static uint32_t cantidad;
+static uint32_t semilla = 1;
+
+static resultado_t resultados[3];
+static uint32_t sobrecarga;
+
+static volatile bool midiendo;
+static uint32_t marca;
+static TickType_t tick_anterior;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+}
+
+static uint32_t Azar(void) {
+   semilla = semilla * 1103515245u + 12345u;
+   return semilla >> 8;
+}
+
+static bool Crear(uint32_t total) {
+   TimerHandle_t temporizador;
+
+   temporizadores = pvPortMalloc(total * sizeof(TimerHandle_t));
+   if (temporizadores == NULL) {
+      return false;
+   }
+   for (cantidad = 0; cantidad < total; cantidad++) {
+      temporizador = xTimerCreate("Fondo", PERIODO_LARGO + Azar() % PERIODO_LARGO, pdTRUE, NULL, Vencer);
+      if (temporizador == NULL) {
+         Eliminar();
+         return false;
+      }
+      temporizadores[cantidad] = temporizador;
+      xTimerStart(temporizador, portMAX_DELAY);
+   }
+   return true;
+}
+
+static void Eliminar(void) {
+   while (cantidad > 0) {
+      cantidad--;
+      xTimerDelete(temporizadores[cantidad], portMAX_DELAY);
+   }
+   vPortFree(temporizadores);
+   temporizadores = NULL;
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado) {
+   char linea[96];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void MedirComandos(void * parametros) {
+   uint32_t anterior;
+
+   /* El servicio de temporizadores tiene mayor prioridad, asi que atiende
+    * cada comando antes de que la función que lo envia termine */
+   while (resultados[0].muestras < BENCH_SAMPLES) {
+      anterior = Read_Cycles();
+      xTimerChangePeriod(sonda, PERIODO_LARGO + Azar() % PERIODO_LARGO, portMAX_DELAY);
+      Acumular(&resultados[0], Read_Cycles() - anterior);
+      if (xTimerIsTimerActive(sonda) == pdFALSE) {
+         resultados[0].errores++;
+      }
+
+      anterior = Read_Cycles();
+      xTimerStop(sonda, portMAX_DELAY);
+      Acumular(&resultados[1], Read_Cycles() - anterior);
+      if (xTimerIsTimerActive(sonda) != pdFALSE) {
+         resultados[1].errores++;
+      }
+   }
+   xTaskNotifyGive(control);
+   vTaskSuspend(NULL);
+}
+
+void Vencer(TimerHandle_t temporizador) {
+   uint32_t ahora = Read_Cycles();
+   TickType_t tick = xTaskGetTickCount();
+
+   if (!midiendo) {
+      return;
+   }
+   /* El vencimiento anterior del mismo tick termino en marca, lo que paso
+    * desde entonces es el trabajo del servicio para llegar a este */
+   if (tick == tick_anterior) {
+      Acumular(&resultados[2], ahora - marca);
+   }
+   /* Ya se recargo el temporizador, asi que debia vencer un periodo antes */
+   if (xTimerGetExpiryTime(temporizador) - xTimerGetPeriod(temporizador) != tick) {
+      resultados[2].errores++;
+   }
+   if (resultados[2].muestras >= BENCH_SAMPLES) {
+      midiendo = false;
+      xTaskNotifyGive(control);
+   }
+   tick_anterior = tick;
+   marca = Read_Cycles();
+}
+
+void Control(void * parametros) {
+   char linea[160];
+   uint32_t anterior;
+   uint32_t indice;
+   uint32_t posicion;
+   TaskHandle_t tarea;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-timers platform=%s cpu_hz=%lu counter_hz=%lu "
+      "tick_hz=%lu heap=%d timer_wheel=%d wheel_levels=%d samples=%d overhead=%lu\r\n",
+      PLATAFORMA, (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(),
+      (unsigned long) configTICK_RATE_HZ, FREERTOS_HEAP_TYPE, configUSE_TIMER_WHEEL,
+      configTIMER_WHEEL_LEVELS, BENCH_SAMPLES, (unsigned long) sobrecarga);
+   Enviar(linea);
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   sonda = xTimerCreate("Sonda", PERIODO_LARGO, pdFALSE, NULL, Vencer);
+   configASSERT(sonda != NULL);
+
+   for (indice = 0; indice < sizeof(CANTIDADES) / sizeof(CANTIDADES[0]); indice++) {
+      if (!Crear(CANTIDADES[indice])) {
+         snprintf(linea, sizeof(linea), "# timers=%u skipped, heap too small\r\n", CANTIDADES[indice]);
+         Enviar(linea);
+         continue;
+      }
+
+      /* Arranque y detención con todos los temporizadores de fondo activos */
+      memset(resultados, 0, sizeof(resultados));
+      xTaskCreate(MedirComandos, "Prueba", PILA_PRUEBA, NULL, PRIORIDAD_BAJA, &tarea);
+      configASSERT(tarea != NULL);
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      vTaskDelete(tarea);
+      Informar("timer_start", cantidad, &resultados[0]);
+      Informar("timer_stop", cantidad, &resultados[1]);
+
+      /* Vencimientos, todos los temporizadores pasan a vencer cada pocos ticks */
+      tick_anterior = 0;
+      for (posicion = 0; posicion < cantidad; posicion++) {
+         xTimerChangePeriod(temporizadores[posicion], PERIODO_CORTO + cantidad / 10, portMAX_DELAY);
+      }
+      midiendo = true;
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      Informar("timer_expire", cantidad, &resultados[2]);
+
+      Eliminar();
+   }
+   xTimerDelete(sonda, portMAX_DELAY);
+
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+
+   xTaskCreate(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, &control);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,22 @@
+# Compile options
+VERBOSE=y
+OPT=2
+USE_NANO=y
+SEMIHOST=n
+USE_FPU=y
+
+# Libraries
+USE_LPCOPEN=y
+USE_SAPI=n
+USE_FREERTOS=y
+LOAD_INRAM=n
+
+# Measurements of each test, the value can be overridden from the command
+# line, for example:
+#   make PROJECT_PATH=projects PROJECT_NAME=bench-trace BENCH_SAMPLES=200
+# Objects are not rebuilt when these values change, run make clean in between
+FREERTOS_HEAP_TYPE ?= 4
+BENCH_SAMPLES ?= 1000
+
+DEFINES += CPU=lpc4337
+DEFINES += BENCH_SAMPLES=$(BENCH_SAMPLES)
@@ -0,0 +1,329 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones del costo del registro de eventos del kernel
+ **
+ ** Mide en ciclos del procesador el costo de registrar un evento llamando
+ ** directamente a TraceEvent, con el registro habilitado y detenido, y el de
+ ** un viaje de ida y vuelta entre dos tareas a traves de dos colas con el
+ ** registro habilitado y detenido. La diferencia entre ambos viajes dividida
+ ** por los eventos que registra cada uno es el costo de cada evento visto
+ ** desde la aplicación, incluyendo el acceso a los bloques de control en las
+ ** macros del kernel.
+ **
+ ** Al terminar registra unos pocos viajes con un evento de usuario entre
+ ** ellos y envia el registro con TraceRecorderDump, que
+ ** scripts/trace/trace2perfetto.py convierte en una linea de tiempo:
+ **
+ **     make PLATFORM=host PROJECT_PATH=projects PROJECT_NAME=bench-trace trace
+ **
+ ** En PLATFORM=host cada tarea es un hilo, por lo que los viajes entre
+ ** tareas cuestan mucho mas que en la placa y la diferencia con el registro
+ ** habilitado se pierde en su variación.
+ **
+ ** La salida tiene el mismo formato que la de bench-kernel:
+ **
+ **     # bench-trace platform=edu-ciaa cpu_hz=204000000 counter_hz=204000000 ...
+ **     test,param,samples,min,avg,max,avg_ns,errors
+ **     trace_event,1,1000,...
+ **     # overhead events_per_roundtrip=10 cycles_per_event=...
+ **     @trace-begin bytes=8624
+ **     ...
+ **     # end
+ **
+ ** El parametro es la cantidad de eventos registrados en cada medición.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include "cycles.h"
+#include "trace_recorder.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES         1000   /*!< Mediciones de cada prueba */
+#endif
+
+/** @brief Viajes registrados en la traza enviada al final */
+#define VIAJES_TRAZA          20
+
+#define PRIORIDAD_CONTROL     ( tskIDLE_PRIORITY + 1 )
+#define PILA_CONTROL          ( configMINIMAL_STACK_SIZE * 4 )
+
+/** @brief La tarea de eco tiene mayor prioridad para que cada envio cambie de contexto */
+#define PRIORIDAD_ECO         ( tskIDLE_PRIORITY + 2 )
+#define PILA_ECO              ( configMINIMAL_STACK_SIZE * 2 )
+
+#ifdef PLATFORM_HOST
+#define PLATAFORMA            "host"
+#else
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estadisticas de una serie de mediciones */
+typedef struct resultado_s {
+   uint32_t muestras;            /*!< Cantidad de mediciones acumuladas */
+   uint32_t minimo;              /*!< Menor valor medido */
+   uint32_t maximo;              /*!< Mayor valor medido */
+   uint32_t errores;             /*!< Mediciones en las que falló la verificación */
+   uint64_t total;               /*!< Suma de todas las mediciones */
+} resultado_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que ejecuta las pruebas en secuencia e informa los resultados */
+void Control(void * parametros);
+
+/** @brief Tarea que devuelve por la cola de respuestas cada valor recibido */
+void Eco(void * parametros);
+
+/** @brief Agrega una medición a las estadisticas descontando el costo de leer el contador */
+static void Acumular(resultado_t * resultado, uint32_t cuentas);
+
+/** @brief Mide el costo de registrar un evento con una llamada directa */
+static void MedirEvento(resultado_t * resultado);
+
+/** @brief Mide viajes de ida y vuelta con la tarea de eco y cuenta los eventos registrados */
+static uint32_t MedirViajes(resultado_t * resultado);
+
+/** @brief Envia una fila de la tabla de resultados */
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+/* === Definiciones de variables internas ================================== */
+
+static QueueHandle_t pedidos;
+static QueueHandle_t respuestas;
+
+static resultado_t resultados[4];
+static uint32_t sobrecarga;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Acumular(resultado_t * resultado, uint32_t cuentas) {
+   cuentas = (cuentas > sobrecarga) ? cuentas - sobrecarga : 0;
+   if ((resultado->muestras == 0) || (cuentas < resultado->minimo)) {
+      resultado->minimo = cuentas;
+   }
+   if (cuentas > resultado->maximo) {
+      resultado->maximo = cuentas;
+   }
+   resultado->total += cuentas;
+   resultado->muestras++;
+}
+
+static void MedirEvento(resultado_t * resultado) {
+   uint32_t inicio, fin;
+   uint32_t indice;
+
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      taskENTER_CRITICAL();
+      inicio = Read_Cycles();
+      TraceEvent(TRACE_USER, indice);
+      fin = Read_Cycles();
+      taskEXIT_CRITICAL();
+      Acumular(resultado, fin - inicio);
+   }
+}
+
+static uint32_t MedirViajes(resultado_t * resultado) {
+   uint32_t inicio, fin;
+   uint32_t indice;
+   uint32_t valor;
+   uint32_t eventos;
+
+   eventos = TraceRecorderCount();
+   for (indice = 0; indice < BENCH_SAMPLES; indice++) {
+      inicio = Read_Cycles();
+      xQueueSend(pedidos, &indice, portMAX_DELAY);
+      xQueueReceive(respuestas, &valor, portMAX_DELAY);
+      fin = Read_Cycles();
+      Acumular(resultado, fin - inicio);
+      resultado->errores += (valor != indice);
+   }
+   return TraceRecorderCount() - eventos;
+}
+
+static void Informar(const char * prueba, uint32_t parametro, const resultado_t * resultado) {
+   char linea[112];
+   uint32_t promedio = 0;
+   uint32_t nanosegundos;
+
+   if (resultado->muestras > 0) {
+      promedio = (uint32_t) (resultado->total / resultado->muestras);
+   }
+   nanosegundos = (uint32_t) (((uint64_t) promedio * 1000000000ULL) / Cycles_Frequency());
+
+   snprintf(linea, sizeof(linea), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", prueba,
+      (unsigned long) parametro, (unsigned long) resultado->muestras,
+      (unsigned long) resultado->minimo, (unsigned long) promedio,
+      (unsigned long) resultado->maximo, (unsigned long) nanosegundos,
+      (unsigned long) resultado->errores);
+   Enviar(linea);
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void Eco(void * parametros) {
+   uint32_t valor;
+
+   while (1) {
+      if (xQueueReceive(pedidos, &valor, portMAX_DELAY) == pdTRUE) {
+         xQueueSend(respuestas, &valor, portMAX_DELAY);
+      }
+   }
+}
+
+void Control(void * parametros) {
+   char linea[160];
+   uint32_t anterior;
+   uint32_t indice;
+   uint32_t eventos;
+   uint32_t por_evento = 0;
+   uint32_t valor;
+
+   /* Costo de leer el contador, se descuenta de todas las mediciones */
+   sobrecarga = UINT32_MAX;
+   for (indice = 0; indice < 1000; indice++) {
+      anterior = Read_Cycles();
+      anterior = Read_Cycles() - anterior;
+      if (anterior < sobrecarga) {
+         sobrecarga = anterior;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# bench-trace platform=%s cpu_hz=%lu counter_hz=%lu "
+      "heap=%d samples=%d overhead=%lu records=%d\r\n", PLATAFORMA,
+      (unsigned long) SystemCoreClock, (unsigned long) Cycles_Frequency(), FREERTOS_HEAP_TYPE,
+      BENCH_SAMPLES, (unsigned long) sobrecarga, configTRACE_BUFFER_RECORDS);
+   Enviar(linea);
+   Enviar("test,param,samples,min,avg,max,avg_ns,errors\r\n");
+
+   memset(resultados, 0, sizeof(resultados));
+   MedirEvento(&resultados[0]);
+   Informar("trace_event", 1, &resultados[0]);
+
+   TraceRecorderStop();
+   MedirEvento(&resultados[1]);
+   Informar("trace_event_stopped", 0, &resultados[1]);
+   MedirViajes(&resultados[2]);
+   Informar("roundtrip_stopped", 0, &resultados[2]);
+
+   TraceRecorderStart();
+   eventos = MedirViajes(&resultados[3]) / BENCH_SAMPLES;
+   Informar("roundtrip_traced", eventos, &resultados[3]);
+
+   if ((eventos > 0) && (resultados[3].total > resultados[2].total)) {
+      por_evento = (uint32_t) ((resultados[3].total - resultados[2].total) / BENCH_SAMPLES / eventos);
+   }
+   snprintf(linea, sizeof(linea), "# overhead events_per_roundtrip=%lu cycles_per_event=%lu\r\n",
+      (unsigned long) eventos, (unsigned long) por_evento);
+   Enviar(linea);
+
+   /* Traza de unos pocos viajes, separados por eventos de usuario */
+   TraceRecorderClear();
+   for (indice = 0; indice < VIAJES_TRAZA; indice++) {
+      TraceUserEvent(indice);
+      xQueueSend(pedidos, &indice, portMAX_DELAY);
+      xQueueReceive(respuestas, &valor, portMAX_DELAY);
+   }
+   vTaskDelay(2);
+   TraceRecorderDump(Enviar);
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(GREEN_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería termina
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          El valor de retorno 0 es para evitar un error en el compilador.
+ **          En la PC el programa termina cuando la tarea de control detiene
+ **          el planificador al completar las pruebas.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+   Init_Cycles();
+
+   pedidos = xQueueCreate(1, sizeof(uint32_t));
+   respuestas = xQueueCreate(1, sizeof(uint32_t));
+   vQueueAddToRegistry(pedidos, "pedidos");
+   vQueueAddToRegistry(respuestas, "respuestas");
+
+   xTaskCreate(Eco, "Eco", PILA_ECO, NULL, PRIORIDAD_ECO, NULL);
+   xTaskCreate(Control, "Control", PILA_CONTROL, NULL, PRIORIDAD_CONTROL, NULL);
+   vTaskStartScheduler();
+
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,19 @@
+# Compile options
+VERBOSE=y
+OPT=2
+USE_NANO=y
+SEMIHOST=n
+USE_FPU=y
+
+# Libraries
+USE_LPCOPEN=y
+USE_SAPI=n
+USE_FREERTOS=y
+LOAD_INRAM=n
+
+# Items sent by each producer, it can be overridden from the command line:
+#   make PROJECT_PATH=projects PROJECT_NAME=stress-ring STRESS_ITEMS=1000000
+STRESS_ITEMS ?= 100000
+
+DEFINES += CPU=lpc4337
+DEFINES += STRESS_ITEMS=$(STRESS_ITEMS)
@@ -0,0 +1,489 @@
+/* Copyright 2026, Facultad de Ingeniería
+ * Universidad Nacional de Entre Ríos
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file stress.c
+ **
+ ** @brief Prueba de esfuerzo del anillo de varios productores
+ **
+ ** Varios productores agregan elementos numerados al mismo anillo mientras
+ ** una tarea los recibe y verifica que de cada productor lleguen todos los
+ ** numeros, en orden y una sola vez. Un elemento que falta cuenta como
+ ** perdido y uno que se repite como duplicado. Cuando el anillo esta lleno
+ ** el productor descarta el intento y vuelve a enviar el mismo numero mas
+ ** tarde, por lo que un anillo lleno nunca provoca perdidas.
+ **
+ ** En la EDU-CIAA los productores son las interrupciones de tres timers con
+ ** periodos distintos y prioridades distintas, que se anidan entre si en
+ ** cualquier punto del envio. TIMER0 tiene prioridad mayor a
+ ** configMAX_SYSCALL_INTERRUPT_PRIORITY y usa MpscRingWrite, avisando a la
+ ** tarea por medio de TIMER3, que solo se activa por software.
+ **
+ ** Para que los desplazamientos caigan justo dentro del envio, los puntos de
+ ** traza del anillo llaman a StressPreempt, que al azar activa una
+ ** interrupción de mayor prioridad en la EDU-CIAA o cede el procesador a otro
+ ** hilo en la PC.
+ **
+ ** En la PC las interrupciones no se anidan, por lo que los productores que
+ ** usan MpscRingWrite son hilos que se ejecutan en paralelo en distintos
+ ** nucleos, una condición mas exigente que el anidamiento. Las interrupciones
+ ** de TIMER1 y TIMER2 las genera otro hilo.
+ **
+ ** Al terminar envía por la USB-UART una tabla CSV con el resultado de cada
+ ** productor:
+ **
+ **     # stress-ring platform=host producers=6 items=100000 length=64
+ **     producer,context,sent,received,lost,duplicated,full
+ **     0,isr,100000,100000,0,0,1873
+ **     # result=pass stalls=0
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.17 | fiuner      | Version inicial del archivo             |
+ **
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mpsc_ring.h"
+#include "chip.h"
+#include "soc.h"
+#include "led.h"
+#include "uart.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef PLATFORM_HOST
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+#ifndef STRESS_ITEMS
+#define STRESS_ITEMS          100000  /*!< Elementos enviados por cada productor */
+#endif
+
+#define LARGO_ANILLO          64      /*!< Capacidad del anillo, pequeña para que se llene */
+#define RAFAGA                4       /*!< Elementos enviados en cada interrupción de timer */
+#define ESPERA_MAXIMA         pdMS_TO_TICKS(1000)
+#define ESPERAS_MAXIMAS       3       /*!< Esperas vencidas antes de abandonar la prueba */
+#define VIGILANCIA            5       /*!< Segundos sin recibir elementos para dar la prueba por fallida en la PC */
+
+#define PRIORIDAD_CONSUMIDOR  ( tskIDLE_PRIORITY + 2 )
+#define PILA_CONSUMIDOR       ( configMINIMAL_STACK_SIZE * 4 )
+
+/** @brief Prioridades de las interrupciones en la EDU-CIAA, TIMER0 por encima del kernel */
+#define PRIORIDAD_TIMER0      2
+#define PRIORIDAD_TIMER1      5
+#define PRIORIDAD_TIMER2      6
+#define PRIORIDAD_TIMER3      7
+
+/** @brief Periodos de los timers en ciclos, distintos para que el anidamiento varie */
+#define PERIODO_TIMER0        14983
+#define PERIODO_TIMER1        20011
+#define PERIODO_TIMER2        25013
+
+/** @brief Productores que agregan con MpscRingWrite, timers o hilos segun la plataforma */
+#ifdef PLATFORM_HOST
+#define PRODUCTORES_RAPIDOS   4
+#define PLATAFORMA            "host"
+#else
+#define PRODUCTORES_RAPIDOS   1
+#define PLATAFORMA            "edu-ciaa"
+#endif
+
+#define PRODUCTOR_TIMER1      0
+#define PRODUCTOR_TIMER2      1
+#define PRODUCTOR_RAPIDO      2       /*!< Primer productor que usa MpscRingWrite */
+#define PRODUCTORES           ( PRODUCTOR_RAPIDO + PRODUCTORES_RAPIDOS )
+
+/** @brief Composición de un elemento, productor en el byte alto y numero en el resto */
+#define ELEMENTO(productor, numero)    ( ( (uint32_t) (productor) << 24 ) | ( numero ) )
+#define PRODUCTOR(elemento)            ( (elemento) >> 24 )
+#define NUMERO(elemento)               ( (elemento) & 0x00FFFFFF )
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estado de un productor */
+typedef struct productor_s {
+   volatile uint32_t enviados;   /*!< Elementos agregados al anillo, es el proximo numero */
+   volatile uint32_t llenos;     /*!< Intentos descartados con el anillo lleno */
+   uint32_t recibidos;           /*!< Elementos recibidos por el consumidor */
+   uint32_t esperado;            /*!< Proximo numero que debe recibir el consumidor */
+   uint32_t perdidos;            /*!< Numeros que el consumidor nunca recibio */
+   uint32_t duplicados;          /*!< Numeros recibidos mas de una vez o fuera de orden */
+} productor_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Tarea que recibe y verifica los elementos e informa el resultado */
+void Consumir(void * parametros);
+
+/** @brief Agrega una rafaga de elementos de un productor
+ **
+ ** @param[in] indice     Productor que envía
+ ** @param[in] woken      NULL para usar MpscRingWrite, o la variable de MpscRingSendFromISR
+ */
+static void Producir(uint32_t indice, BaseType_t * woken);
+
+/** @brief Configura y pone en marcha los productores */
+static void IniciarProductores(void);
+
+/** @brief Envia una cadena por la USB-UART */
+static void Enviar(const char * cadena);
+
+#ifdef PLATFORM_HOST
+/** @brief Hilo que reemplaza a una interrupción de prioridad mayor a la del kernel */
+static void * HiloProductor(void * parametro);
+
+/** @brief Hilo que reemplaza a los timers y genera sus interrupciones */
+static void * HiloTimers(void * parametro);
+
+/** @brief Hilo que termina la prueba si el consumidor deja de recibir
+ **
+ ** Un anillo inconsistente puede dejar a un productor repitiendo la reserva
+ ** dentro de una interrupción, y en ese caso el consumidor nunca vuelve a
+ ** ejecutarse para informar el error.
+ */
+static void * HiloVigilante(void * parametro);
+#endif
+
+/* === Definiciones de variables internas ================================== */
+
+static MpscRingHandle_t anillo;
+static productor_t productores[PRODUCTORES];
+static volatile uint32_t pendientes = PRODUCTORES * STRESS_ITEMS;
+static bool aprobada = true;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+static void Producir(uint32_t indice, BaseType_t * woken) {
+   productor_t * productor = &productores[indice];
+   uint32_t elemento;
+   BaseType_t resultado;
+   uint32_t cantidad;
+
+   for (cantidad = 0; (cantidad < RAFAGA) && (productor->enviados < STRESS_ITEMS); cantidad++) {
+      elemento = ELEMENTO(indice, productor->enviados);
+      if (woken == NULL) {
+         resultado = MpscRingWrite(anillo, &elemento);
+      } else {
+         resultado = MpscRingSendFromISR(anillo, &elemento, woken);
+      }
+      if (resultado != pdPASS) {
+         productor->llenos++;
+         break;
+      }
+      productor->enviados++;
+   }
+}
+
+static void Enviar(const char * cadena) {
+   SendString_Uart_Ftdi((uint8_t *) cadena);
+}
+
+#ifdef PLATFORM_HOST
+
+static void * HiloProductor(void * parametro) {
+   uint32_t indice = (uint32_t) (uintptr_t) parametro;
+
+   uint32_t llenos;
+
+   while (productores[indice].enviados < STRESS_ITEMS) {
+      llenos = productores[indice].llenos;
+      Producir(indice, NULL);
+      if (productores[indice].llenos != llenos) {
+         /* Con el anillo lleno se avisa al consumidor y se cede el procesador */
+         NVIC_SetPendingIRQ(TIMER3_IRQn);
+         sched_yield();
+      }
+   }
+   NVIC_SetPendingIRQ(TIMER3_IRQn);
+   return NULL;
+}
+
+static void * HiloTimers(void * parametro) {
+   (void) parametro;
+
+   while ((productores[PRODUCTOR_TIMER1].enviados < STRESS_ITEMS) ||
+          (productores[PRODUCTOR_TIMER2].enviados < STRESS_ITEMS)) {
+      NVIC_SetPendingIRQ(TIMER1_IRQn);
+      NVIC_SetPendingIRQ(TIMER2_IRQn);
+      usleep(10);
+   }
+   return NULL;
+}
+
+static void * HiloVigilante(void * parametro) {
+   uint32_t anterior;
+
+   (void) parametro;
+   do {
+      anterior = pendientes;
+      sleep(VIGILANCIA);
+   } while (pendientes != anterior);
+
+   Enviar("# result=fail timeout\r\n");
+   Enviar("# end\r\n");
+   _exit(1);
+   return NULL;
+}
+
+static void IniciarProductores(void) {
+   uint32_t indice;
+
+   HostStartThread(HiloVigilante, NULL);
+   NVIC_EnableIRQ(TIMER1_IRQn);
+   NVIC_EnableIRQ(TIMER2_IRQn);
+   NVIC_EnableIRQ(TIMER3_IRQn);
+   for (indice = PRODUCTOR_RAPIDO; indice < PRODUCTORES; indice++) {
+      HostStartThread(HiloProductor, (void *) (uintptr_t) indice);
+   }
+   HostStartThread(HiloTimers, NULL);
+}
+
+#else
+
+static void IniciarProductores(void) {
+   static const struct {
+      LPC_TIMER_T * timer;
+      IRQn_Type irq;
+      uint32_t prioridad;
+      uint32_t periodo;
+   } TIMERS[] = {
+      {LPC_TIMER0, TIMER0_IRQn, PRIORIDAD_TIMER0, PERIODO_TIMER0},
+      {LPC_TIMER1, TIMER1_IRQn, PRIORIDAD_TIMER1, PERIODO_TIMER1},
+      {LPC_TIMER2, TIMER2_IRQn, PRIORIDAD_TIMER2, PERIODO_TIMER2},
+   };
+   uint32_t indice;
+
+   NVIC_SetPriority(TIMER3_IRQn, PRIORIDAD_TIMER3);
+   NVIC_EnableIRQ(TIMER3_IRQn);
+
+   for (indice = 0; indice < sizeof(TIMERS) / sizeof(TIMERS[0]); indice++) {
+      Chip_TIMER_Init(TIMERS[indice].timer);
+      Chip_TIMER_Reset(TIMERS[indice].timer);
+      Chip_TIMER_SetMatch(TIMERS[indice].timer, 0, TIMERS[indice].periodo);
+      Chip_TIMER_ResetOnMatchEnable(TIMERS[indice].timer, 0);
+      Chip_TIMER_MatchEnableInt(TIMERS[indice].timer, 0);
+      NVIC_SetPriority(TIMERS[indice].irq, TIMERS[indice].prioridad);
+      NVIC_ClearPendingIRQ(TIMERS[indice].irq);
+      NVIC_EnableIRQ(TIMERS[indice].irq);
+   }
+   for (indice = 0; indice < sizeof(TIMERS) / sizeof(TIMERS[0]); indice++) {
+      Chip_TIMER_Enable(TIMERS[indice].timer);
+   }
+}
+
+/** @brief Productor por encima de configMAX_SYSCALL_INTERRUPT_PRIORITY */
+void TIMER0_IRQHandler(void) {
+   Chip_TIMER_ClearMatch(LPC_TIMER0, 0);
+   Producir(PRODUCTOR_RAPIDO, NULL);
+   if (productores[PRODUCTOR_RAPIDO].enviados >= STRESS_ITEMS) {
+      NVIC_DisableIRQ(TIMER0_IRQn);
+   }
+   NVIC_SetPendingIRQ(TIMER3_IRQn);
+}
+
+#endif
+
+/* === Definiciones de funciones externas ================================== */
+
+#ifdef PLATFORM_HOST
+
+void StressPreempt(void) {
+   static __thread uint32_t azar = 1;
+
+   azar = azar * 1664525 + 1013904223;
+   if ((azar >> 30) == 0) {
+      sched_yield();
+   }
+}
+
+#else
+
+void StressPreempt(void) {
+   static uint32_t azar = 1;
+   uint32_t excepcion = __get_IPSR();
+
+   azar = azar * 1664525 + 1013904223;
+   if ((azar >> 30) == 0) {
+      /* Una interrupción de mayor prioridad interrumpe a la actual justo en este punto */
+      if (excepcion == 16 + TIMER2_IRQn) {
+         NVIC_SetPendingIRQ((azar & (1 << 16)) ? TIMER1_IRQn : TIMER0_IRQn);
+      } else if (excepcion == 16 + TIMER1_IRQn) {
+         NVIC_SetPendingIRQ(TIMER0_IRQn);
+      }
+      __DSB();
+      __ISB();
+   }
+}
+
+#endif
+
+/** @brief Productor que usa MpscRingSendFromISR */
+void TIMER1_IRQHandler(void) {
+   BaseType_t woken = pdFALSE;
+
+#ifndef PLATFORM_HOST
+   Chip_TIMER_ClearMatch(LPC_TIMER1, 0);
+   if (productores[PRODUCTOR_TIMER1].enviados >= STRESS_ITEMS) {
+      NVIC_DisableIRQ(TIMER1_IRQn);
+   }
+#endif
+   Producir(PRODUCTOR_TIMER1, &woken);
+   portYIELD_FROM_ISR(woken);
+}
+
+/** @brief Productor que usa MpscRingSendFromISR */
+void TIMER2_IRQHandler(void) {
+   BaseType_t woken = pdFALSE;
+
+#ifndef PLATFORM_HOST
+   Chip_TIMER_ClearMatch(LPC_TIMER2, 0);
+   if (productores[PRODUCTOR_TIMER2].enviados >= STRESS_ITEMS) {
+      NVIC_DisableIRQ(TIMER2_IRQn);
+   }
+#endif
+   Producir(PRODUCTOR_TIMER2, &woken);
+   portYIELD_FROM_ISR(woken);
+}
+
+/** @brief Despierta al consumidor despues de las escrituras de los productores rapidos */
+void TIMER3_IRQHandler(void) {
+   BaseType_t woken = pdFALSE;
+
+   MpscRingNotifyFromISR(anillo, &woken);
+   portYIELD_FROM_ISR(woken);
+}
+
+void Consumir(void * parametros) {
+   char linea[128];
+   productor_t * productor;
+   uint32_t elemento;
+   uint32_t esperas = 0;
+   uint32_t extravios = 0;
+   uint32_t indice;
+
+   IniciarProductores();
+
+   while (pendientes > 0) {
+      if (MpscRingReceive(anillo, &elemento, ESPERA_MAXIMA) != pdPASS) {
+         /* Con elementos en el anillo el consumidor debio despertarse, y si
+          * los productores no avanzan el anillo quedo inconsistente */
+         if ((MpscRingItemsWaiting(anillo) > 0) && (esperas < ESPERAS_MAXIMAS)) {
+            esperas++;
+            continue;
+         }
+         break;
+      }
+      if (PRODUCTOR(elemento) >= PRODUCTORES) {
+         extravios++;
+         continue;
+      }
+
+      productor = &productores[PRODUCTOR(elemento)];
+      productor->recibidos++;
+      pendientes--;
+      if (NUMERO(elemento) == productor->esperado) {
+         productor->esperado++;
+      } else if (NUMERO(elemento) > productor->esperado) {
+         productor->perdidos += NUMERO(elemento) - productor->esperado;
+         productor->esperado = NUMERO(elemento) + 1;
+      } else {
+         productor->duplicados++;
+      }
+   }
+
+   snprintf(linea, sizeof(linea), "# stress-ring platform=%s producers=%d items=%d length=%d\r\n",
+      PLATAFORMA, PRODUCTORES, STRESS_ITEMS, LARGO_ANILLO);
+   Enviar(linea);
+   Enviar("producer,context,sent,received,lost,duplicated,full\r\n");
+   for (indice = 0; indice < PRODUCTORES; indice++) {
+      productor = &productores[indice];
+      productor->perdidos += productor->enviados - productor->esperado;
+      aprobada = aprobada && (productor->recibidos == STRESS_ITEMS) && (productor->perdidos == 0) &&
+         (productor->duplicados == 0);
+      snprintf(linea, sizeof(linea), "%lu,%s,%lu,%lu,%lu,%lu,%lu\r\n", (unsigned long) indice,
+         (indice < PRODUCTOR_RAPIDO) ? "isr" : "write", (unsigned long) productor->enviados,
+         (unsigned long) productor->recibidos, (unsigned long) productor->perdidos,
+         (unsigned long) productor->duplicados, (unsigned long) productor->llenos);
+      Enviar(linea);
+   }
+   /* Tambien se exige que el anillo se haya llenado alguna vez, para que la
+    * prueba cubra el descarte y el reintento de los productores */
+   aprobada = aprobada && (esperas == 0) && (extravios == 0) && (MpscRingDropped(anillo) > 0);
+   snprintf(linea, sizeof(linea), "# result=%s stalls=%lu stray=%lu\r\n", aprobada ? "pass" : "fail",
+      (unsigned long) esperas, (unsigned long) extravios);
+   Enviar(linea);
+   Enviar("# end\r\n");
+
+#ifdef PLATFORM_HOST
+   vTaskEndScheduler();
+#endif
+   while (1) {
+      Led_Toggle(aprobada ? GREEN_LED : RED_LED);
+      vTaskDelay(pdMS_TO_TICKS(500));
+   }
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 si la prueba fue exitosa, 1 si fallo
+ **
+ ** @remarks En un sistema embebido la función main() nunca debe terminar.
+ **          En la PC el programa termina cuando la tarea consumidora detiene
+ **          el planificador al recibir todos los elementos, y el valor de
+ **          retorno permite usar la prueba en un script.
+ */
+int main(void) {
+   SisTick_Init();
+   Init_Leds();
+   Init_Uart_Ftdi();
+
+   anillo = MpscRingCreate(LARGO_ANILLO, sizeof(uint32_t));
+   configASSERT(anillo != NULL);
+
+   xTaskCreate(Consumir, "Consumir", PILA_CONSUMIDOR, NULL, PRIORIDAD_CONSUMIDOR, NULL);
+   vTaskStartScheduler();
+
+   return aprobada ? 0 : 1;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
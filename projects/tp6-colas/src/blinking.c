@@ -71,6 +71,8 @@
 #include "switch.h"
 #include "chip.h"
 #include "ili9341.h"
+#include "ili9341_damage.h"
+#include "cycles.h"
 #include "event_groups.h"
 #include <string.h>
 #include <stdio.h>
@@ -280,24 +282,32 @@ void Display(void * parametros)
 	char muestrahoraparcialdos[9]={0};
 	char muestrahoraparcialtres[9]={0};
 	char muestrahoraparcialcuatro[9]={0};
+	char muestraancho[32];
+	ili9341_damage_stats_t pantalla;
 
 
 	while(1) {
 		//xSemaphoreTake(mutex,portMAX_DELAY);
 		sprintf(muestrahora,"%02d:%02d:%02d",argumentos->minutos,argumentos->segundos,argumentos->decimas);
-		ILI9341DrawString(100, 25, muestrahora, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+		/* Solo se envian a la pantalla los caracteres que cambiaron */
+		ILI9341DamageString(100, 25, muestrahora, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
 
 		if(xQueueReceive(cola,&mensajeRecibido,10/ portTICK_PERIOD_MS)){
 
 			sprintf(muestrahoraparcialuno,"%02d:%02d:%02d",mensajeRecibido.minutos,mensajeRecibido.segundos,mensajeRecibido.decimas);
-			ILI9341DrawString(100,100, muestrahoraparcialuno, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
-			ILI9341DrawString(100,130, muestrahoraparcialdos, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
-			ILI9341DrawString(100,160, muestrahoraparcialtres, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
-			ILI9341DrawString(100,190, muestrahoraparcialcuatro, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DamageString(100,100, muestrahoraparcialuno, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DamageString(100,130, muestrahoraparcialdos, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DamageString(100,160, muestrahoraparcialtres, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DamageString(100,190, muestrahoraparcialcuatro, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
 			stpcpy(muestrahoraparcialcuatro, muestrahoraparcialtres);
 			stpcpy(muestrahoraparcialtres, muestrahoraparcialdos);
 			stpcpy(muestrahoraparcialdos, muestrahoraparcialuno);
 			}
+		/* Pixeles por segundo enviados y pedidos, muestra el ancho de banda del SPI ahorrado */
+		ILI9341DamageGetStats(&pantalla);
+		snprintf(muestraancho, sizeof(muestraancho), "px/s %lu/%lu",(unsigned long)pantalla.pushed_per_second,(unsigned long)pantalla.requested_per_second);
+		ILI9341DamageString(100,225, muestraancho, &font_7x10, ILI9341_BLACK, ILI9341_WHITE);
+		ILI9341DamageFlush();
 		vTaskDelay(10/ portTICK_PERIOD_MS);
 	}
 }
@@ -320,6 +330,8 @@ int main(void)
 	Init_Leds();
 	ILI9341Init(SPI_1, GPIO_0, GPIO_6, GPIO_7);
 	ILI9341Rotate(ILI9341_Landscape_1);
+	/* Contador de ciclos para los pixeles por segundo de la pantalla */
+	Init_Cycles();
 	//ILI9341DrawString(50, 25, horaprueba, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
 	SisTick_Init();
 
@@ -62,7 +62,7 @@
 #define configUSE_MALLOC_FAILED_HOOK	            0
 #define configUSE_APPLICATION_TASK_TAG	            0
 #define configUSE_COUNTING_SEMAPHORES	            1
-#define configGENERATE_RUN_TIME_STATS	            0
+#define configGENERATE_RUN_TIME_STATS	            1
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 		0
@@ -190,5 +190,9 @@ extern int iMainRand32( void );
 #define configRAND32()    iMainRand32()
 #endif
 
+/* Per task CPU accounting with the cycle counter, it replaces the run time
+ * stats macros and the task switch trace macros. */
+#include "runtime_stats_hooks.h"
+
 #endif /* FREERTOS_CONFIG_H */
 
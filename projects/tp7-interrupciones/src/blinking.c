@@ -71,10 +71,13 @@
 #include "switch.h"
 #include "chip.h"
 #include "ili9341.h"
+#include "ili9341_damage.h"
 #include "event_groups.h"
 #include <string.h>
 #include <stdio.h>
 #include "controlador.h"
+#include "runtime_stats.h"
+#include "uart.h"
 
 /* === Definicion y Macros ================================================= */
 #define SPI_1   1  /*!< EDU-CIAA SPI port */
@@ -92,6 +95,15 @@
 /** @briev Evento para inidicar que la transmisción esta completa */
 #define EVENTO_COMPLETO   (1 << 8)
 
+/** @brief Memoria de la cache de glifos: indice, linea de 8 caracteres y 11 glifos de 16x26 */
+#define CACHE_GLIFOS      18432
+#define LINEA_GLIFOS      (8 * 16 * 26 * 2)
+#ifdef PLATFORM_HOST
+#define SECCION_GLIFOS
+#else
+#define SECCION_GLIFOS    __attribute__((section(".bss.$RamAHB32")))
+#endif
+
 
 /* === Declaraciones de tipos de datos internos ============================ */
 
@@ -109,6 +121,7 @@ void PuestaCero(void * parametros);
 void Display(void * parametros);
 void ValoresParciales(void *parametros);
 void TransmitePuertoSerie(void *parametros);
+void EnviarEstadisticas(const char * texto);
 
 /* === Definiciones de variables internas ================================== */
 
@@ -124,6 +137,8 @@ SemaphoreHandle_t mutex;
 EventGroupHandle_t eventos;
 EventBits_t uxBits;
 QueueHandle_t cola;
+/** @brief Cache de glifos del reloj, en la RAM AHB para que la lea el DMA */
+static uint8_t glifos[CACHE_GLIFOS] SECCION_GLIFOS __attribute__((aligned(4)));
 /* === Definiciones de variables externas ================================== */
 
 /* === Definiciones de funciones internas ================================== */
@@ -291,24 +306,32 @@ void Display(void * parametros)
 	char muestrahoraparcialdos[9]={0};
 	char muestrahoraparcialtres[9]={0};
 	char muestrahoraparcialcuatro[9]={0};
+	char muestraancho[32];
+	ili9341_damage_stats_t pantalla;
 
 
 	while(1) {
 		//xSemaphoreTake(mutex,portMAX_DELAY);
 		sprintf(muestrahora,"%02d:%02d:%02d",argumentos->minutos,argumentos->segundos,argumentos->decimas);
-		ILI9341DrawString(100, 25, muestrahora, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+		/* Solo se envian a la pantalla los caracteres que cambiaron */
+		ILI9341DamageString(100, 25, muestrahora, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
 
 		if(xQueueReceive(cola,&mensajeRecibido,10/ portTICK_PERIOD_MS)){
 
 			sprintf(muestrahoraparcialuno,"%02d:%02d:%02d",mensajeRecibido.minutos,mensajeRecibido.segundos,mensajeRecibido.decimas);
-			ILI9341DrawString(100,100, muestrahoraparcialuno, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
-			ILI9341DrawString(100,130, muestrahoraparcialdos, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
-			ILI9341DrawString(100,160, muestrahoraparcialtres, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
-			ILI9341DrawString(100,190, muestrahoraparcialcuatro, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DamageString(100,100, muestrahoraparcialuno, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DamageString(100,130, muestrahoraparcialdos, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DamageString(100,160, muestrahoraparcialtres, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DamageString(100,190, muestrahoraparcialcuatro, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
 			stpcpy(muestrahoraparcialcuatro, muestrahoraparcialtres);
 			stpcpy(muestrahoraparcialtres, muestrahoraparcialdos);
 			stpcpy(muestrahoraparcialdos, muestrahoraparcialuno);
 		}
+		/* Pixeles por segundo enviados y pedidos, muestra el ancho de banda del SPI ahorrado */
+		ILI9341DamageGetStats(&pantalla);
+		snprintf(muestraancho, sizeof(muestraancho), "px/s %lu/%lu",(unsigned long)pantalla.pushed_per_second,(unsigned long)pantalla.requested_per_second);
+		ILI9341DamageString(100,225, muestraancho, &font_7x10, ILI9341_BLACK, ILI9341_WHITE);
+		ILI9341DamageFlush();
 		vTaskDelay(10/ portTICK_PERIOD_MS);
 	}
 }
@@ -344,6 +367,15 @@ void TransmitePuertoSerie(void *parametros){
 
 
 }
+/** @brief Envia cada linea del informe de estadisticas por la RS232
+ **
+ ** La USB-UART queda reservada para los tiempos parciales que envia la tarea
+ ** TransmitePuertoSerie.
+ */
+void EnviarEstadisticas(const char * texto) {
+	SendString_Uart_Rs232((uint8_t *) texto);
+}
+
 void EventoSerial(void) {
 	BaseType_t planificar, resultado;
 	planificar = pdFALSE;
@@ -373,10 +405,13 @@ int main(void)
 	Init_Leds();
 	ILI9341Init(SPI_1, GPIO_0, GPIO_6, GPIO_7);
 	ILI9341Rotate(ILI9341_Landscape_1);
+	/* Los relojes se redibujan cada 10 ms con una sola ventana y transferencia */
+	ILI9341GlyphCacheInit(glifos, sizeof(glifos), LINEA_GLIFOS);
 	//ILI9341DrawString(50, 25, horaprueba, &font_16x26, ILI9341_BLACK, ILI9341_WHITE);
 	SisTick_Init();
 
 	Init_Uart_Ftdi();
+	Init_Uart_Rs232();
 
 	NVIC_SetPriority(26, 7);
 	NVIC_EnableIRQ(26);
@@ -394,6 +429,8 @@ int main(void)
 	xTaskCreate(Display,"display", configMINIMAL_STACK_SIZE*4,(void*)&param, tskIDLE_PRIORITY + 4, NULL);
 	xTaskCreate(ValoresParciales,"Parciales",configMINIMAL_STACK_SIZE ,(void*)&param, tskIDLE_PRIORITY + 1, NULL);
 	xTaskCreate(TransmitePuertoSerie,"Puerto serie",configMINIMAL_STACK_SIZE*2 ,(void*)&param, tskIDLE_PRIORITY + 1, NULL);
+	/* Uso del procesador de cada tarea, cada 5 segundos por la RS232 */
+	RuntimeStatsStartReport(5000/ portTICK_PERIOD_MS, EnviarEstadisticas, tskIDLE_PRIORITY + 1);
 	/* Arranque del sistema operativo */
 	vTaskStartScheduler();
 
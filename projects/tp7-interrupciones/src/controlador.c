@@ -52,6 +52,7 @@
 
 /* === Inclusiones de cabeceras ============================================ */
 #include "controlador.h"
+#include "runtime_stats.h"
 #include "uart.h"
 #include <stdint.h>
 #include <string.h>
@@ -107,6 +108,10 @@ bool EnviarTexto(const char * cadena) {
 void UART2_IRQHandler(void) {
    uint8_t eventos;
 
+#if (configGENERATE_RUN_TIME_STATS == 1)
+   RuntimeStatsIsrEnter();
+#endif
+
    eventos = Chip_UART_ReadLineStatus(USB_UART);
 
    if (eventos & UART_LSR_THRE) {
@@ -118,6 +123,10 @@ void UART2_IRQHandler(void) {
          EventoSerial();
       }
    }
+
+#if (configGENERATE_RUN_TIME_STATS == 1)
+   RuntimeStatsIsrExit();
+#endif
 }
 
 __attribute__ ((weak)) void EventoSerial(void) {
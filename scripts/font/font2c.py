@@ -0,0 +1,518 @@
+#!/usr/bin/env python3
+# Copyright 2026, Facultad de Ingeniería
+# Universidad Nacional de Entre Ríos
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Convierte una fuente TTF o BDF en una fuente suavizada para ILI9341DrawText.
+
+Cada caracter se dibuja en escala de grises, con 1, 2 o 4 bits de cobertura
+por pixel, y se recorta a los pixeles con tinta. Las coberturas se comprimen
+fila tras fila con el formato descripto en fonts.h: repeticiones de fondo y
+de frente de hasta 64 pixeles en un byte y repeticiones de hasta 8 pixeles
+de una cobertura intermedia en otro. Los caracteres chicos tienen pocas
+repeticiones y se guardan empaquetados, bpp bits por pixel, cuando así
+ocupan menos. La salida es un archivo C con los códigos, la tabla de
+caracteres y una variable FontAA_t:
+
+  - las fuentes TTF se dibujan a partir de sus contornos, sin hinting,
+    tomando 4 x 4 muestras por pixel, con -s pixeles por em,
+  - las fuentes BDF ya son mapas de bits y solo tienen frente y fondo,
+  - con -c se eligen los caracteres, por ejemplo solo los digitos para un
+    reloj grande; los que faltan entre el primero y el ultimo ocupan una
+    entrada de la tabla sin pixeles ni ancho.
+
+No usa bibliotecas fuera de las de Python.
+
+Uso: font2c.py fuente.ttf [-s pixeles] [-b bits] [-c caracteres] [-n nombre] [-o salida.c]
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+SAMPLES = 4
+CURVE_STEPS = 8
+
+# Códigos del formato, ver fonts.h
+CODE_BACK = 0x00
+CODE_FORE = 0x40
+CODE_BLEND = 0x80
+MAX_SOLID_RUN = 64
+MAX_BLEND_RUN = 8
+
+
+class TrueType:
+    """Lee los contornos y las medidas de una fuente TrueType"""
+
+    def __init__(self, path):
+        with open(path, "rb") as file:
+            self.data = file.read()
+        self.tables = {}
+        count = struct.unpack(">H", self.data[4:6])[0]
+        for i in range(count):
+            tag, _, offset, length = struct.unpack(">4sIII", self.data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        for tag in ("head", "hhea", "hmtx", "maxp", "cmap", "loca", "glyf"):
+            if tag not in self.tables:
+                sys.exit("%s: falta la tabla %s, ¿es una fuente TrueType?" % (path, tag))
+        head = self.tables["head"][0]
+        self.units = struct.unpack(">H", self.data[head + 18:head + 20])[0]
+        self.long_loca = struct.unpack(">h", self.data[head + 50:head + 52])[0] == 1
+        self.glyph_count = struct.unpack(">H", self.data[self.tables["maxp"][0] + 4:][:2])[0]
+        hhea = self.tables["hhea"][0]
+        self.metrics = struct.unpack(">H", self.data[hhea + 34:hhea + 36])[0]
+        self.cmap = self.read_cmap()
+
+    def read_cmap(self):
+        start = self.tables["cmap"][0]
+        count = struct.unpack(">H", self.data[start + 2:start + 4])[0]
+        best = None
+        for i in range(count):
+            platform, encoding, offset = struct.unpack(">HHI", self.data[start + 4 + 8 * i:][:8])
+            fmt = struct.unpack(">H", self.data[start + offset:start + offset + 2])[0]
+            if fmt == 4 and (platform == 0 or (platform == 3 and encoding == 1)):
+                best = start + offset
+        if best is None:
+            sys.exit("la fuente no tiene una tabla de caracteres Unicode de formato 4")
+        segments = struct.unpack(">H", self.data[best + 6:best + 8])[0] // 2
+        ends = best + 14
+        starts = ends + 2 * segments + 2
+        deltas = starts + 2 * segments
+        ranges = deltas + 2 * segments
+        mapping = {}
+        for s in range(segments):
+            end, first, delta, range_offset = (
+                struct.unpack(">H", self.data[table + 2 * s:table + 2 * s + 2])[0]
+                for table in (ends, starts, deltas, ranges))
+            for code in range(first, min(end, 0xFFFE) + 1):
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    address = ranges + 2 * s + range_offset + 2 * (code - first)
+                    glyph = struct.unpack(">H", self.data[address:address + 2])[0]
+                    if glyph != 0:
+                        glyph = (glyph + delta) & 0xFFFF
+                mapping[code] = glyph
+        return mapping
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        index = min(glyph, self.metrics - 1)
+        return struct.unpack(">H", self.data[hmtx + 4 * index:hmtx + 4 * index + 2])[0]
+
+    def glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = struct.unpack(">II", self.data[loca + 4 * glyph:loca + 4 * glyph + 8])
+        else:
+            start, end = (2 * value for value in
+                          struct.unpack(">HH", self.data[loca + 2 * glyph:loca + 2 * glyph + 4]))
+        return self.tables["glyf"][0] + start, end - start
+
+    def contours(self, glyph):
+        """Devuelve los contornos del glifo como listas de puntos (x, y, sobre la curva)"""
+        offset, length = self.glyph_range(glyph)
+        if length == 0:
+            return []
+        count = struct.unpack(">h", self.data[offset:offset + 2])[0]
+        if count < 0:
+            return self.composite(offset + 10)
+        ends = struct.unpack(">%dH" % count, self.data[offset + 10:offset + 10 + 2 * count])
+        points = ends[-1] + 1 if count else 0
+        position = offset + 10 + 2 * count
+        position += 2 + struct.unpack(">H", self.data[position:position + 2])[0]
+        flags = []
+        while len(flags) < points:
+            flag = self.data[position]
+            position += 1
+            flags.append(flag)
+            if flag & 0x08:
+                flags.extend([flag] * self.data[position])
+                position += 1
+        coordinates = []
+        for short, same in ((0x02, 0x10), (0x04, 0x20)):
+            value = 0
+            values = []
+            for flag in flags:
+                if flag & short:
+                    delta = self.data[position]
+                    position += 1
+                    value += delta if flag & same else -delta
+                elif not flag & same:
+                    value += struct.unpack(">h", self.data[position:position + 2])[0]
+                    position += 2
+                values.append(value)
+            coordinates.append(values)
+        result = []
+        start = 0
+        for end in ends:
+            result.append([(coordinates[0][i], coordinates[1][i], bool(flags[i] & 0x01))
+                           for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+    def composite(self, position):
+        result = []
+        while True:
+            flags, glyph = struct.unpack(">HH", self.data[position:position + 4])
+            position += 4
+            if flags & 0x0001:
+                dx, dy = struct.unpack(">hh", self.data[position:position + 4])
+                position += 4
+            else:
+                dx, dy = struct.unpack(">bb", self.data[position:position + 2])
+                position += 2
+            if not flags & 0x0002:
+                dx = dy = 0
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                a = d = struct.unpack(">h", self.data[position:position + 2])[0] / 16384.0
+                position += 2
+            elif flags & 0x0040:
+                a, d = (value / 16384.0 for value in
+                        struct.unpack(">hh", self.data[position:position + 4]))
+                position += 4
+            elif flags & 0x0080:
+                a, b, c, d = (value / 16384.0 for value in
+                              struct.unpack(">hhhh", self.data[position:position + 8]))
+                position += 8
+            for contour in self.contours(glyph):
+                result.append([(a * x + c * y + dx, b * x + d * y + dy, on)
+                               for x, y, on in contour])
+            if not flags & 0x0020:
+                return result
+
+    def copyright(self):
+        if "name" not in self.tables:
+            return None
+        start = self.tables["name"][0]
+        count, strings = struct.unpack(">HH", self.data[start + 2:start + 6])
+        for i in range(count):
+            platform, _, _, name, length, offset = struct.unpack(
+                ">6H", self.data[start + 6 + 12 * i:start + 18 + 12 * i])
+            if name == 0:
+                text = self.data[start + strings + offset:start + strings + offset + length]
+                return text.decode("utf-16-be" if platform in (0, 3) else "latin-1").strip()
+        return None
+
+    def render(self, code, size):
+        """Devuelve la cobertura de 0 a 1 de cada pixel, la posición del mapa respecto del
+        origen del caracter, con y hacia abajo, y el avance en pixeles"""
+        glyph = self.cmap.get(code, 0)
+        scale = size / self.units
+        advance = int(round(self.advance(glyph) * scale))
+        edges = []
+        for contour in self.contours(glyph):
+            polygon = flatten([(x * scale, -y * scale, on) for x, y, on in contour])
+            edges.extend(zip(polygon, polygon[1:] + polygon[:1]))
+        if not edges:
+            return [], 0, 0, advance
+        left = int(math.floor(min(x for (x, _), _ in edges)))
+        top = int(math.floor(min(y for (_, y), _ in edges)))
+        width = int(math.ceil(max(x for (x, _), _ in edges))) - left
+        height = int(math.ceil(max(y for (_, y), _ in edges))) - top
+        coverage = [[0.0] * width for _ in range(height)]
+        for row in range(height * SAMPLES):
+            sample_y = top + (row + 0.5) / SAMPLES
+            crossings = []
+            for (x0, y0), (x1, y1) in edges:
+                if (y0 <= sample_y < y1) or (y1 <= sample_y < y0):
+                    crossings.append((x0 + (sample_y - y0) * (x1 - x0) / (y1 - y0),
+                                      1 if y1 > y0 else -1))
+            crossings.sort()
+            winding = 0
+            for i, (x, direction) in enumerate(crossings[:-1]):
+                winding += direction
+                if winding == 0:
+                    continue
+                # Muestras cuyo centro cae entre este cruce y el siguiente
+                first = int(math.ceil((x - left) * SAMPLES - 0.5))
+                last = int(math.ceil((crossings[i + 1][0] - left) * SAMPLES - 0.5))
+                for sample in range(max(first, 0), min(last, width * SAMPLES)):
+                    coverage[row // SAMPLES][sample // SAMPLES] += 1.0 / (SAMPLES * SAMPLES)
+        return coverage, left, top, advance
+
+
+def flatten(contour):
+    """Reemplaza las curvas cuadráticas del contorno por segmentos"""
+    if not contour:
+        return []
+    # Empieza en un punto sobre la curva, agregando el punto medio si no hay ninguno
+    start = next((i for i, point in enumerate(contour) if point[2]), None)
+    if start is None:
+        first = ((contour[0][0] + contour[-1][0]) / 2, (contour[0][1] + contour[-1][1]) / 2, True)
+        contour = [first] + contour
+        start = 0
+    contour = contour[start:] + contour[:start]
+    polygon = [contour[0][:2]]
+    control = None
+    for x, y, on in contour[1:] + contour[:1]:
+        if on:
+            if control is None:
+                polygon.append((x, y))
+            else:
+                polygon.extend(curve(polygon[-1], control, (x, y)))
+                control = None
+        elif control is None:
+            control = (x, y)
+        else:
+            middle = ((control[0] + x) / 2, (control[1] + y) / 2)
+            polygon.extend(curve(polygon[-1], control, middle))
+            control = (x, y)
+    return polygon[:-1]
+
+
+def curve(start, control, end):
+    points = []
+    for step in range(1, CURVE_STEPS + 1):
+        t = step / CURVE_STEPS
+        points.append(((1 - t) ** 2 * start[0] + 2 * (1 - t) * t * control[0] + t * t * end[0],
+                       (1 - t) ** 2 * start[1] + 2 * (1 - t) * t * control[1] + t * t * end[1]))
+    return points
+
+
+class Bdf:
+    """Lee los mapas de bits de una fuente BDF"""
+
+    def __init__(self, path):
+        self.glyphs = {}
+        self.copyright_text = None
+        code = None
+        bitmap = None
+        with open(path, encoding="latin-1") as file:
+            for line in file:
+                words = line.split()
+                if not words:
+                    continue
+                if words[0] == "COPYRIGHT":
+                    self.copyright_text = line.split(None, 1)[1].strip().strip('"')
+                elif words[0] == "ENCODING":
+                    code = int(words[1])
+                elif words[0] == "DWIDTH":
+                    advance = int(words[1])
+                elif words[0] == "BBX":
+                    box = [int(word) for word in words[1:5]]
+                elif words[0] == "BITMAP":
+                    bitmap = []
+                elif words[0] == "ENDCHAR":
+                    self.glyphs[code] = (advance, box, bitmap)
+                    bitmap = None
+                elif bitmap is not None:
+                    bits = int(words[0], 16)
+                    size = len(words[0]) * 4
+                    bitmap.append([1.0 if bits & (1 << (size - 1 - i)) else 0.0
+                                   for i in range(box[0])])
+
+    def copyright(self):
+        return self.copyright_text
+
+    def render(self, code, size):
+        if code not in self.glyphs:
+            return [], 0, 0, 0
+        advance, (width, height, x, y), bitmap = self.glyphs[code]
+        return bitmap, x, -(y + height), advance
+
+
+def quantize(coverage, levels):
+    """Pasa la cobertura a niveles y recorta las filas y columnas vacias"""
+    rows = [[int(round(value * levels)) for value in row] for row in coverage]
+    used_rows = [i for i, row in enumerate(rows) if any(row)]
+    if not used_rows:
+        return [], 0, 0
+    used_columns = [j for j in range(len(rows[0])) if any(row[j] for row in rows)]
+    top, bottom = used_rows[0], used_rows[-1] + 1
+    left, right = used_columns[0], used_columns[-1] + 1
+    return [row[left:right] for row in rows[top:bottom]], left, top
+
+
+def encode(pixels, levels):
+    """Comprime las coberturas de un glifo, en el mismo orden que GlyphDecode de ili9341.c"""
+    output = bytearray()
+    position = 0
+    while position < len(pixels):
+        value = pixels[position]
+        run = 1
+        limit = MAX_SOLID_RUN if value in (0, levels) else MAX_BLEND_RUN
+        while position + run < len(pixels) and pixels[position + run] == value and run < limit:
+            run += 1
+        if value == 0:
+            output.append(CODE_BACK | (run - 1))
+        elif value == levels:
+            output.append(CODE_FORE | (run - 1))
+        else:
+            output.append(CODE_BLEND | (run - 1) << 4 | value)
+        position += run
+    return bytes(output)
+
+
+def pack(pixels, bpp):
+    """Empaqueta las coberturas, el primer pixel en los bits más altos de cada byte"""
+    output = bytearray()
+    bits = 0
+    used = 0
+    for value in pixels:
+        bits = bits << bpp | value
+        used += bpp
+        if used == 8:
+            output.append(bits)
+            bits = used = 0
+    if used:
+        output.append(bits << (8 - used))
+    return bytes(output)
+
+
+def unpack(data, count, bpp):
+    mask = (1 << bpp) - 1
+    return [(data[i * bpp // 8] >> (8 - bpp - i * bpp % 8)) & mask for i in range(count)]
+
+
+def decode(data, count, levels):
+    pixels = []
+    for code in data:
+        if code & CODE_BLEND:
+            pixels.extend([code & 0x0F] * (((code >> 4) & 0x07) + 1))
+        else:
+            pixels.extend([levels if code & CODE_FORE else 0] * ((code & 0x3F) + 1))
+    return pixels[:count]
+
+
+def convert(font, characters, size, bpp):
+    """Devuelve la altura de la linea y por cada caracter sus datos y su glifo"""
+    levels = (1 << bpp) - 1
+    glyphs = {}
+    for code in characters:
+        coverage, left, top, advance = font.render(code, size)
+        pixels, trim_left, trim_top = quantize(coverage, levels)
+        glyphs[code] = [pixels, left + trim_left, top + trim_top, advance]
+    inked = [glyph for glyph in glyphs.values() if glyph[0]]
+    if not inked:
+        sys.exit("ninguno de los caracteres tiene pixeles")
+    ascent = -min(glyph[2] for glyph in inked)
+    height = max(glyph[2] + len(glyph[0]) for glyph in inked) + ascent
+    result = {}
+    for code, (pixels, x, y, advance) in glyphs.items():
+        width = len(pixels[0]) if pixels else 0
+        # La tinta queda dentro de la celda, que empieza en el origen del caracter
+        x = max(x, 0)
+        advance = max(advance, x + width)
+        if width > 255 or height > 255 or advance > 255:
+            sys.exit("el caracter %r es demasiado grande" % chr(code))
+        flat = [value for row in pixels for value in row]
+        data = encode(flat, levels)
+        packed = pack(flat, bpp)
+        if decode(data, len(flat), levels) != flat or unpack(packed, len(flat), bpp) != flat:
+            sys.exit("el caracter %r comprimido no coincide con el original" % chr(code))
+        use_packed = len(packed) < len(data)
+        if use_packed:
+            data = packed
+        result[code] = (data, use_packed, width, len(pixels), x if width else 0,
+                        y + ascent if width else 0, advance)
+    return height, result
+
+
+def c_string(code):
+    character = chr(code)
+    return "'\\''" if character == "'" else "'\\\\'" if character == "\\" else "'%s'" % character
+
+
+def write_source(output, name, source, notice, bpp, height, glyphs):
+    first, last = min(glyphs), max(glyphs)
+    data = bytearray()
+    table = []
+    raw = 0
+    for code in range(first, last + 1):
+        if code in glyphs:
+            codes, packed, width, rows, x, y, advance = glyphs[code]
+        else:
+            codes, packed, width, rows, x, y, advance = b"", False, 0, 0, 0, 0, 0
+        table.append("\t{%d, %d, %d, %d, %d, %d, %d},\t/* %s */" % (
+            len(data), width, rows, x, y, advance, packed, c_string(code)))
+        data += codes
+        raw += (width * rows * bpp + 7) // 8
+    if len(data) > 0xFFFF:
+        sys.exit("los caracteres ocupan %d bytes, más de los 65535 que admite Glyph_t" % len(data))
+    output.write("/* Generado con scripts/font/font2c.py a partir de %s, no editar */\n" %
+                 os.path.basename(source))
+    if notice:
+        output.write("/* Fuente original: %s */\n" % notice.replace("*/", "* /"))
+    output.write('\n#include "fonts.h"\n\n')
+    output.write("/* %d caracteres de %d pixeles de alto con %d bits por pixel, %d bytes en lugar "
+                 "de %d */\n" % (last - first + 1, height, bpp, len(data), raw))
+    output.write("static const uint8_t %s_data[] = {\n" % name)
+    for start in range(0, len(data), 16):
+        output.write("\t" + " ".join("0x%02X," % value for value in data[start:start + 16]) + "\n")
+    output.write("};\n\n")
+    output.write("static const Glyph_t %s_glyphs[] = {\n%s\n};\n\n" % (name, "\n".join(table)))
+    output.write("const FontAA_t %s = {%d, %d, %d, %d, %s_glyphs, %s_data, sizeof(%s_data)};\n" % (
+        name, bpp, height, first, last - first + 1, name, name, name))
+    return len(data), raw, len(table)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="fuente TTF o BDF")
+    parser.add_argument("-s", "--size", type=float, default=16,
+                        help="pixeles por em de las fuentes TTF, por defecto 16")
+    parser.add_argument("-b", "--bpp", type=int, choices=(1, 2, 4), default=4,
+                        help="bits de cobertura por pixel, por defecto 4")
+    parser.add_argument("-c", "--characters", default=None,
+                        help="caracteres de la fuente, por defecto los ASCII imprimibles")
+    parser.add_argument("-n", "--name", default=None,
+                        help="nombre de la variable, por defecto el del archivo")
+    parser.add_argument("-o", "--output", default=None,
+                        help="archivo C, por defecto la salida estandar")
+    args = parser.parse_args()
+
+    characters = sorted(set(ord(c) for c in (args.characters or
+                                             "".join(chr(c) for c in range(32, 127)))))
+    if characters[0] < 32 or characters[-1] > 255:
+        sys.exit("los caracteres deben estar entre 32 y 255")
+    name = args.name or os.path.splitext(os.path.basename(args.input))[0].replace("-", "_")
+    if args.input.lower().endswith(".bdf"):
+        font = Bdf(args.input)
+    else:
+        font = TrueType(args.input)
+    height, glyphs = convert(font, characters, args.size, args.bpp)
+
+    if args.output:
+        with open(args.output, "w") as output:
+            size, raw, entries = write_source(output, name, args.input, font.copyright(),
+                                              args.bpp, height, glyphs)
+    else:
+        size, raw, entries = write_source(sys.stdout, name, args.input, font.copyright(),
+                                          args.bpp, height, glyphs)
+    print("%s: %d caracteres de %d pixeles de alto, %d bytes comprimida, %d sin comprimir "
+          "(%.1f %%) y %d de la tabla" % (name, entries, height, size, raw, 100.0 * size / raw,
+                                          entries * 8), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
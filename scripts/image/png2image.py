@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+# Copyright 2026, Facultad de Ingeniería
+# Universidad Nacional de Entre Ríos
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Convierte una imagen PNG en una imagen comprimida para ILI9341DrawImage.
+
+Los pixeles se pasan a RGB565 y se comprimen con el formato descripto en
+ili9341.h, parecido a QOI: repeticiones del color anterior, colores ya vistos
+guardados en una tabla de 64 entradas, diferencias pequeñas con el color
+anterior en uno o dos bytes y colores literales en tres. La salida es un
+archivo C con los datos y una variable ili9341_image_t, que se agrega a las
+fuentes del proyecto:
+
+  - los pixeles con transparencia se mezclan con el color de fondo, o con
+    -t se reemplazan por el color transparente de ILI9341DrawSprite cuando
+    son mas de la mitad transparentes,
+  - con -r se agregan tambien los pixeles sin comprimir, con el byte alto
+    primero, para ILI9341DrawPicture.
+
+Lee PNG sin entrelazar de 8 o 16 bits por canal, en cualquier tipo de color,
+sin usar bibliotecas fuera de las de Python.
+
+Uso: png2image.py entrada.png [-n nombre] [-o salida.c] [-b fondo] [-t transparente] [-r]
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+# Operaciones del formato, ver ili9341.h
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_COLOR = 0xFE
+MAX_RUN = 62
+
+
+def read_png(path):
+    """Devuelve el ancho, el alto y las filas de pixeles (r, g, b, a) de 8 bits"""
+    with open(path, "rb") as file:
+        data = file.read()
+    if not data.startswith(PNG_SIGNATURE):
+        sys.exit("%s: no es un archivo PNG" % path)
+    offset = len(PNG_SIGNATURE)
+    header = None
+    palette = []
+    alpha = b""
+    compressed = bytearray()
+    while offset + 8 <= len(data):
+        length, kind = struct.unpack(">I4s", data[offset:offset + 8])
+        chunk = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            alpha = chunk
+        elif kind == b"IDAT":
+            compressed += chunk
+        elif kind == b"IEND":
+            break
+    if header is None:
+        sys.exit("%s: falta el encabezado IHDR" % path)
+    width, height, depth, color_type, _, _, interlace = header
+    if interlace != 0:
+        sys.exit("%s: las imagenes entrelazadas no estan soportadas" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if channels is None or depth not in ((8, 16) if color_type != 3 else (8,)):
+        sys.exit("%s: tipo de color %d con %d bits no soportado" % (path, color_type, depth))
+
+    pixel_size = channels * depth // 8
+    stride = width * pixel_size
+    raw = zlib.decompress(bytes(compressed))
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for x in range(stride):
+            left = line[x - pixel_size] if x >= pixel_size else 0
+            up = previous[x]
+            corner = previous[x - pixel_size] if x >= pixel_size else 0
+            if kind == 1:
+                line[x] = (line[x] + left) & 0xFF
+            elif kind == 2:
+                line[x] = (line[x] + up) & 0xFF
+            elif kind == 3:
+                line[x] = (line[x] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                estimate = left + up - corner
+                distances = (abs(estimate - left), abs(estimate - up), abs(estimate - corner))
+                best = (left, up, corner)[distances.index(min(distances))]
+                line[x] = (line[x] + best) & 0xFF
+        previous = line
+        # Con 16 bits por canal alcanza el byte alto
+        samples = line[::2] if depth == 16 else line
+        row = []
+        for x in range(width):
+            value = samples[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                row.append((value[0], value[0], value[0], 255))
+            elif color_type == 2:
+                row.append((value[0], value[1], value[2], 255))
+            elif color_type == 3:
+                r, g, b = palette[value[0]]
+                row.append((r, g, b, alpha[value[0]] if value[0] < len(alpha) else 255))
+            elif color_type == 4:
+                row.append((value[0], value[0], value[0], value[1]))
+            else:
+                row.append(tuple(value))
+        rows.append(row)
+    return width, height, rows
+
+
+def to_rgb565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | ((b * 31 + 127) // 255)
+
+
+def from_rgb565(color):
+    r = (color >> 11) & 0x1F
+    g = (color >> 5) & 0x3F
+    b = color & 0x1F
+    return (r * 255 + 15) // 31, (g * 255 + 31) // 63, (b * 255 + 15) // 31
+
+
+def convert(rows, background, transparent):
+    """Pasa los pixeles a RGB565, mezclando o reemplazando los transparentes"""
+    back = from_rgb565(background)
+    pixels = []
+    for row in rows:
+        for r, g, b, a in row:
+            if transparent is not None and a < 128:
+                pixels.append(transparent)
+                continue
+            if a < 255:
+                r = (r * a + back[0] * (255 - a) + 127) // 255
+                g = (g * a + back[1] * (255 - a) + 127) // 255
+                b = (b * a + back[2] * (255 - a) + 127) // 255
+            color = to_rgb565(r, g, b)
+            # Un pixel opaco no puede tener el color transparente, se cambia el bit bajo del verde
+            if color == transparent:
+                color ^= 0x0020
+            pixels.append(color)
+    return pixels
+
+
+def color_hash(color):
+    return (((color >> 11) & 0x1F) * 3 + ((color >> 5) & 0x3F) * 5 + (color & 0x1F) * 7) & 0x3F
+
+
+def wrap(value, bits):
+    """Diferencia con signo de un componente de bits bits"""
+    value &= (1 << bits) - 1
+    return value - (1 << bits) if value >= 1 << (bits - 1) else value
+
+
+def encode(pixels):
+    """Comprime los pixeles RGB565, en el mismo orden que los decodifica ili9341.c"""
+    output = bytearray()
+    index = [0] * 64
+    previous = 0
+    run = 0
+    for color in pixels:
+        if color == previous:
+            run += 1
+            if run == MAX_RUN:
+                output.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run > 0:
+            output.append(OP_RUN | (run - 1))
+            run = 0
+        position = color_hash(color)
+        if index[position] == color:
+            output.append(OP_INDEX | position)
+            previous = color
+            continue
+        index[position] = color
+        dr = wrap((color >> 11) - (previous >> 11), 5)
+        dg = wrap(((color >> 5) & 0x3F) - ((previous >> 5) & 0x3F), 6)
+        db = wrap((color & 0x1F) - (previous & 0x1F), 5)
+        # El verde tiene el doble de resolución, el rojo y el azul se miden contra su mitad
+        half = ((dg + 32) >> 1) - 16
+        if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+            output.append(OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+        elif -32 <= dg <= 31 and -8 <= dr - half <= 7 and -8 <= db - half <= 7:
+            output.append(OP_LUMA | (dg + 32))
+            output.append((dr - half + 8) << 4 | (db - half + 8))
+        else:
+            output.append(OP_COLOR)
+            output.append(color >> 8)
+            output.append(color & 0xFF)
+        previous = color
+    if run > 0:
+        output.append(OP_RUN | (run - 1))
+    return bytes(output)
+
+
+def decode(data, count):
+    """Descomprime como ImageDecode de ili9341.c, para verificar la salida"""
+    pixels = []
+    index = [0] * 64
+    color = 0
+    offset = 0
+    while len(pixels) < count:
+        op = data[offset]
+        offset += 1
+        if op == OP_COLOR:
+            color = data[offset] << 8 | data[offset + 1]
+            offset += 2
+        elif op & 0xC0 == OP_INDEX:
+            pixels.append(index[op])
+            color = index[op]
+            continue
+        elif op & 0xC0 == OP_DIFF:
+            r = ((color >> 11) + ((op >> 4) & 3) - 2) & 0x1F
+            g = (((color >> 5) & 0x3F) + ((op >> 2) & 3) - 2) & 0x3F
+            b = ((color & 0x1F) + (op & 3) - 2) & 0x1F
+            color = r << 11 | g << 5 | b
+        elif op & 0xC0 == OP_LUMA:
+            half = ((op & 0x3F) >> 1) - 16
+            r = ((color >> 11) + half + (data[offset] >> 4) - 8) & 0x1F
+            g = (((color >> 5) & 0x3F) + (op & 0x3F) - 32) & 0x3F
+            b = ((color & 0x1F) + half + (data[offset] & 0x0F) - 8) & 0x1F
+            offset += 1
+            color = r << 11 | g << 5 | b
+        else:
+            pixels.extend([color] * ((op & 0x3F) + 1))
+            continue
+        index[color_hash(color)] = color
+        pixels.append(color)
+    return pixels
+
+
+def c_array(data):
+    lines = []
+    for start in range(0, len(data), 16):
+        lines.append("   " + " ".join("0x%02X," % value for value in data[start:start + 16]))
+    return "\n".join(lines)
+
+
+def write_source(output, name, source, width, height, data, pixels, raw):
+    output.write("/* Generado con scripts/image/png2image.py a partir de %s, no editar */\n\n" %
+                 os.path.basename(source))
+    output.write('#include "ili9341.h"\n\n')
+    output.write("/* %dx%d pixeles, %d bytes en lugar de %d */\n" %
+                 (width, height, len(data), width * height * 2))
+    output.write("static const uint8_t %s_data[] = {\n%s\n};\n\n" % (name, c_array(data)))
+    output.write("const ili9341_image_t %s = {%d, %d, sizeof(%s_data), %s_data};\n" %
+                 (name, width, height, name, name))
+    if raw:
+        picture = bytearray()
+        for color in pixels:
+            picture += bytes((color >> 8, color & 0xFF))
+        output.write("\n/* Los mismos pixeles sin comprimir, para ILI9341DrawPicture */\n")
+        output.write("const uint8_t %s_pic[] = {\n%s\n};\n" % (name, c_array(picture)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="imagen PNG")
+    parser.add_argument("-n", "--name", default=None,
+                        help="nombre de la variable, por defecto el del archivo")
+    parser.add_argument("-o", "--output", default=None,
+                        help="archivo C, por defecto la salida estandar")
+    parser.add_argument("-b", "--background", default="0x0000",
+                        help="color RGB565 con el que se mezclan los pixeles transparentes")
+    parser.add_argument("-t", "--transparent", default=None,
+                        help="color RGB565 de los pixeles transparentes para ILI9341DrawSprite")
+    parser.add_argument("-r", "--raw", action="store_true",
+                        help="agrega los pixeles sin comprimir para ILI9341DrawPicture")
+    args = parser.parse_args()
+
+    name = args.name or os.path.splitext(os.path.basename(args.input))[0].replace("-", "_")
+    transparent = int(args.transparent, 0) if args.transparent is not None else None
+    width, height, rows = read_png(args.input)
+    if width > 0xFFFF or height > 0xFFFF:
+        sys.exit("%s: la imagen es demasiado grande" % args.input)
+    pixels = convert(rows, int(args.background, 0), transparent)
+    data = encode(pixels)
+    if decode(data, len(pixels)) != pixels:
+        sys.exit("%s: la imagen comprimida no coincide con la original" % args.input)
+
+    if args.output:
+        with open(args.output, "w") as output:
+            write_source(output, name, args.input, width, height, data, pixels, args.raw)
+    else:
+        write_source(sys.stdout, name, args.input, width, height, data, pixels, args.raw)
+    print("%s: %dx%d pixeles, %d bytes comprimida, %d sin comprimir (%.1f %%)" % (
+        name, width, height, len(data), width * height * 2, 100.0 * len(data) / (width * height * 2)),
+        file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+# Copyright 2026, Facultad de Ingeniería
+# Universidad Nacional de Entre Ríos
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Convierte el histograma de profiler.c en un perfil por función.
+
+La entrada es el texto enviado por ProfilerDump por la USB-UART o la salida
+estandar, que puede estar mezclado con otros mensajes. Las direcciones se
+ubican en la tabla de simbolos .names.csv que genera la compilación de cada
+proyecto, o en la que se obtiene con nm del .elf, y el resultado es:
+
+  - un perfil plano con las muestras de cada función, en la salida estandar,
+  - las muestras de cada tarea,
+  - con -f, pilas plegadas "tarea;función muestras" para flamegraph.pl o
+    https://speedscope.app
+
+Uso: symbolize.py registro simbolos [-f salida.folded] [-n funciones]
+"""
+
+import argparse
+import re
+import shutil
+import subprocess
+import sys
+
+NAMES = re.compile(r"^(?:.*?:)?([0-9a-fA-F]+)\s+(?:([0-9a-fA-F]+)\s+)?([A-Za-z?])\s+(.+)$")
+FUNCTION_TYPES = "tTwWiI"
+ISR_TASK = "[isr]"
+EXTERNAL = "[externo]"
+
+
+def read_profile(path):
+    """Devuelve la cabecera, los nombres de las tareas y las muestras del ultimo envio completo"""
+    with open(path, "rb") as file:
+        text = file.read().decode("latin-1")
+
+    result = None
+    current = None
+    for line in text.splitlines():
+        position = line.find("@profile")
+        if position < 0:
+            continue
+        fields = line[position:].split()
+        if fields[0] == "@profile-begin":
+            header = dict(field.split("=", 1) for field in fields[1:])
+            current = {"header": header, "tasks": {0: ISR_TASK}, "samples": []}
+        elif current is None:
+            continue
+        elif fields[0] == "@profile-task":
+            current["tasks"][int(fields[1], 16)] = " ".join(fields[2:])
+        elif fields[0] == "@profile":
+            current["samples"].append((int(fields[1], 16), int(fields[2], 16), int(fields[3])))
+        elif fields[0] == "@profile-end":
+            result = current
+            current = None
+    if result is None:
+        sys.exit("%s: no contiene un perfil completo entre @profile-begin y @profile-end" % path)
+    return result
+
+
+def is_arm(path):
+    with open(path, "rb") as file:
+        header = file.read(20)
+    return header[:4] == b"\x7fELF" and header[18] == 40
+
+
+def read_symbols(path):
+    """Devuelve las funciones ordenadas por dirección como (inicio, fin, nombre)"""
+    if path.endswith(".elf"):
+        arm = is_arm(path)
+        tool = None
+        for candidate in (["arm-none-eabi-nm"] if arm else []) + ["nm"]:
+            if shutil.which(candidate):
+                tool = candidate
+                break
+        if tool is None:
+            sys.exit("no se encontro nm para leer %s, use el archivo .names.csv" % path)
+        lines = subprocess.run([tool, "-nSC", path], check=True, stdout=subprocess.PIPE,
+                               universal_newlines=True).stdout.splitlines()
+    else:
+        with open(path) as file:
+            lines = file.read().splitlines()
+        arm = False
+
+    symbols = []
+    for line in lines:
+        match = NAMES.match(line.strip())
+        if not match or match.group(3) not in FUNCTION_TYPES:
+            continue
+        address = int(match.group(1), 16)
+        size = int(match.group(2), 16) if match.group(2) else 0
+        if address & 1:
+            # Las funciones Thumb tienen el bit cero en uno en la tabla de simbolos
+            arm = True
+        symbols.append([address, size, match.group(4).strip()])
+
+    if arm:
+        for symbol in symbols:
+            symbol[0] &= ~1
+    symbols.sort()
+
+    functions = []
+    for index, (address, size, name) in enumerate(symbols):
+        if size == 0:
+            following = [other[0] for other in symbols[index + 1:] if other[0] > address]
+            size = (following[0] - address) if following else 4
+        functions.append((address, address + size, name))
+    return functions, arm
+
+
+def locate(functions, starts, address):
+    """Nombre de la función que contiene una dirección"""
+    low, high = 0, len(starts)
+    while low < high:
+        middle = (low + high) // 2
+        if starts[middle] <= address:
+            low = middle + 1
+        else:
+            high = middle
+    if low > 0:
+        start, end, name = functions[low - 1]
+        if start <= address < end:
+            return name
+    return EXTERNAL
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="texto con las lineas @profile enviadas por ProfilerDump")
+    parser.add_argument("symbols", help="tabla de simbolos .names.csv o programa .elf del proyecto")
+    parser.add_argument("-f", "--folded", default=None, help="archivo de pilas plegadas")
+    parser.add_argument("-n", "--top", type=int, default=25, help="funciones del perfil plano")
+    arguments = parser.parse_args()
+
+    profile = read_profile(arguments.input)
+    functions, arm = read_symbols(arguments.symbols)
+    starts = [function[0] for function in functions]
+
+    # El programa puede estar cargado en otra dirección que la del .elf,
+    # como los ejecutables independientes de la posición en la PC
+    slide = 0
+    reference = [function[0] for function in functions if function[2] == "ProfilerStart"]
+    if reference and "ref" in profile["header"]:
+        slide = (int(profile["header"]["ref"], 16) & (~1 if arm else ~0)) - reference[0]
+
+    by_function = {}
+    by_task = {}
+    folded = {}
+    total = 0
+    for address, task, count in profile["samples"]:
+        name = locate(functions, starts, address - slide)
+        task_name = profile["tasks"].get(task, "0x%x" % task)
+        by_function[name] = by_function.get(name, 0) + count
+        by_task[task_name] = by_task.get(task_name, 0) + count
+        key = "%s;%s" % (task_name.replace(";", "_").replace(" ", "_"), name.replace(";", "_"))
+        folded[key] = folded.get(key, 0) + count
+        total += count
+
+    header = profile["header"]
+    print("# profile hz=%s samples=%d dropped=%s" % (header.get("hz", "?"), total,
+                                                      header.get("dropped", "?")))
+    print("function,samples,percent")
+    for name, count in sorted(by_function.items(), key=lambda item: -item[1])[:arguments.top]:
+        print("%s,%d,%.2f" % (name, count, 100.0 * count / total if total else 0))
+    print("task,samples,percent")
+    for name, count in sorted(by_task.items(), key=lambda item: -item[1]):
+        print("%s,%d,%.2f" % (name, count, 100.0 * count / total if total else 0))
+
+    if arguments.folded:
+        with open(arguments.folded, "w") as file:
+            for key, count in sorted(folded.items()):
+                file.write("%s %d\n" % (key, count))
+
+
+if __name__ == "__main__":
+    main()
@@ -23,7 +23,13 @@ do
    OUT_STDOUT=${OUT}/${P_NAME}.stdout
    OUT_STDERR=${OUT}/${P_NAME}.stderr
    printf "[%02d of %02d] \e[36m%-32s\e[0m BUILD " ${COUNT} ${N} [${P_NAME}]
+   if [ "${PLATFORM}" == "host" ] && grep -q "^HOST_BUILD=n" ${D}/config.mk; then
+      echo -e "[\e[33mSKIP\e[0m]"
+      COUNT=$((${COUNT} + 1))
+      continue
+   fi
    make -C ${BASE} \
+      PLATFORM=${PLATFORM} \
       PROJECT_PATH=${P_PATH} \
       PROJECT_NAME=${P_NAME} \
       all clean > ${OUT_STDOUT} 2>${OUT_STDERR} \
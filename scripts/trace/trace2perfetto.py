@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+# Copyright 2026, Facultad de Ingeniería
+# Universidad Nacional de Entre Ríos
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Convierte el registro de eventos de trace_recorder.c en una traza JSON.
+
+La entrada puede ser la copia binaria de la variable trace_recorder que
+obtiene make trace con GDB, o el texto enviado por TraceRecorderDump por la
+USB-UART o la salida estandar, que puede estar mezclado con otros mensajes.
+La salida usa el formato de eventos de Chrome, que se abre con
+https://ui.perfetto.dev o chrome://tracing:
+
+  - cada tarea es un hilo con una porción por cada vez que tuvo el procesador,
+  - las interrupciones registradas con TraceIsrEnter y TraceIsrExit son
+    porciones anidadas en un hilo propio,
+  - las operaciones sobre colas, los bloqueos y los eventos de la aplicación
+    son marcas instantaneas en el hilo que las produjo.
+
+Uso: trace2perfetto.py entrada [-o salida.json]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"FRTRACE\0"
+HEADER = struct.Struct("<8s10I")
+RECORD = struct.Struct("<II")
+
+TASK_CREATE = 0x01
+TASK_DELETE = 0x02
+TASK_SWITCHED_IN = 0x03
+TASK_SWITCHED_OUT = 0x04
+QUEUE_CREATE = 0x05
+QUEUE_SEND = 0x06
+QUEUE_SEND_FROM_ISR = 0x07
+QUEUE_RECEIVE = 0x08
+QUEUE_RECEIVE_FROM_ISR = 0x09
+BLOCKING_ON_SEND = 0x0A
+BLOCKING_ON_RECEIVE = 0x0B
+ISR_ENTER = 0x0C
+ISR_EXIT = 0x0D
+USER = 0x0E
+
+QUEUE_EVENTS = {
+    QUEUE_SEND: "send",
+    QUEUE_SEND_FROM_ISR: "send_from_isr",
+    QUEUE_RECEIVE: "receive",
+    QUEUE_RECEIVE_FROM_ISR: "receive_from_isr",
+    BLOCKING_ON_SEND: "blocked_on_send",
+    BLOCKING_ON_RECEIVE: "blocked_on_receive",
+}
+
+QUEUE_TYPES = ["queue", "mutex", "counting", "binary", "recursive"]
+
+EXCEPTIONS = {11: "SVCall", 14: "PendSV", 15: "SysTick"}
+
+PID = 1
+ISR_TID = 0
+
+
+def read_input(path):
+    """Devuelve los bytes del registro, desde un archivo binario o de texto"""
+    with open(path, "rb") as file:
+        data = file.read()
+    if data.startswith(MAGIC):
+        return data
+
+    block = None
+    current = None
+    for line in data.decode("latin-1").splitlines():
+        position = line.find("@trace")
+        if position < 0:
+            continue
+        line = line[position:].strip()
+        if line.startswith("@trace-begin"):
+            current = bytearray()
+        elif line.startswith("@trace-end"):
+            if current is not None:
+                block = bytes(current)
+            current = None
+        elif current is not None:
+            current += bytes.fromhex(line[len("@trace"):].strip())
+    if block is None:
+        sys.exit("%s: no contiene un registro completo entre @trace-begin y @trace-end" % path)
+    return block
+
+
+def decode(data):
+    """Separa la cabecera, los nombres y los eventos en orden cronologico"""
+    if len(data) < HEADER.size or not data.startswith(MAGIC):
+        sys.exit("el registro no comienza con %r, ¿se inicio el registro?" % MAGIC.rstrip(b"\0"))
+    (_, version, frequency, capacity, name_length, max_tasks, max_queues, tasks, queues, written,
+     _) = HEADER.unpack_from(data)
+    if version != 1:
+        sys.exit("versión de registro %d no soportada" % version)
+
+    def names(offset, count):
+        result = []
+        for index in range(count):
+            raw = data[offset + index * name_length:offset + (index + 1) * name_length]
+            result.append(raw.split(b"\0")[0].decode("latin-1"))
+        return result
+
+    offset = HEADER.size
+    task_names = names(offset, max_tasks)
+    offset += max_tasks * name_length
+    queue_names = names(offset, max_queues)
+    offset += max_queues * name_length
+    offset = (offset + 3) & ~3
+
+    if len(data) < offset + capacity * RECORD.size:
+        sys.exit("registro incompleto: %d bytes de %d" % (len(data), offset + capacity * RECORD.size))
+    records = [RECORD.unpack_from(data, offset + index * RECORD.size) for index in range(capacity)]
+    if written > capacity:
+        first = written % capacity
+        records = records[first:] + records[:first]
+    else:
+        records = records[:written]
+
+    # El contador de ciclos es de 32 bits: se extiende sumando la diferencia
+    # con signo entre eventos consecutivos, lo que tolera los pares que una
+    # interrupción dejo con los tiempos invertidos.
+    events = []
+    now = 0
+    previous = records[0][0] if records else 0
+    for time, event in records:
+        delta = (time - previous) & 0xFFFFFFFF
+        if delta >= 0x80000000:
+            delta -= 0x100000000
+        now += delta
+        previous = time
+        events.append((now, event >> 24, event & 0x00FFFFFF))
+    events.sort(key=lambda item: item[0])
+    if events:
+        start = events[0][0]
+        events = [(time - start, code, argument) for time, code, argument in events]
+
+    return {
+        "frequency": frequency,
+        "task_names": task_names,
+        "queue_names": queue_names,
+        "tasks": tasks,
+        "queues": queues,
+        "written": written,
+        "capacity": capacity,
+        "events": events,
+    }
+
+
+def task_name(trace, number):
+    if 0 < number <= len(trace["task_names"]) and trace["task_names"][number - 1]:
+        return trace["task_names"][number - 1]
+    return "task %d" % number
+
+
+def queue_name(trace, number, types):
+    if 0 < number <= len(trace["queue_names"]) and trace["queue_names"][number - 1]:
+        return trace["queue_names"][number - 1]
+    return "%s %d" % (types.get(number, "queue"), number)
+
+
+def isr_name(number):
+    if number in EXCEPTIONS:
+        return EXCEPTIONS[number]
+    if number >= 16:
+        return "IRQ %d" % (number - 16)
+    return "ISR %d" % number
+
+
+def convert(trace):
+    """Genera los eventos JSON y el tiempo de procesador de cada tarea"""
+    scale = 1e6 / trace["frequency"]
+    output = []
+    busy = {}
+    types = {}
+    current = None
+    running_since = None
+    isr_stack = []
+    last = 0
+
+    def close(time):
+        if current is not None and running_since is not None:
+            output.append({"name": task_name(trace, current), "ph": "X", "pid": PID, "tid": current,
+                           "ts": running_since * scale, "dur": (time - running_since) * scale})
+            busy[current] = busy.get(current, 0) + time - running_since
+
+    for time, code, argument in trace["events"]:
+        last = time
+        tid = ISR_TID if isr_stack else (current if current is not None else ISR_TID)
+        if code == TASK_SWITCHED_IN:
+            current = argument
+            running_since = time
+        elif code == TASK_SWITCHED_OUT:
+            if current == argument:
+                close(time)
+            current = argument
+            running_since = None
+        elif code == TASK_CREATE or code == TASK_DELETE:
+            output.append({"name": "create" if code == TASK_CREATE else "delete", "ph": "i", "s": "t",
+                           "pid": PID, "tid": argument, "ts": time * scale})
+        elif code == QUEUE_CREATE:
+            number = argument & 0xFFFF
+            kind = argument >> 16
+            types[number] = QUEUE_TYPES[kind] if kind < len(QUEUE_TYPES) else "queue"
+        elif code in QUEUE_EVENTS:
+            output.append({"name": "%s %s" % (QUEUE_EVENTS[code], queue_name(trace, argument, types)),
+                           "ph": "i", "s": "t", "pid": PID, "tid": tid, "ts": time * scale,
+                           "args": {"queue": argument}})
+        elif code == ISR_ENTER:
+            isr_stack.append(argument)
+            output.append({"name": isr_name(argument), "ph": "B", "pid": PID, "tid": ISR_TID,
+                           "ts": time * scale})
+        elif code == ISR_EXIT:
+            if isr_stack:
+                isr_stack.pop()
+                output.append({"name": isr_name(argument), "ph": "E", "pid": PID, "tid": ISR_TID,
+                               "ts": time * scale})
+        elif code == USER:
+            output.append({"name": "user", "ph": "i", "s": "t", "pid": PID, "tid": tid,
+                           "ts": time * scale, "args": {"value": argument}})
+    close(last)
+
+    numbers = set(event["tid"] for event in output if event["tid"] != ISR_TID)
+    metadata = [{"name": "process_name", "ph": "M", "pid": PID, "args": {"name": "FreeRTOS"}},
+                {"name": "thread_name", "ph": "M", "pid": PID, "tid": ISR_TID,
+                 "args": {"name": "Interrupciones"}}]
+    for number in sorted(numbers):
+        metadata.append({"name": "thread_name", "ph": "M", "pid": PID, "tid": number,
+                         "args": {"name": task_name(trace, number)}})
+        metadata.append({"name": "thread_sort_index", "ph": "M", "pid": PID, "tid": number,
+                         "args": {"sort_index": number}})
+    return metadata + output, busy, last
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="copia binaria de trace_recorder o texto con lineas @trace")
+    parser.add_argument("-o", "--output", default=None, help="archivo JSON, por defecto trace.json")
+    arguments = parser.parse_args()
+
+    trace = decode(read_input(arguments.input))
+    events, busy, span = convert(trace)
+    output = arguments.output or "trace.json"
+    with open(output, "w") as file:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, file)
+
+    lost = max(0, trace["written"] - trace["capacity"])
+    print("%s: %d eventos en %.3f ms, %d sobreescritos, %d tareas, %d colas" % (
+        output, len(trace["events"]), span * 1e3 / trace["frequency"], lost, trace["tasks"],
+        trace["queues"]))
+    for number in sorted(busy, key=lambda item: -busy[item]):
+        print("  %-16s %6.2f %%" % (task_name(trace, number), 100.0 * busy[number] / span if span else 0))
+
+
+if __name__ == "__main__":
+    main()